@@ -52,7 +52,7 @@ print OUT qq| * Generated     : $now_string
 my $sb = stat($INFILE);
 print OUT "\/\*\@unused\@\*\/ static const char* libieee_oui_status __attribute__ ((__unused__)) = \"OUI/" . strftime("%Y%m%d", localtime($sb->mtime)) . "\";\n";
 
-# Structure
+# Structure (entries sorted by id)
 print OUT qq|
 
 static const s_ieee_oui libieee_oui[] = {
@@ -63,6 +63,9 @@ my ($a, $b, $c);
 my ($t1, $t2, $t3);
 my $oui;
 
+# entries, sorted by OUI on output (required by binary search in lookup)
+my %entries;
+
 # Data
 my $i = 0;
 my $m = 0;
@@ -188,7 +191,10 @@ while (<IN>) {
 		# escape "
 		$t3 =~ s/"/\\"/g;
 	
-		print OUT "\t{ 0x" . $a . $b . $c . ", \"$t3\", \"$oui\" },\n";
+		# first entry wins on duplicate OUI
+		if (! defined $entries{uc($a . $b . $c)}) {
+			$entries{uc($a . $b . $c)} = "\t{ 0x" . $a . $b . $c . ", \"$t3\", \"$oui\" },\n";
+		};
 	};
 };
 
@@ -196,7 +202,11 @@ while (<IN>) {
 if ($flag_qemu == 0) {
 	# print missing qemu
 	$a = "52"; $b = "54"; $c = "00"; $t3 = "possible QEMU VM"; $oui = "QEMU-VIRTUAL";
-	print OUT "\t{ 0x" . $a . $b . $c . ", \"$t3\", \"$oui\" },\n";
+	$entries{uc($a . $b . $c)} = "\t{ 0x" . $a . $b . $c . ", \"$t3\", \"$oui\" },\n";
+};
+
+foreach my $key (sort keys %entries) {
+	print OUT $entries{$key};
 };
 
 print OUT qq|
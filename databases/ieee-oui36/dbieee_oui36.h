@@ -13,2889 +13,2889 @@
 
 
 static const s_ieee_oui36 libieee_oui36[] = {
-	{ 0x70B3D5, 0x913000, 0x913FFF, "Shenzhen Riitek Technology Co.,Ltd", "SHENZHEN-RIITEK" },
-	{ 0x70B3D5, 0x88A000, 0x88AFFF, "Perceptics, LLC", "PERCEPTICS-LLC" },
-	{ 0x70B3D5, 0x001000, 0x001FFF, "SOREDI touch systems GmbH", "SOREDI-TOUCH" },
-	{ 0x70B3D5, 0xD70000, 0xD70FFF, "Rational Production srl Unipersonale", "RATIONAL-PRODUCTION-SRL-UNIPERSONALE" },
-	{ 0x70B3D5, 0x426000, 0x426FFF, "Zehnder Group Nederland", "ZEHNDER-GROUP-NEDERLAND" },
-	{ 0x70B3D5, 0x266000, 0x266FFF, "Spectra Displays Ltd", "SPECTRA-DISPLAYS" },
-	{ 0x70B3D5, 0xD38000, 0xD38FFF, "Vista Research, Inc.", "VISTA-RESEARCH" },
-	{ 0x70B3D5, 0x996000, 0x996FFF, "XpertSea Solutions inc.", "XPERTSEA-SOLUTIONS" },
-	{ 0x70B3D5, 0x605000, 0x605FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x16E000, 0x16EFFF, "Jemac Sweden AB", "JEMAC-SWEDEN-AB" },
-	{ 0x70B3D5, 0x671000, 0x671FFF, "Sea Shell Corporation", "SEA-SHELL" },
-	{ 0x70B3D5, 0x7EC000, 0x7ECFFF, "GRIDSMART Technologies", "GRIDSMART-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xAF9000, 0xAF9FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0xD59000, 0xD59FFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xA3C000, 0xA3CFFF, "Wave Music Ltd", "WAVE-MUSIC" },
-	{ 0x70B3D5, 0xFC1000, 0xFC1FFF, "InDiCor", "INDICOR" },
-	{ 0x70B3D5, 0x14F000, 0x14FFFF, "Mobile Devices Unlimited", "MOBILE-DEVICES-UNLIMITED" },
-	{ 0x70B3D5, 0x891000, 0x891FFF, "neocontrol soluções em automação", "NEOCONTROL-SOLUçõES-EM-AUTOMAçãO" },
-	{ 0x70B3D5, 0x01E000, 0x01EFFF, "ePOINT Embedded Computing Limited", "EPOINT-EMBEDDED-COMPUTING" },
-	{ 0x70B3D5, 0x34C000, 0x34CFFF, "GLT Exports Ltd", "GLT-EXPORTS" },
-	{ 0x70B3D5, 0xB51000, 0xB51FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0xD29000, 0xD29FFF, "Sportzcast", "SPORTZCAST" },
-	{ 0x70B3D5, 0x13B000, 0x13BFFF, "Sienna Corporation", "SIENNA" },
-	{ 0x70B3D5, 0x37F000, 0x37FFFF, "IDS Innomic GmbH", "IDS-INNOMIC" },
-	{ 0x70B3D5, 0x694000, 0x694FFF, "MoviTHERM", "MOVITHERM" },
-	{ 0x70B3D5, 0xB28000, 0xB28FFF, "HUSTY M.Styczen J.Hupert sp.j.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x70B3D5, 0x14E000, 0x14EFFF, "Innosonix GmbH", "INNOSONIX" },
-	{ 0x70B3D5, 0x185000, 0x185FFF, "R&D Gran-System-S LLC", "R-D-GRAN-SYSTEM-S-LLC" },
-	{ 0x70B3D5, 0x5B1000, 0x5B1FFF, "EPD Electronics", "EPD-ELECTRONICS" },
-	{ 0x70B3D5, 0xEAE000, 0xEAEFFF, "Orlaco Products B.V.", "ORLACO-PRODUCTS" },
-	{ 0x70B3D5, 0x57D000, 0x57DFFF, "WICOM1 GmbH", "WICOM1" },
-	{ 0x70B3D5, 0xE77000, 0xE77FFF, "OPTIX JSC", "OPTIX-JSC" },
-	{ 0x70B3D5, 0x740000, 0x740FFF, "Prisma Telecom Testing Srl", "PRISMA-TELECOM-TESTING-SRL" },
-	{ 0x70B3D5, 0x84E000, 0x84EFFF, "Chromalox, Inc.", "CHROMALOX" },
-	{ 0x70B3D5, 0x817000, 0x817FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x43B000, 0x43BFFF, "Kalycito Infotech Private Limited", "KALYCITO-INFOTECH-PRIVATE" },
-	{ 0x70B3D5, 0xC88000, 0xC88FFF, "SINED srl", "SINED-SRL" },
-	{ 0x70B3D5, 0xCD6000, 0xCD6FFF, "VideoRay LLC", "VIDEORAY-LLC" },
-	{ 0x70B3D5, 0xA1D000, 0xA1DFFF, "Fluid Components International", "FLUID-COMPONENTS" },
-	{ 0x70B3D5, 0x079000, 0x079FFF, "CheckBill Co,Ltd.", "CHECKBILL" },
-	{ 0x70B3D5, 0x8FF000, 0x8FFFFF, "IMST GmbH", "IMST" },
-	{ 0x70B3D5, 0xDC0000, 0xDC0FFF, "ATEME", "ATEME" },
-	{ 0x70B3D5, 0xF79000, 0xF79FFF, "Firehose Labs, Inc.", "FIREHOSE-LABS" },
-	{ 0x70B3D5, 0x404000, 0x404FFF, "RANIX,Inc.", "RANIX" },
-	{ 0x70B3D5, 0x52D000, 0x52DFFF, "Tanaka Electric Industry Co., Ltd.", "TANAKA-ELECTRIC-INDUSTRY" },
-	{ 0x70B3D5, 0xBE5000, 0xBE5FFF, "Pantec Engineering AG", "PANTEC-ENGINEERING" },
-	{ 0x70B3D5, 0xD90000, 0xD90FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x45F000, 0x45FFFF, "Cloud4Wi", "CLOUD4WI" },
-	{ 0x70B3D5, 0x35E000, 0x35EFFF, "EIDOS s.p.a.", "EIDOS-S-P-A" },
-	{ 0x70B3D5, 0xF96000, 0xF96FFF, "Ecologicsense", "ECOLOGICSENSE" },
-	{ 0x70B3D5, 0x0D8000, 0x0D8FFF, "Laser Imagineering GmbH", "LASER-IMAGINEERING" },
-	{ 0x70B3D5, 0x7E4000, 0x7E4FFF, "C21 Systems Ltd", "C21" },
-	{ 0x70B3D5, 0x995000, 0x995FFF, "LayTec AG", "LAYTEC" },
-	{ 0x70B3D5, 0x957000, 0x957FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
-	{ 0x70B3D5, 0x4DD000, 0x4DDFFF, "Road-iQ, LLC", "ROAD-IQ-LLC" },
-	{ 0x70B3D5, 0xFBA000, 0xFBAFFF, "Apogee Applied Research, Inc.", "APOGEE-APPLIED-RESEARCH" },
-	{ 0x70B3D5, 0x63B000, 0x63BFFF, "Lazer Safe Pty Ltd", "LAZER-SAFE-PTY" },
-	{ 0x70B3D5, 0x6D1000, 0x6D1FFF, "Visual Engineering Technologies Ltd", "VISUAL-ENGINEERING-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x0DF000, 0x0DFFFF, "B.E.A. sa", "B-E-A" },
-	{ 0x70B3D5, 0x342000, 0x342FFF, "Solectrix", "SOLECTRIX" },
-	{ 0x70B3D5, 0xE20000, 0xE20FFF, "Signature Control Systems, LLC.", "SIGNATURE-CONTROL-LLC" },
-	{ 0x70B3D5, 0x538000, 0x538FFF, "sydetion UG (h.b.)", "SYDETION-UG-H-B" },
-	{ 0x70B3D5, 0x2DC000, 0x2DCFFF, "Bolide Technology Group, Inc.", "BOLIDE-GROUP" },
-	{ 0x70B3D5, 0xB85000, 0xB85FFF, "Fenotech Inc.", "FENOTECH" },
-	{ 0x70B3D5, 0x2EE000, 0x2EEFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x1E5000, 0x1E5FFF, "VendNovation LLC", "VENDNOVATION-LLC" },
-	{ 0x70B3D5, 0xFE7000, 0xFE7FFF, "VEILUX INC.", "VEILUX" },
-	{ 0x70B3D5, 0x08F000, 0x08FFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0xE55000, 0xE55FFF, "BELT S.r.l.", "BELT-S-R-L" },
-	{ 0x70B3D5, 0x88F000, 0x88FFFF, "Quaesta Instruments, LLC", "QUAESTA-INSTRUMENTS-LLC" },
-	{ 0x70B3D5, 0x835000, 0x835FFF, "CommBox P/L", "COMMBOX-P/L" },
-	{ 0x70B3D5, 0x730000, 0x730FFF, "Videogenix", "VIDEOGENIX" },
-	{ 0x70B3D5, 0x5A9000, 0x5A9FFF, "Bunka Shutter Co., Ltd.", "BUNKA-SHUTTER" },
-	{ 0x70B3D5, 0x714000, 0x714FFF, "Alturna Networks", "ALTURNA-NETWORKS" },
-	{ 0x70B3D5, 0x2A7000, 0x2A7FFF, "Plasmability, LLC", "PLASMABILITY-LLC" },
-	{ 0x70B3D5, 0xD7A000, 0xD7AFFF, "Speedifi Inc", "SPEEDIFI" },
-	{ 0x70B3D5, 0x737000, 0x737FFF, "SD Biosensor", "SD-BIOSENSOR" },
-	{ 0x70B3D5, 0x6DA000, 0x6DAFFF, "Enovative Networks, Inc.", "ENOVATIVE-NETWORKS" },
-	{ 0x70B3D5, 0x0D7000, 0x0D7FFF, "Russian Telecom Equipment Company", "RUSSIAN-TELECOM-EQUIPMENT-COMPANY" },
-	{ 0x70B3D5, 0x46F000, 0x46FFFF, "serva transport systems GmbH", "SERVA-TRANSPORT" },
-	{ 0x70B3D5, 0xA00000, 0xA00FFF, "ATX NETWORKS LTD", "ATX-NETWORKS" },
-	{ 0x70B3D5, 0x1AF000, 0x1AFFFF, "Teenage Engineering AB", "TEENAGE-ENGINEERING-AB" },
-	{ 0x70B3D5, 0xD9C000, 0xD9CFFF, "Subinitial LLC", "SUBINITIAL-LLC" },
-	{ 0x70B3D5, 0x923000, 0x923FFF, "eumig industrie-tv GmbH", "EUMIG-INDUSTRIE-TV" },
-	{ 0x70B3D5, 0x78B000, 0x78BFFF, "Jingtu Printing Systems Co., Ltd", "JINGTU-PRINTING" },
-	{ 0x70B3D5, 0x4BB000, 0x4BBFFF, "Plazma-T", "PLAZMA-T" },
-	{ 0x70B3D5, 0xDF2000, 0xDF2FFF, "AML", "AML" },
-	{ 0x70B3D5, 0xCB8000, 0xCB8FFF, "Verti Tecnologia", "VERTI-TECNOLOGIA" },
-	{ 0x70B3D5, 0xA97000, 0xA97FFF, "Bizwerks, LLC", "BIZWERKS-LLC" },
-	{ 0x70B3D5, 0x417000, 0x417FFF, "Figment Design Laboratories", "FIGMENT-DESIGN-LABORATORIES" },
-	{ 0x70B3D5, 0xCF6000, 0xCF6FFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
-	{ 0x70B3D5, 0x91E000, 0x91EFFF, "Creotech Instruments S.A.", "CREOTECH-INSTRUMENTS" },
-	{ 0x70B3D5, 0x775000, 0x775FFF, "Sonel S.A.", "SONEL" },
-	{ 0x70B3D5, 0x5FD000, 0x5FDFFF, "Windar Photonics", "WINDAR-PHOTONICS" },
-	{ 0x70B3D5, 0x078000, 0x078FFF, "OrbiWise SA", "ORBIWISE" },
-	{ 0x70B3D5, 0xB78000, 0xB78FFF, "HOERMANN GmbH", "HOERMANN" },
-	{ 0x70B3D5, 0xD61000, 0xD61FFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0xF78000, 0xF78FFF, "Manvish eTech Pvt. Ltd.", "MANVISH-ETECH-PVT" },
-	{ 0x70B3D5, 0x146000, 0x146FFF, "3City Electronics", "3CITY-ELECTRONICS" },
-	{ 0x70B3D5, 0x15F000, 0x15FFFF, "SAVRONİK ELEKTRONİK", "SAVRONİK-ELEKTRONİK" },
-	{ 0x70B3D5, 0x4DC000, 0x4DCFFF, "JK DEVICE CORPORATION", "JK-DEVICE" },
-	{ 0x70B3D5, 0x875000, 0x875FFF, "Peek Traffic", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0x6A5000, 0x6A5FFF, "Akenori PTE LTD", "AKENORI-PTE" },
-	{ 0x70B3D5, 0x6E0000, 0x6E0FFF, "ABB SPA - DMPC", "ABB-SPA---DMPC" },
-	{ 0x70B3D5, 0xC5B000, 0xC5BFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x70B3D5, 0x030000, 0x030FFF, "Tresent Technologies", "TRESENT-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x7CD000, 0x7CDFFF, "Molekuler Goruntuleme A.S.", "MOLEKULER-GORUNTULEME-A-S" },
-	{ 0x70B3D5, 0x5EA000, 0x5EAFFF, "KYS,INC", "KYS" },
-	{ 0x70B3D5, 0x7B3000, 0x7B3FFF, "BroadSoft Inc", "BROADSOFT" },
-	{ 0x70B3D5, 0xC39000, 0xC39FFF, "MeshWorks Wireless Oy", "MESHWORKS-WIRELESS-OY" },
-	{ 0x70B3D5, 0x660000, 0x660FFF, "Smart Service Technologies CO., LTD", "SMART-SERVICE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xEFE000, 0xEFEFFF, "MEIDEN SYSTEM SOLUTIONS", "MEIDEN-SYSTEM-SOLUTIONS" },
-	{ 0x70B3D5, 0xC03000, 0xC03FFF, "XAVi Technologies Corp.", "XAVI-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x0FF000, 0x0FFFFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x70B3D5, 0x502000, 0x502FFF, "Glidewell Laboratories", "GLIDEWELL-LABORATORIES" },
-	{ 0x70B3D5, 0x6F8000, 0x6F8FFF, "SENSEON Corporation", "SENSEON" },
-	{ 0x70B3D5, 0x35D000, 0x35DFFF, "Fresh Idea Factory BV", "FRESH-IDEA-FACTORY" },
-	{ 0x70B3D5, 0x344000, 0x344FFF, "IHI Inspection & Instrumentation Co., Ltd.", "IHI-INSPECTION-INSTRUMENTATION" },
-	{ 0x70B3D5, 0x3DB000, 0x3DBFFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x4CD000, 0x4CDFFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0x22E000, 0x22EFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xEA3000, 0xEA3FFF, "Gridless Power Corperation", "GRIDLESS-POWER-CORPERATION" },
-	{ 0x70B3D5, 0xA5A000, 0xA5AFFF, "RCS Energy Management Ltd", "RCS-ENERGY-MANAGEMENT" },
-	{ 0x70B3D5, 0x13A000, 0x13AFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x75D000, 0x75DFFF, "Nanjing Magewell Electronics Co., Ltd.", "NANJING-MAGEWELL-ELECTRONICS" },
-	{ 0x70B3D5, 0x0EC000, 0x0ECFFF, "ACS MOTION CONTROL", "ACS-MOTION-CONTROL" },
-	{ 0x70B3D5, 0x1F5000, 0x1F5FFF, "Martec S.p.A.", "MARTEC-S-P-A" },
-	{ 0x70B3D5, 0x22B000, 0x22BFFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0x708000, 0x708FFF, "IBM Research GmbH", "IBM-RESEARCH" },
-	{ 0x70B3D5, 0xC81000, 0xC81FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x70B3D5, 0xFA1000, 0xFA1FFF, "BBI Engineering, Inc.", "BBI-ENGINEERING" },
-	{ 0x70B3D5, 0x60C000, 0x60CFFF, "IST ElektronikgesmbH", "IST-ELEKTRONIKGESMBH" },
-	{ 0x70B3D5, 0x936000, 0x936FFF, "FARO TECHNOLOGIES, INC.", "FARO-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xEF2000, 0xEF2FFF, "Kongsberg Intergrated Tactical Systems", "KONGSBERG-INTERGRATED-TACTICAL" },
-	{ 0x70B3D5, 0xC58000, 0xC58FFF, "RMI Laser LLC", "RMI-LASER-LLC" },
-	{ 0x70B3D5, 0x507000, 0x507FFF, "Human Oriented Technology, Inc.", "HUMAN-ORIENTED" },
-	{ 0x70B3D5, 0xBC6000, 0xBC6FFF, "Hatteland Display AS", "HATTELAND-DISPLAY-AS" },
-	{ 0x70B3D5, 0x55D000, 0x55DFFF, "LunaNexus Inc", "LUNANEXUS" },
-	{ 0x70B3D5, 0xDF3000, 0xDF3FFF, "SPC Bioclinicum", "SPC-BIOCLINICUM" },
-	{ 0x70B3D5, 0xCF1000, 0xCF1FFF, "LightDec GmbH & Co. KG", "LIGHTDEC" },
-	{ 0x70B3D5, 0x8DC000, 0x8DCFFF, "Niveo International BV", "NIVEO" },
-	{ 0x70B3D5, 0xD1E000, 0xD1EFFF, "Houston Radar LLC", "HOUSTON-RADAR-LLC" },
-	{ 0x70B3D5, 0x54D000, 0x54DFFF, "Qingdao Haitian Weiye Automation Control System Co., Ltd", "QINGDAO-HAITIAN-WEIYE-AUTOMATION-CONTROL-SYSTEM" },
-	{ 0x70B3D5, 0xA15000, 0xA15FFF, "Intercore GmbH", "INTERCORE" },
-	{ 0x70B3D5, 0x45E000, 0x45EFFF, "eSOL Co.,Ltd.", "ESOL" },
-	{ 0x70B3D5, 0xB88000, 0xB88FFF, "ARP Corporation", "ARP" },
-	{ 0x70B3D5, 0xBBE000, 0xBBEFFF, "Sunrise Systems Electronics Co. Inc.", "SUNRISE-ELECTRONICS" },
-	{ 0x70B3D5, 0xCBC000, 0xCBCFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
-	{ 0x70B3D5, 0x2DA000, 0x2DAFFF, "Skywave Networks Private Limited", "SKYWAVE-NETWORKS-PRIVATE" },
-	{ 0x70B3D5, 0xB08000, 0xB08FFF, "Secuinfo Co. Ltd", "SECUINFO" },
-	{ 0x70B3D5, 0x33C000, 0x33CFFF, "Videri Inc.", "VIDERI" },
-	{ 0x70B3D5, 0x3E5000, 0x3E5FFF, "ATEME", "ATEME" },
-	{ 0x70B3D5, 0xFC5000, 0xFC5FFF, "Eltwin A/S", "ELTWIN-A/S" },
-	{ 0x70B3D5, 0xECF000, 0xECFFFF, "Ipitek", "IPITEK" },
-	{ 0x70B3D5, 0x099000, 0x099FFF, "Schwer+Kopka GmbH", "SCHWER+KOPKA" },
-	{ 0x70B3D5, 0x7E7000, 0x7E7FFF, "Atessa, Inc.", "ATESSA" },
-	{ 0x70B3D5, 0x39B000, 0x39BFFF, "IROC AB", "IROC-AB" },
-	{ 0x70B3D5, 0x3CE000, 0x3CEFFF, "Aditec GmbH", "ADITEC" },
-	{ 0x70B3D5, 0x190000, 0x190FFF, "Fantom Wireless, Inc.", "FANTOM-WIRELESS" },
-	{ 0x70B3D5, 0x6B6000, 0x6B6FFF, "INRADIOS GmbH", "INRADIOS" },
-	{ 0x70B3D5, 0x29D000, 0x29DFFF, "XTech2 SIA", "XTECH2-SIA" },
-	{ 0x70B3D5, 0x814000, 0x814FFF, "Ingenieurbuero SOMTRONIK", "INGENIEURBUERO-SOMTRONIK" },
-	{ 0x70B3D5, 0x42F000, 0x42FFFF, "SINTOKOGIO, LTD", "SINTOKOGIO" },
-	{ 0x70B3D5, 0x702000, 0x702FFF, "Sensor Highway Ltd", "SENSOR-HIGHWAY" },
-	{ 0x70B3D5, 0x0E0000, 0x0E0FFF, "PLCiS", "PLCIS" },
-	{ 0x70B3D5, 0xEDC000, 0xEDCFFF, "J.D. Koftinoff Software, Ltd.", "J-D-KOFTINOFF-SOFTWARE" },
-	{ 0x001BC5, 0x0C9000, 0x0C9FFF, "UAB Kitron", "UAB-KITRON" },
-	{ 0x001BC5, 0x0C8000, 0x0C8FFF, "Dialine", "DIALINE" },
-	{ 0x70B3D5, 0x51E000, 0x51EFFF, "Fundación Cardiovascular de Colombia", "FUNDACIóN-CARDIOVASCULAR-DE-COLOMBIA" },
-	{ 0x70B3D5, 0xEB0000, 0xEB0FFF, "Nautel Limted", "NAUTEL-LIMTED" },
-	{ 0x70B3D5, 0x625000, 0x625FFF, "VX Instruments GmbH", "VX-INSTRUMENTS" },
-	{ 0x70B3D5, 0xD86000, 0xD86FFF, "WPGSYS Pte Ltd", "WPGSYS-PTE" },
-	{ 0x70B3D5, 0x4C8000, 0x4C8FFF, "Hosokawa Micron Powder Systems", "HOSOKAWA-MICRON-POWDER" },
-	{ 0x001BC5, 0x0B4000, 0x0B4FFF, "COBAN SRL", "COBAN-SRL" },
-	{ 0x001BC5, 0x0AE000, 0x0AEFFF, "Techlan Reti s.r.l.", "TECHLAN-RETI-S-R-L" },
-	{ 0x001BC5, 0x0C2000, 0x0C2FFF, "TechSolutions A/S", "TECHSOLUTIONS-A/S" },
-	{ 0x001BC5, 0x0BF000, 0x0BFFFF, "TN Core Co.,Ltd.", "TN-CORE" },
-	{ 0x001BC5, 0x0BE000, 0x0BEFFF, "YESpay International Ltd", "YESPAY" },
-	{ 0x001BC5, 0x0B9000, 0x0B9FFF, "Denki Kogyo Company, Limited", "DENKI-KOGYO-COMPANY" },
-	{ 0x001BC5, 0x0B8000, 0x0B8FFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x0B5000, 0x0B5FFF, "Exibea AB", "EXIBEA-AB" },
-	{ 0x001BC5, 0x0C3000, 0x0C3FFF, "inomatic GmbH", "INOMATIC" },
-	{ 0x001BC5, 0x0AF000, 0x0AFFFF, "Enerwise Solutions Ltd.", "ENERWISE-SOLUTIONS" },
-	{ 0x001BC5, 0x0A5000, 0x0A5FFF, "Tesla Controls", "TESLA-CONTROLS" },
-	{ 0x001BC5, 0x0A0000, 0x0A0FFF, "HomerSoft sp. z o.o.", "HOMERSOFT-SP-Z-O-O" },
-	{ 0x001BC5, 0x09F000, 0x09FFFF, "ENTE Sp. z o.o.", "ENTE-SP-Z-O-O" },
-	{ 0x001BC5, 0x0AB000, 0x0ABFFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x0AA000, 0x0AAFFF, "Senceive Ltd", "SENCEIVE" },
-	{ 0x001BC5, 0x0A4000, 0x0A4FFF, "RADMOR S.A.", "RADMOR" },
-	{ 0x001BC5, 0x09A000, 0x09AFFF, "Shenzhen Guang Lian Zhi Tong Limited", "SHENZHEN-GUANG-LIAN-ZHI-TONG" },
-	{ 0x001BC5, 0x099000, 0x099FFF, "UAB Kitron", "UAB-KITRON" },
-	{ 0x001BC5, 0x098000, 0x098FFF, "Cubic Systems, Inc.", "CUBIC" },
-	{ 0x001BC5, 0x096000, 0x096FFF, "Sanstreak Corp.", "SANSTREAK" },
-	{ 0x001BC5, 0x095000, 0x095FFF, "PREVAC sp. z o.o.", "PREVAC-SP-Z-O-O" },
-	{ 0x001BC5, 0x08F000, 0x08FFFF, "Unilever R&amp;D", "UNILEVER-R-AMP-D" },
-	{ 0x001BC5, 0x08E000, 0x08EFFF, "TrendPoint Systems", "TRENDPOINT" },
-	{ 0x001BC5, 0x08B000, 0x08BFFF, "Nistica", "NISTICA" },
-	{ 0x001BC5, 0x090000, 0x090FFF, "Seven Solutions S.L", "SEVEN-SOLUTIONS-S-L" },
-	{ 0x001BC5, 0x07D000, 0x07DFFF, "Greatcom AG", "GREATCOM" },
-	{ 0x001BC5, 0x079000, 0x079FFF, "HPI High Pressure Instrumentation GmbH", "HPI-HIGH-PRESSURE-INSTRUMENTATION" },
-	{ 0x001BC5, 0x083000, 0x083FFF, "DIWEL", "DIWEL" },
-	{ 0x001BC5, 0x065000, 0x065FFF, "Plair Media Inc.", "PLAIR-MEDIA" },
-	{ 0x001BC5, 0x06F000, 0x06FFFF, "LLC Emzior", "LLC-EMZIOR" },
-	{ 0x001BC5, 0x073000, 0x073FFF, "tado GmbH", "TADO" },
-	{ 0x001BC5, 0x069000, 0x069FFF, "Datasat Digital Entertainment", "DATASAT-DIGITAL-ENTERTAINMENT" },
-	{ 0x001BC5, 0x051000, 0x051FFF, "QQ Navigation AB", "QQ-NAVIGATION-AB" },
-	{ 0x001BC5, 0x05F000, 0x05FFFF, "Klingenthaler Musikelektronik GmbH", "KLINGENTHALER-MUSIKELEKTRONIK" },
-	{ 0x001BC5, 0x05B000, 0x05BFFF, "konzeptpark GmbH", "KONZEPTPARK" },
-	{ 0x001BC5, 0x055000, 0x055FFF, "LUMIPLAN TRANSPORT", "LUMIPLAN-TRANSPORT" },
-	{ 0x001BC5, 0x047000, 0x047FFF, "PT. Amanindo Nusapadu", "PT-AMANINDO-NUSAPADU" },
-	{ 0x001BC5, 0x04B000, 0x04BFFF, "Silicon Controls", "SILICON-CONTROLS" },
-	{ 0x001BC5, 0x041000, 0x041FFF, "DesignA Electronics Limited", "DESIGNA-ELECTRONICS" },
-	{ 0x001BC5, 0x03D000, 0x03DFFF, "rioxo GmbH", "RIOXO" },
-	{ 0x001BC5, 0x03C000, 0x03CFFF, "Xiphos Systems Corp.", "XIPHOS" },
-	{ 0x001BC5, 0x037000, 0x037FFF, "ITW Reyflex North America", "ITW-REYFLEX-NORTH-AMERICA" },
-	{ 0x001BC5, 0x033000, 0x033FFF, "JE Suunnittelu Oy", "JE-SUUNNITTELU-OY" },
-	{ 0x001BC5, 0x032000, 0x032FFF, "Osborne Coinage Co", "OSBORNE-COINAGE" },
-	{ 0x001BC5, 0x036000, 0x036FFF, "LOMAR SRL", "LOMAR-SRL" },
-	{ 0x001BC5, 0x035000, 0x035FFF, "RTLS Ltd.", "RTLS" },
-	{ 0x001BC5, 0x02D000, 0x02DFFF, "DDTRONIK Dariusz Dowgiert", "DDTRONIK-DARIUSZ-DOWGIERT" },
-	{ 0x001BC5, 0x02C000, 0x02CFFF, "Care Everywhere LLC", "CARE-EVERYWHERE-LLC" },
-	{ 0x001BC5, 0x02B000, 0x02BFFF, "Saturn South Pty Ltd", "SATURN-SOUTH-PTY" },
-	{ 0x001BC5, 0x029000, 0x029FFF, "2 FRANCE MARINE", "2-FRANCE-MARINE" },
-	{ 0x001BC5, 0x028000, 0x028FFF, "STECHWIN.CO.LTD.", "STECHWIN" },
-	{ 0x001BC5, 0x017000, 0x017FFF, "cPacket Networks", "CPACKET-NETWORKS" },
-	{ 0x001BC5, 0x00E000, 0x00EFFF, "Vigor Electric Corp", "VIGOR-ELECTRIC" },
-	{ 0x001BC5, 0x013000, 0x013FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
-	{ 0x001BC5, 0x014000, 0x014FFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x000000, 0x000FFF, "Converging Systems Inc.", "CONVERGING" },
+	{ 0x001BC5, 0x001000, 0x001FFF, "OpenRB.com, Direct SIA", "OPENRB-COM-DIRECT-SIA" },
+	{ 0x001BC5, 0x002000, 0x002FFF, "GORAMO - Janusz Gorecki", "GORAMO---JANUSZ-GORECKI" },
+	{ 0x001BC5, 0x003000, 0x003FFF, "MicroSigns Technologies Inc", "MICROSIGNS-TECHNOLOGIES" },
+	{ 0x001BC5, 0x004000, 0x004FFF, "Intellvisions Software Ltd", "INTELLVISIONS-SOFTWARE" },
+	{ 0x001BC5, 0x005000, 0x005FFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x006000, 0x006FFF, "TRIAX-HIRSCHMANN Multi-Media GmbH", "TRIAX-HIRSCHMANN-MULTI-MEDIA" },
+	{ 0x001BC5, 0x007000, 0x007FFF, "Energy Aware Technology", "ENERGY-AWARE" },
+	{ 0x001BC5, 0x008000, 0x008FFF, "Dalaj Electro-Telecom", "DALAJ-ELECTRO-TELECOM" },
 	{ 0x001BC5, 0x009000, 0x009FFF, "Solomon Systech Pte Ltd", "SOLOMON-SYSTECH-PTE" },
 	{ 0x001BC5, 0x00A000, 0x00AFFF, "Mercury HMI Ltd", "MERCURY-HMI" },
+	{ 0x001BC5, 0x00B000, 0x00BFFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x00C000, 0x00CFFF, "Quantum Technology Sciences, Inc.", "QUANTUM-SCIENCES" },
 	{ 0x001BC5, 0x00D000, 0x00DFFF, "Advanced Scientific Concepts, Inc.", "ADVANCED-SCIENTIFIC-CONCEPTS" },
-	{ 0x001BC5, 0x004000, 0x004FFF, "Intellvisions Software Ltd", "INTELLVISIONS-SOFTWARE" },
-	{ 0x001BC5, 0x003000, 0x003FFF, "MicroSigns Technologies Inc", "MICROSIGNS-TECHNOLOGIES" },
-	{ 0x001BC5, 0x000000, 0x000FFF, "Converging Systems Inc.", "CONVERGING" },
-	{ 0x70B3D5, 0x41A000, 0x41AFFF, "HYOSUNG Power & Industrial Systems", "HYOSUNG-POWER-INDUSTRIAL" },
-	{ 0x70B3D5, 0xBAB000, 0xBABFFF, "Axotec Technologies GmbH", "AXOTEC-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x69E000, 0x69EFFF, "PTYPE Co., LTD.", "PTYPE" },
-	{ 0x70B3D5, 0x75C000, 0x75CFFF, "UPM Technology, Inc", "UPM" },
-	{ 0x70B3D5, 0x124000, 0x124FFF, "Forschungs- und Transferzentrum Leipzig e.V.", "FORSCHUNGS--UND-TRANSFERZENTRUM-LEIPZIG-E-V" },
-	{ 0x70B3D5, 0xF6D000, 0xF6DFFF, "Qowisio", "QOWISIO" },
-	{ 0x70B3D5, 0x578000, 0x578FFF, "IMAGE TECH CO.,LTD", "IMAGE-TECH" },
-	{ 0x70B3D5, 0x187000, 0x187FFF, "Elektronik & Präzisionsbau Saalfeld GmbH", "ELEKTRONIK-PRAEZISIONSBAU-SAALFELD" },
-	{ 0x70B3D5, 0x0EE000, 0x0EEFFF, "Picture Elements, Inc.", "PICTURE-ELEMENTS" },
-	{ 0x70B3D5, 0x28A000, 0x28AFFF, "Transit Solutions, LLC.", "TRANSIT-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0x5A0000, 0x5A0FFF, "Ascon Tecnologic S.r.l.", "ASCON-TECNOLOGIC-S-R-L" },
-	{ 0x70B3D5, 0xA6F000, 0xA6FFFF, "8Cups", "8CUPS" },
-	{ 0x70B3D5, 0x929000, 0x929FFF, "OutSys", "OUTSYS" },
-	{ 0x70B3D5, 0x120000, 0x120FFF, "GSP Sprachtechnologie GmbH", "GSP-SPRACHTECHNOLOGIE" },
-	{ 0x70B3D5, 0x23E000, 0x23EFFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
-	{ 0x70B3D5, 0xEA2000, 0xEA2FFF, "Transportal Solutions Ltd", "TRANSPORTAL-SOLUTIONS" },
-	{ 0x70B3D5, 0x45D000, 0x45DFFF, "Sensapex Oy", "SENSAPEX-OY" },
-	{ 0x70B3D5, 0x8B0000, 0x8B0FFF, "IES S.r.l.", "IES-S-R-L" },
-	{ 0x70B3D5, 0xFB6000, 0xFB6FFF, "KRONOTECH SRL", "KRONOTECH-SRL" },
-	{ 0x70B3D5, 0xEB7000, 0xEB7FFF, "Skreens", "SKREENS" },
-	{ 0x70B3D5, 0x38F000, 0x38FFFF, "Sorynorydotcom Inc", "SORYNORYDOTCOM" },
-	{ 0x70B3D5, 0x7E9000, 0x7E9FFF, "Mecsel Oy", "MECSEL-OY" },
-	{ 0x70B3D5, 0x06C000, 0x06CFFF, "AppTek", "APPTEK" },
-	{ 0x70B3D5, 0x818000, 0x818FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x895000, 0x895FFF, "Integrated Control Corp.", "INTEGRATED-CONTROL" },
-	{ 0x70B3D5, 0x232000, 0x232FFF, "UCONSYS", "UCONSYS" },
-	{ 0x70B3D5, 0x01A000, 0x01AFFF, "Cubro Acronet GesmbH", "CUBRO-ACRONET-GESMBH" },
-	{ 0x70B3D5, 0x37B000, 0x37BFFF, "Power Ltd.", "POWER" },
-	{ 0x70B3D5, 0xFCC000, 0xFCCFFF, "DIgSILENT GmbH", "DIGSILENT" },
-	{ 0x70B3D5, 0xFD8000, 0xFD8FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x76B000, 0x76BFFF, "EMPELOR GmbH", "EMPELOR" },
-	{ 0x70B3D5, 0x0B8000, 0x0B8FFF, "Lucas-Nülle GmbH", "LUCAS-NUELLE" },
-	{ 0x70B3D5, 0xFEB000, 0xFEBFFF, "Les distributions Multi-Secure incorporee", "LES-DISTRIBUTIONS-MULTI-SECURE-INCORPOREE" },
-	{ 0x70B3D5, 0x658000, 0x658FFF, "emperor brands", "EMPEROR-BRANDS" },
-	{ 0x70B3D5, 0x3A9000, 0x3A9FFF, "Vivalnk", "VIVALNK" },
+	{ 0x001BC5, 0x00E000, 0x00EFFF, "Vigor Electric Corp", "VIGOR-ELECTRIC" },
+	{ 0x001BC5, 0x00F000, 0x00FFFF, "Simavita Pty Ltd", "SIMAVITA-PTY" },
+	{ 0x001BC5, 0x010000, 0x010FFF, "Softel SA de CV", "SOFTEL-DE-CV" },
+	{ 0x001BC5, 0x011000, 0x011FFF, "OOO NPP Mera", "OOO-NPP-MERA" },
+	{ 0x001BC5, 0x012000, 0x012FFF, "Tokyo Cosmos Electric, Inc.", "TOKYO-COSMOS-ELECTRIC" },
+	{ 0x001BC5, 0x013000, 0x013FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
+	{ 0x001BC5, 0x014000, 0x014FFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x015000, 0x015FFF, "Corporate Systems Engineering", "CORPORATE-ENGINEERING" },
+	{ 0x001BC5, 0x016000, 0x016FFF, "Energotechnica OOO NPP Ltd", "ENERGOTECHNICA-OOO-NPP" },
+	{ 0x001BC5, 0x017000, 0x017FFF, "cPacket Networks", "CPACKET-NETWORKS" },
+	{ 0x001BC5, 0x019000, 0x019FFF, "Dunlop Systems & Components", "DUNLOP-COMPONENTS" },
+	{ 0x001BC5, 0x01A000, 0x01AFFF, "ABA ELECTRONICS TECHNOLOGY CO.,LTD", "ABA-ELECTRONICS" },
+	{ 0x001BC5, 0x01B000, 0x01BFFF, "Commonwealth Scientific and Industrial Research Organisation", "COMMONWEALTH-SCIENTIFIC-AND-INDUSTRIAL-RESEARCH-ORGANISATION" },
+	{ 0x001BC5, 0x01C000, 0x01CFFF, "Coolit Systems, Inc.", "COOLIT" },
+	{ 0x001BC5, 0x01D000, 0x01DFFF, "Rose + Herleth GbR", "ROSE-+-HERLETH-GBR" },
+	{ 0x001BC5, 0x01E000, 0x01EFFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x01F000, 0x01FFFF, "Saturn Solutions Ltd", "SATURN-SOLUTIONS" },
+	{ 0x001BC5, 0x020000, 0x020FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
+	{ 0x001BC5, 0x021000, 0x021FFF, "Openpeak, Inc", "OPENPEAK" },
+	{ 0x001BC5, 0x022000, 0x022FFF, "CJSC STC SIMOS", "CJSC-STC-SIMOS" },
+	{ 0x001BC5, 0x023000, 0x023FFF, "MAGO di Della Mora Walter", "MAGO-DI-DELLA-MORA-WALTER" },
+	{ 0x001BC5, 0x024000, 0x024FFF, "ANNECY ELECTRONIQUE SAS", "ANNECY-ELECTRONIQUE-SAS" },
+	{ 0x001BC5, 0x025000, 0x025FFF, "andersen lighting GmbH", "ANDERSEN-LIGHTING" },
+	{ 0x001BC5, 0x026000, 0x026FFF, "DIMEP Sistemas", "DIMEP-SISTEMAS" },
+	{ 0x001BC5, 0x027000, 0x027FFF, "CAMEA, spol. s r.o.", "CAMEA-SPOL-S-R-O" },
+	{ 0x001BC5, 0x028000, 0x028FFF, "STECHWIN.CO.LTD.", "STECHWIN" },
+	{ 0x001BC5, 0x029000, 0x029FFF, "2 FRANCE MARINE", "2-FRANCE-MARINE" },
+	{ 0x001BC5, 0x02A000, 0x02AFFF, "Analytical Instrument Systems, Inc.", "ANALYTICAL-INSTRUMENT" },
+	{ 0x001BC5, 0x02B000, 0x02BFFF, "Saturn South Pty Ltd", "SATURN-SOUTH-PTY" },
+	{ 0x001BC5, 0x02C000, 0x02CFFF, "Care Everywhere LLC", "CARE-EVERYWHERE-LLC" },
+	{ 0x001BC5, 0x02D000, 0x02DFFF, "DDTRONIK Dariusz Dowgiert", "DDTRONIK-DARIUSZ-DOWGIERT" },
+	{ 0x001BC5, 0x02E000, 0x02EFFF, "BETTINI SRL", "BETTINI-SRL" },
+	{ 0x001BC5, 0x02F000, 0x02FFFF, "Fibrain Co. Ltd.", "FIBRAIN" },
+	{ 0x001BC5, 0x030000, 0x030FFF, "OctoGate it Security Systems GmbH", "OCTOGATE-IT-SECURITY" },
+	{ 0x001BC5, 0x031000, 0x031FFF, "ADIXEIN LIMITED", "ADIXEIN" },
+	{ 0x001BC5, 0x032000, 0x032FFF, "Osborne Coinage Co", "OSBORNE-COINAGE" },
+	{ 0x001BC5, 0x033000, 0x033FFF, "JE Suunnittelu Oy", "JE-SUUNNITTELU-OY" },
+	{ 0x001BC5, 0x034000, 0x034FFF, "InterCEL Pty Ltd", "INTERCEL-PTY" },
+	{ 0x001BC5, 0x035000, 0x035FFF, "RTLS Ltd.", "RTLS" },
+	{ 0x001BC5, 0x036000, 0x036FFF, "LOMAR SRL", "LOMAR-SRL" },
+	{ 0x001BC5, 0x037000, 0x037FFF, "ITW Reyflex North America", "ITW-REYFLEX-NORTH-AMERICA" },
+	{ 0x001BC5, 0x038000, 0x038FFF, "SEED International Ltd.", "SEED" },
+	{ 0x001BC5, 0x039000, 0x039FFF, "EURESYS S.A.", "EURESYS" },
+	{ 0x001BC5, 0x03A000, 0x03AFFF, "MindMade Sp. z o.o.", "MINDMADE-SP-Z-O-O" },
+	{ 0x001BC5, 0x03B000, 0x03BFFF, "Promixis, LLC", "PROMIXIS-LLC" },
+	{ 0x001BC5, 0x03C000, 0x03CFFF, "Xiphos Systems Corp.", "XIPHOS" },
+	{ 0x001BC5, 0x03D000, 0x03DFFF, "rioxo GmbH", "RIOXO" },
+	{ 0x001BC5, 0x03E000, 0x03EFFF, "Daylight Solutions, Inc", "DAYLIGHT-SOLUTIONS" },
+	{ 0x001BC5, 0x03F000, 0x03FFFF, "ELTRADE Ltd", "ELTRADE" },
+	{ 0x001BC5, 0x040000, 0x040FFF, "OOO Actidata", "OOO-ACTIDATA" },
+	{ 0x001BC5, 0x041000, 0x041FFF, "DesignA Electronics Limited", "DESIGNA-ELECTRONICS" },
+	{ 0x001BC5, 0x042000, 0x042FFF, "ChamSys Ltd", "CHAMSYS" },
+	{ 0x001BC5, 0x043000, 0x043FFF, "Coincident, Inc.", "COINCIDENT" },
+	{ 0x001BC5, 0x044000, 0x044FFF, "ZAO &quot;RADIUS Avtomatika&quot;", "ZAO-QUOT-RADIUS-AVTOMATIKA-QUOT" },
+	{ 0x001BC5, 0x045000, 0x045FFF, "Marvel Digital International Limited", "MARVEL-DIGITAL" },
+	{ 0x001BC5, 0x046000, 0x046FFF, "GÉANT", "GÉANT" },
+	{ 0x001BC5, 0x047000, 0x047FFF, "PT. Amanindo Nusapadu", "PT-AMANINDO-NUSAPADU" },
+	{ 0x001BC5, 0x048000, 0x048FFF, "XPossible Technologies Pte Ltd", "XPOSSIBLE-TECHNOLOGIES-PTE" },
+	{ 0x001BC5, 0x049000, 0x049FFF, "EUROCONTROL S.p.A.", "EUROCONTROL-S-P-A" },
+	{ 0x001BC5, 0x04A000, 0x04AFFF, "Certis Technology International Pte Ltd", "CERTIS-PTE" },
+	{ 0x001BC5, 0x04B000, 0x04BFFF, "Silicon Controls", "SILICON-CONTROLS" },
+	{ 0x001BC5, 0x04C000, 0x04CFFF, "Rhino Controls Ltd.", "RHINO-CONTROLS" },
+	{ 0x001BC5, 0x04D000, 0x04DFFF, "eiraku electric corp.", "EIRAKU-ELECTRIC" },
+	{ 0x001BC5, 0x04E000, 0x04EFFF, "Mitsubishi Electric India PVT. LTD", "MITSUBISHI-ELECTRIC-INDIA-PVT" },
+	{ 0x001BC5, 0x04F000, 0x04FFFF, "Orbital Systems, Ltd.", "ORBITAL" },
+	{ 0x001BC5, 0x050000, 0x050FFF, "TeliSwitch Solutions", "TELISWITCH-SOLUTIONS" },
+	{ 0x001BC5, 0x051000, 0x051FFF, "QQ Navigation AB", "QQ-NAVIGATION-AB" },
+	{ 0x001BC5, 0x052000, 0x052FFF, "Engineering Center ENERGOSERVICE", "ENGINEERING-CENTER-ENERGOSERVICE" },
+	{ 0x001BC5, 0x053000, 0x053FFF, "Metrycom Communications Ltd", "METRYCOM-COMMUNICATION" },
+	{ 0x001BC5, 0x054000, 0x054FFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x055000, 0x055FFF, "LUMIPLAN TRANSPORT", "LUMIPLAN-TRANSPORT" },
+	{ 0x001BC5, 0x056000, 0x056FFF, "ThinKom Solutions, Inc", "THINKOM-SOLUTIONS" },
+	{ 0x001BC5, 0x057000, 0x057FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
+	{ 0x001BC5, 0x058000, 0x058FFF, "optiMEAS GmbH", "OPTIMEAS" },
+	{ 0x001BC5, 0x059000, 0x059FFF, "INPIXAL", "INPIXAL" },
+	{ 0x001BC5, 0x05A000, 0x05AFFF, "POSTEC DATA SYSTEMS", "POSTEC-DATA" },
+	{ 0x001BC5, 0x05B000, 0x05BFFF, "konzeptpark GmbH", "KONZEPTPARK" },
+	{ 0x001BC5, 0x05C000, 0x05CFFF, "Suretrak Global Pty Ltd", "SURETRAK-GLOBAL-PTY" },
+	{ 0x001BC5, 0x05D000, 0x05DFFF, "JSC Prominform", "JSC-PROMINFORM" },
+	{ 0x001BC5, 0x05E000, 0x05EFFF, "Ecomed-Complex", "ECOMED-COMPLEX" },
+	{ 0x001BC5, 0x05F000, 0x05FFFF, "Klingenthaler Musikelektronik GmbH", "KLINGENTHALER-MUSIKELEKTRONIK" },
+	{ 0x001BC5, 0x060000, 0x060FFF, "ENSTECH", "ENSTECH" },
+	{ 0x001BC5, 0x061000, 0x061FFF, "Scientific-Technical Center Epsilon Limited company", "SCIENTIFIC-TECHNICAL-CENTER-EPSILON-COMPANY" },
+	{ 0x001BC5, 0x062000, 0x062FFF, "Sulaon Oy", "SULAON-OY" },
+	{ 0x001BC5, 0x063000, 0x063FFF, "Check-It Solutions Inc", "CHECK-IT-SOLUTIONS" },
+	{ 0x001BC5, 0x064000, 0x064FFF, "Enkora Oy Ltd", "ENKORA-OY" },
+	{ 0x001BC5, 0x065000, 0x065FFF, "Plair Media Inc.", "PLAIR-MEDIA" },
+	{ 0x001BC5, 0x066000, 0x066FFF, "Manufacturas y transformados AB", "MANUFACTURAS-Y-TRANSFORMADOS-AB" },
+	{ 0x001BC5, 0x067000, 0x067FFF, "Embit srl", "EMBIT-SRL" },
+	{ 0x001BC5, 0x068000, 0x068FFF, "HCS KABLOLAMA SISTEMLERI SAN. ve TIC.A.S.", "HCS-KABLOLAMA-SISTEMLERI-SAN-VE-TIC-A-S" },
+	{ 0x001BC5, 0x069000, 0x069FFF, "Datasat Digital Entertainment", "DATASAT-DIGITAL-ENTERTAINMENT" },
+	{ 0x001BC5, 0x06A000, 0x06AFFF, "IST GmbH", "IST" },
+	{ 0x001BC5, 0x06B000, 0x06BFFF, "Verified Energy, LLC.", "VERIFIED-ENERGY-LLC" },
+	{ 0x001BC5, 0x06C000, 0x06CFFF, "Luxcon System Limited", "LUXCON-SYSTEM" },
+	{ 0x001BC5, 0x06D000, 0x06DFFF, "TES Electronic Solutions (I) Pvt. Ltd.", "TES-SOLUTIONS-I-PVT" },
+	{ 0x001BC5, 0x06E000, 0x06EFFF, "Two Dimensional Instruments, LLC", "TWO-DIMENSIONAL-INSTRUMENTS-LLC" },
+	{ 0x001BC5, 0x06F000, 0x06FFFF, "LLC Emzior", "LLC-EMZIOR" },
+	{ 0x001BC5, 0x070000, 0x070FFF, "Siemens Industries, Inc, Retail & Commercial Systems", "SIEMENS-INDUSTRIES-RETAIL-COMMERCIAL" },
+	{ 0x001BC5, 0x071000, 0x071FFF, "Center for E-Commerce Infrastructure Development, The University of Hong Kong", "CENTER-FOR-E-COMMERCE-INFRASTRUCTURE-DEVELOPMENT-THE-UNIVERSITY-OF-HONG-KONG" },
+	{ 0x001BC5, 0x072000, 0x072FFF, "Ohio Semitronics, Inc.", "OHIO-SEMITRONICS" },
+	{ 0x001BC5, 0x073000, 0x073FFF, "tado GmbH", "TADO" },
+	{ 0x001BC5, 0x074000, 0x074FFF, "Dynasthetics", "DYNASTHETICS" },
+	{ 0x001BC5, 0x075000, 0x075FFF, "Kitron GmbH", "KITRON" },
+	{ 0x001BC5, 0x076000, 0x076FFF, "PLAiR Media, Inc", "PLAIR-MEDIA" },
+	{ 0x001BC5, 0x077000, 0x077FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
+	{ 0x001BC5, 0x078000, 0x078FFF, "Donbass Soft Ltd and Co.KG", "DONBASS-SOFT-AND" },
+	{ 0x001BC5, 0x079000, 0x079FFF, "HPI High Pressure Instrumentation GmbH", "HPI-HIGH-PRESSURE-INSTRUMENTATION" },
+	{ 0x001BC5, 0x07A000, 0x07AFFF, "Servicios Electronicos Industriales Berbel s.l.", "SERVICIOS-ELECTRONICOS-INDUSTRIALES-BERBEL-S-L" },
+	{ 0x001BC5, 0x07B000, 0x07BFFF, "QCORE Medical", "QCORE-MEDICAL" },
+	{ 0x001BC5, 0x07C000, 0x07CFFF, "head", "HEAD" },
+	{ 0x001BC5, 0x07D000, 0x07DFFF, "Greatcom AG", "GREATCOM" },
+	{ 0x001BC5, 0x07E000, 0x07EFFF, "Bio Molecular System Pty Ltd", "BIO-MOLECULAR-SYSTEM-PTY" },
+	{ 0x001BC5, 0x07F000, 0x07FFFF, "Hitechlab Inc", "HITECHLAB" },
+	{ 0x001BC5, 0x080000, 0x080FFF, "LUMINO GmbH", "LUMINO" },
+	{ 0x001BC5, 0x081000, 0x081FFF, "WonATech Co., Ltd.", "WONATECH" },
+	{ 0x001BC5, 0x082000, 0x082FFF, "TGS Geophysical Company (UK) Limited", "TGS-GEOPHYSICAL-COMPANY-UK" },
+	{ 0x001BC5, 0x083000, 0x083FFF, "DIWEL", "DIWEL" },
+	{ 0x001BC5, 0x084000, 0x084FFF, "Applied Innovations Research LLC", "APPLIED-INNOVATIONS-RESEARCH-LLC" },
+	{ 0x001BC5, 0x085000, 0x085FFF, "Oberon microsystems, Inc.", "OBERON-MICROSYSTEMS" },
+	{ 0x001BC5, 0x086000, 0x086FFF, "CAST Group of Companies Inc.", "CAST-GROUP-OF-COMPANIES" },
 	{ 0x001BC5, 0x087000, 0x087FFF, "Onnet Technologies and Innovations LLC", "ONNET-TECHNOLOGIES-AND-INNOVATIONS-LLC" },
-	{ 0x70B3D5, 0x6BF000, 0x6BFFFF, "Otto Bihler Maschinenfabrik GmbH & Co. KG", "OTTO-BIHLER-MASCHINENFABRIK" },
-	{ 0x70B3D5, 0x194000, 0x194FFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x70B3D5, 0x493000, 0x493FFF, "Impulse Networks Pte Ltd", "IMPULSE-NETWORKS-PTE" },
-	{ 0x70B3D5, 0xBB7000, 0xBB7FFF, "Innoflight, Inc.", "INNOFLIGHT" },
-	{ 0x70B3D5, 0xB31000, 0xB31FFF, "Qwave Inc", "QWAVE" },
-	{ 0x70B3D5, 0xDA8000, 0xDA8FFF, "Tagarno AS", "TAGARNO-AS" },
-	{ 0x70B3D5, 0xADE000, 0xADEFFF, "ISAC SRL", "ISAC-SRL" },
-	{ 0x70B3D5, 0xE85000, 0xE85FFF, "Explorer Inc.", "EXPLORER" },
-	{ 0x70B3D5, 0xF3C000, 0xF3CFFF, "Gigaray", "GIGARAY" },
-	{ 0x70B3D5, 0xF13000, 0xF13FFF, "MEDIAM Sp. z o.o.", "MEDIAM-SP-Z-O-O" },
-	{ 0x70B3D5, 0x295000, 0x295FFF, "Cello Electronics (UK) Ltd", "CELLO-ELECTRONICS-UK" },
-	{ 0x70B3D5, 0x283000, 0x283FFF, "TextNinja Co.", "TEXTNINJA" },
-	{ 0x70B3D5, 0xD66000, 0xD66FFF, "Ascendent Technology Group", "ASCENDENT-GROUP" },
-	{ 0x70B3D5, 0x3A5000, 0x3A5FFF, "KMtronic ltd", "KMTRONIC" },
-	{ 0x70B3D5, 0x6A0000, 0x6A0FFF, "Active Research Limited", "ACTIVE-RESEARCH" },
-	{ 0x70B3D5, 0xE3E000, 0xE3EFFF, "Sol Welding srl", "SOL-WELDING-SRL" },
-	{ 0x70B3D5, 0x4AE000, 0x4AEFFF, "Reinhardt System- und Messelectronic GmbH", "REINHARDT-SYSTEM--UND-MESSELECTRONIC" },
-	{ 0x70B3D5, 0x38C000, 0x38CFFF, "MiraeSignal Co., Ltd", "MIRAESIGNAL" },
-	{ 0x70B3D5, 0xB1D000, 0xB1DFFF, "Safelet BV", "SAFELET" },
-	{ 0x70B3D5, 0x04C000, 0x04CFFF, "mapna group", "MAPNA-GROUP" },
-	{ 0x70B3D5, 0x6EC000, 0x6ECFFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xABA000, 0xABAFFF, "CL International", "CL" },
-	{ 0x70B3D5, 0x65A000, 0x65AFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x721000, 0x721FFF, "Zoe Medical", "ZOE-MEDICAL" },
-	{ 0x70B3D5, 0x186000, 0x186FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x70B3D5, 0x3BC000, 0x3BCFFF, "SciTronix", "SCITRONIX" },
-	{ 0x70B3D5, 0xBE6000, 0xBE6FFF, "CCII Systems (Pty) Ltd", "CCII-PTY" },
-	{ 0x70B3D5, 0xBD2000, 0xBD2FFF, "Burk Technology", "BURK" },
-	{ 0x70B3D5, 0x925000, 0x925FFF, "Diamante Lighting Srl", "DIAMANTE-LIGHTING-SRL" },
-	{ 0x70B3D5, 0xC8B000, 0xC8BFFF, "Asia Pacific Satellite Coummunication Inc.", "ASIA-PACIFIC-SATELLITE-COUMMUNICATION" },
-	{ 0x70B3D5, 0x7B4000, 0x7B4FFF, "Zumbach Electronic AG", "ZUMBACH" },
-	{ 0x70B3D5, 0xB11000, 0xB11FFF, "CAB S.R.L.", "CAB-S-R-L" },
-	{ 0x70B3D5, 0x513000, 0x513FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0xF99000, 0xF99FFF, "TEX COMPUTER SRL", "TEX-SRL" },
-	{ 0x70B3D5, 0x3A7000, 0x3A7FFF, "Varikorea", "VARIKOREA" },
-	{ 0x70B3D5, 0x174000, 0x174FFF, "Carlson Wireless Technologies Inc.", "CARLSON-WIRELESS-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x7D5000, 0x7D5FFF, "SICS Swedish ICT", "SICS-SWEDISH-ICT" },
-	{ 0x70B3D5, 0x448000, 0x448FFF, "B/E Aerospace, Inc.", "B/E-AEROSPACE" },
-	{ 0x70B3D5, 0xA53000, 0xA53FFF, "GS Industrie-Elektronik GmbH", "GS-INDUSTRIE-ELEKTRONIK" },
-	{ 0x70B3D5, 0xBE3000, 0xBE3FFF, "Saratov Electrounit Production Plant named after Sergo Ordzhonikidze, OJSC", "SARATOV-ELECTROUNIT-PRODUCTION-PLANT-NAMED-AFTER-SERGO-ORDZHONIKIDZE-OJSC" },
-	{ 0x70B3D5, 0xAAD000, 0xAADFFF, "Bartec GmbH", "BARTEC" },
-	{ 0x70B3D5, 0xE82000, 0xE82FFF, "RF Track", "RF-TRACK" },
-	{ 0x70B3D5, 0x85D000, 0x85DFFF, "ATHREYA INC", "ATHREYA" },
-	{ 0x70B3D5, 0x821000, 0x821FFF, "HL2 group", "HL2-GROUP" },
-	{ 0x70B3D5, 0x938000, 0x938FFF, "JETI Technische Instrumente GmbH", "JETI-TECHNISCHE-INSTRUMENTE" },
-	{ 0x70B3D5, 0xA21000, 0xA21FFF, "PPI Inc.", "PPI" },
-	{ 0x70B3D5, 0xE4F000, 0xE4FFFF, "RWS Automation GmbH", "RWS-AUTOMATION" },
-	{ 0x70B3D5, 0x5C4000, 0x5C4FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x67B000, 0x67BFFF, "Stesalit Systems Ltd", "STESALIT" },
-	{ 0x70B3D5, 0x1C8000, 0x1C8FFF, "LDA audio video profesional S.L.", "LDA-AUDIO-VIDEO-PROFESIONAL-S-L" },
-	{ 0x70B3D5, 0x142000, 0x142FFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x70B3D5, 0x666000, 0x666FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x6A8000, 0x6A8FFF, "Vitsch Electronics", "VITSCH-ELECTRONICS" },
-	{ 0x70B3D5, 0xEBD000, 0xEBDFFF, "midBit Technologies, LLC", "MIDBIT-TECHNOLOGIES-LLC" },
-	{ 0x70B3D5, 0xA8E000, 0xA8EFFF, "OMESH CITY GROUP", "OMESH-CITY-GROUP" },
-	{ 0x70B3D5, 0x779000, 0x779FFF, "DR.BRIDGE AQUATECH", "DR-BRIDGE-AQUATECH" },
-	{ 0x70B3D5, 0xF5C000, 0xF5CFFF, "Nable Communications, Inc.", "NABLE-COMMUNICATION" },
-	{ 0x70B3D5, 0x550000, 0x550FFF, "Merten GmbH&CoKG", "MERTEN-COKG" },
-	{ 0x70B3D5, 0x498000, 0x498FFF, "XGEM SAS", "XGEM-SAS" },
-	{ 0x70B3D5, 0xAAA000, 0xAAAFFF, "Xemex NV", "XEMEX-NV" },
-	{ 0x70B3D5, 0x197000, 0x197FFF, "Lattech Systems Pty Ltd", "LATTECH-PTY" },
-	{ 0x70B3D5, 0x593000, 0x593FFF, "Asis Pro", "ASIS-PRO" },
-	{ 0x70B3D5, 0x22F000, 0x22FFFF, "Instec, Inc.", "INSTEC" },
-	{ 0x70B3D5, 0xDD8000, 0xDD8FFF, "EMSCAN Corp.", "EMSCAN" },
-	{ 0x70B3D5, 0xACD000, 0xACDFFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xBCC000, 0xBCCFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x5D6000, 0x5D6FFF, "BMT Messtechnik Gmbh", "BMT-MESSTECHNIK" },
-	{ 0x70B3D5, 0x3BE000, 0x3BEFFF, "MyDefence Communication ApS", "MYDEFENCE-COMMUNICATION-APS" },
-	{ 0x70B3D5, 0x289000, 0x289FFF, "Shenzhen Rongda Computer Co.,Ltd", "SHENZHEN-RONGDA" },
-	{ 0x70B3D5, 0xC3E000, 0xC3EFFF, "DOSADORES ALLTRONIC", "DOSADORES-ALLTRONIC" },
-	{ 0x70B3D5, 0x9FB000, 0x9FBFFF, "Unicom Global, Inc.", "UNICOM-GLOBAL" },
-	{ 0x70B3D5, 0x24D000, 0x24DFFF, "INFO CREATIVE (HK) LTD", "INFO-CREATIVE-HK" },
-	{ 0x70B3D5, 0xA36000, 0xA36FFF, "Beijing DamingWuzhou Science&Technology Co., Ltd.", "BEIJING-DAMINGWUZHOU-SCIENCE" },
-	{ 0x70B3D5, 0x9F8000, 0x9F8FFF, "Asymmetric Technologies", "ASYMMETRIC-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xA85000, 0xA85FFF, "exceet electronics GesmbH", "EXCEET-ELECTRONICS-GESMBH" },
-	{ 0x70B3D5, 0xAC5000, 0xAC5FFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
-	{ 0x70B3D5, 0xF07000, 0xF07FFF, "DUVAL MESSIEN", "DUVAL-MESSIEN" },
-	{ 0x70B3D5, 0x939000, 0x939FFF, "Invertek Drives Ltd", "INVERTEK-DRIVES" },
-	{ 0x70B3D5, 0x6D0000, 0x6D0FFF, "Code Blue Corporation", "CODE-BLUE" },
-	{ 0x70B3D5, 0x2C3000, 0x2C3FFF, "Proterra", "PROTERRA" },
-	{ 0x70B3D5, 0x816000, 0x816FFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x70B3D5, 0x693000, 0x693FFF, "Altron, a.s.", "ALTRON-A-S" },
-	{ 0x70B3D5, 0x5D3000, 0x5D3FFF, "Supracon AG", "SUPRACON" },
-	{ 0x70B3D5, 0x2AD000, 0x2ADFFF, "Opgal Optronic Industries", "OPGAL-OPTRONIC-INDUSTRIES" },
-	{ 0x70B3D5, 0x8EC000, 0x8ECFFF, "Rudy Tellert", "RUDY-TELLERT" },
-	{ 0x70B3D5, 0xCF5000, 0xCF5FFF, "Petring Energietechnik GmbH", "PETRING-ENERGIETECHNIK" },
-	{ 0x70B3D5, 0x269000, 0x269FFF, "Gilbarco Veeder-Root ‎", "GILBARCO-VEEDER-ROOT-‎" },
-	{ 0x70B3D5, 0xFF7000, 0xFF7FFF, "Cybercom AB", "CYBERCOM-AB" },
-	{ 0x70B3D5, 0xDCC000, 0xDCCFFF, "Eutron SPA", "EUTRON-SPA" },
-	{ 0x70B3D5, 0x15C000, 0x15CFFF, "Woods Hole Oceanographic Institution", "WOODS-HOLE-OCEANOGRAPHIC-INSTITUTION" },
-	{ 0x70B3D5, 0x173000, 0x173FFF, "National TeleConsultants LLC", "NATIONAL-TELECONSULTANTS-LLC" },
-	{ 0x70B3D5, 0xCAE000, 0xCAEFFF, "THEMA", "THEMA" },
-	{ 0x70B3D5, 0x5BC000, 0x5BCFFF, "LAMTEC Meß- und Regeltechnik für Feuerungen GmbH & Co. KG", "LAMTEC-MESS--UND-REGELTECHNIK-FUER-FEUERUNGEN" },
-	{ 0x70B3D5, 0x1B8000, 0x1B8FFF, "OES Inc.", "OES" },
-	{ 0x70B3D5, 0x85A000, 0x85AFFF, "BRUSHIES", "BRUSHIES" },
-	{ 0x70B3D5, 0xFAF000, 0xFAFFFF, "Radig Hard & Software", "RADIG-HARD-SOFTWARE" },
-	{ 0x70B3D5, 0x0BC000, 0x0BCFFF, "Practical Software Studio LLC", "PRACTICAL-SOFTWARE-STUDIO-LLC" },
-	{ 0x70B3D5, 0x7A2000, 0x7A2FFF, "Alpha ESS Co., Ltd.", "ALPHA-ESS" },
-	{ 0x70B3D5, 0x724000, 0x724FFF, "Quan International Co., Ltd.", "QUAN" },
-	{ 0x70B3D5, 0x53B000, 0x53BFFF, "Mr.Loop", "MR-LOOP" },
-	{ 0x70B3D5, 0xEBE000, 0xEBEFFF, "Sierra Pacific Innovations Corp", "SIERRA-PACIFIC-INNOVATIONS" },
-	{ 0x70B3D5, 0x103000, 0x103FFF, "HANYOUNG NUX CO.,LTD", "HANYOUNG-NUX" },
-	{ 0x70B3D5, 0x04A000, 0x04AFFF, "Gecko Robotics Inc", "GECKO-ROBOTICS" },
-	{ 0x70B3D5, 0x040000, 0x040FFF, "Savari Inc", "SAVARI" },
-	{ 0x70B3D5, 0x92A000, 0x92AFFF, "Miravue", "MIRAVUE" },
-	{ 0x70B3D5, 0x063000, 0x063FFF, "PoolDigital GmbH & Co. KG", "POOLDIGITAL" },
-	{ 0x70B3D5, 0x209000, 0x209FFF, "SmartNodes", "SMARTNODES" },
-	{ 0x70B3D5, 0x14C000, 0x14CFFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xF9E000, 0xF9EFFF, "International Center for Elementary Particle Physics, The University of Tokyo", "CENTER-FOR-ELEMENTARY-PARTICLE-PHYSICS-THE-UNIVERSITY-OF-TOKYO" },
-	{ 0x70B3D5, 0x9C6000, 0x9C6FFF, "Overspeed SARL", "OVERSPEED-SARL" },
-	{ 0x70B3D5, 0x07A000, 0x07AFFF, "ZAO ZEO", "ZAO-ZEO" },
-	{ 0x70B3D5, 0x06B000, 0x06BFFF, "U-Tech", "U-TECH" },
-	{ 0x70B3D5, 0xF77000, 0xF77FFF, "Satcube AB", "SATCUBE-AB" },
-	{ 0x70B3D5, 0x7A1000, 0x7A1FFF, "Excelfore Corporation", "EXCELFORE" },
-	{ 0x70B3D5, 0x90D000, 0x90DFFF, "Modtronix Engineering", "MODTRONIX-ENGINEERING" },
-	{ 0x70B3D5, 0xC60000, 0xC60FFF, "Gogo BA", "GOGO-BA" },
-	{ 0x70B3D5, 0xA73000, 0xA73FFF, "MobiPromo", "MOBIPROMO" },
-	{ 0x70B3D5, 0x585000, 0x585FFF, "Nefteavtomatika", "NEFTEAVTOMATIKA" },
-	{ 0x70B3D5, 0x495000, 0x495FFF, "Fiem Industries Ltd.", "FIEM-INDUSTRIES" },
-	{ 0x70B3D5, 0xAD2000, 0xAD2FFF, "Wart-Elektronik", "WART-ELEKTRONIK" },
-	{ 0x70B3D5, 0x2B4000, 0x2B4FFF, "Foerster-Technik GmbH", "FOERSTER-TECHNIK" },
-	{ 0x70B3D5, 0x276000, 0x276FFF, "TELL Software Hungaria Kft.", "TELL-SOFTWARE-HUNGARIA-KFT" },
-	{ 0x70B3D5, 0x28C000, 0x28CFFF, "Step Technica Co., Ltd.", "STEP-TECHNICA" },
-	{ 0x70B3D5, 0x7E0000, 0x7E0FFF, "Sanko-sha,inc.", "SANKO-SHA" },
-	{ 0x70B3D5, 0xE50000, 0xE50FFF, "Advanced Vision Technology Ltd", "ADVANCED-VISION" },
-	{ 0x70B3D5, 0x8C1000, 0x8C1FFF, "Rievtech Electronic Co.,Ltd", "RIEVTECH" },
-	{ 0x70B3D5, 0xF0C000, 0xF0CFFF, "ModulaTeam GmbH", "MODULATEAM" },
-	{ 0x70B3D5, 0x8AC000, 0x8ACFFF, "​ASUNG TECHNO CO.,Ltd", "​ASUNG-TECHNO" },
-	{ 0x70B3D5, 0xCE1000, 0xCE1FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
-	{ 0x70B3D5, 0x677000, 0x677FFF, "Fraunhofer-Institut IIS", "FRAUNHOFER-INSTITUT-IIS" },
-	{ 0x70B3D5, 0x38B000, 0x38BFFF, "Lookman Electroplast Industries Ltd", "LOOKMAN-ELECTROPLAST-INDUSTRIES" },
-	{ 0x70B3D5, 0x9DC000, 0x9DCFFF, "Shanghai Daorech Industry Developmnet Co.,Ltd", "SHANGHAI-DAORECH-INDUSTRY-DEVELOPMNET" },
-	{ 0x70B3D5, 0x888000, 0x888FFF, "Zetechtics Ltd", "ZETECHTICS" },
-	{ 0x70B3D5, 0x168000, 0x168FFF, "Biwave Technologies, Inc.", "BIWAVE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xF25000, 0xF25FFF, "JSC “Scientific Industrial Enterprise Rubin", "JSC-“SCIENTIFIC-INDUSTRIAL-RUBIN" },
-	{ 0x70B3D5, 0xA48000, 0xA48FFF, "Applied Satellite Engineering", "APPLIED-SATELLITE-ENGINEERING" },
-	{ 0x70B3D5, 0x46C000, 0x46CFFF, "SHANGHAI CHENZHU INSTRUMENT CO., LTD.", "SHANGHAI-CHENZHU-INSTRUMENT" },
-	{ 0x70B3D5, 0x80B000, 0x80BFFF, "Fischer Block, Inc.", "FISCHER-BLOCK" },
-	{ 0x70B3D5, 0xFAD000, 0xFADFFF, "ARC Technology Solutions, LLC", "ARC-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0xAB8000, 0xAB8FFF, "HORIBA ABX SAS", "HORIBA-ABX-SAS" },
-	{ 0x70B3D5, 0xE6C000, 0xE6CFFF, "Fusar Technologies inc", "FUSAR-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x2B0000, 0x2B0FFF, "Beijing Zhongyi Yue Tai Technology Co., Ltd", "BEIJING-ZHONGYI-YUE-TAI" },
-	{ 0x70B3D5, 0x2E2000, 0x2E2FFF, "Spark Lasers", "SPARK-LASERS" },
-	{ 0x70B3D5, 0x446000, 0x446FFF, "Santa Barbara Imaging Systems", "SANTA-BARBARA-IMAGING" },
-	{ 0x70B3D5, 0x56B000, 0x56BFFF, "S.E.I. CO.,LTD.", "S-E-I" },
-	{ 0x70B3D5, 0xB48000, 0xB48FFF, "DWQ Informatikai Tanacsado es Vezerlestechnikai KFT", "DWQ-INFORMATIKAI-TANACSADO-ES-VEZERLESTECHNIKAI-KFT" },
-	{ 0x70B3D5, 0xA7E000, 0xA7EFFF, "QUICCO SOUND Corporation", "QUICCO-SOUND" },
-	{ 0x70B3D5, 0x878000, 0x878FFF, "Package Guard, Inc", "PACKAGE-GUARD" },
-	{ 0x70B3D5, 0x245000, 0x245FFF, "Newtec A/S", "NEWTEC-A/S" },
-	{ 0x70B3D5, 0x3FE000, 0x3FEFFF, "Mentor Graphics", "MENTOR-GRAPHICS" },
-	{ 0x70B3D5, 0x74D000, 0x74DFFF, "SPEECH TECHNOLOGY CENTER LIMITED", "SPEECH-CENTER" },
-	{ 0x70B3D5, 0x5BF000, 0x5BFFFF, "Aton srl", "ATON-SRL" },
-	{ 0x70B3D5, 0xEEA000, 0xEEAFFF, "Dameca a/s", "DAMECA-A/S" },
-	{ 0x70B3D5, 0x9B8000, 0x9B8FFF, "Loma Systems", "LOMA" },
-	{ 0x70B3D5, 0xBEA000, 0xBEAFFF, "Virtuosys Ltd", "VIRTUOSYS" },
-	{ 0x70B3D5, 0x066000, 0x066FFF, "North Pole Engineering, Inc.", "NORTH-POLE-ENGINEERING" },
-	{ 0x70B3D5, 0x2A1000, 0x2A1FFF, "Blink Services AB", "BLINK-SERVICES-AB" },
-	{ 0x70B3D5, 0x133000, 0x133FFF, "Vidisys GmbH", "VIDISYS" },
-	{ 0x70B3D5, 0x1E6000, 0x1E6FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
-	{ 0x70B3D5, 0x809000, 0x809FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x70B3D5, 0x2AB000, 0x2ABFFF, "NASA Johnson Space Center", "NASA-JOHNSON-SPACE-CENTER" },
-	{ 0x70B3D5, 0x254000, 0x254FFF, "Spectrum Brands", "SPECTRUM-BRANDS" },
-	{ 0x70B3D5, 0x7C9000, 0x7C9FFF, "Council Rock", "COUNCIL-ROCK" },
-	{ 0x70B3D5, 0x53A000, 0x53AFFF, "Pano0ramic Power", "PANO0RAMIC-POWER" },
-	{ 0x70B3D5, 0xE18000, 0xE18FFF, "Plasmapp Co.,Ltd.", "PLASMAPP" },
-	{ 0x70B3D5, 0xD44000, 0xD44FFF, "ic-automation GmbH", "IC-AUTOMATION" },
-	{ 0x70B3D5, 0x9D7000, 0x9D7FFF, "KM OptoElektronik GmbH", "KM-OPTOELEKTRONIK" },
-	{ 0x70B3D5, 0x61B000, 0x61BFFF, "Nubewell Networks Pvt Ltd", "NUBEWELL-NETWORKS-PVT" },
-	{ 0x70B3D5, 0x8F8000, 0x8F8FFF, "Wi6labs", "WI6LABS" },
-	{ 0x70B3D5, 0x2AA000, 0x2AAFFF, "Flirtey Inc", "FLIRTEY" },
-	{ 0x70B3D5, 0x705000, 0x705FFF, "Digital Matter Pty Ltd", "DIGITAL-MATTER-PTY" },
-	{ 0x70B3D5, 0x2BD000, 0x2BDFFF, "mg-sensor GmbH", "MG-SENSOR" },
-	{ 0x70B3D5, 0xD22000, 0xD22FFF, "DEK Technologies", "DEK-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xBB2000, 0xBB2FFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
-	{ 0x70B3D5, 0x99C000, 0x99CFFF, "Enerwise Solutions Ltd.", "ENERWISE-SOLUTIONS" },
-	{ 0x70B3D5, 0xC37000, 0xC37FFF, "Keycom Corp.", "KEYCOM" },
-	{ 0x70B3D5, 0xEF7000, 0xEF7FFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x70B3D5, 0x734000, 0x734FFF, "MANSION INDUSTRY CO., LTD.", "MANSION-INDUSTRY" },
-	{ 0x70B3D5, 0x026000, 0x026FFF, "Telstra", "TELSTRA" },
-	{ 0x70B3D5, 0x3CF000, 0x3CFFFF, "Systems Engineering Arts Pty Ltd", "ENGINEERING-ARTS-PTY" },
-	{ 0x70B3D5, 0x95C000, 0x95CFFF, "Wilson Electronics", "WILSON-ELECTRONICS" },
-	{ 0x70B3D5, 0x6F0000, 0x6F0FFF, "iTelaSoft Pvt Ltd", "ITELASOFT-PVT" },
-	{ 0x70B3D5, 0xD41000, 0xD41FFF, "KSE GmbH", "KSE" },
-	{ 0x70B3D5, 0xB6C000, 0xB6CFFF, "GHM-Messtechnik GmbH (Standort IMTRON)", "GHM-MESSTECHNIK-STANDORT-IMTRON" },
-	{ 0x70B3D5, 0x81B000, 0x81BFFF, "bobz GmbH", "BOBZ" },
-	{ 0x70B3D5, 0x6FD000, 0x6FDFFF, "Core Akıllı Ev Sistemleri", "CORE-AKıLLı-EV-SISTEMLERI" },
-	{ 0x70B3D5, 0x1BB000, 0x1BBFFF, "EFENTO T P SZYDŁOWSKI K ZARĘBA SPÓŁKA JAWNA", "EFENTO-T-P-SZYDŁOWSKI-K-ZARĘBA-SPÓŁKA-JAWNA" },
-	{ 0x70B3D5, 0x2B7000, 0x2B7FFF, "Matrix Orbital Corporation", "MATRIX-ORBITAL" },
-	{ 0x70B3D5, 0x7BF000, 0x7BFFFF, "Stone Three", "STONE-THREE" },
-	{ 0x70B3D5, 0x304000, 0x304FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
-	{ 0x70B3D5, 0x0F3000, 0x0F3FFF, "MonsoonRF, Inc.", "MONSOONRF" },
-	{ 0x70B3D5, 0xF87000, 0xF87FFF, "SHINWA INDUSTRIES, INC.", "SHINWA-INDUSTRIES" },
-	{ 0x70B3D5, 0xDAA000, 0xDAAFFF, "AmTote Australasia", "AMTOTE-AUSTRALASIA" },
-	{ 0x70B3D5, 0x743000, 0x743FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
-	{ 0x70B3D5, 0x08A000, 0x08AFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x689000, 0x689FFF, "Prisma Telecom Testing Srl", "PRISMA-TELECOM-TESTING-SRL" },
-	{ 0x70B3D5, 0x525000, 0x525FFF, "Plantiga Technologies Inc", "PLANTIGA-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x6E9000, 0x6E9FFF, "Krontech", "KRONTECH" },
-	{ 0x70B3D5, 0x981000, 0x981FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
-	{ 0x70B3D5, 0xC8F000, 0xC8FFFF, "TRIDENT INFOSOL PVT LTD", "TRIDENT-INFOSOL-PVT" },
-	{ 0x70B3D5, 0xA13000, 0xA13FFF, "Uplevel Systems Inc", "UPLEVEL" },
+	{ 0x001BC5, 0x088000, 0x088FFF, "UAB Kitron", "UAB-KITRON" },
+	{ 0x001BC5, 0x089000, 0x089FFF, "SIGNATURE CONTROL SYSTEMS, INC.", "SIGNATURE-CONTROL" },
+	{ 0x001BC5, 0x08A000, 0x08AFFF, "Topicon", "TOPICON" },
+	{ 0x001BC5, 0x08B000, 0x08BFFF, "Nistica", "NISTICA" },
 	{ 0x001BC5, 0x08C000, 0x08CFFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x70B3D5, 0x252000, 0x252FFF, "Sierra Nevada Corporation", "SIERRA-NEVADA" },
-	{ 0x70B3D5, 0xD6F000, 0xD6FFFF, "X-SPEX GmbH", "X-SPEX" },
-	{ 0x70B3D5, 0x351000, 0x351FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x15D000, 0x15DFFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0x341000, 0x341FFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0xBE4000, 0xBE4FFF, "Kunshan excellent Intelligent Technology Co., Ltd.", "KUNSHAN-EXCELLENT-INTELLIGENT" },
-	{ 0x70B3D5, 0x6EB000, 0x6EBFFF, "QUANTAFLOW", "QUANTAFLOW" },
-	{ 0x70B3D5, 0x4A0000, 0x4A0FFF, "FLUDIA", "FLUDIA" },
-	{ 0x70B3D5, 0xA43000, 0xA43FFF, "OLEDCOMM", "OLEDCOMM" },
-	{ 0x70B3D5, 0xD7B000, 0xD7BFFF, "Peter Huber Kaeltemaschinenbau AG", "PETER-HUBER-KAELTEMASCHINENBAU" },
-	{ 0x70B3D5, 0x7C0000, 0x7C0FFF, "TORGOVYY DOM TEHNOLOGIY LLC", "TORGOVYY-DOM-TEHNOLOGIY-LLC" },
-	{ 0x70B3D5, 0x75E000, 0x75EFFF, "Cardinal Health", "CARDINAL-HEALTH" },
-	{ 0x70B3D5, 0x90E000, 0x90EFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xDF1000, 0xDF1FFF, "CoXlab Inc.", "COXLAB" },
-	{ 0x70B3D5, 0x7AC000, 0x7ACFFF, "Verity Studios AG", "VERITY-STUDIOS" },
-	{ 0x70B3D5, 0x2A4000, 0x2A4FFF, "GSP Sprachtechnologie GmbH", "GSP-SPRACHTECHNOLOGIE" },
-	{ 0x70B3D5, 0x790000, 0x790FFF, "AVI Pty Ltd", "AVI-PTY" },
-	{ 0x70B3D5, 0xFFE000, 0xFFEFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x75F000, 0x75FFFF, "Vocality international T/A Cubic", "VOCALITY-T/A-CUBIC" },
-	{ 0x70B3D5, 0x8FA000, 0x8FAFFF, "DEA SYSTEM SPA", "DEA-SYSTEM-SPA" },
-	{ 0x70B3D5, 0x64B000, 0x64BFFF, "Kalfire", "KALFIRE" },
-	{ 0x70B3D5, 0x363000, 0x363FFF, "Contec DTx", "CONTEC-DTX" },
-	{ 0x70B3D5, 0x720000, 0x720FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x292000, 0x292FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xC7D000, 0xC7DFFF, "Metatronics B.V.", "METATRONICS" },
-	{ 0x70B3D5, 0x0AC000, 0x0ACFFF, "RoboCore Tecnologia", "ROBOCORE-TECNOLOGIA" },
-	{ 0x70B3D5, 0x21C000, 0x21CFFF, "Enyx SA", "ENYX" },
-	{ 0x70B3D5, 0xA87000, 0xA87FFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
+	{ 0x001BC5, 0x08D000, 0x08DFFF, "EUREK SRL", "EUREK-SRL" },
+	{ 0x001BC5, 0x08E000, 0x08EFFF, "TrendPoint Systems", "TRENDPOINT" },
+	{ 0x001BC5, 0x08F000, 0x08FFFF, "Unilever R&amp;D", "UNILEVER-R-AMP-D" },
+	{ 0x001BC5, 0x090000, 0x090FFF, "Seven Solutions S.L", "SEVEN-SOLUTIONS-S-L" },
+	{ 0x001BC5, 0x091000, 0x091FFF, "3green ApS", "3GREEN-APS" },
+	{ 0x001BC5, 0x092000, 0x092FFF, "Arnouse Digital Devices, Corp.", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x001BC5, 0x093000, 0x093FFF, "Ambient Devices, Inc.", "AMBIENT-DEVICES" },
+	{ 0x001BC5, 0x094000, 0x094FFF, "reelyActive", "REELYACTIVE" },
+	{ 0x001BC5, 0x095000, 0x095FFF, "PREVAC sp. z o.o.", "PREVAC-SP-Z-O-O" },
+	{ 0x001BC5, 0x096000, 0x096FFF, "Sanstreak Corp.", "SANSTREAK" },
+	{ 0x001BC5, 0x097000, 0x097FFF, "Plexstar Inc.", "PLEXSTAR" },
+	{ 0x001BC5, 0x098000, 0x098FFF, "Cubic Systems, Inc.", "CUBIC" },
+	{ 0x001BC5, 0x099000, 0x099FFF, "UAB Kitron", "UAB-KITRON" },
+	{ 0x001BC5, 0x09A000, 0x09AFFF, "Shenzhen Guang Lian Zhi Tong Limited", "SHENZHEN-GUANG-LIAN-ZHI-TONG" },
+	{ 0x001BC5, 0x09B000, 0x09BFFF, "YIK Corporation", "YIK" },
+	{ 0x001BC5, 0x09C000, 0x09CFFF, "S.I.C.E.S. srl", "S-I-C-E-S-SRL" },
+	{ 0x001BC5, 0x09D000, 0x09DFFF, "Navitar Inc", "NAVITAR" },
+	{ 0x001BC5, 0x09E000, 0x09EFFF, "K+K Messtechnik GmbH", "K+K-MESSTECHNIK" },
+	{ 0x001BC5, 0x09F000, 0x09FFFF, "ENTE Sp. z o.o.", "ENTE-SP-Z-O-O" },
+	{ 0x001BC5, 0x0A0000, 0x0A0FFF, "HomerSoft sp. z o.o.", "HOMERSOFT-SP-Z-O-O" },
+	{ 0x001BC5, 0x0A1000, 0x0A1FFF, "Hangzhou Zhiping Technology Co., Ltd.", "HANGZHOU-ZHIPING" },
+	{ 0x001BC5, 0x0A2000, 0x0A2FFF, "Hettich Benelux", "HETTICH-BENELUX" },
+	{ 0x001BC5, 0x0A3000, 0x0A3FFF, "P A Network Laboratory Co.,Ltd", "P-A-NETWORK-LABORATORY" },
+	{ 0x001BC5, 0x0A4000, 0x0A4FFF, "RADMOR S.A.", "RADMOR" },
+	{ 0x001BC5, 0x0A5000, 0x0A5FFF, "Tesla Controls", "TESLA-CONTROLS" },
+	{ 0x001BC5, 0x0A6000, 0x0A6FFF, "Balter Security GmbH", "BALTER-SECURITY" },
+	{ 0x001BC5, 0x0A7000, 0x0A7FFF, "L.G.L. Electronics S.p.a.", "L-G-L-ELECTRONICS-S-P-A" },
+	{ 0x001BC5, 0x0A8000, 0x0A8FFF, "Link Precision", "LINK-PRECISION" },
+	{ 0x001BC5, 0x0A9000, 0x0A9FFF, "Elektrometal SA", "ELEKTROMETAL" },
+	{ 0x001BC5, 0x0AA000, 0x0AAFFF, "Senceive Ltd", "SENCEIVE" },
+	{ 0x001BC5, 0x0AB000, 0x0ABFFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x0AC000, 0x0ACFFF, "AVnu Alliance", "AVNU-ALLIANCE" },
+	{ 0x001BC5, 0x0AD000, 0x0ADFFF, "Tierra Japan Co.,Ltd", "TIERRA-JAPAN" },
+	{ 0x001BC5, 0x0AE000, 0x0AEFFF, "Techlan Reti s.r.l.", "TECHLAN-RETI-S-R-L" },
+	{ 0x001BC5, 0x0AF000, 0x0AFFFF, "Enerwise Solutions Ltd.", "ENERWISE-SOLUTIONS" },
+	{ 0x001BC5, 0x0B0000, 0x0B0FFF, "J-D.COM", "J-D-COM" },
+	{ 0x001BC5, 0x0B1000, 0x0B1FFF, "Roslen Eco-Networking Products", "ROSLEN-ECO-NETWORKING-PRODUCTS" },
+	{ 0x001BC5, 0x0B2000, 0x0B2FFF, "SKODA ELECTRIC a.s.", "SKODA-ELECTRIC-A-S" },
+	{ 0x001BC5, 0x0B3000, 0x0B3FFF, "FSM Solutions Limited", "FSM-SOLUTIONS" },
+	{ 0x001BC5, 0x0B4000, 0x0B4FFF, "COBAN SRL", "COBAN-SRL" },
+	{ 0x001BC5, 0x0B5000, 0x0B5FFF, "Exibea AB", "EXIBEA-AB" },
+	{ 0x001BC5, 0x0B6000, 0x0B6FFF, "Veilux inc.", "VEILUX" },
+	{ 0x001BC5, 0x0B7000, 0x0B7FFF, "Autelis, LLC", "AUTELIS-LLC" },
+	{ 0x001BC5, 0x0B8000, 0x0B8FFF, "Private", "PRIVATE" },
+	{ 0x001BC5, 0x0B9000, 0x0B9FFF, "Denki Kogyo Company, Limited", "DENKI-KOGYO-COMPANY" },
+	{ 0x001BC5, 0x0BA000, 0x0BAFFF, "NT MICROSYSTEMS", "NT-MICROSYSTEMS" },
+	{ 0x001BC5, 0x0BB000, 0x0BBFFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x001BC5, 0x0BC000, 0x0BCFFF, "kuwatec, Inc.", "KUWATEC" },
+	{ 0x001BC5, 0x0BD000, 0x0BDFFF, "Bridge Diagnostics, Inc.", "BRIDGE-DIAGNOSTICS" },
+	{ 0x001BC5, 0x0BE000, 0x0BEFFF, "YESpay International Ltd", "YESPAY" },
+	{ 0x001BC5, 0x0BF000, 0x0BFFFF, "TN Core Co.,Ltd.", "TN-CORE" },
+	{ 0x001BC5, 0x0C0000, 0x0C0FFF, "Digital Loggers, Inc.", "DIGITAL-LOGGERS" },
+	{ 0x001BC5, 0x0C1000, 0x0C1FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
+	{ 0x001BC5, 0x0C2000, 0x0C2FFF, "TechSolutions A/S", "TECHSOLUTIONS-A/S" },
+	{ 0x001BC5, 0x0C3000, 0x0C3FFF, "inomatic GmbH", "INOMATIC" },
+	{ 0x001BC5, 0x0C4000, 0x0C4FFF, "ELDES", "ELDES" },
+	{ 0x001BC5, 0x0C5000, 0x0C5FFF, "Gill Instruments Ltd", "GILL-INSTRUMENTS" },
+	{ 0x001BC5, 0x0C6000, 0x0C6FFF, "Connode", "CONNODE" },
+	{ 0x001BC5, 0x0C7000, 0x0C7FFF, "WIZZILAB SAS", "WIZZILAB-SAS" },
+	{ 0x001BC5, 0x0C8000, 0x0C8FFF, "Dialine", "DIALINE" },
+	{ 0x001BC5, 0x0C9000, 0x0C9FFF, "UAB Kitron", "UAB-KITRON" },
+	{ 0x70B3D5, 0x001000, 0x001FFF, "SOREDI touch systems GmbH", "SOREDI-TOUCH" },
+	{ 0x70B3D5, 0x002000, 0x002FFF, "Gogo BA", "GOGO-BA" },
+	{ 0x70B3D5, 0x003000, 0x003FFF, "ANYROAM", "ANYROAM" },
+	{ 0x70B3D5, 0x006000, 0x006FFF, "Piranha EMS Inc.", "PIRANHA-EMS" },
+	{ 0x70B3D5, 0x007000, 0x007FFF, "SENSONEO", "SENSONEO" },
+	{ 0x70B3D5, 0x008000, 0x008FFF, "ESYSE GmbH Embedded Systems Engineering", "ESYSE-EMBEDDED-ENGINEERING" },
+	{ 0x70B3D5, 0x009000, 0x009FFF, "HolidayCoro", "HOLIDAYCORO" },
 	{ 0x70B3D5, 0x00A000, 0x00AFFF, "FUJICOM Co.,Ltd.", "FUJICOM" },
-	{ 0x70B3D5, 0x17B000, 0x17BFFF, "Vistec Electron Beam GmbH", "VISTEC-ELECTRON-BEAM" },
-	{ 0x70B3D5, 0xB7F000, 0xB7FFFF, "JSK System", "JSK-SYSTEM" },
-	{ 0x70B3D5, 0x23B000, 0x23BFFF, "Fink Telecom Services", "FINK-TELECOM-SERVICES" },
-	{ 0x70B3D5, 0x92E000, 0x92EFFF, "Medical Monitoring Center OOD", "MEDICAL-MONITORING-CENTER-OOD" },
-	{ 0x70B3D5, 0xD64000, 0xD64FFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
-	{ 0x70B3D5, 0xAB3000, 0xAB3FFF, "MICAS AG", "MICAS" },
-	{ 0x70B3D5, 0xB0B000, 0xB0BFFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x70B3D5, 0xA46000, 0xA46FFF, "Foxconn 4Tech", "FOXCONN-4TECH" },
-	{ 0x70B3D5, 0x3C7000, 0x3C7FFF, "SOFTCREATE CORP.", "SOFTCREATE" },
-	{ 0x70B3D5, 0x862000, 0x862FFF, "TripleOre", "TRIPLEORE" },
-	{ 0x70B3D5, 0x1CC000, 0x1CCFFF, "AooGee Controls Co., LTD.", "AOOGEE-CONTROLS" },
-	{ 0x70B3D5, 0x961000, 0x961FFF, "TASK SISTEMAS DE COMPUTACAO LTDA", "TASK-SISTEMAS-DE-COMPUTACAO-LTDA" },
-	{ 0x70B3D5, 0x8A5000, 0x8A5FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0xDEA000, 0xDEAFFF, "Advanced Ventilation Applications, Inc.", "ADVANCED-VENTILATION-APPLICATIONS" },
-	{ 0x70B3D5, 0xDA6000, 0xDA6FFF, "Redfish Group Pty Ltd", "REDFISH-GROUP-PTY" },
-	{ 0x70B3D5, 0xED0000, 0xED0FFF, "shanghai qiaoqi zhinengkeji", "SHANGHAI-QIAOQI-ZHINENGKEJI" },
-	{ 0x70B3D5, 0xC9E000, 0xC9EFFF, "FUKUDA SANGYO CO., LTD.", "FUKUDA-SANGYO" },
-	{ 0x70B3D5, 0xCDF000, 0xCDFFFF, "3D Printing Specialists", "3D-PRINTING-SPECIALISTS" },
-	{ 0x70B3D5, 0xE43000, 0xE43FFF, "SL Audio A/S", "SL-AUDIO-A/S" },
-	{ 0x70B3D5, 0x32D000, 0x32DFFF, "Hanwell Technology Co., Ltd.", "HANWELL" },
-	{ 0x70B3D5, 0xE86000, 0xE86FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0x5C8000, 0x5C8FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0x742000, 0x742FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0x9B4000, 0x9B4FFF, "MyoungSung System", "MYOUNGSUNG-SYSTEM" },
-	{ 0x70B3D5, 0x26C000, 0x26CFFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
-	{ 0x70B3D5, 0x9AB000, 0x9ABFFF, "Groupe Paris-Turf", "GROUPE-PARIS-TURF" },
-	{ 0x70B3D5, 0xB94000, 0xB94FFF, "Cygnetic Technologies (Pty) Ltd", "CYGNETIC-TECHNOLOGIES-PTY" },
-	{ 0x70B3D5, 0x907000, 0x907FFF, "NINGBO CRRC TIMES TRANSDUCER TECHNOLOGY CO., LTD", "NINGBO-CRRC-TIMES-TRANSDUCER" },
-	{ 0x70B3D5, 0x8A2000, 0x8A2FFF, "WINNERS DIGITAL CORPORATION", "WINNERS-DIGITAL" },
-	{ 0x70B3D5, 0x6C3000, 0x6C3FFF, "BEIJING ZGH SECURITY RESEARCH INSTITUTE CO., LTD", "BEIJING-ZGH-SECURITY-RESEARCH-INSTITUTE" },
-	{ 0x70B3D5, 0xC64000, 0xC64FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x70B3D5, 0x31B000, 0x31BFFF, "SilTerra Malaysia Sdn. Bhd.", "SILTERRA-MALAYSIA-SDN-BHD" },
-	{ 0x70B3D5, 0x3F5000, 0x3F5FFF, "DOLBY LABORATORIES, INC.", "DOLBY-LABORATORIES" },
-	{ 0x70B3D5, 0xEE7000, 0xEE7FFF, "BLUE-SOLUTIONS CANADA INC.", "BLUE-SOLUTIONS-CANADA" },
-	{ 0x70B3D5, 0x0EA000, 0x0EAFFF, "AEV Broadcast Srl", "AEV-BROADCAST-SRL" },
-	{ 0x70B3D5, 0xFA5000, 0xFA5FFF, "Shenzhen Hui Rui Tianyan Technology Co., Ltd.", "SHENZHEN-HUI-RUI-TIANYAN" },
-	{ 0x70B3D5, 0x516000, 0x516FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
-	{ 0x70B3D5, 0x978000, 0x978FFF, "Satixfy Israel Ltd.", "SATIXFY-ISRAEL" },
-	{ 0x70B3D5, 0xB49000, 0xB49FFF, "ANALOGICS TECH INDIA LTD", "ANALOGICS-TECH-INDIA" },
-	{ 0x70B3D5, 0x4C6000, 0x4C6FFF, "BlueBox Video Limited", "BLUEBOX-VIDEO" },
-	{ 0x70B3D5, 0xAE6000, 0xAE6FFF, "Ya Batho Trading (Pty) Ltd", "YA-BATHO-TRADING-PTY" },
-	{ 0x70B3D5, 0xC9D000, 0xC9DFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
-	{ 0x70B3D5, 0xACF000, 0xACFFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
-	{ 0x70B3D5, 0x15B000, 0x15BFFF, "Armstrong International, Inc.", "ARMSTRONG" },
-	{ 0x70B3D5, 0x738000, 0x738FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x591000, 0x591FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x510000, 0x510FFF, "PSL ELEKTRONİK SANAYİ VE TİCARET A.S.", "PSL-ELEKTRONİK-SANAYİ-VE-TİCARET-A-S" },
-	{ 0x70B3D5, 0x05C000, 0x05CFFF, "Amber Kinetics Inc", "AMBER-KINETICS" },
-	{ 0x70B3D5, 0xD28000, 0xD28FFF, "Toshiba Electron Tubes & Devices Co., Ltd.", "TOSHIBA-ELECTRON-TUBES-DEVICES" },
-	{ 0x70B3D5, 0xEC3000, 0xEC3FFF, "Virtual Control Systems Ltd", "VIRTUAL-CONTROL" },
-	{ 0x70B3D5, 0x22A000, 0x22AFFF, "Shishido Electrostatic, Ltd.", "SHISHIDO-ELECTROSTATIC" },
-	{ 0x70B3D5, 0xAA9000, 0xAA9FFF, "Datamars SA", "DATAMARS" },
-	{ 0x70B3D5, 0x30F000, 0x30FFFF, "Cardinal Scales Manufacturing Co", "CARDINAL-SCALES-MANUFACTURING" },
-	{ 0x70B3D5, 0x1D8000, 0x1D8FFF, "Blue Skies Global LLC", "BLUE-SKIES-GLOBAL-LLC" },
-	{ 0x70B3D5, 0x3A0000, 0x3A0FFF, "chiconypower", "CHICONYPOWER" },
-	{ 0x70B3D5, 0x553000, 0x553FFF, "TAALEX Systemtechnik GmbH", "TAALEX-SYSTEMTECHNIK" },
-	{ 0x70B3D5, 0x24A000, 0x24AFFF, "Unmukti Technology Pvt Ltd", "UNMUKTI-PVT" },
-	{ 0x70B3D5, 0xC8E000, 0xC8EFFF, "Coral Telecom Limited", "CORAL-TELECOM" },
-	{ 0x70B3D5, 0x9C5000, 0x9C5FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
-	{ 0x70B3D5, 0x0B5000, 0x0B5FFF, "Capgemini Netherlands", "CAPGEMINI-NETHERLANDS" },
-	{ 0x70B3D5, 0xD60000, 0xD60FFF, "Flintab AB", "FLINTAB-AB" },
-	{ 0x70B3D5, 0x1B4000, 0x1B4FFF, "5nines", "5NINES" },
-	{ 0x70B3D5, 0x522000, 0x522FFF, "Syncopated Engineering Inc", "SYNCOPATED-ENGINEERING" },
-	{ 0x70B3D5, 0x78E000, 0x78EFFF, "effectas GmbH", "EFFECTAS" },
-	{ 0x70B3D5, 0xCC1000, 0xCC1FFF, "BEEcube Inc.", "BEECUBE" },
-	{ 0x70B3D5, 0x9D4000, 0x9D4FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
-	{ 0x70B3D5, 0xAE2000, 0xAE2FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
-	{ 0x70B3D5, 0x476000, 0x476FFF, "FR-Team International SA", "FR-TEAM" },
-	{ 0x70B3D5, 0x326000, 0x326FFF, "NEMEUS-SAS", "NEMEUS-SAS" },
-	{ 0x70B3D5, 0xFE6000, 0xFE6FFF, "SHIZUKI ELECTRIC CO.,INC", "SHIZUKI-ELECTRIC" },
-	{ 0x70B3D5, 0x943000, 0x943FFF, "Abbott Medical Optics Inc.", "ABBOTT-MEDICAL-OPTICS" },
-	{ 0x70B3D5, 0xAE0000, 0xAE0FFF, "AnyComm.Co.,Ltd.", "ANYCOMM" },
-	{ 0x70B3D5, 0x2B3000, 0x2B3FFF, "HAS co.,ltd.", "HAS" },
-	{ 0x70B3D5, 0xD5A000, 0xD5AFFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xCB6000, 0xCB6FFF, "Kuebrich Ingeniergesellschaft mbh & Co. KG", "KUEBRICH-INGENIERGESELLSCHAFT-MBH" },
-	{ 0x70B3D5, 0x0BE000, 0x0BEFFF, "ChamSys Ltd", "CHAMSYS" },
-	{ 0x70B3D5, 0x1E0000, 0x1E0FFF, "TOPROOTTechnology Corp. Ltd.", "TOPROOTTECHNOLOGY" },
-	{ 0x70B3D5, 0x0C8000, 0x0C8FFF, "Fin Robotics Inc", "FIN-ROBOTICS" },
-	{ 0x70B3D5, 0x39D000, 0x39DFFF, "Comark Interactive Solutions", "COMARK-INTERACTIVE-SOLUTIONS" },
-	{ 0x70B3D5, 0xD07000, 0xD07FFF, "Waversa Systems", "WAVERSA" },
-	{ 0x70B3D5, 0x4D1000, 0x4D1FFF, "Contraves Advanced Devices Sdn. Bhd.", "CONTRAVES-ADVANCED-DEVICES-SDN-BHD" },
-	{ 0x70B3D5, 0x771000, 0x771FFF, "Apator Miitors ApS", "APATOR-MIITORS-APS" },
-	{ 0x70B3D5, 0xCA9000, 0xCA9FFF, "Nxcontrol system Co., Ltd.", "NXCONTROL-SYSTEM" },
-	{ 0x70B3D5, 0xEDF000, 0xEDFFFF, "GridNavigator", "GRIDNAVIGATOR" },
-	{ 0x70B3D5, 0x20A000, 0x20AFFF, "Golden Grid Systems", "GOLDEN-GRID" },
-	{ 0x70B3D5, 0x517000, 0x517FFF, "ISPHER", "ISPHER" },
-	{ 0x70B3D5, 0x140000, 0x140FFF, "Virta Laboratories, Inc.", "VIRTA-LABORATORIES" },
-	{ 0x70B3D5, 0x9F0000, 0x9F0FFF, "FUJICOM Co.,Ltd.", "FUJICOM" },
-	{ 0x70B3D5, 0x76F000, 0x76FFFF, "OTI LTD", "OTI" },
-	{ 0x70B3D5, 0x4EB000, 0x4EBFFF, "INFOSOFT DIGITAL DESIGN & SERVICES PRIVATE LIMITED", "INFOSOFT-DIGITAL-DESIGN-SERVICES-PRIVATE" },
-	{ 0x70B3D5, 0xD12000, 0xD12FFF, "FIDELTRONIK POLAND SP. Z O.O.", "FIDELTRONIK-POLAND-SP-Z-O-O" },
-	{ 0x70B3D5, 0x8F0000, 0x8F0FFF, "ERAESEEDS co.,ltd.", "ERAESEEDS" },
-	{ 0x70B3D5, 0xEE5000, 0xEE5FFF, "Beijing Hzhytech Technology Co.Ltd", "BEIJING-HZHYTECH" },
-	{ 0x70B3D5, 0xBED000, 0xBEDFFF, "Itrinegy Ltd.", "ITRINEGY" },
-	{ 0x70B3D5, 0xAF5000, 0xAF5FFF, "Net And Print Inc.", "NET-AND-PRINT" },
-	{ 0x70B3D5, 0x64A000, 0x64AFFF, "Netbric Technology Co.,Ltd.", "NETBRIC" },
-	{ 0x70B3D5, 0xECA000, 0xECAFFF, "Transtronic AB", "TRANSTRONIC-AB" },
-	{ 0x70B3D5, 0x852000, 0x852FFF, "NetBoxSC, LLC", "NETBOXSC-LLC" },
-	{ 0x70B3D5, 0xE76000, 0xE76FFF, "Dorsett Technologies, Inc.", "DORSETT-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x172000, 0x172FFF, "LumiGrow, Inc", "LUMIGROW" },
-	{ 0x70B3D5, 0x8A4000, 0x8A4FFF, "Phyton, Inc. Microsystems and Development Tools", "PHYTON-MICROSYSTEMS-AND-DEVELOPMENT-TOOLS" },
-	{ 0x70B3D5, 0x166000, 0x166FFF, "SERIAL IMAGE INC.", "SERIAL-IMAGE" },
-	{ 0x70B3D5, 0x76D000, 0x76DFFF, "Trimble", "TRIMBLE" },
-	{ 0x70B3D5, 0xF73000, 0xF73FFF, "ASL Holdings", "ASL-HOLDINGS" },
-	{ 0x70B3D5, 0xD0E000, 0xD0EFFF, "Beijing Aumiwalker technology CO.,LTD", "BEIJING-AUMIWALKER" },
-	{ 0x70B3D5, 0x827000, 0x827FFF, "Metromatics Pty Ltd", "METROMATICS-PTY" },
-	{ 0x70B3D5, 0xF54000, 0xF54FFF, "Revolution Retail Systems", "REVOLUTION-RETAIL" },
-	{ 0x70B3D5, 0xB91000, 0xB91FFF, "Dynetics, Inc.", "DYNETICS" },
-	{ 0x70B3D5, 0x4DE000, 0x4DEFFF, "Oso Technologies, Inc.", "OSO-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x916000, 0x916FFF, "Techno Mathematical Co.,Ltd", "TECHNO-MATHEMATICAL" },
-	{ 0x70B3D5, 0x958000, 0x958FFF, "pureLiFi Ltd", "PURELIFI" },
-	{ 0x70B3D5, 0x4F4000, 0x4F4FFF, "WiTagg, Inc", "WITAGG" },
-	{ 0x70B3D5, 0xF4C000, 0xF4CFFF, "Global Lightning Protection Services A(S", "GLOBAL-LIGHTNING-PROTECTION-SERVICES-A-S" },
-	{ 0x70B3D5, 0x789000, 0x789FFF, "SEMEX-EngCon GmbH", "SEMEX-ENGCON" },
-	{ 0x70B3D5, 0xCFD000, 0xCFDFFF, "iLOQ Oy", "ILOQ-OY" },
-	{ 0x70B3D5, 0xBAD000, 0xBADFFF, "Technik & Design GmbH", "TECHNIK-DESIGN" },
-	{ 0x70B3D5, 0x324000, 0x324FFF, "Thales Nederland BV", "THALES-NEDERLAND" },
-	{ 0x70B3D5, 0x935000, 0x935FFF, "Sensor Developments", "SENSOR-DEVELOPMENTS" },
-	{ 0x70B3D5, 0x431000, 0x431FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0xC73000, 0xC73FFF, "C.D.N.CORPORATION", "C-D-N" },
-	{ 0x70B3D5, 0xD80000, 0xD80FFF, "AMMT GmbH", "AMMT" },
-	{ 0x70B3D5, 0xD0A000, 0xD0AFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xCE3000, 0xCE3FFF, "Dalcnet srl", "DALCNET-SRL" },
-	{ 0x70B3D5, 0xAB5000, 0xAB5FFF, "BroadSoft Inc", "BROADSOFT" },
-	{ 0x70B3D5, 0x9CA000, 0x9CAFFF, "KOMSIS ELEKTRONIK SISTEMLERI SAN. TIC. LTD.STI", "KOMSIS-ELEKTRONIK-SISTEMLERI-SAN-TIC-STI" },
-	{ 0x70B3D5, 0x0E6000, 0x0E6FFF, "Nasdaq", "NASDAQ" },
-	{ 0x70B3D5, 0x087000, 0x087FFF, "Tempus Fugit Consoles bvba", "TEMPUS-FUGIT-CONSOLES-BVBA" },
-	{ 0x70B3D5, 0x7B7000, 0x7B7FFF, "LSB - LA SALLE BLANCHE", "LSB---LA-SALLE-BLANCHE" },
-	{ 0x70B3D5, 0xE30000, 0xE30FFF, "QUISS AG", "QUISS" },
-	{ 0x70B3D5, 0xD2D000, 0xD2DFFF, "Evolute Systems Private Limited", "EVOLUTE-PRIVATE" },
-	{ 0x70B3D5, 0xB35000, 0xB35FFF, "Rexxam Co.,Ltd.", "REXXAM" },
-	{ 0x70B3D5, 0x79B000, 0x79BFFF, "Soniclean Pty Ltd", "SONICLEAN-PTY" },
-	{ 0x70B3D5, 0xF72000, 0xF72FFF, "Hanshin Electronics", "HANSHIN-ELECTRONICS" },
-	{ 0x70B3D5, 0xAA8000, 0xAA8FFF, "West-Com Nurse Call Systems, Inc.", "WEST-COM-NURSE-CALL" },
-	{ 0x70B3D5, 0xDF6000, 0xDF6FFF, "Tiab Limited", "TIAB" },
-	{ 0x70B3D5, 0x3E3000, 0x3E3FFF, "Head", "HEAD" },
-	{ 0x70B3D5, 0x285000, 0x285FFF, "Bentec GmbH Drilling & Oilfield Systems", "BENTEC-DRILLING-OILFIELD" },
-	{ 0x70B3D5, 0x44E000, 0x44EFFF, "Solace Systems Inc.", "SOLACE" },
-	{ 0x70B3D5, 0x13F000, 0x13FFFF, "Farmobile", "FARMOBILE" },
-	{ 0x70B3D5, 0xD48000, 0xD48FFF, "HEADROOM Broadcast GmbH", "HEADROOM-BROADCAST" },
-	{ 0x70B3D5, 0x99F000, 0x99FFFF, "Confed Holding B.V.", "CONFED-HOLDING" },
-	{ 0x70B3D5, 0xAE3000, 0xAE3FFF, "Zhejiang Wellsun Electric Meter Co.,Ltd", "ZHEJIANG-WELLSUN-ELECTRIC-METER" },
-	{ 0x70B3D5, 0xBEF000, 0xBEFFFF, "Sensortech Systems Inc.", "SENSORTECH" },
-	{ 0x70B3D5, 0xB24000, 0xB24FFF, "Datasat Digital Entertainment", "DATASAT-DIGITAL-ENTERTAINMENT" },
-	{ 0x70B3D5, 0x0C1000, 0x0C1FFF, "Nexus Technologies Pty Ltd", "NEXUS-TECHNOLOGIES-PTY" },
-	{ 0x70B3D5, 0xE6E000, 0xE6EFFF, "Lieron BVBA", "LIERON-BVBA" },
-	{ 0x70B3D5, 0x01C000, 0x01CFFF, "Kumu Networks", "KUMU-NETWORKS" },
-	{ 0x70B3D5, 0x799000, 0x799FFF, "Vitec System Engineering Inc.", "VITEC-SYSTEM-ENGINEERING" },
-	{ 0x70B3D5, 0xDE8000, 0xDE8FFF, "Nation-E Ltd.", "NATION-E" },
-	{ 0x70B3D5, 0x83F000, 0x83FFFF, "Lumine Lighting Solutions Oy", "LUMINE-LIGHTING-SOLUTIONS-OY" },
-	{ 0x70B3D5, 0xE23000, 0xE23FFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x70B3D5, 0xA6E000, 0xA6EFFF, "JSC Electrical Equipment Factory", "JSC-ELECTRICAL-EQUIPMENT-FACTORY" },
-	{ 0x70B3D5, 0xF7E000, 0xF7EFFF, "Alpha Elettronica s.r.l.", "ALPHA-ELETTRONICA-S-R-L" },
-	{ 0x70B3D5, 0x41E000, 0x41EFFF, "Redler Computers", "REDLER-COMPUTERS" },
-	{ 0x70B3D5, 0xD0D000, 0xD0DFFF, "Logiwaste AB", "LOGIWASTE-AB" },
-	{ 0x70B3D5, 0xF2C000, 0xF2CFFF, "Hengen Technologies GmbH", "HENGEN-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x459000, 0x459FFF, "Protium Technologies, Inc.", "PROTIUM-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x811000, 0x811FFF, "CJSC «INTERSET»", "CJSC-«INTERSET»" },
-	{ 0x70B3D5, 0x6ED000, 0x6EDFFF, "Wiingtech International Co. LTD.", "WIINGTECH" },
-	{ 0x70B3D5, 0xF39000, 0xF39FFF, "Zenros ApS", "ZENROS-APS" },
-	{ 0x70B3D5, 0xC56000, 0xC56FFF, "TELETASK", "TELETASK" },
-	{ 0x70B3D5, 0xE58000, 0xE58FFF, "Thurlby Thandar Instruments LTD", "THURLBY-THANDAR-INSTRUMENTS" },
-	{ 0x70B3D5, 0x0AB000, 0x0ABFFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x062000, 0x062FFF, "RM Michaelides Software & Elektronik GmbH", "RM-MICHAELIDES-SOFTWARE-ELEKTRONIK" },
-	{ 0x70B3D5, 0x71E000, 0x71EFFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x70B3D5, 0x8E0000, 0x8E0FFF, "SOUDAX EQUIPEMENTS", "SOUDAX-EQUIPEMENTS" },
-	{ 0x70B3D5, 0x412000, 0x412FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0xE75000, 0xE75FFF, "Nke", "NKE" },
-	{ 0x70B3D5, 0xDE7000, 0xDE7FFF, "Innominds Software Private Limited", "INNOMINDS-SOFTWARE-PRIVATE" },
-	{ 0x70B3D5, 0x1F4000, 0x1F4FFF, "Hangzhou Woosiyuan Communication Co.,Ltd.", "HANGZHOU-WOOSIYUAN-COMMUNICATION" },
-	{ 0x70B3D5, 0x092000, 0x092FFF, "inomed Medizintechnik GmbH", "INOMED-MEDIZINTECHNIK" },
-	{ 0x70B3D5, 0x1A1000, 0x1A1FFF, "HMicro Inc", "HMICRO" },
-	{ 0x70B3D5, 0xB8D000, 0xB8DFFF, "JungwooEng Co., Ltd", "JUNGWOOENG" },
-	{ 0x70B3D5, 0x20C000, 0x20CFFF, "Siemens Healthcare Diagnostics", "SIEMENS-HEALTHCARE-DIAGNOSTICS" },
-	{ 0x70B3D5, 0x709000, 0x709FFF, "AML", "AML" },
-	{ 0x70B3D5, 0x682000, 0x682FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x70B3D5, 0x0A4000, 0x0A4FFF, "Communication Technology Ltd.", "COMMUNICATION" },
-	{ 0x70B3D5, 0xA99000, 0xA99FFF, "Bandelin electronic GmbH & Co. KG", "BANDELIN" },
-	{ 0x70B3D5, 0x7EF000, 0x7EFFFF, "CRAVIS CO., LIMITED", "CRAVIS" },
-	{ 0x70B3D5, 0xA62000, 0xA62FFF, "Environexus", "ENVIRONEXUS" },
-	{ 0x70B3D5, 0xE92000, 0xE92FFF, "FUJI DATA SYSTEM CO.,LTD.", "FUJI-DATA-SYSTEM" },
-	{ 0x70B3D5, 0xC6D000, 0xC6DFFF, "Cyviz AS", "CYVIZ-AS" },
-	{ 0x70B3D5, 0xC43000, 0xC43FFF, "Future Skies", "FUTURE-SKIES" },
-	{ 0x70B3D5, 0xD4E000, 0xD4EFFF, "FLSmidth", "FLSMIDTH" },
-	{ 0x70B3D5, 0x1AC000, 0x1ACFFF, "SVP Broadcast Microwave S.L.", "SVP-BROADCAST-MICROWAVE-S-L" },
-	{ 0x70B3D5, 0x090000, 0x090FFF, "POWERCRAFT ELECTRONICS PVT. LTD.", "POWERCRAFT-ELECTRONICS-PVT" },
-	{ 0x70B3D5, 0x3F1000, 0x3F1FFF, "Olympus NDT Canada", "OLYMPUS-NDT-CANADA" },
-	{ 0x70B3D5, 0x9A7000, 0x9A7FFF, "Honeywell", "HONEYWELL" },
-	{ 0x70B3D5, 0xDC5000, 0xDC5FFF, "Excel Medical Electronics LLC", "EXCEL-MEDICAL-ELECTRONICS-LLC" },
-	{ 0x70B3D5, 0x01D000, 0x01DFFF, "Weigl Elektronik & Mediaprojekte", "WEIGL-ELEKTRONIK-MEDIAPROJEKTE" },
-	{ 0x70B3D5, 0xF68000, 0xF68FFF, "AL ZAJEL MODERN TELECOMM", "AL-ZAJEL-MODERN-TELECOMM" },
-	{ 0x70B3D5, 0xDEC000, 0xDECFFF, "Condev-Automation GmbH", "CONDEV-AUTOMATION" },
-	{ 0x70B3D5, 0x564000, 0x564FFF, "christmann informationstechnik + medien GmbH & Co. KG", "CHRISTMANN-INFORMATIONSTECHNIK-+-MEDIEN" },
-	{ 0x70B3D5, 0xE07000, 0xE07FFF, "Baader Planetarium GmbH", "BAADER-PLANETARIUM" },
-	{ 0x70B3D5, 0x28E000, 0x28EFFF, "TEX COMPUTER SRL", "TEX-SRL" },
-	{ 0x70B3D5, 0x655000, 0x655FFF, "AOT System GmbH", "AOT-SYSTEM" },
-	{ 0x70B3D5, 0xA2F000, 0xA2FFFF, "Botek Systems AB", "BOTEK-AB" },
-	{ 0x70B3D5, 0xB15000, 0xB15FFF, "Eta Beta Srl", "ETA-BETA-SRL" },
-	{ 0x70B3D5, 0xB2A000, 0xB2AFFF, "Myro Control, LLC", "MYRO-CONTROL-LLC" },
-	{ 0x70B3D5, 0x433000, 0x433FFF, "Flexsolution APS", "FLEXSOLUTION-APS" },
-	{ 0x70B3D5, 0x077000, 0x077FFF, "InAccess Networks SA", "INACCESS-NETWORKS" },
-	{ 0x70B3D5, 0x5E8000, 0x5E8FFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0x0FB000, 0x0FBFFF, "Cygnus LLC", "CYGNUS-LLC" },
-	{ 0x70B3D5, 0xDDD000, 0xDDDFFF, "BIO RAD LABORATORIES", "BIO-RAD-LABORATORIES" },
-	{ 0x70B3D5, 0x54E000, 0x54EFFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
-	{ 0x70B3D5, 0xBBD000, 0xBBDFFF, "Providius Corp", "PROVIDIUS" },
-	{ 0x70B3D5, 0xC78000, 0xC78FFF, "NETA Elektronik AS", "NETA-ELEKTRONIK-AS" },
-	{ 0x70B3D5, 0xBCA000, 0xBCAFFF, "Deymed Diagnostic", "DEYMED-DIAGNOSTIC" },
-	{ 0x70B3D5, 0xEE4000, 0xEE4FFF, "O-Net Automation Technology (Shenzhen)Limited", "O-NET-AUTOMATION-SHENZHEN" },
-	{ 0x70B3D5, 0x5B5000, 0x5B5FFF, "Lehigh Electric Products Co", "LEHIGH-ELECTRIC-PRODUCTS" },
-	{ 0x70B3D5, 0xB8C000, 0xB8CFFF, "ePOINT Embedded Computing Limited", "EPOINT-EMBEDDED-COMPUTING" },
-	{ 0x70B3D5, 0x40A000, 0x40AFFF, "Monroe Electronics, Inc.", "MONROE-ELECTRONICS" },
-	{ 0x70B3D5, 0xF63000, 0xF63FFF, "Ars Products", "ARS-PRODUCTS" },
-	{ 0x70B3D5, 0x0AA000, 0x0AAFFF, "Wanco Inc", "WANCO" },
-	{ 0x70B3D5, 0x3ED000, 0x3EDFFF, "Ultra Electronics Sonar System Division", "ULTRA-ELECTRONICS-SONAR-SYSTEM-DIVISION" },
-	{ 0x001BC5, 0x0C1000, 0x0C1FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
-	{ 0x001BC5, 0x0C0000, 0x0C0FFF, "Digital Loggers, Inc.", "DIGITAL-LOGGERS" },
-	{ 0x001BC5, 0x0C7000, 0x0C7FFF, "WIZZILAB SAS", "WIZZILAB-SAS" },
-	{ 0x001BC5, 0x0B3000, 0x0B3FFF, "FSM Solutions Limited", "FSM-SOLUTIONS" },
-	{ 0x001BC5, 0x0BD000, 0x0BDFFF, "Bridge Diagnostics, Inc.", "BRIDGE-DIAGNOSTICS" },
-	{ 0x001BC5, 0x0AD000, 0x0ADFFF, "Tierra Japan Co.,Ltd", "TIERRA-JAPAN" },
-	{ 0x001BC5, 0x0A9000, 0x0A9FFF, "Elektrometal SA", "ELEKTROMETAL" },
-	{ 0x001BC5, 0x0B7000, 0x0B7FFF, "Autelis, LLC", "AUTELIS-LLC" },
-	{ 0x001BC5, 0x0A3000, 0x0A3FFF, "P A Network Laboratory Co.,Ltd", "P-A-NETWORK-LABORATORY" },
-	{ 0x001BC5, 0x0A1000, 0x0A1FFF, "Hangzhou Zhiping Technology Co., Ltd.", "HANGZHOU-ZHIPING" },
-	{ 0x001BC5, 0x097000, 0x097FFF, "Plexstar Inc.", "PLEXSTAR" },
-	{ 0x001BC5, 0x094000, 0x094FFF, "reelyActive", "REELYACTIVE" },
-	{ 0x001BC5, 0x09B000, 0x09BFFF, "YIK Corporation", "YIK" },
-	{ 0x001BC5, 0x09E000, 0x09EFFF, "K+K Messtechnik GmbH", "K+K-MESSTECHNIK" },
-	{ 0x001BC5, 0x08D000, 0x08DFFF, "EUREK SRL", "EUREK-SRL" },
-	{ 0x001BC5, 0x091000, 0x091FFF, "3green ApS", "3GREEN-APS" },
-	{ 0x001BC5, 0x08A000, 0x08AFFF, "Topicon", "TOPICON" },
-	{ 0x001BC5, 0x07C000, 0x07CFFF, "head", "HEAD" },
-	{ 0x001BC5, 0x078000, 0x078FFF, "Donbass Soft Ltd and Co.KG", "DONBASS-SOFT-AND" },
-	{ 0x001BC5, 0x082000, 0x082FFF, "TGS Geophysical Company (UK) Limited", "TGS-GEOPHYSICAL-COMPANY-UK" },
-	{ 0x001BC5, 0x085000, 0x085FFF, "Oberon microsystems, Inc.", "OBERON-MICROSYSTEMS" },
-	{ 0x001BC5, 0x086000, 0x086FFF, "CAST Group of Companies Inc.", "CAST-GROUP-OF-COMPANIES" },
-	{ 0x001BC5, 0x064000, 0x064FFF, "Enkora Oy Ltd", "ENKORA-OY" },
-	{ 0x001BC5, 0x05E000, 0x05EFFF, "Ecomed-Complex", "ECOMED-COMPLEX" },
-	{ 0x001BC5, 0x06E000, 0x06EFFF, "Two Dimensional Instruments, LLC", "TWO-DIMENSIONAL-INSTRUMENTS-LLC" },
-	{ 0x001BC5, 0x068000, 0x068FFF, "HCS KABLOLAMA SISTEMLERI SAN. ve TIC.A.S.", "HCS-KABLOLAMA-SISTEMLERI-SAN-VE-TIC-A-S" },
-	{ 0x001BC5, 0x072000, 0x072FFF, "Ohio Semitronics, Inc.", "OHIO-SEMITRONICS" },
-	{ 0x001BC5, 0x05A000, 0x05AFFF, "POSTEC DATA SYSTEMS", "POSTEC-DATA" },
-	{ 0x001BC5, 0x04A000, 0x04AFFF, "Certis Technology International Pte Ltd", "CERTIS-PTE" },
-	{ 0x001BC5, 0x054000, 0x054FFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x050000, 0x050FFF, "TeliSwitch Solutions", "TELISWITCH-SOLUTIONS" },
-	{ 0x001BC5, 0x040000, 0x040FFF, "OOO Actidata", "OOO-ACTIDATA" },
-	{ 0x001BC5, 0x03B000, 0x03BFFF, "Promixis, LLC", "PROMIXIS-LLC" },
-	{ 0x001BC5, 0x034000, 0x034FFF, "InterCEL Pty Ltd", "INTERCEL-PTY" },
-	{ 0x001BC5, 0x031000, 0x031FFF, "ADIXEIN LIMITED", "ADIXEIN" },
-	{ 0x001BC5, 0x02A000, 0x02AFFF, "Analytical Instrument Systems, Inc.", "ANALYTICAL-INSTRUMENT" },
-	{ 0x001BC5, 0x027000, 0x027FFF, "CAMEA, spol. s r.o.", "CAMEA-SPOL-S-R-O" },
-	{ 0x001BC5, 0x023000, 0x023FFF, "MAGO di Della Mora Walter", "MAGO-DI-DELLA-MORA-WALTER" },
-	{ 0x001BC5, 0x01F000, 0x01FFFF, "Saturn Solutions Ltd", "SATURN-SOLUTIONS" },
-	{ 0x001BC5, 0x012000, 0x012FFF, "Tokyo Cosmos Electric, Inc.", "TOKYO-COSMOS-ELECTRIC" },
-	{ 0x001BC5, 0x00F000, 0x00FFFF, "Simavita Pty Ltd", "SIMAVITA-PTY" },
-	{ 0x001BC5, 0x00B000, 0x00BFFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x00C000, 0x00CFFF, "Quantum Technology Sciences, Inc.", "QUANTUM-SCIENCES" },
-	{ 0x001BC5, 0x008000, 0x008FFF, "Dalaj Electro-Telecom", "DALAJ-ELECTRO-TELECOM" },
-	{ 0x001BC5, 0x005000, 0x005FFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x016000, 0x016FFF, "Energotechnica OOO NPP Ltd", "ENERGOTECHNICA-OOO-NPP" },
-	{ 0x001BC5, 0x002000, 0x002FFF, "GORAMO - Janusz Gorecki", "GORAMO---JANUSZ-GORECKI" },
-	{ 0x001BC5, 0x019000, 0x019FFF, "Dunlop Systems & Components", "DUNLOP-COMPONENTS" },
-	{ 0x70B3D5, 0xD81000, 0xD81FFF, "PDD Group Ltd", "PDD-GROUP" },
-	{ 0x70B3D5, 0xB7A000, 0xB7AFFF, "MAHLE", "MAHLE" },
-	{ 0x70B3D5, 0xAFE000, 0xAFEFFF, "MESOTECHNIC", "MESOTECHNIC" },
-	{ 0x70B3D5, 0x659000, 0x659FFF, "E2G srl", "E2G-SRL" },
-	{ 0x70B3D5, 0x4A1000, 0x4A1FFF, "Herholdt Controls srl", "HERHOLDT-CONTROLS-SRL" },
-	{ 0x70B3D5, 0xD1B000, 0xD1BFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0xD9E000, 0xD9EFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x781000, 0x781FFF, "Project Service S.a.s.", "PROJECT-SERVICE-S" },
-	{ 0x70B3D5, 0xA72000, 0xA72FFF, "Business Marketers Group, Inc.", "BUSINESS-MARKETERS-GROUP" },
-	{ 0x70B3D5, 0x33B000, 0x33BFFF, "Seal Shield, LLC", "SEAL-SHIELD-LLC" },
-	{ 0x70B3D5, 0xE49000, 0xE49FFF, "Kendrion Mechatronics Center GmbH", "KENDRION-MECHATRONICS-CENTER" },
-	{ 0x70B3D5, 0x214000, 0x214FFF, "signalparser", "SIGNALPARSER" },
-	{ 0x70B3D5, 0x3C6000, 0x3C6FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
-	{ 0x70B3D5, 0x384000, 0x384FFF, "Sensohive Technologies", "SENSOHIVE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x893000, 0x893FFF, "Cubitech", "CUBITECH" },
-	{ 0x70B3D5, 0x09E000, 0x09EFFF, "MobiPromo", "MOBIPROMO" },
-	{ 0x70B3D5, 0x49E000, 0x49EFFF, "CAPTEMP, Lda", "CAPTEMP-LDA" },
-	{ 0x70B3D5, 0x4B6000, 0x4B6FFF, "VEILUX INC.", "VEILUX" },
-	{ 0x70B3D5, 0x7CF000, 0x7CFFFF, "ORCA Technologies, LLC", "ORCA-TECHNOLOGIES-LLC" },
-	{ 0x70B3D5, 0x5A3000, 0x5A3FFF, "CT Company", "CT-COMPANY" },
-	{ 0x70B3D5, 0x80A000, 0x80AFFF, "SENSING LABS", "SENSING-LABS" },
-	{ 0x70B3D5, 0xE45000, 0xE45FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
-	{ 0x70B3D5, 0x059000, 0x059FFF, "Pro-Digital Projetos Eletronicos Ltda", "PRO-DIGITAL-PROJETOS-ELETRONICOS-LTDA" },
-	{ 0x70B3D5, 0x091000, 0x091FFF, "PROFITT Ltd", "PROFITT" },
-	{ 0x70B3D5, 0x647000, 0x647FFF, "KZTA", "KZTA" },
-	{ 0x70B3D5, 0x6DF000, 0x6DFFFF, "Mango DSP, Inc.", "MANGO-DSP" },
-	{ 0x70B3D5, 0xCBE000, 0xCBEFFF, "Ensura Solutions BV", "ENSURA-SOLUTIONS" },
-	{ 0x70B3D5, 0xCAC000, 0xCACFFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x8B9000, 0x8B9FFF, "Toptech Systems, Inc.", "TOPTECH" },
-	{ 0x70B3D5, 0x74E000, 0x74EFFF, "PushCorp, Inc.", "PUSHCORP" },
-	{ 0x70B3D5, 0xFD2000, 0xFD2FFF, "DALIAN LEVEAR ELECTRIC CO., LTD", "DALIAN-LEVEAR-ELECTRIC" },
-	{ 0x70B3D5, 0xF08000, 0xF08FFF, "Szabo Software & Engineering UK Ltd", "SZABO-SOFTWARE-ENGINEERING-UK" },
-	{ 0x70B3D5, 0x6A1000, 0x6A1FFF, "GLIAL TECHNOLOGY", "GLIAL" },
-	{ 0x70B3D5, 0x955000, 0x955FFF, "Dynacard Co., Ltd.", "DYNACARD" },
-	{ 0x70B3D5, 0x12B000, 0x12BFFF, "RIC Electronics", "RIC-ELECTRONICS" },
-	{ 0x70B3D5, 0x17E000, 0x17EFFF, "OCULI VISION", "OCULI-VISION" },
-	{ 0x70B3D5, 0x046000, 0x046FFF, "Shenzhen Rihuida Electronics Co,. Ltd", "SHENZHEN-RIHUIDA-ELECTRONICS" },
-	{ 0x70B3D5, 0x268000, 0x268FFF, "Cardinal Scale Mfg Co", "CARDINAL-SCALE-MFG" },
-	{ 0x70B3D5, 0xB7E000, 0xB7EFFF, "Elbit Systems of America - Fort Worth Operations", "ELBIT-OF-AMERICA---FORT-WORTH-OPERATIONS" },
-	{ 0x70B3D5, 0xDB5000, 0xDB5FFF, "Xiamen Point Circle Technologh Co,ltd", "XIAMEN-POINT-CIRCLE-TECHNOLOGH" },
-	{ 0x70B3D5, 0x429000, 0x429FFF, "Redco Audio Inc", "REDCO-AUDIO" },
-	{ 0x70B3D5, 0x2E7000, 0x2E7FFF, "Atos spa", "ATOS-SPA" },
-	{ 0x70B3D5, 0x766000, 0x766FFF, "Tirasoft Nederland", "TIRASOFT-NEDERLAND" },
-	{ 0x70B3D5, 0x17D000, 0x17DFFF, "Entech Electronics", "ENTECH-ELECTRONICS" },
-	{ 0x70B3D5, 0x99A000, 0x99AFFF, "KEVIC. inc,", "KEVIC" },
-	{ 0x70B3D5, 0x02A000, 0x02AFFF, "BAE Systems Surface Ships Limited", "BAE-SURFACE-SHIPS" },
-	{ 0x70B3D5, 0xDE2000, 0xDE2FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
-	{ 0x70B3D5, 0x2BB000, 0x2BBFFF, "Automation Networks & Solutions LLC", "AUTOMATION-NETWORKS-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0xAB4000, 0xAB4FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x70B3D5, 0x35A000, 0x35AFFF, "Applied Radar, Inc.", "APPLIED-RADAR" },
-	{ 0x70B3D5, 0x042000, 0x042FFF, "Coveloz Technologies Inc.", "COVELOZ-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xC1B000, 0xC1BFFF, "Labinvent JSC", "LABINVENT-JSC" },
-	{ 0x70B3D5, 0xE2E000, 0xE2EFFF, "Merz s.r.o.", "MERZ-S-R-O" },
-	{ 0x70B3D5, 0xDE4000, 0xDE4FFF, "MAVILI ELEKTRONIK TIC. VE SAN. A.S.", "MAVILI-ELEKTRONIK-TIC-VE-SAN-A-S" },
-	{ 0x70B3D5, 0x712000, 0x712FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
-	{ 0x70B3D5, 0x776000, 0x776FFF, "Power Ltd.", "POWER" },
-	{ 0x70B3D5, 0xB72000, 0xB72FFF, "UB330.net d.o.o.", "UB330-NET-D-O-O" },
-	{ 0x70B3D5, 0x7D9000, 0x7D9FFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
-	{ 0x70B3D5, 0x7DE000, 0x7DEFFF, "Telaeris, Inc.", "TELAERIS" },
-	{ 0x70B3D5, 0xA10000, 0xA10FFF, "w-tec AG", "W-TEC" },
-	{ 0x70B3D5, 0x13E000, 0x13EFFF, "Stara S/A Indústria de Implementos Agrícolas", "STARA-S/A-INDúSTRIA-DE-IMPLEMENTOS-AGRíCOLAS" },
-	{ 0x70B3D5, 0x0BA000, 0x0BAFFF, "Ayre Acoustics, Inc.", "AYRE-ACOUSTICS" },
-	{ 0x70B3D5, 0x10C000, 0x10CFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x70B3D5, 0xB7D000, 0xB7DFFF, "LOGIX ITS Inc", "LOGIX-ITS" },
-	{ 0x70B3D5, 0x307000, 0x307FFF, "Energi innovation Aps", "ENERGI-INNOVATION-APS" },
-	{ 0x70B3D5, 0x9FA000, 0x9FAFFF, "Ideas srl", "IDEAS-SRL" },
-	{ 0x70B3D5, 0x649000, 0x649FFF, "swissled technologies AG", "SWISSLED-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xC0E000, 0xC0EFFF, "SYSDEV Srl", "SYSDEV-SRL" },
-	{ 0x70B3D5, 0x4C7000, 0x4C7FFF, "SOLVERIS sp. z o.o.", "SOLVERIS-SP-Z-O-O" },
-	{ 0x70B3D5, 0x7A4000, 0x7A4FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0xC86000, 0xC86FFF, "Woodam Co., Ltd.", "WOODAM" },
-	{ 0x70B3D5, 0xBE8000, 0xBE8FFF, "AndFun Co.,Ltd.", "ANDFUN" },
-	{ 0x70B3D5, 0x27A000, 0x27AFFF, "TD ECOPHISIKA", "TD-ECOPHISIKA" },
-	{ 0x70B3D5, 0x54F000, 0x54FFFF, "Assembly Contracts Limited", "ASSEMBLY-CONTRACTS" },
-	{ 0x70B3D5, 0xC0A000, 0xC0AFFF, "Infosocket Co., Ltd.", "INFOSOCKET" },
-	{ 0x70B3D5, 0xD95000, 0xD95FFF, "SANO SERVICE Co.,Ltd", "SANO-SERVICE" },
-	{ 0x70B3D5, 0x2AC000, 0x2ACFFF, "New Imaging Technologies", "NEW-IMAGING-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x0D3000, 0x0D3FFF, "TSAT AS", "TSAT-AS" },
-	{ 0x70B3D5, 0xA89000, 0xA89FFF, "GBS COMMUNICATIONS, LLC", "GBS-COMMUNICATION-LLC" },
-	{ 0x70B3D5, 0x7E1000, 0x7E1FFF, "Applied Materials", "APPLIED-MATERIALS" },
-	{ 0x70B3D5, 0x54C000, 0x54CFFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x70B3D5, 0x041000, 0x041FFF, "FIBERNET LTD", "FIBERNET" },
-	{ 0x70B3D5, 0xAAE000, 0xAAEFFF, "Nuviz Oy", "NUVIZ-OY" },
-	{ 0x70B3D5, 0x881000, 0x881FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x1FE000, 0x1FEFFF, "MobiPromo", "MOBIPROMO" },
-	{ 0x70B3D5, 0xF0B000, 0xF0BFFF, "RF Industries", "RF-INDUSTRIES" },
-	{ 0x70B3D5, 0x217000, 0x217FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x70B3D5, 0x5E6000, 0x5E6FFF, "Mechatronics Systems Private Limited", "MECHATRONICS-PRIVATE" },
-	{ 0x70B3D5, 0x88B000, 0x88BFFF, "WUHAN EASYLINKIN TECHNOLOGY co.,LTD", "WUHAN-EASYLINKIN" },
-	{ 0x70B3D5, 0x49F000, 0x49FFFF, "B.P.A. SRL", "B-P-A-SRL" },
-	{ 0x70B3D5, 0xC91000, 0xC91FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x986000, 0x986FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xFF3000, 0xFF3FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x7CE000, 0x7CEFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xF4F000, 0xF4FFFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0x4E9000, 0x4E9FFF, "ADETEC SAS", "ADETEC-SAS" },
-	{ 0x70B3D5, 0x09D000, 0x09DFFF, "P&S GmbH", "P-S" },
-	{ 0x70B3D5, 0xFB0000, 0xFB0FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x70B3D5, 0x885000, 0x885FFF, "QuirkLogic", "QUIRKLOGIC" },
-	{ 0x70B3D5, 0x274000, 0x274FFF, "Stercom Power Solutions GmbH", "STERCOM-POWER-SOLUTIONS" },
-	{ 0x70B3D5, 0x615000, 0x615FFF, "JSC OTZVUK", "JSC-OTZVUK" },
-	{ 0x70B3D5, 0x889000, 0x889FFF, "Innovative Circuit Technology", "INNOVATIVE-CIRCUIT" },
-	{ 0x70B3D5, 0x58D000, 0x58DFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0xFAA000, 0xFAAFFF, "LogiM GmbH Software und Entwicklung", "LOGIM-SOFTWARE-UND-ENTWICKLUNG" },
-	{ 0x70B3D5, 0x854000, 0x854FFF, "Adimec Advanced Image Systems", "ADIMEC-ADVANCED-IMAGE" },
-	{ 0x70B3D5, 0xFB3000, 0xFB3FFF, "3PS Inc", "3PS" },
-	{ 0x70B3D5, 0xCAA000, 0xCAAFFF, "Bel Power Solutions GmbH", "BEL-POWER-SOLUTIONS" },
-	{ 0x70B3D5, 0xB9E000, 0xB9EFFF, "POLSYSTEM SI SP. Z O.O., S.K.A.", "POLSYSTEM-SI-SP-Z-O-O-S-K-A" },
-	{ 0x70B3D5, 0x4B0000, 0x4B0FFF, "Tecogen Inc.", "TECOGEN" },
-	{ 0x70B3D5, 0x4A7000, 0x4A7FFF, "aelettronica group srl", "AELETTRONICA-GROUP-SRL" },
-	{ 0x70B3D5, 0x238000, 0x238FFF, "Arete Associates", "ARETE-ASSOCIATES" },
-	{ 0x70B3D5, 0x9B6000, 0x9B6FFF, "Intercomp S.p.A.", "INTERCOMP-S-P-A" },
-	{ 0x70B3D5, 0xE8F000, 0xE8FFFF, "DISMUNTEL, S.A.", "DISMUNTEL" },
-	{ 0x70B3D5, 0x7B0000, 0x7B0FFF, "Medisafe International", "MEDISAFE" },
-	{ 0x70B3D5, 0x09F000, 0x09FFFF, "COMTECH Kft.", "COMTECH-KFT" },
-	{ 0x70B3D5, 0x009000, 0x009FFF, "HolidayCoro", "HOLIDAYCORO" },
-	{ 0x70B3D5, 0xAB0000, 0xAB0FFF, "OSR R&D ISRAEL LTD", "OSR-R-D-ISRAEL" },
-	{ 0x70B3D5, 0x317000, 0x317FFF, "Iotopia Solutions", "IOTOPIA-SOLUTIONS" },
-	{ 0x70B3D5, 0xD32000, 0xD32FFF, "Euklis by GSG International", "EUKLIS-BY-GSG" },
-	{ 0x70B3D5, 0x031000, 0x031FFF, "SHENZHEN GAONA ELECTRONIC CO.LTD", "SHENZHEN-GAONA" },
-	{ 0x70B3D5, 0x548000, 0x548FFF, "DIGIVERV INC", "DIGIVERV" },
-	{ 0x70B3D5, 0x284000, 0x284FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
-	{ 0x70B3D5, 0xA4E000, 0xA4EFFF, "Array Technologies Inc.", "ARRAY-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xBA9000, 0xBA9FFF, "Alma", "ALMA" },
-	{ 0x70B3D5, 0x2F2000, 0x2F2FFF, "Health Care Originals, Inc.", "HEALTH-CARE-ORIGINALS" },
-	{ 0x70B3D5, 0xB98000, 0xB98FFF, "GSF Corporation Pte Ltd", "GSF-PTE" },
-	{ 0x70B3D5, 0x0DE000, 0x0DEFFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x4B8000, 0x4B8FFF, "International Roll-Call Corporation", "ROLL-CALL" },
-	{ 0x70B3D5, 0x991000, 0x991FFF, "Javasparrow Inc.", "JAVASPARROW" },
-	{ 0x70B3D5, 0x3AA000, 0x3AAFFF, "RCATSONE", "RCATSONE" },
-	{ 0x70B3D5, 0x894000, 0x894FFF, "UnI Systech Co.,Ltd", "UNI-SYSTECH" },
-	{ 0x70B3D5, 0x16B000, 0x16BFFF, "IOT Engineering", "IOT-ENGINEERING" },
-	{ 0x70B3D5, 0x432000, 0x432FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x086000, 0x086FFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x70B3D5, 0xE17000, 0xE17FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x8A8000, 0x8A8FFF, "megatec electronic GmbH", "MEGATEC" },
-	{ 0x70B3D5, 0x897000, 0x897FFF, "EFG CZ spol. s r.o.", "EFG-CZ-SPOL-S-R-O" },
-	{ 0x70B3D5, 0x4B2000, 0x4B2FFF, "Certus Operations Ltd", "CERTUS-OPERATIONS" },
-	{ 0x70B3D5, 0x169000, 0x169FFF, "Service Plus LLC", "SERVICE-PLUS-LLC" },
-	{ 0x70B3D5, 0x953000, 0x953FFF, "Spectrum Techniques, LLC", "SPECTRUM-TECHNIQUES-LLC" },
-	{ 0x70B3D5, 0xA03000, 0xA03FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x828000, 0x828FFF, "Xacti Corporation", "XACTI" },
-	{ 0x70B3D5, 0xA88000, 0xA88FFF, "Shangdong Bosure Automation Technology Ltd", "SHANGDONG-BOSURE-AUTOMATION" },
-	{ 0x70B3D5, 0x9DD000, 0x9DDFFF, "HumanEyes Technologies Ltd.", "HUMANEYES-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x9B5000, 0x9B5FFF, "Ideetron b.v.", "IDEETRON" },
-	{ 0x70B3D5, 0xBB3000, 0xBB3FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
-	{ 0x70B3D5, 0x255000, 0x255FFF, "Asystems Corporation", "ASYSTEMS" },
-	{ 0x70B3D5, 0x74A000, 0x74AFFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
-	{ 0x70B3D5, 0x877000, 0x877FFF, "Polynet Telecommunications Consulting and Contractor Ltd.", "POLYNET-TELECOMMUNICATIONS-CONSULTING-AND-CONTRACTOR" },
-	{ 0x70B3D5, 0x5DB000, 0x5DBFFF, "Movicom LLC", "MOVICOM-LLC" },
-	{ 0x70B3D5, 0xD93000, 0xD93FFF, "PAMIR Inc", "PAMIR" },
-	{ 0x70B3D5, 0x63E000, 0x63EFFF, "RIKEN OPTECH CORPORATION", "RIKEN-OPTECH" },
-	{ 0x70B3D5, 0x999000, 0x999FFF, "LOGICUBE INC", "LOGICUBE" },
-	{ 0x70B3D5, 0x7A6000, 0x7A6FFF, "Electrolux", "ELECTROLUX" },
-	{ 0x70B3D5, 0x98E000, 0x98EFFF, "Autocom Diagnostic Partner AB", "AUTOCOM-DIAGNOSTIC-PARTNER-AB" },
-	{ 0x70B3D5, 0xE88000, 0xE88FFF, "Breas Medical AB", "BREAS-MEDICAL-AB" },
-	{ 0x70B3D5, 0x723000, 0x723FFF, "LG Electronics", "LG-ELECTRONICS" },
-	{ 0x70B3D5, 0xFF9000, 0xFF9FFF, "InOut Communication Systems", "INOUT-COMMUNICATION" },
-	{ 0x70B3D5, 0x492000, 0x492FFF, "Jiangsu Jinheng Information Technology Co.,Ltd.", "JIANGSU-JINHENG-INFORMATION" },
-	{ 0x70B3D5, 0x95E000, 0x95EFFF, "BLOCKSI LLC", "BLOCKSI-LLC" },
-	{ 0x70B3D5, 0x582000, 0x582FFF, "VAGLER International Sdn Bhd", "VAGLER-SDN-BHD" },
-	{ 0x70B3D5, 0x0A2000, 0x0A2FFF, "TechSigno srl", "TECHSIGNO-SRL" },
-	{ 0x70B3D5, 0xE1B000, 0xE1BFFF, "Neuron GmbH", "NEURON" },
-	{ 0x70B3D5, 0x096000, 0x096FFF, "HAVELSAN A.Ş.", "HAVELSAN-A-Ş" },
-	{ 0x70B3D5, 0xF5E000, 0xF5EFFF, "Selex ES Inc.", "SELEX-ES" },
-	{ 0x70B3D5, 0x63F000, 0x63FFFF, "YG COMPANY CO., LTD", "YG-COMPANY" },
-	{ 0x70B3D5, 0xA29000, 0xA29FFF, "QIAGEN Instruments AG", "QIAGEN-INSTRUMENTS" },
-	{ 0x70B3D5, 0xF8F000, 0xF8FFFF, "DIMASTEC GESTAO DE PONTO E ACESSO EIRELI-ME", "DIMASTEC-GESTAO-DE-PONTO-E-ACESSO-EIRELI-ME" },
-	{ 0x70B3D5, 0x207000, 0x207FFF, "Savari Inc", "SAVARI" },
-	{ 0x70B3D5, 0x480000, 0x480FFF, "Emergency Lighting Products Limited", "EMERGENCY-LIGHTING-PRODUCTS" },
-	{ 0x70B3D5, 0x069000, 0x069FFF, "ONDEMAND LABORATORY Co., Ltd.", "ONDEMAND-LABORATORY" },
-	{ 0x70B3D5, 0xA3A000, 0xA3AFFF, "EPSOFT Co., Ltd", "EPSOFT" },
-	{ 0x70B3D5, 0xFE3000, 0xFE3FFF, "CSM MACHINERY srl", "CSM-MACHINERY-SRL" },
-	{ 0x70B3D5, 0x711000, 0x711FFF, "X-Laser LLC", "X-LASER-LLC" },
-	{ 0x70B3D5, 0x144000, 0x144FFF, "GS Elektromedizinsiche Geräte G. Stemple GmbH", "GS-ELEKTROMEDIZINSICHE-GERAETE-G-STEMPLE" },
-	{ 0x70B3D5, 0xBFA000, 0xBFAFFF, "NESA SRL", "NESA-SRL" },
-	{ 0x70B3D5, 0x340000, 0x340FFF, "Renesas Electronics", "RENESAS-ELECTRONICS" },
-	{ 0x70B3D5, 0xAC1000, 0xAC1FFF, "AEM Singapore Pte. Ltd.", "AEM-SINGAPORE-PTE" },
-	{ 0x70B3D5, 0xCB4000, 0xCB4FFF, "Planewave Instruments", "PLANEWAVE-INSTRUMENTS" },
-	{ 0x70B3D5, 0x611000, 0x611FFF, "Avionica", "AVIONICA" },
-	{ 0x70B3D5, 0x9A0000, 0x9A0FFF, "ELDES", "ELDES" },
-	{ 0x70B3D5, 0xB17000, 0xB17FFF, "Intesens", "INTESENS" },
-	{ 0x70B3D5, 0x410000, 0x410FFF, "Avant Technologies, Inc", "AVANT-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x21B000, 0x21BFFF, "Lab241 Co.,Ltd.", "LAB241" },
-	{ 0x70B3D5, 0x228000, 0x228FFF, "HEITEC AG", "HEITEC" },
-	{ 0x70B3D5, 0xB3B000, 0xB3BFFF, "Insitu, Inc", "INSITU" },
-	{ 0x70B3D5, 0x2AE000, 0x2AEFFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
-	{ 0x70B3D5, 0x1CB000, 0x1CBFFF, "MatchX GmbH", "MATCHX" },
-	{ 0x70B3D5, 0xF98000, 0xF98FFF, "Metrum Sweden AB", "METRUM-SWEDEN-AB" },
-	{ 0x70B3D5, 0xDE9000, 0xDE9FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x2BF000, 0x2BFFFF, "FOSHAN VOHOM", "FOSHAN-VOHOM" },
-	{ 0x70B3D5, 0x78A000, 0x78AFFF, "Hills Health Solutions", "HILLS-HEALTH-SOLUTIONS" },
-	{ 0x70B3D5, 0x023000, 0x023FFF, "Cambridge Pixel", "CAMBRIDGE-PIXEL" },
-	{ 0x70B3D5, 0xC2E000, 0xC2EFFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x70B3D5, 0xC1C000, 0xC1CFFF, "D.E.M. SPA", "D-E-M-SPA" },
-	{ 0x70B3D5, 0x6B0000, 0x6B0FFF, "PTYPE Co., LTD.", "PTYPE" },
-	{ 0x70B3D5, 0x1E9000, 0x1E9FFF, "comtime GmbH", "COMTIME" },
-	{ 0x70B3D5, 0x86C000, 0x86CFFF, "eeas gmbh", "EEAS" },
-	{ 0x70B3D5, 0xB0C000, 0xB0CFFF, "Vigilate srl", "VIGILATE-SRL" },
-	{ 0x70B3D5, 0xB37000, 0xB37FFF, "CODEC Co., Ltd.", "CODEC" },
-	{ 0x70B3D5, 0x597000, 0x597FFF, "VAPE RAIL INTERNATIONAL", "VAPE-RAIL" },
-	{ 0x70B3D5, 0x850000, 0x850FFF, "REO AG", "REO" },
-	{ 0x70B3D5, 0x37A000, 0x37AFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
-	{ 0x70B3D5, 0xC3D000, 0xC3DFFF, "CISTECH Solutions", "CISTECH-SOLUTIONS" },
-	{ 0x70B3D5, 0xF8B000, 0xF8BFFF, "IOOOTA Srl", "IOOOTA-SRL" },
-	{ 0x70B3D5, 0x2EC000, 0x2ECFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x99E000, 0x99EFFF, "Trinity College Dublin", "TRINITY-COLLEGE-DUBLIN" },
-	{ 0x70B3D5, 0x462000, 0x462FFF, "EarTex", "EARTEX" },
-	{ 0x70B3D5, 0x4CE000, 0x4CEFFF, "Agilack", "AGILACK" },
-	{ 0x70B3D5, 0xF17000, 0xF17FFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0x11D000, 0x11DFFF, "Dakton Microlabs LLC", "DAKTON-MICROLABS-LLC" },
-	{ 0x70B3D5, 0x924000, 0x924FFF, "Meridian Technologies Inc", "MERIDIAN-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x03D000, 0x03DFFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
-	{ 0x70B3D5, 0xB97000, 0xB97FFF, "Canam Technology, Inc.", "CANAM" },
-	{ 0x70B3D5, 0x352000, 0x352FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
-	{ 0x70B3D5, 0x7F4000, 0x7F4FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x122000, 0x122FFF, "Henri Systems Holland bv", "HENRI-HOLLAND" },
-	{ 0x70B3D5, 0x767000, 0x767FFF, "FRANKLIN FRANCE", "FRANKLIN-FRANCE" },
-	{ 0x70B3D5, 0x465000, 0x465FFF, "ENERGISME", "ENERGISME" },
-	{ 0x70B3D5, 0xE09000, 0xE09FFF, "L-3 communications ComCept Division", "L-3-COMMUNICATION-COMCEPT-DIVISION" },
-	{ 0x70B3D5, 0xA07000, 0xA07FFF, "IoTrek Technology Private Limited", "IOTREK-PRIVATE" },
-	{ 0x70B3D5, 0x21D000, 0x21DFFF, "iRF - Intelligent RF Solutions, LLC", "IRF---INTELLIGENT-RF-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0xE9C000, 0xE9CFFF, "ATG UV Technology", "ATG-UV" },
-	{ 0x70B3D5, 0x39E000, 0x39EFFF, "Lanmark Controls Inc.", "LANMARK-CONTROLS" },
-	{ 0x70B3D5, 0x267000, 0x267FFF, "Zehntner Testing Instruments", "ZEHNTNER-TESTING-INSTRUMENTS" },
-	{ 0x70B3D5, 0x0EF000, 0x0EFFFF, "Dextera Labs", "DEXTERA-LABS" },
-	{ 0x70B3D5, 0x4C2000, 0x4C2FFF, "hera Laborsysteme GmbH", "HERA-LABORSYSTEME" },
-	{ 0x70B3D5, 0x0A1000, 0x0A1FFF, "PTN Electronics Limited", "PTN-ELECTRONICS" },
-	{ 0x70B3D5, 0xAA4000, 0xAA4FFF, "Pullnet Technology,S.L.", "PULLNET-S-L" },
-	{ 0x70B3D5, 0xC68000, 0xC68FFF, "Mini Solution Co. Ltd.", "MINI-SOLUTION" },
-	{ 0x70B3D5, 0x81A000, 0x81AFFF, "Joehl & Koeferli AG", "JOEHL-KOEFERLI" },
-	{ 0x70B3D5, 0x86E000, 0x86EFFF, "Profcon AB", "PROFCON-AB" },
-	{ 0x70B3D5, 0x0E8000, 0x0E8FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x9D9000, 0x9D9FFF, "ATX Networks Corp", "ATX-NETWORKS" },
-	{ 0x70B3D5, 0x348000, 0x348FFF, "BÄR Bahnsicherung AG", "BAER-BAHNSICHERUNG" },
-	{ 0x70B3D5, 0xA30000, 0xA30FFF, "SHEN ZHEN HUAWANG TECHNOLOGY CO; LTD", "SHEN-ZHEN-HUAWANG" },
-	{ 0x70B3D5, 0xDFD000, 0xDFDFFF, "Contiweb", "CONTIWEB" },
-	{ 0x70B3D5, 0xB30000, 0xB30FFF, "Systolé Hardware B.V.", "SYSTOLé-HARDWARE" },
-	{ 0x70B3D5, 0x3BF000, 0x3BFFFF, "Star Electronics GmbH & Co. KG", "STAR-ELECTRONICS" },
-	{ 0x70B3D5, 0x745000, 0x745FFF, "TMSI LLC", "TMSI-LLC" },
-	{ 0x70B3D5, 0xD1C000, 0xD1CFFF, "Specialised Imaging Limited", "SPECIALISED-IMAGING" },
-	{ 0x70B3D5, 0xE8E000, 0xE8EFFF, "Macnica Technology", "MACNICA" },
-	{ 0x70B3D5, 0xADF000, 0xADFFFF, "Seraphim Optronics Ltd", "SERAPHIM-OPTRONICS" },
-	{ 0x70B3D5, 0x22C000, 0x22CFFF, "Hiquel Elektronik- und Anlagenbau GmbH", "HIQUEL-ELEKTRONIK--UND-ANLAGENBAU" },
-	{ 0x70B3D5, 0xDCE000, 0xDCEFFF, "Stahl GmbH", "STAHL" },
-	{ 0x70B3D5, 0x2A2000, 0x2A2FFF, "Visualware, Inc.", "VISUALWARE" },
-	{ 0x70B3D5, 0xD08000, 0xD08FFF, "Veeco Instruments", "VEECO-INSTRUMENTS" },
-	{ 0x70B3D5, 0x630000, 0x630FFF, "LGE", "LGE" },
-	{ 0x70B3D5, 0x873000, 0x873FFF, "Vishay Nobel AB", "VISHAY-NOBEL-AB" },
-	{ 0x70B3D5, 0x653000, 0x653FFF, "Luxar Tech, Inc.", "LUXAR-TECH" },
-	{ 0x70B3D5, 0xF1F000, 0xF1FFFF, "HKC Limited", "HKC" },
-	{ 0x70B3D5, 0xAF6000, 0xAF6FFF, "S.C.E. srl", "S-C-E-SRL" },
-	{ 0x70B3D5, 0xF37000, 0xF37FFF, "Mitsubishi Electric Micro-Computer Application Software Co.,Ltd.", "MITSUBISHI-ELECTRIC-MICRO--APPLICATION-SOFTWARE" },
-	{ 0x70B3D5, 0x8C3000, 0x8C3FFF, "Wyebot, Inc.", "WYEBOT" },
-	{ 0x70B3D5, 0x42D000, 0x42DFFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
-	{ 0x70B3D5, 0x332000, 0x332FFF, "InnoSenT", "INNOSENT" },
-	{ 0x70B3D5, 0xDEE000, 0xDEEFFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xA47000, 0xA47FFF, "KANOA INC", "KANOA" },
-	{ 0x70B3D5, 0xF45000, 0xF45FFF, "Norbit ODM AS", "NORBIT-ODM-AS" },
-	{ 0x70B3D5, 0xE59000, 0xE59FFF, "Fracarro srl", "FRACARRO-SRL" },
-	{ 0x70B3D5, 0x127000, 0x127FFF, "VITEC", "VITEC" },
-	{ 0x001BC5, 0x046000, 0x046FFF, "GÉANT", "GÉANT" },
-	{ 0x70B3D5, 0x9DE000, 0x9DEFFF, "System 11 Sp. z o.o.", "SYSTEM-11-SP-Z-O-O" },
-	{ 0x70B3D5, 0x96D000, 0x96DFFF, "MSB Elektronik und Gerätebau GmbH", "MSB-ELEKTRONIK-UND-GERAETEBAU" },
-	{ 0x70B3D5, 0xC17000, 0xC17FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0x108000, 0x108FFF, "TEX COMPUTER SRL", "TEX-SRL" },
-	{ 0x70B3D5, 0x007000, 0x007FFF, "SENSONEO", "SENSONEO" },
-	{ 0x70B3D5, 0x4E7000, 0x4E7FFF, "Digital Domain", "DIGITAL-DOMAIN" },
-	{ 0x70B3D5, 0xD10000, 0xD10FFF, "Contec DTx", "CONTEC-DTX" },
-	{ 0x70B3D5, 0x7F3000, 0x7F3FFF, "Shenzhen Virtual Clusters Information Technology Co.,Ltd.", "SHENZHEN-VIRTUAL-CLUSTERS-INFORMATION" },
-	{ 0x70B3D5, 0xC8C000, 0xC8CFFF, "Rollogo Limited", "ROLLOGO" },
-	{ 0x70B3D5, 0xD4C000, 0xD4CFFF, "Elystec Technology Co., Ltd", "ELYSTEC" },
-	{ 0x70B3D5, 0x96B000, 0x96BFFF, "FOCAL-JMLab", "FOCAL-JMLAB" },
-	{ 0x70B3D5, 0x84D000, 0x84DFFF, "Quantum Design Inc.", "QUANTUM-DESIGN" },
-	{ 0x70B3D5, 0xE57000, 0xE57FFF, "Iradimed", "IRADIMED" },
-	{ 0x70B3D5, 0x125000, 0x125FFF, "Securolytics, Inc.", "SECUROLYTICS" },
-	{ 0x70B3D5, 0xC6E000, 0xC6EFFF, "Orion Technologies, LLC", "ORION-TECHNOLOGIES-LLC" },
-	{ 0x70B3D5, 0xCC8000, 0xCC8FFF, "PROFEN COMMUNICATIONS", "PROFEN-COMMUNICATION" },
-	{ 0x70B3D5, 0xFDB000, 0xFDBFFF, "Design SHIFT", "DESIGN-SHIFT" },
-	{ 0x70B3D5, 0x791000, 0x791FFF, "Romteck Australia", "ROMTECK-AUSTRALIA" },
-	{ 0x70B3D5, 0xD20000, 0xD20FFF, "Rheonics GmbH", "RHEONICS" },
-	{ 0x70B3D5, 0x69F000, 0x69FFFF, "T+A elektroakustik GmbH & Co.KG", "T+A-ELEKTROAKUSTIK" },
-	{ 0x70B3D5, 0x768000, 0x768FFF, "Kazan Networks Corporation", "KAZAN-NETWORKS" },
-	{ 0x70B3D5, 0x6B2000, 0x6B2FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x7F7000, 0x7F7FFF, "JASCO Applied Sciences Canada Ltd", "JASCO-APPLIED-SCIENCES-CANADA" },
-	{ 0x70B3D5, 0xF42000, 0xF42FFF, "Matsuhisa Corporation", "MATSUHISA" },
-	{ 0x70B3D5, 0x381000, 0x381FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x488000, 0x488FFF, "Cardinal Scale Mfg Co", "CARDINAL-SCALE-MFG" },
-	{ 0x70B3D5, 0x273000, 0x273FFF, "WeVo Tech", "WEVO-TECH" },
-	{ 0x70B3D5, 0x379000, 0x379FFF, "Vensi, Inc.", "VENSI" },
-	{ 0x70B3D5, 0x0B2000, 0x0B2FFF, "ndb technologies", "NDB-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xCB3000, 0xCB3FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x30D000, 0x30DFFF, "Fiberbase", "FIBERBASE" },
-	{ 0x70B3D5, 0x842000, 0x842FFF, "PLUTO Solution co.,ltd.", "PLUTO-SOLUTION" },
-	{ 0x70B3D5, 0xEB9000, 0xEB9FFF, "Thiel Audio Products Company, LLC", "THIEL-AUDIO-PRODUCTS-COMPANY-LLC" },
-	{ 0x70B3D5, 0x2CA000, 0x2CAFFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x8E3000, 0x8E3FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0x469000, 0x469FFF, "Gentec Systems Co.", "GENTEC" },
-	{ 0x70B3D5, 0xAAF000, 0xAAFFFF, "Exi Flow Measurement Ltd", "EXI-FLOW-MEASUREMENT" },
-	{ 0x70B3D5, 0xD4A000, 0xD4AFFF, "OÜ ELIKO Tehnoloogia Arenduskeskus", "OUE-ELIKO-TEHNOLOOGIA-ARENDUSKESKUS" },
-	{ 0x70B3D5, 0x2C9000, 0x2C9FFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
-	{ 0x70B3D5, 0x728000, 0x728FFF, "BCD Audio", "BCD-AUDIO" },
-	{ 0x70B3D5, 0xD89000, 0xD89FFF, "Resolution Systems", "RESOLUTION" },
-	{ 0x70B3D5, 0xF06000, 0xF06FFF, "WARECUBE,INC", "WARECUBE" },
-	{ 0x70B3D5, 0x651000, 0x651FFF, "Roxford", "ROXFORD" },
-	{ 0x70B3D5, 0x8B4000, 0x8B4FFF, "Scenario Automation", "SCENARIO-AUTOMATION" },
-	{ 0x70B3D5, 0x532000, 0x532FFF, "Talleres de Escoriaza SA", "TALLERES-DE-ESCORIAZA" },
-	{ 0x70B3D5, 0x8D9000, 0x8D9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x1D1000, 0x1D1FFF, "Eurotek Srl", "EUROTEK-SRL" },
-	{ 0x70B3D5, 0x027000, 0x027FFF, "Redcap Solutions s.r.o.", "REDCAP-SOLUTIONS-S-R-O" },
-	{ 0x70B3D5, 0x92F000, 0x92FFFF, "SiFive", "SIFIVE" },
-	{ 0x70B3D5, 0xA82000, 0xA82FFF, "Telefrank GmbH", "TELEFRANK" },
-	{ 0x70B3D5, 0x037000, 0x037FFF, "EIFFAGE ENERGIE ELECTRONIQUE", "EIFFAGE-ENERGIE-ELECTRONIQUE" },
-	{ 0x70B3D5, 0x77E000, 0x77EFFF, "Blue Marble Communications, Inc.", "BLUE-MARBLE-COMMUNICATION" },
-	{ 0x70B3D5, 0xD7C000, 0xD7CFFF, "D.T.S Illuminazione Srl", "D-T-S-ILLUMINAZIONE-SRL" },
-	{ 0x70B3D5, 0x3C9000, 0x3C9FFF, "Duerkopp-Adler", "DUERKOPP-ADLER" },
-	{ 0x70B3D5, 0x109000, 0x109FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x70B3D5, 0xE9E000, 0xE9EFFF, "MSB Elektronik und Gerätebau GmbH", "MSB-ELEKTRONIK-UND-GERAETEBAU" },
-	{ 0x70B3D5, 0x248000, 0x248FFF, "GL TECH CO.,LTD", "GL-TECH" },
-	{ 0x70B3D5, 0xA0A000, 0xA0AFFF, "CAPSYS", "CAPSYS" },
-	{ 0x70B3D5, 0xCE2000, 0xCE2FFF, "Centero", "CENTERO" },
-	{ 0x70B3D5, 0xCD0000, 0xCD0FFF, "Ellenex Pty Ltd", "ELLENEX-PTY" },
-	{ 0x70B3D5, 0x9AA000, 0x9AAFFF, "Tecsys do Brasil Industrial Ltda", "TECSYS-DO-BRASIL-INDUSTRIAL-LTDA" },
-	{ 0x70B3D5, 0x0C9000, 0x0C9FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
-	{ 0x70B3D5, 0xFEA000, 0xFEAFFF, "Heng Dian Technology Co., Ltd", "HENG-DIAN" },
-	{ 0x70B3D5, 0x5FB000, 0x5FBFFF, "TELEPLATFORMS", "TELEPLATFORMS" },
-	{ 0x70B3D5, 0x401000, 0x401FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x9E3000, 0x9E3FFF, "LG Electronics", "LG-ELECTRONICS" },
-	{ 0x70B3D5, 0x960000, 0x960FFF, "HORIZON TELECOM", "HORIZON-TELECOM" },
-	{ 0x70B3D5, 0x06F000, 0x06FFFF, "Beijing Daswell Science and Technology Co.LTD", "BEIJING-DASWELL-SCIENCE-AND" },
-	{ 0x70B3D5, 0x73A000, 0x73AFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xF52000, 0xF52FFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
-	{ 0x70B3D5, 0xEEC000, 0xEECFFF, "Impolux GmbH", "IMPOLUX" },
-	{ 0x70B3D5, 0x105000, 0x105FFF, "Beijing Nacao Technology Co., Ltd.", "BEIJING-NACAO" },
-	{ 0x70B3D5, 0x3E6000, 0x3E6FFF, "machineQ", "MACHINEQ" },
-	{ 0x70B3D5, 0xAA2000, 0xAA2FFF, "eumig industrie-TV GmbH.", "EUMIG-INDUSTRIE-TV" },
-	{ 0x70B3D5, 0xC0B000, 0xC0BFFF, "FSTUDIO CO LTD", "FSTUDIO" },
-	{ 0x70B3D5, 0xDB4000, 0xDB4FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0x706000, 0x706FFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x70B3D5, 0x6F7000, 0x6F7FFF, "EGICON SRL", "EGICON-SRL" },
-	{ 0x70B3D5, 0x0A8000, 0x0A8FFF, "Symetrics Industries d.b.a. Extant Aerospace", "SYMETRICS-INDUSTRIES-D-B-A-EXTANT-AEROSPACE" },
-	{ 0x70B3D5, 0xC38000, 0xC38FFF, "CRESPRIT INC.", "CRESPRIT" },
-	{ 0x70B3D5, 0x675000, 0x675FFF, "alfamation spa", "ALFAMATION-SPA" },
-	{ 0x70B3D5, 0xC05000, 0xC05FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0xA94000, 0xA94FFF, "ETA Technology Pvt Ltd", "ETA-PVT" },
-	{ 0x70B3D5, 0xA64000, 0xA64FFF, "Newshine", "NEWSHINE" },
-	{ 0x70B3D5, 0xE2B000, 0xE2BFFF, "Guan Show Technologe Co., Ltd.", "GUAN-SHOW-TECHNOLOGE" },
-	{ 0x70B3D5, 0x950000, 0x950FFF, "CMT Medical technologies", "CMT-MEDICAL-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x56A000, 0x56AFFF, "Harvard Technology Ltd", "HARVARD" },
-	{ 0x70B3D5, 0x69C000, 0x69CFFF, "Keepen", "KEEPEN" },
-	{ 0x70B3D5, 0xBC1000, 0xBC1FFF, "Abionic", "ABIONIC" },
-	{ 0x70B3D5, 0x0E1000, 0x0E1FFF, "MiWave Consulting, LLC", "MIWAVE-CONSULTING-LLC" },
-	{ 0x70B3D5, 0x5CF000, 0x5CFFFF, "PROEL TSI s.r.l.", "PROEL-TSI-S-R-L" },
-	{ 0x70B3D5, 0x050000, 0x050FFF, "Compusign Systems Pty Ltd", "COMPUSIGN-PTY" },
-	{ 0x70B3D5, 0x3F7000, 0x3F7FFF, "Advansid", "ADVANSID" },
-	{ 0x70B3D5, 0x764000, 0x764FFF, "SCHMID electronic", "SCHMID" },
-	{ 0x70B3D5, 0x966000, 0x966FFF, "dA Tomato Limited", "DA-TOMATO" },
-	{ 0x70B3D5, 0x42E000, 0x42EFFF, "Dr. Zinngrebe GmbH", "DR-ZINNGREBE" },
-	{ 0x70B3D5, 0xDD5000, 0xDD5FFF, "Cooltera Limited", "COOLTERA" },
-	{ 0x70B3D5, 0x937000, 0x937FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x189000, 0x189FFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x70B3D5, 0xBD8000, 0xBD8FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0xF67000, 0xF67FFF, "winsun AG", "WINSUN" },
-	{ 0x70B3D5, 0xA5F000, 0xA5FFFF, "Daatrics LTD", "DAATRICS" },
-	{ 0x70B3D5, 0x441000, 0x441FFF, "Videoport S.A.", "VIDEOPORT" },
-	{ 0x70B3D5, 0x334000, 0x334FFF, "Dokuen Co. Ltd.", "DOKUEN" },
-	{ 0x70B3D5, 0xF27000, 0xF27FFF, "NIRIT- Xinwei Telecom Technology Co., Ltd.", "NIRIT--XINWEI-TELECOM" },
-	{ 0x70B3D5, 0x759000, 0x759FFF, "AML", "AML" },
-	{ 0x70B3D5, 0x623000, 0x623FFF, "Beijing HuaLian Technology Co, Ltd.", "BEIJING-HUALIAN" },
-	{ 0x70B3D5, 0xB71000, 0xB71FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x8DA000, 0x8DAFFF, "MicroElectronics System Co.Ltd", "MICROELECTRONICS-SYSTEM" },
-	{ 0x70B3D5, 0x7DC000, 0x7DCFFF, "Software Systems Plus", "SOFTWARE-PLUS" },
-	{ 0x70B3D5, 0x2E8000, 0x2E8FFF, "Telefire", "TELEFIRE" },
-	{ 0x70B3D5, 0x338000, 0x338FFF, "Opti-Sciences, Inc.", "OPTI-SCIENCES" },
-	{ 0x70B3D5, 0x2F5000, 0x2F5FFF, "eze System, Inc.", "EZE-SYSTEM" },
-	{ 0x001BC5, 0x015000, 0x015FFF, "Corporate Systems Engineering", "CORPORATE-ENGINEERING" },
-	{ 0x70B3D5, 0x580000, 0x580FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xBB0000, 0xBB0FFF, "WICELL TECHNOLOGY", "WICELL" },
-	{ 0x70B3D5, 0xCA1000, 0xCA1FFF, "Waldo System", "WALDO-SYSTEM" },
-	{ 0x70B3D5, 0x302000, 0x302FFF, "DogWatch Inc", "DOGWATCH" },
-	{ 0x70B3D5, 0xB10000, 0xB10FFF, "Zumbach Electronic AG", "ZUMBACH" },
-	{ 0x70B3D5, 0xF9B000, 0xF9BFFF, "EvoLogics GmbH", "EVOLOGICS" },
-	{ 0x70B3D5, 0xA84000, 0xA84FFF, "SOREL GmbH Mikroelektronik", "SOREL-MIKROELEKTRONIK" },
-	{ 0x70B3D5, 0x802000, 0x802FFF, "Qingdao CNR HITACH Railway Signal&communication co.,ltd", "QINGDAO-CNR-HITACH-RAILWAY-SIGNAL-COMMUNICATION" },
-	{ 0x70B3D5, 0x19A000, 0x19AFFF, "WiSuite USA", "WISUITE-USA" },
-	{ 0x70B3D5, 0x072000, 0x072FFF, "Lightdrop", "LIGHTDROP" },
-	{ 0x70B3D5, 0xF21000, 0xF21FFF, "dds", "DDS" },
-	{ 0x70B3D5, 0x25F000, 0x25FFFF, "COPPERNIC SAS", "COPPERNIC-SAS" },
-	{ 0x70B3D5, 0x57A000, 0x57AFFF, "Rhythm Engineering, LLC.", "RHYTHM-ENGINEERING-LLC" },
-	{ 0x70B3D5, 0xA75000, 0xA75FFF, "Taejin InforTech", "TAEJIN-INFORTECH" },
-	{ 0x70B3D5, 0x1EE000, 0x1EEFFF, "MEGGITT", "MEGGITT" },
-	{ 0x70B3D5, 0xF6F000, 0xF6FFFF, "Smashtag Ltd", "SMASHTAG" },
-	{ 0x70B3D5, 0x2DE000, 0x2DEFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0xB5F000, 0xB5FFFF, "CRDMDEVEOPPEMENTS", "CRDMDEVEOPPEMENTS" },
-	{ 0x70B3D5, 0xFAB000, 0xFABFFF, "Open System Solutions Limited", "OPEN-SYSTEM-SOLUTIONS" },
-	{ 0x70B3D5, 0xC29000, 0xC29FFF, "SOFTLAND INDIA LTD", "SOFTLAND-INDIA" },
-	{ 0x70B3D5, 0xF04000, 0xF04FFF, "Scame Sistemi srl", "SCAME-SISTEMI-SRL" },
-	{ 0x70B3D5, 0x494000, 0x494FFF, "Schildknecht AG", "SCHILDKNECHT" },
-	{ 0x70B3D5, 0xBF2000, 0xBF2FFF, "TWIN DEVELOPMENT", "TWIN-DEVELOPMENT" },
-	{ 0x70B3D5, 0x901000, 0x901FFF, "ATS-CONVERS", "ATS-CONVERS" },
-	{ 0x70B3D5, 0x654000, 0x654FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x70B3D5, 0xF6E000, 0xF6EFFF, "Streambox Inc", "STREAMBOX" },
-	{ 0x70B3D5, 0xD5B000, 0xD5BFFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x6CD000, 0x6CDFFF, "NORTHBOUND NETWORKS PTY. LTD.", "NORTHBOUND-NETWORKS-PTY" },
-	{ 0x70B3D5, 0xB7C000, 0xB7CFFF, "Electronic Navigation Ltd", "NAVIGATION" },
-	{ 0x70B3D5, 0xC92000, 0xC92FFF, "Unitro Fleischmann", "UNITRO-FLEISCHMANN" },
-	{ 0x70B3D5, 0x8A0000, 0x8A0FFF, "DM RADIOCOM", "DM-RADIOCOM" },
-	{ 0x70B3D5, 0x081000, 0x081FFF, "IST Technologies (SHENZHEN) Limited", "IST-TECHNOLOGIES-SHENZHEN" },
-	{ 0x70B3D5, 0xC77000, 0xC77FFF, "Yönnet Akıllı Bina ve Otomasyon Sistemleri", "YOENNET-AKıLLı-BINA-VE-OTOMASYON-SISTEMLERI" },
-	{ 0x70B3D5, 0xD74000, 0xD74FFF, "Sandia National Laboratories", "SANDIA-NATIONAL-LABORATORIES" },
-	{ 0x70B3D5, 0xFCF000, 0xFCFFFF, "Acc+Ess Ltd", "ACC+ESS" },
-	{ 0x70B3D5, 0x3C0000, 0x3C0FFF, "DK-Technologies A/S", "DK-TECHNOLOGIES-A/S" },
-	{ 0x70B3D5, 0x2F6000, 0x2F6FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x364000, 0x364FFF, "ADAMCZEWSKI elektronische Messtechnik GmbH", "ADAMCZEWSKI-ELEKTRONISCHE-MESSTECHNIK" },
-	{ 0x70B3D5, 0x48E000, 0x48EFFF, "Allim System Co,.Ltd.", "ALLIM-SYSTEM" },
-	{ 0x70B3D5, 0x9ED000, 0x9EDFFF, "Benchmark Electronics BV", "BENCHMARK-ELECTRONICS" },
-	{ 0x70B3D5, 0x774000, 0x774FFF, "Micram Instruments Ltd", "MICRAM-INSTRUMENTS" },
-	{ 0x70B3D5, 0x76A000, 0x76AFFF, "Swiftnet SOC Ltd", "SWIFTNET-SOC" },
-	{ 0x70B3D5, 0x061000, 0x061FFF, "IntelliDesign Pty Ltd", "INTELLIDESIGN-PTY" },
-	{ 0x70B3D5, 0x383000, 0x383FFF, "LPA Excil Electronics", "LPA-EXCIL-ELECTRONICS" },
-	{ 0x70B3D5, 0x504000, 0x504FFF, "Xsight Systems Ltd.", "XSIGHT" },
-	{ 0x70B3D5, 0x2CE000, 0x2CEFFF, "KDT", "KDT" },
-	{ 0x70B3D5, 0xC07000, 0xC07FFF, "ARECO", "ARECO" },
-	{ 0x70B3D5, 0xDCA000, 0xDCAFFF, "DSan Corporation", "DSAN" },
-	{ 0x70B3D5, 0x25B000, 0x25BFFF, "GID Industrial", "GID-INDUSTRIAL" },
-	{ 0x70B3D5, 0x313000, 0x313FFF, "DIEHL Controls", "DIEHL-CONTROLS" },
-	{ 0x70B3D5, 0x645000, 0x645FFF, "Project Decibel, Inc.", "PROJECT-DECIBEL" },
-	{ 0x70B3D5, 0x377000, 0x377FFF, "Monnit Corporation", "MONNIT" },
-	{ 0x70B3D5, 0xA12000, 0xA12FFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
-	{ 0x70B3D5, 0xB34000, 0xB34FFF, "Medtronic", "MEDTRONIC" },
-	{ 0x70B3D5, 0x303000, 0x303FFF, "Fuchu Giken, Inc.", "FUCHU-GIKEN" },
-	{ 0x70B3D5, 0x6F9000, 0x6F9FFF, "ENVItech s.r.o.", "ENVITECH-S-R-O" },
-	{ 0x70B3D5, 0x100000, 0x100FFF, "Gupsy GmbH", "GUPSY" },
-	{ 0x70B3D5, 0xC89000, 0xC89FFF, "ARD", "ARD" },
-	{ 0x70B3D5, 0x2E0000, 0x2E0FFF, "Peter Huber", "PETER-HUBER" },
-	{ 0x70B3D5, 0x088000, 0x088FFF, "OptiScan Biomedical Corp.", "OPTISCAN-BIOMEDICAL" },
-	{ 0x70B3D5, 0x226000, 0x226FFF, "Yaviar", "YAVIAR" },
-	{ 0x70B3D5, 0xD57000, 0xD57FFF, "TRIUMPH BOARD a.s.", "TRIUMPH-BOARD-A-S" },
-	{ 0x70B3D5, 0x4DB000, 0x4DBFFF, "Temperature@lert", "TEMPERATURE@LERT" },
-	{ 0x70B3D5, 0x343000, 0x343FFF, "Elektro-System s.c.", "ELEKTRO-SYSTEM-S-C" },
-	{ 0x70B3D5, 0x9F2000, 0x9F2FFF, "Acorde Technologies", "ACORDE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xE3B000, 0xE3BFFF, "ComNav Technology Ltd.", "COMNAV" },
-	{ 0x70B3D5, 0x703000, 0x703FFF, "StromIdee GmbH", "STROMIDEE" },
-	{ 0x70B3D5, 0xE6D000, 0xE6DFFF, "Domus S.C.", "DOMUS-S-C" },
-	{ 0x70B3D5, 0xF00000, 0xF00FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x7C3000, 0x7C3FFF, "Flexim Security Oy", "FLEXIM-SECURITY-OY" },
-	{ 0x70B3D5, 0x3E4000, 0x3E4FFF, "Neptec Technologies Corp.", "NEPTEC-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x595000, 0x595FFF, "PLR Prueftechnik Linke und Ruehe GmbH", "PLR-PRUEFTECHNIK-LINKE-UND-RUEHE" },
-	{ 0x70B3D5, 0xE36000, 0xE36FFF, "Guidance Navigation Limited", "GUIDANCE-NAVIGATION" },
-	{ 0x70B3D5, 0xB47000, 0xB47FFF, "DSIT Solutions LTD", "DSIT-SOLUTIONS" },
-	{ 0x70B3D5, 0x2F1000, 0x2F1FFF, "Inspike S.R.L.", "INSPIKE-S-R-L" },
-	{ 0x70B3D5, 0xAFB000, 0xAFBFFF, "Shanghai Tianhe Automation Instrumentation Co., Ltd.", "SHANGHAI-TIANHE-AUTOMATION-INSTRUMENTATION" },
-	{ 0x70B3D5, 0xAD5000, 0xAD5FFF, "Birdland Audio", "BIRDLAND-AUDIO" },
-	{ 0x70B3D5, 0xF93000, 0xF93FFF, "Hella Gutmann Solutions GmbH", "HELLA-GUTMANN-SOLUTIONS" },
-	{ 0x70B3D5, 0xF01000, 0xF01FFF, "Software Systems Plus", "SOFTWARE-PLUS" },
-	{ 0x70B3D5, 0x3E2000, 0x3E2FFF, "AVI Pty Ltd", "AVI-PTY" },
-	{ 0x70B3D5, 0xC2A000, 0xC2AFFF, "Array Telepresence", "ARRAY-TELEPRESENCE" },
-	{ 0x70B3D5, 0xF8E000, 0xF8EFFF, "Isabellenhütte Heusler Gmbh &Co KG", "ISABELLENHUETTE-HEUSLER" },
-	{ 0x70B3D5, 0xFA2000, 0xFA2FFF, "Sarokal Test Systems Oy", "SAROKAL-TEST-OY" },
-	{ 0x70B3D5, 0x134000, 0x134FFF, "Conjing Networks Inc.", "CONJING-NETWORKS" },
-	{ 0x70B3D5, 0x208000, 0x208FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x70B3D5, 0x870000, 0x870FFF, "bentrup Industriesteuerungen", "BENTRUP-INDUSTRIESTEUERUNGEN" },
-	{ 0x70B3D5, 0x4D8000, 0x4D8FFF, "Versilis Inc.", "VERSILIS" },
-	{ 0x70B3D5, 0xA26000, 0xA26FFF, "Hear Gear, Inc.", "HEAR-GEAR" },
-	{ 0x70B3D5, 0xC87000, 0xC87FFF, "Siemens AG", "SIEMENS" },
-	{ 0x70B3D5, 0x7AE000, 0x7AEFFF, "Exi Flow Measurement Ltd", "EXI-FLOW-MEASUREMENT" },
-	{ 0x70B3D5, 0x4DF000, 0x4DFFFF, "Nidec Avtron Automation Corp", "NIDEC-AVTRON-AUTOMATION" },
-	{ 0x70B3D5, 0x4AD000, 0x4ADFFF, "GACI", "GACI" },
-	{ 0x70B3D5, 0xDF9000, 0xDF9FFF, "Korea Plant Maintenance", "KOREA-PLANT-MAINTENANCE" },
-	{ 0x70B3D5, 0xBAE000, 0xBAEFFF, "WARECUBE,INC", "WARECUBE" },
-	{ 0x70B3D5, 0x119000, 0x119FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xC85000, 0xC85FFF, "Solid State Disks Ltd", "SOLID-STATE-DISKS" },
-	{ 0x70B3D5, 0xA44000, 0xA44FFF, "FSR Inc", "FSR" },
-	{ 0x70B3D5, 0x347000, 0x347FFF, "OAS Sweden AB", "OAS-SWEDEN-AB" },
-	{ 0x70B3D5, 0x361000, 0x361FFF, "Parent Power", "PARENT-POWER" },
-	{ 0x70B3D5, 0xFA4000, 0xFA4FFF, "Energybox Limited", "ENERGYBOX" },
-	{ 0x70B3D5, 0xA2A000, 0xA2AFFF, "Redwood Systems", "REDWOOD" },
-	{ 0x70B3D5, 0x73E000, 0x73EFFF, "Trident RFID Pty Ltd", "TRIDENT-RFID-PTY" },
-	{ 0x70B3D5, 0x65D000, 0x65DFFF, "GEGA ELECTRONIQUE", "GEGA-ELECTRONIQUE" },
-	{ 0x70B3D5, 0x9BD000, 0x9BDFFF, "Signal Processing Devices Sweden AB", "SIGNAL-PROCESSING-DEVICES-SWEDEN-AB" },
-	{ 0x70B3D5, 0xAA7000, 0xAA7FFF, "ATEME", "ATEME" },
-	{ 0x70B3D5, 0x20E000, 0x20EFFF, "Amrehn & Partner EDV-Service GmbH", "AMREHN-PARTNER-EDV-SERVICE" },
-	{ 0x70B3D5, 0xE70000, 0xE70FFF, "DISK Multimedia s.r.o.", "DISK-MULTIMEDIA-S-R-O" },
-	{ 0x70B3D5, 0xEAB000, 0xEABFFF, "APEN GROUP SpA (VAT IT08767740155)", "APEN-GROUP-SPA-VAT-IT08767740155" },
-	{ 0x70B3D5, 0x79E000, 0x79EFFF, "CW2. Gmbh & Co. KG", "CW2" },
-	{ 0x70B3D5, 0xEB1000, 0xEB1FFF, "CP contech electronic GmbH", "CP-CONTECH" },
-	{ 0x70B3D5, 0xD97000, 0xD97FFF, "BRS Sistemas Eletronicos", "BRS-SISTEMAS-ELETRONICOS" },
-	{ 0x70B3D5, 0x63A000, 0x63AFFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x70B3D5, 0xC9B000, 0xC9BFFF, "Tieto Sweden AB", "TIETO-SWEDEN-AB" },
-	{ 0x70B3D5, 0x4F0000, 0x4F0FFF, "Li Seng Technology Ltd.,", "LI-SENG" },
-	{ 0x70B3D5, 0xF92000, 0xF92FFF, "TechOne", "TECHONE" },
-	{ 0x70B3D5, 0xD1F000, 0xD1FFFF, "Embsec AB", "EMBSEC-AB" },
-	{ 0x70B3D5, 0x796000, 0x796FFF, "GAMPT mbH", "GAMPT-MBH" },
-	{ 0x70B3D5, 0x0A5000, 0x0A5FFF, "FUELCELLPOWER", "FUELCELLPOWER" },
-	{ 0x70B3D5, 0xAB9000, 0xAB9FFF, "Dynamic Controls", "DYNAMIC-CONTROLS" },
-	{ 0x70B3D5, 0xC25000, 0xC25FFF, "speedsignal GmbH", "SPEEDSIGNAL" },
-	{ 0x70B3D5, 0x6E4000, 0x6E4FFF, "Institute of Power Engineering, Gdansk Division", "INSTITUTE-OF-POWER-ENGINEERING-GDANSK-DIVISION" },
-	{ 0x70B3D5, 0xD46000, 0xD46FFF, "Contineo s.r.o.", "CONTINEO-S-R-O" },
-	{ 0x70B3D5, 0x665000, 0x665FFF, "CertUsus GmbH", "CERTUSUS" },
-	{ 0x70B3D5, 0xA50000, 0xA50FFF, "LECIP CORPORATION", "LECIP" },
-	{ 0x70B3D5, 0xA4B000, 0xA4BFFF, "McKay Brothers LLC", "MCKAY-BROTHERS-LLC" },
-	{ 0x70B3D5, 0x5E4000, 0x5E4FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x70B3D5, 0xDF0000, 0xDF0FFF, "astozi consulting Tomasz Zieba", "ASTOZI-CONSULTING-TOMASZ-ZIEBA" },
-	{ 0x70B3D5, 0xCF3000, 0xCF3FFF, "Mesh Motion Inc", "MESH-MOTION" },
-	{ 0x70B3D5, 0x0B3000, 0x0B3FFF, "Reonix Automation", "REONIX-AUTOMATION" },
-	{ 0x70B3D5, 0x34A000, 0x34AFFF, "PAVO TASARIM ÜRETİM TİC A.Ş.", "PAVO-TASARIM-UERETİM-TİC-A-Ş" },
-	{ 0x70B3D5, 0x6E5000, 0x6E5FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x8F5000, 0x8F5FFF, "Stmovic", "STMOVIC" },
-	{ 0x70B3D5, 0xABF000, 0xABFFFF, "AGR International", "AGR" },
-	{ 0x70B3D5, 0x755000, 0x755FFF, "LandmarkTech Systems Technology Co.,Ltd.", "LANDMARKTECH" },
-	{ 0x70B3D5, 0xB3C000, 0xB3CFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0x57B000, 0x57BFFF, "ELAMAKATO GmbH", "ELAMAKATO" },
-	{ 0x70B3D5, 0xA57000, 0xA57FFF, "PCSC", "PCSC" },
-	{ 0x70B3D5, 0x8E1000, 0x8E1FFF, "WoKa-Elektronik GmbH", "WOKA-ELEKTRONIK" },
-	{ 0x70B3D5, 0xBA4000, 0xBA4FFF, "EIWA GIKEN INC.", "EIWA-GIKEN" },
-	{ 0x70B3D5, 0xF8C000, 0xF8CFFF, "EUROPEAN ADVANCED TECHNOLOGIES", "EUROPEAN-ADVANCED-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x85C000, 0x85CFFF, "Robot Pub Group", "ROBOT-PUB-GROUP" },
-	{ 0x70B3D5, 0xAFA000, 0xAFAFFF, "Power Security Systems Ltd.", "POWER-SECURITY" },
-	{ 0x70B3D5, 0x77C000, 0x77CFFF, "HUSTY M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x70B3D5, 0xCDE000, 0xCDEFFF, "Multipure International", "MULTIPURE" },
-	{ 0x70B3D5, 0xF2B000, 0xF2BFFF, "SENSYS GmbH", "SENSYS" },
-	{ 0x70B3D5, 0x731000, 0x731FFF, "Phoniro Systems AB", "PHONIRO-AB" },
-	{ 0x70B3D5, 0x36D000, 0x36DFFF, "Cyberteam Sp z o o", "CYBERTEAM-SP-Z-O-O" },
-	{ 0x70B3D5, 0xB82000, 0xB82FFF, "Lookout Portable Security", "LOOKOUT-PORTABLE-SECURITY" },
-	{ 0x70B3D5, 0x220000, 0x220FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xD0C000, 0xD0CFFF, "Connor Winfield LTD", "CONNOR-WINFIELD" },
-	{ 0x70B3D5, 0xCB7000, 0xCB7FFF, "HKC Limited", "HKC" },
-	{ 0x70B3D5, 0x3E1000, 0x3E1FFF, "Barnstormer Softworks", "BARNSTORMER-SOFTWORKS" },
-	{ 0x70B3D5, 0x96F000, 0x96FFFF, "4CAM GmbH", "4CAM" },
-	{ 0x70B3D5, 0x8CE000, 0x8CEFFF, "CORES Corporation", "CORES" },
-	{ 0x70B3D5, 0x23C000, 0x23CFFF, "Quasonix, LLC", "QUASONIX-LLC" },
-	{ 0x70B3D5, 0x79A000, 0x79AFFF, "Innerspec Technologies Inc.", "INNERSPEC-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x51D000, 0x51DFFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x70B3D5, 0x61F000, 0x61FFFF, "Labotect Labor-Technik-Göttingen GmbH", "LABOTECT-LABOR-TECHNIK-GOETTINGEN" },
-	{ 0x70B3D5, 0x4C1000, 0x4C1FFF, "QUERCUS TECHNOLOGIES, S. L.", "QUERCUS-TECHNOLOGIES-S-L" },
-	{ 0x70B3D5, 0xA0E000, 0xA0EFFF, "Vetaphone A/S", "VETAPHONE-A/S" },
-	{ 0x70B3D5, 0x5AA000, 0x5AAFFF, "Chugoku Electric Manufacturing Co.,Inc", "CHUGOKU-ELECTRIC-MANUFACTURING" },
-	{ 0x70B3D5, 0x2D4000, 0x2D4FFF, "CT Company", "CT-COMPANY" },
-	{ 0x70B3D5, 0xC96000, 0xC96FFF, "UNI DIMENXI SDN BHD", "UNI-DIMENXI-SDN-BHD" },
-	{ 0x70B3D5, 0xE74000, 0xE74FFF, "Exfrontier Co., Ltd.", "EXFRONTIER" },
-	{ 0x70B3D5, 0xFD3000, 0xFD3FFF, "AKIS technologies", "AKIS-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xE53000, 0xE53FFF, "MI INC.", "MI" },
-	{ 0x70B3D5, 0x2F0000, 0x2F0FFF, "Clock-O-Matic", "CLOCK-O-MATIC" },
-	{ 0x70B3D5, 0x7A9000, 0x7A9FFF, "adidas AG", "ADIDAS" },
-	{ 0x70B3D5, 0xAC8000, 0xAC8FFF, "Heartland.Data Inc.", "HEARTLAND-DATA" },
-	{ 0x70B3D5, 0xF2A000, 0xF2AFFF, "WIBOND Informationssysteme GmbH", "WIBOND-INFORMATIONSSYSTEME" },
-	{ 0x70B3D5, 0x2A5000, 0x2A5FFF, "Taitotekniikka", "TAITOTEKNIIKKA" },
-	{ 0x70B3D5, 0x19C000, 0x19CFFF, "Kubu, Inc.", "KUBU" },
-	{ 0x70B3D5, 0x03B000, 0x03BFFF, "SSL - Electrical Aerospace Ground Equipment Section", "SSL---ELECTRICAL-AEROSPACE-GROUND-EQUIPMENT-SECTION" },
-	{ 0x70B3D5, 0xE9A000, 0xE9AFFF, "Meta Computing Services, Corp", "META-COMPUTING-SERVICES" },
-	{ 0x70B3D5, 0xE26000, 0xE26FFF, "FEITIAN CO.,LTD.", "FEITIAN" },
-	{ 0x70B3D5, 0xE4C000, 0xE4CFFF, "IAI-Israel Aerospace Industries MBT", "IAI-ISRAEL-AEROSPACE-INDUSTRIES-MBT" },
-	{ 0x70B3D5, 0xA40000, 0xA40FFF, "STRACK LIFT AUTOMATION GmbH", "STRACK-LIFT-AUTOMATION" },
+	{ 0x70B3D5, 0x00D000, 0x00DFFF, "Scrona AG", "SCRONA" },
+	{ 0x70B3D5, 0x00E000, 0x00EFFF, "Magosys Systems LTD", "MAGOSYS" },
+	{ 0x70B3D5, 0x010000, 0x010FFF, "Hanwa Electronic Ind.Co.,Ltd.", "HANWA-IND" },
+	{ 0x70B3D5, 0x011000, 0x011FFF, "Sumer Data S.L", "SUMER-DATA-S-L" },
+	{ 0x70B3D5, 0x012000, 0x012FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x013000, 0x013FFF, "Sportsbeams Lighting, Inc.", "SPORTSBEAMS-LIGHTING" },
+	{ 0x70B3D5, 0x014000, 0x014FFF, "FRAKO Kondensatoren und Anlagenbau GmbH", "FRAKO-KONDENSATOREN-UND-ANLAGENBAU" },
+	{ 0x70B3D5, 0x015000, 0x015FFF, "EN ElectronicNetwork Hamburg GmbH", "EN-ELECTRONICNETWORK-HAMBURG" },
 	{ 0x70B3D5, 0x016000, 0x016FFF, "Guardian Controls International Ltd", "GUARDIAN-CONTROLS" },
-	{ 0x70B3D5, 0xA7A000, 0xA7AFFF, "Fluid Management Technology", "FLUID-MANAGEMENT" },
-	{ 0x70B3D5, 0xC6A000, 0xC6AFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x819000, 0x819FFF, "«Intellect module» LLC", "«INTELLECT-MODULE»-LLC" },
-	{ 0x70B3D5, 0xEF3000, 0xEF3FFF, "octoScope", "OCTOSCOPE" },
-	{ 0x70B3D5, 0x9F4000, 0x9F4FFF, "Tband srl", "TBAND-SRL" },
-	{ 0x70B3D5, 0x35C000, 0x35CFFF, "ACS electronics srl", "ACS-ELECTRONICS-SRL" },
-	{ 0x70B3D5, 0x28F000, 0x28FFFF, "Overline Systems", "OVERLINE" },
-	{ 0x70B3D5, 0xF38000, 0xF38FFF, "Scanvaegt Nordic A/S", "SCANVAEGT-NORDIC-A/S" },
-	{ 0x001BC5, 0x0C5000, 0x0C5FFF, "Gill Instruments Ltd", "GILL-INSTRUMENTS" },
-	{ 0x70B3D5, 0x994000, 0x994FFF, "KeFF Networks", "KEFF-NETWORKS" },
-	{ 0x70B3D5, 0xB3D000, 0xB3DFFF, "Inras GmbH", "INRAS" },
-	{ 0x001BC5, 0x0B1000, 0x0B1FFF, "Roslen Eco-Networking Products", "ROSLEN-ECO-NETWORKING-PRODUCTS" },
-	{ 0x001BC5, 0x0A7000, 0x0A7FFF, "L.G.L. Electronics S.p.a.", "L-G-L-ELECTRONICS-S-P-A" },
-	{ 0x001BC5, 0x09C000, 0x09CFFF, "S.I.C.E.S. srl", "S-I-C-E-S-SRL" },
-	{ 0x001BC5, 0x092000, 0x092FFF, "Arnouse Digital Devices, Corp.", "ARNOUSE-DIGITAL-DEVICES" },
-	{ 0x001BC5, 0x088000, 0x088FFF, "UAB Kitron", "UAB-KITRON" },
-	{ 0x001BC5, 0x080000, 0x080FFF, "LUMINO GmbH", "LUMINO" },
-	{ 0x001BC5, 0x076000, 0x076FFF, "PLAiR Media, Inc", "PLAIR-MEDIA" },
-	{ 0x001BC5, 0x06C000, 0x06CFFF, "Luxcon System Limited", "LUXCON-SYSTEM" },
-	{ 0x001BC5, 0x05C000, 0x05CFFF, "Suretrak Global Pty Ltd", "SURETRAK-GLOBAL-PTY" },
-	{ 0x001BC5, 0x062000, 0x062FFF, "Sulaon Oy", "SULAON-OY" },
-	{ 0x001BC5, 0x052000, 0x052FFF, "Engineering Center ENERGOSERVICE", "ENGINEERING-CENTER-ENERGOSERVICE" },
-	{ 0x001BC5, 0x058000, 0x058FFF, "optiMEAS GmbH", "OPTIMEAS" },
-	{ 0x001BC5, 0x048000, 0x048FFF, "XPossible Technologies Pte Ltd", "XPOSSIBLE-TECHNOLOGIES-PTE" },
-	{ 0x001BC5, 0x04E000, 0x04EFFF, "Mitsubishi Electric India PVT. LTD", "MITSUBISHI-ELECTRIC-INDIA-PVT" },
-	{ 0x001BC5, 0x03E000, 0x03EFFF, "Daylight Solutions, Inc", "DAYLIGHT-SOLUTIONS" },
-	{ 0x001BC5, 0x044000, 0x044FFF, "ZAO &quot;RADIUS Avtomatika&quot;", "ZAO-QUOT-RADIUS-AVTOMATIKA-QUOT" },
-	{ 0x001BC5, 0x039000, 0x039FFF, "EURESYS S.A.", "EURESYS" },
-	{ 0x001BC5, 0x02F000, 0x02FFFF, "Fibrain Co. Ltd.", "FIBRAIN" },
-	{ 0x001BC5, 0x025000, 0x025FFF, "andersen lighting GmbH", "ANDERSEN-LIGHTING" },
-	{ 0x001BC5, 0x020000, 0x020FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
-	{ 0x001BC5, 0x01D000, 0x01DFFF, "Rose + Herleth GbR", "ROSE-+-HERLETH-GBR" },
-	{ 0x001BC5, 0x021000, 0x021FFF, "Openpeak, Inc", "OPENPEAK" },
-	{ 0x001BC5, 0x010000, 0x010FFF, "Softel SA de CV", "SOFTEL-DE-CV" },
-	{ 0x001BC5, 0x006000, 0x006FFF, "TRIAX-HIRSCHMANN Multi-Media GmbH", "TRIAX-HIRSCHMANN-MULTI-MEDIA" },
-	{ 0x001BC5, 0x01A000, 0x01AFFF, "ABA ELECTRONICS TECHNOLOGY CO.,LTD", "ABA-ELECTRONICS" },
-	{ 0x70B3D5, 0x76E000, 0x76EFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x8F3000, 0x8F3FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0xC7F000, 0xC7FFFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x5ED000, 0x5EDFFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
-	{ 0x70B3D5, 0xAEA000, 0xAEAFFF, "BBR Verkehrstechnik GmbH", "BBR-VERKEHRSTECHNIK" },
-	{ 0x70B3D5, 0xEEE000, 0xEEEFFF, "SOCIEDAD IBERICA DE CONSTRUCCIONES ELECTRICAS, S.A. (SICE)", "SOCIEDAD-IBERICA-DE-CONSTRUCCIONES-ELECTRICAS-SICE" },
-	{ 0x70B3D5, 0x794000, 0x794FFF, "Shadin Avionics", "SHADIN-AVIONICS" },
-	{ 0x70B3D5, 0x2EF000, 0x2EFFFF, "IEM SA", "IEM" },
-	{ 0x70B3D5, 0xB6D000, 0xB6DFFF, "Movis", "MOVIS" },
-	{ 0x70B3D5, 0x325000, 0x325FFF, "BlueMark Innovations BV", "BLUEMARK-INNOVATIONS" },
-	{ 0x70B3D5, 0x8B2000, 0x8B2FFF, "NPF Modem, LLC", "NPF-MODEM-LLC" },
-	{ 0x70B3D5, 0x3CC000, 0x3CCFFF, "TerOpta Ltd", "TEROPTA" },
-	{ 0x70B3D5, 0x5D1000, 0x5D1FFF, "Software Motor Corp", "SOFTWARE-MOTOR" },
-	{ 0x70B3D5, 0xA2E000, 0xA2EFFF, "Kokam Co., Ltd", "KOKAM" },
-	{ 0x70B3D5, 0x8A6000, 0x8A6FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xFB5000, 0xFB5FFF, "Orange Tree Technologies Ltd", "ORANGE-TREE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xE02000, 0xE02FFF, "YEHL & JORDAN LLC", "YEHL-JORDAN-LLC" },
-	{ 0x70B3D5, 0xF56000, 0xF56FFF, "VirtualHere Pty. Ltd.", "VIRTUALHERE-PTY" },
-	{ 0x70B3D5, 0x8BE000, 0x8BEFFF, "Connoiseur Electronics Private Limited", "CONNOISEUR-ELECTRONICS-PRIVATE" },
-	{ 0x70B3D5, 0x26B000, 0x26BFFF, "Sorama BV", "SORAMA" },
-	{ 0x70B3D5, 0x2FA000, 0x2FAFFF, "Toray　Medical　Co.,Ltd", "TORAY　MEDICAL　" },
-	{ 0x70B3D5, 0x975000, 0x975FFF, "Coester Automação Ltda", "COESTER-AUTOMAçãO-LTDA" },
-	{ 0x70B3D5, 0x13C000, 0x13CFFF, "Detec Systems Ltd", "DETEC" },
-	{ 0x70B3D5, 0x455000, 0x455FFF, "Heartlandmicropayments", "HEARTLANDMICROPAYMENTS" },
-	{ 0x70B3D5, 0x070000, 0x070FFF, "Lumiplan Duhamel", "LUMIPLAN-DUHAMEL" },
-	{ 0x70B3D5, 0x8D8000, 0x8D8FFF, "VNG Corporation", "VNG" },
-	{ 0x70B3D5, 0x392000, 0x392FFF, "Contec DTx", "CONTEC-DTX" },
-	{ 0x70B3D5, 0x14D000, 0x14DFFF, "2-Observe", "2-OBSERVE" },
-	{ 0x70B3D5, 0x9CB000, 0x9CBFFF, "Alligator Communications", "ALLIGATOR-COMMUNICATION" },
-	{ 0x70B3D5, 0xB67000, 0xB67FFF, "RedWave Labs Ltd", "REDWAVE-LABS" },
-	{ 0x70B3D5, 0xB93000, 0xB93FFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x70B3D5, 0xB89000, 0xB89FFF, "IDA", "IDA" },
-	{ 0x70B3D5, 0x7E2000, 0x7E2FFF, "Depro Électronique inc", "DEPRO-ÉLECTRONIQUE" },
-	{ 0x70B3D5, 0x772000, 0x772FFF, "enModus", "ENMODUS" },
-	{ 0x70B3D5, 0x3C5000, 0x3C5FFF, "P4Q ELECTRONICS, S.L.", "P4Q-ELECTRONICS-S-L" },
-	{ 0x70B3D5, 0xFE2000, 0xFE2FFF, "Galileo Tıp Teknolojileri San. ve Tic. A.S.", "GALILEO-TıP-TEKNOLOJILERI-SAN-VE-TIC-A-S" },
-	{ 0x70B3D5, 0xC24000, 0xC24FFF, "Elbit Systems of America - Fort Worth Operations", "ELBIT-OF-AMERICA---FORT-WORTH-OPERATIONS" },
-	{ 0x70B3D5, 0xAC6000, 0xAC6FFF, "SMTC Corporation", "SMTC" },
+	{ 0x70B3D5, 0x01A000, 0x01AFFF, "Cubro Acronet GesmbH", "CUBRO-ACRONET-GESMBH" },
+	{ 0x70B3D5, 0x01B000, 0x01BFFF, "AUDI AG", "AUDI" },
+	{ 0x70B3D5, 0x01C000, 0x01CFFF, "Kumu Networks", "KUMU-NETWORKS" },
+	{ 0x70B3D5, 0x01D000, 0x01DFFF, "Weigl Elektronik & Mediaprojekte", "WEIGL-ELEKTRONIK-MEDIAPROJEKTE" },
+	{ 0x70B3D5, 0x01E000, 0x01EFFF, "ePOINT Embedded Computing Limited", "EPOINT-EMBEDDED-COMPUTING" },
+	{ 0x70B3D5, 0x01F000, 0x01FFFF, "SPX Flow Technology BV", "SPX-FLOW" },
+	{ 0x70B3D5, 0x022000, 0x022FFF, "Ravelin Ltd", "RAVELIN" },
+	{ 0x70B3D5, 0x023000, 0x023FFF, "Cambridge Pixel", "CAMBRIDGE-PIXEL" },
+	{ 0x70B3D5, 0x024000, 0x024FFF, "G+D Mobile Security", "G+D-MOBILE-SECURITY" },
+	{ 0x70B3D5, 0x025000, 0x025FFF, "Elsuhd Net Ltd Co.", "ELSUHD-NET" },
+	{ 0x70B3D5, 0x026000, 0x026FFF, "Telstra", "TELSTRA" },
+	{ 0x70B3D5, 0x027000, 0x027FFF, "Redcap Solutions s.r.o.", "REDCAP-SOLUTIONS-S-R-O" },
 	{ 0x70B3D5, 0x028000, 0x028FFF, "AT-Automation Technology GmbH", "AT-AUTOMATION" },
+	{ 0x70B3D5, 0x029000, 0x029FFF, "Marimo electronics Co.,Ltd.", "MARIMO-ELECTRONICS" },
+	{ 0x70B3D5, 0x02A000, 0x02AFFF, "BAE Systems Surface Ships Limited", "BAE-SURFACE-SHIPS" },
+	{ 0x70B3D5, 0x02D000, 0x02DFFF, "NEXTtec srl", "NEXTTEC-SRL" },
+	{ 0x70B3D5, 0x02E000, 0x02EFFF, "Monnit Corporation", "MONNIT" },
+	{ 0x70B3D5, 0x02F000, 0x02FFFF, "LEGENDAIRE TECHNOLOGY CO., LTD.", "LEGENDAIRE" },
+	{ 0x70B3D5, 0x030000, 0x030FFF, "Tresent Technologies", "TRESENT-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x031000, 0x031FFF, "SHENZHEN GAONA ELECTRONIC CO.LTD", "SHENZHEN-GAONA" },
+	{ 0x70B3D5, 0x032000, 0x032FFF, "iFreecomm Technology Co., Ltd", "IFREECOMM" },
+	{ 0x70B3D5, 0x033000, 0x033FFF, "Sailmon BV", "SAILMON" },
+	{ 0x70B3D5, 0x035000, 0x035FFF, "HKW-Elektronik GmbH", "HKW-ELEKTRONIK" },
+	{ 0x70B3D5, 0x037000, 0x037FFF, "EIFFAGE ENERGIE ELECTRONIQUE", "EIFFAGE-ENERGIE-ELECTRONIQUE" },
+	{ 0x70B3D5, 0x039000, 0x039FFF, "DoWoo Digitech", "DOWOO-DIGITECH" },
+	{ 0x70B3D5, 0x03B000, 0x03BFFF, "SSL - Electrical Aerospace Ground Equipment Section", "SSL---ELECTRICAL-AEROSPACE-GROUND-EQUIPMENT-SECTION" },
+	{ 0x70B3D5, 0x03C000, 0x03CFFF, "Ultimate Software", "ULTIMATE-SOFTWARE" },
+	{ 0x70B3D5, 0x03D000, 0x03DFFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
+	{ 0x70B3D5, 0x03F000, 0x03FFFF, "Elesar Limited", "ELESAR" },
+	{ 0x70B3D5, 0x040000, 0x040FFF, "Savari Inc", "SAVARI" },
+	{ 0x70B3D5, 0x041000, 0x041FFF, "FIBERNET LTD", "FIBERNET" },
+	{ 0x70B3D5, 0x042000, 0x042FFF, "Coveloz Technologies Inc.", "COVELOZ-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x044000, 0x044FFF, "Don Electronics Ltd", "DON-ELECTRONICS" },
+	{ 0x70B3D5, 0x046000, 0x046FFF, "Shenzhen Rihuida Electronics Co,. Ltd", "SHENZHEN-RIHUIDA-ELECTRONICS" },
+	{ 0x70B3D5, 0x048000, 0x048FFF, "AvMap srlu", "AVMAP-SRLU" },
+	{ 0x70B3D5, 0x049000, 0x049FFF, "APP Engineering, Inc.", "APP-ENGINEERING" },
+	{ 0x70B3D5, 0x04A000, 0x04AFFF, "Gecko Robotics Inc", "GECKO-ROBOTICS" },
+	{ 0x70B3D5, 0x04B000, 0x04BFFF, "Dream I System Co., Ltd", "DREAM-I-SYSTEM" },
+	{ 0x70B3D5, 0x04C000, 0x04CFFF, "mapna group", "MAPNA-GROUP" },
+	{ 0x70B3D5, 0x04D000, 0x04DFFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x04E000, 0x04EFFF, "HUGEL GmbH", "HUGEL" },
+	{ 0x70B3D5, 0x050000, 0x050FFF, "Compusign Systems Pty Ltd", "COMPUSIGN-PTY" },
+	{ 0x70B3D5, 0x052000, 0x052FFF, "Sudo Premium Engineering", "SUDO-PREMIUM-ENGINEERING" },
+	{ 0x70B3D5, 0x054000, 0x054FFF, "Groupeer Technologies", "GROUPEER-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x058000, 0x058FFF, "Telink Semiconductor CO, Limtied, Taiwan", "TELINK-SEMICONDUCTOR-LIMTIED-TAIWAN" },
+	{ 0x70B3D5, 0x059000, 0x059FFF, "Pro-Digital Projetos Eletronicos Ltda", "PRO-DIGITAL-PROJETOS-ELETRONICOS-LTDA" },
+	{ 0x70B3D5, 0x05A000, 0x05AFFF, "Uni Control System Sp. z o. o.", "UNI-CONTROL-SYSTEM-SP-Z-O-O" },
+	{ 0x70B3D5, 0x05C000, 0x05CFFF, "Amber Kinetics Inc", "AMBER-KINETICS" },
+	{ 0x70B3D5, 0x05D000, 0x05DFFF, "KOMS Co.,Ltd.", "KOMS" },
+	{ 0x70B3D5, 0x05E000, 0x05EFFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0x05F000, 0x05FFFF, "UNISOR MULTISYSTEMS LTD", "UNISOR-MULTISYSTEMS" },
+	{ 0x70B3D5, 0x061000, 0x061FFF, "IntelliDesign Pty Ltd", "INTELLIDESIGN-PTY" },
+	{ 0x70B3D5, 0x062000, 0x062FFF, "RM Michaelides Software & Elektronik GmbH", "RM-MICHAELIDES-SOFTWARE-ELEKTRONIK" },
+	{ 0x70B3D5, 0x063000, 0x063FFF, "PoolDigital GmbH & Co. KG", "POOLDIGITAL" },
+	{ 0x70B3D5, 0x066000, 0x066FFF, "North Pole Engineering, Inc.", "NORTH-POLE-ENGINEERING" },
+	{ 0x70B3D5, 0x069000, 0x069FFF, "ONDEMAND LABORATORY Co., Ltd.", "ONDEMAND-LABORATORY" },
+	{ 0x70B3D5, 0x06B000, 0x06BFFF, "U-Tech", "U-TECH" },
+	{ 0x70B3D5, 0x06C000, 0x06CFFF, "AppTek", "APPTEK" },
+	{ 0x70B3D5, 0x06F000, 0x06FFFF, "Beijing Daswell Science and Technology Co.LTD", "BEIJING-DASWELL-SCIENCE-AND" },
+	{ 0x70B3D5, 0x070000, 0x070FFF, "Lumiplan Duhamel", "LUMIPLAN-DUHAMEL" },
+	{ 0x70B3D5, 0x072000, 0x072FFF, "Lightdrop", "LIGHTDROP" },
+	{ 0x70B3D5, 0x073000, 0x073FFF, "Liteon Technology Corporation", "LITEON" },
+	{ 0x70B3D5, 0x075000, 0x075FFF, "Mo-Sys Engineering Ltd", "MO-SYS-ENGINEERING" },
+	{ 0x70B3D5, 0x077000, 0x077FFF, "InAccess Networks SA", "INACCESS-NETWORKS" },
+	{ 0x70B3D5, 0x078000, 0x078FFF, "OrbiWise SA", "ORBIWISE" },
+	{ 0x70B3D5, 0x079000, 0x079FFF, "CheckBill Co,Ltd.", "CHECKBILL" },
+	{ 0x70B3D5, 0x07A000, 0x07AFFF, "ZAO ZEO", "ZAO-ZEO" },
+	{ 0x70B3D5, 0x07B000, 0x07BFFF, "wallbe GmbH", "WALLBE" },
+	{ 0x70B3D5, 0x07D000, 0x07DFFF, "PANORAMIC POWER", "PANORAMIC-POWER" },
+	{ 0x70B3D5, 0x07E000, 0x07EFFF, "ENTEC Electric & Electronic CO., LTD", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0x07F000, 0x07FFFF, "Abalance Corporation", "ABALANCE" },
+	{ 0x70B3D5, 0x081000, 0x081FFF, "IST Technologies (SHENZHEN) Limited", "IST-TECHNOLOGIES-SHENZHEN" },
+	{ 0x70B3D5, 0x083000, 0x083FFF, "ZAO ZEO", "ZAO-ZEO" },
+	{ 0x70B3D5, 0x084000, 0x084FFF, "Rako Controls Ltd", "RAKO-CONTROLS" },
+	{ 0x70B3D5, 0x085000, 0x085FFF, "Human Systems Integration", "HUMAN-INTEGRATION" },
+	{ 0x70B3D5, 0x086000, 0x086FFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
+	{ 0x70B3D5, 0x087000, 0x087FFF, "Tempus Fugit Consoles bvba", "TEMPUS-FUGIT-CONSOLES-BVBA" },
+	{ 0x70B3D5, 0x088000, 0x088FFF, "OptiScan Biomedical Corp.", "OPTISCAN-BIOMEDICAL" },
+	{ 0x70B3D5, 0x08A000, 0x08AFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x08B000, 0x08BFFF, "Peter Huber Kaeltemaschinenbau AG", "PETER-HUBER-KAELTEMASCHINENBAU" },
+	{ 0x70B3D5, 0x08C000, 0x08CFFF, "Airmar Technology Corp", "AIRMAR" },
+	{ 0x70B3D5, 0x08D000, 0x08DFFF, "Clover Electronics Technology Co., Ltd.", "CLOVER-ELECTRONICS" },
+	{ 0x70B3D5, 0x08E000, 0x08EFFF, "Beijing CONvision Technology Co.,Ltd", "BEIJING-CONVISION" },
+	{ 0x70B3D5, 0x08F000, 0x08FFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x090000, 0x090FFF, "POWERCRAFT ELECTRONICS PVT. LTD.", "POWERCRAFT-ELECTRONICS-PVT" },
+	{ 0x70B3D5, 0x091000, 0x091FFF, "PROFITT Ltd", "PROFITT" },
+	{ 0x70B3D5, 0x092000, 0x092FFF, "inomed Medizintechnik GmbH", "INOMED-MEDIZINTECHNIK" },
+	{ 0x70B3D5, 0x094000, 0x094FFF, "Circuitlink Pty Ltd", "CIRCUITLINK-PTY" },
+	{ 0x70B3D5, 0x096000, 0x096FFF, "HAVELSAN A.Ş.", "HAVELSAN-A-Ş" },
+	{ 0x70B3D5, 0x097000, 0x097FFF, "Avant Technologies", "AVANT-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x098000, 0x098FFF, "Alcodex Technologies Private Limited", "ALCODEX-TECHNOLOGIES-PRIVATE" },
+	{ 0x70B3D5, 0x099000, 0x099FFF, "Schwer+Kopka GmbH", "SCHWER+KOPKA" },
+	{ 0x70B3D5, 0x09A000, 0x09AFFF, "Akse srl", "AKSE-SRL" },
+	{ 0x70B3D5, 0x09B000, 0x09BFFF, "Jacarta Ltd", "JACARTA" },
+	{ 0x70B3D5, 0x09D000, 0x09DFFF, "P&S GmbH", "P-S" },
+	{ 0x70B3D5, 0x09E000, 0x09EFFF, "MobiPromo", "MOBIPROMO" },
+	{ 0x70B3D5, 0x09F000, 0x09FFFF, "COMTECH Kft.", "COMTECH-KFT" },
+	{ 0x70B3D5, 0x0A0000, 0x0A0FFF, "Cominfo, Inc.", "COMINFO" },
+	{ 0x70B3D5, 0x0A1000, 0x0A1FFF, "PTN Electronics Limited", "PTN-ELECTRONICS" },
+	{ 0x70B3D5, 0x0A2000, 0x0A2FFF, "TechSigno srl", "TECHSIGNO-SRL" },
+	{ 0x70B3D5, 0x0A3000, 0x0A3FFF, "Solace Systems Inc.", "SOLACE" },
+	{ 0x70B3D5, 0x0A4000, 0x0A4FFF, "Communication Technology Ltd.", "COMMUNICATION" },
+	{ 0x70B3D5, 0x0A5000, 0x0A5FFF, "FUELCELLPOWER", "FUELCELLPOWER" },
+	{ 0x70B3D5, 0x0A6000, 0x0A6FFF, "PA CONSULTING SERVICES", "PA-CONSULTING-SERVICES" },
+	{ 0x70B3D5, 0x0A8000, 0x0A8FFF, "Symetrics Industries d.b.a. Extant Aerospace", "SYMETRICS-INDUSTRIES-D-B-A-EXTANT-AEROSPACE" },
+	{ 0x70B3D5, 0x0A9000, 0x0A9FFF, "ProConnections, Inc.", "PROCONNECTIONS" },
+	{ 0x70B3D5, 0x0AA000, 0x0AAFFF, "Wanco Inc", "WANCO" },
+	{ 0x70B3D5, 0x0AB000, 0x0ABFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x0AC000, 0x0ACFFF, "RoboCore Tecnologia", "ROBOCORE-TECNOLOGIA" },
+	{ 0x70B3D5, 0x0AE000, 0x0AEFFF, "Norsat International Inc.", "NORSAT" },
+	{ 0x70B3D5, 0x0AF000, 0x0AFFFF, "KMtronic ltd", "KMTRONIC" },
+	{ 0x70B3D5, 0x0B0000, 0x0B0FFF, "Raven Systems Design, Inc", "RAVEN-DESIGN" },
+	{ 0x70B3D5, 0x0B2000, 0x0B2FFF, "ndb technologies", "NDB-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x0B3000, 0x0B3FFF, "Reonix Automation", "REONIX-AUTOMATION" },
+	{ 0x70B3D5, 0x0B4000, 0x0B4FFF, "AVER", "AVER" },
+	{ 0x70B3D5, 0x0B5000, 0x0B5FFF, "Capgemini Netherlands", "CAPGEMINI-NETHERLANDS" },
+	{ 0x70B3D5, 0x0B6000, 0x0B6FFF, "Landis Gyr", "LANDIS-GYR" },
+	{ 0x70B3D5, 0x0B8000, 0x0B8FFF, "Lucas-Nülle GmbH", "LUCAS-NUELLE" },
 	{ 0x70B3D5, 0x0B9000, 0x0B9FFF, "Easy Digital Concept", "EASY-DIGITAL-CONCEPT" },
-	{ 0x70B3D5, 0xCF2000, 0xCF2FFF, "tinnos", "TINNOS" },
-	{ 0x70B3D5, 0x9E0000, 0x9E0FFF, "ES Industrial Systems Co., Ltd.", "ES-INDUSTRIAL" },
-	{ 0x70B3D5, 0x60F000, 0x60FFFF, "Tanaka Information System, LLC.", "TANAKA-INFORMATION-SYSTEM-LLC" },
-	{ 0x70B3D5, 0x0FA000, 0x0FAFFF, "InsideRF Co., Ltd.", "INSIDERF" },
-	{ 0x70B3D5, 0x31E000, 0x31EFFF, "GILLAM-FEI S.A.", "GILLAM-FEI" },
-	{ 0x70B3D5, 0x8C5000, 0x8C5FFF, "HMicro Inc", "HMICRO" },
-	{ 0x70B3D5, 0x5FF000, 0x5FFFFF, "Vaisala Oyj", "VAISALA-OYJ" },
-	{ 0x70B3D5, 0x8EF000, 0x8EFFFF, "Beeper Communications Ltd.", "BEEPER-COMMUNICATION" },
-	{ 0x70B3D5, 0x277000, 0x277FFF, "Voltaware Limited", "VOLTAWARE" },
-	{ 0x70B3D5, 0x179000, 0x179FFF, "ALTRAN UK", "ALTRAN-UK" },
-	{ 0x70B3D5, 0x74F000, 0x74FFFF, "United States Technologies Inc.", "UNITED-STATES-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x804000, 0x804FFF, "PMT Corporation", "PMT" },
-	{ 0x70B3D5, 0xD2B000, 0xD2BFFF, "StreamPlay Oy Ltd", "STREAMPLAY-OY" },
-	{ 0x70B3D5, 0x39C000, 0x39CFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x70B3D5, 0x840000, 0x840FFF, "xm", "XM" },
-	{ 0x70B3D5, 0x4FE000, 0x4FEFFF, "WiTagg, Inc", "WITAGG" },
-	{ 0x70B3D5, 0x1FD000, 0x1FDFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
-	{ 0x70B3D5, 0x396000, 0x396FFF, "CTG sp. z o. o.", "CTG-SP-Z-O-O" },
-	{ 0x70B3D5, 0x62B000, 0x62BFFF, "Silicann Systems GmbH", "SILICANN" },
-	{ 0x70B3D5, 0x6B5000, 0x6B5FFF, "ART SPA", "ART-SPA" },
-	{ 0x70B3D5, 0xE7C000, 0xE7CFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x3D9000, 0x3D9FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x35F000, 0x35FFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x33E000, 0x33EFFF, "Dynamic Connect (Suzhou) Hi-Tech Electronic Co.,Ltd.", "DYNAMIC-CONNECT-SUZHOU-HI-TECH" },
-	{ 0x70B3D5, 0x180000, 0x180FFF, "LHA Systems (Pty) Ltd", "LHA-PTY" },
-	{ 0x70B3D5, 0xABE000, 0xABEFFF, "MART NETWORK SOLUTIONS LTD", "MART-NETWORK-SOLUTIONS" },
-	{ 0x70B3D5, 0x932000, 0x932FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0x0BA000, 0x0BAFFF, "Ayre Acoustics, Inc.", "AYRE-ACOUSTICS" },
+	{ 0x70B3D5, 0x0BC000, 0x0BCFFF, "Practical Software Studio LLC", "PRACTICAL-SOFTWARE-STUDIO-LLC" },
+	{ 0x70B3D5, 0x0BD000, 0x0BDFFF, "Andium", "ANDIUM" },
+	{ 0x70B3D5, 0x0BE000, 0x0BEFFF, "ChamSys Ltd", "CHAMSYS" },
+	{ 0x70B3D5, 0x0BF000, 0x0BFFFF, "Den Automation", "DEN-AUTOMATION" },
+	{ 0x70B3D5, 0x0C0000, 0x0C0FFF, "Molu Technology Inc., LTD.", "MOLU" },
+	{ 0x70B3D5, 0x0C1000, 0x0C1FFF, "Nexus Technologies Pty Ltd", "NEXUS-TECHNOLOGIES-PTY" },
+	{ 0x70B3D5, 0x0C2000, 0x0C2FFF, "LOOK EASY INTERNATIONAL LIMITED", "LOOK-EASY" },
 	{ 0x70B3D5, 0x0C4000, 0x0C4FFF, "TIAMA", "TIAMA" },
-	{ 0x70B3D5, 0x8CF000, 0x8CFFFF, "Dainichi Denshi　Co.,LTD", "DAINICHI-DENSHI　" },
-	{ 0x70B3D5, 0x750000, 0x750FFF, "Neurio Technology Inc.", "NEURIO" },
-	{ 0x70B3D5, 0xFC9000, 0xFC9FFF, "Shanghai EICT Global Service Co., Ltd", "SHANGHAI-EICT-GLOBAL-SERVICE" },
-	{ 0x70B3D5, 0x147000, 0x147FFF, "ROMO Wind A/S", "ROMO-WIND-A/S" },
-	{ 0x70B3D5, 0x75B000, 0x75BFFF, "Netool LLC", "NETOOL-LLC" },
-	{ 0x70B3D5, 0x78C000, 0x78CFFF, "Survalent Technology Corporation", "SURVALENT" },
-	{ 0x70B3D5, 0x37D000, 0x37DFFF, "The DX Shop Limited", "THE-DX-SHOP" },
-	{ 0x70B3D5, 0x696000, 0x696FFF, "Open Grow", "OPEN-GROW" },
-	{ 0x70B3D5, 0xFCA000, 0xFCAFFF, "M2M Cybernetics Pvt Ltd", "M2M-CYBERNETICS-PVT" },
-	{ 0x70B3D5, 0x02D000, 0x02DFFF, "NEXTtec srl", "NEXTTEC-SRL" },
-	{ 0x70B3D5, 0x3D5000, 0x3D5FFF, "oxynet Solutions", "OXYNET-SOLUTIONS" },
-	{ 0x70B3D5, 0xD11000, 0xD11FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
-	{ 0x70B3D5, 0x1B5000, 0x1B5FFF, "StarBridge, Inc.", "STARBRIDGE" },
-	{ 0x70B3D5, 0x5CD000, 0x5CDFFF, "MVT Video Technologies R + H Maedler GbR", "MVT-VIDEO-TECHNOLOGIES-R-+-H-MAEDLER-GBR" },
-	{ 0x70B3D5, 0xAF7000, 0xAF7FFF, "DimoSystems BV", "DIMOSYSTEMS" },
-	{ 0x70B3D5, 0x9D2000, 0x9D2FFF, "ACS MOTION CONTROL", "ACS-MOTION-CONTROL" },
-	{ 0x70B3D5, 0xA5E000, 0xA5EFFF, "ConectaIP Tecnologia S.L.", "CONECTAIP-TECNOLOGIA-S-L" },
+	{ 0x70B3D5, 0x0C5000, 0x0C5FFF, "Precitec Optronik GmbH", "PRECITEC-OPTRONIK" },
+	{ 0x70B3D5, 0x0C6000, 0x0C6FFF, "Embedded Arts Co., Ltd.", "EMBEDDED-ARTS" },
+	{ 0x70B3D5, 0x0C8000, 0x0C8FFF, "Fin Robotics Inc", "FIN-ROBOTICS" },
+	{ 0x70B3D5, 0x0C9000, 0x0C9FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
+	{ 0x70B3D5, 0x0CD000, 0x0CDFFF, "AML Oceanographic", "AML-OCEANOGRAPHIC" },
+	{ 0x70B3D5, 0x0CE000, 0x0CEFFF, "Innominds Software Inc", "INNOMINDS-SOFTWARE" },
+	{ 0x70B3D5, 0x0CF000, 0x0CFFFF, "sohonet ltd", "SOHONET" },
+	{ 0x70B3D5, 0x0D1000, 0x0D1FFF, "Common Sense Monitoring Solutions Ltd.", "COMMON-SENSE-MONITORING-SOLUTIONS" },
+	{ 0x70B3D5, 0x0D2000, 0x0D2FFF, "UNMANNED SPA", "UNMANNED-SPA" },
+	{ 0x70B3D5, 0x0D3000, 0x0D3FFF, "TSAT AS", "TSAT-AS" },
+	{ 0x70B3D5, 0x0D4000, 0x0D4FFF, "Guangzhou Male Industrial Animation Technology Co.,Ltd.", "GUANGZHOU-MALE-INDUSTRIAL-ANIMATION" },
+	{ 0x70B3D5, 0x0D6000, 0x0D6FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x0D7000, 0x0D7FFF, "Russian Telecom Equipment Company", "RUSSIAN-TELECOM-EQUIPMENT-COMPANY" },
+	{ 0x70B3D5, 0x0D8000, 0x0D8FFF, "Laser Imagineering GmbH", "LASER-IMAGINEERING" },
+	{ 0x70B3D5, 0x0D9000, 0x0D9FFF, "Brechbuehler AG", "BRECHBUEHLER" },
+	{ 0x70B3D5, 0x0DA000, 0x0DAFFF, "Aquavision Distribution Ltd", "AQUAVISION-DISTRIBUTION" },
+	{ 0x70B3D5, 0x0DC000, 0x0DCFFF, "Talleres de Escoriaza", "TALLERES-DE-ESCORIAZA" },
+	{ 0x70B3D5, 0x0DE000, 0x0DEFFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x0DF000, 0x0DFFFF, "B.E.A. sa", "B-E-A" },
+	{ 0x70B3D5, 0x0E0000, 0x0E0FFF, "PLCiS", "PLCIS" },
+	{ 0x70B3D5, 0x0E1000, 0x0E1FFF, "MiWave Consulting, LLC", "MIWAVE-CONSULTING-LLC" },
+	{ 0x70B3D5, 0x0E3000, 0x0E3FFF, "SinTau SrL", "SINTAU-SRL" },
+	{ 0x70B3D5, 0x0E5000, 0x0E5FFF, "Delta Solutions LLC", "DELTA-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0x0E6000, 0x0E6FFF, "Nasdaq", "NASDAQ" },
+	{ 0x70B3D5, 0x0E8000, 0x0E8FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x0E9000, 0x0E9FFF, "VNT electronics s.r.o.", "VNT-ELECTRONICS-S-R-O" },
+	{ 0x70B3D5, 0x0EA000, 0x0EAFFF, "AEV Broadcast Srl", "AEV-BROADCAST-SRL" },
+	{ 0x70B3D5, 0x0EC000, 0x0ECFFF, "ACS MOTION CONTROL", "ACS-MOTION-CONTROL" },
+	{ 0x70B3D5, 0x0EE000, 0x0EEFFF, "Picture Elements, Inc.", "PICTURE-ELEMENTS" },
+	{ 0x70B3D5, 0x0EF000, 0x0EFFFF, "Dextera Labs", "DEXTERA-LABS" },
+	{ 0x70B3D5, 0x0F0000, 0x0F0FFF, "Avionica", "AVIONICA" },
+	{ 0x70B3D5, 0x0F1000, 0x0F1FFF, "Beijing One City Science & Technology Co., LTD", "BEIJING-ONE-CITY-SCIENCE" },
+	{ 0x70B3D5, 0x0F3000, 0x0F3FFF, "MonsoonRF, Inc.", "MONSOONRF" },
+	{ 0x70B3D5, 0x0F7000, 0x0F7FFF, "Bespoon", "BESPOON" },
+	{ 0x70B3D5, 0x0F8000, 0x0F8FFF, "Special Services Group, LLC", "SPECIAL-SERVICES-GROUP-LLC" },
+	{ 0x70B3D5, 0x0FA000, 0x0FAFFF, "InsideRF Co., Ltd.", "INSIDERF" },
+	{ 0x70B3D5, 0x0FB000, 0x0FBFFF, "Cygnus LLC", "CYGNUS-LLC" },
+	{ 0x70B3D5, 0x0FC000, 0x0FCFFF, "vitalcare", "VITALCARE" },
+	{ 0x70B3D5, 0x0FE000, 0x0FEFFF, "Vocality International Ltd", "VOCALITY" },
+	{ 0x70B3D5, 0x0FF000, 0x0FFFFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
+	{ 0x70B3D5, 0x100000, 0x100FFF, "Gupsy GmbH", "GUPSY" },
+	{ 0x70B3D5, 0x103000, 0x103FFF, "HANYOUNG NUX CO.,LTD", "HANYOUNG-NUX" },
+	{ 0x70B3D5, 0x104000, 0x104FFF, "Plum sp. z o.o", "PLUM-SP-Z-O-O" },
+	{ 0x70B3D5, 0x105000, 0x105FFF, "Beijing Nacao Technology Co., Ltd.", "BEIJING-NACAO" },
+	{ 0x70B3D5, 0x106000, 0x106FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x108000, 0x108FFF, "TEX COMPUTER SRL", "TEX-SRL" },
+	{ 0x70B3D5, 0x109000, 0x109FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
+	{ 0x70B3D5, 0x10A000, 0x10AFFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
+	{ 0x70B3D5, 0x10C000, 0x10CFFF, "Vocality International Ltd", "VOCALITY" },
+	{ 0x70B3D5, 0x10E000, 0x10EFFF, "Colorimetry Research, Inc", "COLORIMETRY-RESEARCH" },
+	{ 0x70B3D5, 0x10F000, 0x10FFFF, "neQis", "NEQIS" },
+	{ 0x70B3D5, 0x112000, 0x112FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
+	{ 0x70B3D5, 0x114000, 0x114FFF, "Project H Pty Ltd", "PROJECT-H-PTY" },
+	{ 0x70B3D5, 0x115000, 0x115FFF, "Welltec Corp.", "WELLTEC" },
+	{ 0x70B3D5, 0x119000, 0x119FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x11B000, 0x11BFFF, "HoseoTelnet Inc...", "HOSEOTELNET" },
+	{ 0x70B3D5, 0x11C000, 0x11CFFF, "Samriddi Automations Pvt. Ltd.", "SAMRIDDI-AUTOMATIONS-PVT" },
+	{ 0x70B3D5, 0x11D000, 0x11DFFF, "Dakton Microlabs LLC", "DAKTON-MICROLABS-LLC" },
+	{ 0x70B3D5, 0x11F000, 0x11FFFF, "Geppetto Electronics", "GEPPETTO-ELECTRONICS" },
+	{ 0x70B3D5, 0x120000, 0x120FFF, "GSP Sprachtechnologie GmbH", "GSP-SPRACHTECHNOLOGIE" },
+	{ 0x70B3D5, 0x122000, 0x122FFF, "Henri Systems Holland bv", "HENRI-HOLLAND" },
+	{ 0x70B3D5, 0x123000, 0x123FFF, "Amfitech ApS", "AMFITECH-APS" },
+	{ 0x70B3D5, 0x124000, 0x124FFF, "Forschungs- und Transferzentrum Leipzig e.V.", "FORSCHUNGS--UND-TRANSFERZENTRUM-LEIPZIG-E-V" },
+	{ 0x70B3D5, 0x125000, 0x125FFF, "Securolytics, Inc.", "SECUROLYTICS" },
+	{ 0x70B3D5, 0x127000, 0x127FFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0x129000, 0x129FFF, "OOO Microlink-Svyaz", "OOO-MICROLINK-SVYAZ" },
+	{ 0x70B3D5, 0x12B000, 0x12BFFF, "RIC Electronics", "RIC-ELECTRONICS" },
 	{ 0x70B3D5, 0x12C000, 0x12CFFF, "CIELLE S.R.L.", "CIELLE-S-R-L" },
-	{ 0x70B3D5, 0x486000, 0x486FFF, "ChongQing JianTao Technology Co., Ltd.", "CHONGQING-JIANTAO" },
 	{ 0x70B3D5, 0x12E000, 0x12EFFF, "GreenFlux", "GREENFLUX" },
-	{ 0x70B3D5, 0xB59000, 0xB59FFF, "FutureTechnologyLaboratories INC.", "FUTURETECHNOLOGYLABORATORIES" },
-	{ 0x70B3D5, 0x8B3000, 0x8B3FFF, "Firefly RFID Solutions", "FIREFLY-RFID-SOLUTIONS" },
-	{ 0x70B3D5, 0x599000, 0x599FFF, "LECO Corporation", "LECO" },
-	{ 0x70B3D5, 0x692000, 0x692FFF, "HOSIN INDUSTRIAL LIMITED", "HOSIN-INDUSTRIAL" },
-	{ 0x70B3D5, 0x896000, 0x896FFF, "Shanghai Longpal Communication Equipment Co., Ltd.", "SHANGHAI-LONGPAL-COMMUNICATION-EQUIPMENT" },
-	{ 0x70B3D5, 0xAE7000, 0xAE7FFF, "E-T-A Elektrotechnische Apparate GmbH", "E-T-A-ELEKTROTECHNISCHE-APPARATE" },
 	{ 0x70B3D5, 0x12F000, 0x12FFFF, "DSP4YOU LTd", "DSP4YOU" },
-	{ 0x70B3D5, 0x71B000, 0x71BFFF, "elsys", "ELSYS" },
-	{ 0x70B3D5, 0x9B1000, 0x9B1FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xCA4000, 0xCA4FFF, "Netemera Sp. z o.o.", "NETEMERA-SP-Z-O-O" },
-	{ 0x70B3D5, 0x48F000, 0x48FFFF, "Seiwa Giken", "SEIWA-GIKEN" },
-	{ 0x70B3D5, 0xDDC000, 0xDDCFFF, "Syscom Instruments SA", "SYSCOM-INSTRUMENTS" },
-	{ 0x70B3D5, 0xC15000, 0xC15FFF, "Sensobox GmbH", "SENSOBOX" },
-	{ 0x70B3D5, 0xD2F000, 0xD2FFFF, "L.I.F.E. Corporation SA", "L-I-F-E" },
-	{ 0x70B3D5, 0x36A000, 0x36AFFF, "Becton Dickinson", "BECTON-DICKINSON" },
-	{ 0x70B3D5, 0xC80000, 0xC80FFF, "Link Care Services", "LINK-CARE-SERVICES" },
-	{ 0x70B3D5, 0x607000, 0x607FFF, "ATEME", "ATEME" },
-	{ 0x70B3D5, 0xA33000, 0xA33FFF, "TIAMA", "TIAMA" },
-	{ 0x70B3D5, 0xA19000, 0xA19FFF, "Qualitronix Madrass Pvt Ltd", "QUALITRONIX-MADRASS-PVT" },
-	{ 0x70B3D5, 0xF81000, 0xF81FFF, "Littlemore Scientific", "LITTLEMORE-SCIENTIFIC" },
-	{ 0x70B3D5, 0xB3F000, 0xB3FFFF, "Orbit International", "ORBIT" },
-	{ 0x70B3D5, 0x28D000, 0x28DFFF, "Technica Engineering GmbH", "TECHNICA-ENGINEERING" },
-	{ 0x70B3D5, 0xB62000, 0xB62FFF, "Sakura Seiki Co.,Ltd.", "SAKURA-SEIKI" },
-	{ 0x70B3D5, 0xCCF000, 0xCCFFFF, "Netberg", "NETBERG" },
 	{ 0x70B3D5, 0x131000, 0x131FFF, "Inova Design Solutions Ltd", "INOVA-DESIGN-SOLUTIONS" },
-	{ 0x70B3D5, 0x987000, 0x987FFF, "AXIS CORPORATION", "AXIS" },
-	{ 0x70B3D5, 0x2BA000, 0x2BAFFF, "Active Brains", "ACTIVE-BRAINS" },
-	{ 0x70B3D5, 0x0CE000, 0x0CEFFF, "Innominds Software Inc", "INNOMINDS-SOFTWARE" },
-	{ 0x70B3D5, 0x644000, 0x644FFF, "ATX Networks Corp", "ATX-NETWORKS" },
-	{ 0x70B3D5, 0x52C000, 0x52CFFF, "Centuryarks Ltd.,", "CENTURYARKS" },
-	{ 0x70B3D5, 0xBC2000, 0xBC2FFF, "DWEWOONG ELECTRIC Co., Ltd.", "DWEWOONG-ELECTRIC" },
-	{ 0x70B3D5, 0xDFC000, 0xDFCFFF, "ELECTRONIC SYSTEMS DESIGN SPRL", "DESIGN-SPRL" },
-	{ 0x70B3D5, 0x7E5000, 0x7E5FFF, "Megaflex Oy", "MEGAFLEX-OY" },
-	{ 0x70B3D5, 0x503000, 0x503FFF, "Itest communication Tech Co., LTD", "ITEST-COMMUNICATION-TECH" },
-	{ 0x70B3D5, 0x48A000, 0x48AFFF, "George Wilson Industries Ltd", "GEORGE-WILSON-INDUSTRIES" },
-	{ 0x70B3D5, 0x0E5000, 0x0E5FFF, "Delta Solutions LLC", "DELTA-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0x81E000, 0x81EFFF, "Novathings", "NOVATHINGS" },
-	{ 0x70B3D5, 0x04B000, 0x04BFFF, "Dream I System Co., Ltd", "DREAM-I-SYSTEM" },
-	{ 0x70B3D5, 0x49A000, 0x49AFFF, "HAXE SYSTEME", "HAXE-SYSTEME" },
-	{ 0x70B3D5, 0x63C000, 0x63CFFF, "Pivothead", "PIVOTHEAD" },
-	{ 0x70B3D5, 0xADB000, 0xADBFFF, "RF Code", "RF-CODE" },
-	{ 0x70B3D5, 0xB53000, 0xB53FFF, "Revolution Retail Systems, LLC", "REVOLUTION-RETAIL-LLC" },
-	{ 0x70B3D5, 0xC7E000, 0xC7EFFF, "BirdDog Australia", "BIRDDOG-AUSTRALIA" },
-	{ 0x70B3D5, 0xF03000, 0xF03FFF, "GMI Ltd", "GMI" },
-	{ 0x70B3D5, 0x8C2000, 0x8C2FFF, "F-domain corporation", "F-DOMAIN" },
-	{ 0x70B3D5, 0x72C000, 0x72CFFF, "NuRi&G Engineering co,.Ltd.", "NURI-G-ENGINEERING" },
-	{ 0x70B3D5, 0x735000, 0x735FFF, "Swiss Audio", "SWISS-AUDIO" },
-	{ 0x70B3D5, 0x260000, 0x260FFF, "ModuSystems, Inc", "MODUSYSTEMS" },
-	{ 0x70B3D5, 0x4EF000, 0x4EFFFF, "CMI, Inc.", "CMI" },
-	{ 0x70B3D5, 0xC12000, 0xC12FFF, "Beijing Wisetone Information Technology Co.,Ltd.", "BEIJING-WISETONE-INFORMATION" },
-	{ 0x70B3D5, 0x930000, 0x930FFF, "The Institute of Mine Seismology", "THE-INSTITUTE-OF-MINE-SEISMOLOGY" },
-	{ 0x70B3D5, 0x188000, 0x188FFF, "Birket Engineering", "BIRKET-ENGINEERING" },
-	{ 0x70B3D5, 0x5E2000, 0x5E2FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x25A000, 0x25AFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x16F000, 0x16FFFF, "NimbeLink Corp", "NIMBELINK" },
-	{ 0x70B3D5, 0x9C0000, 0x9C0FFF, "Schneider Displaytechnik GmbH", "SCHNEIDER-DISPLAYTECHNIK" },
+	{ 0x70B3D5, 0x132000, 0x132FFF, "Hagenuk KMT Kabelmesstechnik GmbH", "HAGENUK-KMT-KABELMESSTECHNIK" },
+	{ 0x70B3D5, 0x133000, 0x133FFF, "Vidisys GmbH", "VIDISYS" },
+	{ 0x70B3D5, 0x134000, 0x134FFF, "Conjing Networks Inc.", "CONJING-NETWORKS" },
+	{ 0x70B3D5, 0x135000, 0x135FFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0x136000, 0x136FFF, "Miguel Corporate Services Pte Ltd", "MIGUEL-CORPORATE-SERVICES-PTE" },
+	{ 0x70B3D5, 0x138000, 0x138FFF, "SMITEC S.p.A.", "SMITEC-S-P-A" },
+	{ 0x70B3D5, 0x139000, 0x139FFF, "Tunstall A/S", "TUNSTALL-A/S" },
+	{ 0x70B3D5, 0x13A000, 0x13AFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x13B000, 0x13BFFF, "Sienna Corporation", "SIENNA" },
+	{ 0x70B3D5, 0x13C000, 0x13CFFF, "Detec Systems Ltd", "DETEC" },
+	{ 0x70B3D5, 0x13D000, 0x13DFFF, "Elsist Srl", "ELSIST-SRL" },
+	{ 0x70B3D5, 0x13E000, 0x13EFFF, "Stara S/A Indústria de Implementos Agrícolas", "STARA-S/A-INDúSTRIA-DE-IMPLEMENTOS-AGRíCOLAS" },
+	{ 0x70B3D5, 0x13F000, 0x13FFFF, "Farmobile", "FARMOBILE" },
+	{ 0x70B3D5, 0x140000, 0x140FFF, "Virta Laboratories, Inc.", "VIRTA-LABORATORIES" },
+	{ 0x70B3D5, 0x141000, 0x141FFF, "M.T. S.R.L.", "M-T-S-R-L" },
+	{ 0x70B3D5, 0x142000, 0x142FFF, "DAVE SRL", "DAVE-SRL" },
+	{ 0x70B3D5, 0x144000, 0x144FFF, "GS Elektromedizinsiche Geräte G. Stemple GmbH", "GS-ELEKTROMEDIZINSICHE-GERAETE-G-STEMPLE" },
+	{ 0x70B3D5, 0x145000, 0x145FFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x146000, 0x146FFF, "3City Electronics", "3CITY-ELECTRONICS" },
+	{ 0x70B3D5, 0x147000, 0x147FFF, "ROMO Wind A/S", "ROMO-WIND-A/S" },
+	{ 0x70B3D5, 0x148000, 0x148FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
 	{ 0x70B3D5, 0x149000, 0x149FFF, "eleven-x", "ELEVEN-X" },
-	{ 0x70B3D5, 0xE98000, 0xE98FFF, "JSC Kaluga Astral", "JSC-KALUGA-ASTRAL" },
-	{ 0x70B3D5, 0x443000, 0x443FFF, "Slot3 GmbH", "SLOT3" },
-	{ 0x70B3D5, 0x952000, 0x952FFF, "REQUEA", "REQUEA" },
-	{ 0x70B3D5, 0xBAA000, 0xBAAFFF, "Device Solutions Ltd", "DEVICE-SOLUTIONS" },
-	{ 0x70B3D5, 0xC5C000, 0xC5CFFF, "Layer Logic Inc", "LAYER-LOGIC" },
-	{ 0x70B3D5, 0xF3B000, 0xF3BFFF, "Epdm Pty Ltd", "EPDM-PTY" },
-	{ 0x70B3D5, 0x9F6000, 0x9F6FFF, "Edgeware AB", "EDGEWARE-AB" },
-	{ 0x70B3D5, 0x36F000, 0x36FFFF, "BuddyGuard GmbH", "BUDDYGUARD" },
-	{ 0x70B3D5, 0x222000, 0x222FFF, "Marioff Corporation Oy", "MARIOFF-OY" },
-	{ 0x70B3D5, 0x0E3000, 0x0E3FFF, "SinTau SrL", "SINTAU-SRL" },
-	{ 0x70B3D5, 0x2E5000, 0x2E5FFF, "Fläkt Woods AB", "FLAEKT-WOODS-AB" },
-	{ 0x70B3D5, 0x88D000, 0x88DFFF, "LG Electronics", "LG-ELECTRONICS" },
-	{ 0x70B3D5, 0xA8B000, 0xA8BFFF, "Giant Power Technology Biomedical Corporation", "GIANT-POWER-BIOMEDICAL" },
-	{ 0x70B3D5, 0x0F1000, 0x0F1FFF, "Beijing One City Science & Technology Co., LTD", "BEIJING-ONE-CITY-SCIENCE" },
-	{ 0x70B3D5, 0x9CE000, 0x9CEFFF, "Terragene S.A", "TERRAGENE" },
-	{ 0x70B3D5, 0xCEA000, 0xCEAFFF, "Computerwise, Inc.", "COMPUTERWISE" },
-	{ 0x70B3D5, 0xF1D000, 0xF1DFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0xF05000, 0xF05FFF, "Motomuto Aps", "MOTOMUTO-APS" },
-	{ 0x70B3D5, 0xFFC000, 0xFFCFFF, "Symetrics Industries d.b.a. Extant Aerospace", "SYMETRICS-INDUSTRIES-D-B-A-EXTANT-AEROSPACE" },
-	{ 0x70B3D5, 0x5E0000, 0x5E0FFF, "Hexagon Metrology SAS", "HEXAGON-METROLOGY-SAS" },
-	{ 0x70B3D5, 0x9D0000, 0x9D0FFF, "RJ45 Technologies", "RJ45-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x672000, 0x672FFF, "KLEIBER Infrared GmbH", "KLEIBER-INFRARED" },
-	{ 0x70B3D5, 0x572000, 0x572FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x927000, 0x927FFF, "LG Electronics", "LG-ELECTRONICS" },
-	{ 0x70B3D5, 0x2B1000, 0x2B1FFF, "WIXCON Co., Ltd", "WIXCON" },
-	{ 0x70B3D5, 0x579000, 0x579FFF, "Chelsea Technologies Group Ltd", "CHELSEA-TECHNOLOGIES-GROUP" },
-	{ 0x70B3D5, 0x9B2000, 0x9B2FFF, "CONTINENT, Ltd", "CONTINENT" },
-	{ 0x70B3D5, 0x365000, 0x365FFF, "CircuitMeter Inc.", "CIRCUITMETER" },
-	{ 0x70B3D5, 0x805000, 0x805FFF, "Eurotronik Kranj d.o.o.", "EUROTRONIK-KRANJ-D-O-O" },
-	{ 0x70B3D5, 0x0B4000, 0x0B4FFF, "AVER", "AVER" },
-	{ 0x70B3D5, 0xBF6000, 0xBF6FFF, "comtac AG", "COMTAC" },
-	{ 0x70B3D5, 0x1B6000, 0x1B6FFF, "DACOM West GmbH", "DACOM-WEST" },
-	{ 0x70B3D5, 0x9C1000, 0x9C1FFF, "Zeroplus Technology Co.,Ltd.", "ZEROPLUS" },
-	{ 0x70B3D5, 0x094000, 0x094FFF, "Circuitlink Pty Ltd", "CIRCUITLINK-PTY" },
-	{ 0x70B3D5, 0xAA3000, 0xAA3FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
-	{ 0x70B3D5, 0xAEF000, 0xAEFFFF, "Baumtec GmbH", "BAUMTEC" },
-	{ 0x70B3D5, 0xD92000, 0xD92FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
-	{ 0x70B3D5, 0xCC9000, 0xCC9FFF, "Rapiscan Systems", "RAPISCAN" },
-	{ 0x70B3D5, 0xDA4000, 0xDA4FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x2D0000, 0x2D0FFF, "ijin co.,ltd.", "IJIN" },
-	{ 0x70B3D5, 0x0A0000, 0x0A0FFF, "Cominfo, Inc.", "COMINFO" },
-	{ 0x70B3D5, 0x20F000, 0x20FFFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
-	{ 0x70B3D5, 0xC20000, 0xC20FFF, "Mipot S.p.a.", "MIPOT-S-P-A" },
-	{ 0x70B3D5, 0x4D5000, 0x4D5FFF, "Moog Rekofa GmbH", "MOOG-REKOFA" },
-	{ 0x70B3D5, 0xD3C000, 0xD3CFFF, "HRT", "HRT" },
-	{ 0x70B3D5, 0xDDB000, 0xDDBFFF, "Intra Corporation", "INTRA" },
-	{ 0x70B3D5, 0x8EE000, 0x8EEFFF, "Network Additions", "NETWORK-ADDITIONS" },
-	{ 0x70B3D5, 0x445000, 0x445FFF, "Advanced Devices SpA", "ADVANCED-DEVICES-SPA" },
-	{ 0x70B3D5, 0x674000, 0x674FFF, "Fortress Cyber Security", "FORTRESS-CYBER-SECURITY" },
-	{ 0x70B3D5, 0xDB8000, 0xDB8FFF, "SISTEM SA", "SISTEM" },
-	{ 0x70B3D5, 0xFBC000, 0xFBCFFF, "Twoway Communications, Inc.", "TWOWAY-COMMUNICATION" },
-	{ 0x70B3D5, 0x969000, 0x969FFF, "Emtel System Sp. z o.o.", "EMTEL-SYSTEM-SP-Z-O-O" },
-	{ 0x70B3D5, 0xC33000, 0xC33FFF, "Dandong Dongfang Measurement & Control Technology Co., Ltd.", "DANDONG-DONGFANG-MEASUREMENT-CONTROL" },
-	{ 0x70B3D5, 0xB2E000, 0xB2EFFF, "Green Access Ltd", "GREEN-ACCESS" },
-	{ 0x70B3D5, 0x58C000, 0x58CFFF, "OPTSYS", "OPTSYS" },
-	{ 0x70B3D5, 0x95B000, 0x95BFFF, "SRS Group s.r.o.", "SRS-GROUP-S-R-O" },
-	{ 0x70B3D5, 0x34E000, 0x34EFFF, "Risk Expert sarl", "RISK-EXPERT-SARL" },
-	{ 0x70B3D5, 0x6AD000, 0x6ADFFF, "CONNIT", "CONNIT" },
-	{ 0x70B3D5, 0xC14000, 0xC14FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0xC53000, 0xC53FFF, "S Labs sp. z o.o.", "S-LABS-SP-Z-O-O" },
-	{ 0x70B3D5, 0xF24000, 0xF24FFF, "Daavlin", "DAAVLIN" },
-	{ 0x70B3D5, 0x6E7000, 0x6E7FFF, "AML", "AML" },
-	{ 0x70B3D5, 0x77B000, 0x77BFFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
-	{ 0x70B3D5, 0x04E000, 0x04EFFF, "HUGEL GmbH", "HUGEL" },
-	{ 0x70B3D5, 0x319000, 0x319FFF, "ISO/TC 22/SC 31", "ISO/TC-22/SC-31" },
-	{ 0x70B3D5, 0x844000, 0x844FFF, "SANSFIL Technologies", "SANSFIL-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xC42000, 0xC42FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x557000, 0x557FFF, "HEITEC AG", "HEITEC" },
-	{ 0x70B3D5, 0x68C000, 0x68CFFF, "ND METER", "ND-METER" },
-	{ 0x70B3D5, 0x727000, 0x727FFF, "LP Technologies Inc.", "LP-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x49B000, 0x49BFFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
+	{ 0x70B3D5, 0x14A000, 0x14AFFF, "ExSens Technology (Pty) Ltd.", "EXSENS-PTY" },
+	{ 0x70B3D5, 0x14B000, 0x14BFFF, "C21 Systems Ltd", "C21" },
+	{ 0x70B3D5, 0x14C000, 0x14CFFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x14D000, 0x14DFFF, "2-Observe", "2-OBSERVE" },
+	{ 0x70B3D5, 0x14E000, 0x14EFFF, "Innosonix GmbH", "INNOSONIX" },
+	{ 0x70B3D5, 0x14F000, 0x14FFFF, "Mobile Devices Unlimited", "MOBILE-DEVICES-UNLIMITED" },
+	{ 0x70B3D5, 0x152000, 0x152FFF, "Xped Corporation Pty Ltd", "XPED-PTY" },
+	{ 0x70B3D5, 0x153000, 0x153FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
+	{ 0x70B3D5, 0x154000, 0x154FFF, "Walk Horizon Technology (Beijing) Co., Ltd.", "WALK-HORIZON-BEIJING" },
+	{ 0x70B3D5, 0x15B000, 0x15BFFF, "Armstrong International, Inc.", "ARMSTRONG" },
+	{ 0x70B3D5, 0x15C000, 0x15CFFF, "Woods Hole Oceanographic Institution", "WOODS-HOLE-OCEANOGRAPHIC-INSTITUTION" },
+	{ 0x70B3D5, 0x15D000, 0x15DFFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0x15E000, 0x15EFFF, "Season Electronics Ltd", "SEASON-ELECTRONICS" },
+	{ 0x70B3D5, 0x15F000, 0x15FFFF, "SAVRONİK ELEKTRONİK", "SAVRONİK-ELEKTRONİK" },
+	{ 0x70B3D5, 0x161000, 0x161FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x162000, 0x162FFF, "ESPAI DE PRODUCCIÓ I ELECTRÓNI", "ESPAI-DE-PRODUCCIÓ-I-ELECTRÓNI" },
+	{ 0x70B3D5, 0x163000, 0x163FFF, "BHARAT HEAVY ELECTRICALS LIMITED", "BHARAT-HEAVY-ELECTRICALS" },
+	{ 0x70B3D5, 0x164000, 0x164FFF, "Tokyo Drawing Ltd.", "TOKYO-DRAWING" },
+	{ 0x70B3D5, 0x166000, 0x166FFF, "SERIAL IMAGE INC.", "SERIAL-IMAGE" },
+	{ 0x70B3D5, 0x167000, 0x167FFF, "Eiden Co.,Ltd.", "EIDEN" },
+	{ 0x70B3D5, 0x168000, 0x168FFF, "Biwave Technologies, Inc.", "BIWAVE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x169000, 0x169FFF, "Service Plus LLC", "SERVICE-PLUS-LLC" },
+	{ 0x70B3D5, 0x16B000, 0x16BFFF, "IOT Engineering", "IOT-ENGINEERING" },
+	{ 0x70B3D5, 0x16C000, 0x16CFFF, "OCEAN", "OCEAN" },
+	{ 0x70B3D5, 0x16E000, 0x16EFFF, "Jemac Sweden AB", "JEMAC-SWEDEN-AB" },
+	{ 0x70B3D5, 0x16F000, 0x16FFFF, "NimbeLink Corp", "NIMBELINK" },
+	{ 0x70B3D5, 0x172000, 0x172FFF, "LumiGrow, Inc", "LUMIGROW" },
+	{ 0x70B3D5, 0x173000, 0x173FFF, "National TeleConsultants LLC", "NATIONAL-TELECONSULTANTS-LLC" },
+	{ 0x70B3D5, 0x174000, 0x174FFF, "Carlson Wireless Technologies Inc.", "CARLSON-WIRELESS-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x175000, 0x175FFF, "Akribis Systems", "AKRIBIS" },
+	{ 0x70B3D5, 0x178000, 0x178FFF, "Gamber Johnson-LLC", "GAMBER-JOHNSON-LLC" },
+	{ 0x70B3D5, 0x179000, 0x179FFF, "ALTRAN UK", "ALTRAN-UK" },
+	{ 0x70B3D5, 0x17A000, 0x17AFFF, "Gencoa Ltd", "GENCOA" },
+	{ 0x70B3D5, 0x17B000, 0x17BFFF, "Vistec Electron Beam GmbH", "VISTEC-ELECTRON-BEAM" },
+	{ 0x70B3D5, 0x17D000, 0x17DFFF, "Entech Electronics", "ENTECH-ELECTRONICS" },
+	{ 0x70B3D5, 0x17E000, 0x17EFFF, "OCULI VISION", "OCULI-VISION" },
+	{ 0x70B3D5, 0x17F000, 0x17FFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x180000, 0x180FFF, "LHA Systems (Pty) Ltd", "LHA-PTY" },
+	{ 0x70B3D5, 0x181000, 0x181FFF, "Task Sistemas", "TASK-SISTEMAS" },
+	{ 0x70B3D5, 0x182000, 0x182FFF, "Kitron UAB", "KITRON-UAB" },
+	{ 0x70B3D5, 0x183000, 0x183FFF, "Evco S.p.a.", "EVCO-S-P-A" },
+	{ 0x70B3D5, 0x184000, 0x184FFF, "XV360 Optical Information Systems Ltd.", "XV360-OPTICAL-INFORMATION" },
+	{ 0x70B3D5, 0x185000, 0x185FFF, "R&D Gran-System-S LLC", "R-D-GRAN-SYSTEM-S-LLC" },
+	{ 0x70B3D5, 0x186000, 0x186FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0x187000, 0x187FFF, "Elektronik & Präzisionsbau Saalfeld GmbH", "ELEKTRONIK-PRAEZISIONSBAU-SAALFELD" },
+	{ 0x70B3D5, 0x188000, 0x188FFF, "Birket Engineering", "BIRKET-ENGINEERING" },
+	{ 0x70B3D5, 0x189000, 0x189FFF, "DAVE SRL", "DAVE-SRL" },
+	{ 0x70B3D5, 0x18B000, 0x18BFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x18C000, 0x18CFFF, "CMC Industrial Electronics Ltd", "CMC-INDUSTRIAL-ELECTRONICS" },
+	{ 0x70B3D5, 0x18D000, 0x18DFFF, "Foro Tel", "FORO-TEL" },
+	{ 0x70B3D5, 0x18E000, 0x18EFFF, "NIPPON SEIKI CO., LTD.", "NIPPON-SEIKI" },
+	{ 0x70B3D5, 0x190000, 0x190FFF, "Fantom Wireless, Inc.", "FANTOM-WIRELESS" },
+	{ 0x70B3D5, 0x192000, 0x192FFF, "ASPT, INC.", "ASPT" },
+	{ 0x70B3D5, 0x194000, 0x194FFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
+	{ 0x70B3D5, 0x197000, 0x197FFF, "Lattech Systems Pty Ltd", "LATTECH-PTY" },
+	{ 0x70B3D5, 0x19A000, 0x19AFFF, "WiSuite USA", "WISUITE-USA" },
+	{ 0x70B3D5, 0x19B000, 0x19BFFF, "Global Technical Systems", "GLOBAL-TECHNICAL" },
+	{ 0x70B3D5, 0x19C000, 0x19CFFF, "Kubu, Inc.", "KUBU" },
+	{ 0x70B3D5, 0x19E000, 0x19EFFF, "J-Factor Embedded Technologies", "J-FACTOR-EMBEDDED-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x19F000, 0x19FFFF, "Koizumi Lighting Technology Corp.", "KOIZUMI-LIGHTING" },
+	{ 0x70B3D5, 0x1A0000, 0x1A0FFF, "UFATECH LTD", "UFATECH" },
+	{ 0x70B3D5, 0x1A1000, 0x1A1FFF, "HMicro Inc", "HMICRO" },
+	{ 0x70B3D5, 0x1A3000, 0x1A3FFF, "Telairity Semiconductor", "TELAIRITY-SEMICONDUCTOR" },
+	{ 0x70B3D5, 0x1A5000, 0x1A5FFF, "METRONIC APARATURA KONTROLNO - POMIAROWA", "METRONIC-APARATURA-KONTROLNO---POMIAROWA" },
+	{ 0x70B3D5, 0x1A6000, 0x1A6FFF, "Robotelf Technologies (Chengdu) Co., Ltd.", "ROBOTELF-TECHNOLOGIES-CHENGDU" },
+	{ 0x70B3D5, 0x1A8000, 0x1A8FFF, "STC Rainbow Ltd.", "STC-RAINBOW" },
+	{ 0x70B3D5, 0x1A9000, 0x1A9FFF, "OCEANIX INC.", "OCEANIX" },
+	{ 0x70B3D5, 0x1AB000, 0x1ABFFF, "Access Control Systems JSC", "ACCESS-CONTROL-JSC" },
+	{ 0x70B3D5, 0x1AC000, 0x1ACFFF, "SVP Broadcast Microwave S.L.", "SVP-BROADCAST-MICROWAVE-S-L" },
+	{ 0x70B3D5, 0x1AD000, 0x1ADFFF, "Techworld Industries Ltd", "TECHWORLD-INDUSTRIES" },
+	{ 0x70B3D5, 0x1AF000, 0x1AFFFF, "Teenage Engineering AB", "TEENAGE-ENGINEERING-AB" },
+	{ 0x70B3D5, 0x1B4000, 0x1B4FFF, "5nines", "5NINES" },
+	{ 0x70B3D5, 0x1B5000, 0x1B5FFF, "StarBridge, Inc.", "STARBRIDGE" },
+	{ 0x70B3D5, 0x1B6000, 0x1B6FFF, "DACOM West GmbH", "DACOM-WEST" },
+	{ 0x70B3D5, 0x1B8000, 0x1B8FFF, "OES Inc.", "OES" },
+	{ 0x70B3D5, 0x1B9000, 0x1B9FFF, "RELISTE Ges.m.b.H.", "RELISTE-GES-M-B-H" },
+	{ 0x70B3D5, 0x1BB000, 0x1BBFFF, "EFENTO T P SZYDŁOWSKI K ZARĘBA SPÓŁKA JAWNA", "EFENTO-T-P-SZYDŁOWSKI-K-ZARĘBA-SPÓŁKA-JAWNA" },
+	{ 0x70B3D5, 0x1BD000, 0x1BDFFF, "Shenzhen Siera Technology Ltd", "SHENZHEN-SIERA" },
+	{ 0x70B3D5, 0x1BE000, 0x1BEFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0x1C4000, 0x1C4FFF, "Smeg S.p.A.", "SMEG-S-P-A" },
+	{ 0x70B3D5, 0x1C5000, 0x1C5FFF, "ELSAG", "ELSAG" },
+	{ 0x70B3D5, 0x1C7000, 0x1C7FFF, "Hoshin Electronics Co., Ltd.", "HOSHIN-ELECTRONICS" },
+	{ 0x70B3D5, 0x1C8000, 0x1C8FFF, "LDA audio video profesional S.L.", "LDA-AUDIO-VIDEO-PROFESIONAL-S-L" },
+	{ 0x70B3D5, 0x1C9000, 0x1C9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x1CB000, 0x1CBFFF, "MatchX GmbH", "MATCHX" },
+	{ 0x70B3D5, 0x1CC000, 0x1CCFFF, "AooGee Controls Co., LTD.", "AOOGEE-CONTROLS" },
+	{ 0x70B3D5, 0x1CD000, 0x1CDFFF, "ELEUSI GmbH", "ELEUSI" },
 	{ 0x70B3D5, 0x1D0000, 0x1D0FFF, "Shenzhen INVT Electric Co.,Ltd", "SHENZHEN-INVT-ELECTRIC" },
-	{ 0x70B3D5, 0x400000, 0x400FFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0xB2B000, 0xB2BFFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0xE0F000, 0xE0FFFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0x8C8000, 0x8C8FFF, "KRONOTECH SRL", "KRONOTECH-SRL" },
-	{ 0x70B3D5, 0x670000, 0x670FFF, "Particle sizing systems", "PARTICLE-SIZING" },
-	{ 0x70B3D5, 0x4E1000, 0x4E1FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x7EA000, 0x7EAFFF, "Waterkotte GmbH", "WATERKOTTE" },
-	{ 0x70B3D5, 0x5E3000, 0x5E3FFF, "Imecon Engineering SrL", "IMECON-ENGINEERING-SRL" },
+	{ 0x70B3D5, 0x1D1000, 0x1D1FFF, "Eurotek Srl", "EUROTEK-SRL" },
+	{ 0x70B3D5, 0x1D3000, 0x1D3FFF, "AIROBOT OÜ", "AIROBOT-OUE" },
+	{ 0x70B3D5, 0x1D4000, 0x1D4FFF, "Brinkmann Audio GmbH", "BRINKMANN-AUDIO" },
+	{ 0x70B3D5, 0x1D7000, 0x1D7FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x1D8000, 0x1D8FFF, "Blue Skies Global LLC", "BLUE-SKIES-GLOBAL-LLC" },
+	{ 0x70B3D5, 0x1DA000, 0x1DAFFF, "Promess Inc.", "PROMESS" },
+	{ 0x70B3D5, 0x1DB000, 0x1DBFFF, "Hudson Robotics", "HUDSON-ROBOTICS" },
+	{ 0x70B3D5, 0x1DC000, 0x1DCFFF, "TEKVEL Ltd.", "TEKVEL" },
+	{ 0x70B3D5, 0x1DD000, 0x1DDFFF, "RF CREATIONS LTD", "RF-CREATIONS" },
+	{ 0x70B3D5, 0x1DE000, 0x1DEFFF, "DYCEC, S.A.", "DYCEC" },
+	{ 0x70B3D5, 0x1E0000, 0x1E0FFF, "TOPROOTTechnology Corp. Ltd.", "TOPROOTTECHNOLOGY" },
+	{ 0x70B3D5, 0x1E3000, 0x1E3FFF, "Hatel Elektronik LTD. STI.", "HATEL-ELEKTRONIK-STI" },
+	{ 0x70B3D5, 0x1E4000, 0x1E4FFF, "Tecnologix s.r.l.", "TECNOLOGIX-S-R-L" },
+	{ 0x70B3D5, 0x1E5000, 0x1E5FFF, "VendNovation LLC", "VENDNOVATION-LLC" },
+	{ 0x70B3D5, 0x1E6000, 0x1E6FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
+	{ 0x70B3D5, 0x1E8000, 0x1E8FFF, "Gogo BA", "GOGO-BA" },
+	{ 0x70B3D5, 0x1E9000, 0x1E9FFF, "comtime GmbH", "COMTIME" },
+	{ 0x70B3D5, 0x1EA000, 0x1EAFFF, "Sense For Innovation", "SENSE-FOR-INNOVATION" },
+	{ 0x70B3D5, 0x1EE000, 0x1EEFFF, "MEGGITT", "MEGGITT" },
+	{ 0x70B3D5, 0x1EF000, 0x1EFFFF, "ADTEK", "ADTEK" },
+	{ 0x70B3D5, 0x1F3000, 0x1F3FFF, "Smart Energy Code Company Limited", "SMART-ENERGY-CODE-COMPANY" },
+	{ 0x70B3D5, 0x1F4000, 0x1F4FFF, "Hangzhou Woosiyuan Communication Co.,Ltd.", "HANGZHOU-WOOSIYUAN-COMMUNICATION" },
+	{ 0x70B3D5, 0x1F5000, 0x1F5FFF, "Martec S.p.A.", "MARTEC-S-P-A" },
+	{ 0x70B3D5, 0x1F8000, 0x1F8FFF, "Convergent Design", "CONVERGENT-DESIGN" },
+	{ 0x70B3D5, 0x1FD000, 0x1FDFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
+	{ 0x70B3D5, 0x1FE000, 0x1FEFFF, "MobiPromo", "MOBIPROMO" },
+	{ 0x70B3D5, 0x200000, 0x200FFF, "NextEV Co., Ltd.", "NEXTEV" },
+	{ 0x70B3D5, 0x202000, 0x202FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x203000, 0x203FFF, "WOOJIN Inc", "WOOJIN" },
+	{ 0x70B3D5, 0x204000, 0x204FFF, "TWC", "TWC" },
+	{ 0x70B3D5, 0x205000, 0x205FFF, "Esource Srl", "ESOURCE-SRL" },
+	{ 0x70B3D5, 0x207000, 0x207FFF, "Savari Inc", "SAVARI" },
+	{ 0x70B3D5, 0x208000, 0x208FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
+	{ 0x70B3D5, 0x209000, 0x209FFF, "SmartNodes", "SMARTNODES" },
+	{ 0x70B3D5, 0x20A000, 0x20AFFF, "Golden Grid Systems", "GOLDEN-GRID" },
+	{ 0x70B3D5, 0x20C000, 0x20CFFF, "Siemens Healthcare Diagnostics", "SIEMENS-HEALTHCARE-DIAGNOSTICS" },
+	{ 0x70B3D5, 0x20D000, 0x20DFFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x20E000, 0x20EFFF, "Amrehn & Partner EDV-Service GmbH", "AMREHN-PARTNER-EDV-SERVICE" },
+	{ 0x70B3D5, 0x20F000, 0x20FFFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
+	{ 0x70B3D5, 0x211000, 0x211FFF, "Fracarro srl", "FRACARRO-SRL" },
+	{ 0x70B3D5, 0x213000, 0x213FFF, "ETON Deutschland Electro Acoustic GmbH", "ETON-DEUTSCHLAND-ELECTRO-ACOUSTIC" },
+	{ 0x70B3D5, 0x214000, 0x214FFF, "signalparser", "SIGNALPARSER" },
+	{ 0x70B3D5, 0x215000, 0x215FFF, "Dataspeed Inc", "DATASPEED" },
+	{ 0x70B3D5, 0x216000, 0x216FFF, "FLEXTRONICS", "FLEXTRONICS" },
+	{ 0x70B3D5, 0x217000, 0x217FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
+	{ 0x70B3D5, 0x21B000, 0x21BFFF, "Lab241 Co.,Ltd.", "LAB241" },
+	{ 0x70B3D5, 0x21C000, 0x21CFFF, "Enyx SA", "ENYX" },
+	{ 0x70B3D5, 0x21D000, 0x21DFFF, "iRF - Intelligent RF Solutions, LLC", "IRF---INTELLIGENT-RF-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0x21E000, 0x21EFFF, "Hildebrand Technology Limited", "HILDEBRAND" },
+	{ 0x70B3D5, 0x21F000, 0x21FFFF, "CHRONOMEDIA", "CHRONOMEDIA" },
+	{ 0x70B3D5, 0x220000, 0x220FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x222000, 0x222FFF, "Marioff Corporation Oy", "MARIOFF-OY" },
+	{ 0x70B3D5, 0x224000, 0x224FFF, "Urbana Smart Solutions Pte Ltd", "URBANA-SMART-SOLUTIONS-PTE" },
+	{ 0x70B3D5, 0x225000, 0x225FFF, "RCD Radiokomunikace", "RCD-RADIOKOMUNIKACE" },
+	{ 0x70B3D5, 0x226000, 0x226FFF, "Yaviar", "YAVIAR" },
+	{ 0x70B3D5, 0x227000, 0x227FFF, "Montalvo", "MONTALVO" },
+	{ 0x70B3D5, 0x228000, 0x228FFF, "HEITEC AG", "HEITEC" },
+	{ 0x70B3D5, 0x229000, 0x229FFF, "CONTROL SYSTEMS Srl", "CONTROL-SRL" },
+	{ 0x70B3D5, 0x22A000, 0x22AFFF, "Shishido Electrostatic, Ltd.", "SHISHIDO-ELECTROSTATIC" },
+	{ 0x70B3D5, 0x22B000, 0x22BFFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0x22C000, 0x22CFFF, "Hiquel Elektronik- und Anlagenbau GmbH", "HIQUEL-ELEKTRONIK--UND-ANLAGENBAU" },
+	{ 0x70B3D5, 0x22D000, 0x22DFFF, "Leder Elektronik Design", "LEDER-ELEKTRONIK-DESIGN" },
+	{ 0x70B3D5, 0x22E000, 0x22EFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x22F000, 0x22FFFF, "Instec, Inc.", "INSTEC" },
+	{ 0x70B3D5, 0x230000, 0x230FFF, "CT Company", "CT-COMPANY" },
+	{ 0x70B3D5, 0x231000, 0x231FFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
+	{ 0x70B3D5, 0x232000, 0x232FFF, "UCONSYS", "UCONSYS" },
+	{ 0x70B3D5, 0x234000, 0x234FFF, "EDFelectronics JRMM Sp z o.o. sp.k.", "EDFELECTRONICS-JRMM-SP-Z-O-O-SP-K" },
+	{ 0x70B3D5, 0x235000, 0x235FFF, "CAMEON S.A.", "CAMEON" },
+	{ 0x70B3D5, 0x236000, 0x236FFF, "Monnit Corporation", "MONNIT" },
+	{ 0x70B3D5, 0x238000, 0x238FFF, "Arete Associates", "ARETE-ASSOCIATES" },
+	{ 0x70B3D5, 0x23A000, 0x23AFFF, "Mesa Labs, Inc.", "MESA-LABS" },
+	{ 0x70B3D5, 0x23B000, 0x23BFFF, "Fink Telecom Services", "FINK-TELECOM-SERVICES" },
+	{ 0x70B3D5, 0x23C000, 0x23CFFF, "Quasonix, LLC", "QUASONIX-LLC" },
+	{ 0x70B3D5, 0x23E000, 0x23EFFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
+	{ 0x70B3D5, 0x23F000, 0x23FFFF, "ETA-USA", "ETA-USA" },
+	{ 0x70B3D5, 0x240000, 0x240FFF, "Orlaco Products B.V.", "ORLACO-PRODUCTS" },
+	{ 0x70B3D5, 0x241000, 0x241FFF, "Bolide Technology Group, Inc.", "BOLIDE-GROUP" },
+	{ 0x70B3D5, 0x243000, 0x243FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0x245000, 0x245FFF, "Newtec A/S", "NEWTEC-A/S" },
+	{ 0x70B3D5, 0x246000, 0x246FFF, "Saline Lectronics, Inc.", "SALINE-LECTRONICS" },
+	{ 0x70B3D5, 0x248000, 0x248FFF, "GL TECH CO.,LTD", "GL-TECH" },
+	{ 0x70B3D5, 0x24A000, 0x24AFFF, "Unmukti Technology Pvt Ltd", "UNMUKTI-PVT" },
+	{ 0x70B3D5, 0x24B000, 0x24BFFF, "TOSEI ENGINEERING CORP.", "TOSEI-ENGINEERING" },
+	{ 0x70B3D5, 0x24D000, 0x24DFFF, "INFO CREATIVE (HK) LTD", "INFO-CREATIVE-HK" },
+	{ 0x70B3D5, 0x24E000, 0x24EFFF, "Chengdu Cove Technology CO.,LTD", "CHENGDU-COVE" },
 	{ 0x70B3D5, 0x24F000, 0x24FFFF, "ELBIT SYSTEMS BMD AND LAND EW - ELISRA LTD", "ELBIT-BMD-AND-LAND-EW---ELISRA" },
-	{ 0x70B3D5, 0x837000, 0x837FFF, "HiDes, Inc.", "HIDES" },
-	{ 0x70B3D5, 0x4F9000, 0x4F9FFF, "OptoPrecision GmbH", "OPTOPRECISION" },
-	{ 0x70B3D5, 0xB64000, 0xB64FFF, "OSUNG LST CO.,LTD.", "OSUNG-LST" },
-	{ 0x70B3D5, 0x7A3000, 0x7A3FFF, "Impulse Automation", "IMPULSE-AUTOMATION" },
-	{ 0x70B3D5, 0x631000, 0x631FFF, "SENSO2ME", "SENSO2ME" },
-	{ 0x70B3D5, 0xDBF000, 0xDBFFFF, "Infodev Electronic Designers Intl.", "INFODEV-DESIGNERS-INTL" },
-	{ 0x70B3D5, 0xF7A000, 0xF7AFFF, "SENSO2ME", "SENSO2ME" },
-	{ 0x70B3D5, 0xBB9000, 0xBB9FFF, "KOSMEK.Ltd", "KOSMEK" },
-	{ 0x70B3D5, 0x602000, 0x602FFF, "Quantum Opus, LLC", "QUANTUM-OPUS-LLC" },
-	{ 0x70B3D5, 0x6D8000, 0x6D8FFF, "Shanghai YuanAn Environmental Protection Technology Co.,Ltd", "SHANGHAI-YUANAN-ENVIRONMENTAL-PROTECTION" },
+	{ 0x70B3D5, 0x250000, 0x250FFF, "Datum Electronics Limited", "DATUM-ELECTRONICS" },
+	{ 0x70B3D5, 0x252000, 0x252FFF, "Sierra Nevada Corporation", "SIERRA-NEVADA" },
+	{ 0x70B3D5, 0x253000, 0x253FFF, "Wimate Technology Solutions Private Limited", "WIMATE-SOLUTIONS-PRIVATE" },
+	{ 0x70B3D5, 0x254000, 0x254FFF, "Spectrum Brands", "SPECTRUM-BRANDS" },
+	{ 0x70B3D5, 0x255000, 0x255FFF, "Asystems Corporation", "ASYSTEMS" },
+	{ 0x70B3D5, 0x257000, 0x257FFF, "LG Electronics", "LG-ELECTRONICS" },
+	{ 0x70B3D5, 0x259000, 0x259FFF, "Zebra Elektronik A.S.", "ZEBRA-ELEKTRONIK-A-S" },
+	{ 0x70B3D5, 0x25A000, 0x25AFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x25B000, 0x25BFFF, "GID Industrial", "GID-INDUSTRIAL" },
+	{ 0x70B3D5, 0x25D000, 0x25DFFF, "Mimo Networks", "MIMO-NETWORKS" },
+	{ 0x70B3D5, 0x25F000, 0x25FFFF, "COPPERNIC SAS", "COPPERNIC-SAS" },
+	{ 0x70B3D5, 0x260000, 0x260FFF, "ModuSystems, Inc", "MODUSYSTEMS" },
+	{ 0x70B3D5, 0x261000, 0x261FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0x266000, 0x266FFF, "Spectra Displays Ltd", "SPECTRA-DISPLAYS" },
+	{ 0x70B3D5, 0x267000, 0x267FFF, "Zehntner Testing Instruments", "ZEHNTNER-TESTING-INSTRUMENTS" },
+	{ 0x70B3D5, 0x268000, 0x268FFF, "Cardinal Scale Mfg Co", "CARDINAL-SCALE-MFG" },
+	{ 0x70B3D5, 0x269000, 0x269FFF, "Gilbarco Veeder-Root ‎", "GILBARCO-VEEDER-ROOT-‎" },
+	{ 0x70B3D5, 0x26B000, 0x26BFFF, "Sorama BV", "SORAMA" },
+	{ 0x70B3D5, 0x26C000, 0x26CFFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
+	{ 0x70B3D5, 0x26E000, 0x26EFFF, "HI-TECH SYSTEM Co. Ltd.", "HI-TECH-SYSTEM" },
+	{ 0x70B3D5, 0x272000, 0x272FFF, "TELECOM SANTE", "TELECOM-SANTE" },
+	{ 0x70B3D5, 0x273000, 0x273FFF, "WeVo Tech", "WEVO-TECH" },
+	{ 0x70B3D5, 0x274000, 0x274FFF, "Stercom Power Solutions GmbH", "STERCOM-POWER-SOLUTIONS" },
+	{ 0x70B3D5, 0x276000, 0x276FFF, "TELL Software Hungaria Kft.", "TELL-SOFTWARE-HUNGARIA-KFT" },
+	{ 0x70B3D5, 0x277000, 0x277FFF, "Voltaware Limited", "VOLTAWARE" },
+	{ 0x70B3D5, 0x278000, 0x278FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x279000, 0x279FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x27A000, 0x27AFFF, "TD ECOPHISIKA", "TD-ECOPHISIKA" },
+	{ 0x70B3D5, 0x27C000, 0x27CFFF, "MOTION LIB,Inc.", "MOTION-LIB" },
+	{ 0x70B3D5, 0x27D000, 0x27DFFF, "Telenor Connexion AB", "TELENOR-CONNEXION-AB" },
+	{ 0x70B3D5, 0x27E000, 0x27EFFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
 	{ 0x70B3D5, 0x27F000, 0x27FFFF, "ST Aerospace Systems", "ST-AEROSPACE" },
-	{ 0x70B3D5, 0x339000, 0x339FFF, "Sierra Nevada Corporation", "SIERRA-NEVADA" },
-	{ 0x70B3D5, 0x4B4000, 0x4B4FFF, "Hi Tech Systems Ltd", "HI-TECH" },
-	{ 0x70B3D5, 0xD4B000, 0xD4BFFF, "Hermann Lümmen GmbH", "HERMANN-LUEMMEN" },
-	{ 0x70B3D5, 0xEF5000, 0xEF5FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x64E000, 0x64EFFF, "BigStuff3, Inc.", "BIGSTUFF3" },
+	{ 0x70B3D5, 0x280000, 0x280FFF, "Computech International", "COMPUTECH" },
+	{ 0x70B3D5, 0x283000, 0x283FFF, "TextNinja Co.", "TEXTNINJA" },
+	{ 0x70B3D5, 0x284000, 0x284FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
+	{ 0x70B3D5, 0x285000, 0x285FFF, "Bentec GmbH Drilling & Oilfield Systems", "BENTEC-DRILLING-OILFIELD" },
+	{ 0x70B3D5, 0x286000, 0x286FFF, "Pedax Danmark", "PEDAX-DANMARK" },
+	{ 0x70B3D5, 0x288000, 0x288FFF, "Bresslergroup", "BRESSLERGROUP" },
+	{ 0x70B3D5, 0x289000, 0x289FFF, "Shenzhen Rongda Computer Co.,Ltd", "SHENZHEN-RONGDA" },
+	{ 0x70B3D5, 0x28A000, 0x28AFFF, "Transit Solutions, LLC.", "TRANSIT-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0x28B000, 0x28BFFF, "Arnouse Digital Devices, Corp.", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x70B3D5, 0x28C000, 0x28CFFF, "Step Technica Co., Ltd.", "STEP-TECHNICA" },
+	{ 0x70B3D5, 0x28D000, 0x28DFFF, "Technica Engineering GmbH", "TECHNICA-ENGINEERING" },
+	{ 0x70B3D5, 0x28E000, 0x28EFFF, "TEX COMPUTER SRL", "TEX-SRL" },
+	{ 0x70B3D5, 0x28F000, 0x28FFFF, "Overline Systems", "OVERLINE" },
+	{ 0x70B3D5, 0x292000, 0x292FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x293000, 0x293FFF, "Solar RIg Technologies", "SOLAR-RIG-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x295000, 0x295FFF, "Cello Electronics (UK) Ltd", "CELLO-ELECTRONICS-UK" },
+	{ 0x70B3D5, 0x296000, 0x296FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0x297000, 0x297FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x29B000, 0x29BFFF, "DermaLumics S.L.", "DERMALUMICS-S-L" },
 	{ 0x70B3D5, 0x29C000, 0x29CFFF, "Teko Telecom Srl", "TEKO-TELECOM-SRL" },
-	{ 0x70B3D5, 0x436000, 0x436FFF, "Henrich Electronics Corporation", "HENRICH-ELECTRONICS" },
-	{ 0x70B3D5, 0x7D0000, 0x7D0FFF, "Cubitech", "CUBITECH" },
-	{ 0x70B3D5, 0xAD8000, 0xAD8FFF, "Euklis by GSG International", "EUKLIS-BY-GSG" },
-	{ 0x70B3D5, 0x24E000, 0x24EFFF, "Chengdu Cove Technology CO.,LTD", "CHENGDU-COVE" },
-	{ 0x70B3D5, 0x5EF000, 0x5EFFFF, "Star Systems International", "STAR" },
-	{ 0x70B3D5, 0xB43000, 0xB43FFF, "ZAO ZEO", "ZAO-ZEO" },
-	{ 0x70B3D5, 0x1A6000, 0x1A6FFF, "Robotelf Technologies (Chengdu) Co., Ltd.", "ROBOTELF-TECHNOLOGIES-CHENGDU" },
-	{ 0x70B3D5, 0x257000, 0x257FFF, "LG Electronics", "LG-ELECTRONICS" },
-	{ 0x70B3D5, 0x920000, 0x920FFF, "SLAT", "SLAT" },
-	{ 0x70B3D5, 0xFFF000, 0xFFFFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x4C0000, 0x4C0FFF, "Technica Engineering GmbH", "TECHNICA-ENGINEERING" },
-	{ 0x70B3D5, 0x1D3000, 0x1D3FFF, "AIROBOT OÜ", "AIROBOT-OUE" },
-	{ 0x70B3D5, 0x6CF000, 0x6CFFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x478000, 0x478FFF, "Touchnet/OneCard", "TOUCHNET/ONECARD" },
-	{ 0x70B3D5, 0x1F8000, 0x1F8FFF, "Convergent Design", "CONVERGENT-DESIGN" },
-	{ 0x70B3D5, 0x4F8000, 0x4F8FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x92B000, 0x92BFFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
-	{ 0x70B3D5, 0xEA7000, 0xEA7FFF, "S.I.C.E.S. srl", "S-I-C-E-S-SRL" },
-	{ 0x70B3D5, 0xB13000, 0xB13FFF, "Omwave", "OMWAVE" },
-	{ 0x70B3D5, 0xEED000, 0xEEDFFF, "COMM-connect A/S", "COMM-CONNECT-A/S" },
-	{ 0x70B3D5, 0x826000, 0x826FFF, "Elbit Systems of America", "ELBIT-OF-AMERICA" },
-	{ 0x70B3D5, 0xB21000, 0xB21FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0xE3F000, 0xE3FFFF, "BESTCODE LLC", "BESTCODE-LLC" },
-	{ 0x70B3D5, 0xF75000, 0xF75FFF, "Enlaps", "ENLAPS" },
-	{ 0x70B3D5, 0xDF8000, 0xDF8FFF, "RMA Mess- und Regeltechnik GmbH & Co.KG", "RMA-MESS--UND-REGELTECHNIK" },
-	{ 0x70B3D5, 0xE7B000, 0xE7BFFF, "Shenzhen SanYeCao Electronics Co.,Ltd", "SHENZHEN-SANYECAO-ELECTRONICS" },
-	{ 0x70B3D5, 0x608000, 0x608FFF, "EIIT SA", "EIIT" },
-	{ 0x70B3D5, 0x841000, 0x841FFF, "Stanet Co.,Ltd", "STANET" },
-	{ 0x70B3D5, 0x9D5000, 0x9D5FFF, "Southern Tier Technologies", "SOUTHERN-TIER-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xFAE000, 0xFAEFFF, "Silixa Ltd", "SILIXA" },
-	{ 0x70B3D5, 0x19B000, 0x19BFFF, "Global Technical Systems", "GLOBAL-TECHNICAL" },
-	{ 0x70B3D5, 0x7FE000, 0x7FEFFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
+	{ 0x70B3D5, 0x29D000, 0x29DFFF, "XTech2 SIA", "XTECH2-SIA" },
+	{ 0x70B3D5, 0x29F000, 0x29FFFF, "Code Hardware SA", "CODE-HARDWARE" },
+	{ 0x70B3D5, 0x2A1000, 0x2A1FFF, "Blink Services AB", "BLINK-SERVICES-AB" },
+	{ 0x70B3D5, 0x2A2000, 0x2A2FFF, "Visualware, Inc.", "VISUALWARE" },
+	{ 0x70B3D5, 0x2A3000, 0x2A3FFF, "ATT Nussbaum Prüftechnik GmbH", "ATT-NUSSBAUM-PRUEFTECHNIK" },
+	{ 0x70B3D5, 0x2A4000, 0x2A4FFF, "GSP Sprachtechnologie GmbH", "GSP-SPRACHTECHNOLOGIE" },
+	{ 0x70B3D5, 0x2A5000, 0x2A5FFF, "Taitotekniikka", "TAITOTEKNIIKKA" },
+	{ 0x70B3D5, 0x2A7000, 0x2A7FFF, "Plasmability, LLC", "PLASMABILITY-LLC" },
+	{ 0x70B3D5, 0x2A8000, 0x2A8FFF, "Dynamic Perspective GmbH", "DYNAMIC-PERSPECTIVE" },
+	{ 0x70B3D5, 0x2A9000, 0x2A9FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
+	{ 0x70B3D5, 0x2AA000, 0x2AAFFF, "Flirtey Inc", "FLIRTEY" },
+	{ 0x70B3D5, 0x2AB000, 0x2ABFFF, "NASA Johnson Space Center", "NASA-JOHNSON-SPACE-CENTER" },
+	{ 0x70B3D5, 0x2AC000, 0x2ACFFF, "New Imaging Technologies", "NEW-IMAGING-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x2AD000, 0x2ADFFF, "Opgal Optronic Industries", "OPGAL-OPTRONIC-INDUSTRIES" },
+	{ 0x70B3D5, 0x2AE000, 0x2AEFFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
+	{ 0x70B3D5, 0x2B0000, 0x2B0FFF, "Beijing Zhongyi Yue Tai Technology Co., Ltd", "BEIJING-ZHONGYI-YUE-TAI" },
+	{ 0x70B3D5, 0x2B1000, 0x2B1FFF, "WIXCON Co., Ltd", "WIXCON" },
+	{ 0x70B3D5, 0x2B2000, 0x2B2FFF, "Sun Creative (ZheJiang) Technology INC.", "SUN-CREATIVE-ZHEJIANG" },
+	{ 0x70B3D5, 0x2B3000, 0x2B3FFF, "HAS co.,ltd.", "HAS" },
+	{ 0x70B3D5, 0x2B4000, 0x2B4FFF, "Foerster-Technik GmbH", "FOERSTER-TECHNIK" },
+	{ 0x70B3D5, 0x2B7000, 0x2B7FFF, "Matrix Orbital Corporation", "MATRIX-ORBITAL" },
+	{ 0x70B3D5, 0x2B9000, 0x2B9FFF, "BELECTRIC GmbH", "BELECTRIC" },
+	{ 0x70B3D5, 0x2BA000, 0x2BAFFF, "Active Brains", "ACTIVE-BRAINS" },
+	{ 0x70B3D5, 0x2BB000, 0x2BBFFF, "Automation Networks & Solutions LLC", "AUTOMATION-NETWORKS-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0x2BC000, 0x2BCFFF, "EQUIPOS DE TELECOMUNICACIÓN OPTOELECTRÓNICOS, S.A.", "EQUIPOS-DE-TELECOMUNICACIÓN-OPTOELECTRÓNICOS" },
+	{ 0x70B3D5, 0x2BD000, 0x2BDFFF, "mg-sensor GmbH", "MG-SENSOR" },
+	{ 0x70B3D5, 0x2BE000, 0x2BEFFF, "Coherent Logix, Inc.", "COHERENT-LOGIX" },
+	{ 0x70B3D5, 0x2BF000, 0x2BFFFF, "FOSHAN VOHOM", "FOSHAN-VOHOM" },
+	{ 0x70B3D5, 0x2C2000, 0x2C2FFF, "Quantum Detectors", "QUANTUM-DETECTORS" },
+	{ 0x70B3D5, 0x2C3000, 0x2C3FFF, "Proterra", "PROTERRA" },
+	{ 0x70B3D5, 0x2C9000, 0x2C9FFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
+	{ 0x70B3D5, 0x2CA000, 0x2CAFFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x2CC000, 0x2CCFFF, "WeWork Companies, Inc.", "WEWORK-COMPANIES" },
 	{ 0x70B3D5, 0x2CD000, 0x2CDFFF, "Korea Airports Corporation", "KOREA-AIRPORTS" },
-	{ 0x70B3D5, 0x566000, 0x566FFF, "Data Informs LLC", "DATA-INFORMS-LLC" },
-	{ 0x70B3D5, 0xB07000, 0xB07FFF, "Arrowvale Electronics", "ARROWVALE-ELECTRONICS" },
-	{ 0x70B3D5, 0x00D000, 0x00DFFF, "Scrona AG", "SCRONA" },
-	{ 0x70B3D5, 0x61D000, 0x61DFFF, "Telonic Berkeley Inc", "TELONIC-BERKELEY" },
-	{ 0x70B3D5, 0x278000, 0x278FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x8F7000, 0x8F7FFF, "I.E. Sevko A.V.", "I-E-SEVKO-A-V" },
-	{ 0x70B3D5, 0x7FD000, 0x7FDFFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x70B3D5, 0x7AB000, 0x7ABFFF, "Microgate Srl", "MICROGATE-SRL" },
-	{ 0x70B3D5, 0x813000, 0x813FFF, "Wavemed srl", "WAVEMED-SRL" },
-	{ 0x70B3D5, 0x03C000, 0x03CFFF, "Ultimate Software", "ULTIMATE-SOFTWARE" },
-	{ 0x70B3D5, 0xB3A000, 0xB3AFFF, "Adigitalmedia", "ADIGITALMEDIA" },
-	{ 0x70B3D5, 0xCFE000, 0xCFEFFF, "Secturion Systems", "SECTURION" },
-	{ 0x70B3D5, 0x904000, 0x904FFF, "PHB Eletronica Ltda.", "PHB-ELETRONICA-LTDA" },
-	{ 0x70B3D5, 0x555000, 0x555FFF, "SoftLab-NSK", "SOFTLAB-NSK" },
-	{ 0x70B3D5, 0xBA3000, 0xBA3FFF, "TIAMA", "TIAMA" },
-	{ 0x70B3D5, 0xFB7000, 0xFB7FFF, "SAICE", "SAICE" },
-	{ 0x70B3D5, 0xD5F000, 0xD5FFFF, "Core Balance Co., Ltd.", "CORE-BALANCE" },
-	{ 0x70B3D5, 0xD7E000, 0xD7EFFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x001BC5, 0x0BB000, 0x0BBFFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x70B3D5, 0x941000, 0x941FFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x70B3D5, 0x4AF000, 0x4AFFFF, "Agramkow Fluid Systems A/S", "AGRAMKOW-FLUID-A/S" },
-	{ 0x70B3D5, 0x70A000, 0x70AFFF, "PULLNET TECHNOLOGY, SA DE CV SSC1012302S73", "PULLNET-DE-CV-SSC1012302S73" },
-	{ 0x70B3D5, 0x93E000, 0x93EFFF, "Systems With Intelligence Inc.", "WITH-INTELLIGENCE" },
-	{ 0x70B3D5, 0xE0B000, 0xE0BFFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
-	{ 0x70B3D5, 0x6C1000, 0x6C1FFF, "Labtronik s.r.l.", "LABTRONIK-S-R-L" },
-	{ 0x70B3D5, 0xDB1000, 0xDB1FFF, "Biovigil Hygiene Technologies", "BIOVIGIL-HYGIENE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x87C000, 0x87CFFF, "Nautel Limited", "NAUTEL" },
-	{ 0x70B3D5, 0xD62000, 0xD62FFF, "Andasis Elektronik San. ve Tic. A.Ş.", "ANDASIS-ELEKTRONIK-SAN-VE-TIC-A-Ş" },
-	{ 0x70B3D5, 0x676000, 0x676FFF, "samwooeleco", "SAMWOOELECO" },
-	{ 0x70B3D5, 0x6B7000, 0x6B7FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x489000, 0x489FFF, "ard sa", "ARD" },
+	{ 0x70B3D5, 0x2CE000, 0x2CEFFF, "KDT", "KDT" },
+	{ 0x70B3D5, 0x2CF000, 0x2CFFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x2D0000, 0x2D0FFF, "ijin co.,ltd.", "IJIN" },
 	{ 0x70B3D5, 0x2D2000, 0x2D2FFF, "SHANGHAI IRISIAN OPTRONICS TECHNOLOGY CO.,LTD.", "SHANGHAI-IRISIAN-OPTRONICS" },
-	{ 0x70B3D5, 0x085000, 0x085FFF, "Human Systems Integration", "HUMAN-INTEGRATION" },
-	{ 0x70B3D5, 0x460000, 0x460FFF, "Guilin Tryin Technology Co.,Ltd", "GUILIN-TRYIN" },
-	{ 0x70B3D5, 0x5F2000, 0x5F2FFF, "Invisible Systems Limited", "INVISIBLE" },
-	{ 0x70B3D5, 0xC66000, 0xC66FFF, "Blue Access Inc", "BLUE-ACCESS" },
-	{ 0x70B3D5, 0x87D000, 0x87DFFF, "INVIXIUM ACCESS INC.", "INVIXIUM-ACCESS" },
-	{ 0x70B3D5, 0x5FA000, 0x5FAFFF, "TEX COMPUTER SRL", "TEX-SRL" },
-	{ 0x70B3D5, 0xA9F000, 0xA9FFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x985000, 0x985FFF, "Burk Technology", "BURK" },
+	{ 0x70B3D5, 0x2D4000, 0x2D4FFF, "CT Company", "CT-COMPANY" },
+	{ 0x70B3D5, 0x2D5000, 0x2D5FFF, "Teuco Guzzini", "TEUCO-GUZZINI" },
+	{ 0x70B3D5, 0x2D6000, 0x2D6FFF, "Kvazar LLC", "KVAZAR-LLC" },
+	{ 0x70B3D5, 0x2DA000, 0x2DAFFF, "Skywave Networks Private Limited", "SKYWAVE-NETWORKS-PRIVATE" },
+	{ 0x70B3D5, 0x2DB000, 0x2DBFFF, "ProtoPixel SL", "PROTOPIXEL-SL" },
+	{ 0x70B3D5, 0x2DC000, 0x2DCFFF, "Bolide Technology Group, Inc.", "BOLIDE-GROUP" },
+	{ 0x70B3D5, 0x2DE000, 0x2DEFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0x2E0000, 0x2E0FFF, "Peter Huber", "PETER-HUBER" },
+	{ 0x70B3D5, 0x2E2000, 0x2E2FFF, "Spark Lasers", "SPARK-LASERS" },
+	{ 0x70B3D5, 0x2E3000, 0x2E3FFF, "Meiknologic GmbH", "MEIKNOLOGIC" },
+	{ 0x70B3D5, 0x2E5000, 0x2E5FFF, "Fläkt Woods AB", "FLAEKT-WOODS-AB" },
+	{ 0x70B3D5, 0x2E7000, 0x2E7FFF, "Atos spa", "ATOS-SPA" },
+	{ 0x70B3D5, 0x2E8000, 0x2E8FFF, "Telefire", "TELEFIRE" },
+	{ 0x70B3D5, 0x2EA000, 0x2EAFFF, "Schneider Electric Motion", "SCHNEIDER-ELECTRIC-MOTION" },
+	{ 0x70B3D5, 0x2EB000, 0x2EBFFF, "BRNET CO.,LTD.", "BRNET" },
+	{ 0x70B3D5, 0x2EC000, 0x2ECFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0x2ED000, 0x2EDFFF, "Signals and systems india pvt ltd", "SIGNALS-AND-INDIA-PVT" },
+	{ 0x70B3D5, 0x2EE000, 0x2EEFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x2EF000, 0x2EFFFF, "IEM SA", "IEM" },
+	{ 0x70B3D5, 0x2F0000, 0x2F0FFF, "Clock-O-Matic", "CLOCK-O-MATIC" },
+	{ 0x70B3D5, 0x2F1000, 0x2F1FFF, "Inspike S.R.L.", "INSPIKE-S-R-L" },
+	{ 0x70B3D5, 0x2F2000, 0x2F2FFF, "Health Care Originals, Inc.", "HEALTH-CARE-ORIGINALS" },
+	{ 0x70B3D5, 0x2F3000, 0x2F3FFF, "Scame Sistemi srl", "SCAME-SISTEMI-SRL" },
+	{ 0x70B3D5, 0x2F4000, 0x2F4FFF, "Radixon s.r.o.", "RADIXON-S-R-O" },
+	{ 0x70B3D5, 0x2F5000, 0x2F5FFF, "eze System, Inc.", "EZE-SYSTEM" },
+	{ 0x70B3D5, 0x2F6000, 0x2F6FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x2F8000, 0x2F8FFF, "Tunstall A/S", "TUNSTALL-A/S" },
+	{ 0x70B3D5, 0x2F9000, 0x2F9FFF, "CONSOSPY", "CONSOSPY" },
+	{ 0x70B3D5, 0x2FA000, 0x2FAFFF, "Toray　Medical　Co.,Ltd", "TORAY　MEDICAL　" },
+	{ 0x70B3D5, 0x2FD000, 0x2FDFFF, "Special Projects Group, Inc", "SPECIAL-PROJECTS-GROUP" },
+	{ 0x70B3D5, 0x2FE000, 0x2FEFFF, "Yaham Optoelectronics Co., Ltd", "YAHAM-OPTOELECTRONICS" },
+	{ 0x70B3D5, 0x2FF000, 0x2FFFFF, "Sunstone Engineering", "SUNSTONE-ENGINEERING" },
+	{ 0x70B3D5, 0x300000, 0x300FFF, "Novo DR Ltd.", "NOVO-DR" },
+	{ 0x70B3D5, 0x302000, 0x302FFF, "DogWatch Inc", "DOGWATCH" },
+	{ 0x70B3D5, 0x303000, 0x303FFF, "Fuchu Giken, Inc.", "FUCHU-GIKEN" },
+	{ 0x70B3D5, 0x304000, 0x304FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
+	{ 0x70B3D5, 0x305000, 0x305FFF, "CAITRON Industrial Solutions GmbH", "CAITRON-INDUSTRIAL-SOLUTIONS" },
+	{ 0x70B3D5, 0x307000, 0x307FFF, "Energi innovation Aps", "ENERGI-INNOVATION-APS" },
+	{ 0x70B3D5, 0x308000, 0x308FFF, "DSD MICROTECHNOLOGY,INC.", "DSD-MICROTECHNOLOGY" },
+	{ 0x70B3D5, 0x30B000, 0x30BFFF, "Ash Technologies", "ASH-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x30C000, 0x30CFFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x30D000, 0x30DFFF, "Fiberbase", "FIBERBASE" },
 	{ 0x70B3D5, 0x30E000, 0x30EFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xFC8000, 0xFC8FFF, "Moduware PTY LTD", "MODUWARE-PTY" },
-	{ 0x70B3D5, 0x07B000, 0x07BFFF, "wallbe GmbH", "WALLBE" },
-	{ 0x70B3D5, 0x2CF000, 0x2CFFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x546000, 0x546FFF, "Sensefarm AB", "SENSEFARM-AB" },
-	{ 0x70B3D5, 0xB6A000, 0xB6AFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0xD2E000, 0xD2EFFF, "Coheros Oy", "COHEROS-OY" },
-	{ 0x70B3D5, 0xAC4000, 0xAC4FFF, "Lexi Devices, Inc.", "LEXI-DEVICES" },
-	{ 0x70B3D5, 0x85F000, 0x85FFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0x30F000, 0x30FFFF, "Cardinal Scales Manufacturing Co", "CARDINAL-SCALES-MANUFACTURING" },
+	{ 0x70B3D5, 0x313000, 0x313FFF, "DIEHL Controls", "DIEHL-CONTROLS" },
+	{ 0x70B3D5, 0x317000, 0x317FFF, "Iotopia Solutions", "IOTOPIA-SOLUTIONS" },
+	{ 0x70B3D5, 0x319000, 0x319FFF, "ISO/TC 22/SC 31", "ISO/TC-22/SC-31" },
+	{ 0x70B3D5, 0x31B000, 0x31BFFF, "SilTerra Malaysia Sdn. Bhd.", "SILTERRA-MALAYSIA-SDN-BHD" },
+	{ 0x70B3D5, 0x31C000, 0x31CFFF, "FINANCIERE DE L'OMBREE (eolane)", "FINANCIERE-DE-L-OMBREE-EOLANE" },
+	{ 0x70B3D5, 0x31E000, 0x31EFFF, "GILLAM-FEI S.A.", "GILLAM-FEI" },
+	{ 0x70B3D5, 0x323000, 0x323FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x324000, 0x324FFF, "Thales Nederland BV", "THALES-NEDERLAND" },
+	{ 0x70B3D5, 0x325000, 0x325FFF, "BlueMark Innovations BV", "BLUEMARK-INNOVATIONS" },
+	{ 0x70B3D5, 0x326000, 0x326FFF, "NEMEUS-SAS", "NEMEUS-SAS" },
+	{ 0x70B3D5, 0x327000, 0x327FFF, "Seneco A/S", "SENECO-A/S" },
+	{ 0x70B3D5, 0x328000, 0x328FFF, "HIPODROMO DE AGUA CALIENTE SA CV", "HIPODROMO-DE-AGUA-CALIENTE-CV" },
+	{ 0x70B3D5, 0x32A000, 0x32AFFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
+	{ 0x70B3D5, 0x32D000, 0x32DFFF, "Hanwell Technology Co., Ltd.", "HANWELL" },
+	{ 0x70B3D5, 0x32F000, 0x32FFFF, "Movidius SRL", "MOVIDIUS-SRL" },
+	{ 0x70B3D5, 0x332000, 0x332FFF, "InnoSenT", "INNOSENT" },
+	{ 0x70B3D5, 0x334000, 0x334FFF, "Dokuen Co. Ltd.", "DOKUEN" },
+	{ 0x70B3D5, 0x336000, 0x336FFF, "Synaccess Networks Inc.", "SYNACCESS-NETWORKS" },
+	{ 0x70B3D5, 0x338000, 0x338FFF, "Opti-Sciences, Inc.", "OPTI-SCIENCES" },
+	{ 0x70B3D5, 0x339000, 0x339FFF, "Sierra Nevada Corporation", "SIERRA-NEVADA" },
+	{ 0x70B3D5, 0x33B000, 0x33BFFF, "Seal Shield, LLC", "SEAL-SHIELD-LLC" },
+	{ 0x70B3D5, 0x33C000, 0x33CFFF, "Videri Inc.", "VIDERI" },
+	{ 0x70B3D5, 0x33E000, 0x33EFFF, "Dynamic Connect (Suzhou) Hi-Tech Electronic Co.,Ltd.", "DYNAMIC-CONNECT-SUZHOU-HI-TECH" },
+	{ 0x70B3D5, 0x340000, 0x340FFF, "Renesas Electronics", "RENESAS-ELECTRONICS" },
+	{ 0x70B3D5, 0x341000, 0x341FFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0x342000, 0x342FFF, "Solectrix", "SOLECTRIX" },
+	{ 0x70B3D5, 0x343000, 0x343FFF, "Elektro-System s.c.", "ELEKTRO-SYSTEM-S-C" },
+	{ 0x70B3D5, 0x344000, 0x344FFF, "IHI Inspection & Instrumentation Co., Ltd.", "IHI-INSPECTION-INSTRUMENTATION" },
+	{ 0x70B3D5, 0x346000, 0x346FFF, "Ultamation Limited", "ULTAMATION" },
+	{ 0x70B3D5, 0x347000, 0x347FFF, "OAS Sweden AB", "OAS-SWEDEN-AB" },
+	{ 0x70B3D5, 0x348000, 0x348FFF, "BÄR Bahnsicherung AG", "BAER-BAHNSICHERUNG" },
+	{ 0x70B3D5, 0x349000, 0x349FFF, "SLAT", "SLAT" },
+	{ 0x70B3D5, 0x34A000, 0x34AFFF, "PAVO TASARIM ÜRETİM TİC A.Ş.", "PAVO-TASARIM-UERETİM-TİC-A-Ş" },
+	{ 0x70B3D5, 0x34C000, 0x34CFFF, "GLT Exports Ltd", "GLT-EXPORTS" },
+	{ 0x70B3D5, 0x34E000, 0x34EFFF, "Risk Expert sarl", "RISK-EXPERT-SARL" },
+	{ 0x70B3D5, 0x350000, 0x350FFF, "Tickster AB", "TICKSTER-AB" },
+	{ 0x70B3D5, 0x351000, 0x351FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x352000, 0x352FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
+	{ 0x70B3D5, 0x353000, 0x353FFF, "Digital Outfit", "DIGITAL-OUTFIT" },
+	{ 0x70B3D5, 0x355000, 0x355FFF, "Hongin., Ltd", "HONGIN" },
+	{ 0x70B3D5, 0x357000, 0x357FFF, "Movimento Group AB", "MOVIMENTO-GROUP-AB" },
+	{ 0x70B3D5, 0x359000, 0x359FFF, "Boutronic", "BOUTRONIC" },
+	{ 0x70B3D5, 0x35A000, 0x35AFFF, "Applied Radar, Inc.", "APPLIED-RADAR" },
+	{ 0x70B3D5, 0x35C000, 0x35CFFF, "ACS electronics srl", "ACS-ELECTRONICS-SRL" },
+	{ 0x70B3D5, 0x35D000, 0x35DFFF, "Fresh Idea Factory BV", "FRESH-IDEA-FACTORY" },
+	{ 0x70B3D5, 0x35E000, 0x35EFFF, "EIDOS s.p.a.", "EIDOS-S-P-A" },
+	{ 0x70B3D5, 0x35F000, 0x35FFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x360000, 0x360FFF, "PT. Emsonic Indonesia", "PT-EMSONIC-INDONESIA" },
+	{ 0x70B3D5, 0x361000, 0x361FFF, "Parent Power", "PARENT-POWER" },
+	{ 0x70B3D5, 0x362000, 0x362FFF, "Asiga", "ASIGA" },
+	{ 0x70B3D5, 0x363000, 0x363FFF, "Contec DTx", "CONTEC-DTX" },
+	{ 0x70B3D5, 0x364000, 0x364FFF, "ADAMCZEWSKI elektronische Messtechnik GmbH", "ADAMCZEWSKI-ELEKTRONISCHE-MESSTECHNIK" },
+	{ 0x70B3D5, 0x365000, 0x365FFF, "CircuitMeter Inc.", "CIRCUITMETER" },
+	{ 0x70B3D5, 0x367000, 0x367FFF, "Living Water", "LIVING-WATER" },
+	{ 0x70B3D5, 0x368000, 0x368FFF, "White Matter LLC", "WHITE-MATTER-LLC" },
+	{ 0x70B3D5, 0x36A000, 0x36AFFF, "Becton Dickinson", "BECTON-DICKINSON" },
+	{ 0x70B3D5, 0x36C000, 0x36CFFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x36D000, 0x36DFFF, "Cyberteam Sp z o o", "CYBERTEAM-SP-Z-O-O" },
+	{ 0x70B3D5, 0x36F000, 0x36FFFF, "BuddyGuard GmbH", "BUDDYGUARD" },
+	{ 0x70B3D5, 0x370000, 0x370FFF, "Inphi Corporation", "INPHI" },
+	{ 0x70B3D5, 0x371000, 0x371FFF, "BEDEROV GmbH", "BEDEROV" },
+	{ 0x70B3D5, 0x374000, 0x374FFF, "OOO NPP Mars-Energo", "OOO-NPP-MARS-ENERGO" },
+	{ 0x70B3D5, 0x375000, 0x375FFF, "Adel System srl", "ADEL-SYSTEM-SRL" },
+	{ 0x70B3D5, 0x376000, 0x376FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x377000, 0x377FFF, "Monnit Corporation", "MONNIT" },
+	{ 0x70B3D5, 0x378000, 0x378FFF, "synchrotron SOLEIL", "SYNCHROTRON-SOLEIL" },
+	{ 0x70B3D5, 0x379000, 0x379FFF, "Vensi, Inc.", "VENSI" },
+	{ 0x70B3D5, 0x37A000, 0x37AFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0x37B000, 0x37BFFF, "Power Ltd.", "POWER" },
+	{ 0x70B3D5, 0x37C000, 0x37CFFF, "Merus Power Dynamics Ltd.", "MERUS-POWER-DYNAMICS" },
+	{ 0x70B3D5, 0x37D000, 0x37DFFF, "The DX Shop Limited", "THE-DX-SHOP" },
+	{ 0x70B3D5, 0x37F000, 0x37FFFF, "IDS Innomic GmbH", "IDS-INNOMIC" },
+	{ 0x70B3D5, 0x381000, 0x381FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x382000, 0x382FFF, "Naval Group", "NAVAL-GROUP" },
+	{ 0x70B3D5, 0x383000, 0x383FFF, "LPA Excil Electronics", "LPA-EXCIL-ELECTRONICS" },
+	{ 0x70B3D5, 0x384000, 0x384FFF, "Sensohive Technologies", "SENSOHIVE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x387000, 0x387FFF, "GWF MessSysteme AG", "GWF-MESSSYSTEME" },
+	{ 0x70B3D5, 0x389000, 0x389FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x38B000, 0x38BFFF, "Lookman Electroplast Industries Ltd", "LOOKMAN-ELECTROPLAST-INDUSTRIES" },
+	{ 0x70B3D5, 0x38C000, 0x38CFFF, "MiraeSignal Co., Ltd", "MIRAESIGNAL" },
+	{ 0x70B3D5, 0x38F000, 0x38FFFF, "Sorynorydotcom Inc", "SORYNORYDOTCOM" },
+	{ 0x70B3D5, 0x392000, 0x392FFF, "Contec DTx", "CONTEC-DTX" },
+	{ 0x70B3D5, 0x396000, 0x396FFF, "CTG sp. z o. o.", "CTG-SP-Z-O-O" },
+	{ 0x70B3D5, 0x397000, 0x397FFF, "Guangxi Hunter Information Industry Co.,Ltd", "GUANGXI-HUNTER-INFORMATION-INDUSTRY" },
+	{ 0x70B3D5, 0x39A000, 0x39AFFF, "Videotrend srl", "VIDEOTREND-SRL" },
+	{ 0x70B3D5, 0x39B000, 0x39BFFF, "IROC AB", "IROC-AB" },
+	{ 0x70B3D5, 0x39C000, 0x39CFFF, "GD Mission Systems", "GD-MISSION" },
+	{ 0x70B3D5, 0x39D000, 0x39DFFF, "Comark Interactive Solutions", "COMARK-INTERACTIVE-SOLUTIONS" },
+	{ 0x70B3D5, 0x39E000, 0x39EFFF, "Lanmark Controls Inc.", "LANMARK-CONTROLS" },
+	{ 0x70B3D5, 0x3A0000, 0x3A0FFF, "chiconypower", "CHICONYPOWER" },
+	{ 0x70B3D5, 0x3A1000, 0x3A1FFF, "Reckeen HDP Media sp. z o.o. sp. k.", "RECKEEN-HDP-MEDIA-SP-Z-O-O-SP-K" },
+	{ 0x70B3D5, 0x3A4000, 0x3A4FFF, "Ascenix Corporation", "ASCENIX" },
+	{ 0x70B3D5, 0x3A5000, 0x3A5FFF, "KMtronic ltd", "KMTRONIC" },
+	{ 0x70B3D5, 0x3A7000, 0x3A7FFF, "Varikorea", "VARIKOREA" },
+	{ 0x70B3D5, 0x3A8000, 0x3A8FFF, "JamHub Corp.", "JAMHUB" },
+	{ 0x70B3D5, 0x3A9000, 0x3A9FFF, "Vivalnk", "VIVALNK" },
+	{ 0x70B3D5, 0x3AA000, 0x3AAFFF, "RCATSONE", "RCATSONE" },
+	{ 0x70B3D5, 0x3AD000, 0x3ADFFF, "CT Company", "CT-COMPANY" },
+	{ 0x70B3D5, 0x3AE000, 0x3AEFFF, "Exicom Technologies fze", "EXICOM-TECHNOLOGIES-FZE" },
+	{ 0x70B3D5, 0x3AF000, 0x3AFFFF, "Turbo Technologies Corporation", "TURBO-TECHNOLOGIES" },
 	{ 0x70B3D5, 0x3B0000, 0x3B0FFF, "Millennial Net, Inc.", "MILLENNIAL-NET" },
-	{ 0x70B3D5, 0x23F000, 0x23FFFF, "ETA-USA", "ETA-USA" },
-	{ 0x70B3D5, 0xF70000, 0xF70FFF, "Honeywell", "HONEYWELL" },
-	{ 0x70B3D5, 0x948000, 0x948FFF, "VISION SYSTEMS AURTOMOTIVE (SAFETY TECH)", "VISION-AURTOMOTIVE-SAFETY-TECH" },
+	{ 0x70B3D5, 0x3B2000, 0x3B2FFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x3B5000, 0x3B5FFF, "Preston Industries dba PolyScience", "PRESTON-INDUSTRIES-DBA-POLYSCIENCE" },
+	{ 0x70B3D5, 0x3B7000, 0x3B7FFF, "Paul Scherrer Institut (PSI)", "PAUL-SCHERRER-INSTITUT-PSI" },
+	{ 0x70B3D5, 0x3B8000, 0x3B8FFF, "nVideon, Inc.", "NVIDEON" },
+	{ 0x70B3D5, 0x3BA000, 0x3BAFFF, "Silex Inside", "SILEX-INSIDE" },
+	{ 0x70B3D5, 0x3BB000, 0x3BBFFF, "A-M Systems", "A-M" },
+	{ 0x70B3D5, 0x3BC000, 0x3BCFFF, "SciTronix", "SCITRONIX" },
+	{ 0x70B3D5, 0x3BE000, 0x3BEFFF, "MyDefence Communication ApS", "MYDEFENCE-COMMUNICATION-APS" },
+	{ 0x70B3D5, 0x3BF000, 0x3BFFFF, "Star Electronics GmbH & Co. KG", "STAR-ELECTRONICS" },
+	{ 0x70B3D5, 0x3C0000, 0x3C0FFF, "DK-Technologies A/S", "DK-TECHNOLOGIES-A/S" },
+	{ 0x70B3D5, 0x3C2000, 0x3C2FFF, "Cellular Specialties, Inc.", "CELLULAR-SPECIALTIES" },
+	{ 0x70B3D5, 0x3C3000, 0x3C3FFF, "AIMCO", "AIMCO" },
+	{ 0x70B3D5, 0x3C4000, 0x3C4FFF, "Hagiwara Solutions Co., Ltd.", "HAGIWARA-SOLUTIONS" },
+	{ 0x70B3D5, 0x3C5000, 0x3C5FFF, "P4Q ELECTRONICS, S.L.", "P4Q-ELECTRONICS-S-L" },
+	{ 0x70B3D5, 0x3C6000, 0x3C6FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
+	{ 0x70B3D5, 0x3C7000, 0x3C7FFF, "SOFTCREATE CORP.", "SOFTCREATE" },
+	{ 0x70B3D5, 0x3C9000, 0x3C9FFF, "Duerkopp-Adler", "DUERKOPP-ADLER" },
+	{ 0x70B3D5, 0x3CA000, 0x3CAFFF, "TTI Ltd", "TTI" },
+	{ 0x70B3D5, 0x3CC000, 0x3CCFFF, "TerOpta Ltd", "TEROPTA" },
+	{ 0x70B3D5, 0x3CE000, 0x3CEFFF, "Aditec GmbH", "ADITEC" },
+	{ 0x70B3D5, 0x3CF000, 0x3CFFFF, "Systems Engineering Arts Pty Ltd", "ENGINEERING-ARTS-PTY" },
+	{ 0x70B3D5, 0x3D2000, 0x3D2FFF, "Imagine Inc.", "IMAGINE" },
+	{ 0x70B3D5, 0x3D4000, 0x3D4FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
+	{ 0x70B3D5, 0x3D5000, 0x3D5FFF, "oxynet Solutions", "OXYNET-SOLUTIONS" },
+	{ 0x70B3D5, 0x3D7000, 0x3D7FFF, "Remote Sensing Solutions, Inc.", "REMOTE-SENSING-SOLUTIONS" },
+	{ 0x70B3D5, 0x3D8000, 0x3D8FFF, "Abitsoftware, Ltd.", "ABITSOFTWARE" },
+	{ 0x70B3D5, 0x3D9000, 0x3D9FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x3DA000, 0x3DAFFF, "Loop Labs, Inc.", "LOOP-LABS" },
+	{ 0x70B3D5, 0x3DB000, 0x3DBFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x3DE000, 0x3DEFFF, "ELOMAC Elektronik GmbH", "ELOMAC-ELEKTRONIK" },
+	{ 0x70B3D5, 0x3DF000, 0x3DFFFF, "MultiDyne", "MULTIDYNE" },
+	{ 0x70B3D5, 0x3E1000, 0x3E1FFF, "Barnstormer Softworks", "BARNSTORMER-SOFTWORKS" },
+	{ 0x70B3D5, 0x3E2000, 0x3E2FFF, "AVI Pty Ltd", "AVI-PTY" },
+	{ 0x70B3D5, 0x3E3000, 0x3E3FFF, "Head", "HEAD" },
+	{ 0x70B3D5, 0x3E4000, 0x3E4FFF, "Neptec Technologies Corp.", "NEPTEC-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x3E5000, 0x3E5FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0x3E6000, 0x3E6FFF, "machineQ", "MACHINEQ" },
+	{ 0x70B3D5, 0x3E8000, 0x3E8FFF, "COSMOS web Co., Ltd.", "COSMOS-WEB" },
+	{ 0x70B3D5, 0x3E9000, 0x3E9FFF, "APOLLO GIKEN Co.,Ltd.", "APOLLO-GIKEN" },
+	{ 0x70B3D5, 0x3ED000, 0x3EDFFF, "Ultra Electronics Sonar System Division", "ULTRA-ELECTRONICS-SONAR-SYSTEM-DIVISION" },
+	{ 0x70B3D5, 0x3EF000, 0x3EFFFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0x3F0000, 0x3F0FFF, "Intervala", "INTERVALA" },
+	{ 0x70B3D5, 0x3F1000, 0x3F1FFF, "Olympus NDT Canada", "OLYMPUS-NDT-CANADA" },
+	{ 0x70B3D5, 0x3F2000, 0x3F2FFF, "H3D, Inc.", "H3D" },
+	{ 0x70B3D5, 0x3F3000, 0x3F3FFF, "SPEA SPA", "SPEA-SPA" },
+	{ 0x70B3D5, 0x3F4000, 0x3F4FFF, "Wincode Technology Co., Ltd.", "WINCODE" },
+	{ 0x70B3D5, 0x3F5000, 0x3F5FFF, "DOLBY LABORATORIES, INC.", "DOLBY-LABORATORIES" },
+	{ 0x70B3D5, 0x3F6000, 0x3F6FFF, "Sycomp Electronic GmbH", "SYCOMP" },
+	{ 0x70B3D5, 0x3F7000, 0x3F7FFF, "Advansid", "ADVANSID" },
+	{ 0x70B3D5, 0x3F9000, 0x3F9FFF, "Herrick Tech Labs", "HERRICK-TECH-LABS" },
+	{ 0x70B3D5, 0x3FA000, 0x3FAFFF, "Zaklad Energoelektroniki Twerd", "ZAKLAD-ENERGOELEKTRONIKI-TWERD" },
+	{ 0x70B3D5, 0x3FE000, 0x3FEFFF, "Mentor Graphics", "MENTOR-GRAPHICS" },
+	{ 0x70B3D5, 0x3FF000, 0x3FFFFF, "Hydra Controls", "HYDRA-CONTROLS" },
+	{ 0x70B3D5, 0x400000, 0x400FFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0x401000, 0x401FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x402000, 0x402FFF, "AKIS technologies", "AKIS-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x403000, 0x403FFF, "Mighty Cube Co., Ltd.", "MIGHTY-CUBE" },
+	{ 0x70B3D5, 0x404000, 0x404FFF, "RANIX,Inc.", "RANIX" },
+	{ 0x70B3D5, 0x405000, 0x405FFF, "MG s.r.l.", "MG-S-R-L" },
+	{ 0x70B3D5, 0x406000, 0x406FFF, "Acrodea, Inc.", "ACRODEA" },
+	{ 0x70B3D5, 0x407000, 0x407FFF, "IDOSENS", "IDOSENS" },
+	{ 0x70B3D5, 0x408000, 0x408FFF, "Comrod AS", "COMROD-AS" },
+	{ 0x70B3D5, 0x40A000, 0x40AFFF, "Monroe Electronics, Inc.", "MONROE-ELECTRONICS" },
+	{ 0x70B3D5, 0x40E000, 0x40EFFF, "Liaoyun Information Technology Co., Ltd.", "LIAOYUN-INFORMATION" },
+	{ 0x70B3D5, 0x410000, 0x410FFF, "Avant Technologies, Inc", "AVANT-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x412000, 0x412FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x413000, 0x413FFF, "Axess AG", "AXESS" },
 	{ 0x70B3D5, 0x415000, 0x415FFF, "IDEA SPA", "IDEA-SPA" },
-	{ 0x70B3D5, 0xEB4000, 0xEB4FFF, "Robotic Research, LLC", "ROBOTIC-RESEARCH-LLC" },
-	{ 0x70B3D5, 0x471000, 0x471FFF, "SYSCO Sicherheitssysteme GmbH", "SYSCO-SICHERHEITSSYSTEME" },
-	{ 0x70B3D5, 0x66A000, 0x66AFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x868000, 0x868FFF, "U-JIN Mesco Co., Ltd.", "U-JIN-MESCO" },
-	{ 0x70B3D5, 0x707000, 0x707FFF, "Koco Motion US LLC", "KOCO-MOTION-US-LLC" },
-	{ 0x70B3D5, 0x0F7000, 0x0F7FFF, "Bespoon", "BESPOON" },
-	{ 0x70B3D5, 0x82D000, 0x82DFFF, "Elektronik Art S.C.", "ELEKTRONIK-ART-S-C" },
-	{ 0x70B3D5, 0x1DC000, 0x1DCFFF, "TEKVEL Ltd.", "TEKVEL" },
-	{ 0x70B3D5, 0x5A5000, 0x5A5FFF, "Rehwork GmbH", "REHWORK" },
-	{ 0x70B3D5, 0x2A8000, 0x2A8FFF, "Dynamic Perspective GmbH", "DYNAMIC-PERSPECTIVE" },
+	{ 0x70B3D5, 0x417000, 0x417FFF, "Figment Design Laboratories", "FIGMENT-DESIGN-LABORATORIES" },
+	{ 0x70B3D5, 0x418000, 0x418FFF, "DEV Systemtechnik GmbH& Co KG", "DEV-SYSTEMTECHNIK" },
+	{ 0x70B3D5, 0x41A000, 0x41AFFF, "HYOSUNG Power & Industrial Systems", "HYOSUNG-POWER-INDUSTRIAL" },
+	{ 0x70B3D5, 0x41E000, 0x41EFFF, "Redler Computers", "REDLER-COMPUTERS" },
+	{ 0x70B3D5, 0x421000, 0x421FFF, "North Star Bestech Co.,", "NORTH-STAR-BESTECH" },
+	{ 0x70B3D5, 0x426000, 0x426FFF, "Zehnder Group Nederland", "ZEHNDER-GROUP-NEDERLAND" },
+	{ 0x70B3D5, 0x427000, 0x427FFF, "Key Chemical & Equipment Company", "KEY-CHEMICAL-EQUIPMENT-COMPANY" },
+	{ 0x70B3D5, 0x428000, 0x428FFF, "Presentation Switchers, Inc.", "PRESENTATION-SWITCHERS" },
+	{ 0x70B3D5, 0x429000, 0x429FFF, "Redco Audio Inc", "REDCO-AUDIO" },
+	{ 0x70B3D5, 0x42A000, 0x42AFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0x42C000, 0x42CFFF, "D.Marchiori Srl", "D-MARCHIORI-SRL" },
+	{ 0x70B3D5, 0x42D000, 0x42DFFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
+	{ 0x70B3D5, 0x42E000, 0x42EFFF, "Dr. Zinngrebe GmbH", "DR-ZINNGREBE" },
+	{ 0x70B3D5, 0x42F000, 0x42FFFF, "SINTOKOGIO, LTD", "SINTOKOGIO" },
+	{ 0x70B3D5, 0x430000, 0x430FFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
+	{ 0x70B3D5, 0x431000, 0x431FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
+	{ 0x70B3D5, 0x432000, 0x432FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x433000, 0x433FFF, "Flexsolution APS", "FLEXSOLUTION-APS" },
+	{ 0x70B3D5, 0x434000, 0x434FFF, "Wit.com Inc", "WIT-COM" },
+	{ 0x70B3D5, 0x435000, 0x435FFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
+	{ 0x70B3D5, 0x436000, 0x436FFF, "Henrich Electronics Corporation", "HENRICH-ELECTRONICS" },
+	{ 0x70B3D5, 0x437000, 0x437FFF, "Digital Way", "DIGITAL-WAY" },
+	{ 0x70B3D5, 0x439000, 0x439FFF, "TriLED", "TRILED" },
+	{ 0x70B3D5, 0x43B000, 0x43BFFF, "Kalycito Infotech Private Limited", "KALYCITO-INFOTECH-PRIVATE" },
+	{ 0x70B3D5, 0x43D000, 0x43DFFF, "Veryx Technologies Private Limited", "VERYX-TECHNOLOGIES-PRIVATE" },
+	{ 0x70B3D5, 0x43E000, 0x43EFFF, "Peloton Technology", "PELOTON" },
 	{ 0x70B3D5, 0x43F000, 0x43FFFF, "biosilver .co.,ltd", "BIOSILVER" },
-	{ 0x70B3D5, 0xB4D000, 0xB4DFFF, "Avidbots Corporation", "AVIDBOTS" },
-	{ 0x70B3D5, 0xA9C000, 0xA9CFFF, "Veo Technologies", "VEO-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x9DF000, 0x9DFFFF, "DOBE Computing", "DOBE-COMPUTING" },
-	{ 0x70B3D5, 0x293000, 0x293FFF, "Solar RIg Technologies", "SOLAR-RIG-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x3D4000, 0x3D4FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
-	{ 0x70B3D5, 0xB0F000, 0xB0FFFF, "merkur Funksysteme AG", "MERKUR-FUNKSYSTEME" },
-	{ 0x70B3D5, 0x76C000, 0x76CFFF, "Aural Ltd", "AURAL" },
-	{ 0x70B3D5, 0xE32000, 0xE32FFF, "HERUTU ELECTRONICS CORPORATION", "HERUTU-ELECTRONICS" },
-	{ 0x70B3D5, 0x6B8000, 0x6B8FFF, "BT9", "BT9" },
-	{ 0x70B3D5, 0xAF8000, 0xAF8FFF, "boekel", "BOEKEL" },
-	{ 0x70B3D5, 0xF7C000, 0xF7CFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0xB6B000, 0xB6BFFF, "Cambria Corporation", "CAMBRIA" },
-	{ 0x70B3D5, 0x9F9000, 0x9F9FFF, "Fluid Components Intl", "FLUID-COMPONENTS-INTL" },
-	{ 0x70B3D5, 0x6D2000, 0x6D2FFF, "Ahrens & Birner Company GmbH", "AHRENS-BIRNER-COMPANY" },
-	{ 0x70B3D5, 0x977000, 0x977FFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xFC0000, 0xFC0FFF, "CODESYSTEM Co.,Ltd", "CODESYSTEM" },
-	{ 0x70B3D5, 0x718000, 0x718FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0x403000, 0x403FFF, "Mighty Cube Co., Ltd.", "MIGHTY-CUBE" },
-	{ 0x70B3D5, 0x7F9000, 0x7F9FFF, "Communication Systems Solutions", "COMMUNICATION-SOLUTIONS" },
-	{ 0x70B3D5, 0x1E8000, 0x1E8FFF, "Gogo BA", "GOGO-BA" },
-	{ 0x70B3D5, 0x376000, 0x376FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x3FA000, 0x3FAFFF, "Zaklad Energoelektroniki Twerd", "ZAKLAD-ENERGOELEKTRONIKI-TWERD" },
+	{ 0x70B3D5, 0x440000, 0x440FFF, "Discover Video", "DISCOVER-VIDEO" },
+	{ 0x70B3D5, 0x441000, 0x441FFF, "Videoport S.A.", "VIDEOPORT" },
+	{ 0x70B3D5, 0x442000, 0x442FFF, "Blair Companies", "BLAIR-COMPANIES" },
+	{ 0x70B3D5, 0x443000, 0x443FFF, "Slot3 GmbH", "SLOT3" },
+	{ 0x70B3D5, 0x445000, 0x445FFF, "Advanced Devices SpA", "ADVANCED-DEVICES-SPA" },
+	{ 0x70B3D5, 0x446000, 0x446FFF, "Santa Barbara Imaging Systems", "SANTA-BARBARA-IMAGING" },
+	{ 0x70B3D5, 0x448000, 0x448FFF, "B/E Aerospace, Inc.", "B/E-AEROSPACE" },
+	{ 0x70B3D5, 0x44B000, 0x44BFFF, "Open System Solutions Limited", "OPEN-SYSTEM-SOLUTIONS" },
+	{ 0x70B3D5, 0x44E000, 0x44EFFF, "Solace Systems Inc.", "SOLACE" },
+	{ 0x70B3D5, 0x455000, 0x455FFF, "Heartlandmicropayments", "HEARTLANDMICROPAYMENTS" },
+	{ 0x70B3D5, 0x457000, 0x457FFF, "Vivaldi Clima Srl", "VIVALDI-CLIMA-SRL" },
+	{ 0x70B3D5, 0x459000, 0x459FFF, "Protium Technologies, Inc.", "PROTIUM-TECHNOLOGIES" },
 	{ 0x70B3D5, 0x45B000, 0x45BFFF, "KOMZ - IZMERENIYA", "KOMZ---IZMERENIYA" },
-	{ 0x70B3D5, 0xDA3000, 0xDA3FFF, "Voleatech GmbH", "VOLEATECH" },
-	{ 0x70B3D5, 0x990000, 0x990FFF, "Energy Wall", "ENERGY-WALL" },
-	{ 0x70B3D5, 0x8BB000, 0x8BBFFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0xBD6000, 0xBD6FFF, "Consarc Corporation", "CONSARC" },
-	{ 0x70B3D5, 0xBC4000, 0xBC4FFF, "Digital Media Professionals", "DIGITAL-MEDIA-PROFESSIONALS" },
-	{ 0x70B3D5, 0xD01000, 0xD01FFF, "Vision4ce Ltd", "VISION4CE" },
-	{ 0x70B3D5, 0x59B000, 0x59BFFF, "AUTOMATIZACION Y CONECTIVIDAD SA DE CV", "AUTOMATIZACION-Y-CONECTIVIDAD-DE-CV" },
-	{ 0x70B3D5, 0xF18000, 0xF18FFF, "HD Vision Systems GmbH", "HD-VISION" },
-	{ 0x70B3D5, 0x003000, 0x003FFF, "ANYROAM", "ANYROAM" },
-	{ 0x70B3D5, 0x08C000, 0x08CFFF, "Airmar Technology Corp", "AIRMAR" },
-	{ 0x70B3D5, 0x048000, 0x048FFF, "AvMap srlu", "AVMAP-SRLU" },
-	{ 0x70B3D5, 0x512000, 0x512FFF, "Techno Broad,Inc", "TECHNO-BROAD" },
-	{ 0x70B3D5, 0x926000, 0x926FFF, "Advice", "ADVICE" },
-	{ 0x70B3D5, 0x66B000, 0x66BFFF, "Innitive B.V.", "INNITIVE" },
-	{ 0x70B3D5, 0x8F6000, 0x8F6FFF, "Dofuntech Co.,LTD.", "DOFUNTECH" },
-	{ 0x70B3D5, 0xA06000, 0xA06FFF, "Kopis Mobile LLC", "KOPIS-MOBILE-LLC" },
-	{ 0x70B3D5, 0x679000, 0x679FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x001BC5, 0x042000, 0x042FFF, "ChamSys Ltd", "CHAMSYS" },
-	{ 0x70B3D5, 0x2F9000, 0x2F9FFF, "CONSOSPY", "CONSOSPY" },
-	{ 0x70B3D5, 0xBB8000, 0xBB8FFF, "Al Kamel Systems S.L.", "AL-KAMEL-S-L" },
-	{ 0x70B3D5, 0x439000, 0x439FFF, "TriLED", "TRILED" },
-	{ 0x70B3D5, 0xE48000, 0xE48FFF, "TDI. Co., LTD", "TDI" },
-	{ 0x70B3D5, 0x18D000, 0x18DFFF, "Foro Tel", "FORO-TEL" },
-	{ 0x70B3D5, 0xA95000, 0xA95FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x570000, 0x570FFF, "Bayern Engineering GmbH & Co. KG", "BAYERN-ENGINEERING" },
-	{ 0x70B3D5, 0x524000, 0x524FFF, "Wuxi New Optical Communication Co.,Ltd.", "WUXI-NEW-OPTICAL-COMMUNICATION" },
-	{ 0x70B3D5, 0xDE0000, 0xDE0FFF, "eCozy GmbH", "ECOZY" },
-	{ 0x70B3D5, 0xC26000, 0xC26FFF, "Triple Play Communications", "TRIPLE-PLAY-COMMUNICATION" },
-	{ 0x70B3D5, 0x91F000, 0x91FFFF, "JSC InformInvestGroup", "JSC-INFORMINVESTGROUP" },
-	{ 0x70B3D5, 0x3E9000, 0x3E9FFF, "APOLLO GIKEN Co.,Ltd.", "APOLLO-GIKEN" },
-	{ 0x70B3D5, 0x773000, 0x773FFF, "Rugged Science", "RUGGED-SCIENCE" },
-	{ 0x70B3D5, 0x7AA000, 0x7AAFFF, "Sadel S.p.A.", "SADEL-S-P-A" },
-	{ 0x70B3D5, 0x6FB000, 0x6FBFFF, "Shachihata Inc.", "SHACHIHATA" },
-	{ 0x70B3D5, 0xD73000, 0xD73FFF, "ERMINE Corporation", "ERMINE" },
-	{ 0x70B3D5, 0xD3F000, 0xD3FFFF, "GLOBALCOM ENGINEERING SPA", "GLOBALCOM-ENGINEERING-SPA" },
-	{ 0x70B3D5, 0xDF7000, 0xDF7FFF, "Refecor Oy", "REFECOR-OY" },
-	{ 0x70B3D5, 0x152000, 0x152FFF, "Xped Corporation Pty Ltd", "XPED-PTY" },
-	{ 0x70B3D5, 0x59D000, 0x59DFFF, "servicios de consultoria independiente S.L.", "SERVICIOS-DE-CONSULTORIA-INDEPENDIENTE-S-L" },
-	{ 0x70B3D5, 0x933000, 0x933FFF, "SARL S@TIS", "SARL-S@TIS" },
-	{ 0x70B3D5, 0x7F2000, 0x7F2FFF, "TCI", "TCI" },
-	{ 0x70B3D5, 0xE4B000, 0xE4BFFF, "DELTA", "DELTA" },
-	{ 0x70B3D5, 0x2EA000, 0x2EAFFF, "Schneider Electric Motion", "SCHNEIDER-ELECTRIC-MOTION" },
-	{ 0x70B3D5, 0x5FC000, 0x5FCFFF, "SURTEC", "SURTEC" },
-	{ 0x70B3D5, 0x328000, 0x328FFF, "HIPODROMO DE AGUA CALIENTE SA CV", "HIPODROMO-DE-AGUA-CALIENTE-CV" },
-	{ 0x70B3D5, 0xF85000, 0xF85FFF, "Solystic", "SOLYSTIC" },
-	{ 0x70B3D5, 0xA04000, 0xA04FFF, "Galea Electric S.L.", "GALEA-ELECTRIC-S-L" },
-	{ 0x70B3D5, 0x6BE000, 0x6BEFFF, "VANTAGE INTEGRATED SECURITY SOLUTIONS PVT LTD", "VANTAGE-INTEGRATED-SECURITY-SOLUTIONS-PVT" },
-	{ 0x70B3D5, 0xA01000, 0xA01FFF, "FeldTech GmbH", "FELDTECH" },
-	{ 0x70B3D5, 0x7C1000, 0x7C1FFF, "Data Sciences International", "DATA-SCIENCES" },
-	{ 0x70B3D5, 0x903000, 0x903FFF, "Cymtec Ltd", "CYMTEC" },
-	{ 0x70B3D5, 0x1A0000, 0x1A0FFF, "UFATECH LTD", "UFATECH" },
-	{ 0x70B3D5, 0xEA4000, 0xEA4FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x1AD000, 0x1ADFFF, "Techworld Industries Ltd", "TECHWORLD-INDUSTRIES" },
-	{ 0x70B3D5, 0x866000, 0x866FFF, "MEPS Realtime", "MEPS-REALTIME" },
-	{ 0x70B3D5, 0x3D8000, 0x3D8FFF, "Abitsoftware, Ltd.", "ABITSOFTWARE" },
-	{ 0x70B3D5, 0x230000, 0x230FFF, "CT Company", "CT-COMPANY" },
-	{ 0x70B3D5, 0xFCD000, 0xFCDFFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x07E000, 0x07EFFF, "ENTEC Electric & Electronic CO., LTD", "ENTEC-ELECTRIC" },
-	{ 0x70B3D5, 0x664000, 0x664FFF, "Sankyo Intec co.,ltd", "SANKYO-INTEC" },
-	{ 0x70B3D5, 0x4BA000, 0x4BAFFF, "Sinftech LLC", "SINFTECH-LLC" },
-	{ 0x70B3D5, 0x3FF000, 0x3FFFFF, "Hydra Controls", "HYDRA-CONTROLS" },
+	{ 0x70B3D5, 0x45C000, 0x45CFFF, "AlyTech", "ALYTECH" },
+	{ 0x70B3D5, 0x45D000, 0x45DFFF, "Sensapex Oy", "SENSAPEX-OY" },
+	{ 0x70B3D5, 0x45E000, 0x45EFFF, "eSOL Co.,Ltd.", "ESOL" },
+	{ 0x70B3D5, 0x45F000, 0x45FFFF, "Cloud4Wi", "CLOUD4WI" },
+	{ 0x70B3D5, 0x460000, 0x460FFF, "Guilin Tryin Technology Co.,Ltd", "GUILIN-TRYIN" },
+	{ 0x70B3D5, 0x461000, 0x461FFF, "TESEC Corporation", "TESEC" },
+	{ 0x70B3D5, 0x462000, 0x462FFF, "EarTex", "EARTEX" },
+	{ 0x70B3D5, 0x465000, 0x465FFF, "ENERGISME", "ENERGISME" },
+	{ 0x70B3D5, 0x469000, 0x469FFF, "Gentec Systems Co.", "GENTEC" },
+	{ 0x70B3D5, 0x46B000, 0x46BFFF, "Airborne Engineering Limited", "AIRBORNE-ENGINEERING" },
+	{ 0x70B3D5, 0x46C000, 0x46CFFF, "SHANGHAI CHENZHU INSTRUMENT CO., LTD.", "SHANGHAI-CHENZHU-INSTRUMENT" },
+	{ 0x70B3D5, 0x46F000, 0x46FFFF, "serva transport systems GmbH", "SERVA-TRANSPORT" },
 	{ 0x70B3D5, 0x470000, 0x470FFF, "KITRON UAB", "KITRON-UAB" },
-	{ 0x70B3D5, 0x52B000, 0x52BFFF, "GE Aviation Cheltenham", "GE-AVIATION-CHELTENHAM" },
-	{ 0x70B3D5, 0x87B000, 0x87BFFF, "Liquid Instruments Pty Ltd", "LIQUID-INSTRUMENTS-PTY" },
-	{ 0x70B3D5, 0x5B0000, 0x5B0FFF, "Qxperts Italia S.r.l.", "QXPERTS-ITALIA-S-R-L" },
-	{ 0x70B3D5, 0x435000, 0x435FFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
-	{ 0x70B3D5, 0x0CD000, 0x0CDFFF, "AML Oceanographic", "AML-OCEANOGRAPHIC" },
-	{ 0x70B3D5, 0x6B3000, 0x6B3FFF, "DuraComm Corporation", "DURACOMM" },
-	{ 0x70B3D5, 0xF36000, 0xF36FFF, "dinosys", "DINOSYS" },
-	{ 0x70B3D5, 0xAC9000, 0xAC9FFF, "Trinity Solutions LLC", "TRINITY-SOLUTIONS-LLC" },
-	{ 0x70B3D5, 0x0A6000, 0x0A6FFF, "PA CONSULTING SERVICES", "PA-CONSULTING-SERVICES" },
-	{ 0x70B3D5, 0xB8B000, 0xB8BFFF, "Profound Medical Inc.", "PROFOUND-MEDICAL" },
-	{ 0x70B3D5, 0x1A5000, 0x1A5FFF, "METRONIC APARATURA KONTROLNO - POMIAROWA", "METRONIC-APARATURA-KONTROLNO---POMIAROWA" },
-	{ 0x70B3D5, 0xA1C000, 0xA1CFFF, "MECA SYSTEM", "MECA-SYSTEM" },
-	{ 0x70B3D5, 0xAD6000, 0xAD6FFF, "Lemonade Lab Inc", "LEMONADE-LAB" },
-	{ 0x70B3D5, 0xD87000, 0xD87FFF, "Zigen Corp", "ZIGEN" },
-	{ 0x70B3D5, 0x589000, 0x589FFF, "Cityntel OU", "CITYNTEL-OU" },
-	{ 0x70B3D5, 0x82E000, 0x82EFFF, "PlayAlive A/S", "PLAYALIVE-A/S" },
-	{ 0x70B3D5, 0x00E000, 0x00EFFF, "Magosys Systems LTD", "MAGOSYS" },
-	{ 0x70B3D5, 0xC3C000, 0xC3CFFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0xFE8000, 0xFE8FFF, "PCME Ltd.", "PCME" },
-	{ 0x70B3D5, 0x505000, 0x505FFF, "MC2-Technologies", "MC2-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xF2D000, 0xF2DFFF, "ID Lock AS", "ID-LOCK-AS" },
-	{ 0x70B3D5, 0x0DC000, 0x0DCFFF, "Talleres de Escoriaza", "TALLERES-DE-ESCORIAZA" },
-	{ 0x70B3D5, 0xAF3000, 0xAF3FFF, "New Japan Radio Co., Ltd", "NEW-JAPAN-RADIO" },
+	{ 0x70B3D5, 0x471000, 0x471FFF, "SYSCO Sicherheitssysteme GmbH", "SYSCO-SICHERHEITSSYSTEME" },
+	{ 0x70B3D5, 0x472000, 0x472FFF, "Quadio Devices Private Limited", "QUADIO-DEVICES-PRIVATE" },
+	{ 0x70B3D5, 0x475000, 0x475FFF, "EWATTCH", "EWATTCH" },
+	{ 0x70B3D5, 0x476000, 0x476FFF, "FR-Team International SA", "FR-TEAM" },
+	{ 0x70B3D5, 0x478000, 0x478FFF, "Touchnet/OneCard", "TOUCHNET/ONECARD" },
+	{ 0x70B3D5, 0x479000, 0x479FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
+	{ 0x70B3D5, 0x47C000, 0x47CFFF, "Par-Tech, Inc.", "PAR-TECH" },
+	{ 0x70B3D5, 0x47F000, 0x47FFFF, "ASE GmbH", "ASE" },
+	{ 0x70B3D5, 0x480000, 0x480FFF, "Emergency Lighting Products Limited", "EMERGENCY-LIGHTING-PRODUCTS" },
+	{ 0x70B3D5, 0x482000, 0x482FFF, "Aeryon Labs Inc", "AERYON-LABS" },
+	{ 0x70B3D5, 0x486000, 0x486FFF, "ChongQing JianTao Technology Co., Ltd.", "CHONGQING-JIANTAO" },
+	{ 0x70B3D5, 0x488000, 0x488FFF, "Cardinal Scale Mfg Co", "CARDINAL-SCALE-MFG" },
+	{ 0x70B3D5, 0x489000, 0x489FFF, "ard sa", "ARD" },
+	{ 0x70B3D5, 0x48A000, 0x48AFFF, "George Wilson Industries Ltd", "GEORGE-WILSON-INDUSTRIES" },
+	{ 0x70B3D5, 0x48C000, 0x48CFFF, "Integrated Systems Engineering, Inc.", "INTEGRATED-ENGINEERING" },
+	{ 0x70B3D5, 0x48D000, 0x48DFFF, "OMEGA BILANCE SRL SOCIETA' UNIPERSONALE", "OMEGA-BILANCE-SRL-SOCIETA-UNIPERSONALE" },
+	{ 0x70B3D5, 0x48E000, 0x48EFFF, "Allim System Co,.Ltd.", "ALLIM-SYSTEM" },
+	{ 0x70B3D5, 0x48F000, 0x48FFFF, "Seiwa Giken", "SEIWA-GIKEN" },
+	{ 0x70B3D5, 0x492000, 0x492FFF, "Jiangsu Jinheng Information Technology Co.,Ltd.", "JIANGSU-JINHENG-INFORMATION" },
+	{ 0x70B3D5, 0x493000, 0x493FFF, "Impulse Networks Pte Ltd", "IMPULSE-NETWORKS-PTE" },
+	{ 0x70B3D5, 0x494000, 0x494FFF, "Schildknecht AG", "SCHILDKNECHT" },
+	{ 0x70B3D5, 0x495000, 0x495FFF, "Fiem Industries Ltd.", "FIEM-INDUSTRIES" },
+	{ 0x70B3D5, 0x498000, 0x498FFF, "XGEM SAS", "XGEM-SAS" },
+	{ 0x70B3D5, 0x499000, 0x499FFF, "Pycom Ltd", "PYCOM" },
+	{ 0x70B3D5, 0x49A000, 0x49AFFF, "HAXE SYSTEME", "HAXE-SYSTEME" },
+	{ 0x70B3D5, 0x49B000, 0x49BFFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
+	{ 0x70B3D5, 0x49E000, 0x49EFFF, "CAPTEMP, Lda", "CAPTEMP-LDA" },
+	{ 0x70B3D5, 0x49F000, 0x49FFFF, "B.P.A. SRL", "B-P-A-SRL" },
+	{ 0x70B3D5, 0x4A0000, 0x4A0FFF, "FLUDIA", "FLUDIA" },
+	{ 0x70B3D5, 0x4A1000, 0x4A1FFF, "Herholdt Controls srl", "HERHOLDT-CONTROLS-SRL" },
+	{ 0x70B3D5, 0x4A5000, 0x4A5FFF, "Intermind Inc.", "INTERMIND" },
+	{ 0x70B3D5, 0x4A6000, 0x4A6FFF, "HZHY TECHNOLOGY", "HZHY" },
+	{ 0x70B3D5, 0x4A7000, 0x4A7FFF, "aelettronica group srl", "AELETTRONICA-GROUP-SRL" },
+	{ 0x70B3D5, 0x4A9000, 0x4A9FFF, "WARECUBE,INC", "WARECUBE" },
+	{ 0x70B3D5, 0x4AA000, 0x4AAFFF, "Twoway Communications, Inc.", "TWOWAY-COMMUNICATION" },
+	{ 0x70B3D5, 0x4AD000, 0x4ADFFF, "GACI", "GACI" },
+	{ 0x70B3D5, 0x4AE000, 0x4AEFFF, "Reinhardt System- und Messelectronic GmbH", "REINHARDT-SYSTEM--UND-MESSELECTRONIC" },
+	{ 0x70B3D5, 0x4AF000, 0x4AFFFF, "Agramkow Fluid Systems A/S", "AGRAMKOW-FLUID-A/S" },
+	{ 0x70B3D5, 0x4B0000, 0x4B0FFF, "Tecogen Inc.", "TECOGEN" },
+	{ 0x70B3D5, 0x4B1000, 0x4B1FFF, "LACE LLC.", "LACE-LLC" },
+	{ 0x70B3D5, 0x4B2000, 0x4B2FFF, "Certus Operations Ltd", "CERTUS-OPERATIONS" },
+	{ 0x70B3D5, 0x4B3000, 0x4B3FFF, "Bacsoft", "BACSOFT" },
+	{ 0x70B3D5, 0x4B4000, 0x4B4FFF, "Hi Tech Systems Ltd", "HI-TECH" },
+	{ 0x70B3D5, 0x4B6000, 0x4B6FFF, "VEILUX INC.", "VEILUX" },
+	{ 0x70B3D5, 0x4B7000, 0x4B7FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x4B8000, 0x4B8FFF, "International Roll-Call Corporation", "ROLL-CALL" },
+	{ 0x70B3D5, 0x4B9000, 0x4B9FFF, "SHEN ZHEN TTK TECHNOLOGY CO,LTD", "SHEN-ZHEN-TTK" },
+	{ 0x70B3D5, 0x4BA000, 0x4BAFFF, "Sinftech LLC", "SINFTECH-LLC" },
+	{ 0x70B3D5, 0x4BB000, 0x4BBFFF, "Plazma-T", "PLAZMA-T" },
+	{ 0x70B3D5, 0x4BD000, 0x4BDFFF, "Boulder Amplifiers, Inc.", "BOULDER-AMPLIFIERS" },
+	{ 0x70B3D5, 0x4BE000, 0x4BEFFF, "GY-FX SAS", "GY-FX-SAS" },
+	{ 0x70B3D5, 0x4C0000, 0x4C0FFF, "Technica Engineering GmbH", "TECHNICA-ENGINEERING" },
+	{ 0x70B3D5, 0x4C1000, 0x4C1FFF, "QUERCUS TECHNOLOGIES, S. L.", "QUERCUS-TECHNOLOGIES-S-L" },
+	{ 0x70B3D5, 0x4C2000, 0x4C2FFF, "hera Laborsysteme GmbH", "HERA-LABORSYSTEME" },
+	{ 0x70B3D5, 0x4C4000, 0x4C4FFF, "OOO Research and Production Center Computer Technologies", "OOO-RESEARCH-AND-PRODUCTION-CENTER-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x4C5000, 0x4C5FFF, "Moving iMage Technologies LLC", "MOVING-IMAGE-TECHNOLOGIES-LLC" },
+	{ 0x70B3D5, 0x4C6000, 0x4C6FFF, "BlueBox Video Limited", "BLUEBOX-VIDEO" },
+	{ 0x70B3D5, 0x4C7000, 0x4C7FFF, "SOLVERIS sp. z o.o.", "SOLVERIS-SP-Z-O-O" },
+	{ 0x70B3D5, 0x4C8000, 0x4C8FFF, "Hosokawa Micron Powder Systems", "HOSOKAWA-MICRON-POWDER" },
+	{ 0x70B3D5, 0x4CD000, 0x4CDFFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
+	{ 0x70B3D5, 0x4CE000, 0x4CEFFF, "Agilack", "AGILACK" },
+	{ 0x70B3D5, 0x4CF000, 0x4CFFFF, "GREEN HOUSE CO., LTD.", "GREEN-HOUSE" },
+	{ 0x70B3D5, 0x4D1000, 0x4D1FFF, "Contraves Advanced Devices Sdn. Bhd.", "CONTRAVES-ADVANCED-DEVICES-SDN-BHD" },
+	{ 0x70B3D5, 0x4D2000, 0x4D2FFF, "Biotage Sweden AB", "BIOTAGE-SWEDEN-AB" },
+	{ 0x70B3D5, 0x4D4000, 0x4D4FFF, "Nortek Global HVAC", "NORTEK-GLOBAL-HVAC" },
+	{ 0x70B3D5, 0x4D5000, 0x4D5FFF, "Moog Rekofa GmbH", "MOOG-REKOFA" },
+	{ 0x70B3D5, 0x4D8000, 0x4D8FFF, "Versilis Inc.", "VERSILIS" },
+	{ 0x70B3D5, 0x4DB000, 0x4DBFFF, "Temperature@lert", "TEMPERATURE@LERT" },
+	{ 0x70B3D5, 0x4DC000, 0x4DCFFF, "JK DEVICE CORPORATION", "JK-DEVICE" },
+	{ 0x70B3D5, 0x4DD000, 0x4DDFFF, "Road-iQ, LLC", "ROAD-IQ-LLC" },
+	{ 0x70B3D5, 0x4DE000, 0x4DEFFF, "Oso Technologies, Inc.", "OSO-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x4DF000, 0x4DFFFF, "Nidec Avtron Automation Corp", "NIDEC-AVTRON-AUTOMATION" },
+	{ 0x70B3D5, 0x4E0000, 0x4E0FFF, "Microvideo", "MICROVIDEO" },
+	{ 0x70B3D5, 0x4E1000, 0x4E1FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0x4E5000, 0x4E5FFF, "viZaar industrial imaging AG", "VIZAAR-INDUSTRIAL-IMAGING" },
+	{ 0x70B3D5, 0x4E7000, 0x4E7FFF, "Digital Domain", "DIGITAL-DOMAIN" },
+	{ 0x70B3D5, 0x4E9000, 0x4E9FFF, "ADETEC SAS", "ADETEC-SAS" },
+	{ 0x70B3D5, 0x4EA000, 0x4EAFFF, "Vocality international T/A Cubic", "VOCALITY-T/A-CUBIC" },
+	{ 0x70B3D5, 0x4EB000, 0x4EBFFF, "INFOSOFT DIGITAL DESIGN & SERVICES PRIVATE LIMITED", "INFOSOFT-DIGITAL-DESIGN-SERVICES-PRIVATE" },
+	{ 0x70B3D5, 0x4EC000, 0x4ECFFF, "Hangzhou Youshi Industry Co., Ltd.", "HANGZHOU-YOUSHI-INDUSTRY" },
+	{ 0x70B3D5, 0x4EE000, 0x4EEFFF, "NOA Co., Ltd.", "NOA" },
+	{ 0x70B3D5, 0x4EF000, 0x4EFFFF, "CMI, Inc.", "CMI" },
+	{ 0x70B3D5, 0x4F0000, 0x4F0FFF, "Li Seng Technology Ltd.,", "LI-SENG" },
+	{ 0x70B3D5, 0x4F4000, 0x4F4FFF, "WiTagg, Inc", "WITAGG" },
+	{ 0x70B3D5, 0x4F6000, 0x4F6FFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0x4F8000, 0x4F8FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x4F9000, 0x4F9FFF, "OptoPrecision GmbH", "OPTOPRECISION" },
+	{ 0x70B3D5, 0x4FC000, 0x4FCFFF, "Mettler Toledo", "METTLER-TOLEDO" },
+	{ 0x70B3D5, 0x4FE000, 0x4FEFFF, "WiTagg, Inc", "WITAGG" },
 	{ 0x70B3D5, 0x500000, 0x500FFF, "Mistral Solutions Pvt. LTD", "MISTRAL-SOLUTIONS-PVT" },
-	{ 0x70B3D5, 0x27D000, 0x27DFFF, "Telenor Connexion AB", "TELENOR-CONNEXION-AB" },
-	{ 0x70B3D5, 0xB29000, 0xB29FFF, "WiViCom Co., Ltd.", "WIVICOM" },
-	{ 0x70B3D5, 0xED5000, 0xED5FFF, "hangzhou battle link technology Co.,Ltd", "HANGZHOU-BATTLE-LINK" },
-	{ 0x70B3D5, 0xE95000, 0xE95FFF, "BroadSoft Inc", "BROADSOFT" },
-	{ 0x70B3D5, 0x65B000, 0x65BFFF, "Roush", "ROUSH" },
-	{ 0x70B3D5, 0xD7F000, 0xD7FFFF, "ConectaIP Tecnologia S.L.", "CONECTAIP-TECNOLOGIA-S-L" },
-	{ 0x70B3D5, 0x3D2000, 0x3D2FFF, "Imagine Inc.", "IMAGINE" },
-	{ 0x70B3D5, 0x7A7000, 0x7A7FFF, "Symbicon Ltd", "SYMBICON" },
-	{ 0x70B3D5, 0xD9B000, 0xD9BFFF, "Russian Telecom Equipment Company", "RUSSIAN-TELECOM-EQUIPMENT-COMPANY" },
-	{ 0x70B3D5, 0xE4E000, 0xE4EFFF, "Midfin Systems", "MIDFIN" },
-	{ 0x70B3D5, 0x48C000, 0x48CFFF, "Integrated Systems Engineering, Inc.", "INTEGRATED-ENGINEERING" },
-	{ 0x70B3D5, 0xFC6000, 0xFC6FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x70B3D5, 0x2BE000, 0x2BEFFF, "Coherent Logix, Inc.", "COHERENT-LOGIX" },
-	{ 0x70B3D5, 0x7F1000, 0x7F1FFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
-	{ 0x70B3D5, 0x7B8000, 0x7B8FFF, "SerEnergy A/S", "SERENERGY-A/S" },
-	{ 0x70B3D5, 0xCCE000, 0xCCEFFF, "Proconex 2010 Inc.", "PROCONEX-2010" },
-	{ 0x70B3D5, 0x300000, 0x300FFF, "Novo DR Ltd.", "NOVO-DR" },
-	{ 0x70B3D5, 0xBD3000, 0xBD3FFF, "FOTONA D.D.", "FOTONA-D-D" },
-	{ 0x70B3D5, 0x600000, 0x600FFF, "Stellwerk GmbH", "STELLWERK" },
-	{ 0x70B3D5, 0x421000, 0x421FFF, "North Star Bestech Co.,", "NORTH-STAR-BESTECH" },
-	{ 0x70B3D5, 0xC55000, 0xC55FFF, "Intelligent Energy Ltd", "INTELLIGENT-ENERGY" },
-	{ 0x70B3D5, 0xE28000, 0xE28FFF, "iotec GmbH", "IOTEC" },
-	{ 0x70B3D5, 0x6F3000, 0x6F3FFF, "iungo", "IUNGO" },
-	{ 0x70B3D5, 0x182000, 0x182FFF, "Kitron UAB", "KITRON-UAB" },
-	{ 0x70B3D5, 0x820000, 0x820FFF, "Becker Nachrichtentechnik GmbH", "BECKER-NACHRICHTENTECHNIK" },
-	{ 0x70B3D5, 0x732000, 0x732FFF, "TOFWERK AG", "TOFWERK" },
-	{ 0x70B3D5, 0x07D000, 0x07DFFF, "PANORAMIC POWER", "PANORAMIC-POWER" },
-	{ 0x70B3D5, 0xB9B000, 0xB9BFFF, "Elektronik Art", "ELEKTRONIK-ART" },
-	{ 0x70B3D5, 0x327000, 0x327FFF, "Seneco A/S", "SENECO-A/S" },
-	{ 0x70B3D5, 0x08E000, 0x08EFFF, "Beijing CONvision Technology Co.,Ltd", "BEIJING-CONVISION" },
-	{ 0x70B3D5, 0xB8F000, 0xB8FFFF, "Assembly Contracts Ltd", "ASSEMBLY-CONTRACTS" },
-	{ 0x70B3D5, 0x5C5000, 0x5C5FFF, "Haag-Streit AG", "HAAG-STREIT" },
-	{ 0x70B3D5, 0x164000, 0x164FFF, "Tokyo Drawing Ltd.", "TOKYO-DRAWING" },
-	{ 0x70B3D5, 0x9F1000, 0x9F1FFF, "RFEL Ltd", "RFEL" },
-	{ 0x70B3D5, 0x84A000, 0x84AFFF, "MOG Laboratories Pty Ltd", "MOG-LABORATORIES-PTY" },
-	{ 0x70B3D5, 0x9F5000, 0x9F5FFF, "Vickers Electronics Ltd", "VICKERS-ELECTRONICS" },
-	{ 0x70B3D5, 0xFDE000, 0xFDEFFF, "AERONAUTICAL & GENERAL INSTRUMENTS LTD.", "AERONAUTICAL-GENERAL-INSTRUMENTS" },
-	{ 0x70B3D5, 0x104000, 0x104FFF, "Plum sp. z o.o", "PLUM-SP-Z-O-O" },
-	{ 0x70B3D5, 0xC61000, 0xC61FFF, "JC HUNTER TECHNOLOGIES", "JC-HUNTER-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xA5B000, 0xA5BFFF, "Christ Elektronik GmbH", "CHRIST-ELEKTRONIK" },
-	{ 0x70B3D5, 0x39A000, 0x39AFFF, "Videotrend srl", "VIDEOTREND-SRL" },
-	{ 0x70B3D5, 0xCE7000, 0xCE7FFF, "June Automation Singapore Pte. Ltd.", "JUNE-AUTOMATION-SINGAPORE-PTE" },
-	{ 0x70B3D5, 0xEC1000, 0xEC1FFF, "Xafax Nederland bv", "XAFAX-NEDERLAND" },
-	{ 0x70B3D5, 0xA6D000, 0xA6DFFF, "Metek Meteorologische Messtechnik GmbH", "METEK-METEOROLOGISCHE-MESSTECHNIK" },
-	{ 0x70B3D5, 0x3B8000, 0x3B8FFF, "nVideon, Inc.", "NVIDEON" },
-	{ 0x70B3D5, 0x610000, 0x610FFF, "POLVISION", "POLVISION" },
-	{ 0x70B3D5, 0xEB2000, 0xEB2FFF, "Shooter Detection Systems", "SHOOTER-DETECTION" },
-	{ 0x70B3D5, 0x250000, 0x250FFF, "Datum Electronics Limited", "DATUM-ELECTRONICS" },
-	{ 0x70B3D5, 0xFDA000, 0xFDAFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x70B3D5, 0x6D9000, 0x6D9FFF, "VECTARE Inc", "VECTARE" },
-	{ 0x70B3D5, 0xBDA000, 0xBDAFFF, "5-D Systems, Inc.", "5-D" },
-	{ 0x70B3D5, 0x559000, 0x559FFF, "Eagle Mountain Technology", "EAGLE-MOUNTAIN" },
-	{ 0x70B3D5, 0xAEE000, 0xAEEFFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x70B3D5, 0x710000, 0x710FFF, "Guardian Controls International Ltd", "GUARDIAN-CONTROLS" },
-	{ 0x70B3D5, 0xA0B000, 0xA0BFFF, "ambiHome GmbH", "AMBIHOME" },
-	{ 0x70B3D5, 0x204000, 0x204FFF, "TWC", "TWC" },
-	{ 0x70B3D5, 0x83B000, 0x83BFFF, "Telefonix Incorporated", "TELEFONIX-INCORPORATED" },
-	{ 0x70B3D5, 0x029000, 0x029FFF, "Marimo electronics Co.,Ltd.", "MARIMO-ELECTRONICS" },
-	{ 0x70B3D5, 0x010000, 0x010FFF, "Hanwa Electronic Ind.Co.,Ltd.", "HANWA-IND" },
-	{ 0x70B3D5, 0x86D000, 0x86DFFF, "Census Digital Incorporated", "CENSUS-DIGITAL-INCORPORATED" },
-	{ 0x70B3D5, 0xADD000, 0xADDFFF, "GHL Systems Berhad", "GHL-BERHAD" },
-	{ 0x70B3D5, 0x6F6000, 0x6F6FFF, "Acco Brands Europe", "ACCO-BRANDS-EUROPE" },
-	{ 0x70B3D5, 0xD8F000, 0xD8FFFF, "Molu Technology Inc., LTD.", "MOLU" },
-	{ 0x70B3D5, 0x6F2000, 0x6F2FFF, "P&C Micro's Pty Ltd", "P-C-MICRO-S-PTY" },
-	{ 0x70B3D5, 0x43D000, 0x43DFFF, "Veryx Technologies Private Limited", "VERYX-TECHNOLOGIES-PRIVATE" },
-	{ 0x70B3D5, 0xAB7000, 0xAB7FFF, "SIGLEAD INC", "SIGLEAD" },
-	{ 0x70B3D5, 0xD47000, 0xD47FFF, "YotaScope Technologies Co., Ltd.", "YOTASCOPE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x80F000, 0x80FFFF, "Quickware Eng & Des LLC", "QUICKWARE-ENG-DES-LLC" },
-	{ 0x70B3D5, 0xF61000, 0xF61FFF, "Power Diagnostic Service", "POWER-DIAGNOSTIC-SERVICE" },
-	{ 0x70B3D5, 0x0F0000, 0x0F0FFF, "Avionica", "AVIONICA" },
-	{ 0x70B3D5, 0xE08000, 0xE08FFF, "Olssen", "OLSSEN" },
-	{ 0x70B3D5, 0xFD1000, 0xFD1FFF, "RedRat Ltd", "REDRAT" },
-	{ 0x70B3D5, 0xC8D000, 0xC8DFFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x044000, 0x044FFF, "Don Electronics Ltd", "DON-ELECTRONICS" },
-	{ 0x70B3D5, 0x5F0000, 0x5F0FFF, "managee GmbH & Co KG", "MANAGEE" },
-	{ 0x70B3D5, 0x956000, 0x956FFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
-	{ 0x70B3D5, 0xF62000, 0xF62FFF, "FRS GmbH & Co. KG", "FRS" },
-	{ 0x70B3D5, 0x0A9000, 0x0A9FFF, "ProConnections, Inc.", "PROCONNECTIONS" },
-	{ 0x70B3D5, 0xEDD000, 0xEDDFFF, "Solar Network & Partners", "SOLAR-NETWORK-PARTNERS" },
-	{ 0x70B3D5, 0x3DE000, 0x3DEFFF, "ELOMAC Elektronik GmbH", "ELOMAC-ELEKTRONIK" },
-	{ 0x70B3D5, 0x139000, 0x139FFF, "Tunstall A/S", "TUNSTALL-A/S" },
-	{ 0x70B3D5, 0x871000, 0x871FFF, "Oso Technologies", "OSO-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xAE9000, 0xAE9FFF, "Cari Electronic", "CARI" },
-	{ 0x70B3D5, 0xD8B000, 0xD8BFFF, "Lenoxi Automation s.r.o.", "LENOXI-AUTOMATION-S-R-O" },
-	{ 0x001BC5, 0x0C4000, 0x0C4FFF, "ELDES", "ELDES" },
-	{ 0x001BC5, 0x0BA000, 0x0BAFFF, "NT MICROSYSTEMS", "NT-MICROSYSTEMS" },
-	{ 0x001BC5, 0x0B0000, 0x0B0FFF, "J-D.COM", "J-D-COM" },
-	{ 0x001BC5, 0x0A6000, 0x0A6FFF, "Balter Security GmbH", "BALTER-SECURITY" },
-	{ 0x001BC5, 0x075000, 0x075FFF, "Kitron GmbH", "KITRON" },
-	{ 0x001BC5, 0x074000, 0x074FFF, "Dynasthetics", "DYNASTHETICS" },
-	{ 0x001BC5, 0x07F000, 0x07FFFF, "Hitechlab Inc", "HITECHLAB" },
-	{ 0x001BC5, 0x07E000, 0x07EFFF, "Bio Molecular System Pty Ltd", "BIO-MOLECULAR-SYSTEM-PTY" },
-	{ 0x001BC5, 0x06A000, 0x06AFFF, "IST GmbH", "IST" },
-	{ 0x001BC5, 0x06B000, 0x06BFFF, "Verified Energy, LLC.", "VERIFIED-ENERGY-LLC" },
-	{ 0x001BC5, 0x061000, 0x061FFF, "Scientific-Technical Center Epsilon Limited company", "SCIENTIFIC-TECHNICAL-CENTER-EPSILON-COMPANY" },
-	{ 0x001BC5, 0x060000, 0x060FFF, "ENSTECH", "ENSTECH" },
-	{ 0x001BC5, 0x04D000, 0x04DFFF, "eiraku electric corp.", "EIRAKU-ELECTRIC" },
-	{ 0x001BC5, 0x04C000, 0x04CFFF, "Rhino Controls Ltd.", "RHINO-CONTROLS" },
-	{ 0x001BC5, 0x057000, 0x057FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
-	{ 0x001BC5, 0x056000, 0x056FFF, "ThinKom Solutions, Inc", "THINKOM-SOLUTIONS" },
-	{ 0x001BC5, 0x043000, 0x043FFF, "Coincident, Inc.", "COINCIDENT" },
-	{ 0x001BC5, 0x038000, 0x038FFF, "SEED International Ltd.", "SEED" },
-	{ 0x001BC5, 0x02E000, 0x02EFFF, "BETTINI SRL", "BETTINI-SRL" },
-	{ 0x001BC5, 0x024000, 0x024FFF, "ANNECY ELECTRONIQUE SAS", "ANNECY-ELECTRONIQUE-SAS" },
-	{ 0x001BC5, 0x01B000, 0x01BFFF, "Commonwealth Scientific and Industrial Research Organisation", "COMMONWEALTH-SCIENTIFIC-AND-INDUSTRIAL-RESEARCH-ORGANISATION" },
-	{ 0x001BC5, 0x01C000, 0x01CFFF, "Coolit Systems, Inc.", "COOLIT" },
-	{ 0x70B3D5, 0xC3B000, 0xC3BFFF, "Vironova AB", "VIRONOVA-AB" },
-	{ 0x70B3D5, 0x6A9000, 0x6A9FFF, "OHMORI ELECTRIC INDUSTRIES CO.LTD", "OHMORI-ELECTRIC-INDUSTRIES" },
+	{ 0x70B3D5, 0x501000, 0x501FFF, "Peek Traffic", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0x502000, 0x502FFF, "Glidewell Laboratories", "GLIDEWELL-LABORATORIES" },
+	{ 0x70B3D5, 0x503000, 0x503FFF, "Itest communication Tech Co., LTD", "ITEST-COMMUNICATION-TECH" },
+	{ 0x70B3D5, 0x504000, 0x504FFF, "Xsight Systems Ltd.", "XSIGHT" },
+	{ 0x70B3D5, 0x505000, 0x505FFF, "MC2-Technologies", "MC2-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x507000, 0x507FFF, "Human Oriented Technology, Inc.", "HUMAN-ORIENTED" },
+	{ 0x70B3D5, 0x508000, 0x508FFF, "INSEVIS GmbH", "INSEVIS" },
+	{ 0x70B3D5, 0x50E000, 0x50EFFF, "Micro Trend Automation Co., LTD", "MICRO-TREND-AUTOMATION" },
+	{ 0x70B3D5, 0x510000, 0x510FFF, "PSL ELEKTRONİK SANAYİ VE TİCARET A.S.", "PSL-ELEKTRONİK-SANAYİ-VE-TİCARET-A-S" },
+	{ 0x70B3D5, 0x511000, 0x511FFF, "Next Sight srl", "NEXT-SIGHT-SRL" },
+	{ 0x70B3D5, 0x512000, 0x512FFF, "Techno Broad,Inc", "TECHNO-BROAD" },
+	{ 0x70B3D5, 0x513000, 0x513FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x515000, 0x515FFF, "PCSC", "PCSC" },
+	{ 0x70B3D5, 0x516000, 0x516FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
+	{ 0x70B3D5, 0x517000, 0x517FFF, "ISPHER", "ISPHER" },
+	{ 0x70B3D5, 0x518000, 0x518FFF, "CRUXELL Corp.", "CRUXELL" },
+	{ 0x70B3D5, 0x51B000, 0x51BFFF, "Vitrea Smart Home Technologies", "VITREA-SMART-HOME-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x51C000, 0x51CFFF, "ATX Networks Corp", "ATX-NETWORKS" },
+	{ 0x70B3D5, 0x51D000, 0x51DFFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
+	{ 0x70B3D5, 0x51E000, 0x51EFFF, "Fundación Cardiovascular de Colombia", "FUNDACIóN-CARDIOVASCULAR-DE-COLOMBIA" },
+	{ 0x70B3D5, 0x522000, 0x522FFF, "Syncopated Engineering Inc", "SYNCOPATED-ENGINEERING" },
+	{ 0x70B3D5, 0x523000, 0x523FFF, "Tibit Communications", "TIBIT-COMMUNICATION" },
+	{ 0x70B3D5, 0x524000, 0x524FFF, "Wuxi New Optical Communication Co.,Ltd.", "WUXI-NEW-OPTICAL-COMMUNICATION" },
+	{ 0x70B3D5, 0x525000, 0x525FFF, "Plantiga Technologies Inc", "PLANTIGA-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x526000, 0x526FFF, "FlowNet LLC", "FLOWNET-LLC" },
+	{ 0x70B3D5, 0x528000, 0x528FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x52B000, 0x52BFFF, "GE Aviation Cheltenham", "GE-AVIATION-CHELTENHAM" },
+	{ 0x70B3D5, 0x52C000, 0x52CFFF, "Centuryarks Ltd.,", "CENTURYARKS" },
+	{ 0x70B3D5, 0x52D000, 0x52DFFF, "Tanaka Electric Industry Co., Ltd.", "TANAKA-ELECTRIC-INDUSTRY" },
 	{ 0x70B3D5, 0x52E000, 0x52EFFF, "Swissponic Sagl", "SWISSPONIC-SAGL" },
+	{ 0x70B3D5, 0x530000, 0x530FFF, "iSiS-Ex Limited", "ISIS-EX" },
+	{ 0x70B3D5, 0x531000, 0x531FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0x532000, 0x532FFF, "Talleres de Escoriaza SA", "TALLERES-DE-ESCORIAZA" },
+	{ 0x70B3D5, 0x538000, 0x538FFF, "sydetion UG (h.b.)", "SYDETION-UG-H-B" },
+	{ 0x70B3D5, 0x53A000, 0x53AFFF, "Pano0ramic Power", "PANO0RAMIC-POWER" },
+	{ 0x70B3D5, 0x53B000, 0x53BFFF, "Mr.Loop", "MR-LOOP" },
+	{ 0x70B3D5, 0x53C000, 0x53CFFF, "Airthings", "AIRTHINGS" },
+	{ 0x70B3D5, 0x53D000, 0x53DFFF, "ACCEL CORP", "ACCEL" },
+	{ 0x70B3D5, 0x542000, 0x542FFF, "RTDS Technologies Inc.", "RTDS-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x544000, 0x544FFF, "Silicon Safe Ltd", "SILICON-SAFE" },
+	{ 0x70B3D5, 0x546000, 0x546FFF, "Sensefarm AB", "SENSEFARM-AB" },
+	{ 0x70B3D5, 0x547000, 0x547FFF, "CE LINK LIMITED", "CE-LINK" },
+	{ 0x70B3D5, 0x548000, 0x548FFF, "DIGIVERV INC", "DIGIVERV" },
+	{ 0x70B3D5, 0x549000, 0x549FFF, "Procon automatic systems GmbH", "PROCON-AUTOMATIC" },
+	{ 0x70B3D5, 0x54B000, 0x54BFFF, "Brakels IT", "BRAKELS-IT" },
+	{ 0x70B3D5, 0x54C000, 0x54CFFF, "Husty M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
+	{ 0x70B3D5, 0x54D000, 0x54DFFF, "Qingdao Haitian Weiye Automation Control System Co., Ltd", "QINGDAO-HAITIAN-WEIYE-AUTOMATION-CONTROL-SYSTEM" },
+	{ 0x70B3D5, 0x54E000, 0x54EFFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
+	{ 0x70B3D5, 0x54F000, 0x54FFFF, "Assembly Contracts Limited", "ASSEMBLY-CONTRACTS" },
+	{ 0x70B3D5, 0x550000, 0x550FFF, "Merten GmbH&CoKG", "MERTEN-COKG" },
 	{ 0x70B3D5, 0x551000, 0x551FFF, "infrachip", "INFRACHIP" },
-	{ 0x70B3D5, 0x323000, 0x323FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x054000, 0x054FFF, "Groupeer Technologies", "GROUPEER-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x353000, 0x353FFF, "Digital Outfit", "DIGITAL-OUTFIT" },
-	{ 0x70B3D5, 0xF5B000, 0xF5BFFF, "A.F.MENSAH, INC", "A-F-MENSAH" },
-	{ 0x70B3D5, 0xA92000, 0xA92FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x1E3000, 0x1E3FFF, "Hatel Elektronik LTD. STI.", "HATEL-ELEKTRONIK-STI" },
-	{ 0x70B3D5, 0xCCA000, 0xCCAFFF, "SIEMENS AS", "SIEMENS-AS" },
-	{ 0x70B3D5, 0xEF6000, 0xEF6FFF, "CHARGELIB", "CHARGELIB" },
-	{ 0x70B3D5, 0xB02000, 0xB02FFF, "Nordic Automation Systems AS", "NORDIC-AUTOMATION-AS" },
-	{ 0x70B3D5, 0xB05000, 0xB05FFF, "E-PLUS TECHNOLOGY CO., LTD", "E-PLUS" },
-	{ 0x70B3D5, 0x847000, 0x847FFF, "Ai-Lynx", "AI-LYNX" },
-	{ 0x70B3D5, 0x148000, 0x148FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0xBFE000, 0xBFEFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x261000, 0x261FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0x618000, 0x618FFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x70B3D5, 0x892000, 0x892FFF, "ABB", "ABB" },
-	{ 0x70B3D5, 0x9BA000, 0x9BAFFF, "ATIM Radiocommunication", "ATIM-RADIOCOMMUNICATION" },
-	{ 0x70B3D5, 0x4C4000, 0x4C4FFF, "OOO Research and Production Center Computer Technologies", "OOO-RESEARCH-AND-PRODUCTION-CENTER-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x9B3000, 0x9B3FFF, "K&J Schmittschneider AG", "K-J-SCHMITTSCHNEIDER" },
-	{ 0x70B3D5, 0x747000, 0x747FFF, "Eva Automation", "EVA-AUTOMATION" },
-	{ 0x70B3D5, 0x3F4000, 0x3F4FFF, "Wincode Technology Co., Ltd.", "WINCODE" },
-	{ 0x70B3D5, 0x6E6000, 0x6E6FFF, "Eleven Engineering Incorporated", "ELEVEN-ENGINEERING-INCORPORATED" },
-	{ 0x70B3D5, 0xE39000, 0xE39FFF, "Thinnect, Inc,", "THINNECT" },
-	{ 0x70B3D5, 0x216000, 0x216FFF, "FLEXTRONICS", "FLEXTRONICS" },
-	{ 0x70B3D5, 0x0FE000, 0x0FEFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x70B3D5, 0x4B7000, 0x4B7FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x553000, 0x553FFF, "TAALEX Systemtechnik GmbH", "TAALEX-SYSTEMTECHNIK" },
+	{ 0x70B3D5, 0x554000, 0x554FFF, "Teletypes Manufacturing Plant", "TELETYPES-MANUFACTURING-PLANT" },
+	{ 0x70B3D5, 0x555000, 0x555FFF, "SoftLab-NSK", "SOFTLAB-NSK" },
+	{ 0x70B3D5, 0x557000, 0x557FFF, "HEITEC AG", "HEITEC" },
+	{ 0x70B3D5, 0x559000, 0x559FFF, "Eagle Mountain Technology", "EAGLE-MOUNTAIN" },
+	{ 0x70B3D5, 0x55A000, 0x55AFFF, "Sontay Ltd.", "SONTAY" },
+	{ 0x70B3D5, 0x55B000, 0x55BFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
 	{ 0x70B3D5, 0x55C000, 0x55CFFF, "Saratoga Speed, Inc.", "SARATOGA-SPEED" },
-	{ 0x70B3D5, 0x428000, 0x428FFF, "Presentation Switchers, Inc.", "PRESENTATION-SWITCHERS" },
-	{ 0x70B3D5, 0xC32000, 0xC32FFF, "INFRASAFE/ ADVANTOR SYSTEMS", "INFRASAFE/-ADVANTOR" },
-	{ 0x70B3D5, 0x592000, 0x592FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xF1A000, 0xF1AFFF, "Sator Controls s.r.o.", "SATOR-CONTROLS-S-R-O" },
-	{ 0x70B3D5, 0x05A000, 0x05AFFF, "Uni Control System Sp. z o. o.", "UNI-CONTROL-SYSTEM-SP-Z-O-O" },
-	{ 0x70B3D5, 0x9EF000, 0x9EFFFF, "Cottonwood Creek Technologies, Inc.", "COTTONWOOD-CREEK-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x9EB000, 0x9EBFFF, "Preston Industries dba PolyScience", "PRESTON-INDUSTRIES-DBA-POLYSCIENCE" },
-	{ 0x70B3D5, 0xA3B000, 0xA3BFFF, "Grace Design/Lunatec LLC", "GRACE-DESIGN/LUNATEC-LLC" },
-	{ 0x70B3D5, 0x7A0000, 0x7A0FFF, "Reactec Ltd", "REACTEC" },
-	{ 0x70B3D5, 0x29B000, 0x29BFFF, "DermaLumics S.L.", "DERMALUMICS-S-L" },
-	{ 0x70B3D5, 0x202000, 0x202FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x259000, 0x259FFF, "Zebra Elektronik A.S.", "ZEBRA-ELEKTRONIK-A-S" },
-	{ 0x70B3D5, 0xFBE000, 0xFBEFFF, "Hanbat National University", "HANBAT-NATIONAL-UNIVERSITY" },
-	{ 0x70B3D5, 0xFE4000, 0xFE4FFF, "CARE PVT LTD", "CARE-PVT" },
-	{ 0x70B3D5, 0x8B1000, 0x8B1FFF, "M-Tech Innovations Limited", "M-TECH-INNOVATIONS" },
-	{ 0x70B3D5, 0xD34000, 0xD34FFF, "G-PHILOS CO.,LTD", "G-PHILOS" },
-	{ 0x70B3D5, 0x528000, 0x528FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xB81000, 0xB81FFF, "Instro Precision Limited", "INSTRO-PRECISION" },
-	{ 0x70B3D5, 0xA66000, 0xA66FFF, "Trapeze Software Group Inc", "TRAPEZE-SOFTWARE-GROUP" },
-	{ 0x70B3D5, 0x1AB000, 0x1ABFFF, "Access Control Systems JSC", "ACCESS-CONTROL-JSC" },
-	{ 0x70B3D5, 0xA78000, 0xA78FFF, "Bionics co.,ltd.", "BIONICS" },
-	{ 0x70B3D5, 0xE7E000, 0xE7EFFF, "Groupe Citypassenger Inc", "GROUPE-CITYPASSENGER" },
-	{ 0x70B3D5, 0x8D3000, 0x8D3FFF, "PERFORMANCE CONTROLS, INC.", "PERFORMANCE-CONTROLS" },
-	{ 0x70B3D5, 0xD63000, 0xD63FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x508000, 0x508FFF, "INSEVIS GmbH", "INSEVIS" },
-	{ 0x70B3D5, 0x440000, 0x440FFF, "Discover Video", "DISCOVER-VIDEO" },
-	{ 0x70B3D5, 0x50E000, 0x50EFFF, "Micro Trend Automation Co., LTD", "MICRO-TREND-AUTOMATION" },
-	{ 0x70B3D5, 0x879000, 0x879FFF, "ZIGPOS GmbH", "ZIGPOS" },
-	{ 0x70B3D5, 0x8E4000, 0x8E4FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x350000, 0x350FFF, "Tickster AB", "TICKSTER-AB" },
-	{ 0x70B3D5, 0x2F3000, 0x2F3FFF, "Scame Sistemi srl", "SCAME-SISTEMI-SRL" },
-	{ 0x70B3D5, 0xDAD000, 0xDADFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x70B3D5, 0x68D000, 0x68DFFF, "Meta-chrom Co. Ltd.", "META-CHROM" },
-	{ 0x70B3D5, 0x91B000, 0x91BFFF, "Dolotron d.o.o.", "DOLOTRON-D-O-O" },
-	{ 0x70B3D5, 0xA96000, 0xA96FFF, "Östling Marking Systems GmbH", "OESTLING-MARKING" },
-	{ 0x70B3D5, 0x367000, 0x367FFF, "Living Water", "LIVING-WATER" },
-	{ 0x70B3D5, 0x8DB000, 0x8DBFFF, "Kratos Analytical Ltd", "KRATOS-ANALYTICAL" },
-	{ 0x70B3D5, 0xA4F000, 0xA4FFFF, "Weltek Technologies Co. Ltd.", "WELTEK-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x1A3000, 0x1A3FFF, "Telairity Semiconductor", "TELAIRITY-SEMICONDUCTOR" },
-	{ 0x70B3D5, 0x650000, 0x650FFF, "GIFAS-ELECTRIC GmbH", "GIFAS-ELECTRIC" },
-	{ 0x70B3D5, 0xC63000, 0xC63FFF, "Xentech Solutions Limited", "XENTECH-SOLUTIONS" },
-	{ 0x70B3D5, 0x106000, 0x106FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x6C5000, 0x6C5FFF, "CJSC «Russian telecom equipment company» (CJSC RTEC)", "CJSC-«RUSSIAN-TELECOM-EQUIPMENT-COMPANY»-CJSC-RTEC" },
-	{ 0x70B3D5, 0xFE9000, 0xFE9FFF, "Camsat Przemysław Gralak", "CAMSAT-PRZEMYSłAW-GRALAK" },
-	{ 0x70B3D5, 0x4C5000, 0x4C5FFF, "Moving iMage Technologies LLC", "MOVING-IMAGE-TECHNOLOGIES-LLC" },
-	{ 0x70B3D5, 0x91A000, 0x91AFFF, "Fujian Landfone Information Technology Co.,Ltd", "FUJIAN-LANDFONE-INFORMATION" },
-	{ 0x70B3D5, 0x9EC000, 0x9ECFFF, "eSoftThings", "ESOFTTHINGS" },
-	{ 0x70B3D5, 0x761000, 0x761FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0xC22000, 0xC22FFF, "Skyriver Communications Inc.", "SKYRIVER-COMMUNICATION" },
-	{ 0x70B3D5, 0x3BB000, 0x3BBFFF, "A-M Systems", "A-M" },
-	{ 0x70B3D5, 0xB44000, 0xB44FFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0x55D000, 0x55DFFF, "LunaNexus Inc", "LUNANEXUS" },
+	{ 0x70B3D5, 0x55E000, 0x55EFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
+	{ 0x70B3D5, 0x563000, 0x563FFF, "Zhejiang Hao Teng Electronic Technology Co., Ltd.", "ZHEJIANG-HAO-TENG" },
+	{ 0x70B3D5, 0x564000, 0x564FFF, "christmann informationstechnik + medien GmbH & Co. KG", "CHRISTMANN-INFORMATIONSTECHNIK-+-MEDIEN" },
+	{ 0x70B3D5, 0x566000, 0x566FFF, "Data Informs LLC", "DATA-INFORMS-LLC" },
+	{ 0x70B3D5, 0x56A000, 0x56AFFF, "Harvard Technology Ltd", "HARVARD" },
+	{ 0x70B3D5, 0x56B000, 0x56BFFF, "S.E.I. CO.,LTD.", "S-E-I" },
+	{ 0x70B3D5, 0x56C000, 0x56CFFF, "Telensa Ltd", "TELENSA" },
+	{ 0x70B3D5, 0x570000, 0x570FFF, "Bayern Engineering GmbH & Co. KG", "BAYERN-ENGINEERING" },
+	{ 0x70B3D5, 0x572000, 0x572FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x576000, 0x576FFF, "Shandong Hospot IOT Technology Co.,Ltd.", "SHANDONG-HOSPOT-IOT" },
+	{ 0x70B3D5, 0x578000, 0x578FFF, "IMAGE TECH CO.,LTD", "IMAGE-TECH" },
+	{ 0x70B3D5, 0x579000, 0x579FFF, "Chelsea Technologies Group Ltd", "CHELSEA-TECHNOLOGIES-GROUP" },
+	{ 0x70B3D5, 0x57A000, 0x57AFFF, "Rhythm Engineering, LLC.", "RHYTHM-ENGINEERING-LLC" },
+	{ 0x70B3D5, 0x57B000, 0x57BFFF, "ELAMAKATO GmbH", "ELAMAKATO" },
+	{ 0x70B3D5, 0x57C000, 0x57CFFF, "Automata GmbH & Co. KG", "AUTOMATA" },
+	{ 0x70B3D5, 0x57D000, 0x57DFFF, "WICOM1 GmbH", "WICOM1" },
+	{ 0x70B3D5, 0x580000, 0x580FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x582000, 0x582FFF, "VAGLER International Sdn Bhd", "VAGLER-SDN-BHD" },
+	{ 0x70B3D5, 0x583000, 0x583FFF, "Ducommun Inc.", "DUCOMMUN" },
 	{ 0x70B3D5, 0x584000, 0x584FFF, "Sertone, a division of Opti-Knights Ltd", "SERTONE-A-DIVISION-OF-OPTI-KNIGHTS" },
-	{ 0x70B3D5, 0x7C2000, 0x7C2FFF, "Morgan Schaffer Inc.", "MORGAN-SCHAFFER" },
-	{ 0x70B3D5, 0x697000, 0x697FFF, "Alazar Technologies Inc.", "ALAZAR-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x61A000, 0x61AFFF, "Rocket Lab Ltd.", "ROCKET-LAB" },
-	{ 0x70B3D5, 0x855000, 0x855FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xF8D000, 0xF8DFFF, "Flextronics Canafa Design Services", "FLEXTRONICS-CANAFA-DESIGN-SERVICES" },
-	{ 0x70B3D5, 0x9AE000, 0x9AEFFF, "Volansys technologies pvt ltd", "VOLANSYS-TECHNOLOGIES-PVT" },
-	{ 0x70B3D5, 0x42C000, 0x42CFFF, "D.Marchiori Srl", "D-MARCHIORI-SRL" },
-	{ 0x70B3D5, 0xCE5000, 0xCE5FFF, "GridBridge Inc", "GRIDBRIDGE" },
-	{ 0x70B3D5, 0x1EF000, 0x1EFFFF, "ADTEK", "ADTEK" },
-	{ 0x70B3D5, 0xEDB000, 0xEDBFFF, "Netfort Solutions", "NETFORT-SOLUTIONS" },
-	{ 0x70B3D5, 0xCD9000, 0xCD9FFF, "Peter Huber Kaeltemaschinenbau GmbH", "PETER-HUBER-KAELTEMASCHINENBAU" },
-	{ 0x70B3D5, 0x976000, 0x976FFF, "Atonarp Micro-Systems India Pvt. Ltd.", "ATONARP-MICRO--INDIA-PVT" },
-	{ 0x70B3D5, 0x0DA000, 0x0DAFFF, "Aquavision Distribution Ltd", "AQUAVISION-DISTRIBUTION" },
-	{ 0x70B3D5, 0x989000, 0x989FFF, "DCNS", "DCNS" },
-	{ 0x70B3D5, 0x833000, 0x833FFF, "Alpiq InTec Management AG", "ALPIQ-INTEC-MANAGEMENT" },
-	{ 0x70B3D5, 0x3E8000, 0x3E8FFF, "COSMOS web Co., Ltd.", "COSMOS-WEB" },
-	{ 0x70B3D5, 0x97F000, 0x97FFFF, "BISTOS.,Co.,Ltd", "BISTOS" },
-	{ 0x70B3D5, 0xC5D000, 0xC5DFFF, "FOSHAN SHILANTIAN NETWORK S.T. CO., LTD.", "FOSHAN-SHILANTIAN-NETWORK-S-T" },
-	{ 0x70B3D5, 0x73B000, 0x73BFFF, "S-I-C", "S-I-C" },
-	{ 0x70B3D5, 0x114000, 0x114FFF, "Project H Pty Ltd", "PROJECT-H-PTY" },
-	{ 0x70B3D5, 0x906000, 0x906FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x243000, 0x243FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x70B3D5, 0x9F3000, 0x9F3FFF, "IEEE Registration Authority", "IEEE-REGISTRATION-AUTHORITY" },
-	{ 0x70B3D5, 0xAAC000, 0xAACFFF, "SensoTec GmbH", "SENSOTEC" },
-	{ 0x70B3D5, 0xF9A000, 0xF9AFFF, "Krabbenhøft og Ingolfsson", "KRABBENHøFT-OG-INGOLFSSON" },
-	{ 0x70B3D5, 0x349000, 0x349FFF, "SLAT", "SLAT" },
-	{ 0x70B3D5, 0xD91000, 0xD91FFF, "FoodALYT GmbH", "FOODALYT" },
-	{ 0x70B3D5, 0x3AE000, 0x3AEFFF, "Exicom Technologies fze", "EXICOM-TECHNOLOGIES-FZE" },
-	{ 0x70B3D5, 0x7DD000, 0x7DDFFF, "Excel Medical Electronics LLC", "EXCEL-MEDICAL-ELECTRONICS-LLC" },
-	{ 0x70B3D5, 0xE71000, 0xE71FFF, "SiS Technology", "SIS" },
-	{ 0x70B3D5, 0xEA0000, 0xEA0FFF, "PARK24", "PARK24" },
-	{ 0x70B3D5, 0xD05000, 0xD05FFF, "Colmek", "COLMEK" },
-	{ 0x70B3D5, 0xBF5000, 0xBF5FFF, "Acacia Research", "ACACIA-RESEARCH" },
-	{ 0x70B3D5, 0x499000, 0x499FFF, "Pycom Ltd", "PYCOM" },
-	{ 0x70B3D5, 0x21E000, 0x21EFFF, "Hildebrand Technology Limited", "HILDEBRAND" },
-	{ 0x70B3D5, 0xD67000, 0xD67FFF, "ALPHA　Corporation", "ALPHA　" },
-	{ 0x70B3D5, 0xC4F000, 0xC4FFFF, "AE Van de Vliet BVBA", "AE-VAN-DE-VLIET-BVBA" },
-	{ 0x70B3D5, 0xBD9000, 0xBD9FFF, "SolwayTech", "SOLWAYTECH" },
-	{ 0x70B3D5, 0xF35000, 0xF35FFF, "carbonTRACK", "CARBONTRACK" },
-	{ 0x70B3D5, 0x29F000, 0x29FFFF, "Code Hardware SA", "CODE-HARDWARE" },
-	{ 0x70B3D5, 0xF76000, 0xF76FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
-	{ 0x70B3D5, 0x2B9000, 0x2B9FFF, "BELECTRIC GmbH", "BELECTRIC" },
-	{ 0x70B3D5, 0x9AD000, 0x9ADFFF, "Fortuna Impex Pvt ltd", "FORTUNA-IMPEX-PVT" },
+	{ 0x70B3D5, 0x585000, 0x585FFF, "Nefteavtomatika", "NEFTEAVTOMATIKA" },
+	{ 0x70B3D5, 0x587000, 0x587FFF, "INCAA Computers", "INCAA-COMPUTERS" },
+	{ 0x70B3D5, 0x589000, 0x589FFF, "Cityntel OU", "CITYNTEL-OU" },
+	{ 0x70B3D5, 0x58C000, 0x58CFFF, "OPTSYS", "OPTSYS" },
+	{ 0x70B3D5, 0x58D000, 0x58DFFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0x58E000, 0x58EFFF, "Veilux Inc.", "VEILUX" },
+	{ 0x70B3D5, 0x58F000, 0x58FFFF, "LSL systems", "LSL" },
+	{ 0x70B3D5, 0x591000, 0x591FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x592000, 0x592FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x593000, 0x593FFF, "Asis Pro", "ASIS-PRO" },
 	{ 0x70B3D5, 0x594000, 0x594FFF, "ATE Systems Inc", "ATE" },
-	{ 0x70B3D5, 0x8CB000, 0x8CBFFF, "WELT Corporation", "WELT" },
-	{ 0x70B3D5, 0x405000, 0x405FFF, "MG s.r.l.", "MG-S-R-L" },
-	{ 0x70B3D5, 0x87E000, 0x87EFFF, "Septentrio NV", "SEPTENTRIO-NV" },
-	{ 0x70B3D5, 0xECB000, 0xECBFFF, "Re spa - Controlli Industriali - IT01782300154", "RE-SPA---CONTROLLI-INDUSTRIALI---IT01782300154" },
+	{ 0x70B3D5, 0x595000, 0x595FFF, "PLR Prueftechnik Linke und Ruehe GmbH", "PLR-PRUEFTECHNIK-LINKE-UND-RUEHE" },
+	{ 0x70B3D5, 0x596000, 0x596FFF, "Mencom Corporation", "MENCOM" },
+	{ 0x70B3D5, 0x597000, 0x597FFF, "VAPE RAIL INTERNATIONAL", "VAPE-RAIL" },
+	{ 0x70B3D5, 0x599000, 0x599FFF, "LECO Corporation", "LECO" },
+	{ 0x70B3D5, 0x59B000, 0x59BFFF, "AUTOMATIZACION Y CONECTIVIDAD SA DE CV", "AUTOMATIZACION-Y-CONECTIVIDAD-DE-CV" },
+	{ 0x70B3D5, 0x59C000, 0x59CFFF, "DAVE SRL", "DAVE-SRL" },
+	{ 0x70B3D5, 0x59D000, 0x59DFFF, "servicios de consultoria independiente S.L.", "SERVICIOS-DE-CONSULTORIA-INDEPENDIENTE-S-L" },
+	{ 0x70B3D5, 0x5A0000, 0x5A0FFF, "Ascon Tecnologic S.r.l.", "ASCON-TECNOLOGIC-S-R-L" },
+	{ 0x70B3D5, 0x5A2000, 0x5A2FFF, "Wallner Automation GmbH", "WALLNER-AUTOMATION" },
+	{ 0x70B3D5, 0x5A3000, 0x5A3FFF, "CT Company", "CT-COMPANY" },
+	{ 0x70B3D5, 0x5A5000, 0x5A5FFF, "Rehwork GmbH", "REHWORK" },
+	{ 0x70B3D5, 0x5A8000, 0x5A8FFF, "Farmobile", "FARMOBILE" },
+	{ 0x70B3D5, 0x5A9000, 0x5A9FFF, "Bunka Shutter Co., Ltd.", "BUNKA-SHUTTER" },
+	{ 0x70B3D5, 0x5AA000, 0x5AAFFF, "Chugoku Electric Manufacturing Co.,Inc", "CHUGOKU-ELECTRIC-MANUFACTURING" },
+	{ 0x70B3D5, 0x5AB000, 0x5ABFFF, "Sea Air and Land Communications Ltd", "SEA-AIR-AND-LAND-COMMUNICATION" },
+	{ 0x70B3D5, 0x5B0000, 0x5B0FFF, "Qxperts Italia S.r.l.", "QXPERTS-ITALIA-S-R-L" },
+	{ 0x70B3D5, 0x5B1000, 0x5B1FFF, "EPD Electronics", "EPD-ELECTRONICS" },
+	{ 0x70B3D5, 0x5B5000, 0x5B5FFF, "Lehigh Electric Products Co", "LEHIGH-ELECTRIC-PRODUCTS" },
+	{ 0x70B3D5, 0x5B6000, 0x5B6FFF, "Ethical Lighting and Sensor Solutions Limited", "ETHICAL-LIGHTING-AND-SENSOR-SOLUTIONS" },
+	{ 0x70B3D5, 0x5B8000, 0x5B8FFF, "Hella Gutmann Solutions GmbH", "HELLA-GUTMANN-SOLUTIONS" },
+	{ 0x70B3D5, 0x5BC000, 0x5BCFFF, "LAMTEC Meß- und Regeltechnik für Feuerungen GmbH & Co. KG", "LAMTEC-MESS--UND-REGELTECHNIK-FUER-FEUERUNGEN" },
+	{ 0x70B3D5, 0x5BE000, 0x5BEFFF, "CASWA", "CASWA" },
+	{ 0x70B3D5, 0x5BF000, 0x5BFFFF, "Aton srl", "ATON-SRL" },
+	{ 0x70B3D5, 0x5C1000, 0x5C1FFF, "Shanghai JaWay Information Technology Co., Ltd.", "SHANGHAI-JAWAY-INFORMATION" },
+	{ 0x70B3D5, 0x5C4000, 0x5C4FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x5C5000, 0x5C5FFF, "Haag-Streit AG", "HAAG-STREIT" },
+	{ 0x70B3D5, 0x5C8000, 0x5C8FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0x5CA000, 0x5CAFFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
+	{ 0x70B3D5, 0x5CC000, 0x5CCFFF, "Akse srl", "AKSE-SRL" },
+	{ 0x70B3D5, 0x5CD000, 0x5CDFFF, "MVT Video Technologies R + H Maedler GbR", "MVT-VIDEO-TECHNOLOGIES-R-+-H-MAEDLER-GBR" },
+	{ 0x70B3D5, 0x5CF000, 0x5CFFFF, "PROEL TSI s.r.l.", "PROEL-TSI-S-R-L" },
+	{ 0x70B3D5, 0x5D1000, 0x5D1FFF, "Software Motor Corp", "SOFTWARE-MOTOR" },
+	{ 0x70B3D5, 0x5D3000, 0x5D3FFF, "Supracon AG", "SUPRACON" },
+	{ 0x70B3D5, 0x5D5000, 0x5D5FFF, "CT Company", "CT-COMPANY" },
+	{ 0x70B3D5, 0x5D6000, 0x5D6FFF, "BMT Messtechnik Gmbh", "BMT-MESSTECHNIK" },
+	{ 0x70B3D5, 0x5D8000, 0x5D8FFF, "LYNX Technik AG", "LYNX-TECHNIK" },
+	{ 0x70B3D5, 0x5DA000, 0x5DAFFF, "Valk Welding B.V.", "VALK-WELDING" },
+	{ 0x70B3D5, 0x5DB000, 0x5DBFFF, "Movicom LLC", "MOVICOM-LLC" },
+	{ 0x70B3D5, 0x5DC000, 0x5DCFFF, "FactoryLab B.V.", "FACTORYLAB" },
+	{ 0x70B3D5, 0x5DE000, 0x5DEFFF, "Hangzhou AwareTec Technology Co., Ltd", "HANGZHOU-AWARETEC" },
+	{ 0x70B3D5, 0x5E0000, 0x5E0FFF, "Hexagon Metrology SAS", "HEXAGON-METROLOGY-SAS" },
+	{ 0x70B3D5, 0x5E2000, 0x5E2FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x5E3000, 0x5E3FFF, "Imecon Engineering SrL", "IMECON-ENGINEERING-SRL" },
+	{ 0x70B3D5, 0x5E4000, 0x5E4FFF, "DSP DESIGN", "DSP-DESIGN" },
+	{ 0x70B3D5, 0x5E5000, 0x5E5FFF, "HAIYANG OLIX CO.,LTD.", "HAIYANG-OLIX" },
+	{ 0x70B3D5, 0x5E6000, 0x5E6FFF, "Mechatronics Systems Private Limited", "MECHATRONICS-PRIVATE" },
+	{ 0x70B3D5, 0x5E8000, 0x5E8FFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0x5E9000, 0x5E9FFF, "Zehetner-Elektronik GmbH", "ZEHETNER-ELEKTRONIK" },
+	{ 0x70B3D5, 0x5EA000, 0x5EAFFF, "KYS,INC", "KYS" },
+	{ 0x70B3D5, 0x5ED000, 0x5EDFFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
+	{ 0x70B3D5, 0x5EE000, 0x5EEFFF, "Mikrotron Mikrocomputer, Digital- und Analogtechnik GmbH", "MIKROTRON-MIKROCOMPUTER-DIGITAL--UND-ANALOGTECHNIK" },
+	{ 0x70B3D5, 0x5EF000, 0x5EFFFF, "Star Systems International", "STAR" },
+	{ 0x70B3D5, 0x5F0000, 0x5F0FFF, "managee GmbH & Co KG", "MANAGEE" },
+	{ 0x70B3D5, 0x5F1000, 0x5F1FFF, "Fater Rasa Noor", "FATER-RASA-NOOR" },
+	{ 0x70B3D5, 0x5F2000, 0x5F2FFF, "Invisible Systems Limited", "INVISIBLE" },
+	{ 0x70B3D5, 0x5F3000, 0x5F3FFF, "Rtone", "RTONE" },
 	{ 0x70B3D5, 0x5F4000, 0x5F4FFF, "FDSTiming", "FDSTIMING" },
-	{ 0x70B3D5, 0xD75000, 0xD75FFF, "Hyundai MNSOFT", "HYUNDAI-MNSOFT" },
-	{ 0x70B3D5, 0xD9A000, 0xD9AFFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
-	{ 0x70B3D5, 0x32A000, 0x32AFFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
+	{ 0x70B3D5, 0x5F6000, 0x5F6FFF, "FreeFlight Systems", "FREEFLIGHT" },
+	{ 0x70B3D5, 0x5F9000, 0x5F9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x5FA000, 0x5FAFFF, "TEX COMPUTER SRL", "TEX-SRL" },
+	{ 0x70B3D5, 0x5FB000, 0x5FBFFF, "TELEPLATFORMS", "TELEPLATFORMS" },
+	{ 0x70B3D5, 0x5FC000, 0x5FCFFF, "SURTEC", "SURTEC" },
+	{ 0x70B3D5, 0x5FD000, 0x5FDFFF, "Windar Photonics", "WINDAR-PHOTONICS" },
+	{ 0x70B3D5, 0x5FF000, 0x5FFFFF, "Vaisala Oyj", "VAISALA-OYJ" },
+	{ 0x70B3D5, 0x600000, 0x600FFF, "Stellwerk GmbH", "STELLWERK" },
+	{ 0x70B3D5, 0x602000, 0x602FFF, "Quantum Opus, LLC", "QUANTUM-OPUS-LLC" },
+	{ 0x70B3D5, 0x605000, 0x605FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x607000, 0x607FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0x608000, 0x608FFF, "EIIT SA", "EIIT" },
+	{ 0x70B3D5, 0x609000, 0x609FFF, "PBSI Group Limited", "PBSI-GROUP" },
+	{ 0x70B3D5, 0x60A000, 0x60AFFF, "TATA POWER SED", "TATA-POWER-SED" },
+	{ 0x70B3D5, 0x60B000, 0x60BFFF, "Edgeware AB", "EDGEWARE-AB" },
+	{ 0x70B3D5, 0x60C000, 0x60CFFF, "IST ElektronikgesmbH", "IST-ELEKTRONIKGESMBH" },
+	{ 0x70B3D5, 0x60D000, 0x60DFFF, "Link Electric & Safety Control Co.", "LINK-ELECTRIC-SAFETY-CONTROL" },
 	{ 0x70B3D5, 0x60E000, 0x60EFFF, "HDANYWHERE", "HDANYWHERE" },
-	{ 0x70B3D5, 0xEBB000, 0xEBBFFF, "Beijing Wing ICT Technology Co., Ltd.", "BEIJING-WING-ICT" },
-	{ 0x70B3D5, 0xB09000, 0xB09FFF, "FIRST LIGHT IMAGING", "FIRST-LIGHT-IMAGING" },
-	{ 0x70B3D5, 0x18C000, 0x18CFFF, "CMC Industrial Electronics Ltd", "CMC-INDUSTRIAL-ELECTRONICS" },
-	{ 0x70B3D5, 0xAFF000, 0xAFFFFF, "digital-spice", "DIGITAL-SPICE" },
-	{ 0x70B3D5, 0x563000, 0x563FFF, "Zhejiang Hao Teng Electronic Technology Co., Ltd.", "ZHEJIANG-HAO-TENG" },
-	{ 0x70B3D5, 0xC06000, 0xC06FFF, "XotonicsMED GmbH", "XOTONICSMED" },
-	{ 0x70B3D5, 0x2DB000, 0x2DBFFF, "ProtoPixel SL", "PROTOPIXEL-SL" },
-	{ 0x70B3D5, 0xA58000, 0xA58FFF, "MCQ TECH GmbH", "MCQ-TECH" },
-	{ 0x70B3D5, 0x934000, 0x934FFF, "RBS Netkom GmbH", "RBS-NETKOM" },
-	{ 0x70B3D5, 0x13D000, 0x13DFFF, "Elsist Srl", "ELSIST-SRL" },
-	{ 0x70B3D5, 0x3B7000, 0x3B7FFF, "Paul Scherrer Institut (PSI)", "PAUL-SCHERRER-INSTITUT-PSI" },
-	{ 0x70B3D5, 0x94D000, 0x94DFFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
-	{ 0x70B3D5, 0xA4C000, 0xA4CFFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
-	{ 0x70B3D5, 0x90B000, 0x90BFFF, "Matrix Switch Corporation", "MATRIX-SWITCH" },
-	{ 0x70B3D5, 0xC4B000, 0xC4BFFF, "ANKER-EAST", "ANKER-EAST" },
-	{ 0x70B3D5, 0x68E000, 0x68EFFF, "CEA Technologies Pty Ltd", "CEA-TECHNOLOGIES-PTY" },
-	{ 0x70B3D5, 0x542000, 0x542FFF, "RTDS Technologies Inc.", "RTDS-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x1E4000, 0x1E4FFF, "Tecnologix s.r.l.", "TECNOLOGIX-S-R-L" },
-	{ 0x70B3D5, 0x1C5000, 0x1C5FFF, "ELSAG", "ELSAG" },
+	{ 0x70B3D5, 0x60F000, 0x60FFFF, "Tanaka Information System, LLC.", "TANAKA-INFORMATION-SYSTEM-LLC" },
+	{ 0x70B3D5, 0x610000, 0x610FFF, "POLVISION", "POLVISION" },
+	{ 0x70B3D5, 0x611000, 0x611FFF, "Avionica", "AVIONICA" },
+	{ 0x70B3D5, 0x613000, 0x613FFF, "Suprock Technologies", "SUPROCK-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x615000, 0x615FFF, "JSC OTZVUK", "JSC-OTZVUK" },
+	{ 0x70B3D5, 0x616000, 0x616FFF, "Axxess Identification Ltd", "AXXESS-IDENTIFICATION" },
+	{ 0x70B3D5, 0x618000, 0x618FFF, "Motec Pty Ltd", "MOTEC-PTY" },
+	{ 0x70B3D5, 0x61A000, 0x61AFFF, "Rocket Lab Ltd.", "ROCKET-LAB" },
+	{ 0x70B3D5, 0x61B000, 0x61BFFF, "Nubewell Networks Pvt Ltd", "NUBEWELL-NETWORKS-PVT" },
+	{ 0x70B3D5, 0x61C000, 0x61CFFF, "Earth Works", "EARTH-WORKS" },
+	{ 0x70B3D5, 0x61D000, 0x61DFFF, "Telonic Berkeley Inc", "TELONIC-BERKELEY" },
+	{ 0x70B3D5, 0x61E000, 0x61EFFF, "PKE Electronics AG", "PKE-ELECTRONICS" },
+	{ 0x70B3D5, 0x61F000, 0x61FFFF, "Labotect Labor-Technik-Göttingen GmbH", "LABOTECT-LABOR-TECHNIK-GOETTINGEN" },
+	{ 0x70B3D5, 0x623000, 0x623FFF, "Beijing HuaLian Technology Co, Ltd.", "BEIJING-HUALIAN" },
+	{ 0x70B3D5, 0x625000, 0x625FFF, "VX Instruments GmbH", "VX-INSTRUMENTS" },
+	{ 0x70B3D5, 0x628000, 0x628FFF, "MECT S.R.L.", "MECT-S-R-L" },
+	{ 0x70B3D5, 0x62B000, 0x62BFFF, "Silicann Systems GmbH", "SILICANN" },
+	{ 0x70B3D5, 0x630000, 0x630FFF, "LGE", "LGE" },
+	{ 0x70B3D5, 0x631000, 0x631FFF, "SENSO2ME", "SENSO2ME" },
+	{ 0x70B3D5, 0x634000, 0x634FFF, "idaqs Co.,Ltd.", "IDAQS" },
 	{ 0x70B3D5, 0x635000, 0x635FFF, "Cosylab d.d.", "COSYLAB-D-D" },
-	{ 0x70B3D5, 0xD84000, 0xD84FFF, "Sentry360", "SENTRY360" },
-	{ 0x70B3D5, 0x75A000, 0x75AFFF, "Standard Backhaul Communications", "STANDARD-BACKHAUL-COMMUNICATION" },
-	{ 0x70B3D5, 0x482000, 0x482FFF, "Aeryon Labs Inc", "AERYON-LABS" },
-	{ 0x70B3D5, 0xFBF000, 0xFBFFFF, "SenSys (Design Electronics Ltd)", "SENSYS-DESIGN-ELECTRONICS" },
-	{ 0x70B3D5, 0x825000, 0x825FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x039000, 0x039FFF, "DoWoo Digitech", "DOWOO-DIGITECH" },
-	{ 0x70B3D5, 0x27E000, 0x27EFFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
-	{ 0x70B3D5, 0xF83000, 0xF83FFF, "Tata Communications Ltd.", "TATA-COMMUNICATION" },
-	{ 0x70B3D5, 0x60B000, 0x60BFFF, "Edgeware AB", "EDGEWARE-AB" },
-	{ 0x70B3D5, 0x0D9000, 0x0D9FFF, "Brechbuehler AG", "BRECHBUEHLER" },
-	{ 0x70B3D5, 0x37C000, 0x37CFFF, "Merus Power Dynamics Ltd.", "MERUS-POWER-DYNAMICS" },
-	{ 0x70B3D5, 0xEF8000, 0xEF8FFF, "DKS Dienstl.ges. f. Komm.anl. d. Stadt- u. Reg.verk. mbH", "DKS-DIENSTL-GES-F-KOMM-ANL-D-STADT--U-REG-VERK-MBH" },
-	{ 0x70B3D5, 0x4CF000, 0x4CFFFF, "GREEN HOUSE CO., LTD.", "GREEN-HOUSE" },
-	{ 0x70B3D5, 0xD58000, 0xD58FFF, "Idyllic Engineering Pte Ltd", "IDYLLIC-ENGINEERING-PTE" },
-	{ 0x70B3D5, 0x954000, 0x954FFF, "Dot System S.r.l.", "DOT-SYSTEM-S-R-L" },
-	{ 0x70B3D5, 0xD40000, 0xD40FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x880000, 0x880FFF, "Skopei B.V.", "SKOPEI" },
-	{ 0x70B3D5, 0x51C000, 0x51CFFF, "ATX Networks Corp", "ATX-NETWORKS" },
-	{ 0x70B3D5, 0xFBD000, 0xFBDFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x511000, 0x511FFF, "Next Sight srl", "NEXT-SIGHT-SRL" },
-	{ 0x70B3D5, 0xFA7000, 0xFA7FFF, "Nordson Corporation", "NORDSON" },
-	{ 0x70B3D5, 0x85E000, 0x85EFFF, "XLOGIC srl", "XLOGIC-SRL" },
-	{ 0x70B3D5, 0x31C000, 0x31CFFF, "FINANCIERE DE L'OMBREE (eolane)", "FINANCIERE-DE-L-OMBREE-EOLANE" },
-	{ 0x70B3D5, 0xC41000, 0xC41FFF, "Merlin CSI", "MERLIN-CSI" },
-	{ 0x70B3D5, 0x902000, 0x902FFF, "Unlimiterhear co.,ltd. taiwan branch", "UNLIMITERHEAR-TAIWAN-BRANCH" },
-	{ 0x70B3D5, 0xAD1000, 0xAD1FFF, "Sensile Technologies SA", "SENSILE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x397000, 0x397FFF, "Guangxi Hunter Information Industry Co.,Ltd", "GUANGXI-HUNTER-INFORMATION-INDUSTRY" },
+	{ 0x70B3D5, 0x636000, 0x636FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
 	{ 0x70B3D5, 0x637000, 0x637FFF, "INEO-SENSE", "INEO-SENSE" },
-	{ 0x70B3D5, 0x378000, 0x378FFF, "synchrotron SOLEIL", "SYNCHROTRON-SOLEIL" },
-	{ 0x70B3D5, 0x7B2000, 0x7B2FFF, "Rail Power Systems GmbH", "RAIL-POWER" },
-	{ 0x70B3D5, 0xF12000, 0xF12FFF, "Incoil Induktion AB", "INCOIL-INDUKTION-AB" },
-	{ 0x70B3D5, 0x997000, 0x997FFF, "ProTom International", "PROTOM" },
-	{ 0x70B3D5, 0x288000, 0x288FFF, "Bresslergroup", "BRESSLERGROUP" },
-	{ 0x70B3D5, 0x4BE000, 0x4BEFFF, "GY-FX SAS", "GY-FX-SAS" },
-	{ 0x70B3D5, 0x10F000, 0x10FFFF, "neQis", "NEQIS" },
-	{ 0x70B3D5, 0x98C000, 0x98CFFF, "University of Wisconsin Madison - Department of High Energy Physics", "UNIVERSITY-OF-WISCONSIN-MADISON---DEPARTMENT-OF-HIGH-ENERGY-PHYSICS" },
-	{ 0x70B3D5, 0xE04000, 0xE04FFF, "Combilent", "COMBILENT" },
-	{ 0x70B3D5, 0x022000, 0x022FFF, "Ravelin Ltd", "RAVELIN" },
-	{ 0x70B3D5, 0x135000, 0x135FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0xFF1000, 0xFF1FFF, "Data Strategy Limited", "DATA-STRATEGY" },
-	{ 0x70B3D5, 0x002000, 0x002FFF, "Gogo BA", "GOGO-BA" },
-	{ 0x70B3D5, 0x138000, 0x138FFF, "SMITEC S.p.A.", "SMITEC-S-P-A" },
-	{ 0x70B3D5, 0x0B0000, 0x0B0FFF, "Raven Systems Design, Inc", "RAVEN-DESIGN" },
-	{ 0x70B3D5, 0x596000, 0x596FFF, "Mencom Corporation", "MENCOM" },
-	{ 0x70B3D5, 0x17A000, 0x17AFFF, "Gencoa Ltd", "GENCOA" },
-	{ 0x70B3D5, 0xC49000, 0xC49FFF, "BTG Instruments AB", "BTG-INSTRUMENTS-AB" },
-	{ 0x70B3D5, 0x30B000, 0x30BFFF, "Ash Technologies", "ASH-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x6A6000, 0x6A6FFF, "WOW System", "WOW-SYSTEM" },
-	{ 0x70B3D5, 0xFEF000, 0xFEFFFF, "HANGZHOU HUALAN MICROELECTRONIQUE CO.,LTD", "HANGZHOU-HUALAN-MICROELECTRONIQUE" },
-	{ 0x70B3D5, 0x211000, 0x211FFF, "Fracarro srl", "FRACARRO-SRL" },
-	{ 0x70B3D5, 0x60A000, 0x60AFFF, "TATA POWER SED", "TATA-POWER-SED" },
-	{ 0x70B3D5, 0x479000, 0x479FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
-	{ 0x70B3D5, 0x129000, 0x129FFF, "OOO Microlink-Svyaz", "OOO-MICROLINK-SVYAZ" },
+	{ 0x70B3D5, 0x63A000, 0x63AFFF, "DAVE SRL", "DAVE-SRL" },
+	{ 0x70B3D5, 0x63B000, 0x63BFFF, "Lazer Safe Pty Ltd", "LAZER-SAFE-PTY" },
+	{ 0x70B3D5, 0x63C000, 0x63CFFF, "Pivothead", "PIVOTHEAD" },
+	{ 0x70B3D5, 0x63D000, 0x63DFFF, "Storbyte, Inc.", "STORBYTE" },
+	{ 0x70B3D5, 0x63E000, 0x63EFFF, "RIKEN OPTECH CORPORATION", "RIKEN-OPTECH" },
+	{ 0x70B3D5, 0x63F000, 0x63FFFF, "YG COMPANY CO., LTD", "YG-COMPANY" },
+	{ 0x70B3D5, 0x640000, 0x640FFF, "Electronic Equipment Company Pvt. Ltd.", "EQUIPMENT-COMPANY-PVT" },
+	{ 0x70B3D5, 0x643000, 0x643FFF, "Marques,S.A.", "MARQUES" },
+	{ 0x70B3D5, 0x644000, 0x644FFF, "ATX Networks Corp", "ATX-NETWORKS" },
+	{ 0x70B3D5, 0x645000, 0x645FFF, "Project Decibel, Inc.", "PROJECT-DECIBEL" },
+	{ 0x70B3D5, 0x647000, 0x647FFF, "KZTA", "KZTA" },
+	{ 0x70B3D5, 0x649000, 0x649FFF, "swissled technologies AG", "SWISSLED-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x64A000, 0x64AFFF, "Netbric Technology Co.,Ltd.", "NETBRIC" },
+	{ 0x70B3D5, 0x64B000, 0x64BFFF, "Kalfire", "KALFIRE" },
 	{ 0x70B3D5, 0x64C000, 0x64CFFF, "ACEMIS FRANCE", "ACEMIS-FRANCE" },
-	{ 0x70B3D5, 0x763000, 0x763FFF, "A Trap, USA", "A-TRAP-USA" },
-	{ 0x70B3D5, 0x47F000, 0x47FFFF, "ASE GmbH", "ASE" },
-	{ 0x70B3D5, 0x175000, 0x175FFF, "Akribis Systems", "AKRIBIS" },
-	{ 0x70B3D5, 0xDC9000, 0xDC9FFF, "Sensoterra BV", "SENSOTERRA" },
-	{ 0x70B3D5, 0x371000, 0x371FFF, "BEDEROV GmbH", "BEDEROV" },
-	{ 0x70B3D5, 0x59C000, 0x59CFFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x70B3D5, 0xC79000, 0xC79FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0xB04000, 0xB04FFF, "Herrmann Datensysteme GmbH", "HERRMANN-DATENSYSTEME" },
-	{ 0x70B3D5, 0x229000, 0x229FFF, "CONTROL SYSTEMS Srl", "CONTROL-SRL" },
-	{ 0x70B3D5, 0x55E000, 0x55EFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
-	{ 0x70B3D5, 0xEE3000, 0xEE3FFF, "Lithe Technology, LLC", "LITHE-LLC" },
-	{ 0x70B3D5, 0xD69000, 0xD69FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
-	{ 0x70B3D5, 0xFA0000, 0xFA0FFF, "TIAMA", "TIAMA" },
-	{ 0x70B3D5, 0x7DF000, 0x7DFFFF, "RDT Ltd", "RDT" },
-	{ 0x70B3D5, 0x08D000, 0x08DFFF, "Clover Electronics Technology Co., Ltd.", "CLOVER-ELECTRONICS" },
-	{ 0x70B3D5, 0x7D2000, 0x7D2FFF, "SDK Kristall", "SDK-KRISTALL" },
-	{ 0x70B3D5, 0xAF0000, 0xAF0FFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
-	{ 0x70B3D5, 0xD6C000, 0xD6CFFF, "GP Systems GmbH", "GP" },
+	{ 0x70B3D5, 0x64E000, 0x64EFFF, "BigStuff3, Inc.", "BIGSTUFF3" },
+	{ 0x70B3D5, 0x650000, 0x650FFF, "GIFAS-ELECTRIC GmbH", "GIFAS-ELECTRIC" },
+	{ 0x70B3D5, 0x651000, 0x651FFF, "Roxford", "ROXFORD" },
+	{ 0x70B3D5, 0x652000, 0x652FFF, "Robert Bosch, LLC", "ROBERT-BOSCH-LLC" },
+	{ 0x70B3D5, 0x653000, 0x653FFF, "Luxar Tech, Inc.", "LUXAR-TECH" },
+	{ 0x70B3D5, 0x654000, 0x654FFF, "EMAC, Inc.", "EMAC" },
+	{ 0x70B3D5, 0x655000, 0x655FFF, "AOT System GmbH", "AOT-SYSTEM" },
+	{ 0x70B3D5, 0x656000, 0x656FFF, "SonoSound ApS", "SONOSOUND-APS" },
+	{ 0x70B3D5, 0x658000, 0x658FFF, "emperor brands", "EMPEROR-BRANDS" },
+	{ 0x70B3D5, 0x659000, 0x659FFF, "E2G srl", "E2G-SRL" },
+	{ 0x70B3D5, 0x65A000, 0x65AFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x65B000, 0x65BFFF, "Roush", "ROUSH" },
+	{ 0x70B3D5, 0x65C000, 0x65CFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x65D000, 0x65DFFF, "GEGA ELECTRONIQUE", "GEGA-ELECTRONIQUE" },
+	{ 0x70B3D5, 0x660000, 0x660FFF, "Smart Service Technologies CO., LTD", "SMART-SERVICE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x661000, 0x661FFF, "DesignA Electronics Limited", "DESIGNA-ELECTRONICS" },
+	{ 0x70B3D5, 0x664000, 0x664FFF, "Sankyo Intec co.,ltd", "SANKYO-INTEC" },
+	{ 0x70B3D5, 0x665000, 0x665FFF, "CertUsus GmbH", "CERTUSUS" },
+	{ 0x70B3D5, 0x666000, 0x666FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x66A000, 0x66AFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x66B000, 0x66BFFF, "Innitive B.V.", "INNITIVE" },
+	{ 0x70B3D5, 0x670000, 0x670FFF, "Particle sizing systems", "PARTICLE-SIZING" },
+	{ 0x70B3D5, 0x671000, 0x671FFF, "Sea Shell Corporation", "SEA-SHELL" },
+	{ 0x70B3D5, 0x672000, 0x672FFF, "KLEIBER Infrared GmbH", "KLEIBER-INFRARED" },
+	{ 0x70B3D5, 0x673000, 0x673FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
+	{ 0x70B3D5, 0x674000, 0x674FFF, "Fortress Cyber Security", "FORTRESS-CYBER-SECURITY" },
+	{ 0x70B3D5, 0x675000, 0x675FFF, "alfamation spa", "ALFAMATION-SPA" },
+	{ 0x70B3D5, 0x676000, 0x676FFF, "samwooeleco", "SAMWOOELECO" },
+	{ 0x70B3D5, 0x677000, 0x677FFF, "Fraunhofer-Institut IIS", "FRAUNHOFER-INSTITUT-IIS" },
+	{ 0x70B3D5, 0x678000, 0x678FFF, "The Dini Group, La Jolla inc.", "THE-DINI-GROUP-LA-JOLLA" },
+	{ 0x70B3D5, 0x679000, 0x679FFF, "EMAC, Inc.", "EMAC" },
+	{ 0x70B3D5, 0x67B000, 0x67BFFF, "Stesalit Systems Ltd", "STESALIT" },
+	{ 0x70B3D5, 0x67D000, 0x67DFFF, "Acrodea, Inc.", "ACRODEA" },
+	{ 0x70B3D5, 0x680000, 0x680FFF, "BASF Corporation", "BASF" },
+	{ 0x70B3D5, 0x682000, 0x682FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
+	{ 0x70B3D5, 0x686000, 0x686FFF, "Access Protocol Pty Ltd", "ACCESS-PROTOCOL-PTY" },
+	{ 0x70B3D5, 0x688000, 0x688FFF, "MG s.r.l.", "MG-S-R-L" },
+	{ 0x70B3D5, 0x689000, 0x689FFF, "Prisma Telecom Testing Srl", "PRISMA-TELECOM-TESTING-SRL" },
+	{ 0x70B3D5, 0x68C000, 0x68CFFF, "ND METER", "ND-METER" },
+	{ 0x70B3D5, 0x68D000, 0x68DFFF, "Meta-chrom Co. Ltd.", "META-CHROM" },
+	{ 0x70B3D5, 0x68E000, 0x68EFFF, "CEA Technologies Pty Ltd", "CEA-TECHNOLOGIES-PTY" },
+	{ 0x70B3D5, 0x68F000, 0x68FFFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0x692000, 0x692FFF, "HOSIN INDUSTRIAL LIMITED", "HOSIN-INDUSTRIAL" },
+	{ 0x70B3D5, 0x693000, 0x693FFF, "Altron, a.s.", "ALTRON-A-S" },
+	{ 0x70B3D5, 0x694000, 0x694FFF, "MoviTHERM", "MOVITHERM" },
+	{ 0x70B3D5, 0x696000, 0x696FFF, "Open Grow", "OPEN-GROW" },
+	{ 0x70B3D5, 0x697000, 0x697FFF, "Alazar Technologies Inc.", "ALAZAR-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x69C000, 0x69CFFF, "Keepen", "KEEPEN" },
+	{ 0x70B3D5, 0x69E000, 0x69EFFF, "PTYPE Co., LTD.", "PTYPE" },
+	{ 0x70B3D5, 0x69F000, 0x69FFFF, "T+A elektroakustik GmbH & Co.KG", "T+A-ELEKTROAKUSTIK" },
+	{ 0x70B3D5, 0x6A0000, 0x6A0FFF, "Active Research Limited", "ACTIVE-RESEARCH" },
+	{ 0x70B3D5, 0x6A1000, 0x6A1FFF, "GLIAL TECHNOLOGY", "GLIAL" },
+	{ 0x70B3D5, 0x6A5000, 0x6A5FFF, "Akenori PTE LTD", "AKENORI-PTE" },
+	{ 0x70B3D5, 0x6A6000, 0x6A6FFF, "WOW System", "WOW-SYSTEM" },
+	{ 0x70B3D5, 0x6A8000, 0x6A8FFF, "Vitsch Electronics", "VITSCH-ELECTRONICS" },
+	{ 0x70B3D5, 0x6A9000, 0x6A9FFF, "OHMORI ELECTRIC INDUSTRIES CO.LTD", "OHMORI-ELECTRIC-INDUSTRIES" },
+	{ 0x70B3D5, 0x6AD000, 0x6ADFFF, "CONNIT", "CONNIT" },
 	{ 0x70B3D5, 0x6AF000, 0x6AFFFF, "Sensorberg GmbH", "SENSORBERG" },
-	{ 0x70B3D5, 0x18E000, 0x18EFFF, "NIPPON SEIKI CO., LTD.", "NIPPON-SEIKI" },
-	{ 0x70B3D5, 0xC0C000, 0xC0CFFF, "Tech4Race", "TECH4RACE" },
-	{ 0x70B3D5, 0x5D8000, 0x5D8FFF, "LYNX Technik AG", "LYNX-TECHNIK" },
-	{ 0x70B3D5, 0x374000, 0x374FFF, "OOO NPP Mars-Energo", "OOO-NPP-MARS-ENERGO" },
-	{ 0x70B3D5, 0x4A5000, 0x4A5FFF, "Intermind Inc.", "INTERMIND" },
-	{ 0x70B3D5, 0xC1D000, 0xC1DFFF, "Kranze Technology Solutions", "KRANZE-SOLUTIONS" },
-	{ 0x70B3D5, 0xCC3000, 0xCC3FFF, "Fidalia Networks Inc", "FIDALIA-NETWORKS" },
-	{ 0x70B3D5, 0x07F000, 0x07FFFF, "Abalance Corporation", "ABALANCE" },
+	{ 0x70B3D5, 0x6B0000, 0x6B0FFF, "PTYPE Co., LTD.", "PTYPE" },
+	{ 0x70B3D5, 0x6B1000, 0x6B1FFF, "TTC TELEKOMUNIKACE, s.r.o.", "TTC-TELEKOMUNIKACE-S-R-O" },
+	{ 0x70B3D5, 0x6B2000, 0x6B2FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x6B3000, 0x6B3FFF, "DuraComm Corporation", "DURACOMM" },
+	{ 0x70B3D5, 0x6B5000, 0x6B5FFF, "ART SPA", "ART-SPA" },
+	{ 0x70B3D5, 0x6B6000, 0x6B6FFF, "INRADIOS GmbH", "INRADIOS" },
+	{ 0x70B3D5, 0x6B7000, 0x6B7FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x6B8000, 0x6B8FFF, "BT9", "BT9" },
+	{ 0x70B3D5, 0x6BB000, 0x6BBFFF, "LUCEO", "LUCEO" },
+	{ 0x70B3D5, 0x6BE000, 0x6BEFFF, "VANTAGE INTEGRATED SECURITY SOLUTIONS PVT LTD", "VANTAGE-INTEGRATED-SECURITY-SOLUTIONS-PVT" },
+	{ 0x70B3D5, 0x6BF000, 0x6BFFFF, "Otto Bihler Maschinenfabrik GmbH & Co. KG", "OTTO-BIHLER-MASCHINENFABRIK" },
+	{ 0x70B3D5, 0x6C1000, 0x6C1FFF, "Labtronik s.r.l.", "LABTRONIK-S-R-L" },
+	{ 0x70B3D5, 0x6C3000, 0x6C3FFF, "BEIJING ZGH SECURITY RESEARCH INSTITUTE CO., LTD", "BEIJING-ZGH-SECURITY-RESEARCH-INSTITUTE" },
+	{ 0x70B3D5, 0x6C5000, 0x6C5FFF, "CJSC «Russian telecom equipment company» (CJSC RTEC)", "CJSC-«RUSSIAN-TELECOM-EQUIPMENT-COMPANY»-CJSC-RTEC" },
+	{ 0x70B3D5, 0x6C7000, 0x6C7FFF, "Becton Dickinson", "BECTON-DICKINSON" },
+	{ 0x70B3D5, 0x6CD000, 0x6CDFFF, "NORTHBOUND NETWORKS PTY. LTD.", "NORTHBOUND-NETWORKS-PTY" },
+	{ 0x70B3D5, 0x6CF000, 0x6CFFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x6D0000, 0x6D0FFF, "Code Blue Corporation", "CODE-BLUE" },
+	{ 0x70B3D5, 0x6D1000, 0x6D1FFF, "Visual Engineering Technologies Ltd", "VISUAL-ENGINEERING-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x6D2000, 0x6D2FFF, "Ahrens & Birner Company GmbH", "AHRENS-BIRNER-COMPANY" },
+	{ 0x70B3D5, 0x6D3000, 0x6D3FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x6D6000, 0x6D6FFF, "KMtronic Ltd.", "KMTRONIC" },
+	{ 0x70B3D5, 0x6D8000, 0x6D8FFF, "Shanghai YuanAn Environmental Protection Technology Co.,Ltd", "SHANGHAI-YUANAN-ENVIRONMENTAL-PROTECTION" },
+	{ 0x70B3D5, 0x6D9000, 0x6D9FFF, "VECTARE Inc", "VECTARE" },
+	{ 0x70B3D5, 0x6DA000, 0x6DAFFF, "Enovative Networks, Inc.", "ENOVATIVE-NETWORKS" },
+	{ 0x70B3D5, 0x6DF000, 0x6DFFFF, "Mango DSP, Inc.", "MANGO-DSP" },
+	{ 0x70B3D5, 0x6E0000, 0x6E0FFF, "ABB SPA - DMPC", "ABB-SPA---DMPC" },
+	{ 0x70B3D5, 0x6E1000, 0x6E1FFF, "Shanghai Holystar Information Technology Co.,Ltd", "SHANGHAI-HOLYSTAR-INFORMATION" },
+	{ 0x70B3D5, 0x6E4000, 0x6E4FFF, "Institute of Power Engineering, Gdansk Division", "INSTITUTE-OF-POWER-ENGINEERING-GDANSK-DIVISION" },
+	{ 0x70B3D5, 0x6E5000, 0x6E5FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0x6E6000, 0x6E6FFF, "Eleven Engineering Incorporated", "ELEVEN-ENGINEERING-INCORPORATED" },
+	{ 0x70B3D5, 0x6E7000, 0x6E7FFF, "AML", "AML" },
 	{ 0x70B3D5, 0x6E8000, 0x6E8FFF, "Blu Wireless Technology Ltd", "BLU-WIRELESS" },
-	{ 0x70B3D5, 0xCD3000, 0xCD3FFF, "Controlrad", "CONTROLRAD" },
-	{ 0x70B3D5, 0x4E5000, 0x4E5FFF, "viZaar industrial imaging AG", "VIZAAR-INDUSTRIAL-IMAGING" },
-	{ 0x70B3D5, 0xDE6000, 0xDE6FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x839000, 0x839FFF, "Rockwell Collins Canada", "ROCKWELL-COLLINS-CANADA" },
-	{ 0x70B3D5, 0xECE000, 0xECEFFF, "COMM-connect A/S", "COMM-CONNECT-A/S" },
-	{ 0x70B3D5, 0x3AF000, 0x3AFFFF, "Turbo Technologies Corporation", "TURBO-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xE96000, 0xE96FFF, "Cellier Domesticus inc", "CELLIER-DOMESTICUS" },
-	{ 0x70B3D5, 0xBBF000, 0xBBFFFF, "Ensys srl", "ENSYS-SRL" },
-	{ 0x70B3D5, 0x741000, 0x741FFF, "HOW-E", "HOW-E" },
-	{ 0x70B3D5, 0x357000, 0x357FFF, "Movimento Group AB", "MOVIMENTO-GROUP-AB" },
-	{ 0x70B3D5, 0x60D000, 0x60DFFF, "Link Electric & Safety Control Co.", "LINK-ELECTRIC-SAFETY-CONTROL" },
-	{ 0x70B3D5, 0xBA2000, 0xBA2FFF, "MAMAC Systems, Inc.", "MAMAC" },
-	{ 0x70B3D5, 0x3EF000, 0x3EFFFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x70B3D5, 0x3B5000, 0x3B5FFF, "Preston Industries dba PolyScience", "PRESTON-INDUSTRIES-DBA-POLYSCIENCE" },
-	{ 0x70B3D5, 0xC67000, 0xC67FFF, "Collini Dienstleistungs GmbH", "COLLINI-DIENSTLEISTUNGS" },
-	{ 0x70B3D5, 0xE69000, 0xE69FFF, "Fire4 Systems UK Ltd", "FIRE4-UK" },
-	{ 0x70B3D5, 0x98B000, 0x98BFFF, "Richard Paul Russell Ltd", "RICHARD-PAUL-RUSSELL" },
-	{ 0x70B3D5, 0xAEB000, 0xAEBFFF, "Association Romandix", "ASSOCIATION-ROMANDIX" },
-	{ 0x70B3D5, 0xA86000, 0xA86FFF, "Divigraph (Pty) LTD", "DIVIGRAPH-PTY" },
-	{ 0x70B3D5, 0xCCB000, 0xCCBFFF, "RealD", "REALD" },
+	{ 0x70B3D5, 0x6E9000, 0x6E9FFF, "Krontech", "KRONTECH" },
+	{ 0x70B3D5, 0x6EA000, 0x6EAFFF, "Edgeware AB", "EDGEWARE-AB" },
+	{ 0x70B3D5, 0x6EB000, 0x6EBFFF, "QUANTAFLOW", "QUANTAFLOW" },
+	{ 0x70B3D5, 0x6EC000, 0x6ECFFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x6ED000, 0x6EDFFF, "Wiingtech International Co. LTD.", "WIINGTECH" },
+	{ 0x70B3D5, 0x6F0000, 0x6F0FFF, "iTelaSoft Pvt Ltd", "ITELASOFT-PVT" },
+	{ 0x70B3D5, 0x6F2000, 0x6F2FFF, "P&C Micro's Pty Ltd", "P-C-MICRO-S-PTY" },
+	{ 0x70B3D5, 0x6F3000, 0x6F3FFF, "iungo", "IUNGO" },
+	{ 0x70B3D5, 0x6F6000, 0x6F6FFF, "Acco Brands Europe", "ACCO-BRANDS-EUROPE" },
+	{ 0x70B3D5, 0x6F7000, 0x6F7FFF, "EGICON SRL", "EGICON-SRL" },
+	{ 0x70B3D5, 0x6F8000, 0x6F8FFF, "SENSEON Corporation", "SENSEON" },
+	{ 0x70B3D5, 0x6F9000, 0x6F9FFF, "ENVItech s.r.o.", "ENVITECH-S-R-O" },
+	{ 0x70B3D5, 0x6FA000, 0x6FAFFF, "Dataforth Corporation", "DATAFORTH" },
+	{ 0x70B3D5, 0x6FB000, 0x6FBFFF, "Shachihata Inc.", "SHACHIHATA" },
+	{ 0x70B3D5, 0x6FC000, 0x6FCFFF, "MI Inc.", "MI" },
+	{ 0x70B3D5, 0x6FD000, 0x6FDFFF, "Core Akıllı Ev Sistemleri", "CORE-AKıLLı-EV-SISTEMLERI" },
+	{ 0x70B3D5, 0x6FF000, 0x6FFFFF, "AKEO PLUS", "AKEO-PLUS" },
+	{ 0x70B3D5, 0x700000, 0x700FFF, "University Of Groningen", "UNIVERSITY-OF-GRONINGEN" },
+	{ 0x70B3D5, 0x702000, 0x702FFF, "Sensor Highway Ltd", "SENSOR-HIGHWAY" },
+	{ 0x70B3D5, 0x703000, 0x703FFF, "StromIdee GmbH", "STROMIDEE" },
 	{ 0x70B3D5, 0x704000, 0x704FFF, "Melecs EWS GmbH", "MELECS-EWS" },
-	{ 0x70B3D5, 0x8D0000, 0x8D0FFF, "Raft Technologies", "RAFT-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x09B000, 0x09BFFF, "Jacarta Ltd", "JACARTA" },
-	{ 0x70B3D5, 0x049000, 0x049FFF, "APP Engineering, Inc.", "APP-ENGINEERING" },
-	{ 0x70B3D5, 0x5DE000, 0x5DEFFF, "Hangzhou AwareTec Technology Co., Ltd", "HANGZHOU-AWARETEC" },
-	{ 0x70B3D5, 0x1CD000, 0x1CDFFF, "ELEUSI GmbH", "ELEUSI" },
-	{ 0x70B3D5, 0x04D000, 0x04DFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0x36C000, 0x36CFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0xA90000, 0xA90FFF, "ERA a.s.", "ERA-A-S" },
-	{ 0x70B3D5, 0x253000, 0x253FFF, "Wimate Technology Solutions Private Limited", "WIMATE-SOLUTIONS-PRIVATE" },
-	{ 0x70B3D5, 0x993000, 0x993FFF, "ioThings", "IOTHINGS" },
-	{ 0x70B3D5, 0x0D4000, 0x0D4FFF, "Guangzhou Male Industrial Animation Technology Co.,Ltd.", "GUANGZHOU-MALE-INDUSTRIAL-ANIMATION" },
+	{ 0x70B3D5, 0x705000, 0x705FFF, "Digital Matter Pty Ltd", "DIGITAL-MATTER-PTY" },
+	{ 0x70B3D5, 0x706000, 0x706FFF, "Smith Meter, Inc.", "SMITH-METER" },
+	{ 0x70B3D5, 0x707000, 0x707FFF, "Koco Motion US LLC", "KOCO-MOTION-US-LLC" },
+	{ 0x70B3D5, 0x708000, 0x708FFF, "IBM Research GmbH", "IBM-RESEARCH" },
+	{ 0x70B3D5, 0x709000, 0x709FFF, "AML", "AML" },
+	{ 0x70B3D5, 0x70A000, 0x70AFFF, "PULLNET TECHNOLOGY, SA DE CV SSC1012302S73", "PULLNET-DE-CV-SSC1012302S73" },
+	{ 0x70B3D5, 0x70F000, 0x70FFFF, "Alion Science & Technology", "ALION-SCIENCE" },
+	{ 0x70B3D5, 0x710000, 0x710FFF, "Guardian Controls International Ltd", "GUARDIAN-CONTROLS" },
+	{ 0x70B3D5, 0x711000, 0x711FFF, "X-Laser LLC", "X-LASER-LLC" },
+	{ 0x70B3D5, 0x712000, 0x712FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0x714000, 0x714FFF, "Alturna Networks", "ALTURNA-NETWORKS" },
+	{ 0x70B3D5, 0x715000, 0x715FFF, "RIOT", "RIOT" },
+	{ 0x70B3D5, 0x716000, 0x716FFF, "Lode BV", "LODE" },
+	{ 0x70B3D5, 0x717000, 0x717FFF, "Secure Systems & Services", "SECURE-SERVICES" },
+	{ 0x70B3D5, 0x718000, 0x718FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0x71B000, 0x71BFFF, "elsys", "ELSYS" },
+	{ 0x70B3D5, 0x71E000, 0x71EFFF, "Motec Pty Ltd", "MOTEC-PTY" },
+	{ 0x70B3D5, 0x720000, 0x720FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x721000, 0x721FFF, "Zoe Medical", "ZOE-MEDICAL" },
+	{ 0x70B3D5, 0x722000, 0x722FFF, "UMAN", "UMAN" },
+	{ 0x70B3D5, 0x723000, 0x723FFF, "LG Electronics", "LG-ELECTRONICS" },
+	{ 0x70B3D5, 0x724000, 0x724FFF, "Quan International Co., Ltd.", "QUAN" },
+	{ 0x70B3D5, 0x727000, 0x727FFF, "LP Technologies Inc.", "LP-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x728000, 0x728FFF, "BCD Audio", "BCD-AUDIO" },
+	{ 0x70B3D5, 0x729000, 0x729FFF, "EMAC, Inc.", "EMAC" },
+	{ 0x70B3D5, 0x72C000, 0x72CFFF, "NuRi&G Engineering co,.Ltd.", "NURI-G-ENGINEERING" },
+	{ 0x70B3D5, 0x72D000, 0x72DFFF, "Kron Medidores", "KRON-MEDIDORES" },
+	{ 0x70B3D5, 0x72E000, 0x72EFFF, "Maharsystem", "MAHARSYSTEM" },
+	{ 0x70B3D5, 0x730000, 0x730FFF, "Videogenix", "VIDEOGENIX" },
+	{ 0x70B3D5, 0x731000, 0x731FFF, "Phoniro Systems AB", "PHONIRO-AB" },
+	{ 0x70B3D5, 0x732000, 0x732FFF, "TOFWERK AG", "TOFWERK" },
+	{ 0x70B3D5, 0x733000, 0x733FFF, "SA Instrumentation Limited", "INSTRUMENTATION" },
+	{ 0x70B3D5, 0x734000, 0x734FFF, "MANSION INDUSTRY CO., LTD.", "MANSION-INDUSTRY" },
+	{ 0x70B3D5, 0x735000, 0x735FFF, "Swiss Audio", "SWISS-AUDIO" },
+	{ 0x70B3D5, 0x737000, 0x737FFF, "SD Biosensor", "SD-BIOSENSOR" },
+	{ 0x70B3D5, 0x738000, 0x738FFF, "Private", "PRIVATE" },
 	{ 0x70B3D5, 0x739000, 0x739FFF, "Zigencorp, Inc", "ZIGENCORP" },
-	{ 0x70B3D5, 0x526000, 0x526FFF, "FlowNet LLC", "FLOWNET-LLC" },
-	{ 0x70B3D5, 0x224000, 0x224FFF, "Urbana Smart Solutions Pte Ltd", "URBANA-SMART-SOLUTIONS-PTE" },
-	{ 0x70B3D5, 0xB74000, 0xB74FFF, "OnYield Inc Ltd", "ONYIELD" },
+	{ 0x70B3D5, 0x73A000, 0x73AFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x73B000, 0x73BFFF, "S-I-C", "S-I-C" },
+	{ 0x70B3D5, 0x73C000, 0x73CFFF, "Centro de Ingenieria y Desarrollo industrial", "CENTRO-DE-INGENIERIA-Y-DESARROLLO-INDUSTRIAL" },
+	{ 0x70B3D5, 0x73D000, 0x73DFFF, "NETWAYS GmbH", "NETWAYS" },
+	{ 0x70B3D5, 0x73E000, 0x73EFFF, "Trident RFID Pty Ltd", "TRIDENT-RFID-PTY" },
+	{ 0x70B3D5, 0x740000, 0x740FFF, "Prisma Telecom Testing Srl", "PRISMA-TELECOM-TESTING-SRL" },
+	{ 0x70B3D5, 0x741000, 0x741FFF, "HOW-E", "HOW-E" },
+	{ 0x70B3D5, 0x742000, 0x742FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0x743000, 0x743FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
+	{ 0x70B3D5, 0x745000, 0x745FFF, "TMSI LLC", "TMSI-LLC" },
+	{ 0x70B3D5, 0x747000, 0x747FFF, "Eva Automation", "EVA-AUTOMATION" },
+	{ 0x70B3D5, 0x748000, 0x748FFF, "KDT", "KDT" },
 	{ 0x70B3D5, 0x749000, 0x749FFF, "Granite River Labs Inc", "GRANITE-RIVER-LABS" },
-	{ 0x70B3D5, 0x3AD000, 0x3ADFFF, "CT Company", "CT-COMPANY" },
-	{ 0x70B3D5, 0x656000, 0x656FFF, "SonoSound ApS", "SONOSOUND-APS" },
-	{ 0x70B3D5, 0xD09000, 0xD09FFF, "Rishaad Brown", "RISHAAD-BROWN" },
-	{ 0x70B3D5, 0x2A9000, 0x2A9FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0x1D7000, 0x1D7FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x613000, 0x613FFF, "Suprock Technologies", "SUPROCK-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x7D6000, 0x7D6FFF, "Yukilab", "YUKILAB" },
-	{ 0x70B3D5, 0xBAF000, 0xBAFFFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x70B3D5, 0xA37000, 0xA37FFF, "MITSUBISHI HEAVY INDUSTRIES THERMAL SYSTEMS, LTD.", "MITSUBISHI-HEAVY-INDUSTRIES-THERMAL" },
-	{ 0x70B3D5, 0x4EC000, 0x4ECFFF, "Hangzhou Youshi Industry Co., Ltd.", "HANGZHOU-YOUSHI-INDUSTRY" },
-	{ 0x70B3D5, 0x246000, 0x246FFF, "Saline Lectronics, Inc.", "SALINE-LECTRONICS" },
-	{ 0x70B3D5, 0x616000, 0x616FFF, "Axxess Identification Ltd", "AXXESS-IDENTIFICATION" },
-	{ 0x70B3D5, 0xCC5000, 0xCC5FFF, "Intecom", "INTECOM" },
-	{ 0x70B3D5, 0x98F000, 0x98FFFF, "Spaceflight Industries", "SPACEFLIGHT-INDUSTRIES" },
-	{ 0x70B3D5, 0xCAB000, 0xCABFFF, "NOTICE Co., Ltd.", "NOTICE" },
-	{ 0x70B3D5, 0x940000, 0x940FFF, "Paradigm Technology Services B.V.", "PARADIGM-SERVICES" },
-	{ 0x70B3D5, 0xBB4000, 0xBB4FFF, "Integritech", "INTEGRITECH" },
-	{ 0x70B3D5, 0xC6C000, 0xC6CFFF, "McQ Inc", "MCQ" },
-	{ 0x70B3D5, 0xBFB000, 0xBFBFFF, "Sensor 42", "SENSOR-42" },
-	{ 0x70B3D5, 0xC4D000, 0xC4DFFF, "RADA Electronics Industries Ltd.", "RADA-ELECTRONICS-INDUSTRIES" },
-	{ 0x70B3D5, 0xEA6000, 0xEA6FFF, "Galios", "GALIOS" },
-	{ 0x70B3D5, 0xFD6000, 0xFD6FFF, "Visual Fan", "VISUAL-FAN" },
-	{ 0x70B3D5, 0x717000, 0x717FFF, "Secure Systems & Services", "SECURE-SERVICES" },
+	{ 0x70B3D5, 0x74A000, 0x74AFFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
+	{ 0x70B3D5, 0x74C000, 0x74CFFF, "Kwant Controls BV", "KWANT-CONTROLS" },
+	{ 0x70B3D5, 0x74D000, 0x74DFFF, "SPEECH TECHNOLOGY CENTER LIMITED", "SPEECH-CENTER" },
+	{ 0x70B3D5, 0x74E000, 0x74EFFF, "PushCorp, Inc.", "PUSHCORP" },
+	{ 0x70B3D5, 0x74F000, 0x74FFFF, "United States Technologies Inc.", "UNITED-STATES-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x750000, 0x750FFF, "Neurio Technology Inc.", "NEURIO" },
+	{ 0x70B3D5, 0x751000, 0x751FFF, "GNF", "GNF" },
+	{ 0x70B3D5, 0x753000, 0x753FFF, "HCH. Kündig & CIE. AG", "HCH-KUENDIG-CIE" },
+	{ 0x70B3D5, 0x755000, 0x755FFF, "LandmarkTech Systems Technology Co.,Ltd.", "LANDMARKTECH" },
+	{ 0x70B3D5, 0x758000, 0x758FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0x759000, 0x759FFF, "AML", "AML" },
+	{ 0x70B3D5, 0x75A000, 0x75AFFF, "Standard Backhaul Communications", "STANDARD-BACKHAUL-COMMUNICATION" },
+	{ 0x70B3D5, 0x75B000, 0x75BFFF, "Netool LLC", "NETOOL-LLC" },
+	{ 0x70B3D5, 0x75C000, 0x75CFFF, "UPM Technology, Inc", "UPM" },
+	{ 0x70B3D5, 0x75D000, 0x75DFFF, "Nanjing Magewell Electronics Co., Ltd.", "NANJING-MAGEWELL-ELECTRONICS" },
+	{ 0x70B3D5, 0x75E000, 0x75EFFF, "Cardinal Health", "CARDINAL-HEALTH" },
+	{ 0x70B3D5, 0x75F000, 0x75FFFF, "Vocality international T/A Cubic", "VOCALITY-T/A-CUBIC" },
+	{ 0x70B3D5, 0x760000, 0x760FFF, "QUALITTEQ LLC", "QUALITTEQ-LLC" },
+	{ 0x70B3D5, 0x761000, 0x761FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0x763000, 0x763FFF, "A Trap, USA", "A-TRAP-USA" },
+	{ 0x70B3D5, 0x764000, 0x764FFF, "SCHMID electronic", "SCHMID" },
+	{ 0x70B3D5, 0x766000, 0x766FFF, "Tirasoft Nederland", "TIRASOFT-NEDERLAND" },
+	{ 0x70B3D5, 0x767000, 0x767FFF, "FRANKLIN FRANCE", "FRANKLIN-FRANCE" },
+	{ 0x70B3D5, 0x768000, 0x768FFF, "Kazan Networks Corporation", "KAZAN-NETWORKS" },
+	{ 0x70B3D5, 0x76A000, 0x76AFFF, "Swiftnet SOC Ltd", "SWIFTNET-SOC" },
+	{ 0x70B3D5, 0x76B000, 0x76BFFF, "EMPELOR GmbH", "EMPELOR" },
+	{ 0x70B3D5, 0x76C000, 0x76CFFF, "Aural Ltd", "AURAL" },
+	{ 0x70B3D5, 0x76D000, 0x76DFFF, "Trimble", "TRIMBLE" },
+	{ 0x70B3D5, 0x76E000, 0x76EFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0x76F000, 0x76FFFF, "OTI LTD", "OTI" },
+	{ 0x70B3D5, 0x770000, 0x770FFF, "STREGA", "STREGA" },
+	{ 0x70B3D5, 0x771000, 0x771FFF, "Apator Miitors ApS", "APATOR-MIITORS-APS" },
+	{ 0x70B3D5, 0x772000, 0x772FFF, "enModus", "ENMODUS" },
+	{ 0x70B3D5, 0x773000, 0x773FFF, "Rugged Science", "RUGGED-SCIENCE" },
+	{ 0x70B3D5, 0x774000, 0x774FFF, "Micram Instruments Ltd", "MICRAM-INSTRUMENTS" },
+	{ 0x70B3D5, 0x775000, 0x775FFF, "Sonel S.A.", "SONEL" },
+	{ 0x70B3D5, 0x776000, 0x776FFF, "Power Ltd.", "POWER" },
+	{ 0x70B3D5, 0x777000, 0x777FFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
+	{ 0x70B3D5, 0x778000, 0x778FFF, "Lumacron Technology Ltd.", "LUMACRON" },
+	{ 0x70B3D5, 0x779000, 0x779FFF, "DR.BRIDGE AQUATECH", "DR-BRIDGE-AQUATECH" },
+	{ 0x70B3D5, 0x77B000, 0x77BFFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
+	{ 0x70B3D5, 0x77C000, 0x77CFFF, "HUSTY M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
+	{ 0x70B3D5, 0x77E000, 0x77EFFF, "Blue Marble Communications, Inc.", "BLUE-MARBLE-COMMUNICATION" },
+	{ 0x70B3D5, 0x781000, 0x781FFF, "Project Service S.a.s.", "PROJECT-SERVICE-S" },
 	{ 0x70B3D5, 0x782000, 0x782FFF, "thou&tech", "THOU-TECH" },
-	{ 0x70B3D5, 0x5DC000, 0x5DCFFF, "FactoryLab B.V.", "FACTORYLAB" },
-	{ 0x70B3D5, 0xAF2000, 0xAF2FFF, "True Networks Ltd.", "TRUE-NETWORKS" },
-	{ 0x70B3D5, 0x63D000, 0x63DFFF, "Storbyte, Inc.", "STORBYTE" },
 	{ 0x70B3D5, 0x784000, 0x784FFF, "Shenzhen bayue software co. LTD", "SHENZHEN-BAYUE-SOFTWARE" },
-	{ 0x70B3D5, 0xFA3000, 0xFA3FFF, "ELVA-1 MICROWAVE HANDELSBOLAG", "ELVA-1-MICROWAVE-HANDELSBOLAG" },
-	{ 0x70B3D5, 0x853000, 0x853FFF, "HGH SYSTEMES INFRAROUGES", "HGH-SYSTEMES-INFRAROUGES" },
-	{ 0x70B3D5, 0x0AF000, 0x0AFFFF, "KMtronic ltd", "KMTRONIC" },
-	{ 0x70B3D5, 0x9E6000, 0x9E6FFF, "BLOCKSI LLC", "BLOCKSI-LLC" },
-	{ 0x70B3D5, 0x0F8000, 0x0F8FFF, "Special Services Group, LLC", "SPECIAL-SERVICES-GROUP-LLC" },
-	{ 0x70B3D5, 0xA17000, 0xA17FFF, "Tunstall A/S", "TUNSTALL-A/S" },
-	{ 0x70B3D5, 0xC9F000, 0xC9FFFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0x785000, 0x785FFF, "Density Inc.", "DENSITY" },
+	{ 0x70B3D5, 0x789000, 0x789FFF, "SEMEX-EngCon GmbH", "SEMEX-ENGCON" },
+	{ 0x70B3D5, 0x78A000, 0x78AFFF, "Hills Health Solutions", "HILLS-HEALTH-SOLUTIONS" },
+	{ 0x70B3D5, 0x78B000, 0x78BFFF, "Jingtu Printing Systems Co., Ltd", "JINGTU-PRINTING" },
+	{ 0x70B3D5, 0x78C000, 0x78CFFF, "Survalent Technology Corporation", "SURVALENT" },
+	{ 0x70B3D5, 0x78E000, 0x78EFFF, "effectas GmbH", "EFFECTAS" },
+	{ 0x70B3D5, 0x78F000, 0x78FFFF, "SoFiHa", "SOFIHA" },
+	{ 0x70B3D5, 0x790000, 0x790FFF, "AVI Pty Ltd", "AVI-PTY" },
+	{ 0x70B3D5, 0x791000, 0x791FFF, "Romteck Australia", "ROMTECK-AUSTRALIA" },
+	{ 0x70B3D5, 0x793000, 0x793FFF, "Gastech Australia Pty Ltd", "GASTECH-AUSTRALIA-PTY" },
+	{ 0x70B3D5, 0x794000, 0x794FFF, "Shadin Avionics", "SHADIN-AVIONICS" },
+	{ 0x70B3D5, 0x796000, 0x796FFF, "GAMPT mbH", "GAMPT-MBH" },
+	{ 0x70B3D5, 0x799000, 0x799FFF, "Vitec System Engineering Inc.", "VITEC-SYSTEM-ENGINEERING" },
+	{ 0x70B3D5, 0x79A000, 0x79AFFF, "Innerspec Technologies Inc.", "INNERSPEC-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x79B000, 0x79BFFF, "Soniclean Pty Ltd", "SONICLEAN-PTY" },
+	{ 0x70B3D5, 0x79E000, 0x79EFFF, "CW2. Gmbh & Co. KG", "CW2" },
+	{ 0x70B3D5, 0x7A0000, 0x7A0FFF, "Reactec Ltd", "REACTEC" },
+	{ 0x70B3D5, 0x7A1000, 0x7A1FFF, "Excelfore Corporation", "EXCELFORE" },
+	{ 0x70B3D5, 0x7A2000, 0x7A2FFF, "Alpha ESS Co., Ltd.", "ALPHA-ESS" },
+	{ 0x70B3D5, 0x7A3000, 0x7A3FFF, "Impulse Automation", "IMPULSE-AUTOMATION" },
+	{ 0x70B3D5, 0x7A4000, 0x7A4FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0x7A5000, 0x7A5FFF, "Triton Electronics Ltd", "TRITON-ELECTRONICS" },
+	{ 0x70B3D5, 0x7A6000, 0x7A6FFF, "Electrolux", "ELECTROLUX" },
+	{ 0x70B3D5, 0x7A7000, 0x7A7FFF, "Symbicon Ltd", "SYMBICON" },
+	{ 0x70B3D5, 0x7A8000, 0x7A8FFF, "dieEntwickler Elektronik GmbH", "DIEENTWICKLER-ELEKTRONIK" },
+	{ 0x70B3D5, 0x7A9000, 0x7A9FFF, "adidas AG", "ADIDAS" },
+	{ 0x70B3D5, 0x7AA000, 0x7AAFFF, "Sadel S.p.A.", "SADEL-S-P-A" },
+	{ 0x70B3D5, 0x7AB000, 0x7ABFFF, "Microgate Srl", "MICROGATE-SRL" },
+	{ 0x70B3D5, 0x7AC000, 0x7ACFFF, "Verity Studios AG", "VERITY-STUDIOS" },
+	{ 0x70B3D5, 0x7AD000, 0x7ADFFF, "Insitu, Inc", "INSITU" },
+	{ 0x70B3D5, 0x7AE000, 0x7AEFFF, "Exi Flow Measurement Ltd", "EXI-FLOW-MEASUREMENT" },
+	{ 0x70B3D5, 0x7AF000, 0x7AFFFF, "Hessware GmbH", "HESSWARE" },
+	{ 0x70B3D5, 0x7B0000, 0x7B0FFF, "Medisafe International", "MEDISAFE" },
+	{ 0x70B3D5, 0x7B2000, 0x7B2FFF, "Rail Power Systems GmbH", "RAIL-POWER" },
+	{ 0x70B3D5, 0x7B3000, 0x7B3FFF, "BroadSoft Inc", "BROADSOFT" },
+	{ 0x70B3D5, 0x7B4000, 0x7B4FFF, "Zumbach Electronic AG", "ZUMBACH" },
+	{ 0x70B3D5, 0x7B6000, 0x7B6FFF, "Amada Miyachi America Inc.", "AMADA-MIYACHI-AMERICA" },
+	{ 0x70B3D5, 0x7B7000, 0x7B7FFF, "LSB - LA SALLE BLANCHE", "LSB---LA-SALLE-BLANCHE" },
+	{ 0x70B3D5, 0x7B8000, 0x7B8FFF, "SerEnergy A/S", "SERENERGY-A/S" },
+	{ 0x70B3D5, 0x7B9000, 0x7B9FFF, "QIAGEN Instruments AG", "QIAGEN-INSTRUMENTS" },
+	{ 0x70B3D5, 0x7BF000, 0x7BFFFF, "Stone Three", "STONE-THREE" },
+	{ 0x70B3D5, 0x7C0000, 0x7C0FFF, "TORGOVYY DOM TEHNOLOGIY LLC", "TORGOVYY-DOM-TEHNOLOGIY-LLC" },
+	{ 0x70B3D5, 0x7C1000, 0x7C1FFF, "Data Sciences International", "DATA-SCIENCES" },
+	{ 0x70B3D5, 0x7C2000, 0x7C2FFF, "Morgan Schaffer Inc.", "MORGAN-SCHAFFER" },
+	{ 0x70B3D5, 0x7C3000, 0x7C3FFF, "Flexim Security Oy", "FLEXIM-SECURITY-OY" },
+	{ 0x70B3D5, 0x7C7000, 0x7C7FFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0x7C8000, 0x7C8FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x7C9000, 0x7C9FFF, "Council Rock", "COUNCIL-ROCK" },
+	{ 0x70B3D5, 0x7CD000, 0x7CDFFF, "Molekuler Goruntuleme A.S.", "MOLEKULER-GORUNTULEME-A-S" },
+	{ 0x70B3D5, 0x7CE000, 0x7CEFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x7CF000, 0x7CFFFF, "ORCA Technologies, LLC", "ORCA-TECHNOLOGIES-LLC" },
+	{ 0x70B3D5, 0x7D0000, 0x7D0FFF, "Cubitech", "CUBITECH" },
+	{ 0x70B3D5, 0x7D1000, 0x7D1FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
+	{ 0x70B3D5, 0x7D2000, 0x7D2FFF, "SDK Kristall", "SDK-KRISTALL" },
+	{ 0x70B3D5, 0x7D5000, 0x7D5FFF, "SICS Swedish ICT", "SICS-SWEDISH-ICT" },
+	{ 0x70B3D5, 0x7D6000, 0x7D6FFF, "Yukilab", "YUKILAB" },
 	{ 0x70B3D5, 0x7D7000, 0x7D7FFF, "Gedomo GmbH", "GEDOMO" },
-	{ 0x70B3D5, 0xD37000, 0xD37FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0x8B7000, 0x8B7FFF, "Contec DTx", "CONTEC-DTX" },
-	{ 0x70B3D5, 0x4A6000, 0x4A6FFF, "HZHY TECHNOLOGY", "HZHY" },
-	{ 0x70B3D5, 0x23A000, 0x23AFFF, "Mesa Labs, Inc.", "MESA-LABS" },
-	{ 0x70B3D5, 0xCA2000, 0xCA2FFF, "De Haardt bv", "DE-HAARDT" },
-	{ 0x70B3D5, 0x10E000, 0x10EFFF, "Colorimetry Research, Inc", "COLORIMETRY-RESEARCH" },
-	{ 0x70B3D5, 0xEF4000, 0xEF4FFF, "Orange Tree Technologies Ltd", "ORANGE-TREE-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x375000, 0x375FFF, "Adel System srl", "ADEL-SYSTEM-SRL" },
-	{ 0x70B3D5, 0xA76000, 0xA76FFF, "Pietro Fiorentini", "PIETRO-FIORENTINI" },
-	{ 0x70B3D5, 0x722000, 0x722FFF, "UMAN", "UMAN" },
-	{ 0x70B3D5, 0xBCE000, 0xBCEFFF, "YAWATA ELECTRIC INDUSTRIAL CO.,LTD.", "YAWATA-ELECTRIC-INDUSTRIAL" },
-	{ 0x70B3D5, 0xC65000, 0xC65FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0xDC8000, 0xDC8FFF, "Enertex Bayern GmbH", "ENERTEX-BAYERN" },
-	{ 0x70B3D5, 0x1BE000, 0x1BEFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0x21F000, 0x21FFFF, "CHRONOMEDIA", "CHRONOMEDIA" },
-	{ 0x70B3D5, 0xEEF000, 0xEEFFFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x67D000, 0x67DFFF, "Acrodea, Inc.", "ACRODEA" },
-	{ 0x70B3D5, 0xA54000, 0xA54FFF, "provedo", "PROVEDO" },
-	{ 0x70B3D5, 0x770000, 0x770FFF, "STREGA", "STREGA" },
-	{ 0x70B3D5, 0x857000, 0x857FFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
-	{ 0x70B3D5, 0x876000, 0x876FFF, "IONETECH", "IONETECH" },
-	{ 0x70B3D5, 0x8EB000, 0x8EBFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
-	{ 0x70B3D5, 0xC1A000, 0xC1AFFF, "Xylon", "XYLON" },
-	{ 0x70B3D5, 0x084000, 0x084FFF, "Rako Controls Ltd", "RAKO-CONTROLS" },
-	{ 0x70B3D5, 0x53C000, 0x53CFFF, "Airthings", "AIRTHINGS" },
-	{ 0x70B3D5, 0x014000, 0x014FFF, "FRAKO Kondensatoren und Anlagenbau GmbH", "FRAKO-KONDENSATOREN-UND-ANLAGENBAU" },
-	{ 0x70B3D5, 0xF14000, 0xF14FFF, "SANYU SWITCH CO., LTD.", "SANYU-SWITCH" },
-	{ 0x70B3D5, 0xB4A000, 0xB4AFFF, "MEDEX", "MEDEX" },
-	{ 0x70B3D5, 0x17F000, 0x17FFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0xB39000, 0xB39FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x162000, 0x162FFF, "ESPAI DE PRODUCCIÓ I ELECTRÓNI", "ESPAI-DE-PRODUCCIÓ-I-ELECTRÓNI" },
-	{ 0x70B3D5, 0xEA8000, 0xEA8FFF, "Dia-Stron Limited", "DIA-STRON" },
-	{ 0x70B3D5, 0x5F9000, 0x5F9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x123000, 0x123FFF, "Amfitech ApS", "AMFITECH-APS" },
-	{ 0x70B3D5, 0x0BF000, 0x0BFFFF, "Den Automation", "DEN-AUTOMATION" },
-	{ 0x70B3D5, 0x9C7000, 0x9C7FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0x758000, 0x758FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x02F000, 0x02FFFF, "LEGENDAIRE TECHNOLOGY CO., LTD.", "LEGENDAIRE" },
-	{ 0x70B3D5, 0xB1F000, 0xB1FFFF, "TECNOWATT", "TECNOWATT" },
-	{ 0x70B3D5, 0xF4D000, 0xF4DFFF, "Honeywell", "HONEYWELL" },
+	{ 0x70B3D5, 0x7D9000, 0x7D9FFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
+	{ 0x70B3D5, 0x7DC000, 0x7DCFFF, "Software Systems Plus", "SOFTWARE-PLUS" },
+	{ 0x70B3D5, 0x7DD000, 0x7DDFFF, "Excel Medical Electronics LLC", "EXCEL-MEDICAL-ELECTRONICS-LLC" },
+	{ 0x70B3D5, 0x7DE000, 0x7DEFFF, "Telaeris, Inc.", "TELAERIS" },
+	{ 0x70B3D5, 0x7DF000, 0x7DFFFF, "RDT Ltd", "RDT" },
+	{ 0x70B3D5, 0x7E0000, 0x7E0FFF, "Sanko-sha,inc.", "SANKO-SHA" },
+	{ 0x70B3D5, 0x7E1000, 0x7E1FFF, "Applied Materials", "APPLIED-MATERIALS" },
+	{ 0x70B3D5, 0x7E2000, 0x7E2FFF, "Depro Électronique inc", "DEPRO-ÉLECTRONIQUE" },
+	{ 0x70B3D5, 0x7E3000, 0x7E3FFF, "RedLeaf Security", "REDLEAF-SECURITY" },
+	{ 0x70B3D5, 0x7E4000, 0x7E4FFF, "C21 Systems Ltd", "C21" },
+	{ 0x70B3D5, 0x7E5000, 0x7E5FFF, "Megaflex Oy", "MEGAFLEX-OY" },
+	{ 0x70B3D5, 0x7E7000, 0x7E7FFF, "Atessa, Inc.", "ATESSA" },
+	{ 0x70B3D5, 0x7E8000, 0x7E8FFF, "Mannkind Corporation", "MANNKIND" },
+	{ 0x70B3D5, 0x7E9000, 0x7E9FFF, "Mecsel Oy", "MECSEL-OY" },
+	{ 0x70B3D5, 0x7EA000, 0x7EAFFF, "Waterkotte GmbH", "WATERKOTTE" },
+	{ 0x70B3D5, 0x7EB000, 0x7EBFFF, "Xerox International Partners", "XEROX-PARTNERS" },
+	{ 0x70B3D5, 0x7EC000, 0x7ECFFF, "GRIDSMART Technologies", "GRIDSMART-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x7ED000, 0x7EDFFF, "The Things Network Foundation", "THE-THINGS-NETWORK-FOUNDATION" },
+	{ 0x70B3D5, 0x7EE000, 0x7EEFFF, "ADVEEZ", "ADVEEZ" },
+	{ 0x70B3D5, 0x7EF000, 0x7EFFFF, "CRAVIS CO., LIMITED", "CRAVIS" },
+	{ 0x70B3D5, 0x7F1000, 0x7F1FFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
+	{ 0x70B3D5, 0x7F2000, 0x7F2FFF, "TCI", "TCI" },
+	{ 0x70B3D5, 0x7F3000, 0x7F3FFF, "Shenzhen Virtual Clusters Information Technology Co.,Ltd.", "SHENZHEN-VIRTUAL-CLUSTERS-INFORMATION" },
+	{ 0x70B3D5, 0x7F4000, 0x7F4FFF, "KST technology", "KST" },
 	{ 0x70B3D5, 0x7F5000, 0x7F5FFF, "Incusense", "INCUSENSE" },
+	{ 0x70B3D5, 0x7F7000, 0x7F7FFF, "JASCO Applied Sciences Canada Ltd", "JASCO-APPLIED-SCIENCES-CANADA" },
+	{ 0x70B3D5, 0x7F8000, 0x7F8FFF, "Solvera Lynx d.d.", "SOLVERA-LYNX-D-D" },
+	{ 0x70B3D5, 0x7F9000, 0x7F9FFF, "Communication Systems Solutions", "COMMUNICATION-SOLUTIONS" },
+	{ 0x70B3D5, 0x7FB000, 0x7FBFFF, "db Broadcast Products Ltd", "DB-BROADCAST-PRODUCTS" },
+	{ 0x70B3D5, 0x7FD000, 0x7FDFFF, "SYS TEC electronic GmbH", "SYS-TEC" },
+	{ 0x70B3D5, 0x7FE000, 0x7FEFFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
+	{ 0x70B3D5, 0x802000, 0x802FFF, "Qingdao CNR HITACH Railway Signal&communication co.,ltd", "QINGDAO-CNR-HITACH-RAILWAY-SIGNAL-COMMUNICATION" },
+	{ 0x70B3D5, 0x804000, 0x804FFF, "PMT Corporation", "PMT" },
+	{ 0x70B3D5, 0x805000, 0x805FFF, "Eurotronik Kranj d.o.o.", "EUROTRONIK-KRANJ-D-O-O" },
+	{ 0x70B3D5, 0x807000, 0x807FFF, "Camsat Przemysław Gralak", "CAMSAT-PRZEMYSłAW-GRALAK" },
+	{ 0x70B3D5, 0x809000, 0x809FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
+	{ 0x70B3D5, 0x80A000, 0x80AFFF, "SENSING LABS", "SENSING-LABS" },
+	{ 0x70B3D5, 0x80B000, 0x80BFFF, "Fischer Block, Inc.", "FISCHER-BLOCK" },
+	{ 0x70B3D5, 0x80D000, 0x80DFFF, "Data Physics Corporation", "DATA-PHYSICS" },
+	{ 0x70B3D5, 0x80F000, 0x80FFFF, "Quickware Eng & Des LLC", "QUICKWARE-ENG-DES-LLC" },
+	{ 0x70B3D5, 0x810000, 0x810FFF, "Advice", "ADVICE" },
+	{ 0x70B3D5, 0x811000, 0x811FFF, "CJSC «INTERSET»", "CJSC-«INTERSET»" },
+	{ 0x70B3D5, 0x813000, 0x813FFF, "Wavemed srl", "WAVEMED-SRL" },
+	{ 0x70B3D5, 0x814000, 0x814FFF, "Ingenieurbuero SOMTRONIK", "INGENIEURBUERO-SOMTRONIK" },
+	{ 0x70B3D5, 0x816000, 0x816FFF, "Smith Meter, Inc.", "SMITH-METER" },
+	{ 0x70B3D5, 0x817000, 0x817FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x818000, 0x818FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x819000, 0x819FFF, "«Intellect module» LLC", "«INTELLECT-MODULE»-LLC" },
+	{ 0x70B3D5, 0x81A000, 0x81AFFF, "Joehl & Koeferli AG", "JOEHL-KOEFERLI" },
+	{ 0x70B3D5, 0x81B000, 0x81BFFF, "bobz GmbH", "BOBZ" },
+	{ 0x70B3D5, 0x81E000, 0x81EFFF, "Novathings", "NOVATHINGS" },
+	{ 0x70B3D5, 0x820000, 0x820FFF, "Becker Nachrichtentechnik GmbH", "BECKER-NACHRICHTENTECHNIK" },
+	{ 0x70B3D5, 0x821000, 0x821FFF, "HL2 group", "HL2-GROUP" },
+	{ 0x70B3D5, 0x823000, 0x823FFF, "SP Controls", "SP-CONTROLS" },
+	{ 0x70B3D5, 0x825000, 0x825FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x826000, 0x826FFF, "Elbit Systems of America", "ELBIT-OF-AMERICA" },
+	{ 0x70B3D5, 0x827000, 0x827FFF, "Metromatics Pty Ltd", "METROMATICS-PTY" },
+	{ 0x70B3D5, 0x828000, 0x828FFF, "Xacti Corporation", "XACTI" },
+	{ 0x70B3D5, 0x82C000, 0x82CFFF, "NELS Ltd.", "NELS" },
+	{ 0x70B3D5, 0x82D000, 0x82DFFF, "Elektronik Art S.C.", "ELEKTRONIK-ART-S-C" },
+	{ 0x70B3D5, 0x82E000, 0x82EFFF, "PlayAlive A/S", "PLAYALIVE-A/S" },
+	{ 0x70B3D5, 0x831000, 0x831FFF, "Arnouse Digital Devices Corp", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x70B3D5, 0x833000, 0x833FFF, "Alpiq InTec Management AG", "ALPIQ-INTEC-MANAGEMENT" },
+	{ 0x70B3D5, 0x835000, 0x835FFF, "CommBox P/L", "COMMBOX-P/L" },
+	{ 0x70B3D5, 0x837000, 0x837FFF, "HiDes, Inc.", "HIDES" },
+	{ 0x70B3D5, 0x838000, 0x838FFF, "Tofino", "TOFINO" },
+	{ 0x70B3D5, 0x839000, 0x839FFF, "Rockwell Collins Canada", "ROCKWELL-COLLINS-CANADA" },
+	{ 0x70B3D5, 0x83B000, 0x83BFFF, "Telefonix Incorporated", "TELEFONIX-INCORPORATED" },
+	{ 0x70B3D5, 0x83C000, 0x83CFFF, "Sinoembed", "SINOEMBED" },
+	{ 0x70B3D5, 0x83F000, 0x83FFFF, "Lumine Lighting Solutions Oy", "LUMINE-LIGHTING-SOLUTIONS-OY" },
+	{ 0x70B3D5, 0x840000, 0x840FFF, "xm", "XM" },
+	{ 0x70B3D5, 0x841000, 0x841FFF, "Stanet Co.,Ltd", "STANET" },
+	{ 0x70B3D5, 0x842000, 0x842FFF, "PLUTO Solution co.,ltd.", "PLUTO-SOLUTION" },
+	{ 0x70B3D5, 0x844000, 0x844FFF, "SANSFIL Technologies", "SANSFIL-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x845000, 0x845FFF, "Harborside Technology", "HARBORSIDE" },
+	{ 0x70B3D5, 0x847000, 0x847FFF, "Ai-Lynx", "AI-LYNX" },
 	{ 0x70B3D5, 0x848000, 0x848FFF, "Aldridge Electrical Industries", "ALDRIDGE-ELECTRICAL-INDUSTRIES" },
-	{ 0x70B3D5, 0x8C6000, 0x8C6FFF, "Onosokki Co.,Ltd", "ONOSOKKI" },
-	{ 0x70B3D5, 0xDB6000, 0xDB6FFF, "csintech", "CSINTECH" },
-	{ 0x70B3D5, 0x225000, 0x225FFF, "RCD Radiokomunikace", "RCD-RADIOKOMUNIKACE" },
-	{ 0x70B3D5, 0xDA5000, 0xDA5FFF, "Roboteq", "ROBOTEQ" },
-	{ 0x70B3D5, 0x235000, 0x235FFF, "CAMEON S.A.", "CAMEON" },
-	{ 0x70B3D5, 0x280000, 0x280FFF, "Computech International", "COMPUTECH" },
-	{ 0x70B3D5, 0x9D1000, 0x9D1FFF, "OS42 UG (haftungsbeschraenkt)", "OS42-UG-HAFTUNGSBESCHRAENKT" },
-	{ 0x70B3D5, 0xE61000, 0xE61FFF, "Adeli", "ADELI" },
-	{ 0x70B3D5, 0x2A3000, 0x2A3FFF, "ATT Nussbaum Prüftechnik GmbH", "ATT-NUSSBAUM-PRUEFTECHNIK" },
-	{ 0x70B3D5, 0xC35000, 0xC35FFF, "Vibrationmaster", "VIBRATIONMASTER" },
-	{ 0x70B3D5, 0xBCB000, 0xBCBFFF, "Smart Vision Lights", "SMART-VISION-LIGHTS" },
-	{ 0x70B3D5, 0x15E000, 0x15EFFF, "Season Electronics Ltd", "SEASON-ELECTRONICS" },
-	{ 0x70B3D5, 0x53D000, 0x53DFFF, "ACCEL CORP", "ACCEL" },
-	{ 0x70B3D5, 0xED7000, 0xED7FFF, "WAVE", "WAVE" },
-	{ 0x70B3D5, 0x11B000, 0x11BFFF, "HoseoTelnet Inc...", "HOSEOTELNET" },
-	{ 0x70B3D5, 0xFDD000, 0xFDDFFF, "Laser Imagineering Vertriebs GmbH", "LASER-IMAGINEERING-VERTRIEBS" },
+	{ 0x70B3D5, 0x849000, 0x849FFF, "RF-Tuote Oy", "RF-TUOTE-OY" },
+	{ 0x70B3D5, 0x84A000, 0x84AFFF, "MOG Laboratories Pty Ltd", "MOG-LABORATORIES-PTY" },
+	{ 0x70B3D5, 0x84C000, 0x84CFFF, "CoreKinect", "COREKINECT" },
+	{ 0x70B3D5, 0x84D000, 0x84DFFF, "Quantum Design Inc.", "QUANTUM-DESIGN" },
+	{ 0x70B3D5, 0x84E000, 0x84EFFF, "Chromalox, Inc.", "CHROMALOX" },
+	{ 0x70B3D5, 0x850000, 0x850FFF, "REO AG", "REO" },
+	{ 0x70B3D5, 0x852000, 0x852FFF, "NetBoxSC, LLC", "NETBOXSC-LLC" },
+	{ 0x70B3D5, 0x853000, 0x853FFF, "HGH SYSTEMES INFRAROUGES", "HGH-SYSTEMES-INFRAROUGES" },
+	{ 0x70B3D5, 0x854000, 0x854FFF, "Adimec Advanced Image Systems", "ADIMEC-ADVANCED-IMAGE" },
+	{ 0x70B3D5, 0x855000, 0x855FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x857000, 0x857FFF, "RCH Italia SpA", "RCH-ITALIA-SPA" },
+	{ 0x70B3D5, 0x85A000, 0x85AFFF, "BRUSHIES", "BRUSHIES" },
+	{ 0x70B3D5, 0x85B000, 0x85BFFF, "TSUBAKIMOTO CHAIN CO.", "TSUBAKIMOTO-CHAIN" },
+	{ 0x70B3D5, 0x85C000, 0x85CFFF, "Robot Pub Group", "ROBOT-PUB-GROUP" },
+	{ 0x70B3D5, 0x85D000, 0x85DFFF, "ATHREYA INC", "ATHREYA" },
+	{ 0x70B3D5, 0x85E000, 0x85EFFF, "XLOGIC srl", "XLOGIC-SRL" },
+	{ 0x70B3D5, 0x85F000, 0x85FFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0x861000, 0x861FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x862000, 0x862FFF, "TripleOre", "TRIPLEORE" },
+	{ 0x70B3D5, 0x866000, 0x866FFF, "MEPS Realtime", "MEPS-REALTIME" },
+	{ 0x70B3D5, 0x868000, 0x868FFF, "U-JIN Mesco Co., Ltd.", "U-JIN-MESCO" },
+	{ 0x70B3D5, 0x86C000, 0x86CFFF, "eeas gmbh", "EEAS" },
+	{ 0x70B3D5, 0x86D000, 0x86DFFF, "Census Digital Incorporated", "CENSUS-DIGITAL-INCORPORATED" },
+	{ 0x70B3D5, 0x86E000, 0x86EFFF, "Profcon AB", "PROFCON-AB" },
+	{ 0x70B3D5, 0x870000, 0x870FFF, "bentrup Industriesteuerungen", "BENTRUP-INDUSTRIESTEUERUNGEN" },
+	{ 0x70B3D5, 0x871000, 0x871FFF, "Oso Technologies", "OSO-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x873000, 0x873FFF, "Vishay Nobel AB", "VISHAY-NOBEL-AB" },
+	{ 0x70B3D5, 0x875000, 0x875FFF, "Peek Traffic", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0x876000, 0x876FFF, "IONETECH", "IONETECH" },
+	{ 0x70B3D5, 0x877000, 0x877FFF, "Polynet Telecommunications Consulting and Contractor Ltd.", "POLYNET-TELECOMMUNICATIONS-CONSULTING-AND-CONTRACTOR" },
+	{ 0x70B3D5, 0x878000, 0x878FFF, "Package Guard, Inc", "PACKAGE-GUARD" },
+	{ 0x70B3D5, 0x879000, 0x879FFF, "ZIGPOS GmbH", "ZIGPOS" },
+	{ 0x70B3D5, 0x87B000, 0x87BFFF, "Liquid Instruments Pty Ltd", "LIQUID-INSTRUMENTS-PTY" },
+	{ 0x70B3D5, 0x87C000, 0x87CFFF, "Nautel Limited", "NAUTEL" },
+	{ 0x70B3D5, 0x87D000, 0x87DFFF, "INVIXIUM ACCESS INC.", "INVIXIUM-ACCESS" },
+	{ 0x70B3D5, 0x87E000, 0x87EFFF, "Septentrio NV", "SEPTENTRIO-NV" },
 	{ 0x70B3D5, 0x87F000, 0x87FFFF, "NAC Planning Co., Ltd.", "NAC-PLANNING" },
-	{ 0x70B3D5, 0x3A1000, 0x3A1FFF, "Reckeen HDP Media sp. z o.o. sp. k.", "RECKEEN-HDP-MEDIA-SP-Z-O-O-SP-K" },
-	{ 0x70B3D5, 0x97A000, 0x97AFFF, "Orion Corporation", "ORION" },
-	{ 0x70B3D5, 0x8D7000, 0x8D7FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
-	{ 0x70B3D5, 0x4EA000, 0x4EAFFF, "Vocality international T/A Cubic", "VOCALITY-T/A-CUBIC" },
-	{ 0x70B3D5, 0x688000, 0x688FFF, "MG s.r.l.", "MG-S-R-L" },
-	{ 0x70B3D5, 0x40E000, 0x40EFFF, "Liaoyun Information Technology Co., Ltd.", "LIAOYUN-INFORMATION" },
-	{ 0x70B3D5, 0xEBA000, 0xEBAFFF, "Last Mile Gear", "LAST-MILE-GEAR" },
-	{ 0x70B3D5, 0xE84000, 0xE84FFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
-	{ 0x70B3D5, 0xBC3000, 0xBC3FFF, "eWireless", "EWIRELESS" },
-	{ 0x70B3D5, 0xCC2000, 0xCC2FFF, "LSC Lighting Systems (Aust) Pty Ltd", "LSC-LIGHTING-AUST-PTY" },
-	{ 0x70B3D5, 0xF51000, 0xF51FFF, "IoT Routers Limited", "IOT-ROUTERS" },
-	{ 0x70B3D5, 0xBCF000, 0xBCFFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0x880000, 0x880FFF, "Skopei B.V.", "SKOPEI" },
+	{ 0x70B3D5, 0x881000, 0x881FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x882000, 0x882FFF, "SIMON TECH, S.L.", "SIMON-TECH-S-L" },
+	{ 0x70B3D5, 0x885000, 0x885FFF, "QuirkLogic", "QUIRKLOGIC" },
+	{ 0x70B3D5, 0x888000, 0x888FFF, "Zetechtics Ltd", "ZETECHTICS" },
+	{ 0x70B3D5, 0x889000, 0x889FFF, "Innovative Circuit Technology", "INNOVATIVE-CIRCUIT" },
+	{ 0x70B3D5, 0x88A000, 0x88AFFF, "Perceptics, LLC", "PERCEPTICS-LLC" },
+	{ 0x70B3D5, 0x88B000, 0x88BFFF, "WUHAN EASYLINKIN TECHNOLOGY co.,LTD", "WUHAN-EASYLINKIN" },
+	{ 0x70B3D5, 0x88D000, 0x88DFFF, "LG Electronics", "LG-ELECTRONICS" },
+	{ 0x70B3D5, 0x88F000, 0x88FFFF, "Quaesta Instruments, LLC", "QUAESTA-INSTRUMENTS-LLC" },
 	{ 0x70B3D5, 0x890000, 0x890FFF, "EIDOS s.r.l.", "EIDOS-S-R-L" },
-	{ 0x70B3D5, 0xA71000, 0xA71FFF, "Samwell International Inc", "SAMWELL" },
-	{ 0x70B3D5, 0xADC000, 0xADCFFF, "SODAQ", "SODAQ" },
-	{ 0x70B3D5, 0x4E0000, 0x4E0FFF, "Microvideo", "MICROVIDEO" },
-	{ 0x70B3D5, 0xE0C000, 0xE0CFFF, "Communication Systems Solutions", "COMMUNICATION-SOLUTIONS" },
-	{ 0x70B3D5, 0xB38000, 0xB38FFF, "GoTrustID Inc.", "GOTRUSTID" },
-	{ 0x70B3D5, 0xF22000, 0xF22FFF, "Shengli Financial Software Development", "SHENGLI-FINANCIAL-SOFTWARE-DEVELOPMENT" },
-	{ 0x70B3D5, 0x08B000, 0x08BFFF, "Peter Huber Kaeltemaschinenbau AG", "PETER-HUBER-KAELTEMASCHINENBAU" },
-	{ 0x70B3D5, 0x4B3000, 0x4B3FFF, "Bacsoft", "BACSOFT" },
-	{ 0x70B3D5, 0x686000, 0x686FFF, "Access Protocol Pty Ltd", "ACCESS-PROTOCOL-PTY" },
-	{ 0x70B3D5, 0x4D2000, 0x4D2FFF, "Biotage Sweden AB", "BIOTAGE-SWEDEN-AB" },
-	{ 0x70B3D5, 0xBB6000, 0xBB6FFF, "Franke Aquarotter GmbH", "FRANKE-AQUAROTTER" },
-	{ 0x70B3D5, 0xFEE000, 0xFEEFFF, "Kawasaki Robot Service,Ltd.", "KAWASAKI-ROBOT-SERVICE" },
-	{ 0x70B3D5, 0x098000, 0x098FFF, "Alcodex Technologies Private Limited", "ALCODEX-TECHNOLOGIES-PRIVATE" },
-	{ 0x70B3D5, 0x006000, 0x006FFF, "Piranha EMS Inc.", "PIRANHA-EMS" },
-	{ 0x70B3D5, 0x96E000, 0x96EFFF, "Myostat Motion Control Inc", "MYOSTAT-MOTION-CONTROL" },
-	{ 0x70B3D5, 0x01B000, 0x01BFFF, "AUDI AG", "AUDI" },
-	{ 0x70B3D5, 0xE47000, 0xE47FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0xCBA000, 0xCBAFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x70B3D5, 0xEE8000, 0xEE8FFF, "robert juliat", "ROBERT-JULIAT" },
-	{ 0x70B3D5, 0x56C000, 0x56CFFF, "Telensa Ltd", "TELENSA" },
-	{ 0x70B3D5, 0xABB000, 0xABBFFF, "David Horn Communications Ltd", "DAVID-HORN-COMMUNICATION" },
-	{ 0x70B3D5, 0xDAB000, 0xDABFFF, "SET Power Systems GmbH", "SET-POWER" },
-	{ 0x70B3D5, 0x73C000, 0x73CFFF, "Centro de Ingenieria y Desarrollo industrial", "CENTRO-DE-INGENIERIA-Y-DESARROLLO-INDUSTRIAL" },
-	{ 0x70B3D5, 0xACA000, 0xACAFFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x70B3D5, 0x4EE000, 0x4EEFFF, "NOA Co., Ltd.", "NOA" },
-	{ 0x70B3D5, 0xC2D000, 0xC2DFFF, "Ensotech Limited", "ENSOTECH" },
-	{ 0x70B3D5, 0x9D6000, 0x9D6FFF, "Crown Solar Power Fencing Systems", "CROWN-SOLAR-POWER-FENCING" },
-	{ 0x70B3D5, 0xD50000, 0xD50FFF, "GRIDSMART Technologies", "GRIDSMART-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x43E000, 0x43EFFF, "Peloton Technology", "PELOTON" },
+	{ 0x70B3D5, 0x891000, 0x891FFF, "neocontrol soluções em automação", "NEOCONTROL-SOLUçõES-EM-AUTOMAçãO" },
+	{ 0x70B3D5, 0x892000, 0x892FFF, "ABB", "ABB" },
+	{ 0x70B3D5, 0x893000, 0x893FFF, "Cubitech", "CUBITECH" },
+	{ 0x70B3D5, 0x894000, 0x894FFF, "UnI Systech Co.,Ltd", "UNI-SYSTECH" },
+	{ 0x70B3D5, 0x895000, 0x895FFF, "Integrated Control Corp.", "INTEGRATED-CONTROL" },
+	{ 0x70B3D5, 0x896000, 0x896FFF, "Shanghai Longpal Communication Equipment Co., Ltd.", "SHANGHAI-LONGPAL-COMMUNICATION-EQUIPMENT" },
+	{ 0x70B3D5, 0x897000, 0x897FFF, "EFG CZ spol. s r.o.", "EFG-CZ-SPOL-S-R-O" },
+	{ 0x70B3D5, 0x89B000, 0x89BFFF, "ControlWorks, Inc.", "CONTROLWORKS" },
+	{ 0x70B3D5, 0x8A0000, 0x8A0FFF, "DM RADIOCOM", "DM-RADIOCOM" },
+	{ 0x70B3D5, 0x8A2000, 0x8A2FFF, "WINNERS DIGITAL CORPORATION", "WINNERS-DIGITAL" },
+	{ 0x70B3D5, 0x8A4000, 0x8A4FFF, "Phyton, Inc. Microsystems and Development Tools", "PHYTON-MICROSYSTEMS-AND-DEVELOPMENT-TOOLS" },
+	{ 0x70B3D5, 0x8A5000, 0x8A5FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x8A6000, 0x8A6FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0x8A8000, 0x8A8FFF, "megatec electronic GmbH", "MEGATEC" },
 	{ 0x70B3D5, 0x8AB000, 0x8ABFFF, "EMAC, Inc.", "EMAC" },
-	{ 0x70B3D5, 0x729000, 0x729FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x70B3D5, 0xE93000, 0xE93FFF, "ECON Technology Co.Ltd", "ECON" },
-	{ 0x70B3D5, 0xCF4000, 0xCF4FFF, "Harbin Cheng Tian Technology Development Co., Ltd.", "HARBIN-CHENG-TIAN-DEVELOPMENT" },
-	{ 0x70B3D5, 0x4BD000, 0x4BDFFF, "Boulder Amplifiers, Inc.", "BOULDER-AMPLIFIERS" },
-	{ 0x70B3D5, 0x45C000, 0x45CFFF, "AlyTech", "ALYTECH" },
-	{ 0x70B3D5, 0x4B9000, 0x4B9FFF, "SHEN ZHEN TTK TECHNOLOGY CO,LTD", "SHEN-ZHEN-TTK" },
-	{ 0x70B3D5, 0x1C4000, 0x1C4FFF, "Smeg S.p.A.", "SMEG-S-P-A" },
-	{ 0x70B3D5, 0xA59000, 0xA59FFF, "Muuntosähkö Oy - Trafox", "MUUNTOSAEHKOE-OY---TRAFOX" },
-	{ 0x70B3D5, 0xD76000, 0xD76FFF, "attocube systems AG", "ATTOCUBE" },
-	{ 0x70B3D5, 0x7E3000, 0x7E3FFF, "RedLeaf Security", "REDLEAF-SECURITY" },
-	{ 0x70B3D5, 0x83C000, 0x83CFFF, "Sinoembed", "SINOEMBED" },
-	{ 0x70B3D5, 0x7EB000, 0x7EBFFF, "Xerox International Partners", "XEROX-PARTNERS" },
-	{ 0x70B3D5, 0xF57000, 0xF57FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x01F000, 0x01FFFF, "SPX Flow Technology BV", "SPX-FLOW" },
-	{ 0x70B3D5, 0x407000, 0x407FFF, "IDOSENS", "IDOSENS" },
-	{ 0x70B3D5, 0xC01000, 0xC01FFF, "SmartGuard LLC", "SMARTGUARD-LLC" },
-	{ 0x70B3D5, 0x7C8000, 0x7C8FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0x7B9000, 0x7B9FFF, "QIAGEN Instruments AG", "QIAGEN-INSTRUMENTS" },
-	{ 0x70B3D5, 0xDD7000, 0xDD7FFF, "DETECT Australia", "DETECT-AUSTRALIA" },
-	{ 0x70B3D5, 0xDDF000, 0xDDFFFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
-	{ 0x70B3D5, 0xBF1000, 0xBF1FFF, "Flashnet SRL", "FLASHNET-SRL" },
-	{ 0x70B3D5, 0x0C5000, 0x0C5FFF, "Precitec Optronik GmbH", "PRECITEC-OPTRONIK" },
-	{ 0x70B3D5, 0xE35000, 0xE35FFF, "Nanospeed Technologies Limited", "NANOSPEED-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x5EE000, 0x5EEFFF, "Mikrotron Mikrocomputer, Digital- und Analogtechnik GmbH", "MIKROTRON-MIKROCOMPUTER-DIGITAL--UND-ANALOGTECHNIK" },
-	{ 0x70B3D5, 0xF11000, 0xF11FFF, "BroadSoft Inc", "BROADSOFT" },
-	{ 0x70B3D5, 0xB3E000, 0xB3EFFF, "Paradigm Communication Systems Ltd", "PARADIGM-COMMUNICATION" },
-	{ 0x70B3D5, 0x033000, 0x033FFF, "Sailmon BV", "SAILMON" },
-	{ 0x70B3D5, 0xD42000, 0xD42FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x70B3D5, 0xA56000, 0xA56FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0xFDF000, 0xFDFFFF, "NARA CONTROLS INC.", "NARA-CONTROLS" },
-	{ 0x70B3D5, 0x430000, 0x430FFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
-	{ 0x70B3D5, 0x5B6000, 0x5B6FFF, "Ethical Lighting and Sensor Solutions Limited", "ETHICAL-LIGHTING-AND-SENSOR-SOLUTIONS" },
-	{ 0x70B3D5, 0x2EB000, 0x2EBFFF, "BRNET CO.,LTD.", "BRNET" },
-	{ 0x70B3D5, 0xE7A000, 0xE7AFFF, "ART SPA", "ART-SPA" },
-	{ 0x70B3D5, 0xA93000, 0xA93FFF, "Mes Communication Co., Ltd", "MES-COMMUNICATION" },
-	{ 0x70B3D5, 0x0FC000, 0x0FCFFF, "vitalcare", "VITALCARE" },
+	{ 0x70B3D5, 0x8AC000, 0x8ACFFF, "​ASUNG TECHNO CO.,Ltd", "​ASUNG-TECHNO" },
+	{ 0x70B3D5, 0x8AD000, 0x8ADFFF, "Global Communications Technology LLC", "GLOBAL-COMMUNICATION-LLC" },
+	{ 0x70B3D5, 0x8B0000, 0x8B0FFF, "IES S.r.l.", "IES-S-R-L" },
+	{ 0x70B3D5, 0x8B1000, 0x8B1FFF, "M-Tech Innovations Limited", "M-TECH-INNOVATIONS" },
+	{ 0x70B3D5, 0x8B2000, 0x8B2FFF, "NPF Modem, LLC", "NPF-MODEM-LLC" },
+	{ 0x70B3D5, 0x8B3000, 0x8B3FFF, "Firefly RFID Solutions", "FIREFLY-RFID-SOLUTIONS" },
+	{ 0x70B3D5, 0x8B4000, 0x8B4FFF, "Scenario Automation", "SCENARIO-AUTOMATION" },
+	{ 0x70B3D5, 0x8B7000, 0x8B7FFF, "Contec DTx", "CONTEC-DTX" },
+	{ 0x70B3D5, 0x8B9000, 0x8B9FFF, "Toptech Systems, Inc.", "TOPTECH" },
+	{ 0x70B3D5, 0x8BB000, 0x8BBFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0x8BE000, 0x8BEFFF, "Connoiseur Electronics Private Limited", "CONNOISEUR-ELECTRONICS-PRIVATE" },
+	{ 0x70B3D5, 0x8C1000, 0x8C1FFF, "Rievtech Electronic Co.,Ltd", "RIEVTECH" },
+	{ 0x70B3D5, 0x8C2000, 0x8C2FFF, "F-domain corporation", "F-DOMAIN" },
+	{ 0x70B3D5, 0x8C3000, 0x8C3FFF, "Wyebot, Inc.", "WYEBOT" },
+	{ 0x70B3D5, 0x8C5000, 0x8C5FFF, "HMicro Inc", "HMICRO" },
+	{ 0x70B3D5, 0x8C6000, 0x8C6FFF, "Onosokki Co.,Ltd", "ONOSOKKI" },
+	{ 0x70B3D5, 0x8C8000, 0x8C8FFF, "KRONOTECH SRL", "KRONOTECH-SRL" },
+	{ 0x70B3D5, 0x8CA000, 0x8CAFFF, "Allied Data Systems", "ALLIED-DATA" },
+	{ 0x70B3D5, 0x8CB000, 0x8CBFFF, "WELT Corporation", "WELT" },
+	{ 0x70B3D5, 0x8CE000, 0x8CEFFF, "CORES Corporation", "CORES" },
+	{ 0x70B3D5, 0x8CF000, 0x8CFFFF, "Dainichi Denshi　Co.,LTD", "DAINICHI-DENSHI　" },
+	{ 0x70B3D5, 0x8D0000, 0x8D0FFF, "Raft Technologies", "RAFT-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x8D3000, 0x8D3FFF, "PERFORMANCE CONTROLS, INC.", "PERFORMANCE-CONTROLS" },
+	{ 0x70B3D5, 0x8D7000, 0x8D7FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
+	{ 0x70B3D5, 0x8D8000, 0x8D8FFF, "VNG Corporation", "VNG" },
+	{ 0x70B3D5, 0x8D9000, 0x8D9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0x8DA000, 0x8DAFFF, "MicroElectronics System Co.Ltd", "MICROELECTRONICS-SYSTEM" },
+	{ 0x70B3D5, 0x8DB000, 0x8DBFFF, "Kratos Analytical Ltd", "KRATOS-ANALYTICAL" },
+	{ 0x70B3D5, 0x8DC000, 0x8DCFFF, "Niveo International BV", "NIVEO" },
+	{ 0x70B3D5, 0x8E0000, 0x8E0FFF, "SOUDAX EQUIPEMENTS", "SOUDAX-EQUIPEMENTS" },
+	{ 0x70B3D5, 0x8E1000, 0x8E1FFF, "WoKa-Elektronik GmbH", "WOKA-ELEKTRONIK" },
+	{ 0x70B3D5, 0x8E3000, 0x8E3FFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0x8E4000, 0x8E4FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x8EB000, 0x8EBFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
+	{ 0x70B3D5, 0x8EC000, 0x8ECFFF, "Rudy Tellert", "RUDY-TELLERT" },
+	{ 0x70B3D5, 0x8EE000, 0x8EEFFF, "Network Additions", "NETWORK-ADDITIONS" },
+	{ 0x70B3D5, 0x8EF000, 0x8EFFFF, "Beeper Communications Ltd.", "BEEPER-COMMUNICATION" },
+	{ 0x70B3D5, 0x8F0000, 0x8F0FFF, "ERAESEEDS co.,ltd.", "ERAESEEDS" },
+	{ 0x70B3D5, 0x8F2000, 0x8F2FFF, "Rimota Limited", "RIMOTA" },
+	{ 0x70B3D5, 0x8F3000, 0x8F3FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x8F5000, 0x8F5FFF, "Stmovic", "STMOVIC" },
+	{ 0x70B3D5, 0x8F6000, 0x8F6FFF, "Dofuntech Co.,LTD.", "DOFUNTECH" },
+	{ 0x70B3D5, 0x8F7000, 0x8F7FFF, "I.E. Sevko A.V.", "I-E-SEVKO-A-V" },
+	{ 0x70B3D5, 0x8F8000, 0x8F8FFF, "Wi6labs", "WI6LABS" },
+	{ 0x70B3D5, 0x8FA000, 0x8FAFFF, "DEA SYSTEM SPA", "DEA-SYSTEM-SPA" },
+	{ 0x70B3D5, 0x8FF000, 0x8FFFFF, "IMST GmbH", "IMST" },
+	{ 0x70B3D5, 0x901000, 0x901FFF, "ATS-CONVERS", "ATS-CONVERS" },
+	{ 0x70B3D5, 0x902000, 0x902FFF, "Unlimiterhear co.,ltd. taiwan branch", "UNLIMITERHEAR-TAIWAN-BRANCH" },
+	{ 0x70B3D5, 0x903000, 0x903FFF, "Cymtec Ltd", "CYMTEC" },
+	{ 0x70B3D5, 0x904000, 0x904FFF, "PHB Eletronica Ltda.", "PHB-ELETRONICA-LTDA" },
+	{ 0x70B3D5, 0x906000, 0x906FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x907000, 0x907FFF, "NINGBO CRRC TIMES TRANSDUCER TECHNOLOGY CO., LTD", "NINGBO-CRRC-TIMES-TRANSDUCER" },
+	{ 0x70B3D5, 0x908000, 0x908FFF, "Accusonic", "ACCUSONIC" },
+	{ 0x70B3D5, 0x90A000, 0x90AFFF, "Hangzhou SunTown Intelligent Science & Technology Co.,Ltd.", "HANGZHOU-SUNTOWN-INTELLIGENT-SCIENCE" },
+	{ 0x70B3D5, 0x90B000, 0x90BFFF, "Matrix Switch Corporation", "MATRIX-SWITCH" },
+	{ 0x70B3D5, 0x90C000, 0x90CFFF, "ANTEK GmbH", "ANTEK" },
+	{ 0x70B3D5, 0x90D000, 0x90DFFF, "Modtronix Engineering", "MODTRONIX-ENGINEERING" },
+	{ 0x70B3D5, 0x90E000, 0x90EFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0x90F000, 0x90FFFF, "DTRON Communications (Pty) Ltd", "DTRON-COMMUNICATION-PTY" },
+	{ 0x70B3D5, 0x910000, 0x910FFF, "Eginity, Inc.", "EGINITY" },
+	{ 0x70B3D5, 0x911000, 0x911FFF, "Equatel", "EQUATEL" },
+	{ 0x70B3D5, 0x913000, 0x913FFF, "Shenzhen Riitek Technology Co.,Ltd", "SHENZHEN-RIITEK" },
+	{ 0x70B3D5, 0x916000, 0x916FFF, "Techno Mathematical Co.,Ltd", "TECHNO-MATHEMATICAL" },
+	{ 0x70B3D5, 0x917000, 0x917FFF, "KSJ Co.Ltd", "KSJ" },
+	{ 0x70B3D5, 0x918000, 0x918FFF, "Glova Rail A/S", "GLOVA-RAIL-A/S" },
+	{ 0x70B3D5, 0x91A000, 0x91AFFF, "Fujian Landfone Information Technology Co.,Ltd", "FUJIAN-LANDFONE-INFORMATION" },
+	{ 0x70B3D5, 0x91B000, 0x91BFFF, "Dolotron d.o.o.", "DOLOTRON-D-O-O" },
+	{ 0x70B3D5, 0x91E000, 0x91EFFF, "Creotech Instruments S.A.", "CREOTECH-INSTRUMENTS" },
+	{ 0x70B3D5, 0x91F000, 0x91FFFF, "JSC InformInvestGroup", "JSC-INFORMINVESTGROUP" },
+	{ 0x70B3D5, 0x920000, 0x920FFF, "SLAT", "SLAT" },
+	{ 0x70B3D5, 0x923000, 0x923FFF, "eumig industrie-tv GmbH", "EUMIG-INDUSTRIE-TV" },
+	{ 0x70B3D5, 0x924000, 0x924FFF, "Meridian Technologies Inc", "MERIDIAN-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x925000, 0x925FFF, "Diamante Lighting Srl", "DIAMANTE-LIGHTING-SRL" },
+	{ 0x70B3D5, 0x926000, 0x926FFF, "Advice", "ADVICE" },
+	{ 0x70B3D5, 0x927000, 0x927FFF, "LG Electronics", "LG-ELECTRONICS" },
+	{ 0x70B3D5, 0x929000, 0x929FFF, "OutSys", "OUTSYS" },
+	{ 0x70B3D5, 0x92A000, 0x92AFFF, "Miravue", "MIRAVUE" },
+	{ 0x70B3D5, 0x92B000, 0x92BFFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0x92E000, 0x92EFFF, "Medical Monitoring Center OOD", "MEDICAL-MONITORING-CENTER-OOD" },
+	{ 0x70B3D5, 0x92F000, 0x92FFFF, "SiFive", "SIFIVE" },
+	{ 0x70B3D5, 0x930000, 0x930FFF, "The Institute of Mine Seismology", "THE-INSTITUTE-OF-MINE-SEISMOLOGY" },
+	{ 0x70B3D5, 0x932000, 0x932FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0x933000, 0x933FFF, "SARL S@TIS", "SARL-S@TIS" },
+	{ 0x70B3D5, 0x934000, 0x934FFF, "RBS Netkom GmbH", "RBS-NETKOM" },
+	{ 0x70B3D5, 0x935000, 0x935FFF, "Sensor Developments", "SENSOR-DEVELOPMENTS" },
+	{ 0x70B3D5, 0x936000, 0x936FFF, "FARO TECHNOLOGIES, INC.", "FARO-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x937000, 0x937FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x938000, 0x938FFF, "JETI Technische Instrumente GmbH", "JETI-TECHNISCHE-INSTRUMENTE" },
+	{ 0x70B3D5, 0x939000, 0x939FFF, "Invertek Drives Ltd", "INVERTEK-DRIVES" },
+	{ 0x70B3D5, 0x93E000, 0x93EFFF, "Systems With Intelligence Inc.", "WITH-INTELLIGENCE" },
+	{ 0x70B3D5, 0x940000, 0x940FFF, "Paradigm Technology Services B.V.", "PARADIGM-SERVICES" },
+	{ 0x70B3D5, 0x941000, 0x941FFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0x942000, 0x942FFF, "TruTeq Devices (Pty) Ltd", "TRUTEQ-DEVICES-PTY" },
+	{ 0x70B3D5, 0x943000, 0x943FFF, "Abbott Medical Optics Inc.", "ABBOTT-MEDICAL-OPTICS" },
+	{ 0x70B3D5, 0x945000, 0x945FFF, "Symboticware Incorporated", "SYMBOTICWARE-INCORPORATED" },
+	{ 0x70B3D5, 0x947000, 0x947FFF, "Checkbill Co,Ltd.", "CHECKBILL" },
+	{ 0x70B3D5, 0x948000, 0x948FFF, "VISION SYSTEMS AURTOMOTIVE (SAFETY TECH)", "VISION-AURTOMOTIVE-SAFETY-TECH" },
+	{ 0x70B3D5, 0x94A000, 0x94AFFF, "SHENZHEN WISEWING INTERNET TECHNOLOGY CO.,LTD", "SHENZHEN-WISEWING-INTERNET" },
+	{ 0x70B3D5, 0x94D000, 0x94DFFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
+	{ 0x70B3D5, 0x94F000, 0x94FFFF, "MART NETWORK SOLUTIONS LTD", "MART-NETWORK-SOLUTIONS" },
+	{ 0x70B3D5, 0x950000, 0x950FFF, "CMT Medical technologies", "CMT-MEDICAL-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x952000, 0x952FFF, "REQUEA", "REQUEA" },
+	{ 0x70B3D5, 0x953000, 0x953FFF, "Spectrum Techniques, LLC", "SPECTRUM-TECHNIQUES-LLC" },
+	{ 0x70B3D5, 0x954000, 0x954FFF, "Dot System S.r.l.", "DOT-SYSTEM-S-R-L" },
+	{ 0x70B3D5, 0x955000, 0x955FFF, "Dynacard Co., Ltd.", "DYNACARD" },
+	{ 0x70B3D5, 0x956000, 0x956FFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
+	{ 0x70B3D5, 0x957000, 0x957FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
+	{ 0x70B3D5, 0x958000, 0x958FFF, "pureLiFi Ltd", "PURELIFI" },
+	{ 0x70B3D5, 0x959000, 0x959FFF, "Zulex International Co.,Ltd.", "ZULEX" },
+	{ 0x70B3D5, 0x95A000, 0x95AFFF, "Sigmann Elektronik GmbH", "SIGMANN-ELEKTRONIK" },
+	{ 0x70B3D5, 0x95B000, 0x95BFFF, "SRS Group s.r.o.", "SRS-GROUP-S-R-O" },
+	{ 0x70B3D5, 0x95C000, 0x95CFFF, "Wilson Electronics", "WILSON-ELECTRONICS" },
+	{ 0x70B3D5, 0x95E000, 0x95EFFF, "BLOCKSI LLC", "BLOCKSI-LLC" },
+	{ 0x70B3D5, 0x960000, 0x960FFF, "HORIZON TELECOM", "HORIZON-TELECOM" },
+	{ 0x70B3D5, 0x961000, 0x961FFF, "TASK SISTEMAS DE COMPUTACAO LTDA", "TASK-SISTEMAS-DE-COMPUTACAO-LTDA" },
+	{ 0x70B3D5, 0x963000, 0x963FFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0x966000, 0x966FFF, "dA Tomato Limited", "DA-TOMATO" },
+	{ 0x70B3D5, 0x967000, 0x967FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0x968000, 0x968FFF, "LGM Ingénierie", "LGM-INGéNIERIE" },
+	{ 0x70B3D5, 0x969000, 0x969FFF, "Emtel System Sp. z o.o.", "EMTEL-SYSTEM-SP-Z-O-O" },
+	{ 0x70B3D5, 0x96B000, 0x96BFFF, "FOCAL-JMLab", "FOCAL-JMLAB" },
+	{ 0x70B3D5, 0x96D000, 0x96DFFF, "MSB Elektronik und Gerätebau GmbH", "MSB-ELEKTRONIK-UND-GERAETEBAU" },
+	{ 0x70B3D5, 0x96E000, 0x96EFFF, "Myostat Motion Control Inc", "MYOSTAT-MOTION-CONTROL" },
+	{ 0x70B3D5, 0x96F000, 0x96FFFF, "4CAM GmbH", "4CAM" },
+	{ 0x70B3D5, 0x973000, 0x973FFF, "Autonomic Controls, Inc.", "AUTONOMIC-CONTROLS" },
+	{ 0x70B3D5, 0x974000, 0x974FFF, "Jireh Industries Ltd.", "JIREH-INDUSTRIES" },
+	{ 0x70B3D5, 0x975000, 0x975FFF, "Coester Automação Ltda", "COESTER-AUTOMAçãO-LTDA" },
+	{ 0x70B3D5, 0x976000, 0x976FFF, "Atonarp Micro-Systems India Pvt. Ltd.", "ATONARP-MICRO--INDIA-PVT" },
+	{ 0x70B3D5, 0x977000, 0x977FFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x978000, 0x978FFF, "Satixfy Israel Ltd.", "SATIXFY-ISRAEL" },
+	{ 0x70B3D5, 0x97A000, 0x97AFFF, "Orion Corporation", "ORION" },
+	{ 0x70B3D5, 0x97C000, 0x97CFFF, "Nu-Tek Power Controls and Automation", "NU-TEK-POWER-CONTROLS-AND-AUTOMATION" },
+	{ 0x70B3D5, 0x97F000, 0x97FFFF, "BISTOS.,Co.,Ltd", "BISTOS" },
+	{ 0x70B3D5, 0x981000, 0x981FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
+	{ 0x70B3D5, 0x984000, 0x984FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
+	{ 0x70B3D5, 0x985000, 0x985FFF, "Burk Technology", "BURK" },
+	{ 0x70B3D5, 0x986000, 0x986FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x987000, 0x987FFF, "AXIS CORPORATION", "AXIS" },
+	{ 0x70B3D5, 0x989000, 0x989FFF, "DCNS", "DCNS" },
+	{ 0x70B3D5, 0x98B000, 0x98BFFF, "Richard Paul Russell Ltd", "RICHARD-PAUL-RUSSELL" },
+	{ 0x70B3D5, 0x98C000, 0x98CFFF, "University of Wisconsin Madison - Department of High Energy Physics", "UNIVERSITY-OF-WISCONSIN-MADISON---DEPARTMENT-OF-HIGH-ENERGY-PHYSICS" },
+	{ 0x70B3D5, 0x98E000, 0x98EFFF, "Autocom Diagnostic Partner AB", "AUTOCOM-DIAGNOSTIC-PARTNER-AB" },
+	{ 0x70B3D5, 0x98F000, 0x98FFFF, "Spaceflight Industries", "SPACEFLIGHT-INDUSTRIES" },
+	{ 0x70B3D5, 0x990000, 0x990FFF, "Energy Wall", "ENERGY-WALL" },
+	{ 0x70B3D5, 0x991000, 0x991FFF, "Javasparrow Inc.", "JAVASPARROW" },
+	{ 0x70B3D5, 0x993000, 0x993FFF, "ioThings", "IOTHINGS" },
+	{ 0x70B3D5, 0x994000, 0x994FFF, "KeFF Networks", "KEFF-NETWORKS" },
+	{ 0x70B3D5, 0x995000, 0x995FFF, "LayTec AG", "LAYTEC" },
+	{ 0x70B3D5, 0x996000, 0x996FFF, "XpertSea Solutions inc.", "XPERTSEA-SOLUTIONS" },
+	{ 0x70B3D5, 0x997000, 0x997FFF, "ProTom International", "PROTOM" },
+	{ 0x70B3D5, 0x999000, 0x999FFF, "LOGICUBE INC", "LOGICUBE" },
+	{ 0x70B3D5, 0x99A000, 0x99AFFF, "KEVIC. inc,", "KEVIC" },
+	{ 0x70B3D5, 0x99C000, 0x99CFFF, "Enerwise Solutions Ltd.", "ENERWISE-SOLUTIONS" },
+	{ 0x70B3D5, 0x99E000, 0x99EFFF, "Trinity College Dublin", "TRINITY-COLLEGE-DUBLIN" },
+	{ 0x70B3D5, 0x99F000, 0x99FFFF, "Confed Holding B.V.", "CONFED-HOLDING" },
+	{ 0x70B3D5, 0x9A0000, 0x9A0FFF, "ELDES", "ELDES" },
+	{ 0x70B3D5, 0x9A1000, 0x9A1FFF, "ITS Industrial Turbine Services GmbH", "ITS-INDUSTRIAL-TURBINE-SERVICES" },
+	{ 0x70B3D5, 0x9A7000, 0x9A7FFF, "Honeywell", "HONEYWELL" },
+	{ 0x70B3D5, 0x9AA000, 0x9AAFFF, "Tecsys do Brasil Industrial Ltda", "TECSYS-DO-BRASIL-INDUSTRIAL-LTDA" },
+	{ 0x70B3D5, 0x9AB000, 0x9ABFFF, "Groupe Paris-Turf", "GROUPE-PARIS-TURF" },
+	{ 0x70B3D5, 0x9AD000, 0x9ADFFF, "Fortuna Impex Pvt ltd", "FORTUNA-IMPEX-PVT" },
+	{ 0x70B3D5, 0x9AE000, 0x9AEFFF, "Volansys technologies pvt ltd", "VOLANSYS-TECHNOLOGIES-PVT" },
+	{ 0x70B3D5, 0x9B1000, 0x9B1FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0x9B2000, 0x9B2FFF, "CONTINENT, Ltd", "CONTINENT" },
+	{ 0x70B3D5, 0x9B3000, 0x9B3FFF, "K&J Schmittschneider AG", "K-J-SCHMITTSCHNEIDER" },
+	{ 0x70B3D5, 0x9B4000, 0x9B4FFF, "MyoungSung System", "MYOUNGSUNG-SYSTEM" },
+	{ 0x70B3D5, 0x9B5000, 0x9B5FFF, "Ideetron b.v.", "IDEETRON" },
+	{ 0x70B3D5, 0x9B6000, 0x9B6FFF, "Intercomp S.p.A.", "INTERCOMP-S-P-A" },
+	{ 0x70B3D5, 0x9B8000, 0x9B8FFF, "Loma Systems", "LOMA" },
+	{ 0x70B3D5, 0x9BA000, 0x9BAFFF, "ATIM Radiocommunication", "ATIM-RADIOCOMMUNICATION" },
+	{ 0x70B3D5, 0x9BD000, 0x9BDFFF, "Signal Processing Devices Sweden AB", "SIGNAL-PROCESSING-DEVICES-SWEDEN-AB" },
+	{ 0x70B3D5, 0x9C0000, 0x9C0FFF, "Schneider Displaytechnik GmbH", "SCHNEIDER-DISPLAYTECHNIK" },
+	{ 0x70B3D5, 0x9C1000, 0x9C1FFF, "Zeroplus Technology Co.,Ltd.", "ZEROPLUS" },
+	{ 0x70B3D5, 0x9C5000, 0x9C5FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
+	{ 0x70B3D5, 0x9C6000, 0x9C6FFF, "Overspeed SARL", "OVERSPEED-SARL" },
+	{ 0x70B3D5, 0x9C7000, 0x9C7FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
 	{ 0x70B3D5, 0x9C8000, 0x9C8FFF, "Applied Systems Engineering, Inc.", "APPLIED-ENGINEERING" },
-	{ 0x70B3D5, 0xD8C000, 0xD8CFFF, "Damerell Design Limited (DCL)", "DAMERELL-DESIGN-DCL" },
-	{ 0x70B3D5, 0xFBB000, 0xFBBFFF, "Vena Engineering Corporation", "VENA-ENGINEERING" },
-	{ 0x70B3D5, 0xC21000, 0xC21FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x628000, 0x628FFF, "MECT S.R.L.", "MECT-S-R-L" },
-	{ 0x70B3D5, 0x32F000, 0x32FFFF, "Movidius SRL", "MOVIDIUS-SRL" },
 	{ 0x70B3D5, 0x9C9000, 0x9C9FFF, "PK Sound", "PK-SOUND" },
-	{ 0x70B3D5, 0xADA000, 0xADAFFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x554000, 0x554FFF, "Teletypes Manufacturing Plant", "TELETYPES-MANUFACTURING-PLANT" },
-	{ 0x70B3D5, 0xE0D000, 0xE0DFFF, "Sigma Connectivity AB", "SIGMA-CONNECTIVITY-AB" },
-	{ 0x70B3D5, 0x72D000, 0x72DFFF, "Kron Medidores", "KRON-MEDIDORES" },
-	{ 0x70B3D5, 0xD8D000, 0xD8DFFF, "Pullnet Technology,S.L.", "PULLNET-S-L" },
-	{ 0x70B3D5, 0x2BC000, 0x2BCFFF, "EQUIPOS DE TELECOMUNICACIÓN OPTOELECTRÓNICOS, S.A.", "EQUIPOS-DE-TELECOMUNICACIÓN-OPTOELECTRÓNICOS" },
-	{ 0x70B3D5, 0x2D6000, 0x2D6FFF, "Kvazar LLC", "KVAZAR-LLC" },
-	{ 0x70B3D5, 0x231000, 0x231FFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
-	{ 0x70B3D5, 0x823000, 0x823FFF, "SP Controls", "SP-CONTROLS" },
-	{ 0x70B3D5, 0x80D000, 0x80DFFF, "Data Physics Corporation", "DATA-PHYSICS" },
-	{ 0x70B3D5, 0x336000, 0x336FFF, "Synaccess Networks Inc.", "SYNACCESS-NETWORKS" },
-	{ 0x70B3D5, 0xA51000, 0xA51FFF, "RF Code", "RF-CODE" },
-	{ 0x70B3D5, 0x7AF000, 0x7AFFFF, "Hessware GmbH", "HESSWARE" },
-	{ 0x70B3D5, 0x3F9000, 0x3F9FFF, "Herrick Tech Labs", "HERRICK-TECH-LABS" },
-	{ 0x70B3D5, 0x4B1000, 0x4B1FFF, "LACE LLC.", "LACE-LLC" },
-	{ 0x70B3D5, 0x530000, 0x530FFF, "iSiS-Ex Limited", "ISIS-EX" },
-	{ 0x70B3D5, 0xA27000, 0xA27FFF, "HDL da Amazônia Industria Eletrônica Ltda", "HDL-DA-AMAZôNIA-INDUSTRIA-ELETRôNICA-LTDA" },
-	{ 0x70B3D5, 0xE21000, 0xE21FFF, "LLVISION TECHNOLOGY CO.,LTD", "LLVISION" },
-	{ 0x70B3D5, 0x583000, 0x583FFF, "Ducommun Inc.", "DUCOMMUN" },
-	{ 0x70B3D5, 0xF1E000, 0xF1EFFF, "ATX NETWORKS LTD", "ATX-NETWORKS" },
-	{ 0x70B3D5, 0x9E7000, 0x9E7FFF, "Xiamen Maxincom Technologies Co., Ltd.", "XIAMEN-MAXINCOM-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x472000, 0x472FFF, "Quadio Devices Private Limited", "QUADIO-DEVICES-PRIVATE" },
-	{ 0x70B3D5, 0x7A8000, 0x7A8FFF, "dieEntwickler Elektronik GmbH", "DIEENTWICKLER-ELEKTRONIK" },
-	{ 0x70B3D5, 0x03F000, 0x03FFFF, "Elesar Limited", "ELESAR" },
-	{ 0x70B3D5, 0x3D7000, 0x3D7FFF, "Remote Sensing Solutions, Inc.", "REMOTE-SENSING-SOLUTIONS" },
-	{ 0x70B3D5, 0x838000, 0x838FFF, "Tofino", "TOFINO" },
-	{ 0x70B3D5, 0x1F3000, 0x1F3FFF, "Smart Energy Code Company Limited", "SMART-ENERGY-CODE-COMPANY" },
-	{ 0x70B3D5, 0x6BB000, 0x6BBFFF, "LUCEO", "LUCEO" },
-	{ 0x70B3D5, 0xC5A000, 0xC5AFFF, "Commsignia Ltd.", "COMMSIGNIA" },
-	{ 0x70B3D5, 0x9DB000, 0x9DBFFF, "CAS Medical Systems, Inc", "CAS-MEDICAL" },
-	{ 0x70B3D5, 0xBDD000, 0xBDDFFF, "CDR SRL", "CDR-SRL" },
-	{ 0x70B3D5, 0xF5A000, 0xF5AFFF, "HAMEG GmbH", "HAMEG" },
-	{ 0x70B3D5, 0x74C000, 0x74CFFF, "Kwant Controls BV", "KWANT-CONTROLS" },
-	{ 0x70B3D5, 0x6FA000, 0x6FAFFF, "Dataforth Corporation", "DATAFORTH" },
-	{ 0x70B3D5, 0xE90000, 0xE90FFF, "Getein Biotechnology Co.,ltd", "GETEIN-BIOTECHNOLOGY" },
-	{ 0x70B3D5, 0xC3F000, 0xC3FFFF, "Code Blue Corporation", "CODE-BLUE" },
-	{ 0x70B3D5, 0x917000, 0x917FFF, "KSJ Co.Ltd", "KSJ" },
-	{ 0x70B3D5, 0xEC6000, 0xEC6FFF, "ESII", "ESII" },
-	{ 0x70B3D5, 0x849000, 0x849FFF, "RF-Tuote Oy", "RF-TUOTE-OY" },
+	{ 0x70B3D5, 0x9CA000, 0x9CAFFF, "KOMSIS ELEKTRONIK SISTEMLERI SAN. TIC. LTD.STI", "KOMSIS-ELEKTRONIK-SISTEMLERI-SAN-TIC-STI" },
+	{ 0x70B3D5, 0x9CB000, 0x9CBFFF, "Alligator Communications", "ALLIGATOR-COMMUNICATION" },
+	{ 0x70B3D5, 0x9CE000, 0x9CEFFF, "Terragene S.A", "TERRAGENE" },
+	{ 0x70B3D5, 0x9D0000, 0x9D0FFF, "RJ45 Technologies", "RJ45-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9D1000, 0x9D1FFF, "OS42 UG (haftungsbeschraenkt)", "OS42-UG-HAFTUNGSBESCHRAENKT" },
+	{ 0x70B3D5, 0x9D2000, 0x9D2FFF, "ACS MOTION CONTROL", "ACS-MOTION-CONTROL" },
 	{ 0x70B3D5, 0x9D3000, 0x9D3FFF, "Communication Technology Ltd.", "COMMUNICATION" },
-	{ 0x70B3D5, 0x46B000, 0x46BFFF, "Airborne Engineering Limited", "AIRBORNE-ENGINEERING" },
-	{ 0x70B3D5, 0xEFB000, 0xEFBFFF, "PXM sp.k.", "PXM-SP-K" },
-	{ 0x70B3D5, 0xA81000, 0xA81FFF, "Sienda New Media Technologies GmbH", "SIENDA-NEW-MEDIA-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xEAC000, 0xEACFFF, "Kentech Instruments Limited", "KENTECH-INSTRUMENTS" },
-	{ 0x70B3D5, 0x8AD000, 0x8ADFFF, "Global Communications Technology LLC", "GLOBAL-COMMUNICATION-LLC" },
-	{ 0x70B3D5, 0xC97000, 0xC97FFF, "CSINFOTEL", "CSINFOTEL" },
-	{ 0x70B3D5, 0x4AA000, 0x4AAFFF, "Twoway Communications, Inc.", "TWOWAY-COMMUNICATION" },
-	{ 0x70B3D5, 0x5A2000, 0x5A2FFF, "Wallner Automation GmbH", "WALLNER-AUTOMATION" },
-	{ 0x70B3D5, 0x418000, 0x418FFF, "DEV Systemtechnik GmbH& Co KG", "DEV-SYSTEMTECHNIK" },
-	{ 0x70B3D5, 0xD79000, 0xD79FFF, "GOMA ELETTRONICA SpA", "GOMA-ELETTRONICA-SPA" },
-	{ 0x70B3D5, 0x58E000, 0x58EFFF, "Veilux Inc.", "VEILUX" },
-	{ 0x70B3D5, 0x181000, 0x181FFF, "Task Sistemas", "TASK-SISTEMAS" },
-	{ 0x70B3D5, 0xDCF000, 0xDCFFFF, "KLS Netherlands B.V.", "KLS-NETHERLANDS" },
+	{ 0x70B3D5, 0x9D4000, 0x9D4FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
+	{ 0x70B3D5, 0x9D5000, 0x9D5FFF, "Southern Tier Technologies", "SOUTHERN-TIER-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9D6000, 0x9D6FFF, "Crown Solar Power Fencing Systems", "CROWN-SOLAR-POWER-FENCING" },
+	{ 0x70B3D5, 0x9D7000, 0x9D7FFF, "KM OptoElektronik GmbH", "KM-OPTOELEKTRONIK" },
+	{ 0x70B3D5, 0x9D9000, 0x9D9FFF, "ATX Networks Corp", "ATX-NETWORKS" },
+	{ 0x70B3D5, 0x9DB000, 0x9DBFFF, "CAS Medical Systems, Inc", "CAS-MEDICAL" },
+	{ 0x70B3D5, 0x9DC000, 0x9DCFFF, "Shanghai Daorech Industry Developmnet Co.,Ltd", "SHANGHAI-DAORECH-INDUSTRY-DEVELOPMNET" },
+	{ 0x70B3D5, 0x9DD000, 0x9DDFFF, "HumanEyes Technologies Ltd.", "HUMANEYES-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9DE000, 0x9DEFFF, "System 11 Sp. z o.o.", "SYSTEM-11-SP-Z-O-O" },
+	{ 0x70B3D5, 0x9DF000, 0x9DFFFF, "DOBE Computing", "DOBE-COMPUTING" },
+	{ 0x70B3D5, 0x9E0000, 0x9E0FFF, "ES Industrial Systems Co., Ltd.", "ES-INDUSTRIAL" },
+	{ 0x70B3D5, 0x9E2000, 0x9E2FFF, "Ofil USA", "OFIL-USA" },
+	{ 0x70B3D5, 0x9E3000, 0x9E3FFF, "LG Electronics", "LG-ELECTRONICS" },
+	{ 0x70B3D5, 0x9E6000, 0x9E6FFF, "BLOCKSI LLC", "BLOCKSI-LLC" },
+	{ 0x70B3D5, 0x9E7000, 0x9E7FFF, "Xiamen Maxincom Technologies Co., Ltd.", "XIAMEN-MAXINCOM-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9EB000, 0x9EBFFF, "Preston Industries dba PolyScience", "PRESTON-INDUSTRIES-DBA-POLYSCIENCE" },
+	{ 0x70B3D5, 0x9EC000, 0x9ECFFF, "eSoftThings", "ESOFTTHINGS" },
+	{ 0x70B3D5, 0x9ED000, 0x9EDFFF, "Benchmark Electronics BV", "BENCHMARK-ELECTRONICS" },
+	{ 0x70B3D5, 0x9EF000, 0x9EFFFF, "Cottonwood Creek Technologies, Inc.", "COTTONWOOD-CREEK-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9F0000, 0x9F0FFF, "FUJICOM Co.,Ltd.", "FUJICOM" },
+	{ 0x70B3D5, 0x9F1000, 0x9F1FFF, "RFEL Ltd", "RFEL" },
+	{ 0x70B3D5, 0x9F2000, 0x9F2FFF, "Acorde Technologies", "ACORDE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9F3000, 0x9F3FFF, "IEEE Registration Authority", "IEEE-REGISTRATION-AUTHORITY" },
+	{ 0x70B3D5, 0x9F4000, 0x9F4FFF, "Tband srl", "TBAND-SRL" },
+	{ 0x70B3D5, 0x9F5000, 0x9F5FFF, "Vickers Electronics Ltd", "VICKERS-ELECTRONICS" },
+	{ 0x70B3D5, 0x9F6000, 0x9F6FFF, "Edgeware AB", "EDGEWARE-AB" },
+	{ 0x70B3D5, 0x9F8000, 0x9F8FFF, "Asymmetric Technologies", "ASYMMETRIC-TECHNOLOGIES" },
+	{ 0x70B3D5, 0x9F9000, 0x9F9FFF, "Fluid Components Intl", "FLUID-COMPONENTS-INTL" },
+	{ 0x70B3D5, 0x9FA000, 0x9FAFFF, "Ideas srl", "IDEAS-SRL" },
+	{ 0x70B3D5, 0x9FB000, 0x9FBFFF, "Unicom Global, Inc.", "UNICOM-GLOBAL" },
+	{ 0x70B3D5, 0xA00000, 0xA00FFF, "ATX NETWORKS LTD", "ATX-NETWORKS" },
+	{ 0x70B3D5, 0xA01000, 0xA01FFF, "FeldTech GmbH", "FELDTECH" },
+	{ 0x70B3D5, 0xA03000, 0xA03FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xA04000, 0xA04FFF, "Galea Electric S.L.", "GALEA-ELECTRIC-S-L" },
+	{ 0x70B3D5, 0xA05000, 0xA05FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
+	{ 0x70B3D5, 0xA06000, 0xA06FFF, "Kopis Mobile LLC", "KOPIS-MOBILE-LLC" },
+	{ 0x70B3D5, 0xA07000, 0xA07FFF, "IoTrek Technology Private Limited", "IOTREK-PRIVATE" },
+	{ 0x70B3D5, 0xA08000, 0xA08FFF, "BioBusiness", "BIOBUSINESS" },
+	{ 0x70B3D5, 0xA0A000, 0xA0AFFF, "CAPSYS", "CAPSYS" },
+	{ 0x70B3D5, 0xA0B000, 0xA0BFFF, "ambiHome GmbH", "AMBIHOME" },
+	{ 0x70B3D5, 0xA0D000, 0xA0DFFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
+	{ 0x70B3D5, 0xA0E000, 0xA0EFFF, "Vetaphone A/S", "VETAPHONE-A/S" },
+	{ 0x70B3D5, 0xA10000, 0xA10FFF, "w-tec AG", "W-TEC" },
+	{ 0x70B3D5, 0xA12000, 0xA12FFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
+	{ 0x70B3D5, 0xA13000, 0xA13FFF, "Uplevel Systems Inc", "UPLEVEL" },
+	{ 0x70B3D5, 0xA15000, 0xA15FFF, "Intercore GmbH", "INTERCORE" },
+	{ 0x70B3D5, 0xA17000, 0xA17FFF, "Tunstall A/S", "TUNSTALL-A/S" },
+	{ 0x70B3D5, 0xA18000, 0xA18FFF, "Embedded Systems Lukasz Panasiuk", "EMBEDDED-LUKASZ-PANASIUK" },
+	{ 0x70B3D5, 0xA19000, 0xA19FFF, "Qualitronix Madrass Pvt Ltd", "QUALITRONIX-MADRASS-PVT" },
+	{ 0x70B3D5, 0xA1B000, 0xA1BFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0xA1C000, 0xA1CFFF, "MECA SYSTEM", "MECA-SYSTEM" },
+	{ 0x70B3D5, 0xA1D000, 0xA1DFFF, "Fluid Components International", "FLUID-COMPONENTS" },
+	{ 0x70B3D5, 0xA1F000, 0xA1FFFF, "GlobalTest LLC", "GLOBALTEST-LLC" },
+	{ 0x70B3D5, 0xA20000, 0xA20FFF, "Design For Life Systems", "DESIGN-FOR-LIFE" },
+	{ 0x70B3D5, 0xA21000, 0xA21FFF, "PPI Inc.", "PPI" },
 	{ 0x70B3D5, 0xA25000, 0xA25FFF, "PulseTor LLC", "PULSETOR-LLC" },
-	{ 0x70B3D5, 0x882000, 0x882FFF, "SIMON TECH, S.L.", "SIMON-TECH-S-L" },
-	{ 0x70B3D5, 0x959000, 0x959FFF, "Zulex International Co.,Ltd.", "ZULEX" },
-	{ 0x70B3D5, 0xCFF000, 0xCFFFFF, "DTECH Labs, Inc.", "DTECH-LABS" },
-	{ 0x70B3D5, 0x0C0000, 0x0C0FFF, "Molu Technology Inc., LTD.", "MOLU" },
-	{ 0x70B3D5, 0x3DF000, 0x3DFFFF, "MultiDyne", "MULTIDYNE" },
-	{ 0x70B3D5, 0x82C000, 0x82CFFF, "NELS Ltd.", "NELS" },
-	{ 0x70B3D5, 0x501000, 0x501FFF, "Peek Traffic", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0x025000, 0x025FFF, "Elsuhd Net Ltd Co.", "ELSUHD-NET" },
-	{ 0x70B3D5, 0x58F000, 0x58FFFF, "LSL systems", "LSL" },
+	{ 0x70B3D5, 0xA26000, 0xA26FFF, "Hear Gear, Inc.", "HEAR-GEAR" },
+	{ 0x70B3D5, 0xA27000, 0xA27FFF, "HDL da Amazônia Industria Eletrônica Ltda", "HDL-DA-AMAZôNIA-INDUSTRIA-ELETRôNICA-LTDA" },
+	{ 0x70B3D5, 0xA28000, 0xA28FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0xA29000, 0xA29FFF, "QIAGEN Instruments AG", "QIAGEN-INSTRUMENTS" },
+	{ 0x70B3D5, 0xA2A000, 0xA2AFFF, "Redwood Systems", "REDWOOD" },
+	{ 0x70B3D5, 0xA2C000, 0xA2CFFF, "TLV CO., LTD.", "TLV" },
+	{ 0x70B3D5, 0xA2E000, 0xA2EFFF, "Kokam Co., Ltd", "KOKAM" },
+	{ 0x70B3D5, 0xA2F000, 0xA2FFFF, "Botek Systems AB", "BOTEK-AB" },
+	{ 0x70B3D5, 0xA30000, 0xA30FFF, "SHEN ZHEN HUAWANG TECHNOLOGY CO; LTD", "SHEN-ZHEN-HUAWANG" },
+	{ 0x70B3D5, 0xA32000, 0xA32FFF, "Toughdog Security Systems", "TOUGHDOG-SECURITY" },
+	{ 0x70B3D5, 0xA33000, 0xA33FFF, "TIAMA", "TIAMA" },
+	{ 0x70B3D5, 0xA35000, 0xA35FFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0xA36000, 0xA36FFF, "Beijing DamingWuzhou Science&Technology Co., Ltd.", "BEIJING-DAMINGWUZHOU-SCIENCE" },
+	{ 0x70B3D5, 0xA37000, 0xA37FFF, "MITSUBISHI HEAVY INDUSTRIES THERMAL SYSTEMS, LTD.", "MITSUBISHI-HEAVY-INDUSTRIES-THERMAL" },
+	{ 0x70B3D5, 0xA3A000, 0xA3AFFF, "EPSOFT Co., Ltd", "EPSOFT" },
+	{ 0x70B3D5, 0xA3B000, 0xA3BFFF, "Grace Design/Lunatec LLC", "GRACE-DESIGN/LUNATEC-LLC" },
+	{ 0x70B3D5, 0xA3C000, 0xA3CFFF, "Wave Music Ltd", "WAVE-MUSIC" },
+	{ 0x70B3D5, 0xA3F000, 0xA3FFFF, "PHPower Srl", "PHPOWER-SRL" },
+	{ 0x70B3D5, 0xA40000, 0xA40FFF, "STRACK LIFT AUTOMATION GmbH", "STRACK-LIFT-AUTOMATION" },
+	{ 0x70B3D5, 0xA43000, 0xA43FFF, "OLEDCOMM", "OLEDCOMM" },
+	{ 0x70B3D5, 0xA44000, 0xA44FFF, "FSR Inc", "FSR" },
+	{ 0x70B3D5, 0xA46000, 0xA46FFF, "Foxconn 4Tech", "FOXCONN-4TECH" },
+	{ 0x70B3D5, 0xA47000, 0xA47FFF, "KANOA INC", "KANOA" },
+	{ 0x70B3D5, 0xA48000, 0xA48FFF, "Applied Satellite Engineering", "APPLIED-SATELLITE-ENGINEERING" },
+	{ 0x70B3D5, 0xA4A000, 0xA4AFFF, "Beijing Arrow SEED Technology Co,.Ltd.", "BEIJING-ARROW-SEED" },
+	{ 0x70B3D5, 0xA4B000, 0xA4BFFF, "McKay Brothers LLC", "MCKAY-BROTHERS-LLC" },
+	{ 0x70B3D5, 0xA4C000, 0xA4CFFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
+	{ 0x70B3D5, 0xA4E000, 0xA4EFFF, "Array Technologies Inc.", "ARRAY-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xA4F000, 0xA4FFFF, "Weltek Technologies Co. Ltd.", "WELTEK-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xA50000, 0xA50FFF, "LECIP CORPORATION", "LECIP" },
+	{ 0x70B3D5, 0xA51000, 0xA51FFF, "RF Code", "RF-CODE" },
+	{ 0x70B3D5, 0xA53000, 0xA53FFF, "GS Industrie-Elektronik GmbH", "GS-INDUSTRIE-ELEKTRONIK" },
+	{ 0x70B3D5, 0xA54000, 0xA54FFF, "provedo", "PROVEDO" },
 	{ 0x70B3D5, 0xA55000, 0xA55FFF, "Embest Technology Co., Ltd", "EMBEST" },
-	{ 0x70B3D5, 0xBE1000, 0xBE1FFF, "FeCon GmbH", "FECON" },
-	{ 0x70B3D5, 0x26E000, 0x26EFFF, "HI-TECH SYSTEM Co. Ltd.", "HI-TECH-SYSTEM" },
-	{ 0x70B3D5, 0x5E9000, 0x5E9FFF, "Zehetner-Elektronik GmbH", "ZEHETNER-ELEKTRONIK" },
-	{ 0x70B3D5, 0x205000, 0x205FFF, "Esource Srl", "ESOURCE-SRL" },
-	{ 0x70B3D5, 0x112000, 0x112FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x70B3D5, 0x3DA000, 0x3DAFFF, "Loop Labs, Inc.", "LOOP-LABS" },
-	{ 0x70B3D5, 0xFF5000, 0xFF5FFF, "Prolan Process Control Co.", "PROLAN-PROCESS-CONTROL" },
-	{ 0x70B3D5, 0x2D5000, 0x2D5FFF, "Teuco Guzzini", "TEUCO-GUZZINI" },
-	{ 0x70B3D5, 0xBEC000, 0xBECFFF, "Tokyo Communication Equipment MFG Co.,ltd.", "TOKYO-COMMUNICATION-EQUIPMENT-MFG" },
-	{ 0x70B3D5, 0x6D6000, 0x6D6FFF, "KMtronic Ltd.", "KMTRONIC" },
-	{ 0x70B3D5, 0x57C000, 0x57CFFF, "Automata GmbH & Co. KG", "AUTOMATA" },
-	{ 0x70B3D5, 0xDA1000, 0xDA1FFF, "Qprel srl", "QPREL-SRL" },
-	{ 0x70B3D5, 0x097000, 0x097FFF, "Avant Technologies", "AVANT-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x05F000, 0x05FFFF, "UNISOR MULTISYSTEMS LTD", "UNISOR-MULTISYSTEMS" },
-	{ 0x70B3D5, 0x48D000, 0x48DFFF, "OMEGA BILANCE SRL SOCIETA' UNIPERSONALE", "OMEGA-BILANCE-SRL-SOCIETA-UNIPERSONALE" },
-	{ 0x70B3D5, 0xE99000, 0xE99FFF, "Advitronics telecom bv", "ADVITRONICS-TELECOM" },
-	{ 0x70B3D5, 0x362000, 0x362FFF, "Asiga", "ASIGA" },
-	{ 0x70B3D5, 0x751000, 0x751FFF, "GNF", "GNF" },
-	{ 0x70B3D5, 0x587000, 0x587FFF, "INCAA Computers", "INCAA-COMPUTERS" },
-	{ 0x70B3D5, 0xE27000, 0xE27FFF, "Woodside Electronics", "WOODSIDE-ELECTRONICS" },
-	{ 0x70B3D5, 0x346000, 0x346FFF, "Ultamation Limited", "ULTAMATION" },
-	{ 0x70B3D5, 0x052000, 0x052FFF, "Sudo Premium Engineering", "SUDO-PREMIUM-ENGINEERING" },
-	{ 0x70B3D5, 0xF34000, 0xF34FFF, "MacGray Services", "MACGRAY-SERVICES" },
-	{ 0x70B3D5, 0xB16000, 0xB16FFF, "XI'AN SHENMING ELECTRON TECHNOLOGY CO.,LTD", "XI-AN-SHENMING-ELECTRON" },
-	{ 0x70B3D5, 0x2FD000, 0x2FDFFF, "Special Projects Group, Inc", "SPECIAL-PROJECTS-GROUP" },
-	{ 0x70B3D5, 0x305000, 0x305FFF, "CAITRON Industrial Solutions GmbH", "CAITRON-INDUSTRIAL-SOLUTIONS" },
-	{ 0x70B3D5, 0x634000, 0x634FFF, "idaqs Co.,Ltd.", "IDAQS" },
-	{ 0x70B3D5, 0xCE9000, 0xCE9FFF, "KINEMETRICS", "KINEMETRICS" },
-	{ 0x70B3D5, 0xB8A000, 0xB8AFFF, "Nexus Tech. VN", "NEXUS-TECH-VN" },
-	{ 0x70B3D5, 0x3A8000, 0x3A8FFF, "JamHub Corp.", "JAMHUB" },
+	{ 0x70B3D5, 0xA56000, 0xA56FFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0xA57000, 0xA57FFF, "PCSC", "PCSC" },
+	{ 0x70B3D5, 0xA58000, 0xA58FFF, "MCQ TECH GmbH", "MCQ-TECH" },
+	{ 0x70B3D5, 0xA59000, 0xA59FFF, "Muuntosähkö Oy - Trafox", "MUUNTOSAEHKOE-OY---TRAFOX" },
+	{ 0x70B3D5, 0xA5A000, 0xA5AFFF, "RCS Energy Management Ltd", "RCS-ENERGY-MANAGEMENT" },
+	{ 0x70B3D5, 0xA5B000, 0xA5BFFF, "Christ Elektronik GmbH", "CHRIST-ELEKTRONIK" },
+	{ 0x70B3D5, 0xA5C000, 0xA5CFFF, "Molekule", "MOLEKULE" },
+	{ 0x70B3D5, 0xA5E000, 0xA5EFFF, "ConectaIP Tecnologia S.L.", "CONECTAIP-TECNOLOGIA-S-L" },
+	{ 0x70B3D5, 0xA5F000, 0xA5FFFF, "Daatrics LTD", "DAATRICS" },
+	{ 0x70B3D5, 0xA62000, 0xA62FFF, "Environexus", "ENVIRONEXUS" },
+	{ 0x70B3D5, 0xA64000, 0xA64FFF, "Newshine", "NEWSHINE" },
+	{ 0x70B3D5, 0xA66000, 0xA66FFF, "Trapeze Software Group Inc", "TRAPEZE-SOFTWARE-GROUP" },
+	{ 0x70B3D5, 0xA69000, 0xA69FFF, "Leviathan Solutions Ltd.", "LEVIATHAN-SOLUTIONS" },
+	{ 0x70B3D5, 0xA6D000, 0xA6DFFF, "Metek Meteorologische Messtechnik GmbH", "METEK-METEOROLOGISCHE-MESSTECHNIK" },
+	{ 0x70B3D5, 0xA6E000, 0xA6EFFF, "JSC Electrical Equipment Factory", "JSC-ELECTRICAL-EQUIPMENT-FACTORY" },
+	{ 0x70B3D5, 0xA6F000, 0xA6FFFF, "8Cups", "8CUPS" },
+	{ 0x70B3D5, 0xA71000, 0xA71FFF, "Samwell International Inc", "SAMWELL" },
+	{ 0x70B3D5, 0xA72000, 0xA72FFF, "Business Marketers Group, Inc.", "BUSINESS-MARKETERS-GROUP" },
+	{ 0x70B3D5, 0xA73000, 0xA73FFF, "MobiPromo", "MOBIPROMO" },
+	{ 0x70B3D5, 0xA75000, 0xA75FFF, "Taejin InforTech", "TAEJIN-INFORTECH" },
+	{ 0x70B3D5, 0xA76000, 0xA76FFF, "Pietro Fiorentini", "PIETRO-FIORENTINI" },
+	{ 0x70B3D5, 0xA78000, 0xA78FFF, "Bionics co.,ltd.", "BIONICS" },
+	{ 0x70B3D5, 0xA7A000, 0xA7AFFF, "Fluid Management Technology", "FLUID-MANAGEMENT" },
+	{ 0x70B3D5, 0xA7C000, 0xA7CFFF, "Transelektronik Messgeräte GmbH", "TRANSELEKTRONIK-MESSGERAETE" },
+	{ 0x70B3D5, 0xA7E000, 0xA7EFFF, "QUICCO SOUND Corporation", "QUICCO-SOUND" },
+	{ 0x70B3D5, 0xA81000, 0xA81FFF, "Sienda New Media Technologies GmbH", "SIENDA-NEW-MEDIA-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xA82000, 0xA82FFF, "Telefrank GmbH", "TELEFRANK" },
+	{ 0x70B3D5, 0xA84000, 0xA84FFF, "SOREL GmbH Mikroelektronik", "SOREL-MIKROELEKTRONIK" },
+	{ 0x70B3D5, 0xA85000, 0xA85FFF, "exceet electronics GesmbH", "EXCEET-ELECTRONICS-GESMBH" },
+	{ 0x70B3D5, 0xA86000, 0xA86FFF, "Divigraph (Pty) LTD", "DIVIGRAPH-PTY" },
+	{ 0x70B3D5, 0xA87000, 0xA87FFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
+	{ 0x70B3D5, 0xA88000, 0xA88FFF, "Shangdong Bosure Automation Technology Ltd", "SHANGDONG-BOSURE-AUTOMATION" },
+	{ 0x70B3D5, 0xA89000, 0xA89FFF, "GBS COMMUNICATIONS, LLC", "GBS-COMMUNICATION-LLC" },
+	{ 0x70B3D5, 0xA8B000, 0xA8BFFF, "Giant Power Technology Biomedical Corporation", "GIANT-POWER-BIOMEDICAL" },
+	{ 0x70B3D5, 0xA8D000, 0xA8DFFF, "Code Blue Corporation", "CODE-BLUE" },
+	{ 0x70B3D5, 0xA8E000, 0xA8EFFF, "OMESH CITY GROUP", "OMESH-CITY-GROUP" },
+	{ 0x70B3D5, 0xA90000, 0xA90FFF, "ERA a.s.", "ERA-A-S" },
+	{ 0x70B3D5, 0xA91000, 0xA91FFF, "IDEAL INDUSTRIES Ltd t/a Casella", "IDEAL-INDUSTRIES-T/A-CASELLA" },
+	{ 0x70B3D5, 0xA92000, 0xA92FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0xA93000, 0xA93FFF, "Mes Communication Co., Ltd", "MES-COMMUNICATION" },
+	{ 0x70B3D5, 0xA94000, 0xA94FFF, "ETA Technology Pvt Ltd", "ETA-PVT" },
+	{ 0x70B3D5, 0xA95000, 0xA95FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0xA96000, 0xA96FFF, "Östling Marking Systems GmbH", "OESTLING-MARKING" },
+	{ 0x70B3D5, 0xA97000, 0xA97FFF, "Bizwerks, LLC", "BIZWERKS-LLC" },
+	{ 0x70B3D5, 0xA99000, 0xA99FFF, "Bandelin electronic GmbH & Co. KG", "BANDELIN" },
+	{ 0x70B3D5, 0xA9A000, 0xA9AFFF, "Amphenol Advanced Sensors", "AMPHENOL-ADVANCED-SENSORS" },
+	{ 0x70B3D5, 0xA9C000, 0xA9CFFF, "Veo Technologies", "VEO-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xA9D000, 0xA9DFFF, "VITEC MULTIMEDIA", "VITEC-MULTIMEDIA" },
+	{ 0x70B3D5, 0xA9E000, 0xA9EFFF, "Argon ST", "ARGON-ST" },
+	{ 0x70B3D5, 0xA9F000, 0xA9FFFF, "Private", "PRIVATE" },
 	{ 0x70B3D5, 0xAA0000, 0xAA0FFF, "Simple Works, Inc.", "SIMPLE-WORKS" },
-	{ 0x70B3D5, 0x058000, 0x058FFF, "Telink Semiconductor CO, Limtied, Taiwan", "TELINK-SEMICONDUCTOR-LIMTIED-TAIWAN" },
-	{ 0x70B3D5, 0xEFA000, 0xEFAFFF, "NextEra Energy Resources, LLC", "NEXTERA-ENERGY-RESOURCES-LLC" },
-	{ 0x70B3D5, 0x95A000, 0x95AFFF, "Sigmann Elektronik GmbH", "SIGMANN-ELEKTRONIK" },
-	{ 0x70B3D5, 0x2E3000, 0x2E3FFF, "Meiknologic GmbH", "MEIKNOLOGIC" },
+	{ 0x70B3D5, 0xAA1000, 0xAA1FFF, "Shenzhen Weema TV Technology Co.,Ltd.", "SHENZHEN-WEEMA-TV" },
+	{ 0x70B3D5, 0xAA2000, 0xAA2FFF, "eumig industrie-TV GmbH.", "EUMIG-INDUSTRIE-TV" },
+	{ 0x70B3D5, 0xAA3000, 0xAA3FFF, "LINEAGE POWER PVT LTD.,", "LINEAGE-POWER-PVT" },
+	{ 0x70B3D5, 0xAA4000, 0xAA4FFF, "Pullnet Technology,S.L.", "PULLNET-S-L" },
+	{ 0x70B3D5, 0xAA6000, 0xAA6FFF, "Proximus", "PROXIMUS" },
+	{ 0x70B3D5, 0xAA7000, 0xAA7FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0xAA8000, 0xAA8FFF, "West-Com Nurse Call Systems, Inc.", "WEST-COM-NURSE-CALL" },
+	{ 0x70B3D5, 0xAA9000, 0xAA9FFF, "Datamars SA", "DATAMARS" },
+	{ 0x70B3D5, 0xAAA000, 0xAAAFFF, "Xemex NV", "XEMEX-NV" },
+	{ 0x70B3D5, 0xAAC000, 0xAACFFF, "SensoTec GmbH", "SENSOTEC" },
+	{ 0x70B3D5, 0xAAD000, 0xAADFFF, "Bartec GmbH", "BARTEC" },
+	{ 0x70B3D5, 0xAAE000, 0xAAEFFF, "Nuviz Oy", "NUVIZ-OY" },
+	{ 0x70B3D5, 0xAAF000, 0xAAFFFF, "Exi Flow Measurement Ltd", "EXI-FLOW-MEASUREMENT" },
+	{ 0x70B3D5, 0xAB0000, 0xAB0FFF, "OSR R&D ISRAEL LTD", "OSR-R-D-ISRAEL" },
+	{ 0x70B3D5, 0xAB3000, 0xAB3FFF, "MICAS AG", "MICAS" },
+	{ 0x70B3D5, 0xAB4000, 0xAB4FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
+	{ 0x70B3D5, 0xAB5000, 0xAB5FFF, "BroadSoft Inc", "BROADSOFT" },
+	{ 0x70B3D5, 0xAB7000, 0xAB7FFF, "SIGLEAD INC", "SIGLEAD" },
+	{ 0x70B3D5, 0xAB8000, 0xAB8FFF, "HORIBA ABX SAS", "HORIBA-ABX-SAS" },
+	{ 0x70B3D5, 0xAB9000, 0xAB9FFF, "Dynamic Controls", "DYNAMIC-CONTROLS" },
+	{ 0x70B3D5, 0xABA000, 0xABAFFF, "CL International", "CL" },
+	{ 0x70B3D5, 0xABB000, 0xABBFFF, "David Horn Communications Ltd", "DAVID-HORN-COMMUNICATION" },
 	{ 0x70B3D5, 0xABC000, 0xABCFFF, "BKM-Micronic Richtfunkanlagen GmbH", "BKM-MICRONIC-RICHTFUNKANLAGEN" },
-	{ 0x70B3D5, 0xE4A000, 0xE4AFFF, "ICP NewTech Ltd", "ICP-NEWTECH" },
-	{ 0x70B3D5, 0xECD000, 0xECDFFF, "SBS-Feintechnik GmbH & Co. KG", "SBS-FEINTECHNIK" },
-	{ 0x70B3D5, 0x918000, 0x918FFF, "Glova Rail A/S", "GLOVA-RAIL-A/S" },
-	{ 0x70B3D5, 0x308000, 0x308FFF, "DSD MICROTECHNOLOGY,INC.", "DSD-MICROTECHNOLOGY" },
-	{ 0x70B3D5, 0x6D3000, 0x6D3FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0x908000, 0x908FFF, "Accusonic", "ACCUSONIC" },
-	{ 0x70B3D5, 0x183000, 0x183FFF, "Evco S.p.a.", "EVCO-S-P-A" },
-	{ 0x70B3D5, 0x5A8000, 0x5A8FFF, "Farmobile", "FARMOBILE" },
-	{ 0x70B3D5, 0xC2C000, 0xC2CFFF, "Dromont S.p.A.", "DROMONT-S-P-A" },
-	{ 0x001BC5, 0x0C6000, 0x0C6FFF, "Connode", "CONNODE" },
-	{ 0x70B3D5, 0x3C2000, 0x3C2FFF, "Cellular Specialties, Inc.", "CELLULAR-SPECIALTIES" },
-	{ 0x001BC5, 0x0B6000, 0x0B6FFF, "Veilux inc.", "VEILUX" },
-	{ 0x001BC5, 0x0AC000, 0x0ACFFF, "AVnu Alliance", "AVNU-ALLIANCE" },
-	{ 0x001BC5, 0x0BC000, 0x0BCFFF, "kuwatec, Inc.", "KUWATEC" },
-	{ 0x001BC5, 0x0A2000, 0x0A2FFF, "Hettich Benelux", "HETTICH-BENELUX" },
-	{ 0x001BC5, 0x0A8000, 0x0A8FFF, "Link Precision", "LINK-PRECISION" },
-	{ 0x001BC5, 0x09D000, 0x09DFFF, "Navitar Inc", "NAVITAR" },
-	{ 0x001BC5, 0x093000, 0x093FFF, "Ambient Devices, Inc.", "AMBIENT-DEVICES" },
-	{ 0x001BC5, 0x081000, 0x081FFF, "WonATech Co., Ltd.", "WONATECH" },
-	{ 0x001BC5, 0x084000, 0x084FFF, "Applied Innovations Research LLC", "APPLIED-INNOVATIONS-RESEARCH-LLC" },
-	{ 0x001BC5, 0x07B000, 0x07BFFF, "QCORE Medical", "QCORE-MEDICAL" },
-	{ 0x001BC5, 0x07A000, 0x07AFFF, "Servicios Electronicos Industriales Berbel s.l.", "SERVICIOS-ELECTRONICOS-INDUSTRIALES-BERBEL-S-L" },
-	{ 0x001BC5, 0x089000, 0x089FFF, "SIGNATURE CONTROL SYSTEMS, INC.", "SIGNATURE-CONTROL" },
-	{ 0x001BC5, 0x077000, 0x077FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
-	{ 0x001BC5, 0x063000, 0x063FFF, "Check-It Solutions Inc", "CHECK-IT-SOLUTIONS" },
-	{ 0x001BC5, 0x070000, 0x070FFF, "Siemens Industries, Inc, Retail & Commercial Systems", "SIEMENS-INDUSTRIES-RETAIL-COMMERCIAL" },
-	{ 0x001BC5, 0x071000, 0x071FFF, "Center for E-Commerce Infrastructure Development, The University of Hong Kong", "CENTER-FOR-E-COMMERCE-INFRASTRUCTURE-DEVELOPMENT-THE-UNIVERSITY-OF-HONG-KONG" },
-	{ 0x001BC5, 0x067000, 0x067FFF, "Embit srl", "EMBIT-SRL" },
-	{ 0x001BC5, 0x066000, 0x066FFF, "Manufacturas y transformados AB", "MANUFACTURAS-Y-TRANSFORMADOS-AB" },
-	{ 0x001BC5, 0x06D000, 0x06DFFF, "TES Electronic Solutions (I) Pvt. Ltd.", "TES-SOLUTIONS-I-PVT" },
-	{ 0x001BC5, 0x04F000, 0x04FFFF, "Orbital Systems, Ltd.", "ORBITAL" },
-	{ 0x001BC5, 0x05D000, 0x05DFFF, "JSC Prominform", "JSC-PROMINFORM" },
-	{ 0x001BC5, 0x053000, 0x053FFF, "Metrycom Communications Ltd", "METRYCOM-COMMUNICATION" },
-	{ 0x001BC5, 0x059000, 0x059FFF, "INPIXAL", "INPIXAL" },
-	{ 0x001BC5, 0x045000, 0x045FFF, "Marvel Digital International Limited", "MARVEL-DIGITAL" },
-	{ 0x001BC5, 0x049000, 0x049FFF, "EUROCONTROL S.p.A.", "EUROCONTROL-S-P-A" },
-	{ 0x001BC5, 0x03F000, 0x03FFFF, "ELTRADE Ltd", "ELTRADE" },
-	{ 0x001BC5, 0x03A000, 0x03AFFF, "MindMade Sp. z o.o.", "MINDMADE-SP-Z-O-O" },
-	{ 0x001BC5, 0x030000, 0x030FFF, "OctoGate it Security Systems GmbH", "OCTOGATE-IT-SECURITY" },
-	{ 0x001BC5, 0x026000, 0x026FFF, "DIMEP Sistemas", "DIMEP-SISTEMAS" },
-	{ 0x001BC5, 0x022000, 0x022FFF, "CJSC STC SIMOS", "CJSC-STC-SIMOS" },
-	{ 0x001BC5, 0x01E000, 0x01EFFF, "Private", "PRIVATE" },
-	{ 0x001BC5, 0x011000, 0x011FFF, "OOO NPP Mera", "OOO-NPP-MERA" },
-	{ 0x001BC5, 0x007000, 0x007FFF, "Energy Aware Technology", "ENERGY-AWARE" },
-	{ 0x001BC5, 0x001000, 0x001FFF, "OpenRB.com, Direct SIA", "OPENRB-COM-DIRECT-SIA" },
-	{ 0x70B3D5, 0x6C7000, 0x6C7FFF, "Becton Dickinson", "BECTON-DICKINSON" },
-	{ 0x70B3D5, 0xCA8000, 0xCA8FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
-	{ 0x70B3D5, 0x609000, 0x609FFF, "PBSI Group Limited", "PBSI-GROUP" },
+	{ 0x70B3D5, 0xABE000, 0xABEFFF, "MART NETWORK SOLUTIONS LTD", "MART-NETWORK-SOLUTIONS" },
+	{ 0x70B3D5, 0xABF000, 0xABFFFF, "AGR International", "AGR" },
+	{ 0x70B3D5, 0xAC1000, 0xAC1FFF, "AEM Singapore Pte. Ltd.", "AEM-SINGAPORE-PTE" },
+	{ 0x70B3D5, 0xAC3000, 0xAC3FFF, "Novoptel GmbH", "NOVOPTEL" },
+	{ 0x70B3D5, 0xAC4000, 0xAC4FFF, "Lexi Devices, Inc.", "LEXI-DEVICES" },
+	{ 0x70B3D5, 0xAC5000, 0xAC5FFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
+	{ 0x70B3D5, 0xAC6000, 0xAC6FFF, "SMTC Corporation", "SMTC" },
+	{ 0x70B3D5, 0xAC7000, 0xAC7FFF, "vivaMOS", "VIVAMOS" },
+	{ 0x70B3D5, 0xAC8000, 0xAC8FFF, "Heartland.Data Inc.", "HEARTLAND-DATA" },
+	{ 0x70B3D5, 0xAC9000, 0xAC9FFF, "Trinity Solutions LLC", "TRINITY-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0xACA000, 0xACAFFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
+	{ 0x70B3D5, 0xACB000, 0xACBFFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0xACD000, 0xACDFFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xACF000, 0xACFFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0xAD1000, 0xAD1FFF, "Sensile Technologies SA", "SENSILE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xAD2000, 0xAD2FFF, "Wart-Elektronik", "WART-ELEKTRONIK" },
+	{ 0x70B3D5, 0xAD5000, 0xAD5FFF, "Birdland Audio", "BIRDLAND-AUDIO" },
+	{ 0x70B3D5, 0xAD6000, 0xAD6FFF, "Lemonade Lab Inc", "LEMONADE-LAB" },
+	{ 0x70B3D5, 0xAD8000, 0xAD8FFF, "Euklis by GSG International", "EUKLIS-BY-GSG" },
+	{ 0x70B3D5, 0xADA000, 0xADAFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xADB000, 0xADBFFF, "RF Code", "RF-CODE" },
+	{ 0x70B3D5, 0xADC000, 0xADCFFF, "SODAQ", "SODAQ" },
+	{ 0x70B3D5, 0xADD000, 0xADDFFF, "GHL Systems Berhad", "GHL-BERHAD" },
+	{ 0x70B3D5, 0xADE000, 0xADEFFF, "ISAC SRL", "ISAC-SRL" },
+	{ 0x70B3D5, 0xADF000, 0xADFFFF, "Seraphim Optronics Ltd", "SERAPHIM-OPTRONICS" },
+	{ 0x70B3D5, 0xAE0000, 0xAE0FFF, "AnyComm.Co.,Ltd.", "ANYCOMM" },
+	{ 0x70B3D5, 0xAE1000, 0xAE1FFF, "DimoCore Corporation", "DIMOCORE" },
+	{ 0x70B3D5, 0xAE2000, 0xAE2FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
+	{ 0x70B3D5, 0xAE3000, 0xAE3FFF, "Zhejiang Wellsun Electric Meter Co.,Ltd", "ZHEJIANG-WELLSUN-ELECTRIC-METER" },
+	{ 0x70B3D5, 0xAE5000, 0xAE5FFF, "BeatCraft, Inc.", "BEATCRAFT" },
+	{ 0x70B3D5, 0xAE6000, 0xAE6FFF, "Ya Batho Trading (Pty) Ltd", "YA-BATHO-TRADING-PTY" },
+	{ 0x70B3D5, 0xAE7000, 0xAE7FFF, "E-T-A Elektrotechnische Apparate GmbH", "E-T-A-ELEKTROTECHNISCHE-APPARATE" },
+	{ 0x70B3D5, 0xAE9000, 0xAE9FFF, "Cari Electronic", "CARI" },
+	{ 0x70B3D5, 0xAEA000, 0xAEAFFF, "BBR Verkehrstechnik GmbH", "BBR-VERKEHRSTECHNIK" },
+	{ 0x70B3D5, 0xAEB000, 0xAEBFFF, "Association Romandix", "ASSOCIATION-ROMANDIX" },
+	{ 0x70B3D5, 0xAEE000, 0xAEEFFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
+	{ 0x70B3D5, 0xAEF000, 0xAEFFFF, "Baumtec GmbH", "BAUMTEC" },
+	{ 0x70B3D5, 0xAF0000, 0xAF0FFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
+	{ 0x70B3D5, 0xAF1000, 0xAF1FFF, "Emka Technologies", "EMKA-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xAF2000, 0xAF2FFF, "True Networks Ltd.", "TRUE-NETWORKS" },
+	{ 0x70B3D5, 0xAF3000, 0xAF3FFF, "New Japan Radio Co., Ltd", "NEW-JAPAN-RADIO" },
+	{ 0x70B3D5, 0xAF4000, 0xAF4FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0xAF5000, 0xAF5FFF, "Net And Print Inc.", "NET-AND-PRINT" },
+	{ 0x70B3D5, 0xAF6000, 0xAF6FFF, "S.C.E. srl", "S-C-E-SRL" },
+	{ 0x70B3D5, 0xAF7000, 0xAF7FFF, "DimoSystems BV", "DIMOSYSTEMS" },
+	{ 0x70B3D5, 0xAF8000, 0xAF8FFF, "boekel", "BOEKEL" },
+	{ 0x70B3D5, 0xAF9000, 0xAF9FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xAFA000, 0xAFAFFF, "Power Security Systems Ltd.", "POWER-SECURITY" },
+	{ 0x70B3D5, 0xAFB000, 0xAFBFFF, "Shanghai Tianhe Automation Instrumentation Co., Ltd.", "SHANGHAI-TIANHE-AUTOMATION-INSTRUMENTATION" },
+	{ 0x70B3D5, 0xAFE000, 0xAFEFFF, "MESOTECHNIC", "MESOTECHNIC" },
+	{ 0x70B3D5, 0xAFF000, 0xAFFFFF, "digital-spice", "DIGITAL-SPICE" },
+	{ 0x70B3D5, 0xB02000, 0xB02FFF, "Nordic Automation Systems AS", "NORDIC-AUTOMATION-AS" },
+	{ 0x70B3D5, 0xB04000, 0xB04FFF, "Herrmann Datensysteme GmbH", "HERRMANN-DATENSYSTEME" },
+	{ 0x70B3D5, 0xB05000, 0xB05FFF, "E-PLUS TECHNOLOGY CO., LTD", "E-PLUS" },
+	{ 0x70B3D5, 0xB07000, 0xB07FFF, "Arrowvale Electronics", "ARROWVALE-ELECTRONICS" },
+	{ 0x70B3D5, 0xB08000, 0xB08FFF, "Secuinfo Co. Ltd", "SECUINFO" },
+	{ 0x70B3D5, 0xB09000, 0xB09FFF, "FIRST LIGHT IMAGING", "FIRST-LIGHT-IMAGING" },
+	{ 0x70B3D5, 0xB0B000, 0xB0BFFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
+	{ 0x70B3D5, 0xB0C000, 0xB0CFFF, "Vigilate srl", "VIGILATE-SRL" },
+	{ 0x70B3D5, 0xB0F000, 0xB0FFFF, "merkur Funksysteme AG", "MERKUR-FUNKSYSTEME" },
+	{ 0x70B3D5, 0xB10000, 0xB10FFF, "Zumbach Electronic AG", "ZUMBACH" },
+	{ 0x70B3D5, 0xB11000, 0xB11FFF, "CAB S.R.L.", "CAB-S-R-L" },
+	{ 0x70B3D5, 0xB13000, 0xB13FFF, "Omwave", "OMWAVE" },
+	{ 0x70B3D5, 0xB15000, 0xB15FFF, "Eta Beta Srl", "ETA-BETA-SRL" },
+	{ 0x70B3D5, 0xB16000, 0xB16FFF, "XI'AN SHENMING ELECTRON TECHNOLOGY CO.,LTD", "XI-AN-SHENMING-ELECTRON" },
+	{ 0x70B3D5, 0xB17000, 0xB17FFF, "Intesens", "INTESENS" },
+	{ 0x70B3D5, 0xB18000, 0xB18FFF, "Abbas, a.s.", "ABBAS-A-S" },
+	{ 0x70B3D5, 0xB1A000, 0xB1AFFF, "Aaronia AG", "AARONIA" },
+	{ 0x70B3D5, 0xB1D000, 0xB1DFFF, "Safelet BV", "SAFELET" },
+	{ 0x70B3D5, 0xB1E000, 0xB1EFFF, "Fen Systems Ltd", "FEN" },
+	{ 0x70B3D5, 0xB1F000, 0xB1FFFF, "TECNOWATT", "TECNOWATT" },
+	{ 0x70B3D5, 0xB21000, 0xB21FFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0xB23000, 0xB23FFF, "Supervision Test et Pilotage", "SUPERVISION-TEST-ET-PILOTAGE" },
+	{ 0x70B3D5, 0xB24000, 0xB24FFF, "Datasat Digital Entertainment", "DATASAT-DIGITAL-ENTERTAINMENT" },
+	{ 0x70B3D5, 0xB26000, 0xB26FFF, "INTEC International GmbH", "INTEC" },
+	{ 0x70B3D5, 0xB28000, 0xB28FFF, "HUSTY M.Styczen J.Hupert sp.j.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
+	{ 0x70B3D5, 0xB29000, 0xB29FFF, "WiViCom Co., Ltd.", "WIVICOM" },
+	{ 0x70B3D5, 0xB2A000, 0xB2AFFF, "Myro Control, LLC", "MYRO-CONTROL-LLC" },
+	{ 0x70B3D5, 0xB2B000, 0xB2BFFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0xB2E000, 0xB2EFFF, "Green Access Ltd", "GREEN-ACCESS" },
+	{ 0x70B3D5, 0xB30000, 0xB30FFF, "Systolé Hardware B.V.", "SYSTOLé-HARDWARE" },
+	{ 0x70B3D5, 0xB31000, 0xB31FFF, "Qwave Inc", "QWAVE" },
+	{ 0x70B3D5, 0xB33000, 0xB33FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xB34000, 0xB34FFF, "Medtronic", "MEDTRONIC" },
+	{ 0x70B3D5, 0xB35000, 0xB35FFF, "Rexxam Co.,Ltd.", "REXXAM" },
+	{ 0x70B3D5, 0xB37000, 0xB37FFF, "CODEC Co., Ltd.", "CODEC" },
+	{ 0x70B3D5, 0xB38000, 0xB38FFF, "GoTrustID Inc.", "GOTRUSTID" },
+	{ 0x70B3D5, 0xB39000, 0xB39FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xB3A000, 0xB3AFFF, "Adigitalmedia", "ADIGITALMEDIA" },
+	{ 0x70B3D5, 0xB3B000, 0xB3BFFF, "Insitu, Inc", "INSITU" },
+	{ 0x70B3D5, 0xB3C000, 0xB3CFFF, "DORLET SAU", "DORLET-SAU" },
+	{ 0x70B3D5, 0xB3D000, 0xB3DFFF, "Inras GmbH", "INRAS" },
+	{ 0x70B3D5, 0xB3E000, 0xB3EFFF, "Paradigm Communication Systems Ltd", "PARADIGM-COMMUNICATION" },
+	{ 0x70B3D5, 0xB3F000, 0xB3FFFF, "Orbit International", "ORBIT" },
 	{ 0x70B3D5, 0xB40000, 0xB40FFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
-	{ 0x70B3D5, 0x0D6000, 0x0D6FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x297000, 0x297FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x70B3D5, 0x942000, 0x942FFF, "TruTeq Devices (Pty) Ltd", "TRUTEQ-DEVICES-PTY" },
-	{ 0x70B3D5, 0xF7B000, 0xF7BFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0xB43000, 0xB43FFF, "ZAO ZEO", "ZAO-ZEO" },
+	{ 0x70B3D5, 0xB44000, 0xB44FFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0xB47000, 0xB47FFF, "DSIT Solutions LTD", "DSIT-SOLUTIONS" },
+	{ 0x70B3D5, 0xB48000, 0xB48FFF, "DWQ Informatikai Tanacsado es Vezerlestechnikai KFT", "DWQ-INFORMATIKAI-TANACSADO-ES-VEZERLESTECHNIKAI-KFT" },
+	{ 0x70B3D5, 0xB49000, 0xB49FFF, "ANALOGICS TECH INDIA LTD", "ANALOGICS-TECH-INDIA" },
+	{ 0x70B3D5, 0xB4A000, 0xB4AFFF, "MEDEX", "MEDEX" },
+	{ 0x70B3D5, 0xB4D000, 0xB4DFFF, "Avidbots Corporation", "AVIDBOTS" },
+	{ 0x70B3D5, 0xB51000, 0xB51FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xB53000, 0xB53FFF, "Revolution Retail Systems, LLC", "REVOLUTION-RETAIL-LLC" },
+	{ 0x70B3D5, 0xB55000, 0xB55FFF, "CTAG - ESG36871424", "CTAG---ESG36871424" },
+	{ 0x70B3D5, 0xB56000, 0xB56FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
+	{ 0x70B3D5, 0xB59000, 0xB59FFF, "FutureTechnologyLaboratories INC.", "FUTURETECHNOLOGYLABORATORIES" },
+	{ 0x70B3D5, 0xB5C000, 0xB5CFFF, "Prozess Technologie", "PROZESS-TECHNOLOGIE" },
+	{ 0x70B3D5, 0xB5F000, 0xB5FFFF, "CRDMDEVEOPPEMENTS", "CRDMDEVEOPPEMENTS" },
+	{ 0x70B3D5, 0xB62000, 0xB62FFF, "Sakura Seiki Co.,Ltd.", "SAKURA-SEIKI" },
+	{ 0x70B3D5, 0xB64000, 0xB64FFF, "OSUNG LST CO.,LTD.", "OSUNG-LST" },
+	{ 0x70B3D5, 0xB66000, 0xB66FFF, "Silent Gliss International Ltd", "SILENT-GLISS" },
+	{ 0x70B3D5, 0xB67000, 0xB67FFF, "RedWave Labs Ltd", "REDWAVE-LABS" },
+	{ 0x70B3D5, 0xB6A000, 0xB6AFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0xB6B000, 0xB6BFFF, "Cambria Corporation", "CAMBRIA" },
+	{ 0x70B3D5, 0xB6C000, 0xB6CFFF, "GHM-Messtechnik GmbH (Standort IMTRON)", "GHM-MESSTECHNIK-STANDORT-IMTRON" },
+	{ 0x70B3D5, 0xB6D000, 0xB6DFFF, "Movis", "MOVIS" },
+	{ 0x70B3D5, 0xB71000, 0xB71FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xB72000, 0xB72FFF, "UB330.net d.o.o.", "UB330-NET-D-O-O" },
+	{ 0x70B3D5, 0xB74000, 0xB74FFF, "OnYield Inc Ltd", "ONYIELD" },
+	{ 0x70B3D5, 0xB77000, 0xB77FFF, "Motec Pty Ltd", "MOTEC-PTY" },
+	{ 0x70B3D5, 0xB78000, 0xB78FFF, "HOERMANN GmbH", "HOERMANN" },
+	{ 0x70B3D5, 0xB7A000, 0xB7AFFF, "MAHLE", "MAHLE" },
+	{ 0x70B3D5, 0xB7C000, 0xB7CFFF, "Electronic Navigation Ltd", "NAVIGATION" },
+	{ 0x70B3D5, 0xB7D000, 0xB7DFFF, "LOGIX ITS Inc", "LOGIX-ITS" },
+	{ 0x70B3D5, 0xB7E000, 0xB7EFFF, "Elbit Systems of America - Fort Worth Operations", "ELBIT-OF-AMERICA---FORT-WORTH-OPERATIONS" },
+	{ 0x70B3D5, 0xB7F000, 0xB7FFFF, "JSK System", "JSK-SYSTEM" },
+	{ 0x70B3D5, 0xB81000, 0xB81FFF, "Instro Precision Limited", "INSTRO-PRECISION" },
+	{ 0x70B3D5, 0xB82000, 0xB82FFF, "Lookout Portable Security", "LOOKOUT-PORTABLE-SECURITY" },
+	{ 0x70B3D5, 0xB85000, 0xB85FFF, "Fenotech Inc.", "FENOTECH" },
+	{ 0x70B3D5, 0xB88000, 0xB88FFF, "ARP Corporation", "ARP" },
+	{ 0x70B3D5, 0xB89000, 0xB89FFF, "IDA", "IDA" },
+	{ 0x70B3D5, 0xB8A000, 0xB8AFFF, "Nexus Tech. VN", "NEXUS-TECH-VN" },
+	{ 0x70B3D5, 0xB8B000, 0xB8BFFF, "Profound Medical Inc.", "PROFOUND-MEDICAL" },
+	{ 0x70B3D5, 0xB8C000, 0xB8CFFF, "ePOINT Embedded Computing Limited", "EPOINT-EMBEDDED-COMPUTING" },
+	{ 0x70B3D5, 0xB8D000, 0xB8DFFF, "JungwooEng Co., Ltd", "JUNGWOOENG" },
+	{ 0x70B3D5, 0xB8E000, 0xB8EFFF, "UR FOG S.R.L.", "UR-FOG-S-R-L" },
+	{ 0x70B3D5, 0xB8F000, 0xB8FFFF, "Assembly Contracts Ltd", "ASSEMBLY-CONTRACTS" },
+	{ 0x70B3D5, 0xB91000, 0xB91FFF, "Dynetics, Inc.", "DYNETICS" },
+	{ 0x70B3D5, 0xB93000, 0xB93FFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
+	{ 0x70B3D5, 0xB94000, 0xB94FFF, "Cygnetic Technologies (Pty) Ltd", "CYGNETIC-TECHNOLOGIES-PTY" },
+	{ 0x70B3D5, 0xB97000, 0xB97FFF, "Canam Technology, Inc.", "CANAM" },
+	{ 0x70B3D5, 0xB98000, 0xB98FFF, "GSF Corporation Pte Ltd", "GSF-PTE" },
 	{ 0x70B3D5, 0xB99000, 0xB99FFF, "DomoSafety S.A.", "DOMOSAFETY" },
-	{ 0x70B3D5, 0xD51000, 0xD51FFF, "Azcom Technology S.r.l.", "AZCOM-S-R-L" },
+	{ 0x70B3D5, 0xB9A000, 0xB9AFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0xB9B000, 0xB9BFFF, "Elektronik Art", "ELEKTRONIK-ART" },
+	{ 0x70B3D5, 0xB9C000, 0xB9CFFF, "EDCO Technology 1993 ltd", "EDCO-1993" },
+	{ 0x70B3D5, 0xB9E000, 0xB9EFFF, "POLSYSTEM SI SP. Z O.O., S.K.A.", "POLSYSTEM-SI-SP-Z-O-O-S-K-A" },
 	{ 0x70B3D5, 0xBA1000, 0xBA1FFF, "Cathwell AS", "CATHWELL-AS" },
-	{ 0x70B3D5, 0x286000, 0x286FFF, "Pedax Danmark", "PEDAX-DANMARK" },
-	{ 0x70B3D5, 0x1A9000, 0x1A9FFF, "OCEANIX INC.", "OCEANIX" },
-	{ 0x70B3D5, 0x733000, 0x733FFF, "SA Instrumentation Limited", "INSTRUMENTATION" },
-	{ 0x70B3D5, 0x652000, 0x652FFF, "Robert Bosch, LLC", "ROBERT-BOSCH-LLC" },
-	{ 0x70B3D5, 0xF65000, 0xF65FFF, "MARKUS LABS", "MARKUS-LABS" },
-	{ 0x70B3D5, 0xF2E000, 0xF2EFFF, "Shanghai JCY Technology Company", "SHANGHAI-JCY-COMPANY" },
-	{ 0x70B3D5, 0x7F8000, 0x7F8FFF, "Solvera Lynx d.d.", "SOLVERA-LYNX-D-D" },
-	{ 0x70B3D5, 0x5BE000, 0x5BEFFF, "CASWA", "CASWA" },
-	{ 0x70B3D5, 0xF55000, 0xF55FFF, "Kohler Mira Ltd", "KOHLER-MIRA" },
-	{ 0x70B3D5, 0x7ED000, 0x7EDFFF, "The Things Network Foundation", "THE-THINGS-NETWORK-FOUNDATION" },
-	{ 0x70B3D5, 0xA9D000, 0xA9DFFF, "VITEC MULTIMEDIA", "VITEC-MULTIMEDIA" },
-	{ 0x70B3D5, 0x1A8000, 0x1A8FFF, "STC Rainbow Ltd.", "STC-RAINBOW" },
-	{ 0x70B3D5, 0x3CA000, 0x3CAFFF, "TTI Ltd", "TTI" },
-	{ 0x70B3D5, 0xE1C000, 0xE1CFFF, "Xcenter AS", "XCENTER-AS" },
-	{ 0x70B3D5, 0x184000, 0x184FFF, "XV360 Optical Information Systems Ltd.", "XV360-OPTICAL-INFORMATION" },
-	{ 0x70B3D5, 0xB5C000, 0xB5CFFF, "Prozess Technologie", "PROZESS-TECHNOLOGIE" },
-	{ 0x70B3D5, 0xAF4000, 0xAF4FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0x531000, 0x531FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0xBA2000, 0xBA2FFF, "MAMAC Systems, Inc.", "MAMAC" },
+	{ 0x70B3D5, 0xBA3000, 0xBA3FFF, "TIAMA", "TIAMA" },
+	{ 0x70B3D5, 0xBA4000, 0xBA4FFF, "EIWA GIKEN INC.", "EIWA-GIKEN" },
 	{ 0x70B3D5, 0xBA7000, 0xBA7FFF, "Digital Yacht Ltd", "DIGITAL-YACHT" },
-	{ 0x70B3D5, 0x1C7000, 0x1C7FFF, "Hoshin Electronics Co., Ltd.", "HOSHIN-ELECTRONICS" },
-	{ 0x70B3D5, 0x28B000, 0x28BFFF, "Arnouse Digital Devices, Corp.", "ARNOUSE-DIGITAL-DEVICES" },
-	{ 0x70B3D5, 0xD94000, 0xD94FFF, "Dewetron GmbH", "DEWETRON" },
-	{ 0x70B3D5, 0x974000, 0x974FFF, "Jireh Industries Ltd.", "JIREH-INDUSTRIES" },
-	{ 0x70B3D5, 0x544000, 0x544FFF, "Silicon Safe Ltd", "SILICON-SAFE" },
-	{ 0x70B3D5, 0xEE1000, 0xEE1FFF, "allora Factory BVBA", "ALLORA-FACTORY-BVBA" },
-	{ 0x70B3D5, 0x640000, 0x640FFF, "Electronic Equipment Company Pvt. Ltd.", "EQUIPMENT-COMPANY-PVT" },
-	{ 0x70B3D5, 0xD65000, 0xD65FFF, "CRDE", "CRDE" },
-	{ 0x70B3D5, 0xAE1000, 0xAE1FFF, "DimoCore Corporation", "DIMOCORE" },
-	{ 0x70B3D5, 0x3C3000, 0x3C3FFF, "AIMCO", "AIMCO" },
-	{ 0x70B3D5, 0x3F6000, 0x3F6FFF, "Sycomp Electronic GmbH", "SYCOMP" },
-	{ 0x70B3D5, 0x90C000, 0x90CFFF, "ANTEK GmbH", "ANTEK" },
-	{ 0x70B3D5, 0x10A000, 0x10AFFF, "SEASON DESIGN TECHNOLOGY", "SEASON-DESIGN" },
-	{ 0x70B3D5, 0x47C000, 0x47CFFF, "Par-Tech, Inc.", "PAR-TECH" },
-	{ 0x70B3D5, 0xAC3000, 0xAC3FFF, "Novoptel GmbH", "NOVOPTEL" },
-	{ 0x70B3D5, 0x97C000, 0x97CFFF, "Nu-Tek Power Controls and Automation", "NU-TEK-POWER-CONTROLS-AND-AUTOMATION" },
-	{ 0x70B3D5, 0x8F2000, 0x8F2FFF, "Rimota Limited", "RIMOTA" },
-	{ 0x70B3D5, 0x0BD000, 0x0BDFFF, "Andium", "ANDIUM" },
-	{ 0x70B3D5, 0xE3D000, 0xE3DFFF, "Leo Bodnar Electronics Ltd", "LEO-BODNAR-ELECTRONICS" },
-	{ 0x70B3D5, 0xB26000, 0xB26FFF, "INTEC International GmbH", "INTEC" },
-	{ 0x70B3D5, 0x643000, 0x643FFF, "Marques,S.A.", "MARQUES" },
-	{ 0x70B3D5, 0xA7C000, 0xA7CFFF, "Transelektronik Messgeräte GmbH", "TRANSELEKTRONIK-MESSGERAETE" },
-	{ 0x70B3D5, 0xC27000, 0xC27FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x70B3D5, 0x94F000, 0x94FFFF, "MART NETWORK SOLUTIONS LTD", "MART-NETWORK-SOLUTIONS" },
-	{ 0x70B3D5, 0xDFF000, 0xDFFFFF, "Spanawave Corporation", "SPANAWAVE" },
-	{ 0x70B3D5, 0x7B6000, 0x7B6FFF, "Amada Miyachi America Inc.", "AMADA-MIYACHI-AMERICA" },
-	{ 0x70B3D5, 0x55A000, 0x55AFFF, "Sontay Ltd.", "SONTAY" },
-	{ 0x70B3D5, 0x11C000, 0x11CFFF, "Samriddi Automations Pvt. Ltd.", "SAMRIDDI-AUTOMATIONS-PVT" },
-	{ 0x70B3D5, 0xCB2000, 0xCB2FFF, "SECLAB", "SECLAB" },
-	{ 0x70B3D5, 0xA91000, 0xA91FFF, "IDEAL INDUSTRIES Ltd t/a Casella", "IDEAL-INDUSTRIES-T/A-CASELLA" },
-	{ 0x70B3D5, 0xAE5000, 0xAE5FFF, "BeatCraft, Inc.", "BEATCRAFT" },
-	{ 0x70B3D5, 0x1DD000, 0x1DDFFF, "RF CREATIONS LTD", "RF-CREATIONS" },
-	{ 0x70B3D5, 0x1DA000, 0x1DAFFF, "Promess Inc.", "PROMESS" },
-	{ 0x70B3D5, 0x55B000, 0x55BFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
-	{ 0x70B3D5, 0x0AE000, 0x0AEFFF, "Norsat International Inc.", "NORSAT" },
-	{ 0x70B3D5, 0x461000, 0x461FFF, "TESEC Corporation", "TESEC" },
-	{ 0x70B3D5, 0x7FB000, 0x7FBFFF, "db Broadcast Products Ltd", "DB-BROADCAST-PRODUCTS" },
-	{ 0x70B3D5, 0x6FF000, 0x6FFFFF, "AKEO PLUS", "AKEO-PLUS" },
-	{ 0x70B3D5, 0xCD2000, 0xCD2FFF, "HBH Microwave GmbH", "HBH-MICROWAVE" },
-	{ 0x70B3D5, 0xB23000, 0xB23FFF, "Supervision Test et Pilotage", "SUPERVISION-TEST-ET-PILOTAGE" },
-	{ 0x70B3D5, 0x178000, 0x178FFF, "Gamber Johnson-LLC", "GAMBER-JOHNSON-LLC" },
-	{ 0x70B3D5, 0xA5C000, 0xA5CFFF, "Molekule", "MOLEKULE" },
-	{ 0x70B3D5, 0x012000, 0x012FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0xFEC000, 0xFECFFF, "Finder SpA", "FINDER-SPA" },
-	{ 0x70B3D5, 0x19E000, 0x19EFFF, "J-Factor Embedded Technologies", "J-FACTOR-EMBEDDED-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xA20000, 0xA20FFF, "Design For Life Systems", "DESIGN-FOR-LIFE" },
-	{ 0x70B3D5, 0x90A000, 0x90AFFF, "Hangzhou SunTown Intelligent Science & Technology Co.,Ltd.", "HANGZHOU-SUNTOWN-INTELLIGENT-SCIENCE" },
-	{ 0x70B3D5, 0x1DB000, 0x1DBFFF, "Hudson Robotics", "HUDSON-ROBOTICS" },
-	{ 0x70B3D5, 0x5CC000, 0x5CCFFF, "Akse srl", "AKSE-SRL" },
-	{ 0x70B3D5, 0x973000, 0x973FFF, "Autonomic Controls, Inc.", "AUTONOMIC-CONTROLS" },
-	{ 0x70B3D5, 0x083000, 0x083FFF, "ZAO ZEO", "ZAO-ZEO" },
-	{ 0x70B3D5, 0x42A000, 0x42AFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xBA9000, 0xBA9FFF, "Alma", "ALMA" },
+	{ 0x70B3D5, 0xBAA000, 0xBAAFFF, "Device Solutions Ltd", "DEVICE-SOLUTIONS" },
+	{ 0x70B3D5, 0xBAB000, 0xBABFFF, "Axotec Technologies GmbH", "AXOTEC-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xBAC000, 0xBACFFF, "AdInte, inc.", "ADINTE" },
+	{ 0x70B3D5, 0xBAD000, 0xBADFFF, "Technik & Design GmbH", "TECHNIK-DESIGN" },
+	{ 0x70B3D5, 0xBAE000, 0xBAEFFF, "WARECUBE,INC", "WARECUBE" },
+	{ 0x70B3D5, 0xBAF000, 0xBAFFFF, "SYS TEC electronic GmbH", "SYS-TEC" },
+	{ 0x70B3D5, 0xBB0000, 0xBB0FFF, "WICELL TECHNOLOGY", "WICELL" },
+	{ 0x70B3D5, 0xBB2000, 0xBB2FFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
+	{ 0x70B3D5, 0xBB3000, 0xBB3FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0xBB4000, 0xBB4FFF, "Integritech", "INTEGRITECH" },
+	{ 0x70B3D5, 0xBB6000, 0xBB6FFF, "Franke Aquarotter GmbH", "FRANKE-AQUAROTTER" },
+	{ 0x70B3D5, 0xBB7000, 0xBB7FFF, "Innoflight, Inc.", "INNOFLIGHT" },
+	{ 0x70B3D5, 0xBB8000, 0xBB8FFF, "Al Kamel Systems S.L.", "AL-KAMEL-S-L" },
+	{ 0x70B3D5, 0xBB9000, 0xBB9FFF, "KOSMEK.Ltd", "KOSMEK" },
+	{ 0x70B3D5, 0xBBD000, 0xBBDFFF, "Providius Corp", "PROVIDIUS" },
+	{ 0x70B3D5, 0xBBE000, 0xBBEFFF, "Sunrise Systems Electronics Co. Inc.", "SUNRISE-ELECTRONICS" },
+	{ 0x70B3D5, 0xBBF000, 0xBBFFFF, "Ensys srl", "ENSYS-SRL" },
+	{ 0x70B3D5, 0xBC1000, 0xBC1FFF, "Abionic", "ABIONIC" },
+	{ 0x70B3D5, 0xBC2000, 0xBC2FFF, "DWEWOONG ELECTRIC Co., Ltd.", "DWEWOONG-ELECTRIC" },
+	{ 0x70B3D5, 0xBC3000, 0xBC3FFF, "eWireless", "EWIRELESS" },
+	{ 0x70B3D5, 0xBC4000, 0xBC4FFF, "Digital Media Professionals", "DIGITAL-MEDIA-PROFESSIONALS" },
+	{ 0x70B3D5, 0xBC6000, 0xBC6FFF, "Hatteland Display AS", "HATTELAND-DISPLAY-AS" },
+	{ 0x70B3D5, 0xBCA000, 0xBCAFFF, "Deymed Diagnostic", "DEYMED-DIAGNOSTIC" },
+	{ 0x70B3D5, 0xBCB000, 0xBCBFFF, "Smart Vision Lights", "SMART-VISION-LIGHTS" },
+	{ 0x70B3D5, 0xBCC000, 0xBCCFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xBCE000, 0xBCEFFF, "YAWATA ELECTRIC INDUSTRIAL CO.,LTD.", "YAWATA-ELECTRIC-INDUSTRIAL" },
+	{ 0x70B3D5, 0xBCF000, 0xBCFFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0xBD1000, 0xBD1FFF, "CableLabs", "CABLELABS" },
+	{ 0x70B3D5, 0xBD2000, 0xBD2FFF, "Burk Technology", "BURK" },
+	{ 0x70B3D5, 0xBD3000, 0xBD3FFF, "FOTONA D.D.", "FOTONA-D-D" },
+	{ 0x70B3D5, 0xBD5000, 0xBD5FFF, "Synics AG", "SYNICS" },
+	{ 0x70B3D5, 0xBD6000, 0xBD6FFF, "Consarc Corporation", "CONSARC" },
+	{ 0x70B3D5, 0xBD8000, 0xBD8FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xBD9000, 0xBD9FFF, "SolwayTech", "SOLWAYTECH" },
+	{ 0x70B3D5, 0xBDA000, 0xBDAFFF, "5-D Systems, Inc.", "5-D" },
+	{ 0x70B3D5, 0xBDD000, 0xBDDFFF, "CDR SRL", "CDR-SRL" },
+	{ 0x70B3D5, 0xBE1000, 0xBE1FFF, "FeCon GmbH", "FECON" },
+	{ 0x70B3D5, 0xBE3000, 0xBE3FFF, "Saratov Electrounit Production Plant named after Sergo Ordzhonikidze, OJSC", "SARATOV-ELECTROUNIT-PRODUCTION-PLANT-NAMED-AFTER-SERGO-ORDZHONIKIDZE-OJSC" },
+	{ 0x70B3D5, 0xBE4000, 0xBE4FFF, "Kunshan excellent Intelligent Technology Co., Ltd.", "KUNSHAN-EXCELLENT-INTELLIGENT" },
+	{ 0x70B3D5, 0xBE5000, 0xBE5FFF, "Pantec Engineering AG", "PANTEC-ENGINEERING" },
+	{ 0x70B3D5, 0xBE6000, 0xBE6FFF, "CCII Systems (Pty) Ltd", "CCII-PTY" },
+	{ 0x70B3D5, 0xBE8000, 0xBE8FFF, "AndFun Co.,Ltd.", "ANDFUN" },
+	{ 0x70B3D5, 0xBE9000, 0xBE9FFF, "Telecast Inc.", "TELECAST" },
+	{ 0x70B3D5, 0xBEA000, 0xBEAFFF, "Virtuosys Ltd", "VIRTUOSYS" },
+	{ 0x70B3D5, 0xBEC000, 0xBECFFF, "Tokyo Communication Equipment MFG Co.,ltd.", "TOKYO-COMMUNICATION-EQUIPMENT-MFG" },
+	{ 0x70B3D5, 0xBED000, 0xBEDFFF, "Itrinegy Ltd.", "ITRINEGY" },
+	{ 0x70B3D5, 0xBEF000, 0xBEFFFF, "Sensortech Systems Inc.", "SENSORTECH" },
+	{ 0x70B3D5, 0xBF1000, 0xBF1FFF, "Flashnet SRL", "FLASHNET-SRL" },
+	{ 0x70B3D5, 0xBF2000, 0xBF2FFF, "TWIN DEVELOPMENT", "TWIN-DEVELOPMENT" },
+	{ 0x70B3D5, 0xBF3000, 0xBF3FFF, "CG-WIRELESS", "CG-WIRELESS" },
+	{ 0x70B3D5, 0xBF5000, 0xBF5FFF, "Acacia Research", "ACACIA-RESEARCH" },
+	{ 0x70B3D5, 0xBF6000, 0xBF6FFF, "comtac AG", "COMTAC" },
+	{ 0x70B3D5, 0xBF9000, 0xBF9FFF, "Okolab Srl", "OKOLAB-SRL" },
+	{ 0x70B3D5, 0xBFA000, 0xBFAFFF, "NESA SRL", "NESA-SRL" },
+	{ 0x70B3D5, 0xBFB000, 0xBFBFFF, "Sensor 42", "SENSOR-42" },
+	{ 0x70B3D5, 0xBFE000, 0xBFEFFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xC01000, 0xC01FFF, "SmartGuard LLC", "SMARTGUARD-LLC" },
+	{ 0x70B3D5, 0xC03000, 0xC03FFF, "XAVi Technologies Corp.", "XAVI-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xC05000, 0xC05FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0xC06000, 0xC06FFF, "XotonicsMED GmbH", "XOTONICSMED" },
+	{ 0x70B3D5, 0xC07000, 0xC07FFF, "ARECO", "ARECO" },
+	{ 0x70B3D5, 0xC0A000, 0xC0AFFF, "Infosocket Co., Ltd.", "INFOSOCKET" },
+	{ 0x70B3D5, 0xC0B000, 0xC0BFFF, "FSTUDIO CO LTD", "FSTUDIO" },
+	{ 0x70B3D5, 0xC0C000, 0xC0CFFF, "Tech4Race", "TECH4RACE" },
+	{ 0x70B3D5, 0xC0E000, 0xC0EFFF, "SYSDEV Srl", "SYSDEV-SRL" },
 	{ 0x70B3D5, 0xC0F000, 0xC0FFFF, "Honeywell Safety Products USA, Inc", "HONEYWELL-SAFETY-PRODUCTS-USA" },
-	{ 0x70B3D5, 0x65C000, 0x65CFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xB55000, 0xB55FFF, "CTAG - ESG36871424", "CTAG---ESG36871424" },
-	{ 0x70B3D5, 0xB33000, 0xB33FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0x18B000, 0x18BFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x70B3D5, 0xCCC000, 0xCCCFFF, "AEC s.r.l.", "AEC-S-R-L" },
-	{ 0x70B3D5, 0x387000, 0x387FFF, "GWF MessSysteme AG", "GWF-MESSSYSTEME" },
-	{ 0x70B3D5, 0x51B000, 0x51BFFF, "Vitrea Smart Home Technologies", "VITREA-SMART-HOME-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xE9B000, 0xE9BFFF, "NUMATA R&D Co.,Ltd", "NUMATA-R-D" },
+	{ 0x70B3D5, 0xC11000, 0xC11FFF, "Ariston Thermo s.p.a.", "ARISTON-THERMO-S-P-A" },
+	{ 0x70B3D5, 0xC12000, 0xC12FFF, "Beijing Wisetone Information Technology Co.,Ltd.", "BEIJING-WISETONE-INFORMATION" },
+	{ 0x70B3D5, 0xC14000, 0xC14FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0xC15000, 0xC15FFF, "Sensobox GmbH", "SENSOBOX" },
+	{ 0x70B3D5, 0xC16000, 0xC16FFF, "Southern Innovation", "SOUTHERN-INNOVATION" },
+	{ 0x70B3D5, 0xC17000, 0xC17FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
+	{ 0x70B3D5, 0xC1A000, 0xC1AFFF, "Xylon", "XYLON" },
+	{ 0x70B3D5, 0xC1B000, 0xC1BFFF, "Labinvent JSC", "LABINVENT-JSC" },
+	{ 0x70B3D5, 0xC1C000, 0xC1CFFF, "D.E.M. SPA", "D-E-M-SPA" },
+	{ 0x70B3D5, 0xC1D000, 0xC1DFFF, "Kranze Technology Solutions", "KRANZE-SOLUTIONS" },
+	{ 0x70B3D5, 0xC1F000, 0xC1FFFF, "Behr Technologies Inc", "BEHR-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xC20000, 0xC20FFF, "Mipot S.p.a.", "MIPOT-S-P-A" },
+	{ 0x70B3D5, 0xC21000, 0xC21FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xC22000, 0xC22FFF, "Skyriver Communications Inc.", "SKYRIVER-COMMUNICATION" },
+	{ 0x70B3D5, 0xC24000, 0xC24FFF, "Elbit Systems of America - Fort Worth Operations", "ELBIT-OF-AMERICA---FORT-WORTH-OPERATIONS" },
+	{ 0x70B3D5, 0xC25000, 0xC25FFF, "speedsignal GmbH", "SPEEDSIGNAL" },
+	{ 0x70B3D5, 0xC26000, 0xC26FFF, "Triple Play Communications", "TRIPLE-PLAY-COMMUNICATION" },
+	{ 0x70B3D5, 0xC27000, 0xC27FFF, "GD Mission Systems", "GD-MISSION" },
+	{ 0x70B3D5, 0xC29000, 0xC29FFF, "SOFTLAND INDIA LTD", "SOFTLAND-INDIA" },
+	{ 0x70B3D5, 0xC2A000, 0xC2AFFF, "Array Telepresence", "ARRAY-TELEPRESENCE" },
+	{ 0x70B3D5, 0xC2C000, 0xC2CFFF, "Dromont S.p.A.", "DROMONT-S-P-A" },
+	{ 0x70B3D5, 0xC2D000, 0xC2DFFF, "Ensotech Limited", "ENSOTECH" },
+	{ 0x70B3D5, 0xC2E000, 0xC2EFFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0xC2F000, 0xC2FFFF, "ATBiS Co.,Ltd", "ATBIS" },
+	{ 0x70B3D5, 0xC32000, 0xC32FFF, "INFRASAFE/ ADVANTOR SYSTEMS", "INFRASAFE/-ADVANTOR" },
+	{ 0x70B3D5, 0xC33000, 0xC33FFF, "Dandong Dongfang Measurement & Control Technology Co., Ltd.", "DANDONG-DONGFANG-MEASUREMENT-CONTROL" },
 	{ 0x70B3D5, 0xC34000, 0xC34FFF, "Technical Panels Co. Ltd.", "TECHNICAL-PANELS" },
-	{ 0x70B3D5, 0x200000, 0x200FFF, "NextEV Co., Ltd.", "NEXTEV" },
-	{ 0x70B3D5, 0xA2C000, 0xA2CFFF, "TLV CO., LTD.", "TLV" },
-	{ 0x70B3D5, 0xAA1000, 0xAA1FFF, "Shenzhen Weema TV Technology Co.,Ltd.", "SHENZHEN-WEEMA-TV" },
-	{ 0x70B3D5, 0x0D2000, 0x0D2FFF, "UNMANNED SPA", "UNMANNED-SPA" },
-	{ 0x70B3D5, 0xAF1000, 0xAF1FFF, "Emka Technologies", "EMKA-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x296000, 0x296FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x70B3D5, 0x167000, 0x167FFF, "Eiden Co.,Ltd.", "EIDEN" },
-	{ 0x70B3D5, 0xA4A000, 0xA4AFFF, "Beijing Arrow SEED Technology Co,.Ltd.", "BEIJING-ARROW-SEED" },
-	{ 0x70B3D5, 0x85B000, 0x85BFFF, "TSUBAKIMOTO CHAIN CO.", "TSUBAKIMOTO-CHAIN" },
-	{ 0x70B3D5, 0x89B000, 0x89BFFF, "ControlWorks, Inc.", "CONTROLWORKS" },
-	{ 0x70B3D5, 0x68F000, 0x68FFFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0x5AB000, 0x5ABFFF, "Sea Air and Land Communications Ltd", "SEA-AIR-AND-LAND-COMMUNICATION" },
-	{ 0x70B3D5, 0xCED000, 0xCEDFFF, "Advanced Products Corporation Pte Ltd", "ADVANCED-PRODUCTS-PTE" },
-	{ 0x70B3D5, 0xDB0000, 0xDB0FFF, "Arnouse Digital Devices Corp", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x70B3D5, 0xC35000, 0xC35FFF, "Vibrationmaster", "VIBRATIONMASTER" },
+	{ 0x70B3D5, 0xC37000, 0xC37FFF, "Keycom Corp.", "KEYCOM" },
+	{ 0x70B3D5, 0xC38000, 0xC38FFF, "CRESPRIT INC.", "CRESPRIT" },
+	{ 0x70B3D5, 0xC39000, 0xC39FFF, "MeshWorks Wireless Oy", "MESHWORKS-WIRELESS-OY" },
+	{ 0x70B3D5, 0xC3B000, 0xC3BFFF, "Vironova AB", "VIRONOVA-AB" },
+	{ 0x70B3D5, 0xC3C000, 0xC3CFFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0xC3D000, 0xC3DFFF, "CISTECH Solutions", "CISTECH-SOLUTIONS" },
+	{ 0x70B3D5, 0xC3E000, 0xC3EFFF, "DOSADORES ALLTRONIC", "DOSADORES-ALLTRONIC" },
+	{ 0x70B3D5, 0xC3F000, 0xC3FFFF, "Code Blue Corporation", "CODE-BLUE" },
+	{ 0x70B3D5, 0xC41000, 0xC41FFF, "Merlin CSI", "MERLIN-CSI" },
+	{ 0x70B3D5, 0xC42000, 0xC42FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xC43000, 0xC43FFF, "Future Skies", "FUTURE-SKIES" },
+	{ 0x70B3D5, 0xC45000, 0xC45FFF, "Stiebel Eltron GmbH", "STIEBEL-ELTRON" },
+	{ 0x70B3D5, 0xC49000, 0xC49FFF, "BTG Instruments AB", "BTG-INSTRUMENTS-AB" },
+	{ 0x70B3D5, 0xC4A000, 0xC4AFFF, "TIAMA", "TIAMA" },
+	{ 0x70B3D5, 0xC4B000, 0xC4BFFF, "ANKER-EAST", "ANKER-EAST" },
+	{ 0x70B3D5, 0xC4C000, 0xC4CFFF, "VTC Digicom", "VTC-DIGICOM" },
+	{ 0x70B3D5, 0xC4D000, 0xC4DFFF, "RADA Electronics Industries Ltd.", "RADA-ELECTRONICS-INDUSTRIES" },
+	{ 0x70B3D5, 0xC4F000, 0xC4FFFF, "AE Van de Vliet BVBA", "AE-VAN-DE-VLIET-BVBA" },
+	{ 0x70B3D5, 0xC53000, 0xC53FFF, "S Labs sp. z o.o.", "S-LABS-SP-Z-O-O" },
+	{ 0x70B3D5, 0xC55000, 0xC55FFF, "Intelligent Energy Ltd", "INTELLIGENT-ENERGY" },
+	{ 0x70B3D5, 0xC56000, 0xC56FFF, "TELETASK", "TELETASK" },
+	{ 0x70B3D5, 0xC58000, 0xC58FFF, "RMI Laser LLC", "RMI-LASER-LLC" },
+	{ 0x70B3D5, 0xC5A000, 0xC5AFFF, "Commsignia Ltd.", "COMMSIGNIA" },
+	{ 0x70B3D5, 0xC5B000, 0xC5BFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
+	{ 0x70B3D5, 0xC5C000, 0xC5CFFF, "Layer Logic Inc", "LAYER-LOGIC" },
+	{ 0x70B3D5, 0xC5D000, 0xC5DFFF, "FOSHAN SHILANTIAN NETWORK S.T. CO., LTD.", "FOSHAN-SHILANTIAN-NETWORK-S-T" },
+	{ 0x70B3D5, 0xC60000, 0xC60FFF, "Gogo BA", "GOGO-BA" },
+	{ 0x70B3D5, 0xC61000, 0xC61FFF, "JC HUNTER TECHNOLOGIES", "JC-HUNTER-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xC62000, 0xC62FFF, "WIZNOVA", "WIZNOVA" },
+	{ 0x70B3D5, 0xC63000, 0xC63FFF, "Xentech Solutions Limited", "XENTECH-SOLUTIONS" },
+	{ 0x70B3D5, 0xC64000, 0xC64FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
+	{ 0x70B3D5, 0xC65000, 0xC65FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
+	{ 0x70B3D5, 0xC66000, 0xC66FFF, "Blue Access Inc", "BLUE-ACCESS" },
+	{ 0x70B3D5, 0xC67000, 0xC67FFF, "Collini Dienstleistungs GmbH", "COLLINI-DIENSTLEISTUNGS" },
+	{ 0x70B3D5, 0xC68000, 0xC68FFF, "Mini Solution Co. Ltd.", "MINI-SOLUTION" },
+	{ 0x70B3D5, 0xC6A000, 0xC6AFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xC6C000, 0xC6CFFF, "McQ Inc", "MCQ" },
+	{ 0x70B3D5, 0xC6D000, 0xC6DFFF, "Cyviz AS", "CYVIZ-AS" },
+	{ 0x70B3D5, 0xC6E000, 0xC6EFFF, "Orion Technologies, LLC", "ORION-TECHNOLOGIES-LLC" },
+	{ 0x70B3D5, 0xC6F000, 0xC6FFFF, "nyantec GmbH", "NYANTEC" },
+	{ 0x70B3D5, 0xC73000, 0xC73FFF, "C.D.N.CORPORATION", "C-D-N" },
+	{ 0x70B3D5, 0xC74000, 0xC74FFF, "Qtechnology A/S", "QTECHNOLOGY-A/S" },
+	{ 0x70B3D5, 0xC77000, 0xC77FFF, "Yönnet Akıllı Bina ve Otomasyon Sistemleri", "YOENNET-AKıLLı-BINA-VE-OTOMASYON-SISTEMLERI" },
+	{ 0x70B3D5, 0xC78000, 0xC78FFF, "NETA Elektronik AS", "NETA-ELEKTRONIK-AS" },
+	{ 0x70B3D5, 0xC79000, 0xC79FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xC7D000, 0xC7DFFF, "Metatronics B.V.", "METATRONICS" },
+	{ 0x70B3D5, 0xC7E000, 0xC7EFFF, "BirdDog Australia", "BIRDDOG-AUSTRALIA" },
+	{ 0x70B3D5, 0xC7F000, 0xC7FFFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0xC80000, 0xC80FFF, "Link Care Services", "LINK-CARE-SERVICES" },
+	{ 0x70B3D5, 0xC81000, 0xC81FFF, "DSP DESIGN", "DSP-DESIGN" },
+	{ 0x70B3D5, 0xC85000, 0xC85FFF, "Solid State Disks Ltd", "SOLID-STATE-DISKS" },
+	{ 0x70B3D5, 0xC86000, 0xC86FFF, "Woodam Co., Ltd.", "WOODAM" },
+	{ 0x70B3D5, 0xC87000, 0xC87FFF, "Siemens AG", "SIEMENS" },
+	{ 0x70B3D5, 0xC88000, 0xC88FFF, "SINED srl", "SINED-SRL" },
+	{ 0x70B3D5, 0xC89000, 0xC89FFF, "ARD", "ARD" },
+	{ 0x70B3D5, 0xC8B000, 0xC8BFFF, "Asia Pacific Satellite Coummunication Inc.", "ASIA-PACIFIC-SATELLITE-COUMMUNICATION" },
+	{ 0x70B3D5, 0xC8C000, 0xC8CFFF, "Rollogo Limited", "ROLLOGO" },
+	{ 0x70B3D5, 0xC8D000, 0xC8DFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0xC8E000, 0xC8EFFF, "Coral Telecom Limited", "CORAL-TELECOM" },
+	{ 0x70B3D5, 0xC8F000, 0xC8FFFF, "TRIDENT INFOSOL PVT LTD", "TRIDENT-INFOSOL-PVT" },
+	{ 0x70B3D5, 0xC91000, 0xC91FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
+	{ 0x70B3D5, 0xC92000, 0xC92FFF, "Unitro Fleischmann", "UNITRO-FLEISCHMANN" },
+	{ 0x70B3D5, 0xC96000, 0xC96FFF, "UNI DIMENXI SDN BHD", "UNI-DIMENXI-SDN-BHD" },
+	{ 0x70B3D5, 0xC97000, 0xC97FFF, "CSINFOTEL", "CSINFOTEL" },
+	{ 0x70B3D5, 0xC9B000, 0xC9BFFF, "Tieto Sweden AB", "TIETO-SWEDEN-AB" },
+	{ 0x70B3D5, 0xC9D000, 0xC9DFFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER-LLC" },
+	{ 0x70B3D5, 0xC9E000, 0xC9EFFF, "FUKUDA SANGYO CO., LTD.", "FUKUDA-SANGYO" },
+	{ 0x70B3D5, 0xC9F000, 0xC9FFFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0xCA1000, 0xCA1FFF, "Waldo System", "WALDO-SYSTEM" },
+	{ 0x70B3D5, 0xCA2000, 0xCA2FFF, "De Haardt bv", "DE-HAARDT" },
+	{ 0x70B3D5, 0xCA3000, 0xCA3FFF, "Saankhya Labs Private Limited", "SAANKHYA-LABS-PRIVATE" },
+	{ 0x70B3D5, 0xCA4000, 0xCA4FFF, "Netemera Sp. z o.o.", "NETEMERA-SP-Z-O-O" },
+	{ 0x70B3D5, 0xCA8000, 0xCA8FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0xCA9000, 0xCA9FFF, "Nxcontrol system Co., Ltd.", "NXCONTROL-SYSTEM" },
+	{ 0x70B3D5, 0xCAA000, 0xCAAFFF, "Bel Power Solutions GmbH", "BEL-POWER-SOLUTIONS" },
+	{ 0x70B3D5, 0xCAB000, 0xCABFFF, "NOTICE Co., Ltd.", "NOTICE" },
+	{ 0x70B3D5, 0xCAC000, 0xCACFFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xCAE000, 0xCAEFFF, "THEMA", "THEMA" },
+	{ 0x70B3D5, 0xCB2000, 0xCB2FFF, "SECLAB", "SECLAB" },
+	{ 0x70B3D5, 0xCB3000, 0xCB3FFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0xCB4000, 0xCB4FFF, "Planewave Instruments", "PLANEWAVE-INSTRUMENTS" },
+	{ 0x70B3D5, 0xCB6000, 0xCB6FFF, "Kuebrich Ingeniergesellschaft mbh & Co. KG", "KUEBRICH-INGENIERGESELLSCHAFT-MBH" },
+	{ 0x70B3D5, 0xCB7000, 0xCB7FFF, "HKC Limited", "HKC" },
+	{ 0x70B3D5, 0xCB8000, 0xCB8FFF, "Verti Tecnologia", "VERTI-TECNOLOGIA" },
+	{ 0x70B3D5, 0xCBA000, 0xCBAFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0xCBC000, 0xCBCFFF, "Procon Electronics Pty Ltd", "PROCON-ELECTRONICS-PTY" },
+	{ 0x70B3D5, 0xCBE000, 0xCBEFFF, "Ensura Solutions BV", "ENSURA-SOLUTIONS" },
+	{ 0x70B3D5, 0xCC1000, 0xCC1FFF, "BEEcube Inc.", "BEECUBE" },
+	{ 0x70B3D5, 0xCC2000, 0xCC2FFF, "LSC Lighting Systems (Aust) Pty Ltd", "LSC-LIGHTING-AUST-PTY" },
+	{ 0x70B3D5, 0xCC3000, 0xCC3FFF, "Fidalia Networks Inc", "FIDALIA-NETWORKS" },
+	{ 0x70B3D5, 0xCC5000, 0xCC5FFF, "Intecom", "INTECOM" },
+	{ 0x70B3D5, 0xCC8000, 0xCC8FFF, "PROFEN COMMUNICATIONS", "PROFEN-COMMUNICATION" },
+	{ 0x70B3D5, 0xCC9000, 0xCC9FFF, "Rapiscan Systems", "RAPISCAN" },
+	{ 0x70B3D5, 0xCCA000, 0xCCAFFF, "SIEMENS AS", "SIEMENS-AS" },
+	{ 0x70B3D5, 0xCCB000, 0xCCBFFF, "RealD", "REALD" },
+	{ 0x70B3D5, 0xCCC000, 0xCCCFFF, "AEC s.r.l.", "AEC-S-R-L" },
 	{ 0x70B3D5, 0xCCD000, 0xCCDFFF, "Suzhou PowerCore Technology Co.,Ltd.", "SUZHOU-POWERCORE" },
-	{ 0x70B3D5, 0x163000, 0x163FFF, "BHARAT HEAVY ELECTRICALS LIMITED", "BHARAT-HEAVY-ELECTRICALS" },
-	{ 0x70B3D5, 0x227000, 0x227FFF, "Montalvo", "MONTALVO" },
-	{ 0x70B3D5, 0x910000, 0x910FFF, "Eginity, Inc.", "EGINITY" },
-	{ 0x70B3D5, 0x7D1000, 0x7D1FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
-	{ 0x70B3D5, 0x70F000, 0x70FFFF, "Alion Science & Technology", "ALION-SCIENCE" },
-	{ 0x70B3D5, 0xA1B000, 0xA1BFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0x947000, 0x947FFF, "Checkbill Co,Ltd.", "CHECKBILL" },
-	{ 0x70B3D5, 0xB77000, 0xB77FFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x70B3D5, 0xD9D000, 0xD9DFFF, "Electroimpact, Inc.", "ELECTROIMPACT" },
-	{ 0x70B3D5, 0x475000, 0x475FFF, "EWATTCH", "EWATTCH" },
-	{ 0x70B3D5, 0xF30000, 0xF30FFF, "ADE Technology Inc.", "ADE" },
-	{ 0x70B3D5, 0xF95000, 0xF95FFF, "Get SAT", "GET-SAT" },
-	{ 0x70B3D5, 0x457000, 0x457FFF, "Vivaldi Clima Srl", "VIVALDI-CLIMA-SRL" },
-	{ 0x70B3D5, 0xF9C000, 0xF9CFFF, "SureFlap Ltd", "SUREFLAP" },
-	{ 0x70B3D5, 0x73D000, 0x73DFFF, "NETWAYS GmbH", "NETWAYS" },
-	{ 0x70B3D5, 0x678000, 0x678FFF, "The Dini Group, La Jolla inc.", "THE-DINI-GROUP-LA-JOLLA" },
-	{ 0x70B3D5, 0xD6B000, 0xD6BFFF, "Uwinloc", "UWINLOC" },
-	{ 0x70B3D5, 0xA3F000, 0xA3FFFF, "PHPower Srl", "PHPOWER-SRL" },
-	{ 0x70B3D5, 0x5F3000, 0x5F3FFF, "Rtone", "RTONE" },
-	{ 0x70B3D5, 0x5F6000, 0x5F6FFF, "FreeFlight Systems", "FREEFLIGHT" },
-	{ 0x70B3D5, 0xD26000, 0xD26FFF, "MI Inc.", "MI" },
-	{ 0x70B3D5, 0x24B000, 0x24BFFF, "TOSEI ENGINEERING CORP.", "TOSEI-ENGINEERING" },
-	{ 0x70B3D5, 0x72E000, 0x72EFFF, "Maharsystem", "MAHARSYSTEM" },
+	{ 0x70B3D5, 0xCCE000, 0xCCEFFF, "Proconex 2010 Inc.", "PROCONEX-2010" },
+	{ 0x70B3D5, 0xCCF000, 0xCCFFFF, "Netberg", "NETBERG" },
+	{ 0x70B3D5, 0xCD0000, 0xCD0FFF, "Ellenex Pty Ltd", "ELLENEX-PTY" },
 	{ 0x70B3D5, 0xCD1000, 0xCD1FFF, "Cannex Technology Inc.", "CANNEX" },
-	{ 0x70B3D5, 0x4FC000, 0x4FCFFF, "Mettler Toledo", "METTLER-TOLEDO" },
-	{ 0x70B3D5, 0xE91000, 0xE91FFF, "NAS Australia P/L", "NAS-AUSTRALIA-P/L" },
-	{ 0x70B3D5, 0xA32000, 0xA32FFF, "Toughdog Security Systems", "TOUGHDOG-SECURITY" },
-	{ 0x70B3D5, 0x716000, 0x716FFF, "Lode BV", "LODE" },
-	{ 0x70B3D5, 0x5F1000, 0x5F1FFF, "Fater Rasa Noor", "FATER-RASA-NOOR" },
-	{ 0x70B3D5, 0x153000, 0x153FFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
-	{ 0x70B3D5, 0xA08000, 0xA08FFF, "BioBusiness", "BIOBUSINESS" },
-	{ 0x70B3D5, 0xC6F000, 0xC6FFFF, "nyantec GmbH", "NYANTEC" },
-	{ 0x70B3D5, 0x547000, 0x547FFF, "CE LINK LIMITED", "CE-LINK" },
-	{ 0x70B3D5, 0x0C6000, 0x0C6FFF, "Embedded Arts Co., Ltd.", "EMBEDDED-ARTS" },
-	{ 0x70B3D5, 0xDC6000, 0xDC6FFF, "IDEM INC.", "IDEM" },
-	{ 0x70B3D5, 0xD54000, 0xD54FFF, "JL World Corporation Limited", "JL-WORLD" },
-	{ 0x70B3D5, 0x0B6000, 0x0B6FFF, "Landis Gyr", "LANDIS-GYR" },
-	{ 0x70B3D5, 0x9E2000, 0x9E2FFF, "Ofil USA", "OFIL-USA" },
-	{ 0x70B3D5, 0x2CC000, 0x2CCFFF, "WeWork Companies, Inc.", "WEWORK-COMPANIES" },
-	{ 0x70B3D5, 0x132000, 0x132FFF, "Hagenuk KMT Kabelmesstechnik GmbH", "HAGENUK-KMT-KABELMESSTECHNIK" },
-	{ 0x70B3D5, 0xD5C000, 0xD5CFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0xEF9000, 0xEF9FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
-	{ 0x70B3D5, 0x777000, 0x777FFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES-S-L" },
-	{ 0x70B3D5, 0x368000, 0x368FFF, "White Matter LLC", "WHITE-MATTER-LLC" },
-	{ 0x70B3D5, 0x032000, 0x032FFF, "iFreecomm Technology Co., Ltd", "IFREECOMM" },
-	{ 0x70B3D5, 0x1B9000, 0x1B9FFF, "RELISTE Ges.m.b.H.", "RELISTE-GES-M-B-H" },
-	{ 0x70B3D5, 0xEB5000, 0xEB5FFF, "JUSTEK INC", "JUSTEK" },
-	{ 0x70B3D5, 0x94A000, 0x94AFFF, "SHENZHEN WISEWING INTERNET TECHNOLOGY CO.,LTD", "SHENZHEN-WISEWING-INTERNET" },
-	{ 0x70B3D5, 0x075000, 0x075FFF, "Mo-Sys Engineering Ltd", "MO-SYS-ENGINEERING" },
-	{ 0x70B3D5, 0xB18000, 0xB18FFF, "Abbas, a.s.", "ABBAS-A-S" },
-	{ 0x70B3D5, 0x6E1000, 0x6E1FFF, "Shanghai Holystar Information Technology Co.,Ltd", "SHANGHAI-HOLYSTAR-INFORMATION" },
-	{ 0x70B3D5, 0x25D000, 0x25DFFF, "Mimo Networks", "MIMO-NETWORKS" },
-	{ 0x70B3D5, 0xC2F000, 0xC2FFFF, "ATBiS Co.,Ltd", "ATBIS" },
-	{ 0x70B3D5, 0xE3A000, 0xE3AFFF, "Cyanview", "CYANVIEW" },
-	{ 0x70B3D5, 0x5DA000, 0x5DAFFF, "Valk Welding B.V.", "VALK-WELDING" },
-	{ 0x70B3D5, 0xBAC000, 0xBACFFF, "AdInte, inc.", "ADINTE" },
-	{ 0x70B3D5, 0xCDA000, 0xCDAFFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0x4D4000, 0x4D4FFF, "Nortek Global HVAC", "NORTEK-GLOBAL-HVAC" },
-	{ 0x70B3D5, 0x7AD000, 0x7ADFFF, "Insitu, Inc", "INSITU" },
-	{ 0x70B3D5, 0xEB3000, 0xEB3FFF, "KWS-Electronic GmbH", "KWS" },
-	{ 0x70B3D5, 0x700000, 0x700FFF, "University Of Groningen", "UNIVERSITY-OF-GRONINGEN" },
-	{ 0x70B3D5, 0x7A5000, 0x7A5FFF, "Triton Electronics Ltd", "TRITON-ELECTRONICS" },
-	{ 0x70B3D5, 0x213000, 0x213FFF, "ETON Deutschland Electro Acoustic GmbH", "ETON-DEUTSCHLAND-ELECTRO-ACOUSTIC" },
-	{ 0x70B3D5, 0xA0D000, 0xA0DFFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
-	{ 0x70B3D5, 0x236000, 0x236FFF, "Monnit Corporation", "MONNIT" },
-	{ 0x70B3D5, 0x810000, 0x810FFF, "Advice", "ADVICE" },
-	{ 0x70B3D5, 0x963000, 0x963FFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x70B3D5, 0x30C000, 0x30CFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0x3B2000, 0x3B2FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0xA35000, 0xA35FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0x024000, 0x024FFF, "G+D Mobile Security", "G+D-MOBILE-SECURITY" },
-	{ 0x70B3D5, 0x145000, 0x145FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0xFF0000, 0xFF0FFF, "E-MetroTel", "E-METROTEL" },
-	{ 0x70B3D5, 0x3BA000, 0x3BAFFF, "Silex Inside", "SILEX-INSIDE" },
-	{ 0x70B3D5, 0x2FE000, 0x2FEFFF, "Yaham Optoelectronics Co., Ltd", "YAHAM-OPTOELECTRONICS" },
-	{ 0x70B3D5, 0x576000, 0x576FFF, "Shandong Hospot IOT Technology Co.,Ltd.", "SHANDONG-HOSPOT-IOT" },
-	{ 0x70B3D5, 0x54B000, 0x54BFFF, "Brakels IT", "BRAKELS-IT" },
+	{ 0x70B3D5, 0xCD2000, 0xCD2FFF, "HBH Microwave GmbH", "HBH-MICROWAVE" },
+	{ 0x70B3D5, 0xCD3000, 0xCD3FFF, "Controlrad", "CONTROLRAD" },
 	{ 0x70B3D5, 0xCD5000, 0xCD5FFF, "Apantac LLC", "APANTAC-LLC" },
-	{ 0x70B3D5, 0x11F000, 0x11FFFF, "Geppetto Electronics", "GEPPETTO-ELECTRONICS" },
-	{ 0x70B3D5, 0x136000, 0x136FFF, "Miguel Corporate Services Pte Ltd", "MIGUEL-CORPORATE-SERVICES-PTE" },
-	{ 0x70B3D5, 0xE1A000, 0xE1AFFF, "BIZERBA LUCEO", "BIZERBA-LUCEO" },
-	{ 0x70B3D5, 0x5D5000, 0x5D5FFF, "CT Company", "CT-COMPANY" },
-	{ 0x70B3D5, 0xA1F000, 0xA1FFFF, "GlobalTest LLC", "GLOBALTEST-LLC" },
-	{ 0x70B3D5, 0x8CA000, 0x8CAFFF, "Allied Data Systems", "ALLIED-DATA" },
-	{ 0x70B3D5, 0x785000, 0x785FFF, "Density Inc.", "DENSITY" },
-	{ 0x70B3D5, 0x6B1000, 0x6B1FFF, "TTC TELEKOMUNIKACE, s.r.o.", "TTC-TELEKOMUNIKACE-S-R-O" },
-	{ 0x70B3D5, 0xBD5000, 0xBD5FFF, "Synics AG", "SYNICS" },
-	{ 0x70B3D5, 0x5C1000, 0x5C1FFF, "Shanghai JaWay Information Technology Co., Ltd.", "SHANGHAI-JAWAY-INFORMATION" },
-	{ 0x70B3D5, 0xBE9000, 0xBE9FFF, "Telecast Inc.", "TELECAST" },
-	{ 0x70B3D5, 0xC62000, 0xC62FFF, "WIZNOVA", "WIZNOVA" },
+	{ 0x70B3D5, 0xCD6000, 0xCD6FFF, "VideoRay LLC", "VIDEORAY-LLC" },
+	{ 0x70B3D5, 0xCD9000, 0xCD9FFF, "Peter Huber Kaeltemaschinenbau GmbH", "PETER-HUBER-KAELTEMASCHINENBAU" },
+	{ 0x70B3D5, 0xCDA000, 0xCDAFFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0xCDE000, 0xCDEFFF, "Multipure International", "MULTIPURE" },
+	{ 0x70B3D5, 0xCDF000, 0xCDFFFF, "3D Printing Specialists", "3D-PRINTING-SPECIALISTS" },
+	{ 0x70B3D5, 0xCE1000, 0xCE1FFF, "EA Elektroautomatik GmbH & Co. KG", "EA-ELEKTROAUTOMATIK" },
+	{ 0x70B3D5, 0xCE2000, 0xCE2FFF, "Centero", "CENTERO" },
+	{ 0x70B3D5, 0xCE3000, 0xCE3FFF, "Dalcnet srl", "DALCNET-SRL" },
+	{ 0x70B3D5, 0xCE5000, 0xCE5FFF, "GridBridge Inc", "GRIDBRIDGE" },
+	{ 0x70B3D5, 0xCE7000, 0xCE7FFF, "June Automation Singapore Pte. Ltd.", "JUNE-AUTOMATION-SINGAPORE-PTE" },
+	{ 0x70B3D5, 0xCE9000, 0xCE9FFF, "KINEMETRICS", "KINEMETRICS" },
+	{ 0x70B3D5, 0xCEA000, 0xCEAFFF, "Computerwise, Inc.", "COMPUTERWISE" },
+	{ 0x70B3D5, 0xCED000, 0xCEDFFF, "Advanced Products Corporation Pte Ltd", "ADVANCED-PRODUCTS-PTE" },
+	{ 0x70B3D5, 0xCF1000, 0xCF1FFF, "LightDec GmbH & Co. KG", "LIGHTDEC" },
+	{ 0x70B3D5, 0xCF2000, 0xCF2FFF, "tinnos", "TINNOS" },
+	{ 0x70B3D5, 0xCF3000, 0xCF3FFF, "Mesh Motion Inc", "MESH-MOTION" },
+	{ 0x70B3D5, 0xCF4000, 0xCF4FFF, "Harbin Cheng Tian Technology Development Co., Ltd.", "HARBIN-CHENG-TIAN-DEVELOPMENT" },
+	{ 0x70B3D5, 0xCF5000, 0xCF5FFF, "Petring Energietechnik GmbH", "PETRING-ENERGIETECHNIK" },
+	{ 0x70B3D5, 0xCF6000, 0xCF6FFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
+	{ 0x70B3D5, 0xCFD000, 0xCFDFFF, "iLOQ Oy", "ILOQ-OY" },
+	{ 0x70B3D5, 0xCFE000, 0xCFEFFF, "Secturion Systems", "SECTURION" },
+	{ 0x70B3D5, 0xCFF000, 0xCFFFFF, "DTECH Labs, Inc.", "DTECH-LABS" },
+	{ 0x70B3D5, 0xD01000, 0xD01FFF, "Vision4ce Ltd", "VISION4CE" },
+	{ 0x70B3D5, 0xD05000, 0xD05FFF, "Colmek", "COLMEK" },
+	{ 0x70B3D5, 0xD07000, 0xD07FFF, "Waversa Systems", "WAVERSA" },
+	{ 0x70B3D5, 0xD08000, 0xD08FFF, "Veeco Instruments", "VEECO-INSTRUMENTS" },
+	{ 0x70B3D5, 0xD09000, 0xD09FFF, "Rishaad Brown", "RISHAAD-BROWN" },
+	{ 0x70B3D5, 0xD0A000, 0xD0AFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xD0C000, 0xD0CFFF, "Connor Winfield LTD", "CONNOR-WINFIELD" },
+	{ 0x70B3D5, 0xD0D000, 0xD0DFFF, "Logiwaste AB", "LOGIWASTE-AB" },
+	{ 0x70B3D5, 0xD0E000, 0xD0EFFF, "Beijing Aumiwalker technology CO.,LTD", "BEIJING-AUMIWALKER" },
+	{ 0x70B3D5, 0xD10000, 0xD10FFF, "Contec DTx", "CONTEC-DTX" },
+	{ 0x70B3D5, 0xD11000, 0xD11FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
+	{ 0x70B3D5, 0xD12000, 0xD12FFF, "FIDELTRONIK POLAND SP. Z O.O.", "FIDELTRONIK-POLAND-SP-Z-O-O" },
+	{ 0x70B3D5, 0xD1B000, 0xD1BFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0xD1C000, 0xD1CFFF, "Specialised Imaging Limited", "SPECIALISED-IMAGING" },
+	{ 0x70B3D5, 0xD1E000, 0xD1EFFF, "Houston Radar LLC", "HOUSTON-RADAR-LLC" },
+	{ 0x70B3D5, 0xD1F000, 0xD1FFFF, "Embsec AB", "EMBSEC-AB" },
+	{ 0x70B3D5, 0xD20000, 0xD20FFF, "Rheonics GmbH", "RHEONICS" },
+	{ 0x70B3D5, 0xD22000, 0xD22FFF, "DEK Technologies", "DEK-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD24000, 0xD24FFF, "Microtronics Engineering GmbH", "MICROTRONICS-ENGINEERING" },
+	{ 0x70B3D5, 0xD25000, 0xD25FFF, "ENGenesis", "ENGENESIS" },
+	{ 0x70B3D5, 0xD26000, 0xD26FFF, "MI Inc.", "MI" },
+	{ 0x70B3D5, 0xD28000, 0xD28FFF, "Toshiba Electron Tubes & Devices Co., Ltd.", "TOSHIBA-ELECTRON-TUBES-DEVICES" },
+	{ 0x70B3D5, 0xD29000, 0xD29FFF, "Sportzcast", "SPORTZCAST" },
+	{ 0x70B3D5, 0xD2B000, 0xD2BFFF, "StreamPlay Oy Ltd", "STREAMPLAY-OY" },
+	{ 0x70B3D5, 0xD2D000, 0xD2DFFF, "Evolute Systems Private Limited", "EVOLUTE-PRIVATE" },
+	{ 0x70B3D5, 0xD2E000, 0xD2EFFF, "Coheros Oy", "COHEROS-OY" },
+	{ 0x70B3D5, 0xD2F000, 0xD2FFFF, "L.I.F.E. Corporation SA", "L-I-F-E" },
+	{ 0x70B3D5, 0xD32000, 0xD32FFF, "Euklis by GSG International", "EUKLIS-BY-GSG" },
+	{ 0x70B3D5, 0xD34000, 0xD34FFF, "G-PHILOS CO.,LTD", "G-PHILOS" },
+	{ 0x70B3D5, 0xD37000, 0xD37FFF, "Sicon srl", "SICON-SRL" },
+	{ 0x70B3D5, 0xD38000, 0xD38FFF, "Vista Research, Inc.", "VISTA-RESEARCH" },
 	{ 0x70B3D5, 0xD3B000, 0xD3BFFF, "NimbeLink Corp", "NIMBELINK" },
-	{ 0x70B3D5, 0xFF4000, 0xFF4FFF, "Serveron Corporation", "SERVERON" },
-	{ 0x70B3D5, 0x760000, 0x760FFF, "QUALITTEQ LLC", "QUALITTEQ-LLC" },
-	{ 0x70B3D5, 0x272000, 0x272FFF, "TELECOM SANTE", "TELECOM-SANTE" },
-	{ 0x70B3D5, 0x20D000, 0x20DFFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD3C000, 0xD3CFFF, "HRT", "HRT" },
+	{ 0x70B3D5, 0xD3F000, 0xD3FFFF, "GLOBALCOM ENGINEERING SPA", "GLOBALCOM-ENGINEERING-SPA" },
+	{ 0x70B3D5, 0xD40000, 0xD40FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xD41000, 0xD41FFF, "KSE GmbH", "KSE" },
+	{ 0x70B3D5, 0xD42000, 0xD42FFF, "DSP DESIGN", "DSP-DESIGN" },
+	{ 0x70B3D5, 0xD43000, 0xD43FFF, "EZSYS Co., Ltd.", "EZSYS" },
+	{ 0x70B3D5, 0xD44000, 0xD44FFF, "ic-automation GmbH", "IC-AUTOMATION" },
+	{ 0x70B3D5, 0xD46000, 0xD46FFF, "Contineo s.r.o.", "CONTINEO-S-R-O" },
+	{ 0x70B3D5, 0xD47000, 0xD47FFF, "YotaScope Technologies Co., Ltd.", "YOTASCOPE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD48000, 0xD48FFF, "HEADROOM Broadcast GmbH", "HEADROOM-BROADCAST" },
+	{ 0x70B3D5, 0xD4A000, 0xD4AFFF, "OÜ ELIKO Tehnoloogia Arenduskeskus", "OUE-ELIKO-TEHNOLOOGIA-ARENDUSKESKUS" },
+	{ 0x70B3D5, 0xD4B000, 0xD4BFFF, "Hermann Lümmen GmbH", "HERMANN-LUEMMEN" },
+	{ 0x70B3D5, 0xD4C000, 0xD4CFFF, "Elystec Technology Co., Ltd", "ELYSTEC" },
+	{ 0x70B3D5, 0xD4D000, 0xD4DFFF, "The Morey Corporation", "THE-MOREY" },
+	{ 0x70B3D5, 0xD4E000, 0xD4EFFF, "FLSmidth", "FLSMIDTH" },
+	{ 0x70B3D5, 0xD50000, 0xD50FFF, "GRIDSMART Technologies", "GRIDSMART-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD51000, 0xD51FFF, "Azcom Technology S.r.l.", "AZCOM-S-R-L" },
+	{ 0x70B3D5, 0xD54000, 0xD54FFF, "JL World Corporation Limited", "JL-WORLD" },
 	{ 0x70B3D5, 0xD55000, 0xD55FFF, "WM Design s.r.o", "WM-DESIGN-S-R-O" },
-	{ 0x70B3D5, 0xE67000, 0xE67FFF, "APPLIED PROCESSING", "APPLIED-PROCESSING" },
-	{ 0x70B3D5, 0x523000, 0x523FFF, "Tibit Communications", "TIBIT-COMMUNICATION" },
-	{ 0x70B3D5, 0x241000, 0x241FFF, "Bolide Technology Group, Inc.", "BOLIDE-GROUP" },
-	{ 0x70B3D5, 0xD25000, 0xD25FFF, "ENGenesis", "ENGENESIS" },
-	{ 0x70B3D5, 0x4A9000, 0x4A9FFF, "WARECUBE,INC", "WARECUBE" },
-	{ 0x70B3D5, 0x2F8000, 0x2F8FFF, "Tunstall A/S", "TUNSTALL-A/S" },
-	{ 0x70B3D5, 0x0A3000, 0x0A3FFF, "Solace Systems Inc.", "SOLACE" },
-	{ 0x70B3D5, 0xFC2000, 0xFC2FFF, "HUNTER LIBERTY CORPORATION", "HUNTER-LIBERTY" },
-	{ 0x70B3D5, 0x61C000, 0x61CFFF, "Earth Works", "EARTH-WORKS" },
-	{ 0x70B3D5, 0x6EA000, 0x6EAFFF, "Edgeware AB", "EDGEWARE-AB" },
-	{ 0x70B3D5, 0xA05000, 0xA05FFF, "Transas Marine Limited", "TRANSAS-MARINE" },
-	{ 0x70B3D5, 0xAA6000, 0xAA6FFF, "Proximus", "PROXIMUS" },
-	{ 0x70B3D5, 0x1D4000, 0x1D4FFF, "Brinkmann Audio GmbH", "BRINKMANN-AUDIO" },
-	{ 0x70B3D5, 0x5E5000, 0x5E5FFF, "HAIYANG OLIX CO.,LTD.", "HAIYANG-OLIX" },
-	{ 0x70B3D5, 0xE2C000, 0xE2CFFF, "Fourth Frontier Technologies Private Limited", "FOURTH-FRONTIER-TECHNOLOGIES-PRIVATE" },
-	{ 0x70B3D5, 0x5CA000, 0x5CAFFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
-	{ 0x70B3D5, 0x427000, 0x427FFF, "Key Chemical & Equipment Company", "KEY-CHEMICAL-EQUIPMENT-COMPANY" },
-	{ 0x70B3D5, 0x753000, 0x753FFF, "HCH. Kündig & CIE. AG", "HCH-KUENDIG-CIE" },
-	{ 0x70B3D5, 0xA18000, 0xA18FFF, "Embedded Systems Lukasz Panasiuk", "EMBEDDED-LUKASZ-PANASIUK" },
-	{ 0x70B3D5, 0x0C2000, 0x0C2FFF, "LOOK EASY INTERNATIONAL LIMITED", "LOOK-EASY" },
-	{ 0x70B3D5, 0x1DE000, 0x1DEFFF, "DYCEC, S.A.", "DYCEC" },
-	{ 0x70B3D5, 0x16C000, 0x16CFFF, "OCEAN", "OCEAN" },
-	{ 0x70B3D5, 0x778000, 0x778FFF, "Lumacron Technology Ltd.", "LUMACRON" },
-	{ 0x70B3D5, 0x05D000, 0x05DFFF, "KOMS Co.,Ltd.", "KOMS" },
-	{ 0x70B3D5, 0xEC8000, 0xEC8FFF, "Viko Elektrik-Elektronik A.Ş.", "VIKO-ELEKTRIK-ELEKTRONIK-A-Ş" },
-	{ 0x70B3D5, 0x3F0000, 0x3F0FFF, "Intervala", "INTERVALA" },
-	{ 0x70B3D5, 0xBD1000, 0xBD1FFF, "CableLabs", "CABLELABS" },
-	{ 0x70B3D5, 0xB1A000, 0xB1AFFF, "Aaronia AG", "AARONIA" },
-	{ 0x70B3D5, 0xF0D000, 0xF0DFFF, "MeQ Inc.", "MEQ" },
-	{ 0x70B3D5, 0x215000, 0x215FFF, "Dataspeed Inc", "DATASPEED" },
-	{ 0x70B3D5, 0x115000, 0x115FFF, "Welltec Corp.", "WELLTEC" },
-	{ 0x70B3D5, 0xC45000, 0xC45FFF, "Stiebel Eltron GmbH", "STIEBEL-ELTRON" },
-	{ 0x70B3D5, 0xB56000, 0xB56FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
-	{ 0x70B3D5, 0x911000, 0x911FFF, "Equatel", "EQUATEL" },
-	{ 0x70B3D5, 0x661000, 0x661FFF, "DesignA Electronics Limited", "DESIGNA-ELECTRONICS" },
-	{ 0x70B3D5, 0x011000, 0x011FFF, "Sumer Data S.L", "SUMER-DATA-S-L" },
-	{ 0x70B3D5, 0x2C2000, 0x2C2FFF, "Quantum Detectors", "QUANTUM-DETECTORS" },
-	{ 0x70B3D5, 0xBF3000, 0xBF3FFF, "CG-WIRELESS", "CG-WIRELESS" },
-	{ 0x70B3D5, 0x9A1000, 0x9A1FFF, "ITS Industrial Turbine Services GmbH", "ITS-INDUSTRIAL-TURBINE-SERVICES" },
-	{ 0x70B3D5, 0x861000, 0x861FFF, "KST technology", "KST" },
-	{ 0x70B3D5, 0x442000, 0x442FFF, "Blair Companies", "BLAIR-COMPANIES" },
-	{ 0x70B3D5, 0xC74000, 0xC74FFF, "Qtechnology A/S", "QTECHNOLOGY-A/S" },
-	{ 0x70B3D5, 0xE16000, 0xE16FFF, "China Entropy Co., Ltd.", "CHINA-ENTROPY" },
-	{ 0x70B3D5, 0x02E000, 0x02EFFF, "Monnit Corporation", "MONNIT" },
-	{ 0x70B3D5, 0x370000, 0x370FFF, "Inphi Corporation", "INPHI" },
-	{ 0x70B3D5, 0x7E8000, 0x7E8FFF, "Mannkind Corporation", "MANNKIND" },
-	{ 0x70B3D5, 0x3F3000, 0x3F3FFF, "SPEA SPA", "SPEA-SPA" },
-	{ 0x70B3D5, 0x549000, 0x549FFF, "Procon automatic systems GmbH", "PROCON-AUTOMATIC" },
-	{ 0x70B3D5, 0x831000, 0x831FFF, "Arnouse Digital Devices Corp", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x70B3D5, 0xD57000, 0xD57FFF, "TRIUMPH BOARD a.s.", "TRIUMPH-BOARD-A-S" },
+	{ 0x70B3D5, 0xD58000, 0xD58FFF, "Idyllic Engineering Pte Ltd", "IDYLLIC-ENGINEERING-PTE" },
+	{ 0x70B3D5, 0xD59000, 0xD59FFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD5A000, 0xD5AFFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD5B000, 0xD5BFFF, "WyreStorm Technologies Ltd", "WYRESTORM-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xD5C000, 0xD5CFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xD5F000, 0xD5FFFF, "Core Balance Co., Ltd.", "CORE-BALANCE" },
+	{ 0x70B3D5, 0xD60000, 0xD60FFF, "Flintab AB", "FLINTAB-AB" },
+	{ 0x70B3D5, 0xD61000, 0xD61FFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0xD62000, 0xD62FFF, "Andasis Elektronik San. ve Tic. A.Ş.", "ANDASIS-ELEKTRONIK-SAN-VE-TIC-A-Ş" },
+	{ 0x70B3D5, 0xD63000, 0xD63FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xD64000, 0xD64FFF, "Mettler Toledo Hi Speed", "METTLER-TOLEDO-HI-SPEED" },
+	{ 0x70B3D5, 0xD65000, 0xD65FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xD66000, 0xD66FFF, "Ascendent Technology Group", "ASCENDENT-GROUP" },
+	{ 0x70B3D5, 0xD67000, 0xD67FFF, "ALPHA　Corporation", "ALPHA　" },
+	{ 0x70B3D5, 0xD69000, 0xD69FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
+	{ 0x70B3D5, 0xD6A000, 0xD6AFFF, "KnowRoaming", "KNOWROAMING" },
+	{ 0x70B3D5, 0xD6B000, 0xD6BFFF, "Uwinloc", "UWINLOC" },
+	{ 0x70B3D5, 0xD6C000, 0xD6CFFF, "GP Systems GmbH", "GP" },
+	{ 0x70B3D5, 0xD6E000, 0xD6EFFF, "ard sa", "ARD" },
+	{ 0x70B3D5, 0xD6F000, 0xD6FFFF, "X-SPEX GmbH", "X-SPEX" },
+	{ 0x70B3D5, 0xD70000, 0xD70FFF, "Rational Production srl Unipersonale", "RATIONAL-PRODUCTION-SRL-UNIPERSONALE" },
+	{ 0x70B3D5, 0xD71000, 0xD71FFF, "RZB Rudolf Zimmermann, Bamberg GmbH", "RZB-RUDOLF-ZIMMERMANN-BAMBERG" },
+	{ 0x70B3D5, 0xD72000, 0xD72FFF, "OnYield Inc Ltd", "ONYIELD" },
+	{ 0x70B3D5, 0xD73000, 0xD73FFF, "ERMINE Corporation", "ERMINE" },
+	{ 0x70B3D5, 0xD74000, 0xD74FFF, "Sandia National Laboratories", "SANDIA-NATIONAL-LABORATORIES" },
+	{ 0x70B3D5, 0xD75000, 0xD75FFF, "Hyundai MNSOFT", "HYUNDAI-MNSOFT" },
+	{ 0x70B3D5, 0xD76000, 0xD76FFF, "attocube systems AG", "ATTOCUBE" },
+	{ 0x70B3D5, 0xD79000, 0xD79FFF, "GOMA ELETTRONICA SpA", "GOMA-ELETTRONICA-SPA" },
+	{ 0x70B3D5, 0xD7A000, 0xD7AFFF, "Speedifi Inc", "SPEEDIFI" },
+	{ 0x70B3D5, 0xD7B000, 0xD7BFFF, "Peter Huber Kaeltemaschinenbau AG", "PETER-HUBER-KAELTEMASCHINENBAU" },
+	{ 0x70B3D5, 0xD7C000, 0xD7CFFF, "D.T.S Illuminazione Srl", "D-T-S-ILLUMINAZIONE-SRL" },
+	{ 0x70B3D5, 0xD7E000, 0xD7EFFF, "Triax A/S", "TRIAX-A/S" },
+	{ 0x70B3D5, 0xD7F000, 0xD7FFFF, "ConectaIP Tecnologia S.L.", "CONECTAIP-TECNOLOGIA-S-L" },
+	{ 0x70B3D5, 0xD80000, 0xD80FFF, "AMMT GmbH", "AMMT" },
+	{ 0x70B3D5, 0xD81000, 0xD81FFF, "PDD Group Ltd", "PDD-GROUP" },
+	{ 0x70B3D5, 0xD84000, 0xD84FFF, "Sentry360", "SENTRY360" },
+	{ 0x70B3D5, 0xD86000, 0xD86FFF, "WPGSYS Pte Ltd", "WPGSYS-PTE" },
+	{ 0x70B3D5, 0xD87000, 0xD87FFF, "Zigen Corp", "ZIGEN" },
+	{ 0x70B3D5, 0xD89000, 0xD89FFF, "Resolution Systems", "RESOLUTION" },
+	{ 0x70B3D5, 0xD8B000, 0xD8BFFF, "Lenoxi Automation s.r.o.", "LENOXI-AUTOMATION-S-R-O" },
+	{ 0x70B3D5, 0xD8C000, 0xD8CFFF, "Damerell Design Limited (DCL)", "DAMERELL-DESIGN-DCL" },
+	{ 0x70B3D5, 0xD8D000, 0xD8DFFF, "Pullnet Technology,S.L.", "PULLNET-S-L" },
 	{ 0x70B3D5, 0xD8E000, 0xD8EFFF, "Axatel SrL", "AXATEL-SRL" },
-	{ 0x70B3D5, 0xA28000, 0xA28FFF, "PEEK TRAFFIC", "PEEK-TRAFFIC" },
-	{ 0x70B3D5, 0xAC7000, 0xAC7FFF, "vivaMOS", "VIVAMOS" },
+	{ 0x70B3D5, 0xD8F000, 0xD8FFFF, "Molu Technology Inc., LTD.", "MOLU" },
+	{ 0x70B3D5, 0xD90000, 0xD90FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xD91000, 0xD91FFF, "FoodALYT GmbH", "FOODALYT" },
+	{ 0x70B3D5, 0xD92000, 0xD92FFF, "Zamir Recognition Systems Ltd.", "ZAMIR-RECOGNITION" },
+	{ 0x70B3D5, 0xD93000, 0xD93FFF, "PAMIR Inc", "PAMIR" },
+	{ 0x70B3D5, 0xD94000, 0xD94FFF, "Dewetron GmbH", "DEWETRON" },
+	{ 0x70B3D5, 0xD95000, 0xD95FFF, "SANO SERVICE Co.,Ltd", "SANO-SERVICE" },
+	{ 0x70B3D5, 0xD97000, 0xD97FFF, "BRS Sistemas Eletronicos", "BRS-SISTEMAS-ELETRONICOS" },
+	{ 0x70B3D5, 0xD98000, 0xD98FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
+	{ 0x70B3D5, 0xD9A000, 0xD9AFFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
+	{ 0x70B3D5, 0xD9B000, 0xD9BFFF, "Russian Telecom Equipment Company", "RUSSIAN-TELECOM-EQUIPMENT-COMPANY" },
+	{ 0x70B3D5, 0xD9C000, 0xD9CFFF, "Subinitial LLC", "SUBINITIAL-LLC" },
+	{ 0x70B3D5, 0xD9D000, 0xD9DFFF, "Electroimpact, Inc.", "ELECTROIMPACT" },
+	{ 0x70B3D5, 0xD9E000, 0xD9EFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0xDA1000, 0xDA1FFF, "Qprel srl", "QPREL-SRL" },
+	{ 0x70B3D5, 0xDA3000, 0xDA3FFF, "Voleatech GmbH", "VOLEATECH" },
+	{ 0x70B3D5, 0xDA4000, 0xDA4FFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xDA5000, 0xDA5FFF, "Roboteq", "ROBOTEQ" },
+	{ 0x70B3D5, 0xDA6000, 0xDA6FFF, "Redfish Group Pty Ltd", "REDFISH-GROUP-PTY" },
+	{ 0x70B3D5, 0xDA8000, 0xDA8FFF, "Tagarno AS", "TAGARNO-AS" },
+	{ 0x70B3D5, 0xDAA000, 0xDAAFFF, "AmTote Australasia", "AMTOTE-AUSTRALASIA" },
+	{ 0x70B3D5, 0xDAB000, 0xDABFFF, "SET Power Systems GmbH", "SET-POWER" },
+	{ 0x70B3D5, 0xDAD000, 0xDADFFF, "GD Mission Systems", "GD-MISSION" },
+	{ 0x70B3D5, 0xDB0000, 0xDB0FFF, "Arnouse Digital Devices Corp", "ARNOUSE-DIGITAL-DEVICES" },
+	{ 0x70B3D5, 0xDB1000, 0xDB1FFF, "Biovigil Hygiene Technologies", "BIOVIGIL-HYGIENE-TECHNOLOGIES" },
 	{ 0x70B3D5, 0xDB2000, 0xDB2FFF, "Micro Electroninc Products", "MICRO-ELECTRONINC-PRODUCTS" },
-	{ 0x70B3D5, 0x967000, 0x967FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0xC16000, 0xC16FFF, "Southern Innovation", "SOUTHERN-INNOVATION" },
-	{ 0x70B3D5, 0x90F000, 0x90FFFF, "DTRON Communications (Pty) Ltd", "DTRON-COMMUNICATION-PTY" },
-	{ 0x70B3D5, 0x408000, 0x408FFF, "Comrod AS", "COMROD-AS" },
-	{ 0x70B3D5, 0x945000, 0x945FFF, "Symboticware Incorporated", "SYMBOTICWARE-INCORPORATED" },
-	{ 0x70B3D5, 0xD4D000, 0xD4DFFF, "The Morey Corporation", "THE-MOREY" },
-	{ 0x70B3D5, 0x192000, 0x192FFF, "ASPT, INC.", "ASPT" },
-	{ 0x70B3D5, 0x807000, 0x807FFF, "Camsat Przemysław Gralak", "CAMSAT-PRZEMYSłAW-GRALAK" },
+	{ 0x70B3D5, 0xDB4000, 0xDB4FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0xDB5000, 0xDB5FFF, "Xiamen Point Circle Technologh Co,ltd", "XIAMEN-POINT-CIRCLE-TECHNOLOGH" },
+	{ 0x70B3D5, 0xDB6000, 0xDB6FFF, "csintech", "CSINTECH" },
+	{ 0x70B3D5, 0xDB8000, 0xDB8FFF, "SISTEM SA", "SISTEM" },
+	{ 0x70B3D5, 0xDBF000, 0xDBFFFF, "Infodev Electronic Designers Intl.", "INFODEV-DESIGNERS-INTL" },
+	{ 0x70B3D5, 0xDC0000, 0xDC0FFF, "ATEME", "ATEME" },
+	{ 0x70B3D5, 0xDC5000, 0xDC5FFF, "Excel Medical Electronics LLC", "EXCEL-MEDICAL-ELECTRONICS-LLC" },
+	{ 0x70B3D5, 0xDC6000, 0xDC6FFF, "IDEM INC.", "IDEM" },
+	{ 0x70B3D5, 0xDC8000, 0xDC8FFF, "Enertex Bayern GmbH", "ENERTEX-BAYERN" },
+	{ 0x70B3D5, 0xDC9000, 0xDC9FFF, "Sensoterra BV", "SENSOTERRA" },
+	{ 0x70B3D5, 0xDCA000, 0xDCAFFF, "DSan Corporation", "DSAN" },
+	{ 0x70B3D5, 0xDCC000, 0xDCCFFF, "Eutron SPA", "EUTRON-SPA" },
+	{ 0x70B3D5, 0xDCE000, 0xDCEFFF, "Stahl GmbH", "STAHL" },
+	{ 0x70B3D5, 0xDCF000, 0xDCFFFF, "KLS Netherlands B.V.", "KLS-NETHERLANDS" },
 	{ 0x70B3D5, 0xDD1000, 0xDD1FFF, "em-tec GmbH", "EM-TEC" },
-	{ 0x70B3D5, 0xED1000, 0xED1FFF, "Przemyslowy Instytut Automatyki i Pomiarow", "PRZEMYSLOWY-INSTYTUT-AUTOMATYKI-I-POMIAROW" },
-	{ 0x70B3D5, 0x14A000, 0x14AFFF, "ExSens Technology (Pty) Ltd.", "EXSENS-PTY" },
-	{ 0x70B3D5, 0xA69000, 0xA69FFF, "Leviathan Solutions Ltd.", "LEVIATHAN-SOLUTIONS" },
-	{ 0x70B3D5, 0xA9A000, 0xA9AFFF, "Amphenol Advanced Sensors", "AMPHENOL-ADVANCED-SENSORS" },
-	{ 0x70B3D5, 0x715000, 0x715FFF, "RIOT", "RIOT" },
-	{ 0x70B3D5, 0xFF8000, 0xFF8FFF, "Dutile, Glines and Higgins Corporation", "DUTILE-GLINES-AND-HIGGINS" },
-	{ 0x70B3D5, 0x413000, 0x413FFF, "Axess AG", "AXESS" },
+	{ 0x70B3D5, 0xDD2000, 0xDD2FFF, "Insitu, Inc", "INSITU" },
+	{ 0x70B3D5, 0xDD5000, 0xDD5FFF, "Cooltera Limited", "COOLTERA" },
+	{ 0x70B3D5, 0xDD7000, 0xDD7FFF, "DETECT Australia", "DETECT-AUSTRALIA" },
+	{ 0x70B3D5, 0xDD8000, 0xDD8FFF, "EMSCAN Corp.", "EMSCAN" },
+	{ 0x70B3D5, 0xDDB000, 0xDDBFFF, "Intra Corporation", "INTRA" },
+	{ 0x70B3D5, 0xDDC000, 0xDDCFFF, "Syscom Instruments SA", "SYSCOM-INSTRUMENTS" },
+	{ 0x70B3D5, 0xDDD000, 0xDDDFFF, "BIO RAD LABORATORIES", "BIO-RAD-LABORATORIES" },
+	{ 0x70B3D5, 0xDDF000, 0xDDFFFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
+	{ 0x70B3D5, 0xDE0000, 0xDE0FFF, "eCozy GmbH", "ECOZY" },
+	{ 0x70B3D5, 0xDE2000, 0xDE2FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
+	{ 0x70B3D5, 0xDE4000, 0xDE4FFF, "MAVILI ELEKTRONIK TIC. VE SAN. A.S.", "MAVILI-ELEKTRONIK-TIC-VE-SAN-A-S" },
+	{ 0x70B3D5, 0xDE6000, 0xDE6FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xDE7000, 0xDE7FFF, "Innominds Software Private Limited", "INNOMINDS-SOFTWARE-PRIVATE" },
+	{ 0x70B3D5, 0xDE8000, 0xDE8FFF, "Nation-E Ltd.", "NATION-E" },
+	{ 0x70B3D5, 0xDE9000, 0xDE9FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xDEA000, 0xDEAFFF, "Advanced Ventilation Applications, Inc.", "ADVANCED-VENTILATION-APPLICATIONS" },
+	{ 0x70B3D5, 0xDEC000, 0xDECFFF, "Condev-Automation GmbH", "CONDEV-AUTOMATION" },
+	{ 0x70B3D5, 0xDEE000, 0xDEEFFF, "CRDE", "CRDE" },
+	{ 0x70B3D5, 0xDF0000, 0xDF0FFF, "astozi consulting Tomasz Zieba", "ASTOZI-CONSULTING-TOMASZ-ZIEBA" },
+	{ 0x70B3D5, 0xDF1000, 0xDF1FFF, "CoXlab Inc.", "COXLAB" },
+	{ 0x70B3D5, 0xDF2000, 0xDF2FFF, "AML", "AML" },
+	{ 0x70B3D5, 0xDF3000, 0xDF3FFF, "SPC Bioclinicum", "SPC-BIOCLINICUM" },
+	{ 0x70B3D5, 0xDF6000, 0xDF6FFF, "Tiab Limited", "TIAB" },
+	{ 0x70B3D5, 0xDF7000, 0xDF7FFF, "Refecor Oy", "REFECOR-OY" },
+	{ 0x70B3D5, 0xDF8000, 0xDF8FFF, "RMA Mess- und Regeltechnik GmbH & Co.KG", "RMA-MESS--UND-REGELTECHNIK" },
+	{ 0x70B3D5, 0xDF9000, 0xDF9FFF, "Korea Plant Maintenance", "KOREA-PLANT-MAINTENANCE" },
+	{ 0x70B3D5, 0xDFA000, 0xDFAFFF, "Newtouch Electronics (Shanghai) Co.,Ltd.", "NEWTOUCH-ELECTRONICS-SHANGHAI" },
+	{ 0x70B3D5, 0xDFC000, 0xDFCFFF, "ELECTRONIC SYSTEMS DESIGN SPRL", "DESIGN-SPRL" },
+	{ 0x70B3D5, 0xDFD000, 0xDFDFFF, "Contiweb", "CONTIWEB" },
+	{ 0x70B3D5, 0xDFF000, 0xDFFFFF, "Spanawave Corporation", "SPANAWAVE" },
+	{ 0x70B3D5, 0xE02000, 0xE02FFF, "YEHL & JORDAN LLC", "YEHL-JORDAN-LLC" },
+	{ 0x70B3D5, 0xE04000, 0xE04FFF, "Combilent", "COMBILENT" },
+	{ 0x70B3D5, 0xE07000, 0xE07FFF, "Baader Planetarium GmbH", "BAADER-PLANETARIUM" },
+	{ 0x70B3D5, 0xE08000, 0xE08FFF, "Olssen", "OLSSEN" },
+	{ 0x70B3D5, 0xE09000, 0xE09FFF, "L-3 communications ComCept Division", "L-3-COMMUNICATION-COMCEPT-DIVISION" },
+	{ 0x70B3D5, 0xE0B000, 0xE0BFFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0xE0C000, 0xE0CFFF, "Communication Systems Solutions", "COMMUNICATION-SOLUTIONS" },
+	{ 0x70B3D5, 0xE0D000, 0xE0DFFF, "Sigma Connectivity AB", "SIGMA-CONNECTIVITY-AB" },
+	{ 0x70B3D5, 0xE0F000, 0xE0FFFF, "Vtron Pty Ltd", "VTRON-PTY" },
+	{ 0x70B3D5, 0xE16000, 0xE16FFF, "China Entropy Co., Ltd.", "CHINA-ENTROPY" },
+	{ 0x70B3D5, 0xE17000, 0xE17FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xE18000, 0xE18FFF, "Plasmapp Co.,Ltd.", "PLASMAPP" },
+	{ 0x70B3D5, 0xE1A000, 0xE1AFFF, "BIZERBA LUCEO", "BIZERBA-LUCEO" },
+	{ 0x70B3D5, 0xE1B000, 0xE1BFFF, "Neuron GmbH", "NEURON" },
+	{ 0x70B3D5, 0xE1C000, 0xE1CFFF, "Xcenter AS", "XCENTER-AS" },
+	{ 0x70B3D5, 0xE20000, 0xE20FFF, "Signature Control Systems, LLC.", "SIGNATURE-CONTROL-LLC" },
+	{ 0x70B3D5, 0xE21000, 0xE21FFF, "LLVISION TECHNOLOGY CO.,LTD", "LLVISION" },
+	{ 0x70B3D5, 0xE22000, 0xE22FFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xE23000, 0xE23FFF, "Smith Meter, Inc.", "SMITH-METER" },
+	{ 0x70B3D5, 0xE26000, 0xE26FFF, "FEITIAN CO.,LTD.", "FEITIAN" },
+	{ 0x70B3D5, 0xE27000, 0xE27FFF, "Woodside Electronics", "WOODSIDE-ELECTRONICS" },
+	{ 0x70B3D5, 0xE28000, 0xE28FFF, "iotec GmbH", "IOTEC" },
+	{ 0x70B3D5, 0xE2B000, 0xE2BFFF, "Guan Show Technologe Co., Ltd.", "GUAN-SHOW-TECHNOLOGE" },
+	{ 0x70B3D5, 0xE2C000, 0xE2CFFF, "Fourth Frontier Technologies Private Limited", "FOURTH-FRONTIER-TECHNOLOGIES-PRIVATE" },
+	{ 0x70B3D5, 0xE2E000, 0xE2EFFF, "Merz s.r.o.", "MERZ-S-R-O" },
+	{ 0x70B3D5, 0xE30000, 0xE30FFF, "QUISS AG", "QUISS" },
+	{ 0x70B3D5, 0xE32000, 0xE32FFF, "HERUTU ELECTRONICS CORPORATION", "HERUTU-ELECTRONICS" },
+	{ 0x70B3D5, 0xE35000, 0xE35FFF, "Nanospeed Technologies Limited", "NANOSPEED-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xE36000, 0xE36FFF, "Guidance Navigation Limited", "GUIDANCE-NAVIGATION" },
+	{ 0x70B3D5, 0xE39000, 0xE39FFF, "Thinnect, Inc,", "THINNECT" },
+	{ 0x70B3D5, 0xE3A000, 0xE3AFFF, "Cyanview", "CYANVIEW" },
+	{ 0x70B3D5, 0xE3B000, 0xE3BFFF, "ComNav Technology Ltd.", "COMNAV" },
+	{ 0x70B3D5, 0xE3D000, 0xE3DFFF, "Leo Bodnar Electronics Ltd", "LEO-BODNAR-ELECTRONICS" },
+	{ 0x70B3D5, 0xE3E000, 0xE3EFFF, "Sol Welding srl", "SOL-WELDING-SRL" },
+	{ 0x70B3D5, 0xE3F000, 0xE3FFFF, "BESTCODE LLC", "BESTCODE-LLC" },
+	{ 0x70B3D5, 0xE43000, 0xE43FFF, "SL Audio A/S", "SL-AUDIO-A/S" },
+	{ 0x70B3D5, 0xE45000, 0xE45FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
+	{ 0x70B3D5, 0xE47000, 0xE47FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0xE48000, 0xE48FFF, "TDI. Co., LTD", "TDI" },
+	{ 0x70B3D5, 0xE49000, 0xE49FFF, "Kendrion Mechatronics Center GmbH", "KENDRION-MECHATRONICS-CENTER" },
+	{ 0x70B3D5, 0xE4A000, 0xE4AFFF, "ICP NewTech Ltd", "ICP-NEWTECH" },
+	{ 0x70B3D5, 0xE4B000, 0xE4BFFF, "DELTA", "DELTA" },
+	{ 0x70B3D5, 0xE4C000, 0xE4CFFF, "IAI-Israel Aerospace Industries MBT", "IAI-ISRAEL-AEROSPACE-INDUSTRIES-MBT" },
+	{ 0x70B3D5, 0xE4E000, 0xE4EFFF, "Midfin Systems", "MIDFIN" },
+	{ 0x70B3D5, 0xE4F000, 0xE4FFFF, "RWS Automation GmbH", "RWS-AUTOMATION" },
+	{ 0x70B3D5, 0xE50000, 0xE50FFF, "Advanced Vision Technology Ltd", "ADVANCED-VISION" },
+	{ 0x70B3D5, 0xE52000, 0xE52FFF, "Guangzhou Moblin Technology Co., Ltd.", "GUANGZHOU-MOBLIN" },
+	{ 0x70B3D5, 0xE53000, 0xE53FFF, "MI INC.", "MI" },
+	{ 0x70B3D5, 0xE55000, 0xE55FFF, "BELT S.r.l.", "BELT-S-R-L" },
+	{ 0x70B3D5, 0xE57000, 0xE57FFF, "Iradimed", "IRADIMED" },
+	{ 0x70B3D5, 0xE58000, 0xE58FFF, "Thurlby Thandar Instruments LTD", "THURLBY-THANDAR-INSTRUMENTS" },
+	{ 0x70B3D5, 0xE59000, 0xE59FFF, "Fracarro srl", "FRACARRO-SRL" },
+	{ 0x70B3D5, 0xE5D000, 0xE5DFFF, "Boffins Technologies AB", "BOFFINS-TECHNOLOGIES-AB" },
 	{ 0x70B3D5, 0xE5E000, 0xE5EFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xE61000, 0xE61FFF, "Adeli", "ADELI" },
+	{ 0x70B3D5, 0xE67000, 0xE67FFF, "APPLIED PROCESSING", "APPLIED-PROCESSING" },
+	{ 0x70B3D5, 0xE69000, 0xE69FFF, "Fire4 Systems UK Ltd", "FIRE4-UK" },
+	{ 0x70B3D5, 0xE6C000, 0xE6CFFF, "Fusar Technologies inc", "FUSAR-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xE6D000, 0xE6DFFF, "Domus S.C.", "DOMUS-S-C" },
+	{ 0x70B3D5, 0xE6E000, 0xE6EFFF, "Lieron BVBA", "LIERON-BVBA" },
+	{ 0x70B3D5, 0xE70000, 0xE70FFF, "DISK Multimedia s.r.o.", "DISK-MULTIMEDIA-S-R-O" },
+	{ 0x70B3D5, 0xE71000, 0xE71FFF, "SiS Technology", "SIS" },
+	{ 0x70B3D5, 0xE74000, 0xE74FFF, "Exfrontier Co., Ltd.", "EXFRONTIER" },
+	{ 0x70B3D5, 0xE75000, 0xE75FFF, "Nke", "NKE" },
+	{ 0x70B3D5, 0xE76000, 0xE76FFF, "Dorsett Technologies, Inc.", "DORSETT-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xE77000, 0xE77FFF, "OPTIX JSC", "OPTIX-JSC" },
+	{ 0x70B3D5, 0xE7A000, 0xE7AFFF, "ART SPA", "ART-SPA" },
+	{ 0x70B3D5, 0xE7B000, 0xE7BFFF, "Shenzhen SanYeCao Electronics Co.,Ltd", "SHENZHEN-SANYECAO-ELECTRONICS" },
+	{ 0x70B3D5, 0xE7C000, 0xE7CFFF, "Aplex Technology Inc.", "APLEX" },
 	{ 0x70B3D5, 0xE7D000, 0xE7DFFF, "Nanjing Dandick Science&technology development co., LTD", "NANJING-DANDICK-SCIENCE-DEVELOPMENT" },
-	{ 0x70B3D5, 0xD98000, 0xD98FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
-	{ 0x70B3D5, 0xFA6000, 0xFA6FFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
-	{ 0x70B3D5, 0xD43000, 0xD43FFF, "EZSYS Co., Ltd.", "EZSYS" },
-	{ 0x70B3D5, 0x359000, 0x359FFF, "Boutronic", "BOUTRONIC" },
-	{ 0x001BC5, 0x0B2000, 0x0B2FFF, "SKODA ELECTRIC a.s.", "SKODA-ELECTRIC-A-S" },
-	{ 0x70B3D5, 0x035000, 0x035FFF, "HKW-Elektronik GmbH", "HKW-ELEKTRONIK" },
-	{ 0x70B3D5, 0xDFA000, 0xDFAFFF, "Newtouch Electronics (Shanghai) Co.,Ltd.", "NEWTOUCH-ELECTRONICS-SHANGHAI" },
+	{ 0x70B3D5, 0xE7E000, 0xE7EFFF, "Groupe Citypassenger Inc", "GROUPE-CITYPASSENGER" },
+	{ 0x70B3D5, 0xE82000, 0xE82FFF, "RF Track", "RF-TRACK" },
+	{ 0x70B3D5, 0xE84000, 0xE84FFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
+	{ 0x70B3D5, 0xE85000, 0xE85FFF, "Explorer Inc.", "EXPLORER" },
+	{ 0x70B3D5, 0xE86000, 0xE86FFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
+	{ 0x70B3D5, 0xE88000, 0xE88FFF, "Breas Medical AB", "BREAS-MEDICAL-AB" },
+	{ 0x70B3D5, 0xE8E000, 0xE8EFFF, "Macnica Technology", "MACNICA" },
+	{ 0x70B3D5, 0xE8F000, 0xE8FFFF, "DISMUNTEL, S.A.", "DISMUNTEL" },
+	{ 0x70B3D5, 0xE90000, 0xE90FFF, "Getein Biotechnology Co.,ltd", "GETEIN-BIOTECHNOLOGY" },
+	{ 0x70B3D5, 0xE91000, 0xE91FFF, "NAS Australia P/L", "NAS-AUSTRALIA-P/L" },
+	{ 0x70B3D5, 0xE92000, 0xE92FFF, "FUJI DATA SYSTEM CO.,LTD.", "FUJI-DATA-SYSTEM" },
+	{ 0x70B3D5, 0xE93000, 0xE93FFF, "ECON Technology Co.Ltd", "ECON" },
+	{ 0x70B3D5, 0xE94000, 0xE94FFF, "Lumiplan Duhamel", "LUMIPLAN-DUHAMEL" },
+	{ 0x70B3D5, 0xE95000, 0xE95FFF, "BroadSoft Inc", "BROADSOFT" },
+	{ 0x70B3D5, 0xE96000, 0xE96FFF, "Cellier Domesticus inc", "CELLIER-DOMESTICUS" },
+	{ 0x70B3D5, 0xE98000, 0xE98FFF, "JSC Kaluga Astral", "JSC-KALUGA-ASTRAL" },
+	{ 0x70B3D5, 0xE99000, 0xE99FFF, "Advitronics telecom bv", "ADVITRONICS-TELECOM" },
+	{ 0x70B3D5, 0xE9A000, 0xE9AFFF, "Meta Computing Services, Corp", "META-COMPUTING-SERVICES" },
+	{ 0x70B3D5, 0xE9B000, 0xE9BFFF, "NUMATA R&D Co.,Ltd", "NUMATA-R-D" },
+	{ 0x70B3D5, 0xE9C000, 0xE9CFFF, "ATG UV Technology", "ATG-UV" },
+	{ 0x70B3D5, 0xE9E000, 0xE9EFFF, "MSB Elektronik und Gerätebau GmbH", "MSB-ELEKTRONIK-UND-GERAETEBAU" },
+	{ 0x70B3D5, 0xEA0000, 0xEA0FFF, "PARK24", "PARK24" },
+	{ 0x70B3D5, 0xEA2000, 0xEA2FFF, "Transportal Solutions Ltd", "TRANSPORTAL-SOLUTIONS" },
+	{ 0x70B3D5, 0xEA3000, 0xEA3FFF, "Gridless Power Corperation", "GRIDLESS-POWER-CORPERATION" },
+	{ 0x70B3D5, 0xEA4000, 0xEA4FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA-S-L" },
+	{ 0x70B3D5, 0xEA6000, 0xEA6FFF, "Galios", "GALIOS" },
+	{ 0x70B3D5, 0xEA7000, 0xEA7FFF, "S.I.C.E.S. srl", "S-I-C-E-S-SRL" },
+	{ 0x70B3D5, 0xEA8000, 0xEA8FFF, "Dia-Stron Limited", "DIA-STRON" },
+	{ 0x70B3D5, 0xEAB000, 0xEABFFF, "APEN GROUP SpA (VAT IT08767740155)", "APEN-GROUP-SPA-VAT-IT08767740155" },
+	{ 0x70B3D5, 0xEAC000, 0xEACFFF, "Kentech Instruments Limited", "KENTECH-INSTRUMENTS" },
+	{ 0x70B3D5, 0xEAE000, 0xEAEFFF, "Orlaco Products B.V.", "ORLACO-PRODUCTS" },
+	{ 0x70B3D5, 0xEB0000, 0xEB0FFF, "Nautel Limted", "NAUTEL-LIMTED" },
+	{ 0x70B3D5, 0xEB1000, 0xEB1FFF, "CP contech electronic GmbH", "CP-CONTECH" },
+	{ 0x70B3D5, 0xEB2000, 0xEB2FFF, "Shooter Detection Systems", "SHOOTER-DETECTION" },
+	{ 0x70B3D5, 0xEB3000, 0xEB3FFF, "KWS-Electronic GmbH", "KWS" },
+	{ 0x70B3D5, 0xEB4000, 0xEB4FFF, "Robotic Research, LLC", "ROBOTIC-RESEARCH-LLC" },
+	{ 0x70B3D5, 0xEB5000, 0xEB5FFF, "JUSTEK INC", "JUSTEK" },
+	{ 0x70B3D5, 0xEB7000, 0xEB7FFF, "Skreens", "SKREENS" },
+	{ 0x70B3D5, 0xEB9000, 0xEB9FFF, "Thiel Audio Products Company, LLC", "THIEL-AUDIO-PRODUCTS-COMPANY-LLC" },
+	{ 0x70B3D5, 0xEBA000, 0xEBAFFF, "Last Mile Gear", "LAST-MILE-GEAR" },
+	{ 0x70B3D5, 0xEBB000, 0xEBBFFF, "Beijing Wing ICT Technology Co., Ltd.", "BEIJING-WING-ICT" },
+	{ 0x70B3D5, 0xEBC000, 0xEBCFFF, "Refine Technology, LLC", "REFINE-LLC" },
+	{ 0x70B3D5, 0xEBD000, 0xEBDFFF, "midBit Technologies, LLC", "MIDBIT-TECHNOLOGIES-LLC" },
+	{ 0x70B3D5, 0xEBE000, 0xEBEFFF, "Sierra Pacific Innovations Corp", "SIERRA-PACIFIC-INNOVATIONS" },
+	{ 0x70B3D5, 0xEC1000, 0xEC1FFF, "Xafax Nederland bv", "XAFAX-NEDERLAND" },
+	{ 0x70B3D5, 0xEC3000, 0xEC3FFF, "Virtual Control Systems Ltd", "VIRTUAL-CONTROL" },
+	{ 0x70B3D5, 0xEC6000, 0xEC6FFF, "ESII", "ESII" },
 	{ 0x70B3D5, 0xEC7000, 0xEC7FFF, "Neoptix Inc.", "NEOPTIX" },
-	{ 0x70B3D5, 0x5B8000, 0x5B8FFF, "Hella Gutmann Solutions GmbH", "HELLA-GUTMANN-SOLUTIONS" },
-	{ 0x70B3D5, 0x203000, 0x203FFF, "WOOJIN Inc", "WOOJIN" },
-	{ 0x70B3D5, 0x845000, 0x845FFF, "Harborside Technology", "HARBORSIDE" },
-	{ 0x70B3D5, 0x2F4000, 0x2F4FFF, "Radixon s.r.o.", "RADIXON-S-R-O" },
+	{ 0x70B3D5, 0xEC8000, 0xEC8FFF, "Viko Elektrik-Elektronik A.Ş.", "VIKO-ELEKTRIK-ELEKTRONIK-A-Ş" },
+	{ 0x70B3D5, 0xECA000, 0xECAFFF, "Transtronic AB", "TRANSTRONIC-AB" },
+	{ 0x70B3D5, 0xECB000, 0xECBFFF, "Re spa - Controlli Industriali - IT01782300154", "RE-SPA---CONTROLLI-INDUSTRIALI---IT01782300154" },
+	{ 0x70B3D5, 0xECD000, 0xECDFFF, "SBS-Feintechnik GmbH & Co. KG", "SBS-FEINTECHNIK" },
+	{ 0x70B3D5, 0xECE000, 0xECEFFF, "COMM-connect A/S", "COMM-CONNECT-A/S" },
+	{ 0x70B3D5, 0xECF000, 0xECFFFF, "Ipitek", "IPITEK" },
+	{ 0x70B3D5, 0xED0000, 0xED0FFF, "shanghai qiaoqi zhinengkeji", "SHANGHAI-QIAOQI-ZHINENGKEJI" },
+	{ 0x70B3D5, 0xED1000, 0xED1FFF, "Przemyslowy Instytut Automatyki i Pomiarow", "PRZEMYSLOWY-INSTYTUT-AUTOMATYKI-I-POMIAROW" },
+	{ 0x70B3D5, 0xED5000, 0xED5FFF, "hangzhou battle link technology Co.,Ltd", "HANGZHOU-BATTLE-LINK" },
+	{ 0x70B3D5, 0xED7000, 0xED7FFF, "WAVE", "WAVE" },
+	{ 0x70B3D5, 0xEDB000, 0xEDBFFF, "Netfort Solutions", "NETFORT-SOLUTIONS" },
+	{ 0x70B3D5, 0xEDC000, 0xEDCFFF, "J.D. Koftinoff Software, Ltd.", "J-D-KOFTINOFF-SOFTWARE" },
+	{ 0x70B3D5, 0xEDD000, 0xEDDFFF, "Solar Network & Partners", "SOLAR-NETWORK-PARTNERS" },
+	{ 0x70B3D5, 0xEDF000, 0xEDFFFF, "GridNavigator", "GRIDNAVIGATOR" },
+	{ 0x70B3D5, 0xEE1000, 0xEE1FFF, "allora Factory BVBA", "ALLORA-FACTORY-BVBA" },
+	{ 0x70B3D5, 0xEE3000, 0xEE3FFF, "Lithe Technology, LLC", "LITHE-LLC" },
+	{ 0x70B3D5, 0xEE4000, 0xEE4FFF, "O-Net Automation Technology (Shenzhen)Limited", "O-NET-AUTOMATION-SHENZHEN" },
+	{ 0x70B3D5, 0xEE5000, 0xEE5FFF, "Beijing Hzhytech Technology Co.Ltd", "BEIJING-HZHYTECH" },
+	{ 0x70B3D5, 0xEE7000, 0xEE7FFF, "BLUE-SOLUTIONS CANADA INC.", "BLUE-SOLUTIONS-CANADA" },
+	{ 0x70B3D5, 0xEE8000, 0xEE8FFF, "robert juliat", "ROBERT-JULIAT" },
+	{ 0x70B3D5, 0xEEA000, 0xEEAFFF, "Dameca a/s", "DAMECA-A/S" },
+	{ 0x70B3D5, 0xEEC000, 0xEECFFF, "Impolux GmbH", "IMPOLUX" },
+	{ 0x70B3D5, 0xEED000, 0xEEDFFF, "COMM-connect A/S", "COMM-CONNECT-A/S" },
+	{ 0x70B3D5, 0xEEE000, 0xEEEFFF, "SOCIEDAD IBERICA DE CONSTRUCCIONES ELECTRICAS, S.A. (SICE)", "SOCIEDAD-IBERICA-DE-CONSTRUCCIONES-ELECTRICAS-SICE" },
+	{ 0x70B3D5, 0xEEF000, 0xEEFFFF, "TATTILE SRL", "TATTILE-SRL" },
+	{ 0x70B3D5, 0xEF2000, 0xEF2FFF, "Kongsberg Intergrated Tactical Systems", "KONGSBERG-INTERGRATED-TACTICAL" },
+	{ 0x70B3D5, 0xEF3000, 0xEF3FFF, "octoScope", "OCTOSCOPE" },
+	{ 0x70B3D5, 0xEF4000, 0xEF4FFF, "Orange Tree Technologies Ltd", "ORANGE-TREE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xEF5000, 0xEF5FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
+	{ 0x70B3D5, 0xEF6000, 0xEF6FFF, "CHARGELIB", "CHARGELIB" },
+	{ 0x70B3D5, 0xEF7000, 0xEF7FFF, "DAVE SRL", "DAVE-SRL" },
+	{ 0x70B3D5, 0xEF8000, 0xEF8FFF, "DKS Dienstl.ges. f. Komm.anl. d. Stadt- u. Reg.verk. mbH", "DKS-DIENSTL-GES-F-KOMM-ANL-D-STADT--U-REG-VERK-MBH" },
+	{ 0x70B3D5, 0xEF9000, 0xEF9FFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xEFA000, 0xEFAFFF, "NextEra Energy Resources, LLC", "NEXTERA-ENERGY-RESOURCES-LLC" },
+	{ 0x70B3D5, 0xEFB000, 0xEFBFFF, "PXM sp.k.", "PXM-SP-K" },
+	{ 0x70B3D5, 0xEFE000, 0xEFEFFF, "MEIDEN SYSTEM SOLUTIONS", "MEIDEN-SYSTEM-SOLUTIONS" },
+	{ 0x70B3D5, 0xF00000, 0xF00FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xF01000, 0xF01FFF, "Software Systems Plus", "SOFTWARE-PLUS" },
+	{ 0x70B3D5, 0xF03000, 0xF03FFF, "GMI Ltd", "GMI" },
+	{ 0x70B3D5, 0xF04000, 0xF04FFF, "Scame Sistemi srl", "SCAME-SISTEMI-SRL" },
+	{ 0x70B3D5, 0xF05000, 0xF05FFF, "Motomuto Aps", "MOTOMUTO-APS" },
+	{ 0x70B3D5, 0xF06000, 0xF06FFF, "WARECUBE,INC", "WARECUBE" },
+	{ 0x70B3D5, 0xF07000, 0xF07FFF, "DUVAL MESSIEN", "DUVAL-MESSIEN" },
+	{ 0x70B3D5, 0xF08000, 0xF08FFF, "Szabo Software & Engineering UK Ltd", "SZABO-SOFTWARE-ENGINEERING-UK" },
+	{ 0x70B3D5, 0xF0B000, 0xF0BFFF, "RF Industries", "RF-INDUSTRIES" },
+	{ 0x70B3D5, 0xF0C000, 0xF0CFFF, "ModulaTeam GmbH", "MODULATEAM" },
+	{ 0x70B3D5, 0xF0D000, 0xF0DFFF, "MeQ Inc.", "MEQ" },
+	{ 0x70B3D5, 0xF10000, 0xF10FFF, "Riegl Laser Measurement Systems GmbH", "RIEGL-LASER-MEASUREMENT" },
+	{ 0x70B3D5, 0xF11000, 0xF11FFF, "BroadSoft Inc", "BROADSOFT" },
+	{ 0x70B3D5, 0xF12000, 0xF12FFF, "Incoil Induktion AB", "INCOIL-INDUKTION-AB" },
+	{ 0x70B3D5, 0xF13000, 0xF13FFF, "MEDIAM Sp. z o.o.", "MEDIAM-SP-Z-O-O" },
+	{ 0x70B3D5, 0xF14000, 0xF14FFF, "SANYU SWITCH CO., LTD.", "SANYU-SWITCH" },
+	{ 0x70B3D5, 0xF16000, 0xF16FFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
+	{ 0x70B3D5, 0xF17000, 0xF17FFF, "VITEC", "VITEC" },
+	{ 0x70B3D5, 0xF18000, 0xF18FFF, "HD Vision Systems GmbH", "HD-VISION" },
 	{ 0x70B3D5, 0xF19000, 0xF19FFF, "Vitro Technology Corporation", "VITRO" },
-	{ 0x70B3D5, 0x141000, 0x141FFF, "M.T. S.R.L.", "M-T-S-R-L" },
-	{ 0x70B3D5, 0xC11000, 0xC11FFF, "Ariston Thermo s.p.a.", "ARISTON-THERMO-S-P-A" },
-	{ 0x70B3D5, 0x154000, 0x154FFF, "Walk Horizon Technology (Beijing) Co., Ltd.", "WALK-HORIZON-BEIJING" },
-	{ 0x70B3D5, 0xD72000, 0xD72FFF, "OnYield Inc Ltd", "ONYIELD" },
-	{ 0x70B3D5, 0xD6A000, 0xD6AFFF, "KnowRoaming", "KNOWROAMING" },
+	{ 0x70B3D5, 0xF1A000, 0xF1AFFF, "Sator Controls s.r.o.", "SATOR-CONTROLS-S-R-O" },
+	{ 0x70B3D5, 0xF1D000, 0xF1DFFF, "Critical Link LLC", "CRITICAL-LINK-LLC" },
+	{ 0x70B3D5, 0xF1E000, 0xF1EFFF, "ATX NETWORKS LTD", "ATX-NETWORKS" },
+	{ 0x70B3D5, 0xF1F000, 0xF1FFFF, "HKC Limited", "HKC" },
+	{ 0x70B3D5, 0xF21000, 0xF21FFF, "dds", "DDS" },
+	{ 0x70B3D5, 0xF22000, 0xF22FFF, "Shengli Financial Software Development", "SHENGLI-FINANCIAL-SOFTWARE-DEVELOPMENT" },
+	{ 0x70B3D5, 0xF24000, 0xF24FFF, "Daavlin", "DAAVLIN" },
+	{ 0x70B3D5, 0xF25000, 0xF25FFF, "JSC “Scientific Industrial Enterprise Rubin", "JSC-“SCIENTIFIC-INDUSTRIAL-RUBIN" },
+	{ 0x70B3D5, 0xF27000, 0xF27FFF, "NIRIT- Xinwei Telecom Technology Co., Ltd.", "NIRIT--XINWEI-TELECOM" },
+	{ 0x70B3D5, 0xF2A000, 0xF2AFFF, "WIBOND Informationssysteme GmbH", "WIBOND-INFORMATIONSSYSTEME" },
+	{ 0x70B3D5, 0xF2B000, 0xF2BFFF, "SENSYS GmbH", "SENSYS" },
+	{ 0x70B3D5, 0xF2C000, 0xF2CFFF, "Hengen Technologies GmbH", "HENGEN-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xF2D000, 0xF2DFFF, "ID Lock AS", "ID-LOCK-AS" },
+	{ 0x70B3D5, 0xF2E000, 0xF2EFFF, "Shanghai JCY Technology Company", "SHANGHAI-JCY-COMPANY" },
+	{ 0x70B3D5, 0xF30000, 0xF30FFF, "ADE Technology Inc.", "ADE" },
+	{ 0x70B3D5, 0xF34000, 0xF34FFF, "MacGray Services", "MACGRAY-SERVICES" },
+	{ 0x70B3D5, 0xF35000, 0xF35FFF, "carbonTRACK", "CARBONTRACK" },
+	{ 0x70B3D5, 0xF36000, 0xF36FFF, "dinosys", "DINOSYS" },
+	{ 0x70B3D5, 0xF37000, 0xF37FFF, "Mitsubishi Electric Micro-Computer Application Software Co.,Ltd.", "MITSUBISHI-ELECTRIC-MICRO--APPLICATION-SOFTWARE" },
+	{ 0x70B3D5, 0xF38000, 0xF38FFF, "Scanvaegt Nordic A/S", "SCANVAEGT-NORDIC-A/S" },
+	{ 0x70B3D5, 0xF39000, 0xF39FFF, "Zenros ApS", "ZENROS-APS" },
+	{ 0x70B3D5, 0xF3B000, 0xF3BFFF, "Epdm Pty Ltd", "EPDM-PTY" },
+	{ 0x70B3D5, 0xF3C000, 0xF3CFFF, "Gigaray", "GIGARAY" },
+	{ 0x70B3D5, 0xF42000, 0xF42FFF, "Matsuhisa Corporation", "MATSUHISA" },
+	{ 0x70B3D5, 0xF45000, 0xF45FFF, "Norbit ODM AS", "NORBIT-ODM-AS" },
+	{ 0x70B3D5, 0xF4C000, 0xF4CFFF, "Global Lightning Protection Services A(S", "GLOBAL-LIGHTNING-PROTECTION-SERVICES-A-S" },
+	{ 0x70B3D5, 0xF4D000, 0xF4DFFF, "Honeywell", "HONEYWELL" },
+	{ 0x70B3D5, 0xF4F000, 0xF4FFFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA-S-L" },
+	{ 0x70B3D5, 0xF51000, 0xF51FFF, "IoT Routers Limited", "IOT-ROUTERS" },
+	{ 0x70B3D5, 0xF52000, 0xF52FFF, "Alere Technologies AS", "ALERE-TECHNOLOGIES-AS" },
+	{ 0x70B3D5, 0xF54000, 0xF54FFF, "Revolution Retail Systems", "REVOLUTION-RETAIL" },
+	{ 0x70B3D5, 0xF55000, 0xF55FFF, "Kohler Mira Ltd", "KOHLER-MIRA" },
+	{ 0x70B3D5, 0xF56000, 0xF56FFF, "VirtualHere Pty. Ltd.", "VIRTUALHERE-PTY" },
+	{ 0x70B3D5, 0xF57000, 0xF57FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xF58000, 0xF58FFF, "CDR SRL", "CDR-SRL" },
+	{ 0x70B3D5, 0xF5A000, 0xF5AFFF, "HAMEG GmbH", "HAMEG" },
+	{ 0x70B3D5, 0xF5B000, 0xF5BFFF, "A.F.MENSAH, INC", "A-F-MENSAH" },
+	{ 0x70B3D5, 0xF5C000, 0xF5CFFF, "Nable Communications, Inc.", "NABLE-COMMUNICATION" },
+	{ 0x70B3D5, 0xF5E000, 0xF5EFFF, "Selex ES Inc.", "SELEX-ES" },
 	{ 0x70B3D5, 0xF5F000, 0xF5FFFF, "RFRain LLC", "RFRAIN-LLC" },
-	{ 0x70B3D5, 0xEBC000, 0xEBCFFF, "Refine Technology, LLC", "REFINE-LLC" },
-	{ 0x70B3D5, 0x389000, 0x389FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x984000, 0x984FFF, "Sanmina Israel", "SANMINA-ISRAEL" },
-	{ 0x70B3D5, 0x0D1000, 0x0D1FFF, "Common Sense Monitoring Solutions Ltd.", "COMMON-SENSE-MONITORING-SOLUTIONS" },
-	{ 0x70B3D5, 0x382000, 0x382FFF, "Naval Group", "NAVAL-GROUP" },
-	{ 0x70B3D5, 0x19F000, 0x19FFFF, "Koizumi Lighting Technology Corp.", "KOIZUMI-LIGHTING" },
-	{ 0x70B3D5, 0x968000, 0x968FFF, "LGM Ingénierie", "LGM-INGéNIERIE" },
-	{ 0x70B3D5, 0x05E000, 0x05EFFF, "VITEC", "VITEC" },
-	{ 0x70B3D5, 0x015000, 0x015FFF, "EN ElectronicNetwork Hamburg GmbH", "EN-ELECTRONICNETWORK-HAMBURG" },
-	{ 0x70B3D5, 0xCA3000, 0xCA3FFF, "Saankhya Labs Private Limited", "SAANKHYA-LABS-PRIVATE" },
-	{ 0x70B3D5, 0xD6E000, 0xD6EFFF, "ard sa", "ARD" },
-	{ 0x70B3D5, 0x240000, 0x240FFF, "Orlaco Products B.V.", "ORLACO-PRODUCTS" },
-	{ 0x70B3D5, 0xF8A000, 0xF8AFFF, "FRS GmbH & Co. KG", "FRS" },
-	{ 0x70B3D5, 0x073000, 0x073FFF, "Liteon Technology Corporation", "LITEON" },
-	{ 0x70B3D5, 0x7EE000, 0x7EEFFF, "ADVEEZ", "ADVEEZ" },
-	{ 0x70B3D5, 0xE52000, 0xE52FFF, "Guangzhou Moblin Technology Co., Ltd.", "GUANGZHOU-MOBLIN" },
-	{ 0x70B3D5, 0xB1E000, 0xB1EFFF, "Fen Systems Ltd", "FEN" },
-	{ 0x70B3D5, 0x78F000, 0x78FFFF, "SoFiHa", "SOFIHA" },
-	{ 0x70B3D5, 0x515000, 0x515FFF, "PCSC", "PCSC" },
-	{ 0x70B3D5, 0xD24000, 0xD24FFF, "Microtronics Engineering GmbH", "MICROTRONICS-ENGINEERING" },
-	{ 0x70B3D5, 0xBF9000, 0xBF9FFF, "Okolab Srl", "OKOLAB-SRL" },
-	{ 0x70B3D5, 0x406000, 0x406FFF, "Acrodea, Inc.", "ACRODEA" },
-	{ 0x70B3D5, 0x09A000, 0x09AFFF, "Akse srl", "AKSE-SRL" },
-	{ 0x70B3D5, 0xA9E000, 0xA9EFFF, "Argon ST", "ARGON-ST" },
-	{ 0x70B3D5, 0x161000, 0x161FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x3C4000, 0x3C4FFF, "Hagiwara Solutions Co., Ltd.", "HAGIWARA-SOLUTIONS" },
-	{ 0x70B3D5, 0xD71000, 0xD71FFF, "RZB Rudolf Zimmermann, Bamberg GmbH", "RZB-RUDOLF-ZIMMERMANN-BAMBERG" },
-	{ 0x70B3D5, 0xB9C000, 0xB9CFFF, "EDCO Technology 1993 ltd", "EDCO-1993" },
-	{ 0x70B3D5, 0x84C000, 0x84CFFF, "CoreKinect", "COREKINECT" },
-	{ 0x70B3D5, 0x434000, 0x434FFF, "Wit.com Inc", "WIT-COM" },
-	{ 0x70B3D5, 0xF10000, 0xF10FFF, "Riegl Laser Measurement Systems GmbH", "RIEGL-LASER-MEASUREMENT" },
-	{ 0x70B3D5, 0x61E000, 0x61EFFF, "PKE Electronics AG", "PKE-ELECTRONICS" },
-	{ 0x70B3D5, 0x360000, 0x360FFF, "PT. Emsonic Indonesia", "PT-EMSONIC-INDONESIA" },
-	{ 0x70B3D5, 0x3F2000, 0x3F2FFF, "H3D, Inc.", "H3D" },
-	{ 0x70B3D5, 0xACB000, 0xACBFFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x70B3D5, 0xE22000, 0xE22FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x636000, 0x636FFF, "Globalcom Engineering SPA", "GLOBALCOM-ENGINEERING-SPA" },
+	{ 0x70B3D5, 0xF61000, 0xF61FFF, "Power Diagnostic Service", "POWER-DIAGNOSTIC-SERVICE" },
+	{ 0x70B3D5, 0xF62000, 0xF62FFF, "FRS GmbH & Co. KG", "FRS" },
+	{ 0x70B3D5, 0xF63000, 0xF63FFF, "Ars Products", "ARS-PRODUCTS" },
+	{ 0x70B3D5, 0xF65000, 0xF65FFF, "MARKUS LABS", "MARKUS-LABS" },
+	{ 0x70B3D5, 0xF67000, 0xF67FFF, "winsun AG", "WINSUN" },
+	{ 0x70B3D5, 0xF68000, 0xF68FFF, "AL ZAJEL MODERN TELECOMM", "AL-ZAJEL-MODERN-TELECOMM" },
+	{ 0x70B3D5, 0xF6D000, 0xF6DFFF, "Qowisio", "QOWISIO" },
+	{ 0x70B3D5, 0xF6E000, 0xF6EFFF, "Streambox Inc", "STREAMBOX" },
+	{ 0x70B3D5, 0xF6F000, 0xF6FFFF, "Smashtag Ltd", "SMASHTAG" },
+	{ 0x70B3D5, 0xF70000, 0xF70FFF, "Honeywell", "HONEYWELL" },
+	{ 0x70B3D5, 0xF72000, 0xF72FFF, "Hanshin Electronics", "HANSHIN-ELECTRONICS" },
+	{ 0x70B3D5, 0xF73000, 0xF73FFF, "ASL Holdings", "ASL-HOLDINGS" },
+	{ 0x70B3D5, 0xF75000, 0xF75FFF, "Enlaps", "ENLAPS" },
+	{ 0x70B3D5, 0xF76000, 0xF76FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
+	{ 0x70B3D5, 0xF77000, 0xF77FFF, "Satcube AB", "SATCUBE-AB" },
+	{ 0x70B3D5, 0xF78000, 0xF78FFF, "Manvish eTech Pvt. Ltd.", "MANVISH-ETECH-PVT" },
+	{ 0x70B3D5, 0xF79000, 0xF79FFF, "Firehose Labs, Inc.", "FIREHOSE-LABS" },
+	{ 0x70B3D5, 0xF7A000, 0xF7AFFF, "SENSO2ME", "SENSO2ME" },
+	{ 0x70B3D5, 0xF7B000, 0xF7BFFF, "KST technology", "KST" },
+	{ 0x70B3D5, 0xF7C000, 0xF7CFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xF7E000, 0xF7EFFF, "Alpha Elettronica s.r.l.", "ALPHA-ELETTRONICA-S-R-L" },
+	{ 0x70B3D5, 0xF81000, 0xF81FFF, "Littlemore Scientific", "LITTLEMORE-SCIENTIFIC" },
+	{ 0x70B3D5, 0xF83000, 0xF83FFF, "Tata Communications Ltd.", "TATA-COMMUNICATION" },
 	{ 0x70B3D5, 0xF84000, 0xF84FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x70B3D5, 0xA8D000, 0xA8DFFF, "Code Blue Corporation", "CODE-BLUE" },
-	{ 0x70B3D5, 0xF58000, 0xF58FFF, "CDR SRL", "CDR-SRL" },
-	{ 0x70B3D5, 0x2B2000, 0x2B2FFF, "Sun Creative (ZheJiang) Technology INC.", "SUN-CREATIVE-ZHEJIANG" },
-	{ 0x70B3D5, 0x7C7000, 0x7C7FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x70B3D5, 0x680000, 0x680FFF, "BASF Corporation", "BASF" },
-	{ 0x70B3D5, 0xE94000, 0xE94FFF, "Lumiplan Duhamel", "LUMIPLAN-DUHAMEL" },
-	{ 0x70B3D5, 0xFD7000, 0xFD7FFF, "Centum Adetel Group", "CENTUM-ADETEL-GROUP" },
-	{ 0x70B3D5, 0xC4A000, 0xC4AFFF, "TIAMA", "TIAMA" },
-	{ 0x70B3D5, 0x355000, 0x355FFF, "Hongin., Ltd", "HONGIN" },
-	{ 0x70B3D5, 0x518000, 0x518FFF, "CRUXELL Corp.", "CRUXELL" },
-	{ 0x70B3D5, 0xF16000, 0xF16FFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRôNICOS" },
-	{ 0x70B3D5, 0x6FC000, 0x6FCFFF, "MI Inc.", "MI" },
-	{ 0x70B3D5, 0x1EA000, 0x1EAFFF, "Sense For Innovation", "SENSE-FOR-INNOVATION" },
-	{ 0x70B3D5, 0x673000, 0x673FFF, "ACD Elekronik GmbH", "ACD-ELEKRONIK" },
-	{ 0x70B3D5, 0xE5D000, 0xE5DFFF, "Boffins Technologies AB", "BOFFINS-TECHNOLOGIES-AB" },
-	{ 0x70B3D5, 0x402000, 0x402FFF, "AKIS technologies", "AKIS-TECHNOLOGIES" },
-	{ 0x70B3D5, 0xB8E000, 0xB8EFFF, "UR FOG S.R.L.", "UR-FOG-S-R-L" },
-	{ 0x70B3D5, 0x234000, 0x234FFF, "EDFelectronics JRMM Sp z o.o. sp.k.", "EDFELECTRONICS-JRMM-SP-Z-O-O-SP-K" },
+	{ 0x70B3D5, 0xF85000, 0xF85FFF, "Solystic", "SOLYSTIC" },
+	{ 0x70B3D5, 0xF87000, 0xF87FFF, "SHINWA INDUSTRIES, INC.", "SHINWA-INDUSTRIES" },
 	{ 0x70B3D5, 0xF88000, 0xF88FFF, "ODAWARAKIKI AUTO-MACHINE MFG.CO.,LTD", "ODAWARAKIKI-AUTO-MACHINE-MFG" },
-	{ 0x70B3D5, 0xB66000, 0xB66FFF, "Silent Gliss International Ltd", "SILENT-GLISS" },
-	{ 0x70B3D5, 0x793000, 0x793FFF, "Gastech Australia Pty Ltd", "GASTECH-AUSTRALIA-PTY" },
-	{ 0x70B3D5, 0x437000, 0x437FFF, "Digital Way", "DIGITAL-WAY" },
-	{ 0x70B3D5, 0x748000, 0x748FFF, "KDT", "KDT" },
-	{ 0x70B3D5, 0xC1F000, 0xC1FFFF, "Behr Technologies Inc", "BEHR-TECHNOLOGIES" },
-	{ 0x70B3D5, 0x27C000, 0x27CFFF, "MOTION LIB,Inc.", "MOTION-LIB" },
-	{ 0x70B3D5, 0x279000, 0x279FFF, "Private", "PRIVATE" },
-	{ 0x70B3D5, 0x008000, 0x008FFF, "ESYSE GmbH Embedded Systems Engineering", "ESYSE-EMBEDDED-ENGINEERING" },
-	{ 0x70B3D5, 0x14B000, 0x14BFFF, "C21 Systems Ltd", "C21" },
-	{ 0x70B3D5, 0x22D000, 0x22DFFF, "Leder Elektronik Design", "LEDER-ELEKTRONIK-DESIGN" },
-	{ 0x70B3D5, 0xC4C000, 0xC4CFFF, "VTC Digicom", "VTC-DIGICOM" },
-	{ 0x70B3D5, 0xB9A000, 0xB9AFFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL-LLC" },
-	{ 0x70B3D5, 0x2ED000, 0x2EDFFF, "Signals and systems india pvt ltd", "SIGNALS-AND-INDIA-PVT" },
-	{ 0x70B3D5, 0xDD2000, 0xDD2FFF, "Insitu, Inc", "INSITU" },
-	{ 0x70B3D5, 0x1C9000, 0x1C9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x70B3D5, 0x2FF000, 0x2FFFFF, "Sunstone Engineering", "SUNSTONE-ENGINEERING" },
-	{ 0x70B3D5, 0x3A4000, 0x3A4FFF, "Ascenix Corporation", "ASCENIX" },
-	{ 0x70B3D5, 0x0E9000, 0x0E9FFF, "VNT electronics s.r.o.", "VNT-ELECTRONICS-S-R-O" },
-	{ 0x70B3D5, 0x44B000, 0x44BFFF, "Open System Solutions Limited", "OPEN-SYSTEM-SOLUTIONS" },
-	{ 0x70B3D5, 0x4F6000, 0x4F6FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x70B3D5, 0x013000, 0x013FFF, "Sportsbeams Lighting, Inc.", "SPORTSBEAMS-LIGHTING" },
-	{ 0x70B3D5, 0x1BD000, 0x1BDFFF, "Shenzhen Siera Technology Ltd", "SHENZHEN-SIERA" },
-	{ 0x70B3D5, 0x0CF000, 0x0CFFFF, "sohonet ltd", "SOHONET" },
+	{ 0x70B3D5, 0xF8A000, 0xF8AFFF, "FRS GmbH & Co. KG", "FRS" },
+	{ 0x70B3D5, 0xF8B000, 0xF8BFFF, "IOOOTA Srl", "IOOOTA-SRL" },
+	{ 0x70B3D5, 0xF8C000, 0xF8CFFF, "EUROPEAN ADVANCED TECHNOLOGIES", "EUROPEAN-ADVANCED-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xF8D000, 0xF8DFFF, "Flextronics Canafa Design Services", "FLEXTRONICS-CANAFA-DESIGN-SERVICES" },
+	{ 0x70B3D5, 0xF8E000, 0xF8EFFF, "Isabellenhütte Heusler Gmbh &Co KG", "ISABELLENHUETTE-HEUSLER" },
+	{ 0x70B3D5, 0xF8F000, 0xF8FFFF, "DIMASTEC GESTAO DE PONTO E ACESSO EIRELI-ME", "DIMASTEC-GESTAO-DE-PONTO-E-ACESSO-EIRELI-ME" },
+	{ 0x70B3D5, 0xF92000, 0xF92FFF, "TechOne", "TECHONE" },
+	{ 0x70B3D5, 0xF93000, 0xF93FFF, "Hella Gutmann Solutions GmbH", "HELLA-GUTMANN-SOLUTIONS" },
+	{ 0x70B3D5, 0xF95000, 0xF95FFF, "Get SAT", "GET-SAT" },
+	{ 0x70B3D5, 0xF96000, 0xF96FFF, "Ecologicsense", "ECOLOGICSENSE" },
+	{ 0x70B3D5, 0xF98000, 0xF98FFF, "Metrum Sweden AB", "METRUM-SWEDEN-AB" },
+	{ 0x70B3D5, 0xF99000, 0xF99FFF, "TEX COMPUTER SRL", "TEX-SRL" },
+	{ 0x70B3D5, 0xF9A000, 0xF9AFFF, "Krabbenhøft og Ingolfsson", "KRABBENHøFT-OG-INGOLFSSON" },
+	{ 0x70B3D5, 0xF9B000, 0xF9BFFF, "EvoLogics GmbH", "EVOLOGICS" },
+	{ 0x70B3D5, 0xF9C000, 0xF9CFFF, "SureFlap Ltd", "SUREFLAP" },
+	{ 0x70B3D5, 0xF9E000, 0xF9EFFF, "International Center for Elementary Particle Physics, The University of Tokyo", "CENTER-FOR-ELEMENTARY-PARTICLE-PHYSICS-THE-UNIVERSITY-OF-TOKYO" },
+	{ 0x70B3D5, 0xFA0000, 0xFA0FFF, "TIAMA", "TIAMA" },
+	{ 0x70B3D5, 0xFA1000, 0xFA1FFF, "BBI Engineering, Inc.", "BBI-ENGINEERING" },
+	{ 0x70B3D5, 0xFA2000, 0xFA2FFF, "Sarokal Test Systems Oy", "SAROKAL-TEST-OY" },
+	{ 0x70B3D5, 0xFA3000, 0xFA3FFF, "ELVA-1 MICROWAVE HANDELSBOLAG", "ELVA-1-MICROWAVE-HANDELSBOLAG" },
+	{ 0x70B3D5, 0xFA4000, 0xFA4FFF, "Energybox Limited", "ENERGYBOX" },
+	{ 0x70B3D5, 0xFA5000, 0xFA5FFF, "Shenzhen Hui Rui Tianyan Technology Co., Ltd.", "SHENZHEN-HUI-RUI-TIANYAN" },
+	{ 0x70B3D5, 0xFA6000, 0xFA6FFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
+	{ 0x70B3D5, 0xFA7000, 0xFA7FFF, "Nordson Corporation", "NORDSON" },
+	{ 0x70B3D5, 0xFAA000, 0xFAAFFF, "LogiM GmbH Software und Entwicklung", "LOGIM-SOFTWARE-UND-ENTWICKLUNG" },
+	{ 0x70B3D5, 0xFAB000, 0xFABFFF, "Open System Solutions Limited", "OPEN-SYSTEM-SOLUTIONS" },
+	{ 0x70B3D5, 0xFAD000, 0xFADFFF, "ARC Technology Solutions, LLC", "ARC-SOLUTIONS-LLC" },
+	{ 0x70B3D5, 0xFAE000, 0xFAEFFF, "Silixa Ltd", "SILIXA" },
+	{ 0x70B3D5, 0xFAF000, 0xFAFFFF, "Radig Hard & Software", "RADIG-HARD-SOFTWARE" },
+	{ 0x70B3D5, 0xFB0000, 0xFB0FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
+	{ 0x70B3D5, 0xFB3000, 0xFB3FFF, "3PS Inc", "3PS" },
+	{ 0x70B3D5, 0xFB5000, 0xFB5FFF, "Orange Tree Technologies Ltd", "ORANGE-TREE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xFB6000, 0xFB6FFF, "KRONOTECH SRL", "KRONOTECH-SRL" },
+	{ 0x70B3D5, 0xFB7000, 0xFB7FFF, "SAICE", "SAICE" },
+	{ 0x70B3D5, 0xFBA000, 0xFBAFFF, "Apogee Applied Research, Inc.", "APOGEE-APPLIED-RESEARCH" },
+	{ 0x70B3D5, 0xFBB000, 0xFBBFFF, "Vena Engineering Corporation", "VENA-ENGINEERING" },
+	{ 0x70B3D5, 0xFBC000, 0xFBCFFF, "Twoway Communications, Inc.", "TWOWAY-COMMUNICATION" },
+	{ 0x70B3D5, 0xFBD000, 0xFBDFFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xFBE000, 0xFBEFFF, "Hanbat National University", "HANBAT-NATIONAL-UNIVERSITY" },
+	{ 0x70B3D5, 0xFBF000, 0xFBFFFF, "SenSys (Design Electronics Ltd)", "SENSYS-DESIGN-ELECTRONICS" },
+	{ 0x70B3D5, 0xFC0000, 0xFC0FFF, "CODESYSTEM Co.,Ltd", "CODESYSTEM" },
+	{ 0x70B3D5, 0xFC1000, 0xFC1FFF, "InDiCor", "INDICOR" },
+	{ 0x70B3D5, 0xFC2000, 0xFC2FFF, "HUNTER LIBERTY CORPORATION", "HUNTER-LIBERTY" },
+	{ 0x70B3D5, 0xFC5000, 0xFC5FFF, "Eltwin A/S", "ELTWIN-A/S" },
+	{ 0x70B3D5, 0xFC6000, 0xFC6FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
+	{ 0x70B3D5, 0xFC8000, 0xFC8FFF, "Moduware PTY LTD", "MODUWARE-PTY" },
+	{ 0x70B3D5, 0xFC9000, 0xFC9FFF, "Shanghai EICT Global Service Co., Ltd", "SHANGHAI-EICT-GLOBAL-SERVICE" },
+	{ 0x70B3D5, 0xFCA000, 0xFCAFFF, "M2M Cybernetics Pvt Ltd", "M2M-CYBERNETICS-PVT" },
+	{ 0x70B3D5, 0xFCC000, 0xFCCFFF, "DIgSILENT GmbH", "DIGSILENT" },
+	{ 0x70B3D5, 0xFCD000, 0xFCDFFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xFCF000, 0xFCFFFF, "Acc+Ess Ltd", "ACC+ESS" },
+	{ 0x70B3D5, 0xFD1000, 0xFD1FFF, "RedRat Ltd", "REDRAT" },
+	{ 0x70B3D5, 0xFD2000, 0xFD2FFF, "DALIAN LEVEAR ELECTRIC CO., LTD", "DALIAN-LEVEAR-ELECTRIC" },
+	{ 0x70B3D5, 0xFD3000, 0xFD3FFF, "AKIS technologies", "AKIS-TECHNOLOGIES" },
+	{ 0x70B3D5, 0xFD6000, 0xFD6FFF, "Visual Fan", "VISUAL-FAN" },
+	{ 0x70B3D5, 0xFD7000, 0xFD7FFF, "Centum Adetel Group", "CENTUM-ADETEL-GROUP" },
+	{ 0x70B3D5, 0xFD8000, 0xFD8FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
+	{ 0x70B3D5, 0xFDA000, 0xFDAFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
+	{ 0x70B3D5, 0xFDB000, 0xFDBFFF, "Design SHIFT", "DESIGN-SHIFT" },
+	{ 0x70B3D5, 0xFDD000, 0xFDDFFF, "Laser Imagineering Vertriebs GmbH", "LASER-IMAGINEERING-VERTRIEBS" },
+	{ 0x70B3D5, 0xFDE000, 0xFDEFFF, "AERONAUTICAL & GENERAL INSTRUMENTS LTD.", "AERONAUTICAL-GENERAL-INSTRUMENTS" },
+	{ 0x70B3D5, 0xFDF000, 0xFDFFFF, "NARA CONTROLS INC.", "NARA-CONTROLS" },
+	{ 0x70B3D5, 0xFE2000, 0xFE2FFF, "Galileo Tıp Teknolojileri San. ve Tic. A.S.", "GALILEO-TıP-TEKNOLOJILERI-SAN-VE-TIC-A-S" },
+	{ 0x70B3D5, 0xFE3000, 0xFE3FFF, "CSM MACHINERY srl", "CSM-MACHINERY-SRL" },
+	{ 0x70B3D5, 0xFE4000, 0xFE4FFF, "CARE PVT LTD", "CARE-PVT" },
+	{ 0x70B3D5, 0xFE6000, 0xFE6FFF, "SHIZUKI ELECTRIC CO.,INC", "SHIZUKI-ELECTRIC" },
+	{ 0x70B3D5, 0xFE7000, 0xFE7FFF, "VEILUX INC.", "VEILUX" },
+	{ 0x70B3D5, 0xFE8000, 0xFE8FFF, "PCME Ltd.", "PCME" },
+	{ 0x70B3D5, 0xFE9000, 0xFE9FFF, "Camsat Przemysław Gralak", "CAMSAT-PRZEMYSłAW-GRALAK" },
+	{ 0x70B3D5, 0xFEA000, 0xFEAFFF, "Heng Dian Technology Co., Ltd", "HENG-DIAN" },
+	{ 0x70B3D5, 0xFEB000, 0xFEBFFF, "Les distributions Multi-Secure incorporee", "LES-DISTRIBUTIONS-MULTI-SECURE-INCORPOREE" },
+	{ 0x70B3D5, 0xFEC000, 0xFECFFF, "Finder SpA", "FINDER-SPA" },
+	{ 0x70B3D5, 0xFEE000, 0xFEEFFF, "Kawasaki Robot Service,Ltd.", "KAWASAKI-ROBOT-SERVICE" },
+	{ 0x70B3D5, 0xFEF000, 0xFEFFFF, "HANGZHOU HUALAN MICROELECTRONIQUE CO.,LTD", "HANGZHOU-HUALAN-MICROELECTRONIQUE" },
+	{ 0x70B3D5, 0xFF0000, 0xFF0FFF, "E-MetroTel", "E-METROTEL" },
+	{ 0x70B3D5, 0xFF1000, 0xFF1FFF, "Data Strategy Limited", "DATA-STRATEGY" },
+	{ 0x70B3D5, 0xFF3000, 0xFF3FFF, "Aplex Technology Inc.", "APLEX" },
+	{ 0x70B3D5, 0xFF4000, 0xFF4FFF, "Serveron Corporation", "SERVERON" },
+	{ 0x70B3D5, 0xFF5000, 0xFF5FFF, "Prolan Process Control Co.", "PROLAN-PROCESS-CONTROL" },
+	{ 0x70B3D5, 0xFF7000, 0xFF7FFF, "Cybercom AB", "CYBERCOM-AB" },
+	{ 0x70B3D5, 0xFF8000, 0xFF8FFF, "Dutile, Glines and Higgins Corporation", "DUTILE-GLINES-AND-HIGGINS" },
+	{ 0x70B3D5, 0xFF9000, 0xFF9FFF, "InOut Communication Systems", "INOUT-COMMUNICATION" },
+	{ 0x70B3D5, 0xFFC000, 0xFFCFFF, "Symetrics Industries d.b.a. Extant Aerospace", "SYMETRICS-INDUSTRIES-D-B-A-EXTANT-AEROSPACE" },
+	{ 0x70B3D5, 0xFFE000, 0xFFEFFF, "Private", "PRIVATE" },
+	{ 0x70B3D5, 0xFFF000, 0xFFFFFF, "Private", "PRIVATE" },
 
 };
@@ -17,6 +17,10 @@
 
 #include "config.h"
 
+#ifdef SUPPORT_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "libipv6calcdebug.h"
 #include "libipv6calc.h"
 
@@ -27,6 +31,7 @@
 #include "libipv6calc_db_wrapper_IP2Location.h"
 #include "libipv6calc_db_wrapper_DBIP.h"
 #include "libipv6calc_db_wrapper_External.h"
+#include "libipv6calc_db_wrapper_MMAP.h"
 #include "libipv6calc_db_wrapper_BuiltIn.h"
 
 #ifdef DOMAIN
@@ -48,19 +53,59 @@ static int wrapper_GeoIP_disable       = 0;
 static int wrapper_IP2Location_disable = 0;
 static int wrapper_DBIP_disable        = 0;
 static int wrapper_External_disable    = 0;
+static int wrapper_MMAP_disable        = 0;
 static int wrapper_BuiltIn_disable     = 0;
 
 static int wrapper_GeoIP_status = 0;
 static int wrapper_IP2Location_status = 0;
 static int wrapper_DBIP_status = 0;
 static int wrapper_External_status = 0;
+static int wrapper_MMAP_status = 0;
 static int wrapper_BuiltIn_status = 0;
 
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+static int wrapper_bdb_index_enable = 0;
+static s_db_bdb_index wrapper_bdb_index[IPV6CALC_DB_BDB_INDEX_MAX];
+static int wrapper_bdb_index_used = 0;
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+#ifdef SUPPORT_PTHREAD
+// after libipv6calc_db_wrapper_threads_init lookups of features served by a source keeping state (handles of GeoIP/IP2Location/DBIP/External) are serialized
+// BuiltIn and MMAP are read-only, their lookups run in parallel (without last-used caches)
+static int wrapper_threads = 0;
+static uint32_t wrapper_threads_lock_features = 0;
+static pthread_mutex_t wrapper_threads_mutex;
+static pthread_rwlock_t wrapper_trie_rwlock = PTHREAD_RWLOCK_INITIALIZER;
+
+#define DB_WRAPPER_LOCK		if (wrapper_threads == 1) { pthread_mutex_lock(&wrapper_threads_mutex); };
+#define DB_WRAPPER_UNLOCK	if (wrapper_threads == 1) { pthread_mutex_unlock(&wrapper_threads_mutex); };
+#define DB_WRAPPER_LOCK_FEATURES(features)	if ((wrapper_threads == 1) && ((wrapper_threads_lock_features & (features)) != 0)) { pthread_mutex_lock(&wrapper_threads_mutex); };
+#define DB_WRAPPER_UNLOCK_FEATURES(features)	if ((wrapper_threads == 1) && ((wrapper_threads_lock_features & (features)) != 0)) { pthread_mutex_unlock(&wrapper_threads_mutex); };
+// last-used caches are only safe while lookups of the features are serialized
+#define DB_WRAPPER_CACHE_LU(features)		((wrapper_threads == 0) || ((wrapper_threads_lock_features & (features)) != 0))
+#define DB_WRAPPER_TRIE_RDLOCK	if (wrapper_threads == 1) { pthread_rwlock_rdlock(&wrapper_trie_rwlock); };
+#define DB_WRAPPER_TRIE_WRLOCK	if (wrapper_threads == 1) { pthread_rwlock_wrlock(&wrapper_trie_rwlock); };
+#define DB_WRAPPER_TRIE_UNLOCK	if (wrapper_threads == 1) { pthread_rwlock_unlock(&wrapper_trie_rwlock); };
+#else
+#define DB_WRAPPER_LOCK
+#define DB_WRAPPER_UNLOCK
+#define DB_WRAPPER_LOCK_FEATURES(features)
+#define DB_WRAPPER_UNLOCK_FEATURES(features)
+#define DB_WRAPPER_CACHE_LU(features)		(1 == 1)
+#define DB_WRAPPER_TRIE_RDLOCK
+#define DB_WRAPPER_TRIE_WRLOCK
+#define DB_WRAPPER_TRIE_UNLOCK
+#endif // SUPPORT_PTHREAD
+
 uint32_t wrapper_features = 0;
 uint32_t wrapper_features_by_source[IPV6CALC_DB_SOURCE_MAX + 1];
 uint32_t wrapper_features_by_source_implemented[IPV6CALC_DB_SOURCE_MAX + 1];
 
 int wrapper_features_selector[IPV6CALC_DB_FEATURE_NUM_MAX + 1][IPV6CALC_DB_PRIO_MAX];
+
+// selection made by init, saved while a feature is restricted to one source
+static int wrapper_features_selector_saved[IPV6CALC_DB_FEATURE_NUM_MAX + 1][IPV6CALC_DB_PRIO_MAX];
+static int wrapper_features_selector_saved_valid[IPV6CALC_DB_FEATURE_NUM_MAX + 1];
 unsigned int wrapper_source_priority_selector[IPV6CALC_DB_SOURCE_MAX + 1];
 int wrapper_source_priority_selector_by_option = -1; // -1: uninitialized, 0: initialized, > 0: touched by option
 
@@ -74,7 +119,7 @@ int wrapper_source_priority_selector_by_option = -1; // -1: uninitialized, 0: in
 int libipv6calc_db_wrapper_init(const char *prefix_string) {
 	int result = 0, f, p, s, j;
 
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
+#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_BUILTIN
 	int r;
 #endif
 	s = strlen(prefix_string); // make compiler happy (avoid unused "...")
@@ -219,6 +264,25 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 #endif // SUPPORT_EXTERNAL
 	};
 
+	if (wrapper_MMAP_disable != 1) {
+#ifdef SUPPORT_MMAP
+		// Call MMAP wrapper
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_MMAP_wrapper_init");
+
+		r = libipv6calc_db_wrapper_MMAP_wrapper_init();
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "MMAP_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
+
+		if (r != 0) {
+			result = 1;
+		} else {
+			wrapper_MMAP_status = 1; // ok
+		};
+	} else {
+		NONQUIETPRINT_WA("%sSupport for MMAP disabled by option", prefix_string);
+#endif // SUPPORT_MMAP
+	};
+
 
 	if (wrapper_BuiltIn_disable != 1) {
 #ifdef SUPPORT_BUILTIN
@@ -344,7 +408,7 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 int libipv6calc_db_wrapper_cleanup(void) {
 	int result = 0;
 
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
+#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_BUILTIN
 	int r;
 #endif
 
@@ -374,6 +438,14 @@ int libipv6calc_db_wrapper_cleanup(void) {
 	};
 #endif
 
+#ifdef SUPPORT_MMAP
+	// Call MMAP wrapper
+	r = libipv6calc_db_wrapper_MMAP_wrapper_cleanup();
+	if (r != 0) {
+		result = 1;
+	};
+#endif
+
 #ifdef SUPPORT_BUILTIN
 	// Call BuiltIn wrapper
 	r = libipv6calc_db_wrapper_BuiltIn_wrapper_cleanup();
@@ -382,10 +454,124 @@ int libipv6calc_db_wrapper_cleanup(void) {
 	};
 #endif
 
+	// release tries
+	libipv6calc_db_wrapper_trie_free(NULL);
+
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	// release remaining in-memory indexes
+	while (wrapper_bdb_index_used > 0) {
+		libipv6calc_db_wrapper_bdb_index_free(wrapper_bdb_index[0].dbp);
+	};
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+#ifdef SUPPORT_PTHREAD
+	if (wrapper_threads == 1) {
+		wrapper_threads = 0;
+		pthread_mutex_destroy(&wrapper_threads_mutex);
+	};
+#endif // SUPPORT_PTHREAD
+
 	return(result);
 };
 
 
+#ifdef SUPPORT_PTHREAD
+/*
+ * select features to be serialized: served by a source keeping state (all except BuiltIn and MMAP)
+ */
+static void libipv6calc_db_wrapper_threads_lock_features_update(void) {
+	int f, p;
+
+	wrapper_threads_lock_features = 0;
+
+	for (f = IPV6CALC_DB_FEATURE_NUM_MIN; f <= IPV6CALC_DB_FEATURE_NUM_MAX; f++) {
+		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			if ((wrapper_features_selector[f][p] != 0)
+			    && (wrapper_features_selector[f][p] != IPV6CALC_DB_SOURCE_BUILTIN)
+			    && (wrapper_features_selector[f][p] != IPV6CALC_DB_SOURCE_MMAP)
+			) {
+				wrapper_threads_lock_features |= (1 << f);
+			};
+		};
+	};
+
+	if (wrapper_GeoIP_status == 1) {
+		// AS number is retrieved always from GeoIP (see libipv6calc_db_wrapper_as_text_by_addr)
+		wrapper_threads_lock_features |= IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Serialized features: 0x%08x", (unsigned int) wrapper_threads_lock_features);
+};
+#endif // SUPPORT_PTHREAD
+
+
+/*
+ * function enable thread-safe lookups (serialized for features served by a source keeping state), has to be called before starting threads
+ *
+ * in : (nothing)
+ * out: 0=ok, 1=error (not supported)
+ */
+int libipv6calc_db_wrapper_threads_init(void) {
+#ifdef SUPPORT_PTHREAD
+	pthread_mutexattr_t attr;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_threads == 1) {
+		return(0);
+	};
+
+	// recursive: abstract functions call each other
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	if (pthread_mutex_init(&wrapper_threads_mutex, &attr) != 0) {
+		pthread_mutexattr_destroy(&attr);
+		return(1);
+	};
+	pthread_mutexattr_destroy(&attr);
+
+	libipv6calc_db_wrapper_threads_lock_features_update();
+
+	wrapper_threads = 1;
+	return(0);
+#else
+	return(1);
+#endif // SUPPORT_PTHREAD
+};
+
+
+/*
+ * function reset info regarding used databases (e.g. per processed address)
+ */
+void libipv6calc_db_wrapper_db_info_used_reset(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+#ifdef SUPPORT_GEOIP
+	libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used_reset();
+#endif
+
+#ifdef SUPPORT_IP2LOCATION
+	libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_reset();
+#endif
+
+#ifdef SUPPORT_DBIP
+	libipv6calc_db_wrapper_DBIP_wrapper_db_info_used_reset();
+#endif
+
+#ifdef SUPPORT_EXTERNAL
+	libipv6calc_db_wrapper_External_wrapper_db_info_used_reset();
+#endif
+
+#ifdef SUPPORT_MMAP
+	libipv6calc_db_wrapper_MMAP_wrapper_db_info_used_reset();
+#endif
+
+#ifdef SUPPORT_BUILTIN
+	libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_reset();
+#endif
+};
+
+
 /* function get info strings */
 void libipv6calc_db_wrapper_info(char *string, const size_t size) {
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
@@ -444,7 +630,7 @@ void libipv6calc_db_wrapper_features(char *string, const size_t size) {
 
 /* function get capability string */
 void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
+#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_BUILTIN
 	char tempstring[NI_MAXHOST];
 #endif
 
@@ -498,6 +684,13 @@ void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
 #endif
 	};
 
+	if (wrapper_MMAP_disable != 1) {
+#ifdef SUPPORT_MMAP
+		snprintf(tempstring, sizeof(tempstring), "%s%sMMAP", string, strlen(string) > 0 ? " " : "");
+		snprintf(string, size, "%s", tempstring);
+#endif
+	};
+
 	if (wrapper_BuiltIn_disable != 1) {
 #ifdef SUPPORT_BUILTIN
 		snprintf(tempstring, sizeof(tempstring), "%s%sDB_AS_REG(BuiltIn)", string, strlen(string) > 0 ? " " : "");
@@ -640,6 +833,16 @@ void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *p
 	fprintf(stderr, "\n");
 #endif
 
+#ifdef SUPPORT_MMAP
+	if (wrapper_MMAP_disable != 1) {
+		// Call MMAP wrapper
+		libipv6calc_db_wrapper_MMAP_wrapper_print_db_info(level_verbose, prefix_string);
+	} else {
+		fprintf(stderr, "%sMMAP support available but disabled by option\n", prefix_string);
+	};
+	fprintf(stderr, "\n");
+#endif
+
 #ifdef SUPPORT_BUILTIN
 	if (wrapper_BuiltIn_disable != 1) {
 		// Call BuiltIn wrapper
@@ -716,6 +919,58 @@ int libipv6calc_db_wrapper_has_features(uint32_t features) {
 };
 
 
+/*
+ * restrict lookups of a feature to a single source (e.g. to benchmark a source)
+ * in : feature number, source (0: restore selection of init)
+ * ret: 0=ok, 1=source does not provide the feature
+ */
+int libipv6calc_db_wrapper_feature_select_source(const int f, const unsigned int source) {
+	int p, result = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with feature number %d and source %u", f, source);
+
+	if ((f < IPV6CALC_DB_FEATURE_NUM_MIN) || (f > IPV6CALC_DB_FEATURE_NUM_MAX)) {
+		ERRORPRINT_WA("unsupported feature number=%d (FIX CODE)", f);
+		exit(EXIT_FAILURE);
+	};
+
+	DB_WRAPPER_LOCK
+
+	if (source == 0) {
+		if (wrapper_features_selector_saved_valid[f] == 1) {
+			for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+				wrapper_features_selector[f][p] = wrapper_features_selector_saved[f][p];
+			};
+			wrapper_features_selector_saved_valid[f] = 0;
+		};
+		result = 0;
+	} else if ((source <= IPV6CALC_DB_SOURCE_MAX) && ((wrapper_features_by_source[source] & (1 << f)) != 0)) {
+		if (wrapper_features_selector_saved_valid[f] == 0) {
+			for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+				wrapper_features_selector_saved[f][p] = wrapper_features_selector[f][p];
+			};
+			wrapper_features_selector_saved_valid[f] = 1;
+		};
+
+		wrapper_features_selector[f][0] = source;
+		for (p = 1; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			wrapper_features_selector[f][p] = 0;
+		};
+		result = 0;
+	};
+
+#ifdef SUPPORT_PTHREAD
+	if (wrapper_threads == 1) {
+		libipv6calc_db_wrapper_threads_lock_features_update();
+	};
+#endif // SUPPORT_PTHREAD
+
+	DB_WRAPPER_UNLOCK
+
+	return(result);
+};
+
+
 /*********************************************
  * Option handling
  * return < 0: error
@@ -755,6 +1010,11 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_mmap_disable:
+			wrapper_MMAP_disable = 1;
+			result = 0;
+			break;
+
 		case DB_builtin_disable:
 			wrapper_BuiltIn_disable = 1;
 			result = 0;
@@ -842,6 +1102,15 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_mmap_dir:
+#ifdef SUPPORT_MMAP
+			result = snprintf(mmap_db_dir, sizeof(mmap_db_dir), "%s", optarg);
+#else
+			NONQUIETPRINT_WA("Support for MMAP not compiled-in, skipping option: --%s", ipv6calcoption_name(opt, longopts));
+#endif
+			result = 0;
+			break;
+
 		/* obsolete options */
 		case DB_ip2location_ipv4:
 		case DB_ip2location_ipv6:
@@ -907,8 +1176,26 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_ip2location_disable_native:
+#ifdef SUPPORT_IP2LOCATION
+			ip2location_db_native = 0;
+#else
+			NONQUIETPRINT_WA("Support for IP2Location not compiled-in, skipping option: --%s", ipv6calcoption_name(opt, longopts));
+#endif
+			result = 0;
+			break;
+
+		case DB_common_bdb_index:
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+			wrapper_bdb_index_enable = 1;
+#else
+			NONQUIETPRINT_WA("Support for Berkeley DB not compiled-in, skipping option: --%s", ipv6calcoption_name(opt, longopts));
+#endif
+			result = 0;
+			break;
+
 		case DB_common_priorization:
-#if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Parse database priorization string: %s", optarg);
 			char tempstring[NI_MAXHOST];
 			char *token, *cptr, **ptrptr;
@@ -981,20 +1268,42 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 /*
  * get registry number by AS number
  */
-int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
+static int libipv6calc_db_wrapper_registry_num_by_as_num32_unlocked(const uint32_t as_num32) {
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_as_num32(as_num32));
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
+	int result;
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_AS_TO_REGISTRY)
+	result = libipv6calc_db_wrapper_registry_num_by_as_num32_unlocked(as_num32);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_AS_TO_REGISTRY)
+
+	return(result);
+};
+
 
 /*
  * get registry number by CC index
  */
-int libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_t cc_index) {
+static int libipv6calc_db_wrapper_registry_num_by_cc_index_unlocked(const uint16_t cc_index) {
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_cc_index(cc_index));
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+int libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_t cc_index) {
+	int result;
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_CC_TO_REGISTRY)
+	result = libipv6calc_db_wrapper_registry_num_by_cc_index_unlocked(cc_index);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_CC_TO_REGISTRY)
+
+	return(result);
+};
+
 /*
  * get registry number by IP address
  */
@@ -1034,20 +1343,135 @@ int libipv6calc_db_wrapper_registry_string_by_ipaddr(const ipv6calc_ipaddr *ipad
 };
 
 
+/*
+ * get CountryCode in text form from one source
+ * in: source, ipaddrp, length
+ * mod: string
+ * return: 0=ok, -1=no result, 1=source not supporting CountryCode
+ */
+static int libipv6calc_db_wrapper_country_code_by_source_unlocked(const unsigned int source, char *string, const int length, const ipv6calc_ipaddr *ipaddrp) {
+	int result = -1;
+
+#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION
+	const char *result_char_ptr = NULL;
+#endif
+#ifdef SUPPORT_IP2LOCATION
+	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
+#endif
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: source=%u proto=%d", source, ipaddrp->proto);
+
+	// clear string
+	snprintf(string, length, "%s", "");
+
+	switch(source) {
+	    case IPV6CALC_DB_SOURCE_GEOIP:
+		if (wrapper_GeoIP_status == 1) {
+#ifdef SUPPORT_GEOIP
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP");
+
+			result_char_ptr = libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_ipaddr(ipaddrp);
+
+			if (result_char_ptr != NULL) {
+				snprintf(string, length, "%s", result_char_ptr);
+				result = 0;
+			} else {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called GeoIP did not return a valid country_code");
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_IP2LOCATION:
+		if (wrapper_IP2Location_status == 1) {
+#ifdef SUPPORT_IP2LOCATION
+			int ret = libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_ipaddr(ipaddrp, string, length);
+			if (ret == 0) {
+				result = 0;
+				break;
+			} else if (ret > 0) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called IP2Location (native) did not return a valid country_code");
+				break;
+			};
+
+			// native reader not usable, need IP address as string
+			libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now IP2Location with %s", tempstring);
+
+			result_char_ptr = libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(tempstring, ipaddrp->proto);
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called IP2Location returned: %s", result_char_ptr);
+
+			if (result_char_ptr != NULL) {
+				snprintf(string, length, "%s", result_char_ptr);
+				result = 0;
+			} else {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called IP2Location did not return a valid country_code");
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_DBIP:
+		if (wrapper_DBIP_status == 1) {
+#ifdef SUPPORT_DBIP
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now DBIP");
+
+			if (libipv6calc_db_wrapper_DBIP_wrapper_country_code_by_addr(ipaddrp, string, length) == 0) {
+				result = 0;
+			} else {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called db-ip.com did not return a valid country_code");
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_EXTERNAL:
+		if (wrapper_External_status == 1) {
+#ifdef SUPPORT_EXTERNAL
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now External");
+
+			if (libipv6calc_db_wrapper_External_country_code_by_addr(ipaddrp, string, length) == 0) {
+				result = 0;
+			} else {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called External did not return a valid country_code");
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_MMAP:
+		if (wrapper_MMAP_status == 1) {
+#ifdef SUPPORT_MMAP
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now MMAP");
+
+			if (libipv6calc_db_wrapper_MMAP_country_code_by_addr(ipaddrp, string, length) == 0) {
+				result = 0;
+			} else {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called MMAP did not return a valid country_code");
+			};
+#endif
+		};
+		break;
+
+	    default:
+		result = 1;
+		break;
+	};
+
+	return(result);
+};
+
+
 /*
  * get CountryCode in text form
  * in: ipaddrp, length
  * mod: string, data_source_ptr (if != NULL)
  * return: 0=ok
  */
-int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+static int libipv6calc_db_wrapper_country_code_by_addr_unlocked(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	unsigned int data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-	int f = 0, p, result = -1;
-
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION
-	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
-	char *result_char_ptr = NULL;
-#endif
+	int f = 0, p, r, result = -1;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
@@ -1084,127 +1508,101 @@ int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length,
 
 	// run through priorities
 	for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION
-		switch(wrapper_features_selector[f][p]) {
-		    case IPV6CALC_DB_SOURCE_GEOIP:
-		    case IPV6CALC_DB_SOURCE_IP2LOCATION:
-			// need IP address as string
-			if (strlen(tempstring) == 0) {
-				libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
-			};
-		};
-#endif
-
-		switch(wrapper_features_selector[f][p]) {
-		    case 0:
+		if (wrapper_features_selector[f][p] == 0) {
 			// last
 			goto END_libipv6calc_db_wrapper; // ok
-			break;
-
-		    case IPV6CALC_DB_SOURCE_GEOIP:
-			if (wrapper_GeoIP_status == 1) {
-#ifdef SUPPORT_GEOIP
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP with %s", tempstring);
+		};
 
-				result_char_ptr = (char *) libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_addr(tempstring, ipaddrp->proto);
+		r = libipv6calc_db_wrapper_country_code_by_source_unlocked(wrapper_features_selector[f][p], string, length, ipaddrp);
+		if (r == 0) {
+			result = 0;
+			data_source = wrapper_features_selector[f][p];
+			goto END_libipv6calc_db_wrapper; // ok
+		} else if (r > 0) {
+			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
+		};
+	};
 
-				if (result_char_ptr != NULL) {
-					snprintf(string, length, "%s", result_char_ptr);
-					result = 0;
-					data_source = IPV6CALC_DB_SOURCE_GEOIP;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called GeoIP did not return a valid country_code");
-				};
-#endif
-			};
-			break;
+END_libipv6calc_db_wrapper:
+	if (result == 0) {
+		if (data_source_ptr != NULL) {
+			// set data_source if pointer not NULL
+			*data_source_ptr = data_source;
+		};
+	} else {
+		// clear string
+		snprintf(string, length, "%s", "");
+	};
 
-		    case IPV6CALC_DB_SOURCE_IP2LOCATION:
-			if (wrapper_IP2Location_status == 1) {
-#ifdef SUPPORT_IP2LOCATION
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now IP2Location with %s", tempstring);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: %s (data_source=%d)", string, data_source);
 
-				result_char_ptr = libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(tempstring, ipaddrp->proto);
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called IP2Location returned: %s", result_char_ptr);
+	return(result);
+};
 
-				if (result_char_ptr != NULL) {
-					snprintf(string, length, "%s", result_char_ptr);
-					result = 0;
-					data_source = IPV6CALC_DB_SOURCE_IP2LOCATION;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called IP2Location did not return a valid country_code");
-				};
-#endif
-			};
-			break;
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+	int result;
 
-		    case IPV6CALC_DB_SOURCE_DBIP:
-			if (wrapper_DBIP_status == 1) {
-#ifdef SUPPORT_DBIP
-				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now DBIP");
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC)
+	result = libipv6calc_db_wrapper_country_code_by_addr_unlocked(string, length, ipaddrp, data_source_ptr);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC)
 
-				int ret = libipv6calc_db_wrapper_DBIP_wrapper_country_code_by_addr(ipaddrp, string, length);
-				if (ret == 0) {
-					result = 0;
-					data_source = IPV6CALC_DB_SOURCE_DBIP;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called db-ip.com did not return a valid country_code");
-				};
-#endif
-			};
-			break;
+	return(result);
+};
 
-		    case IPV6CALC_DB_SOURCE_EXTERNAL:
-			if (wrapper_External_status == 1) {
-#ifdef SUPPORT_EXTERNAL
-				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now External");
 
-				int ret = libipv6calc_db_wrapper_External_country_code_by_addr(ipaddrp, string, length);
+/*
+ * convert CountryCode in text form into index
+ * in: cc_text
+ * mod: indexp (untouched if cc_text is not a letter/digit combination)
+ * return: 0=ok, -1=invalid
+ */
+static int libipv6calc_db_wrapper_cc_index_by_country_code(const char *cc_text, uint16_t *indexp) {
+	uint8_t c1, c2;
 
-				if (ret == 0) {
-					result = 0;
-					data_source = IPV6CALC_DB_SOURCE_EXTERNAL;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called External did not return a valid country_code");
-				};
-#endif
+	if (strlen(cc_text) == 2) {
+		if (isalpha(cc_text[0]) && isalnum(cc_text[1])) {
+			c1 = toupper(cc_text[0]);
+			if (! (c1 >= 'A' && c1 <= 'Z')) {
+				return(-1); // something wrong
+			};
+			c1 -= 'A';
+
+			c2 = toupper(cc_text[1]);
+			if (c2 >= '0' && c2 <= '9') {
+				c2 -= '0';
+			} else if (c2 >= 'A' && c2 <= 'Z') {
+				c2 -= 'A';
+				c2 += 10;
+			} else {
+				return(-1); // something wrong
 			};
-			break;
 
-		    default:
-			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
-			break;
-		};
-	};
+			*indexp = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
 
-END_libipv6calc_db_wrapper:
-	if (result == 0) {
-		if (data_source_ptr != NULL) {
-			// set data_source if pointer not NULL
-			*data_source_ptr = data_source;
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, *indexp, *indexp, COUNTRYCODE_INDEX_TO_CHAR1(*indexp), COUNTRYCODE_INDEX_TO_CHAR2(*indexp));
+
+			if (*indexp >= COUNTRYCODE_INDEX_MAX) {
+				*indexp = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
+				ERRORPRINT_WA("unexpected index (too high): %d", *indexp);
+				return(-1); // something wrong
+			};
 		};
 	} else {
-		// clear string
-		snprintf(string, length, "%s", "");
+		ERRORPRINT_WA("returned cc_text has not 2 chars: %s", cc_text);
+		return(-1); // something wrong
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: %s (data_source=%d)", string, data_source);
-
-	return(result);
+	return(0);
 };
 
 
 /*
  * get CountryCode in special internal form (index) [A-Z] (26) x [0-9A-Z] (36)
  */
-uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+static uint16_t libipv6calc_db_wrapper_cc_index_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
 	char cc_text[256] = "";
-	uint8_t c1, c2;
 	int r;
 
 	int cache_hit = 0;
@@ -1214,9 +1612,12 @@ uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp,
 	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
 	static int ipaddr_cache_lastused_valid = 0;
 
+	unsigned int data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+	int cache_lu = DB_WRAPPER_CACHE_LU(IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC);
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
-	if ((ipaddr_cache_lastused_valid == 1)
+	if ((cache_lu == 1) && (ipaddr_cache_lastused_valid == 1)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
 	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
@@ -1234,48 +1635,26 @@ uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp,
 		goto END_libipv6calc_db_wrapper_cached;
 	} else {
 		// retrieve always data_source for caching
-		r = libipv6calc_db_wrapper_country_code_by_addr(cc_text, sizeof(cc_text), ipaddrp, &data_source_lastused);
+		r = libipv6calc_db_wrapper_country_code_by_addr(cc_text, sizeof(cc_text), ipaddrp, &data_source);
 		if (r != 0) {
 			goto END_libipv6calc_db_wrapper_cached; // something wrong
 		};
 
-		if (strlen(cc_text) == 2) {
-			if (isalpha(cc_text[0]) && isalnum(cc_text[1])) {
-				c1 = toupper(cc_text[0]);
-				if (! (c1 >= 'A' && c1 <= 'Z')) {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-				c1 -= 'A';
-
-				c2 = toupper(cc_text[1]);
-				if (c2 >= '0' && c2 <= '9') {
-					c2 -= '0';
-				} else if (c2 >= 'A' && c2 <= 'Z') {
-					c2 -= 'A';
-					c2 += 10;
-				} else {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-
-				index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
-
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
+		if (data_source_ptr != NULL) {
+			*data_source_ptr = data_source;
+		};
 
-				if (index >= COUNTRYCODE_INDEX_MAX) {
-					index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
-					ERRORPRINT_WA("unexpected index (too high): %d", index);
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-			};
-		} else {
-			ERRORPRINT_WA("returned cc_text has not 2 chars: %s", cc_text);
+		if (libipv6calc_db_wrapper_cc_index_by_country_code(cc_text, &index) != 0) {
 			goto END_libipv6calc_db_wrapper_cached; // something wrong
 		};
 
-		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
-		cc_index_lastused = index;
-		ipaddr_cache_lastused = *ipaddrp;
+		if (cache_lu == 1) {
+			// store in last used cache
+			ipaddr_cache_lastused_valid = 1;
+			cc_index_lastused = index;
+			data_source_lastused = data_source;
+			ipaddr_cache_lastused = *ipaddrp;
+		};
 	};
 
 END_libipv6calc_db_wrapper_cached:
@@ -1284,6 +1663,17 @@ END_libipv6calc_db_wrapper_cached:
 	return(index);
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+	uint16_t result;
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC)
+	result = libipv6calc_db_wrapper_cc_index_by_addr_unlocked(ipaddrp, data_source_ptr);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC)
+
+	return(result);
+};
+
 
 /*
  * get country code string by index
@@ -1314,10 +1704,6 @@ int libipv6calc_db_wrapper_country_code_by_cc_index(char *string, const int leng
 char *libipv6calc_db_wrapper_as_text_by_addr(const ipv6calc_ipaddr *ipaddrp) {
 	char *result_char_ptr = NULL;
 
-#if defined SUPPORT_GEOIP
-	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
-#endif
-
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%04x%04x%04x%04x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
 	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
@@ -1339,14 +1725,9 @@ char *libipv6calc_db_wrapper_as_text_by_addr(const ipv6calc_ipaddr *ipaddrp) {
 
 	if (wrapper_GeoIP_status == 1) {
 #ifdef SUPPORT_GEOIP
-		// conversion sto string needed for GeoIP
-		if (strlen(tempstring) == 0) {
-			libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
-		};
-
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP with addr=%s proto=%d)", tempstring, ipaddrp->proto);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP with proto=%d", ipaddrp->proto);
 
-		result_char_ptr = libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_addr(tempstring, ipaddrp->proto);
+		result_char_ptr = libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_ipaddr(ipaddrp);
 #endif
 	};
 
@@ -1361,7 +1742,7 @@ END_libipv6calc_db_wrapper:
 /*
  * get AS 32-bit number
  */
-uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+static uint32_t libipv6calc_db_wrapper_as_num32_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp) {
 	char *as_text;
 	char as_number_string[11];  // max: 4294967295 = 10 digits + \0
 	uint32_t as_num32 = ASNUM_AS_UNKNOWN; // default
@@ -1374,6 +1755,8 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp)
 	static uint32_t as_num32_lastused;
 	static int ipaddr_cache_lastused_valid = 0;
 
+	int cache_lu = DB_WRAPPER_CACHE_LU(IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS);
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
 	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
@@ -1393,7 +1776,7 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp)
 		exit(EXIT_FAILURE);
 	};
 
-	if ((ipaddr_cache_lastused_valid == 1)
+	if ((cache_lu == 1) && (ipaddr_cache_lastused_valid == 1)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
 	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
@@ -1431,10 +1814,12 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp)
 			};
 		};
 
-		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
-		as_num32_lastused = as_num32;
-		ipaddr_cache_lastused = *ipaddrp;
+		if (cache_lu == 1) {
+			// store in last used cache
+			ipaddr_cache_lastused_valid = 1;
+			as_num32_lastused = as_num32;
+			ipaddr_cache_lastused = *ipaddrp;
+		};
 	};
 
 END_libipv6calc_db_wrapper:
@@ -1443,6 +1828,17 @@ END_libipv6calc_db_wrapper:
 	return(as_num32);
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint32_t result;
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS)
+	result = libipv6calc_db_wrapper_as_num32_by_addr_unlocked(ipaddrp);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS)
+
+	return(result);
+};
+
 
 /*
  * get AS 16-bit number
@@ -1739,13 +2135,251 @@ int libipv6calc_db_wrapper_registry_string_by_ipv4addr(const ipv6calc_ipv4addr *
 };
 
 
+/* qsort helper */
+static int libipv6calc_db_wrapper_batch_cmp_uint32(const void *a, const void *b) {
+	const uint32_t va = *(const uint32_t *) a;
+	const uint32_t vb = *(const uint32_t *) b;
+
+	return((va > vb) - (va < vb));
+};
+
+
+/*
+ * prepare batch lookup for a list of addresses (e.g. a chunk of log lines)
+ *
+ * addresses are sorted and deduplicated, registries of IPv4 addresses are
+ * resolved per source in priority order like single lookups, by one
+ * merge-join sweep over the database if supported by the source
+ *
+ * in:  ipaddrs = list of addresses, num = number of addresses
+ * mod: batchp = results (owned by caller, see libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr)
+ * ret: number of resolved unique addresses
+ */
+int libipv6calc_db_wrapper_batch_prepare(s_ipv6calc_db_batch *batchp, const ipv6calc_ipaddr *ipaddrs, const int num) {
+	int i, n = 0, p, r, result = 0;
+	int f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_REGISTRY;
+	uint64_t *keys = NULL;
+	int *registry = NULL;
+	char *final = NULL;
+	ipv6calc_ipv4addr ipv4addr;
+
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP
+	ipv6calc_ipaddr ipaddr;
+#endif
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with number of addresses: %d", num);
+
+	batchp->ipv4_num = 0;
+
+	if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY) != 1) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "No support available for IPV6CALC_DB_IPV4_TO_REGISTRY");
+		return(0);
+	};
+
+	if (num > batchp->ipv4_size) {
+		free(batchp->ipv4_keys);
+		free(batchp->ipv4_registry);
+		batchp->ipv4_keys = malloc(sizeof(uint32_t) * num);
+		batchp->ipv4_registry = malloc(sizeof(int) * num);
+		if ((batchp->ipv4_keys == NULL) || (batchp->ipv4_registry == NULL)) {
+			ERRORPRINT_WA("can't allocate memory for batch lookup of addresses: %d", num);
+			exit(EXIT_FAILURE);
+		};
+		batchp->ipv4_size = num;
+	};
+
+	for (i = 0; i < num; i++) {
+		if ((ipaddrs[i].flag_valid == 1) && (ipaddrs[i].proto == IPV6CALC_PROTO_IPV4)) {
+			batchp->ipv4_keys[n++] = ipaddrs[i].addr[0];
+		};
+	};
+
+	if (n == 0) {
+		return(0);
+	};
+
+	// sort and remove duplicates
+	qsort(batchp->ipv4_keys, n, sizeof(uint32_t), libipv6calc_db_wrapper_batch_cmp_uint32);
+
+	for (i = 1, result = 1; i < n; i++) {
+		if (batchp->ipv4_keys[i] != batchp->ipv4_keys[result - 1]) {
+			batchp->ipv4_keys[result++] = batchp->ipv4_keys[i];
+		};
+	};
+
+	keys = malloc(sizeof(uint64_t) * result);
+	registry = malloc(sizeof(int) * result);
+	final = malloc(result);
+	if ((keys == NULL) || (registry == NULL) || (final == NULL)) {
+		ERRORPRINT_WA("can't allocate memory for batch lookup of addresses: %d", result);
+		exit(EXIT_FAILURE);
+	};
+
+	for (i = 0; i < result; i++) {
+		keys[i] = ((uint64_t) batchp->ipv4_keys[i]) << 32;
+		batchp->ipv4_registry[i] = REGISTRY_UNKNOWN;
+		final[i] = 0;
+
+		ipv4addr_clearall(&ipv4addr);
+		ipv4addr_setdword(&ipv4addr, batchp->ipv4_keys[i]);
+		if (libipv6calc_db_wrapper_reserved_string_by_ipv4addr(&ipv4addr) != NULL) {
+			batchp->ipv4_registry[i] = REGISTRY_RESERVED;
+			final[i] = 1;
+		};
+	};
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV4_TO_REGISTRY)
+
+	// run through priorities
+	for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+		switch(wrapper_features_selector[f][p]) {
+		    case 0:
+			// last
+			goto END_libipv6calc_db_wrapper_batch_prepare; // ok
+			break;
+
+		    case IPV6CALC_DB_SOURCE_BUILTIN:
+			if (wrapper_BuiltIn_status == 1) {
+#ifdef SUPPORT_BUILTIN
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now BuiltIn");
+				r = libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(keys, result, registry);
+
+				for (i = 0; i < result; i++) {
+					if (final[i] == 1) {
+						continue;
+					};
+
+					if (r == 0) {
+						batchp->ipv4_registry[i] = registry[i];
+					} else {
+						ipv4addr_clearall(&ipv4addr);
+						ipv4addr_setdword(&ipv4addr, batchp->ipv4_keys[i]);
+						batchp->ipv4_registry[i] = libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(&ipv4addr);
+					};
+				};
+#endif
+			};
+			break;
+
+		    case IPV6CALC_DB_SOURCE_EXTERNAL:
+			if (wrapper_External_status == 1) {
+#ifdef SUPPORT_EXTERNAL
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now External");
+				r = libipv6calc_db_wrapper_External_registry_num_by_ipv4addr_batch(keys, result, registry);
+
+				for (i = 0; i < result; i++) {
+					if (final[i] == 1) {
+						continue;
+					};
+
+					if (r == 0) {
+						batchp->ipv4_registry[i] = registry[i];
+					} else {
+						ipv4addr_clearall(&ipv4addr);
+						ipv4addr_setdword(&ipv4addr, batchp->ipv4_keys[i]);
+						CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+						batchp->ipv4_registry[i] = libipv6calc_db_wrapper_External_registry_num_by_addr(&ipaddr);
+					};
+				};
+#endif
+			};
+			break;
+
+		    case IPV6CALC_DB_SOURCE_MMAP:
+			if (wrapper_MMAP_status == 1) {
+#ifdef SUPPORT_MMAP
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now MMAP");
+				for (i = 0; i < result; i++) {
+					if ((final[i] == 1) || (batchp->ipv4_registry[i] != REGISTRY_UNKNOWN)) {
+						continue;
+					};
+
+					ipv4addr_clearall(&ipv4addr);
+					ipv4addr_setdword(&ipv4addr, batchp->ipv4_keys[i]);
+					CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+					batchp->ipv4_registry[i] = libipv6calc_db_wrapper_MMAP_registry_num_by_addr(&ipaddr);
+					if (batchp->ipv4_registry[i] != REGISTRY_UNKNOWN) {
+						final[i] = 1;
+					};
+				};
+#endif
+			};
+			break;
+
+		    default:
+			goto END_libipv6calc_db_wrapper_batch_prepare; // dummy goto in case no db is enabled
+			break;
+		};
+	};
+
+END_libipv6calc_db_wrapper_batch_prepare:
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV4_TO_REGISTRY)
+
+	free(keys);
+	free(registry);
+	free(final);
+
+	batchp->ipv4_num = result;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Resolved unique addresses: %d", result);
+	return(result);
+};
+
+
+/*
+ * get registry number of an IPv4 address from batch lookup results,
+ * falls back to single lookup if not contained (or anonymized)
+ *
+ * in:  batchp = results of libipv6calc_db_wrapper_batch_prepare (NULL: single lookup)
+ * in:  ipv4addr = IPv4 address structure
+ * out: registry number
+ */
+int libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(const s_ipv6calc_db_batch *batchp, const ipv6calc_ipv4addr *ipv4addrp) {
+	int i_min = 0, i_max, i;
+	uint32_t ipv4;
+
+	if ((batchp == NULL) || (batchp->ipv4_num == 0) || (ipv4addrp->flag_valid != 1) || ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0)) {
+		return(libipv4addr_registry_num_by_addr(ipv4addrp));
+	};
+
+	ipv4 = ipv4addr_getdword(ipv4addrp);
+	i_max = batchp->ipv4_num - 1;
+
+	while (i_min <= i_max) {
+		i = i_min + (i_max - i_min) / 2;
+		if (batchp->ipv4_keys[i] < ipv4) {
+			i_min = i + 1;
+		} else if (batchp->ipv4_keys[i] > ipv4) {
+			i_max = i - 1;
+		} else {
+			return(batchp->ipv4_registry[i]);
+		};
+	};
+
+	return(libipv4addr_registry_num_by_addr(ipv4addrp));
+};
+
+
+/*
+ * free results of batch lookup
+ */
+void libipv6calc_db_wrapper_batch_cleanup(s_ipv6calc_db_batch *batchp) {
+	free(batchp->ipv4_keys);
+	free(batchp->ipv4_registry);
+	batchp->ipv4_keys = NULL;
+	batchp->ipv4_registry = NULL;
+	batchp->ipv4_num = 0;
+	batchp->ipv4_size = 0;
+};
+
+
 /*
  * get registry number of an IPv4 address
  *
  * in:  ipv4addr = IPv4 address structure
  * out: registry number
  */
-int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
+static int libipv6calc_db_wrapper_registry_num_by_ipv4addr_unlocked(const ipv6calc_ipv4addr *ipv4addrp) {
 	int retval = REGISTRY_UNKNOWN, p, f;
 
 	int cache_hit = 0;
@@ -1754,13 +2388,15 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 	static uint32_t cache_lu_ipv4addr_registry_num;
 	static int      cache_lu_ipv4addr_valid = 0;
 
-#if defined SUPPORT_EXTERNAL
+	int cache_lu = DB_WRAPPER_CACHE_LU(IPV6CALC_DB_IPV4_TO_REGISTRY);
+
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP
 	ipv6calc_ipaddr ipaddr;
 #endif
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword(ipv4addrp));
 
-	if ((cache_lu_ipv4addr_valid == 1)
+	if ((cache_lu == 1) && (cache_lu_ipv4addr_valid == 1)
 	    && 	(memcmp(&cache_lu_ipv4addr.in_addr, &ipv4addrp->in_addr, sizeof(struct in_addr)) == 0)
 	) {
 		retval= cache_lu_ipv4addr_registry_num;
@@ -1805,6 +2441,19 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 			};
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MMAP:
+			if ((wrapper_MMAP_status == 1) && (retval == REGISTRY_UNKNOWN)) {
+#ifdef SUPPORT_MMAP
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now MMAP");
+				CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, ipaddr);
+				retval = libipv6calc_db_wrapper_MMAP_registry_num_by_addr(&ipaddr);
+				if (retval != REGISTRY_UNKNOWN) {
+					goto END_libipv6calc_db_wrapper; // ok
+				};
+#endif
+			};
+			break;
+
 		    default:
 			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
 			break;
@@ -1812,10 +2461,12 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 	};
 
 END_libipv6calc_db_wrapper:
-	// store in last used cache
-	cache_lu_ipv4addr_valid = 1;
-	cache_lu_ipv4addr_registry_num = retval;
-	cache_lu_ipv4addr.in_addr = ipv4addrp->in_addr;
+	if (cache_lu == 1) {
+		// store in last used cache
+		cache_lu_ipv4addr_valid = 1;
+		cache_lu_ipv4addr_registry_num = retval;
+		cache_lu_ipv4addr.in_addr = ipv4addrp->in_addr;
+	};
 
 END_libipv6calc_db_wrapper_cached:
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x reg=%d%s"
@@ -1826,6 +2477,17 @@ END_libipv6calc_db_wrapper_cached:
 	return (retval);
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
+	int result;
+
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV4_TO_REGISTRY)
+	result = libipv6calc_db_wrapper_registry_num_by_ipv4addr_unlocked(ipv4addrp);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV4_TO_REGISTRY)
+
+	return(result);
+};
+
 
 /*
  * get registry string of an IPv6 address
@@ -1867,7 +2529,7 @@ int libipv6calc_db_wrapper_registry_string_by_ipv6addr(const ipv6calc_ipv6addr *
  * in:  ipv6addr = IPv6 address structure
  * out: assignment number (-1 = no result)
  */
-int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
+static int libipv6calc_db_wrapper_registry_num_by_ipv6addr_unlocked(const ipv6calc_ipv6addr *ipv6addrp) {
 	int retval = REGISTRY_UNKNOWN, p, f;
 
 	int cache_hit = 0;
@@ -1876,13 +2538,15 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 	static uint32_t cache_lu_ipv6addr_registry_num;
 	static int      cache_lu_ipv6addr_valid = 0;
 
-#if defined SUPPORT_EXTERNAL
+	int cache_lu = DB_WRAPPER_CACHE_LU(IPV6CALC_DB_IPV6_TO_REGISTRY);
+
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP
 	ipv6calc_ipaddr ipaddr;
 #endif
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
 
-	if ((cache_lu_ipv6addr_valid == 1)
+	if ((cache_lu == 1) && (cache_lu_ipv6addr_valid == 1)
 	    && 	(memcmp(&cache_lu_ipv6addr.in6_addr, &ipv6addrp->in6_addr, sizeof(struct in6_addr)) == 0)
 	) {
 		retval= cache_lu_ipv6addr_registry_num;
@@ -1933,6 +2597,19 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 			};
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MMAP:
+			if ((wrapper_MMAP_status == 1) && (retval == REGISTRY_UNKNOWN)) {
+#ifdef SUPPORT_MMAP
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now MMAP");
+				CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
+				retval = libipv6calc_db_wrapper_MMAP_registry_num_by_addr(&ipaddr);
+				if (retval != REGISTRY_UNKNOWN) {
+					goto END_libipv6calc_db_wrapper; // ok
+				};
+#endif
+			};
+			break;
+
 		    default:
 			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
 			break;
@@ -1940,10 +2617,12 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 	};
 
 END_libipv6calc_db_wrapper:
-	// store in last used cache
-	cache_lu_ipv6addr_valid = 1;
-	cache_lu_ipv6addr_registry_num = retval;
-	cache_lu_ipv6addr.in6_addr = ipv6addrp->in6_addr;
+	if (cache_lu == 1) {
+		// store in last used cache
+		cache_lu_ipv6addr_valid = 1;
+		cache_lu_ipv6addr_registry_num = retval;
+		cache_lu_ipv6addr.in6_addr = ipv6addrp->in6_addr;
+	};
 
 END_libipv6calc_db_wrapper_cached:
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x reg=%d%s"
@@ -1957,12 +2636,318 @@ END_libipv6calc_db_wrapper_cached:
 	return (retval);
 };
 
+/* serialized if called from multiple threads and feature is served by a source keeping state */
+int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
+	int result;
 
-/*
- * get info string of an IPv4 address
- *
- * in:  ipv4addr = IPv4 address structure
- * out: *resultstring = Registry string
+	DB_WRAPPER_LOCK_FEATURES(IPV6CALC_DB_IPV6_TO_REGISTRY)
+	result = libipv6calc_db_wrapper_registry_num_by_ipv6addr_unlocked(ipv6addrp);
+	DB_WRAPPER_UNLOCK_FEATURES(IPV6CALC_DB_IPV6_TO_REGISTRY)
+
+	return(result);
+};
+
+
+/* location record of one source, fetched at most once per combined lookup */
+typedef struct {
+	int	status;		// 0: not fetched, 1: found, -1: not found, -2: source has no region/city database
+	char	country[3];	// empty if source keeps CountryCode in a separate database
+	char	city[IPV6CALC_DB_LOOKUP_ALL_CITY_SIZE];
+	char	region[IPV6CALC_DB_LOOKUP_ALL_CITY_SIZE];
+} s_ipv6calc_db_location_record;
+
+
+/*
+ * fetch location record (CountryCode, city, region) of an IP address from region/city database of a source
+ * in: source, ipaddrp
+ * mod: recordp
+ * return: recordp->status
+ */
+static int libipv6calc_db_wrapper_location_record_fetch(const unsigned int source, const ipv6calc_ipaddr *ipaddrp, s_ipv6calc_db_location_record *recordp) {
+	uint32_t feature_city;
+
+#ifdef SUPPORT_IP2LOCATION
+	char tempstring[IPV6CALC_ADDR_STRING_MAX];
+#endif
+
+	if (recordp->status != 0) {
+		// already fetched
+		return(recordp->status);
+	};
+
+	recordp->status = -2;
+	recordp->country[0] = '\0';
+	recordp->city[0] = '\0';
+	recordp->region[0] = '\0';
+
+	feature_city = (ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? IPV6CALC_DB_IPV4_TO_CITY : IPV6CALC_DB_IPV6_TO_CITY;
+
+	if ((source > IPV6CALC_DB_SOURCE_MAX) || ((wrapper_features_by_source[source] & feature_city) == 0)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "source=%u has no region/city database", source);
+		return(recordp->status);
+	};
+
+	switch(source) {
+	    case IPV6CALC_DB_SOURCE_GEOIP:
+		if (wrapper_GeoIP_status == 1) {
+#ifdef SUPPORT_GEOIP
+			// CountryCode is stored in a separate database
+			GeoIPRecord *gir = libipv6calc_db_wrapper_GeoIP_wrapper_record_city_by_ipaddr(ipaddrp);
+			recordp->status = -1;
+			if (gir != NULL) {
+				snprintf(recordp->city, sizeof(recordp->city), "%s", (gir->city != NULL) ? gir->city : "");
+				snprintf(recordp->region, sizeof(recordp->region), "%s", (gir->region != NULL) ? gir->region : "");
+				libipv6calc_db_wrapper_GeoIPRecord_delete(gir);
+				recordp->status = 1;
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_IP2LOCATION:
+		if (wrapper_IP2Location_status == 1) {
+#ifdef SUPPORT_IP2LOCATION
+			IP2LocationRecord *record;
+			int ret = libipv6calc_db_wrapper_IP2Location_wrapper_all_by_ipaddr(ipaddrp, recordp->country, sizeof(recordp->country), recordp->city, sizeof(recordp->city), recordp->region, sizeof(recordp->region));
+			recordp->status = -1;
+			if (ret == 0) {
+				recordp->status = 1;
+				break;
+			} else if (ret > 0) {
+				break;
+			};
+
+			// native reader not usable, need IP address as string
+			libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+
+			record = libipv6calc_db_wrapper_IP2Location_wrapper_record_city_by_addr(tempstring, ipaddrp->proto);
+			if (record != NULL) {
+				if ((record->country_short != NULL) && (strlen(record->country_short) == 2) && (strcmp(record->country_short, "??") != 0)) {
+					snprintf(recordp->country, sizeof(recordp->country), "%s", record->country_short);
+				};
+				snprintf(recordp->city, sizeof(recordp->city), "%s", (record->city != NULL) ? record->city : "");
+				snprintf(recordp->region, sizeof(recordp->region), "%s", (record->region != NULL) ? record->region : "");
+				libipv6calc_db_wrapper_IP2Location_free_record(record);
+				recordp->status = 1;
+			};
+#endif
+		};
+		break;
+
+	    case IPV6CALC_DB_SOURCE_DBIP:
+		if (wrapper_DBIP_status == 1) {
+#ifdef SUPPORT_DBIP
+			DBIP_Record record;
+			recordp->status = -1;
+			if (libipv6calc_db_wrapper_DBIP_all_by_addr(ipaddrp, &record) == 0) {
+				snprintf(recordp->country, sizeof(recordp->country), "%s", record.country);
+				snprintf(recordp->city, sizeof(recordp->city), "%s", (strlen(record.city) > 0) ? record.city : "-");
+				snprintf(recordp->region, sizeof(recordp->region), "%s", (strlen(record.stateprov) > 0) ? record.stateprov : "-");
+				recordp->status = 1;
+			};
+#endif
+		};
+		break;
+
+	    default:
+		break;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: source=%u status=%d country=%s city=%s region=%s", source, recordp->status, recordp->country, recordp->city, recordp->region);
+
+	return(recordp->status);
+};
+
+
+/*
+ * get CountryCode, city and region of an IP address
+ *  each source is searched at most once, CountryCode is taken from the region/city record if the source stores it there
+ * in: ipaddrp, wanted (IPV6CALC_DB_LOOKUP_ALL_CC, IPV6CALC_DB_LOOKUP_ALL_CITY)
+ * mod: resultp
+ */
+static void libipv6calc_db_wrapper_location_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, const uint32_t wanted, s_ipv6calc_db_lookup_all *resultp) {
+	s_ipv6calc_db_location_record location[IPV6CALC_DB_SOURCE_MAX + 1];
+	char cc_text[256];
+	unsigned int source;
+	int f, p, r, reserved;
+
+	for (p = 0; p <= IPV6CALC_DB_SOURCE_MAX; p++) {
+		location[p].status = 0;
+	};
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CC;
+		reserved = ((ipaddrp->typeinfo1 & IPV4_ADDR_RESERVED) != 0) ? 1 : 0;
+	} else {
+		f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CC;
+		reserved = ((ipaddrp->typeinfo1 & IPV6_ADDR_RESERVED) != 0) ? 1 : 0;
+	};
+
+	// reserved address has no country
+	if (((wanted & IPV6CALC_DB_LOOKUP_ALL_CC) != 0) && (reserved == 0)) {
+		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			source = wrapper_features_selector[f][p];
+			if (source == 0) {
+				// last
+				break;
+			};
+
+			if ((libipv6calc_db_wrapper_location_record_fetch(source, ipaddrp, &location[source]) == 1) && (strlen(location[source].country) == 2)) {
+				snprintf(cc_text, sizeof(cc_text), "%s", location[source].country);
+				r = 0;
+			} else {
+				// country database of source
+				r = libipv6calc_db_wrapper_country_code_by_source_unlocked(source, cc_text, sizeof(cc_text), ipaddrp);
+			};
+
+			if (r > 0) {
+				// source not supporting CountryCode
+				break;
+			} else if (r == 0) {
+				if (libipv6calc_db_wrapper_cc_index_by_country_code(cc_text, &resultp->cc_index) == 0) {
+					resultp->cc_data_source = source;
+				};
+				break;
+			};
+		};
+
+		if (resultp->cc_index != COUNTRYCODE_INDEX_UNKNOWN) {
+			resultp->found |= IPV6CALC_DB_LOOKUP_ALL_CC;
+		};
+	};
+
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_CITY) != 0) {
+		f = (ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CITY : IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CITY;
+
+		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			source = wrapper_features_selector[f][p];
+			if (source == 0) {
+				// last
+				break;
+			};
+
+			if (libipv6calc_db_wrapper_location_record_fetch(source, ipaddrp, &location[source]) != 1) {
+				continue;
+			};
+
+			if (((strlen(location[source].city) == 0) || (strcmp(location[source].city, "-") == 0)) \
+			  && ((strlen(location[source].region) == 0) || (strcmp(location[source].region, "-") == 0))) {
+				// record of unassigned range
+				continue;
+			};
+
+			snprintf(resultp->city, sizeof(resultp->city), "%s", location[source].city);
+			snprintf(resultp->region, sizeof(resultp->region), "%s", location[source].region);
+			resultp->city_data_source = source;
+			resultp->found |= IPV6CALC_DB_LOOKUP_ALL_CITY;
+			break;
+		};
+	};
+};
+
+
+/*
+ * get CountryCode, AS number, registry and city/region of an IP address in one call
+ *  database lock (if required by wanted features) is taken only once, registry falls back to retrieved AS number/CountryCode
+ *  with city/region wanted, each source is searched only once for CountryCode, city and region
+ * in: ipaddrp, wanted (IPV6CALC_DB_LOOKUP_ALL_*)
+ * mod: resultp
+ * return: 0=ok
+ */
+int libipv6calc_db_wrapper_lookup_all(const ipv6calc_ipaddr *ipaddrp, const uint32_t wanted, s_ipv6calc_db_lookup_all *resultp) {
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	int registry_unknown;
+	uint32_t features = 0;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d wanted=0x%x", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto, wanted);
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		registry_unknown = IPV4_ADDR_REGISTRY_UNKNOWN;
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		registry_unknown = IPV6_ADDR_REGISTRY_UNKNOWN;
+	} else {
+		ERRORPRINT_WA("unsupported proto=%d (FIX CODE)", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+	};
+
+	resultp->found = 0;
+	resultp->cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	resultp->cc_data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+	resultp->as_num32 = ASNUM_AS_UNKNOWN;
+	resultp->registry = registry_unknown;
+	resultp->city[0] = '\0';
+	resultp->region[0] = '\0';
+	resultp->city_data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_CC) != 0) {
+		features |= IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC;
+	};
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_CITY) != 0) {
+		features |= IPV6CALC_DB_IPV4_TO_CITY | IPV6CALC_DB_IPV6_TO_CITY;
+	};
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_AS) != 0) {
+		features |= IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS;
+	};
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_REGISTRY) != 0) {
+		features |= IPV6CALC_DB_IPV4_TO_REGISTRY | IPV6CALC_DB_IPV6_TO_REGISTRY | IPV6CALC_DB_AS_TO_REGISTRY | IPV6CALC_DB_CC_TO_REGISTRY;
+	};
+
+	DB_WRAPPER_LOCK_FEATURES(features)
+
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_CITY) != 0) {
+		// CountryCode from same record as city/region
+		libipv6calc_db_wrapper_location_by_addr_unlocked(ipaddrp, wanted, resultp);
+	} else if ((wanted & IPV6CALC_DB_LOOKUP_ALL_CC) != 0) {
+		resultp->cc_index = libipv6calc_db_wrapper_cc_index_by_addr_unlocked(ipaddrp, &resultp->cc_data_source);
+		if (resultp->cc_index != COUNTRYCODE_INDEX_UNKNOWN) {
+			resultp->found |= IPV6CALC_DB_LOOKUP_ALL_CC;
+		};
+	};
+
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_AS) != 0) {
+		resultp->as_num32 = libipv6calc_db_wrapper_as_num32_by_addr_unlocked(ipaddrp);
+		if (resultp->as_num32 != ASNUM_AS_UNKNOWN) {
+			resultp->found |= IPV6CALC_DB_LOOKUP_ALL_AS;
+		};
+	};
+
+	if ((wanted & IPV6CALC_DB_LOOKUP_ALL_REGISTRY) != 0) {
+		if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+			CONVERT_IPADDRP_IPV4ADDR(ipaddrp, ipv4addr)
+			resultp->registry = libipv6calc_db_wrapper_registry_num_by_ipv4addr_unlocked(&ipv4addr);
+		} else {
+			CONVERT_IPADDRP_IPV6ADDR(ipaddrp, ipv6addr)
+			resultp->registry = libipv6calc_db_wrapper_registry_num_by_ipv6addr_unlocked(&ipv6addr);
+		};
+
+		if (resultp->registry == registry_unknown) {
+			// fallback on already retrieved values
+			if ((resultp->found & IPV6CALC_DB_LOOKUP_ALL_AS) != 0) {
+				resultp->registry = libipv6calc_db_wrapper_registry_num_by_as_num32_unlocked(resultp->as_num32);
+			} else if ((resultp->found & IPV6CALC_DB_LOOKUP_ALL_CC) != 0) {
+				resultp->registry = libipv6calc_db_wrapper_registry_num_by_cc_index_unlocked(resultp->cc_index);
+			};
+		};
+
+		if (resultp->registry != registry_unknown) {
+			resultp->found |= IPV6CALC_DB_LOOKUP_ALL_REGISTRY;
+		};
+	};
+
+	DB_WRAPPER_UNLOCK_FEATURES(features)
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: found=0x%x cc_index=%d as_num32=%u registry=%d city=%s region=%s", resultp->found, resultp->cc_index, resultp->as_num32, resultp->registry, resultp->city, resultp->region);
+
+	return(0);
+};
+
+
+/*
+ * get info string of an IPv4 address
+ *
+ * in:  ipv4addr = IPv4 address structure
+ * out: *resultstring = Registry string
  * ret: 0: ok
  */
 int libipv6calc_db_wrapper_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len) {
@@ -2157,77 +3142,689 @@ int libipv6calc_db_wrapper_bdb_fetch_row(
 		exit(EXIT_FAILURE);
 	};
 
-	if (db_format >= MAXENTRIES_ARRAY(db_format_row)) {
-		ERRORPRINT_WA("unsupported db_format (FIX CODE): %u", db_format);
-		exit(EXIT_FAILURE);
+	if (db_format >= MAXENTRIES_ARRAY(db_format_row)) {
+		ERRORPRINT_WA("unsupported db_format (FIX CODE): %u", db_format);
+		exit(EXIT_FAILURE);
+	};
+
+	char datastring[NI_MAXHOST];
+
+	DBT key, data;
+
+	db_recno_t recno = row;
+
+	memset(&key, 0, sizeof(key));
+	memset(&data, 0, sizeof(data));
+
+	key.data = &recno;
+	key.size = sizeof(recno);
+
+	int ret, value;
+
+	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Try to get row");
+
+	ret = db_ptr->get(db_ptr, NULL, &key, &data, 0);
+
+	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "get executed");
+
+	if (ret != 0) {
+		db_ptr->err(db_ptr, ret, "DB->get");
+		goto END_libipv6calc_db_wrapper_bdb_fetch_row;
+	};
+
+	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Got row");
+
+	snprintf(datastring, (data.size + 1) >= sizeof(datastring) ? sizeof(datastring) : data.size + 1, "%s", (char *) data.data);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "start parsing database row %u: %s (size=%d) data_ptr=%p values=%u format=%s", recno, datastring, data.size, data_ptr, db_format_values[db_format], db_format_row[db_format]);
+
+	if (db_format_values[db_format] == 3) {
+		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_2_00_31_ptr, (char *) data_ptr);
+		*data_1_32_63_ptr = 0;
+		*data_2_32_63_ptr = 0;
+	} else if (db_format_values[db_format] == 4) {
+		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_2_00_31_ptr, &value, (char *) data_ptr);
+		*data_1_32_63_ptr = 0;
+		*data_2_32_63_ptr = 0;
+	} else if (db_format_values[db_format] == 5) {
+		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_1_32_63_ptr, data_2_00_31_ptr, data_2_32_63_ptr, (char *) data_ptr);
+	} else if (db_format_values[db_format] == 6) {
+		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_1_32_63_ptr, data_2_00_31_ptr, data_2_32_63_ptr, &value, (char *) data_ptr);
+	} else {
+		ERRORPRINT_WA("unsupported db_format_values (FIX CODE): %u", db_format_values[db_format]);
+		exit(EXIT_FAILURE);
+	};
+
+	if (ret != db_format_values[db_format]) {
+		ERRORPRINT_WA("row parsing error, corrupted database: %s (ret=%d format=%s expectedvalues=%d)", datastring, ret, db_format_row[db_format], db_format_values[db_format]);
+		goto END_libipv6calc_db_wrapper_bdb_fetch_row;
+	};
+
+	if ((db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x4) \
+	  || (db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x4)) {
+		retval = value; // for Longest Match
+	} else {
+		retval = 0; // ok
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "database row %lu parsed: data_1_00_31=%08x data_1_32_63=%08x data_2_00_31=%08x data_2_32_63=%08x value=%s)", row, *data_1_00_31_ptr, *data_1_32_63_ptr, *data_2_00_31_ptr, *data_2_32_63_ptr, (char *) data_ptr);
+	
+END_libipv6calc_db_wrapper_bdb_fetch_row:
+	return(retval);
+};
+
+
+/*
+ * free in-memory key index of a Berkeley DB (to be called before DB is closed)
+ */
+void libipv6calc_db_wrapper_bdb_index_free(DB *dbp) {
+	int i;
+
+	for (i = 0; i < wrapper_bdb_index_used; i++) {
+		if (wrapper_bdb_index[i].dbp != dbp) {
+			continue;
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Free index of dbp=%p rows=%u", dbp, wrapper_bdb_index[i].num_rows);
+
+		free(wrapper_bdb_index[i].keys);
+		if (wrapper_bdb_index[i].values != NULL) {
+			free(wrapper_bdb_index[i].values);
+		};
+
+		// move last entry into the gap
+		wrapper_bdb_index_used--;
+		wrapper_bdb_index[i] = wrapper_bdb_index[wrapper_bdb_index_used];
+		break;
+	};
+};
+
+
+/*
+ * get in-memory key index of a Berkeley DB, build it on first call
+ * in : DB pointer, DB format, number of rows
+ * ret: pointer to index, NULL if not enabled or not available
+ */
+static s_db_bdb_index *libipv6calc_db_wrapper_bdb_index_get(DB *dbp, const uint8_t db_format, const uint32_t num_rows) {
+	s_db_bdb_index *indexp = NULL;
+	uint32_t first_00_31, first_32_63, last_00_31, last_32_63;
+	char datastring[NI_MAXHOST];
+	uint32_t *k;
+	long int row;
+	int i, ret;
+
+	if (wrapper_bdb_index_enable == 0) {
+		return(NULL);
+	};
+
+	for (i = 0; i < wrapper_bdb_index_used; i++) {
+		if (wrapper_bdb_index[i].dbp == dbp) {
+			indexp = &wrapper_bdb_index[i];
+			if ((indexp->db_format != db_format) || (indexp->num_rows != num_rows)) {
+				// index doesn't fit to request, fallback to direct access
+				return(NULL);
+			};
+			return(indexp);
+		};
+	};
+
+	if (wrapper_bdb_index_used >= IPV6CALC_DB_BDB_INDEX_MAX) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Maximum of indexes reached, no index for dbp=%p", dbp);
+		return(NULL);
+	};
+
+	indexp = &wrapper_bdb_index[wrapper_bdb_index_used];
+	indexp->dbp = dbp;
+	indexp->db_format = db_format;
+	indexp->num_rows = num_rows;
+	indexp->values = NULL;
+
+	switch (db_format) {
+	    case IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_DEC_32x2:
+	    case IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x2:
+	    case IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x2:
+	    case IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_PREFIX_32x2:
+		indexp->key_stride = 2;
+		break;
+
+	    default:
+		indexp->key_stride = 4;
+		break;
+	};
+
+	indexp->keys = malloc(sizeof(uint32_t) * indexp->key_stride * num_rows);
+	if (indexp->keys == NULL) {
+		ERRORPRINT_WA("can't allocate memory for index of database with rows: %u", num_rows);
+		wrapper_bdb_index_enable = 0;
+		return(NULL);
+	};
+
+	if ((db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x2) \
+	  || (db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x4)) {
+		indexp->values = malloc(sizeof(int32_t) * num_rows);
+		if (indexp->values == NULL) {
+			ERRORPRINT_WA("can't allocate memory for index values of database with rows: %u", num_rows);
+			free(indexp->keys);
+			wrapper_bdb_index_enable = 0;
+			return(NULL);
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Build index of dbp=%p format=%u rows=%u", dbp, db_format, num_rows);
+
+	// decode all keys once
+	for (row = 0, k = indexp->keys; row < (long int) num_rows; row++, k += indexp->key_stride) {
+		ret = libipv6calc_db_wrapper_bdb_fetch_row(dbp, db_format, row + 1, &first_00_31, &first_32_63, &last_00_31, &last_32_63, datastring);
+		if (ret < 0) {
+			ERRORPRINT_WA("can't retrieve keys from data for row, no index used: %ld", row);
+			free(indexp->keys);
+			if (indexp->values != NULL) {
+				free(indexp->values);
+			};
+			wrapper_bdb_index_enable = 0;
+			return(NULL);
+		};
+
+		if (indexp->key_stride == 2) {
+			k[0] = first_00_31;
+			k[1] = last_00_31;
+		} else {
+			k[0] = first_00_31;
+			k[1] = first_32_63;
+			k[2] = last_00_31;
+			k[3] = last_32_63;
+		};
+
+		if (indexp->values != NULL) {
+			indexp->values[row] = ret;
+		};
+	};
+
+	wrapper_bdb_index_used++;
+
+	return(indexp);
+};
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+
+/*
+ * prefix trie for base/mask lookups
+ *
+ * each level consumes IPV6CALC_DB_TRIE_STRIDE bits of the 64 bit key, a node
+ * stores only bitmaps: "vector" marks slots with a child (children are stored
+ * contiguous), "leafvec" marks slots where a new run of equal leaf values
+ * starts (leaves are pushed down, so each slot resolves to child or leaf).
+ * Index into children/leaves is found by counting bits (Poptrie style).
+ *
+ * On overlapping prefixes the row with the highest number wins, which is the
+ * result of the sequential search IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST
+ */
+static s_db_trie wrapper_trie[IPV6CALC_DB_TRIE_MAX];
+static int wrapper_trie_used = 0;
+
+// node used during build only
+typedef struct {
+	int32_t row[1 << IPV6CALC_DB_TRIE_STRIDE];	// row of prefix ending in slot (-1: none)
+	int32_t child[1 << IPV6CALC_DB_TRIE_STRIDE];	// index of child node (-1: none)
+} s_db_trie_build_node;
+
+typedef struct {
+	s_db_trie_build_node	*nodes;
+	uint32_t		nodes_num;
+	uint32_t		nodes_size;
+} s_db_trie_build;
+
+
+static int libipv6calc_db_wrapper_trie_popcount(uint64_t v) {
+#ifdef __GNUC__
+	return(__builtin_popcountll(v));
+#else
+	int c;
+	for (c = 0; v != 0; c++) {
+		v &= v - 1;
+	};
+	return(c);
+#endif
+};
+
+
+// slot of key on given depth (key is padded with 0 behind bit 63)
+static unsigned int libipv6calc_db_wrapper_trie_slot(const uint64_t key, const int depth) {
+	int shift = 64 - IPV6CALC_DB_TRIE_STRIDE * (depth + 1);
+
+	if (shift >= 0) {
+		return((key >> shift) & ((1 << IPV6CALC_DB_TRIE_STRIDE) - 1));
+	};
+	return((key << -shift) & ((1 << IPV6CALC_DB_TRIE_STRIDE) - 1));
+};
+
+
+static int32_t libipv6calc_db_wrapper_trie_build_node_new(s_db_trie_build *buildp) {
+	s_db_trie_build_node *p;
+	int i;
+
+	if (buildp->nodes_num == buildp->nodes_size) {
+		buildp->nodes_size = (buildp->nodes_size == 0) ? 1024 : buildp->nodes_size * 2;
+		p = realloc(buildp->nodes, sizeof(s_db_trie_build_node) * buildp->nodes_size);
+		if (p == NULL) {
+			return(-1);
+		};
+		buildp->nodes = p;
+	};
+
+	for (i = 0; i < (1 << IPV6CALC_DB_TRIE_STRIDE); i++) {
+		buildp->nodes[buildp->nodes_num].row[i] = -1;
+		buildp->nodes[buildp->nodes_num].child[i] = -1;
+	};
+
+	return(buildp->nodes_num++);
+};
+
+
+// insert prefix, ret: 0=ok, -1=error
+static int libipv6calc_db_wrapper_trie_build_insert(s_db_trie_build *buildp, const uint64_t base, const int length, const int32_t row) {
+	int32_t node = 0, child;
+	int depth = 0, remain;
+	unsigned int slot, s;
+
+	while (length > IPV6CALC_DB_TRIE_STRIDE * (depth + 1)) {
+		slot = libipv6calc_db_wrapper_trie_slot(base, depth);
+		child = buildp->nodes[node].child[slot];
+		if (child < 0) {
+			child = libipv6calc_db_wrapper_trie_build_node_new(buildp);
+			if (child < 0) {
+				return(-1);
+			};
+			buildp->nodes[node].child[slot] = child;
+		};
+		node = child;
+		depth++;
+	};
+
+	// expand prefix to all slots covered in this node
+	remain = IPV6CALC_DB_TRIE_STRIDE * (depth + 1) - length;
+	slot = libipv6calc_db_wrapper_trie_slot(base, depth) & ~((1u << remain) - 1);
+	for (s = slot; s < slot + (1u << remain); s++) {
+		if (row > buildp->nodes[node].row[s]) {
+			buildp->nodes[node].row[s] = row;
+		};
+	};
+
+	return(0);
+};
+
+
+// convert build node into compressed node, ret: 0=ok, -1=error
+static int libipv6calc_db_wrapper_trie_compile(s_db_trie *triep, const s_db_trie_build *buildp, const int32_t build_node, const uint32_t node, const int32_t inherited) {
+	const s_db_trie_build_node *bp = &buildp->nodes[build_node];
+	int32_t value[1 << IPV6CALC_DB_TRIE_STRIDE];
+	uint64_t vector = 0, leafvec = 0;
+	uint32_t base_leaf, base_node, n;
+	int s, first = 1;
+	int32_t prev = -1;
+	void *p;
+
+	for (s = 0; s < (1 << IPV6CALC_DB_TRIE_STRIDE); s++) {
+		value[s] = (bp->row[s] > inherited) ? bp->row[s] : inherited;
+		if (bp->child[s] >= 0) {
+			vector |= UINT64_C(1) << s;
+		};
+	};
+
+	// leaves, compressed into runs
+	base_leaf = triep->leaves_num;
+	for (s = 0; s < (1 << IPV6CALC_DB_TRIE_STRIDE); s++) {
+		if (bp->child[s] >= 0) {
+			continue;
+		};
+		if ((first == 1) || (value[s] != prev)) {
+			if (triep->leaves_num == triep->leaves_size) {
+				triep->leaves_size = (triep->leaves_size == 0) ? 1024 : triep->leaves_size * 2;
+				p = realloc(triep->leaves, sizeof(int32_t) * triep->leaves_size);
+				if (p == NULL) {
+					return(-1);
+				};
+				triep->leaves = p;
+			};
+			triep->leaves[triep->leaves_num++] = value[s];
+			leafvec |= UINT64_C(1) << s;
+			prev = value[s];
+			first = 0;
+		};
+	};
+
+	// reserve contiguous block of children
+	n = libipv6calc_db_wrapper_trie_popcount(vector);
+	base_node = triep->nodes_num;
+	while (triep->nodes_num + n > triep->nodes_size) {
+		triep->nodes_size = (triep->nodes_size == 0) ? 1024 : triep->nodes_size * 2;
+		p = realloc(triep->nodes, sizeof(s_db_trie_node) * triep->nodes_size);
+		if (p == NULL) {
+			return(-1);
+		};
+		triep->nodes = p;
+	};
+	triep->nodes_num += n;
+
+	triep->nodes[node].vector = vector;
+	triep->nodes[node].leafvec = leafvec;
+	triep->nodes[node].base_leaf = base_leaf;
+	triep->nodes[node].base_node = base_node;
+
+	for (s = 0, n = 0; s < (1 << IPV6CALC_DB_TRIE_STRIDE); s++) {
+		if (bp->child[s] < 0) {
+			continue;
+		};
+		if (libipv6calc_db_wrapper_trie_compile(triep, buildp, bp->child[s], base_node + n, value[s]) != 0) {
+			return(-1);
+		};
+		n++;
+	};
+
+	return(0);
+};
+
+
+/*
+ * build trie from all rows
+ * ret: 0=ok, -1=error or unsupported data (e.g. non-contiguous mask)
+ */
+static int libipv6calc_db_wrapper_trie_build(s_db_trie *triep, const uint8_t data_ptr_type, const uint8_t data_key_format) {
+	uint32_t first_00_31 = 0, first_32_63 = 0, last_00_31 = 0, last_32_63 = 0;
+	uint64_t base, mask;
+	int32_t root_row = -1;
+	s_db_trie_build build;
+	long int row;
+	int ret = -1, result = -1;
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	char datastring[NI_MAXHOST];
+	s_db_bdb_index *bdb_indexp = NULL;
+	const uint32_t *k;
+
+	if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) {
+		bdb_indexp = libipv6calc_db_wrapper_bdb_index_get((DB *) triep->db_ptr, data_key_format, triep->num_rows);
+	};
+#else // HAVE_BERKELEY_DB_SUPPORT
+	if (data_key_format == 0) { }; // make compiler happy (avoid unused "...")
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+	memset(&build, 0, sizeof(build));
+
+	if (libipv6calc_db_wrapper_trie_build_node_new(&build) < 0) {
+		goto END_libipv6calc_db_wrapper_trie_build;
+	};
+
+	for (row = 0; row < (long int) triep->num_rows; row++) {
+		if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY) {
+			ret = triep->get_array_row(row, &first_00_31, &first_32_63, &last_00_31, &last_32_63);
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+		} else if (bdb_indexp != NULL) {
+			k = bdb_indexp->keys + row * bdb_indexp->key_stride;
+			if (bdb_indexp->key_stride == 2) {
+				first_00_31 = k[0];
+				last_00_31  = k[1];
+			} else {
+				first_00_31 = k[0];
+				first_32_63 = k[1];
+				last_00_31  = k[2];
+				last_32_63  = k[3];
+			};
+			ret = 0;
+		} else {
+			ret = libipv6calc_db_wrapper_bdb_fetch_row((DB *) triep->db_ptr, data_key_format, row + 1, &first_00_31, &first_32_63, &last_00_31, &last_32_63, datastring);
+#endif // HAVE_BERKELEY_DB_SUPPORT
+		};
+
+		if (ret < 0) {
+			ERRORPRINT_WA("can't retrieve keys from data for row, no trie used: %ld", row);
+			goto END_libipv6calc_db_wrapper_trie_build;
+		};
+
+		if (triep->data_key_length == 32) {
+			first_32_63 = 0;
+			last_32_63 = 0;
+		};
+
+		base = ((uint64_t) first_00_31 << 32) | first_32_63;
+		mask = ((uint64_t) last_00_31 << 32) | last_32_63;
+
+		if ((~mask & (~mask + 1)) != 0) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "non-contiguous mask in row, no trie used: %ld", row);
+			goto END_libipv6calc_db_wrapper_trie_build;
+		};
+
+		if ((base & ~mask) != 0) {
+			// row can't match any key
+			continue;
+		};
+
+		if (mask == 0) {
+			root_row = row;
+			continue;
+		};
+
+		if (libipv6calc_db_wrapper_trie_build_insert(&build, base, libipv6calc_db_wrapper_trie_popcount(mask), row) != 0) {
+			ERRORPRINT_WA("can't allocate memory for trie of database with rows: %u", triep->num_rows);
+			goto END_libipv6calc_db_wrapper_trie_build;
+		};
+	};
+
+	// root node
+	triep->nodes_size = 1024;
+	triep->nodes = malloc(sizeof(s_db_trie_node) * triep->nodes_size);
+	if (triep->nodes == NULL) {
+		ERRORPRINT_WA("can't allocate memory for trie of database with rows: %u", triep->num_rows);
+		goto END_libipv6calc_db_wrapper_trie_build;
+	};
+	triep->nodes_num = 1;
+
+	if (libipv6calc_db_wrapper_trie_compile(triep, &build, 0, 0, root_row) != 0) {
+		ERRORPRINT_WA("can't allocate memory for trie of database with rows: %u", triep->num_rows);
+		goto END_libipv6calc_db_wrapper_trie_build;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Built trie rows=%u build_nodes=%u nodes=%u leaves=%u", triep->num_rows, build.nodes_num, triep->nodes_num, triep->leaves_num);
+
+	result = 0;
+
+END_libipv6calc_db_wrapper_trie_build:
+	if (build.nodes != NULL) {
+		free(build.nodes);
+	};
+
+	if (result != 0) {
+		if (triep->nodes != NULL) {
+			free(triep->nodes);
+			triep->nodes = NULL;
+		};
+		if (triep->leaves != NULL) {
+			free(triep->leaves);
+			triep->leaves = NULL;
+		};
+	};
+
+	return(result);
+};
+
+
+/*
+ * lookup key in trie
+ * ret: matching row, -1 if no match
+ */
+static long int libipv6calc_db_wrapper_trie_lookup(const s_db_trie *triep, const uint64_t key) {
+	const s_db_trie_node *np = &triep->nodes[0];
+	unsigned int slot;
+	int depth = 0;
+
+	slot = libipv6calc_db_wrapper_trie_slot(key, depth);
+	while ((np->vector & (UINT64_C(1) << slot)) != 0) {
+		np = &triep->nodes[np->base_node + libipv6calc_db_wrapper_trie_popcount(np->vector & ((UINT64_C(2) << slot) - 1)) - 1];
+		depth++;
+		slot = libipv6calc_db_wrapper_trie_slot(key, depth);
+	};
+
+	return(triep->leaves[np->base_leaf + libipv6calc_db_wrapper_trie_popcount(np->leafvec & ((UINT64_C(2) << slot) - 1)) - 1]);
+};
+
+
+/*
+ * free trie(s) of a database (to be called before DB is closed), NULL: all
+ */
+void libipv6calc_db_wrapper_trie_free(const void *db_ptr) {
+	int i = 0;
+
+	DB_WRAPPER_TRIE_WRLOCK
+
+	while (i < wrapper_trie_used) {
+		if ((db_ptr != NULL) && (wrapper_trie[i].db_ptr != db_ptr)) {
+			i++;
+			continue;
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Free trie of db_ptr=%p rows=%u", wrapper_trie[i].db_ptr, wrapper_trie[i].num_rows);
+
+		if (wrapper_trie[i].nodes != NULL) {
+			free(wrapper_trie[i].nodes);
+		};
+		if (wrapper_trie[i].leaves != NULL) {
+			free(wrapper_trie[i].leaves);
+		};
+
+		// move last entry into the gap
+		wrapper_trie_used--;
+		wrapper_trie[i] = wrapper_trie[wrapper_trie_used];
+	};
+
+	DB_WRAPPER_TRIE_UNLOCK
+};
+
+
+/*
+ * find trie entry of a database/array (built or build failed)
+ * ret: pointer to trie entry, NULL if not existing
+ */
+static s_db_trie *libipv6calc_db_wrapper_trie_find(const void *db_ptr, const uint8_t data_key_length, int (*get_array_row)()) {
+	int i;
+
+	for (i = 0; i < wrapper_trie_used; i++) {
+		if ((wrapper_trie[i].db_ptr == db_ptr) && (wrapper_trie[i].get_array_row == get_array_row) && (wrapper_trie[i].data_key_length == data_key_length)) {
+			return(&wrapper_trie[i]);
+		};
 	};
 
-	char datastring[NI_MAXHOST];
+	return(NULL);
+};
 
-	DBT key, data;
 
-	db_recno_t recno = row;
+/*
+ * get trie of a database/array, build it on first call
+ * ret: pointer to trie, NULL if not available
+ */
+static s_db_trie *libipv6calc_db_wrapper_trie_get(void *db_ptr, const uint8_t data_ptr_type, const uint8_t data_key_format, const uint8_t data_key_length, const uint32_t num_rows, int (*get_array_row)()) {
+	s_db_trie *triep;
+
+	triep = libipv6calc_db_wrapper_trie_find(db_ptr, data_key_length, get_array_row);
+	if (triep != NULL) {
+		if ((triep->num_rows != num_rows) || (triep->status != 0)) {
+			// trie doesn't fit to request or build failed, fallback to sequential search
+			return(NULL);
+		};
+		return(triep);
+	};
 
-	memset(&key, 0, sizeof(key));
-	memset(&data, 0, sizeof(data));
+	if (wrapper_trie_used >= IPV6CALC_DB_TRIE_MAX) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Maximum of tries reached, no trie for db_ptr=%p", db_ptr);
+		return(NULL);
+	};
 
-	key.data = &recno;
-	key.size = sizeof(recno);
+	triep = &wrapper_trie[wrapper_trie_used];
+	memset(triep, 0, sizeof(s_db_trie));
+	triep->db_ptr = db_ptr;
+	triep->get_array_row = get_array_row;
+	triep->data_key_length = data_key_length;
+	triep->num_rows = num_rows;
 
-	int ret, value;
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Build trie of db_ptr=%p rows=%u", db_ptr, num_rows);
 
-	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Try to get row");
+	// entry is kept also on failure to avoid retries
+	wrapper_trie_used++;
+	triep->status = libipv6calc_db_wrapper_trie_build(triep, data_ptr_type, data_key_format);
 
-	ret = db_ptr->get(db_ptr, NULL, &key, &data, 0);
+	if (triep->status != 0) {
+		return(NULL);
+	};
 
-	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "get executed");
+	return(triep);
+};
 
-	if (ret != 0) {
-		db_ptr->err(db_ptr, ret, "DB->get");
-		goto END_libipv6calc_db_wrapper_bdb_fetch_row;
-	};
 
-	// DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Got row");
+/*
+ * lookup using prefix trie, fallback to sequential search
+ * return:	 -1 : no lookup result
+ * 		>= 0: matching row
+ */
+static long int libipv6calc_db_wrapper_get_entry_trie(
+	void 		*db_ptr,		// pointer to database in case of IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB, otherwise NULL
+	const uint8_t	data_ptr_type,		// type of data_ptr
+	const uint8_t	data_key_type,		// key type
+	const uint8_t	data_key_format,	// key format
+	const uint8_t	data_key_length,	// key length
+	const uint32_t	data_num_rows,		// number of rows
+	const uint32_t	lookup_key_00_31,	// lookup key MSB
+	const uint32_t	lookup_key_32_63,	// lookup key LSB
+	void            *data_ptr,		// pointer to DB data in case of IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB, otherwise NULL
+	int  (*get_array_row)()			// function to get array row
+	) {
 
-	snprintf(datastring, (data.size + 1) >= sizeof(datastring) ? sizeof(datastring) : data.size + 1, "%s", (char *) data.data);
+	s_db_trie *triep = NULL;
+	long int match;
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "start parsing database row %u: %s (size=%d) data_ptr=%p values=%u format=%s", recno, datastring, data.size, data_ptr, db_format_values[db_format], db_format_row[db_format]);
+	if (data_key_type == IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_BASE_MASK) {
+		// tries are shared between threads, build requires exclusive access
+		DB_WRAPPER_TRIE_RDLOCK
+		if (libipv6calc_db_wrapper_trie_find(db_ptr, data_key_length, get_array_row) == NULL) {
+			DB_WRAPPER_TRIE_UNLOCK
+			DB_WRAPPER_TRIE_WRLOCK
+		};
+		triep = libipv6calc_db_wrapper_trie_get(db_ptr, data_ptr_type, data_key_format, data_key_length, data_num_rows, get_array_row);
 
-	if (db_format_values[db_format] == 3) {
-		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_2_00_31_ptr, (char *) data_ptr);
-		*data_1_32_63_ptr = 0;
-		*data_2_32_63_ptr = 0;
-	} else if (db_format_values[db_format] == 4) {
-		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_2_00_31_ptr, &value, (char *) data_ptr);
-		*data_1_32_63_ptr = 0;
-		*data_2_32_63_ptr = 0;
-	} else if (db_format_values[db_format] == 5) {
-		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_1_32_63_ptr, data_2_00_31_ptr, data_2_32_63_ptr, (char *) data_ptr);
-	} else if (db_format_values[db_format] == 6) {
-		ret = sscanf(datastring, db_format_row[db_format], data_1_00_31_ptr, data_1_32_63_ptr, data_2_00_31_ptr, data_2_32_63_ptr, &value, (char *) data_ptr);
-	} else {
-		ERRORPRINT_WA("unsupported db_format_values (FIX CODE): %u", db_format_values[db_format]);
-		exit(EXIT_FAILURE);
+		if (triep == NULL) {
+			DB_WRAPPER_TRIE_UNLOCK
+		};
 	};
 
-	if (ret != db_format_values[db_format]) {
-		ERRORPRINT_WA("row parsing error, corrupted database: %s (ret=%d format=%s expectedvalues=%d)", datastring, ret, db_format_row[db_format], db_format_values[db_format]);
-		goto END_libipv6calc_db_wrapper_bdb_fetch_row;
+	if (triep == NULL) {
+		return(libipv6calc_db_wrapper_get_entry_generic(db_ptr, data_ptr_type, data_key_type, data_key_format, data_key_length, IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST, data_num_rows, lookup_key_00_31, lookup_key_32_63, data_ptr, get_array_row));
 	};
 
-	if ((db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x4) \
-	  || (db_format == IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_WITH_VALUE_32x4)) {
-		retval = value; // for Longest Match
-	} else {
-		retval = 0; // ok
+	match = libipv6calc_db_wrapper_trie_lookup(triep, ((uint64_t) lookup_key_00_31 << 32) | ((data_key_length == 64) ? lookup_key_32_63 : 0));
+	DB_WRAPPER_TRIE_UNLOCK
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Trie lookup %08x:%08x result: %ld", (unsigned int) lookup_key_00_31, (unsigned int) lookup_key_32_63, match);
+
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	if ((match >= 0) && (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB)) {
+		uint32_t value_first_00_31, value_first_32_63, value_last_00_31, value_last_32_63;
+
+		// fetch matching row
+		if (libipv6calc_db_wrapper_bdb_fetch_row(
+			(DB *) db_ptr,		// pointer to DB
+			data_key_format,	// DB format
+			match + 1,		// row number
+			&value_first_00_31,	// data 1 (MSB in case of 64 bits)
+			&value_first_32_63,	// data 1 (LSB in case of 64 bits)
+			&value_last_00_31,	// data 2 (MSB in case of 64 bits)
+			&value_last_32_63,	// data 2 (LSB in case of 64 bits)
+			data_ptr		// pointer to data
+		) < 0) {
+			ERRORPRINT_WA("can't retrieve keys from data for row: %lu", match);
+			exit(EXIT_FAILURE);
+		};
 	};
+#endif // HAVE_BERKELEY_DB_SUPPORT
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "database row %lu parsed: data_1_00_31=%08x data_1_32_63=%08x data_2_00_31=%08x data_2_32_63=%08x value=%s)", row, *data_1_00_31_ptr, *data_1_32_63_ptr, *data_2_00_31_ptr, *data_2_32_63_ptr, (char *) data_ptr);
-	
-END_libipv6calc_db_wrapper_bdb_fetch_row:
-	return(retval);
+	return(match);
 };
-#endif // HAVE_BERKELEY_DB_SUPPORT
 
 
 /*
@@ -2256,6 +3853,8 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 
 #ifdef HAVE_BERKELEY_DB_SUPPORT
 	DB *dbp = NULL;
+	s_db_bdb_index *bdb_indexp = NULL;
+	const uint32_t *k;
 #endif // HAVE_BERKELEY_DB_SUPPORT
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with data_ptr_type=%u data_key_type=%u data_key_format=%u, data_key_length=%u data_num_rows=%u lookup_key_00_31=%08lx lookup_key_32_63=%08lx db_ptr=%p, data_ptr=%p",
@@ -2308,6 +3907,9 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 
 		// supported
 		dbp = (DB *) db_ptr; // map db_ptr to DB ptr
+
+		// in-memory key index (if enabled)
+		bdb_indexp = libipv6calc_db_wrapper_bdb_index_get(dbp, data_key_format, data_num_rows);
 		break;
 #endif // HAVE_BERKELEY_DB_SUPPORT
 
@@ -2336,6 +3938,9 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 		// supported
 		break;
 
+	    case IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_TRIE:
+		return(libipv6calc_db_wrapper_get_entry_trie(db_ptr, data_ptr_type, data_key_type, data_key_format, data_key_length, data_num_rows, lookup_key_00_31, lookup_key_32_63, data_ptr, get_array_row));
+
 	    default:
 		ERRORPRINT_WA("unsupported data_search_type (FIX CODE): %d", data_search_type);
 		exit(EXIT_FAILURE);
@@ -2371,8 +3976,8 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 		i = i_max / 2;
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Start binary search over entries: data_num_rows=%u", data_num_rows);
 	} else if (data_search_type == IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST) {
-		// sequential search in provided data
-		i_old = i_max;
+		// sequential search in provided data (loop ends after last entry)
+		i_old = data_num_rows;
 		i = 0;
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Start sequential search over entries: data_num_rows=%u", data_num_rows);
 	};
@@ -2392,6 +3997,19 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 				exit(EXIT_FAILURE);
 			};	
 #ifdef HAVE_BERKELEY_DB_SUPPORT	
+		} else if ((data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) && (bdb_indexp != NULL)) {
+			// keys from in-memory index, data row is fetched after match
+			k = bdb_indexp->keys + i * bdb_indexp->key_stride;
+			if (bdb_indexp->key_stride == 2) {
+				value_first_00_31 = k[0];
+				value_last_00_31  = k[1];
+			} else {
+				value_first_00_31 = k[0];
+				value_first_32_63 = k[1];
+				value_last_00_31  = k[2];
+				value_last_32_63  = k[3];
+			};
+			ret = (bdb_indexp->values != NULL) ? bdb_indexp->values[i] : 0;
 		} else if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) {
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Try to get row from Berkeley DB dbp=%p row=%ld", dbp, i + 1);
 			ret = libipv6calc_db_wrapper_bdb_fetch_row(
@@ -2630,6 +4248,23 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 			if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY) {
 				// currently nothing to do
 #ifdef HAVE_BERKELEY_DB_SUPPORT
+			} else if ((data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) && (bdb_indexp != NULL)) {
+				// fetch matching row (keys were taken from index)
+				ret = libipv6calc_db_wrapper_bdb_fetch_row(
+					dbp,			// pointer to DB
+					data_key_format,	// DB format
+					match + 1,		// row number
+					&value_first_00_31,	// data 1 (MSB in case of 64 bits)
+					&value_first_32_63,	// data 1 (LSB in case of 64 bits)
+					&value_last_00_31,	// data 2 (MSB in case of 64 bits)
+					&value_last_32_63,	// data 2 (LSB in case of 64 bits)
+					data_ptr		// pointer to data
+				);
+
+				if (ret < 0) {
+					ERRORPRINT_WA("can't retrieve keys from data for row: %lu", match);
+					exit(EXIT_FAILURE);
+				};
 			} else if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) {
 				// currently nothing to do
 #endif // HAVE_BERKELEY_DB_SUPPORT
@@ -2674,6 +4309,195 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 };
 
 
+/*
+ * get keys of a row as 64-bit values (32-bit keys are stored in the upper half)
+ */
+static void libipv6calc_db_wrapper_get_row_keys_batch(
+	void		*db_ptr,
+	const void	*index_ptr,
+	const uint8_t	data_ptr_type,
+	const uint8_t	data_key_format,
+	const uint8_t	data_key_length,
+	const long int	row,
+	uint64_t	*first_p,
+	uint64_t	*last_p,
+	int  (*get_array_row)()
+	) {
+
+	uint32_t value_first_00_31 = 0, value_last_00_31 = 0;
+	uint32_t value_first_32_63 = 0, value_last_32_63 = 0;
+
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	const s_db_bdb_index *bdb_indexp = (const s_db_bdb_index *) index_ptr;
+	const uint32_t *k;
+	char datastring[NI_MAXHOST];
+#else // HAVE_BERKELEY_DB_SUPPORT
+	if (db_ptr == NULL) { }; // make compiler happy (avoid unused "...")
+	if (index_ptr == NULL) { }; // make compiler happy (avoid unused "...")
+	if (data_key_format == 0) { }; // make compiler happy (avoid unused "...")
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+	if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY) {
+		if (get_array_row(row, &value_first_00_31, &value_first_32_63, &value_last_00_31, &value_last_32_63) < 0) {
+			ERRORPRINT_WA("can't retrieve keys from array for row: %ld", row);
+			exit(EXIT_FAILURE);
+		};
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	} else if ((data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) && (bdb_indexp != NULL)) {
+		k = bdb_indexp->keys + row * bdb_indexp->key_stride;
+		if (bdb_indexp->key_stride == 2) {
+			value_first_00_31 = k[0];
+			value_last_00_31  = k[1];
+		} else {
+			value_first_00_31 = k[0];
+			value_first_32_63 = k[1];
+			value_last_00_31  = k[2];
+			value_last_32_63  = k[3];
+		};
+	} else if (data_ptr_type == IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB) {
+		if (libipv6calc_db_wrapper_bdb_fetch_row(
+			(DB *) db_ptr,		// pointer to DB
+			data_key_format,	// DB format
+			row + 1,		// row number
+			&value_first_00_31,	// data 1 (MSB in case of 64 bits)
+			&value_first_32_63,	// data 1 (LSB in case of 64 bits)
+			&value_last_00_31,	// data 2 (MSB in case of 64 bits)
+			&value_last_32_63,	// data 2 (LSB in case of 64 bits)
+			datastring		// pointer to data
+		) < 0) {
+			ERRORPRINT_WA("can't retrieve keys from data for row: %ld", row);
+			exit(EXIT_FAILURE);
+		};
+#endif // HAVE_BERKELEY_DB_SUPPORT
+	};
+
+	if (data_key_length == 32) {
+		value_first_32_63 = 0;
+		value_last_32_63  = 0;
+	};
+
+	*first_p = (((uint64_t) value_first_00_31) << 32) | value_first_32_63;
+	*last_p  = (((uint64_t) value_last_00_31)  << 32) | value_last_32_63;
+};
+
+
+/*
+ * generic internal/external database batch lookup function
+ *
+ * lookup keys have to be sorted ascending, rows are sorted by first key and
+ * don't overlap, so one merge-join sweep (galloping forward) resolves all keys
+ *
+ * lookup keys: 64-bit values, MSB = lookup_key_00_31, LSB = lookup_key_32_63
+ * result:	matches[] filled (-1: no lookup result, >= 0: matching row)
+ * return:	  0 : ok
+ * 		 -1 : not supported by database, single lookups required
+ */
+int libipv6calc_db_wrapper_get_entry_generic_batch(
+	void 		*db_ptr,		// pointer to database in case of IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB, otherwise NULL
+	const uint8_t	data_ptr_type,		// type of data_ptr
+	const uint8_t	data_key_type,		// key type
+	const uint8_t	data_key_format,	// key format
+	const uint8_t	data_key_length,	// key length
+	const uint32_t	data_num_rows,		// number of rows
+	const uint64_t	*lookup_keys,		// sorted lookup keys
+	const int	lookup_num,		// number of lookup keys
+	long int	*matches,		// matching rows
+	int  (*get_array_row)()			// function to get array row
+	) {
+
+	const void *index_ptr = NULL;
+	long int row = 0, step, row_min, row_max, row_mid;
+	uint64_t first, last;
+	int l;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with data_ptr_type=%u data_key_type=%u data_key_format=%u, data_key_length=%u data_num_rows=%u lookup_num=%d db_ptr=%p",
+		data_ptr_type,
+		data_key_type,
+		data_key_format,
+		data_key_length,
+		data_num_rows,
+		lookup_num,
+		db_ptr
+	);
+
+	if ((data_num_rows < 1) || (data_num_rows > INT32_MAX)) {
+		ERRORPRINT_WA("unsupported data_key_num_rows (FIX CODE): %u", data_num_rows);
+		exit(EXIT_FAILURE);
+	};
+
+	if ((data_key_length != 32) && (data_key_length != 64)) {
+		ERRORPRINT_WA("unsupported data_key_length (FIX CODE): %d", data_key_length);
+		exit(EXIT_FAILURE);
+	};
+
+	if (data_key_type != IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST) {
+		// base/mask rows can overlap, no merge-join possible
+		return(-1);
+	};
+
+	switch(data_ptr_type) {
+	    case IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY:
+		if (get_array_row == NULL) {
+			ERRORPRINT_NA("get_array_row function is unexpected NULL (FIX CODE)");
+			exit(EXIT_FAILURE);
+		};
+		break;
+
+#ifdef HAVE_BERKELEY_DB_SUPPORT
+	    case IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB:
+		// keys from in-memory key index if enabled, otherwise rows are fetched while galloping
+		index_ptr = libipv6calc_db_wrapper_bdb_index_get((DB *) db_ptr, data_key_format, data_num_rows);
+		break;
+#endif // HAVE_BERKELEY_DB_SUPPORT
+
+	    default:
+		return(-1);
+	};
+
+	for (l = 0; l < lookup_num; l++) {
+		if ((l > 0) && (lookup_keys[l] < lookup_keys[l - 1])) {
+			ERRORPRINT_WA("lookup keys are not sorted (FIX CODE): %d", l);
+			exit(EXIT_FAILURE);
+		};
+
+		// gallop forward to the last row having first <= key
+		step = 1;
+		while (row + step < (long int) data_num_rows) {
+			libipv6calc_db_wrapper_get_row_keys_batch(db_ptr, index_ptr, data_ptr_type, data_key_format, data_key_length, row + step, &first, &last, get_array_row);
+			if (first > lookup_keys[l]) {
+				break;
+			};
+			row += step;
+			step *= 2;
+		};
+
+		// binary search between last hit and overshoot
+		row_min = row;
+		row_max = (row + step < (long int) data_num_rows) ? row + step : (long int) data_num_rows;
+		while (row_max - row_min > 1) {
+			row_mid = row_min + (row_max - row_min) / 2;
+			libipv6calc_db_wrapper_get_row_keys_batch(db_ptr, index_ptr, data_ptr_type, data_key_format, data_key_length, row_mid, &first, &last, get_array_row);
+			if (first <= lookup_keys[l]) {
+				row_min = row_mid;
+			} else {
+				row_max = row_mid;
+			};
+		};
+		row = row_min;
+
+		libipv6calc_db_wrapper_get_row_keys_batch(db_ptr, index_ptr, data_ptr_type, data_key_format, data_key_length, row, &first, &last, get_array_row);
+		if ((first <= lookup_keys[l]) && (lookup_keys[l] <= last)) {
+			matches[l] = row;
+		} else {
+			matches[l] = -1;
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Finished batch lookup with keys: %d", lookup_num);
+	return(0);
+};
+
+
 /*********** generic function **********************/
 uint16_t libipv6calc_db_cc_to_index(const char *cc_text) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
@@ -2732,6 +4556,15 @@ END_libipv6calc_db_cc_to_index:
 
 /*********** DB CC **********************/
 
+#if COUNTRYCODE_INDEX_MAX >= IPV6CALC_FILTER_DB_CC_BITS
+#error "IPV6CALC_FILTER_DB_CC_BITS too small for COUNTRYCODE_INDEX_MAX"
+#endif
+
+/* bitset by country code index */
+#define FILTER_DB_CC_BIT_TEST(set, index)	(((set)[(index) / 32] & (1u << ((index) % 32))) != 0)
+#define FILTER_DB_CC_BIT_SET(set, index)	(set)[(index) / 32] |= (1u << ((index) % 32))
+
+
 /*
  * parse filter DB CC
  *
@@ -2798,20 +4631,14 @@ int libipv6calc_db_cc_filter_parse(s_ipv6calc_filter_db_cc *filter, const char *
 	};
 
 	if (negate == 1) {
-		if (filter->cc_may_not_have_max < IPV6CALC_FILTER_DB_CC_MAX) {
-			filter->cc_may_not_have[filter->cc_may_not_have_max] = cc_index;
+		if (! FILTER_DB_CC_BIT_TEST(filter->cc_may_not_have, cc_index)) {
+			FILTER_DB_CC_BIT_SET(filter->cc_may_not_have, cc_index);
 			filter->cc_may_not_have_max++;
-		} else {
-			ERRORPRINT_WA("filter token 'cc=' maxmimum reached for 'may not have': %d", filter->cc_may_not_have_max);
-			goto END_ipv6calc_db_cc_filter_parse;
 		};
 	} else {
-		if (filter->cc_must_have_max < IPV6CALC_FILTER_DB_CC_MAX) {
-			filter->cc_must_have[filter->cc_must_have_max] = cc_index;
+		if (! FILTER_DB_CC_BIT_TEST(filter->cc_must_have, cc_index)) {
+			FILTER_DB_CC_BIT_SET(filter->cc_must_have, cc_index);
 			filter->cc_must_have_max++;
-		} else {
-			ERRORPRINT_WA("filter token 'cc=' maxmimum reached for 'must have': %d", filter->cc_must_have_max);
-			goto END_ipv6calc_db_cc_filter_parse;
 		};
 	};
 	filter->active = 1;
@@ -2839,9 +4666,12 @@ int libipv6calc_db_cc_filter_check(const s_ipv6calc_filter_db_cc *filter, const
 
 	if (filter->cc_must_have_max > 0) {
 		tempstring2[0] = '\0';
-		for (i = 0; i < filter->cc_must_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc, sizeof(cc), filter->cc_must_have[i]);
-			snprintf(tempstring, sizeof(tempstring), "%s%s%s", tempstring2, (i > 0) ? " " : "", cc);
+		for (i = 0; i <= COUNTRYCODE_INDEX_MAX; i++) {
+			if (! FILTER_DB_CC_BIT_TEST(filter->cc_must_have, i)) {
+				continue;
+			};
+			libipv6calc_db_wrapper_country_code_by_cc_index(cc, sizeof(cc), i);
+			snprintf(tempstring, sizeof(tempstring), "%s%s%s", tempstring2, (tempstring2[0] != '\0') ? " " : "", cc);
 			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
 		};
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter 'must_have'   : %s", tempstring2);
@@ -2851,9 +4681,12 @@ int libipv6calc_db_cc_filter_check(const s_ipv6calc_filter_db_cc *filter, const
 
 	if (filter->cc_may_not_have_max > 0) {
 		tempstring2[0] = '\0';
-		for (i = 0; i < filter->cc_may_not_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc, sizeof(cc), filter->cc_may_not_have[i]);
-			snprintf(tempstring, sizeof(tempstring), "%s%s%s", tempstring2, (i > 0) ? " " : "", cc);
+		for (i = 0; i <= COUNTRYCODE_INDEX_MAX; i++) {
+			if (! FILTER_DB_CC_BIT_TEST(filter->cc_may_not_have, i)) {
+				continue;
+			};
+			libipv6calc_db_wrapper_country_code_by_cc_index(cc, sizeof(cc), i);
+			snprintf(tempstring, sizeof(tempstring), "%s%s%s", tempstring2, (tempstring2[0] != '\0') ? " " : "", cc);
 			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
 		};
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter 'may_not_have': %s", tempstring2);
@@ -2893,41 +4726,26 @@ END_ipv6calc_db_cc_filter_check:
  * ret: 0=match 1=not match -1=neutral
  */
 int libipv6calc_db_cc_filter(const uint16_t cc_index, const s_ipv6calc_filter_db_cc *filter) {
-	int i, result = -1;
-
-	char cc1[IPV6CALC_COUNTRYCODE_STRING_MAX], cc2[IPV6CALC_COUNTRYCODE_STRING_MAX];
-
-	libipv6calc_db_wrapper_country_code_by_cc_index(cc1, sizeof(cc1), cc_index);
+	int result = -1;
+	const uint16_t index = (cc_index > COUNTRYCODE_INDEX_MAX) ? COUNTRYCODE_INDEX_UNKNOWN : cc_index;
 
 	if (filter->cc_must_have_max > 0) {
-		result = 1;
-
-		for (i = 0; i < filter->cc_must_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter->cc_must_have[i]);
-
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: check %s against must-have: %s", cc1, cc2);
-			if (cc_index == filter->cc_must_have[i]) {
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %s hits must-have: %s", cc1, cc2);
-				// match MUST-HAVE
-				result = 0;
-				break;
-			};
+		if (FILTER_DB_CC_BIT_TEST(filter->cc_must_have, index)) {
+			// match MUST-HAVE
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %u hits must-have", (unsigned int) cc_index);
+			result = 0;
+		} else {
+			result = 1;
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: no must-have defined");
 	};
 
 	if (filter->cc_may_not_have_max > 0) {
-		for (i = 0; i < filter->cc_may_not_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter->cc_may_not_have[i]);
-
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: check %s against may-not-have: %s", cc1, cc2);
-			if (cc_index == filter->cc_may_not_have[i]) {
-				// match MAY-NOT-HAVE
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %s hits may-not-have: %s", cc1, cc2);
-				result = 1;
-				break;
-			};
+		if (FILTER_DB_CC_BIT_TEST(filter->cc_may_not_have, index)) {
+			// match MAY-NOT-HAVE
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %u hits may-not-have", (unsigned int) cc_index);
+			result = 1;
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: no may-not-have defined");
@@ -2947,7 +4765,7 @@ int libipv6calc_db_cc_filter(const uint16_t cc_index, const s_ipv6calc_filter_db
  * ret: 0:found 1:skip 2:problem
  */
 int libipv6calc_db_asn_filter_parse(s_ipv6calc_filter_db_asn *filter, const char *token, const int negate_flag) {
-	int result = 1, negate = negate_flag, offset = 0;
+	int result = 1, negate = negate_flag, offset = 0, r;
 	const char *filter_token = "asn=";
 	const char *prefixdot = "db.";
 
@@ -3001,20 +4819,18 @@ int libipv6calc_db_asn_filter_parse(s_ipv6calc_filter_db_asn *filter, const char
 	};
 
 	if (negate == 1) {
-		if (filter->asn_may_not_have_max < IPV6CALC_FILTER_DB_ASN_MAX) {
-			filter->asn_may_not_have[filter->asn_may_not_have_max] = asn;
-			filter->asn_may_not_have_max++;
-		} else {
-			ERRORPRINT_WA("filter token 'asn=' maxmimum reached for 'may not have': %d", filter->asn_may_not_have_max);
+		r = libasnmap_add(&filter->asn_may_not_have, asn, NULL);
+		if (r < 0) {
 			goto END_ipv6calc_db_asn_filter_parse;
+		} else if (r == 0) {
+			filter->asn_may_not_have_max++;
 		};
 	} else {
-		if (filter->asn_must_have_max < IPV6CALC_FILTER_DB_ASN_MAX) {
-			filter->asn_must_have[filter->asn_must_have_max] = asn;
-			filter->asn_must_have_max++;
-		} else {
-			ERRORPRINT_WA("filter token 'asn=' maxmimum reached for 'must have': %d", filter->asn_must_have_max);
+		r = libasnmap_add(&filter->asn_must_have, asn, NULL);
+		if (r < 0) {
 			goto END_ipv6calc_db_asn_filter_parse;
+		} else if (r == 0) {
+			filter->asn_must_have_max++;
 		};
 	};
 	filter->active = 1;
@@ -3035,27 +4851,14 @@ int libipv6calc_db_asn_filter_check(const s_ipv6calc_filter_db_asn *filter, cons
 	int result = 0, r;
 
 	DEBUGSECTION_BEGIN(DEBUG_libipv6calc_db_wrapper)
-	char tempstring[NI_MAXHOST];
-	char tempstring2[NI_MAXHOST];
-	int i;
 	if (filter->asn_must_have_max > 0) {
-		tempstring2[0] = '\0';
-		for (i = 0; i < filter->asn_must_have_max; i++) {
-			snprintf(tempstring, sizeof(tempstring), "%s%s%u", tempstring2, (i > 0) ? " " : "", filter->asn_must_have[i]);
-			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
-		};
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'must_have'   : %s", tempstring2);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'must_have'   : %d ASNs (hash set slots: %u)", filter->asn_must_have_max, filter->asn_must_have.size);
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'must_have'   : --"); 
 	};
 
 	if (filter->asn_may_not_have_max > 0) {
-		tempstring2[0] = '\0';
-		for (i = 0; i < filter->asn_may_not_have_max; i++) {
-			snprintf(tempstring, sizeof(tempstring), "%s%s%u", tempstring2, (i > 0) ? " " : "", filter->asn_may_not_have[i]);
-			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
-		};
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'may_not_have': %s", tempstring2);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'may_not_have': %d ASNs (hash set slots: %u)", filter->asn_may_not_have_max, filter->asn_may_not_have.size);
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.asn filter 'may_not_have': --"); 
 	};
@@ -3092,31 +4895,25 @@ END_ipv6calc_db_asn_filter_check:
  * ret: 0=match 1=not match -1=neutral
  */
 int libipv6calc_db_asn_filter(const uint32_t asn, const s_ipv6calc_filter_db_asn *filter) {
-	int i, result = -1;
+	int result = -1;
 
 	if (filter->asn_must_have_max > 0) {
-		result = 1;
-
-		for (i = 0; i < filter->asn_must_have_max; i++) {
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: check %u against must-have: %u", asn, filter->asn_must_have[i]);
-			if (asn == filter->asn_must_have[i]) {
-				// match MUST-HAVE
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits must-have: %u", asn, filter->asn_must_have[i]);
-				result = 0;
-			};
+		if (libasnmap_get(&filter->asn_must_have, asn) >= 0) {
+			// match MUST-HAVE
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits must-have", asn);
+			result = 0;
+		} else {
+			result = 1;
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: no must-have defined");
 	};
 
 	if (filter->asn_may_not_have_max > 0) {
-		for (i = 0; i < filter->asn_may_not_have_max; i++) {
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: check %u against must-have: %u", asn, filter->asn_may_not_have[i]);
-			if (asn == filter->asn_may_not_have[i]) {
-				// match MAY-NOT-HAVE
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits may-not-have: %u", asn, filter->asn_may_not_have[i]);
-				result = 1;
-			};
+		if (libasnmap_get(&filter->asn_may_not_have, asn) >= 0) {
+			// match MAY-NOT-HAVE
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits may-not-have", asn);
+			result = 1;
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: no may-not-have defined");
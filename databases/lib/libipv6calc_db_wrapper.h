@@ -17,6 +17,34 @@
 #define _libipv6calc_db_wrapper_h 1
 
 #include "ipv6calctypes.h"
+
+// combined lookup (libipv6calc_db_wrapper_lookup_all)
+#define IPV6CALC_DB_LOOKUP_ALL_CC		0x00000001
+#define IPV6CALC_DB_LOOKUP_ALL_AS		0x00000002
+#define IPV6CALC_DB_LOOKUP_ALL_REGISTRY		0x00000004
+#define IPV6CALC_DB_LOOKUP_ALL_CITY		0x00000008	// city and region
+
+#define IPV6CALC_DB_LOOKUP_ALL_CITY_SIZE	128
+
+typedef struct {
+	uint32_t	found;		// IPV6CALC_DB_LOOKUP_ALL_* with result
+	uint16_t	cc_index;
+	unsigned int	cc_data_source;
+	uint32_t	as_num32;
+	int		registry;
+	char		city[IPV6CALC_DB_LOOKUP_ALL_CITY_SIZE];
+	char		region[IPV6CALC_DB_LOOKUP_ALL_CITY_SIZE];
+	unsigned int	city_data_source;
+} s_ipv6calc_db_lookup_all;
+
+// batch lookup results (libipv6calc_db_wrapper_batch_prepare), owned by caller
+typedef struct {
+	uint32_t	*ipv4_keys;	// sorted unique IPv4 addresses
+	int		*ipv4_registry;	// registry number per IPv4 address
+	int		ipv4_num;	// number of resolved IPv4 addresses
+	int		ipv4_size;	// number of allocated entries
+} s_ipv6calc_db_batch;
+
 #include "libmac.h"
 #include "libipv4addr.h"
 #include "libipv6addr.h"
@@ -89,6 +117,9 @@ extern uint32_t wrapper_features_by_source_implemented[];
 #define IPV6CALC_DB_EXTERNAL_IPV4		0x40000000
 #define IPV6CALC_DB_EXTERNAL_IPV6		0x80000000
 
+#define IPV6CALC_DB_MMAP_IPV4			0x00400000
+#define IPV6CALC_DB_MMAP_IPV6			0x00800000
+
 
 static const s_formatoption ipv6calc_db_features[] = {
 	{ IPV6CALC_DB_GEOIP_IPV4	, "GeoIP"		, "GeoIPv4 database"},
@@ -97,6 +128,8 @@ static const s_formatoption ipv6calc_db_features[] = {
 	{ IPV6CALC_DB_IP2LOCATION_IPV6	, "IP2Location6"	, "IP2Location IPv6 database"},
 	{ IPV6CALC_DB_DBIP_IPV4		, "DBIPv4"		, "db-ip.com IPv4 database"},
 	{ IPV6CALC_DB_DBIP_IPV6		, "DBIPv6"		, "db-ip.com IPv6 database"},
+	{ IPV6CALC_DB_MMAP_IPV4		, "MMAPv4"		, "ipv6calc MMAP IPv4 database"},
+	{ IPV6CALC_DB_MMAP_IPV6		, "MMAPv6"		, "ipv6calc MMAP IPv6 database"},
 	{ IPV6CALC_DB_AS_TO_REGISTRY	, "DB_AS_REG"		, "AS-Number to Registry database"},
 	{ IPV6CALC_DB_IPV4_TO_REGISTRY	, "DB_IPV4_REG"		, "IPv4 to Registry database"},
 	{ IPV6CALC_DB_IPV6_TO_REGISTRY	, "DB_IPV6_REG"		, "IPv6 to Registry database"},
@@ -125,9 +158,10 @@ static const s_formatoption ipv6calc_db_features[] = {
 #define IPV6CALC_DB_SOURCE_IP2LOCATION		2
 #define IPV6CALC_DB_SOURCE_DBIP			3
 #define IPV6CALC_DB_SOURCE_EXTERNAL		4
-#define IPV6CALC_DB_SOURCE_BUILTIN		5
+#define IPV6CALC_DB_SOURCE_MMAP			5
+#define IPV6CALC_DB_SOURCE_BUILTIN		6
 
-#define IPV6CALC_DB_SOURCE_MAX			5
+#define IPV6CALC_DB_SOURCE_MAX			6
 
 #define IPV6CALC_DB_PRIO_MAX			IPV6CALC_DB_SOURCE_MAX
 
@@ -142,6 +176,7 @@ static const s_data_sources data_sources[] = {
 	{ IPV6CALC_DB_SOURCE_IP2LOCATION, "IP2Location", "IP2Location" },
 	{ IPV6CALC_DB_SOURCE_DBIP	, "db-ip.com"  , "DBIP"        },
 	{ IPV6CALC_DB_SOURCE_EXTERNAL	, "External"   , "External"    },
+	{ IPV6CALC_DB_SOURCE_MMAP	, "MMAP"       , "MMAP"        },
 	{ IPV6CALC_DB_SOURCE_BUILTIN	, "BuiltIn"    , "BuiltIn"     },
 };
 
@@ -224,6 +259,32 @@ typedef struct {
 // data search type
 #define IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY	1	 // binary search
 #define IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST	2	 // sequential longest match
+#define IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_TRIE	3	 // longest match by prefix trie (only key type base/mask)
+
+// prefix trie (built on first lookup, 6 bit per level, compressed by bitmaps)
+#define IPV6CALC_DB_TRIE_STRIDE		6
+#define IPV6CALC_DB_TRIE_MAX		16	// max amount of tries
+
+typedef struct {
+	uint64_t	vector;		// slots having a child node
+	uint64_t	leafvec;	// slots starting a new run of leaf values
+	uint32_t	base_leaf;	// index of first leaf of this node
+	uint32_t	base_node;	// index of first child of this node
+} s_db_trie_node;
+
+typedef struct {
+	void		*db_ptr;	// database the trie was built from (IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB)
+	int		(*get_array_row)();	// array the trie was built from (IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
+	uint8_t		data_key_length;	// key length used on build
+	uint32_t	num_rows;	// number of rows
+	int		status;		// 0: usable, -1: build failed (fallback to sequential search)
+	s_db_trie_node	*nodes;
+	uint32_t	nodes_num;
+	uint32_t	nodes_size;
+	int32_t		*leaves;	// matching row (-1: no match)
+	uint32_t	leaves_num;
+	uint32_t	leaves_size;
+} s_db_trie;
 
 // Berkeley DB  lookup function
 #ifdef HAVE_BERKELEY_DB_SUPPORT
@@ -243,6 +304,18 @@ typedef struct {
 	long int db_data_max;
 } s_db_info_data;
 
+// in-memory key index of a Berkeley DB (RECNO row n+1 belongs to index entry n)
+typedef struct {
+	DB		*dbp;		// database the index was built from
+	uint8_t		db_format;	// DB format used on build
+	uint8_t		key_stride;	// 2: first/last 32 bit, 4: first/last 64 bit
+	uint32_t	num_rows;	// number of rows
+	uint32_t	*keys;		// packed keys: first_00_31[,first_32_63],last_00_31[,last_32_63]
+	int32_t		*values;	// row value (only for formats WITH_VALUE, otherwise NULL)
+} s_db_bdb_index;
+
+#define IPV6CALC_DB_BDB_INDEX_MAX	64	// max amount of indexed databases
+
 #endif // HAVE_BERKELEY_DB_SUPPORT
 
 #define IPV6CALC_DB_LIB_VERSION_CHECK_EXIT(version_numeric, version_string) \
@@ -256,7 +329,9 @@ typedef struct {
 
 extern int  libipv6calc_db_wrapper_init(const char *prefix_string);
 extern int  libipv6calc_db_wrapper_cleanup(void);
+extern int  libipv6calc_db_wrapper_threads_init(void);
 extern void libipv6calc_db_wrapper_info(char *string, const size_t size);
+extern void libipv6calc_db_wrapper_db_info_used_reset(void);
 extern void libipv6calc_db_wrapper_features(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_capabilities(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_features_help(void);
@@ -264,6 +339,7 @@ extern void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const
 extern int  libipv6calc_db_wrapper_has_features(uint32_t features);
 extern int  libipv6calc_db_wrapper_options(const int opt, const char *optarg, const struct option longopts[]);
 extern const char *libipv6calc_db_wrapper_get_data_source_name_by_number(const unsigned int number);
+extern int  libipv6calc_db_wrapper_feature_select_source(const int f, const unsigned int source);
 
 
 /* functional wrappers */
@@ -287,6 +363,9 @@ extern int         libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_
 extern int         libipv6calc_db_wrapper_registry_num_by_ipaddr(const ipv6calc_ipaddr *ipaddrp);
 extern int         libipv6calc_db_wrapper_registry_string_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *resultstring, const size_t resultstring_length);
 
+// CountryCode/AS/Registry/City in one call
+extern int         libipv6calc_db_wrapper_lookup_all(const ipv6calc_ipaddr *ipaddrp, const uint32_t wanted, s_ipv6calc_db_lookup_all *resultp);
+
 // IEEE
 extern int libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(char *resultstring, const size_t resultstring_length, const ipv6calc_macaddr *macaddrp);
 extern int libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(char *resultstring, const size_t resultstring_length, const ipv6calc_macaddr *macaddrp);
@@ -304,8 +383,12 @@ extern int libipv6calc_db_wrapper_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6
 
 #ifdef HAVE_BERKELEY_DB_SUPPORT
 extern int libipv6calc_db_wrapper_bdb_get_data_by_key(DB *dbp, char *token, char *value, const size_t value_size);
+extern void libipv6calc_db_wrapper_bdb_index_free(DB *dbp);
+extern int libipv6calc_db_wrapper_bdb_fetch_row(DB *db_ptr, const uint8_t db_format, const long int row, uint32_t *data_1_00_31_ptr, uint32_t *data_1_32_63_ptr, uint32_t *data_2_00_31_ptr, uint32_t *data_2_32_63_ptr, void *data_ptr);
 #endif // HAVE_BERKELEY_DB_SUPPORT
 
+extern void libipv6calc_db_wrapper_trie_free(const void *db_ptr);
+
 // generic DB lookup
 extern long int libipv6calc_db_wrapper_get_entry_generic(
 	void 		*db_ptr,		// pointer to database in case of IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB, otherwise NULL
@@ -321,6 +404,25 @@ extern long int libipv6calc_db_wrapper_get_entry_generic(
 	int  (*get_array_row)()			// function to get array row
 	);
 
+// generic DB batch lookup (sorted keys, merge-join)
+extern int libipv6calc_db_wrapper_get_entry_generic_batch(
+	void 		*db_ptr,		// pointer to database in case of IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB, otherwise NULL
+	const uint8_t	data_ptr_type,		// type of data_ptr
+	const uint8_t	data_key_type,		// key type
+	const uint8_t   data_key_format,        // key format
+	const uint8_t	data_key_length,	// key length
+	const uint32_t	data_num_rows,		// number of rows
+	const uint64_t	*lookup_keys,		// sorted lookup keys
+	const int	lookup_num,		// number of lookup keys
+	long int	*matches,		// matching rows
+	int  (*get_array_row)()			// function to get array row
+	);
+
+// batch lookup of a list of addresses
+extern int  libipv6calc_db_wrapper_batch_prepare(s_ipv6calc_db_batch *batchp, const ipv6calc_ipaddr *ipaddrs, const int num);
+extern int  libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(const s_ipv6calc_db_batch *batchp, const ipv6calc_ipv4addr *ipv4addrp);
+extern void libipv6calc_db_wrapper_batch_cleanup(s_ipv6calc_db_batch *batchp);
+
 /* filter powered by database */
 extern int libipv6calc_db_cc_filter_parse(s_ipv6calc_filter_db_cc *filter, const char *token, const int negate_flag);
 extern int libipv6calc_db_cc_filter_check(const s_ipv6calc_filter_db_cc *filter, const int proto);
@@ -52,13 +52,13 @@ static int builtin_ieee       = 0;
 
 #endif
 
-/* database usage map */
+/* database usage map (tagged by lookups running in parallel without lock, see libipv6calc_db_wrapper_threads_init) */
 #define BUILTIN_DB_MAX_BLOCKS_32	2	// 0-63
 static uint32_t builtin_db_usage_map[BUILTIN_DB_MAX_BLOCKS_32];
 
 #define BUILTIN_DB_USAGE_MAP_TAG(db)	if (db < (32 * BUILTIN_DB_MAX_BLOCKS_32)) { \
 							DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Tag usage for db: %d", db); \
-							builtin_db_usage_map[db / 32] |= 1 << (db % 32); \
+							__atomic_fetch_or(&builtin_db_usage_map[db / 32], (uint32_t) 1 << (db % 32), __ATOMIC_RELAXED); \
 						} else { \
 							fprintf(stderr, "FIXME: unsupported db value (exceed limit): %d (%d)\n", db, 32 * BUILTIN_DB_MAX_BLOCKS_32 - 1); \
 							exit(1); \
@@ -305,6 +305,15 @@ char *libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_reset(void) {
+	memset(builtin_db_usage_map, 0, sizeof(builtin_db_usage_map));
+	builtin_db_usage_string[0] = '\0';
+};
+
+
 /*********************************************
  * Abstract functions
  * *******************************************/
@@ -440,6 +449,153 @@ END_libipv6calc_db_wrapper:
 };
 
 
+#ifdef SUPPORT_DB_IEEE
+/*
+ * IEEE tables are sorted by the header generators (id, subid_begin),
+ * checked once on first lookup, linear search is used as fallback
+ */
+static int builtin_ieee_sorted = -1;	// -1=not checked, 0=unsorted, 1=sorted
+
+static void libipv6calc_db_wrapper_BuiltIn_ieee_check_sorted(void) {
+	int i;
+
+	builtin_ieee_sorted = 1;
+
+	for (i = 1; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
+		if (libieee_oui[i - 1].id >= libieee_oui[i].id) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "OUI table not sorted at row: %d", i);
+			builtin_ieee_sorted = 0;
+			return;
+		};
+	};
+
+	for (i = 1; i < MAXENTRIES_ARRAY(libieee_oui36); i++) {
+		if ((libieee_oui36[i - 1].id > libieee_oui36[i].id) || ((libieee_oui36[i - 1].id == libieee_oui36[i].id) && (libieee_oui36[i - 1].subid_end >= libieee_oui36[i].subid_begin))) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "OUI36 table not sorted at row: %d", i);
+			builtin_ieee_sorted = 0;
+			return;
+		};
+	};
+
+	for (i = 1; i < MAXENTRIES_ARRAY(libieee_iab); i++) {
+		if ((libieee_iab[i - 1].id > libieee_iab[i].id) || ((libieee_iab[i - 1].id == libieee_iab[i].id) && (libieee_iab[i - 1].subid_end >= libieee_iab[i].subid_begin))) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "IAB table not sorted at row: %d", i);
+			builtin_ieee_sorted = 0;
+			return;
+		};
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "IEEE tables are sorted, use binary search");
+};
+
+
+/*
+ * search IEEE tables (IAB, OUI36, OUI)
+ * in:  idval, subidval
+ * mod: pointer to owner strings
+ * out: 0=found, 1=not found
+ */
+static int libipv6calc_db_wrapper_BuiltIn_ieee_lookup(const uint32_t idval, const uint32_t subidval, const char **string_owner, const char **shortstring_owner) {
+	int i, i_min, i_max, i_match;
+
+	if (builtin_ieee_sorted < 0) {
+		libipv6calc_db_wrapper_BuiltIn_ieee_check_sorted();
+	};
+
+	/* IAB list: last entry with (id, subid_begin) <= (idval, subidval) */
+	i_match = -1;
+	if (builtin_ieee_sorted == 1) {
+		i_min = 0; i_max = MAXENTRIES_ARRAY(libieee_iab) - 1;
+		while (i_min <= i_max) {
+			i = (i_min + i_max) / 2;
+			if ((libieee_iab[i].id < idval) || ((libieee_iab[i].id == idval) && (libieee_iab[i].subid_begin <= subidval))) {
+				i_match = i;
+				i_min = i + 1;
+			} else {
+				i_max = i - 1;
+			};
+		};
+	} else {
+		for (i = 0; i < MAXENTRIES_ARRAY(libieee_iab); i++) {
+			if ((libieee_iab[i].id == idval) && (libieee_iab[i].subid_begin <= subidval) && (libieee_iab[i].subid_end >= subidval)) {
+				i_match = i;
+				break;
+			};
+		};
+	};
+
+	if ((i_match >= 0) && (libieee_iab[i_match].id == idval) && (libieee_iab[i_match].subid_end >= subidval)) {
+		*string_owner = libieee_iab[i_match].string_owner;
+		*shortstring_owner = libieee_iab[i_match].shortstring_owner;
+		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IAB);
+		return (0);
+	};
+
+	/* OUI36 list: last entry with (id, subid_begin) <= (idval, subidval) */
+	i_match = -1;
+	if (builtin_ieee_sorted == 1) {
+		i_min = 0; i_max = MAXENTRIES_ARRAY(libieee_oui36) - 1;
+		while (i_min <= i_max) {
+			i = (i_min + i_max) / 2;
+			if ((libieee_oui36[i].id < idval) || ((libieee_oui36[i].id == idval) && (libieee_oui36[i].subid_begin <= subidval))) {
+				i_match = i;
+				i_min = i + 1;
+			} else {
+				i_max = i - 1;
+			};
+		};
+	} else {
+		for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui36); i++) {
+			if ((libieee_oui36[i].id == idval) && (libieee_oui36[i].subid_begin <= subidval) && (libieee_oui36[i].subid_end >= subidval)) {
+				i_match = i;
+				break;
+			};
+		};
+	};
+
+	if ((i_match >= 0) && (libieee_oui36[i_match].id == idval) && (libieee_oui36[i_match].subid_end >= subidval)) {
+		*string_owner = libieee_oui36[i_match].string_owner;
+		*shortstring_owner = libieee_oui36[i_match].shortstring_owner;
+		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI36);
+		return (0);
+	};
+
+	/* OUI list */
+	i_match = -1;
+	if (builtin_ieee_sorted == 1) {
+		i_min = 0; i_max = MAXENTRIES_ARRAY(libieee_oui) - 1;
+		while (i_min <= i_max) {
+			i = (i_min + i_max) / 2;
+			if (libieee_oui[i].id < idval) {
+				i_min = i + 1;
+			} else if (libieee_oui[i].id > idval) {
+				i_max = i - 1;
+			} else {
+				i_match = i;
+				break;
+			};
+		};
+	} else {
+		for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
+			if (libieee_oui[i].id == idval) {
+				i_match = i;
+				break;
+			};
+		};
+	};
+
+	if (i_match >= 0) {
+		*string_owner = libieee_oui[i_match].string_owner;
+		*shortstring_owner = libieee_oui[i_match].shortstring_owner;
+		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI);
+		return (0);
+	};
+
+	return (1);
+};
+#endif
+
+
 /*
  * Get IEEE vendor string
  * in:  macaddrp
@@ -450,8 +606,8 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 	int retval = 1;
 
 #ifdef SUPPORT_DB_IEEE
-	int i;
 	uint32_t idval, subidval;
+	const char *string_owner, *shortstring_owner;
 #endif
 
 	DEBUGPRINT_NA(DEBUG_libieee, "called");
@@ -472,38 +628,9 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 	idval = (macaddrp->addr[0] << 16) | (macaddrp->addr[1] << 8) | macaddrp->addr[2];
 	subidval = (macaddrp->addr[3] << 16) | (macaddrp->addr[4] << 8) | macaddrp->addr[5];
 
-	/* run through IAB list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_iab); i++) {
-		if (libieee_iab[i].id == idval) {
-			/* major id match */
-			if (libieee_iab[i].subid_begin <= subidval && libieee_iab[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_iab[i].string_owner);
-				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IAB);
-				return (0);
-			};
-		};
-	};
-
-	/* run through OUI36 list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui36); i++) {
-		if (libieee_oui36[i].id == idval) {
-			/* major id match */
-			if (libieee_oui36[i].subid_begin <= subidval && libieee_oui36[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui36[i].string_owner);
-				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI36);
-				return (0);
-			};
-		};
-	};
-
-	/* run through OUI list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
-		if (libieee_oui[i].id == idval) {
-			/* match */
-			snprintf(resultstring, resultstring_length, "%s", libieee_oui[i].string_owner);
-			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI);
-			return (0);
-		};
+	if (libipv6calc_db_wrapper_BuiltIn_ieee_lookup(idval, subidval, &string_owner, &shortstring_owner) == 0) {
+		snprintf(resultstring, resultstring_length, "%s", string_owner);
+		return (0);
 	};
 #else
 	snprintf(resultstring, resultstring_length, "(IEEE databases not compiled in)");
@@ -526,8 +653,8 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 	int retval = 1;
 
 #ifdef SUPPORT_DB_IEEE
-	int i;
 	uint32_t idval, subidval;
+	const char *string_owner, *shortstring_owner;
 #endif
 
 	DEBUGPRINT_NA(DEBUG_libieee, "called");
@@ -548,38 +675,9 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 	idval = (macaddrp->addr[0] << 16) | (macaddrp->addr[1] << 8) | macaddrp->addr[2];
 	subidval = (macaddrp->addr[3] << 16) | (macaddrp->addr[4] << 8) | macaddrp->addr[5];
 
-	/* run through IAB list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_iab); i++) {
-		if (libieee_iab[i].id == idval) {
-			/* major id match */
-			if (libieee_iab[i].subid_begin <= subidval && libieee_iab[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_iab[i].shortstring_owner);
-				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IAB);
-				return (0);
-			};
-		};
-	};
-
-	/* run through OUI36 list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui36); i++) {
-		if (libieee_oui36[i].id == idval) {
-			/* major id match */
-			if (libieee_oui36[i].subid_begin <= subidval && libieee_oui36[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui36[i].shortstring_owner);
-				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI36);
-				return (0);
-			};
-		};
-	};
-
-	/* run through OUI list */
-	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
-		if (libieee_oui[i].id == idval) {
-			/* match */
-			snprintf(resultstring, resultstring_length, "%s", libieee_oui[i].shortstring_owner);
-			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI);
-			return (0);
-		};
+	if (libipv6calc_db_wrapper_BuiltIn_ieee_lookup(idval, subidval, &string_owner, &shortstring_owner) == 0) {
+		snprintf(resultstring, resultstring_length, "%s", shortstring_owner);
+		return (0);
 	};
 #else
 	snprintf(resultstring, resultstring_length, "(IEEE databases not compiled in)");
@@ -740,6 +838,85 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4a
 };
 
 
+/*
+ * get registry numbers of a list of IPv4 addresses
+ *
+ * in:  keys = sorted IPv4 addresses (in upper 32 bits), num = number of keys
+ * out: registry[] = assignment numbers
+ * ret: 0 = ok, -1 = not supported
+ */
+int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(const uint64_t *keys, const int num, int *registry) {
+	int result = -1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given number of IPv4 addresses: %d", num);
+
+#ifdef SUPPORT_DB_IPV4_REG
+	long int *matches;
+	long int match;
+	int i;
+
+	matches = malloc(sizeof(long int) * num);
+	if (matches == NULL) {
+		ERRORPRINT_WA("can't allocate memory for batch lookup of addresses: %d", num);
+		exit(EXIT_FAILURE);
+	};
+
+	result = libipv6calc_db_wrapper_get_entry_generic_batch(
+		NULL,							// pointer to data
+		IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,			// type of data_ptr
+		IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
+		0,							// key format (not relevant)
+		32,							// key length
+		MAXENTRIES_ARRAY(dbipv4addr_assignment),		// number of rows
+		keys,							// sorted lookup keys
+		num,							// number of lookup keys
+		matches,						// matching rows
+		libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment	// function pointer
+	);
+
+	if (result != 0) {
+		goto END_libipv6calc_db_wrapper_BuiltIn_batch;
+	};
+
+	for (i = 0; i < num; i++) {
+		registry[i] = IPV4_ADDR_REGISTRY_UNKNOWN;
+
+		if (matches[i] > -1) {
+			registry[i] = dbipv4addr_assignment[matches[i]].registry;
+			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
+		};
+
+		if (registry[i] == IPV4_ADDR_REGISTRY_UNKNOWN) {
+			// IANA fallback (rare, single lookup)
+			match = libipv6calc_db_wrapper_get_entry_generic(
+				NULL,							// pointer to data
+				IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,			// type of data_ptr
+				IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
+				0,							// key format (not relevant)
+				32,							// key length
+				IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,		// search type
+				MAXENTRIES_ARRAY(dbipv4addr_assignment_iana),		// number of rows
+				(uint32_t) (keys[i] >> 32),				// lookup key MSB
+				0,							// lookup key LSB
+				NULL,							// data ptr (not used in IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
+				libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_iana	// function pointer
+			);
+
+			if (match > -1) {
+				registry[i] = dbipv4addr_assignment_iana[match].registry;
+				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
+			};
+		};
+	};
+
+END_libipv6calc_db_wrapper_BuiltIn_batch:
+	free(matches);
+#endif // SUPPORT_DB_IPV4_REG
+
+	return(result);
+};
+
+
 /*
  * get info of an IPv4 address
  *
@@ -873,7 +1050,7 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv6addr(const ipv6calc_ipv6a
 		IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_BASE_MASK,		// key type
 		0,							// key format (not relevant)
 		64,							// key length
-		IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST,		// search type
+		IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_TRIE,		// search type
 		MAXENTRIES_ARRAY(dbipv6addr_assignment),		// number of rows
 		ipv6_00_31,						// lookup key MSB
 		ipv6_32_63,						// lookup key LSB
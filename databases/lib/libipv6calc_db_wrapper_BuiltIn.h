@@ -96,6 +96,7 @@ extern int  libipv6calc_db_wrapper_BuiltIn_wrapper_cleanup(void);
 extern void libipv6calc_db_wrapper_BuiltIn_wrapper_info(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_BuiltIn_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char *libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used(void);
+extern void libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_reset(void);
 
 extern int libipv6calc_db_wrapper_BuiltIn_has_features(uint32_t features);
 extern time_t libipv6calc_db_wrapper_BuiltIn_db_unixtime_by_feature(uint32_t feature);
@@ -109,6 +110,7 @@ extern int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(ch
 
 // IPv4 Registry
 extern int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp);
+extern int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(const uint64_t *keys, const int num, int *registry);
 extern int libipv6calc_db_wrapper_BuiltIn_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len);
 
 // IPv6 Registry
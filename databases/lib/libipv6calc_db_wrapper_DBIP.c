@@ -280,6 +280,8 @@ static int libipv6calc_db_wrapper_DBIP_close(DB *dbp) {
 			};
 		};
 
+		libipv6calc_db_wrapper_bdb_index_free(dbp);
+
 		dbp->close(dbp, 0);
 	};
 
@@ -517,6 +519,15 @@ char *libipv6calc_db_wrapper_DBIP_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_DBIP_wrapper_db_info_used_reset(void) {
+	memset(dbip_db_usage_map, 0, sizeof(dbip_db_usage_map));
+	dbip_db_usage_string[0] = '\0';
+};
+
+
 
 #ifdef SUPPORT_DBIP
 
@@ -156,6 +156,9 @@ static int libipv6calc_db_wrapper_External_close(DB *dbp) {
 			};
 		};
 
+		libipv6calc_db_wrapper_trie_free(dbp);
+		libipv6calc_db_wrapper_bdb_index_free(dbp);
+
 		dbp->close(dbp, 0);
 	};
 
@@ -303,6 +306,15 @@ char *libipv6calc_db_wrapper_External_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_External_wrapper_db_info_used_reset(void) {
+	memset(external_db_usage_map, 0, sizeof(external_db_usage_map));
+	external_db_usage_string[0] = '\0';
+};
+
+
 
 #ifdef SUPPORT_EXTERNAL
 
@@ -810,6 +822,48 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * get registry number from data of a registry database row
+ *
+ * in:  resultstring (modified)
+ * out: assignment number (REGISTRY_UNKNOWN = no result, -1 = corrupt database)
+ */
+static int libipv6calc_db_wrapper_External_registry_num_by_data(char *resultstring) {
+	char *token, *cptr, **ptrptr;
+	int i, token_count = 0;
+	int retval = REGISTRY_UNKNOWN;
+
+	ptrptr = &cptr;
+
+	// split result string
+	token = strtok_r(resultstring, ";", ptrptr);
+	while (token != NULL) {
+		token_count++;
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database entry found %d: %s", token_count, token);
+
+		if (token_count == 1) {
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_registries); i++) {
+				if (strcmp(token, ipv6calc_registries[i].tokensimple) == 0) {
+					retval = ipv6calc_registries[i].number;
+					break;
+				};
+			};
+		};
+
+		/* get next token */
+		token = strtok_r(NULL, ";", ptrptr);
+	};
+
+	if (token_count != 1) {
+		ERRORPRINT_WA("data has more entries than expected, corrupt database: %d", token_count);
+		return(-1);
+	};
+
+	return(retval);
+};
+
+
 /*
  * get registry number of an IPv4/IPv6 address
  *
@@ -820,8 +874,7 @@ int libipv6calc_db_wrapper_External_registry_num_by_addr(const ipv6calc_ipaddr *
 	DB *dbp, *dbp_iana;
 	long int recno_max;
 	static char resultstring[NI_MAXHOST];
-	char *data_ptr = "";
-	int i, result;
+	int result;
 	int retval = REGISTRY_UNKNOWN;
 
 	int External_type;
@@ -868,7 +921,7 @@ int libipv6calc_db_wrapper_External_registry_num_by_addr(const ipv6calc_ipaddr *
 		  : 64,								// key length
 		(ipaddrp->proto == IPV6CALC_PROTO_IPV4) \
 		  ? IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY \
-		  : IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST,		// search type
+		  : IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_TRIE,			// search type
 		recno_max,							// number of rows
 		ipaddrp->addr[0],						// lookup key MSB
 		(ipaddrp->proto == IPV6CALC_PROTO_IPV4) \
@@ -924,37 +977,10 @@ END_libipv6calc_db_wrapper_match:
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "resultstring=%s", resultstring);
 
-	char datastring[NI_MAXHOST];
+	retval = libipv6calc_db_wrapper_External_registry_num_by_data(resultstring);
 
-	char *token, *cptr, **ptrptr;
-	ptrptr = &cptr;
-
-	int token_count = 0;
-
-	snprintf(datastring, sizeof(datastring), "%s", data_ptr);
-
-	// split result string
-	token = strtok_r(resultstring, ";", ptrptr);
-	while (token != NULL) {
-		token_count++;
-
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database entry found %d: %s", token_count, token);
-
-		if (token_count == 1) {
-			for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_registries); i++) {
-				if (strcmp(token, ipv6calc_registries[i].tokensimple) == 0) {
-					retval = ipv6calc_registries[i].number;
-					break;
-				};
-			};
-		};
-
-		/* get next token */
-		token = strtok_r(NULL, ";", ptrptr);
-	};
-
-	if (token_count != 1) {
-		ERRORPRINT_WA("data has more entries than expected, corrupt database: %d", token_count);
+	if (retval < 0) {
+		retval = REGISTRY_UNKNOWN;
 		goto END_libipv6calc_db_wrapper_close;
 	};
 
@@ -978,6 +1004,137 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * get registry numbers of a list of IPv4 addresses
+ *
+ * in:  keys = sorted IPv4 addresses (in upper 32 bits), num = number of keys
+ * out: registry[] = assignment numbers
+ * ret: 0 = ok, -1 = not supported
+ */
+int libipv6calc_db_wrapper_External_registry_num_by_ipv4addr_batch(const uint64_t *keys, const int num, int *registry) {
+	DB *dbp, *dbp_iana = NULL;
+	long int recno_max, recno_max_iana = 0;
+	static char resultstring[NI_MAXHOST];
+	uint32_t value_first_00_31, value_first_32_63, value_last_00_31, value_last_32_63;
+	long int *matches;
+	long int match, match_last = -1;
+	int i, registry_last = REGISTRY_UNKNOWN;
+	int result = -1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Given number of IPv4 addresses: %d", num);
+
+	dbp = libipv6calc_db_wrapper_External_open_type(EXTERNAL_DB_IPV4_REGISTRY, &recno_max);
+
+	if (dbp == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "Error opening External by type");
+		return(-1);
+	};
+
+	matches = malloc(sizeof(long int) * num);
+	if (matches == NULL) {
+		ERRORPRINT_WA("can't allocate memory for batch lookup of addresses: %d", num);
+		exit(EXIT_FAILURE);
+	};
+
+	result = libipv6calc_db_wrapper_get_entry_generic_batch(
+		(void *) dbp,						// pointer to database
+		IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB,			// type of data_ptr
+		IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
+		IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x2,	// key format
+		32,							// key length
+		recno_max,						// number of rows
+		keys,							// sorted lookup keys
+		num,							// number of lookup keys
+		matches,						// matching rows
+		NULL							// function pointer
+	);
+
+	if (result != 0) {
+		goto END_libipv6calc_db_wrapper_External_batch;
+	};
+
+	for (i = 0; i < num; i++) {
+		registry[i] = REGISTRY_UNKNOWN;
+		match = matches[i];
+
+		if (match < 0) {
+			// data-iana (fallback, rare, single lookup)
+			if (dbp_iana == NULL) {
+				dbp_iana = libipv6calc_db_wrapper_External_open_type(EXTERNAL_DB_IPV4_REGISTRY | 0x20000, &recno_max_iana);
+				if (dbp_iana == NULL) {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "Error opening External by type");
+					result = -1;
+					goto END_libipv6calc_db_wrapper_External_batch;
+				};
+			};
+
+			match = libipv6calc_db_wrapper_get_entry_generic(
+				(void *) dbp_iana,					// pointer to database
+				IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_BDB,			// type of data_ptr
+				IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
+				IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x2,   // key format
+				32,							// key length
+				IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,		// search type
+				recno_max_iana,						// number of rows
+				(uint32_t) (keys[i] >> 32),				// lookup key MSB
+				0,							// lookup key LSB
+				resultstring,						// data ptr
+				NULL							// function pointer
+			);
+
+			if (match < 0) {
+				continue;
+			};
+
+			match_last = -1; // row of data-iana
+		} else if (match == match_last) {
+			// same row as previous key
+			registry[i] = registry_last;
+			continue;
+		} else if (libipv6calc_db_wrapper_bdb_fetch_row(
+				dbp,			// pointer to DB
+				IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x2,	// DB format
+				match + 1,		// row number
+				&value_first_00_31,	// data 1 (MSB in case of 64 bits)
+				&value_first_32_63,	// data 1 (LSB in case of 64 bits)
+				&value_last_00_31,	// data 2 (MSB in case of 64 bits)
+				&value_last_32_63,	// data 2 (LSB in case of 64 bits)
+				resultstring		// pointer to data
+			) < 0) {
+			ERRORPRINT_WA("can't retrieve data for row: %ld", match);
+			result = -1;
+			goto END_libipv6calc_db_wrapper_External_batch;
+		} else {
+			match_last = match;
+		};
+
+		registry[i] = libipv6calc_db_wrapper_External_registry_num_by_data(resultstring);
+
+		if (registry[i] < 0) {
+			// corrupt database, reported by single lookups
+			result = -1;
+			goto END_libipv6calc_db_wrapper_External_batch;
+		};
+
+		registry_last = registry[i];
+
+		if (registry[i] != REGISTRY_UNKNOWN) {
+			EXTERNAL_DB_USAGE_MAP_TAG(EXTERNAL_DB_IPV4_REGISTRY);
+		};
+	};
+
+END_libipv6calc_db_wrapper_External_batch:
+	if (dbp_iana != NULL) {
+		libipv6calc_db_wrapper_External_close(dbp_iana);
+	};
+
+	free(matches);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "result=%d", result);
+	return(result);
+};
+
+
 /*
  * get country code of an IPv4/IPv6 address
  *
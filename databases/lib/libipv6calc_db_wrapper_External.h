@@ -57,6 +57,7 @@ extern int         libipv6calc_db_wrapper_External_wrapper_cleanup(void);
 extern void        libipv6calc_db_wrapper_External_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_External_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_External_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_External_wrapper_db_info_used_reset(void);
 
 extern int         libipv6calc_db_wrapper_External_has_features(uint32_t features);
 extern time_t      libipv6calc_db_wrapper_External_db_unixtime_by_feature(uint32_t feature);
@@ -75,6 +76,7 @@ extern const char  *libipv6calc_db_wrapper_External_dbdescription(const unsigned
 
 // IPv4/v6 Registry Number
 extern int libipv6calc_db_wrapper_External_registry_num_by_addr(const ipv6calc_ipaddr *ipaddrp);
+extern int libipv6calc_db_wrapper_External_registry_num_by_ipv4addr_batch(const uint64_t *keys, const int num, int *registry);
 
 // IPv4/v6 CountryCode 
 extern int libipv6calc_db_wrapper_External_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
@@ -11,12 +11,14 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <dlfcn.h>
 
 #include "config.h"
 
 #include "libipv6calcdebug.h"
 #include "libipv6addr.h"
+#include "libipaddr.h"
 
 #include "libipv6calc_db_wrapper.h"
 
@@ -138,6 +140,33 @@ static int dl_status_GeoIP_country_code_by_ipnum_v6 = IPV6CALC_DL_STATUS_UNKNOWN
 typedef char *(*dl_GeoIP_country_code_by_ipnum_v6_t)(GeoIP* gi, geoipv6_t ipnum);
 static union { dl_GeoIP_country_code_by_ipnum_v6_t func; void * obj; } dl_GeoIP_country_code_by_ipnum_v6;
 
+/* binary address (ipnum) functions, resolved once during init */
+static int dl_status_GeoIP_country_id_by_ipnum = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef int (*dl_GeoIP_country_id_by_ipnum_t)(GeoIP* gi, unsigned long ipnum);
+static union { dl_GeoIP_country_id_by_ipnum_t func; void * obj; } dl_GeoIP_country_id_by_ipnum;
+
+static int dl_status_GeoIP_code_by_id = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef const char *(*dl_GeoIP_code_by_id_t)(int id);
+static union { dl_GeoIP_code_by_id_t func; void * obj; } dl_GeoIP_code_by_id;
+
+static int dl_status_GeoIP_name_by_ipnum = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef char *(*dl_GeoIP_name_by_ipnum_t)(GeoIP* gi, unsigned long ipnum);
+static union { dl_GeoIP_name_by_ipnum_t func; void * obj; } dl_GeoIP_name_by_ipnum;
+
+static int dl_status_GeoIP_name_by_ipnum_v6 = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef char *(*dl_GeoIP_name_by_ipnum_v6_t)(GeoIP* gi, geoipv6_t ipnum);
+static union { dl_GeoIP_name_by_ipnum_v6_t func; void * obj; } dl_GeoIP_name_by_ipnum_v6;
+
+static int dl_status_GeoIP_record_by_ipnum = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef GeoIPRecord *(*dl_GeoIP_record_by_ipnum_t)(GeoIP* gi, unsigned long ipnum);
+static union { dl_GeoIP_record_by_ipnum_t func; void * obj; } dl_GeoIP_record_by_ipnum;
+
+static int dl_status_GeoIP_record_by_ipnum_v6 = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef GeoIPRecord *(*dl_GeoIP_record_by_ipnum_v6_t)(GeoIP* gi, geoipv6_t ipnum);
+static union { dl_GeoIP_record_by_ipnum_v6_t func; void * obj; } dl_GeoIP_record_by_ipnum_v6;
+
+static void libipv6calc_db_wrapper_dl_load_GeoIP_symbol(const char *dl_symbol, void **obj, int *status);
+
 #else // SUPPORT_GEOIP_DYN
 static const char* wrapper_geoip_info = "built-in";
 #endif // SUPPORT_GEOIP_DYN
@@ -241,6 +270,33 @@ int libipv6calc_db_wrapper_GeoIP_wrapper_init(void) {
 		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV6_CN_BY_ADDR;
 	};
 
+	/* check for binary address (ipnum) support, symbols are resolved only here */
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_country_id_by_ipnum", &dl_GeoIP_country_id_by_ipnum.obj, &dl_status_GeoIP_country_id_by_ipnum);
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_code_by_id", &dl_GeoIP_code_by_id.obj, &dl_status_GeoIP_code_by_id);
+	if ((dl_status_GeoIP_country_id_by_ipnum == IPV6CALC_DL_STATUS_OK) && (dl_status_GeoIP_code_by_id == IPV6CALC_DL_STATUS_OK)) {
+		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV4_CC_BY_IPNUM;
+	};
+
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_name_by_ipnum", &dl_GeoIP_name_by_ipnum.obj, &dl_status_GeoIP_name_by_ipnum);
+	if (dl_status_GeoIP_name_by_ipnum == IPV6CALC_DL_STATUS_OK) {
+		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV4_NAME_BY_IPNUM;
+	};
+
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_name_by_ipnum_v6", &dl_GeoIP_name_by_ipnum_v6.obj, &dl_status_GeoIP_name_by_ipnum_v6);
+	if (dl_status_GeoIP_name_by_ipnum_v6 == IPV6CALC_DL_STATUS_OK) {
+		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV6_NAME_BY_IPNUM;
+	};
+
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_record_by_ipnum", &dl_GeoIP_record_by_ipnum.obj, &dl_status_GeoIP_record_by_ipnum);
+	if (dl_status_GeoIP_record_by_ipnum == IPV6CALC_DL_STATUS_OK) {
+		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV4_RECORD_BY_IPNUM;
+	};
+
+	libipv6calc_db_wrapper_dl_load_GeoIP_symbol("GeoIP_record_by_ipnum_v6", &dl_GeoIP_record_by_ipnum_v6.obj, &dl_status_GeoIP_record_by_ipnum_v6);
+	if (dl_status_GeoIP_record_by_ipnum_v6 == IPV6CALC_DL_STATUS_OK) {
+		lib_features_GeoIP |= GEOIP_LIB_FEATURE_IPV6_RECORD_BY_IPNUM;
+	};
+
 	/* GeoIPDBFFileName */
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Call dlsym: %s", "GeoIPDBFileName");
 	dlerror();    /* Clear any existing error */
@@ -266,6 +322,11 @@ int libipv6calc_db_wrapper_GeoIP_wrapper_init(void) {
 #endif // SUPPORT_GEOIP_V6
 #endif // SUPPORT_GEOIP_COUNTRY_CODE_BY_ADDR_V6 && SUPPORT_GEOIP_COUNTRY_NAME_BY_ADDR_V6
 
+		lib_features_GeoIP |= (GEOIP_LIB_FEATURE_IPV4_CC_BY_IPNUM | GEOIP_LIB_FEATURE_IPV4_NAME_BY_IPNUM | GEOIP_LIB_FEATURE_IPV4_RECORD_BY_IPNUM);
+#ifdef SUPPORT_GEOIP_V6
+		lib_features_GeoIP |= (GEOIP_LIB_FEATURE_IPV6_CC_BY_IPNUM | GEOIP_LIB_FEATURE_IPV6_NAME_BY_IPNUM | GEOIP_LIB_FEATURE_IPV6_RECORD_BY_IPNUM);
+#endif // SUPPORT_GEOIP_V6
+
 	libipv6calc_db_wrapper_GeoIPDBDescription = GeoIPDBDescription;
 	libipv6calc_db_wrapper_GeoIPDBFileName_ptr = &GeoIPDBFileName;
 	geoip_num_db_types = NUM_DB_TYPES;
@@ -1138,6 +1199,15 @@ char *libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used_reset(void) {
+	memset(geoip_db_usage_map, 0, sizeof(geoip_db_usage_map));
+	geoip_db_usage_string[0] = '\0';
+};
+
+
 /*
  * wrapper: GeoIP_delete
  */ 
@@ -1714,6 +1784,86 @@ END_libipv6calc_db_wrapper:
 #endif // SUPPORT_GEOIP_V6
 
 
+/*
+ * wrapper: binary address (ipnum) functions
+ *  symbols are resolved during init, availability is reflected in lib_features_GeoIP
+ */
+static const char *libipv6calc_db_wrapper_GeoIP_country_code_by_ipnum(GeoIP *gi, const uint32_t ipnum) {
+	int country_id;
+
+#ifdef SUPPORT_GEOIP_DYN
+	if ((dl_status_GeoIP_country_id_by_ipnum != IPV6CALC_DL_STATUS_OK) || (dl_status_GeoIP_code_by_id != IPV6CALC_DL_STATUS_OK)) {
+		return(NULL);
+	};
+
+	country_id = (*dl_GeoIP_country_id_by_ipnum.func)(gi, (unsigned long) ipnum);
+	return((country_id > 0) ? (*dl_GeoIP_code_by_id.func)(country_id) : NULL);
+#else
+	country_id = GeoIP_country_id_by_ipnum(gi, (unsigned long) ipnum);
+	return((country_id > 0) ? GeoIP_code_by_id(country_id) : NULL);
+#endif
+};
+
+static char *libipv6calc_db_wrapper_GeoIP_name_by_ipnum(GeoIP *gi, const uint32_t ipnum) {
+#ifdef SUPPORT_GEOIP_DYN
+	if (dl_status_GeoIP_name_by_ipnum != IPV6CALC_DL_STATUS_OK) {
+		return(NULL);
+	};
+
+	return((*dl_GeoIP_name_by_ipnum.func)(gi, (unsigned long) ipnum));
+#else
+	return(GeoIP_name_by_ipnum(gi, (unsigned long) ipnum));
+#endif
+};
+
+static GeoIPRecord *libipv6calc_db_wrapper_GeoIP_record_by_ipnum(GeoIP *gi, const uint32_t ipnum) {
+#ifdef SUPPORT_GEOIP_DYN
+	if (dl_status_GeoIP_record_by_ipnum != IPV6CALC_DL_STATUS_OK) {
+		return(NULL);
+	};
+
+	return((*dl_GeoIP_record_by_ipnum.func)(gi, (unsigned long) ipnum));
+#else
+	return(GeoIP_record_by_ipnum(gi, (unsigned long) ipnum));
+#endif
+};
+
+#ifdef SUPPORT_GEOIP_V6
+static char *libipv6calc_db_wrapper_GeoIP_name_by_ipnum_v6(GeoIP *gi, geoipv6_t ipnum) {
+#ifdef SUPPORT_GEOIP_DYN
+	if (dl_status_GeoIP_name_by_ipnum_v6 != IPV6CALC_DL_STATUS_OK) {
+		return(NULL);
+	};
+
+	return((*dl_GeoIP_name_by_ipnum_v6.func)(gi, ipnum));
+#else
+	return(GeoIP_name_by_ipnum_v6(gi, ipnum));
+#endif
+};
+
+static GeoIPRecord *libipv6calc_db_wrapper_GeoIP_record_by_ipnum_v6(GeoIP *gi, geoipv6_t ipnum) {
+#ifdef SUPPORT_GEOIP_DYN
+	if (dl_status_GeoIP_record_by_ipnum_v6 != IPV6CALC_DL_STATUS_OK) {
+		return(NULL);
+	};
+
+	return((*dl_GeoIP_record_by_ipnum_v6.func)(gi, ipnum));
+#else
+	return(GeoIP_record_by_ipnum_v6(gi, ipnum));
+#endif
+};
+
+/* convert ipv6calc address into GeoIP ipnum (network byte order) */
+static void libipv6calc_db_wrapper_GeoIP_ipaddr_to_ipnum_v6(const ipv6calc_ipaddr *ipaddrp, geoipv6_t *ipnump) {
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		ipnump->s6_addr[i] = (uint8_t) ((ipaddrp->addr[i / 4] >> (24 - 8 * (i % 4))) & 0xff);
+	};
+};
+#endif // SUPPORT_GEOIP_V6
+
+
 /********************************************************
  * particular dynamic loader functions for feature checks
  *  avoiding duplicate code
@@ -1875,6 +2025,33 @@ END_libipv6calc_db_wrapper_dl_load:
 	return;
 };
 
+/* libipv6calc_db_wrapper_dl_load_GeoIP_symbol: resolve optional symbol once (silent if not found) */
+static void libipv6calc_db_wrapper_dl_load_GeoIP_symbol(const char *dl_symbol, void **obj, int *status) {
+	if (dl_GeoIP_handle == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP, "dl_GeoIP_handle not defined");
+		return;
+	};
+
+	if (*status != IPV6CALC_DL_STATUS_UNKNOWN) {
+		return;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Call dlsym: %s", dl_symbol);
+
+	dlerror();    /* Clear any existing error */
+
+	*obj = dlsym(dl_GeoIP_handle, dl_symbol);
+
+	if (dlerror() != NULL)  {
+		*status = IPV6CALC_DL_STATUS_ERROR;
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "dl_symbol not found: %s", dl_symbol);
+		return;
+	};
+
+	*status = IPV6CALC_DL_STATUS_OK;
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Called dlsym successful: %s", dl_symbol);
+};
+
 static void libipv6calc_db_wrapper_dl_load_GeoIP_lib_version (void) {
 	const char *dl_symbol = "GeoIP_lib_version";
 	char *error;
@@ -2177,6 +2354,177 @@ END_libipv6calc_db_wrapper:
 	return(GeoIP_result_ptr);
 };
 
+
+/*
+ * lookups by binary address
+ *  use ipnum functions of library if available (no conversion to string and back),
+ *  otherwise fall back to string based wrapper functions
+ */
+
+/* country_code */
+const char *libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_ipaddr(const ipv6calc_ipaddr *ipaddrp) {
+	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
+	const char *GeoIP_result_ptr = NULL;
+	int GeoIP_type = 0;
+	GeoIP *gi;
+
+	if ((ipaddrp->proto == IPV6CALC_PROTO_IPV4) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV4_CC_BY_IPNUM) != 0)) {
+		GeoIP_type = GEOIP_COUNTRY_EDITION;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_country_code_by_ipnum(gi, ipaddrp->addr[0]);
+#ifdef SUPPORT_GEOIP_V6
+#if HAVE_DECL_GEOIP_COUNTRY_EDITION_V6 == 1
+	} else if ((ipaddrp->proto == IPV6CALC_PROTO_IPV6) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV6_CC_BY_IPNUM) != 0)) {
+		geoipv6_t ipnum;
+
+		GeoIP_type = GEOIP_COUNTRY_EDITION_V6;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		libipv6calc_db_wrapper_GeoIP_ipaddr_to_ipnum_v6(ipaddrp, &ipnum);
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_country_code_by_ipnum_v6(gi, ipnum);
+#endif
+#endif // SUPPORT_GEOIP_V6
+	} else {
+		libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+		return(libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_addr(tempstring, ipaddrp->proto));
+	};
+
+	if (GeoIP_result_ptr == NULL) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	if (strlen(GeoIP_result_ptr) > 2) {
+		GeoIP_result_ptr = NULL;
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	GEOIP_DB_USAGE_MAP_TAG(GeoIP_type);
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Result for proto=%d: %s", ipaddrp->proto, GeoIP_result_ptr);
+	return(GeoIP_result_ptr);
+};
+
+
+/* asnum */
+char *libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_ipaddr(const ipv6calc_ipaddr *ipaddrp) {
+	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
+	char *GeoIP_result_ptr = NULL;
+	int GeoIP_type = 0;
+	GeoIP *gi;
+
+	if (0) {
+		// dummy
+#if HAVE_DECL_GEOIP_ASNUM_EDITION == 1
+	} else if ((ipaddrp->proto == IPV6CALC_PROTO_IPV4) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV4_NAME_BY_IPNUM) != 0)) {
+		if ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP] & IPV6CALC_DB_IPV4_TO_AS) == 0) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Database/Support not available: GEOIP_ASNUM_EDITION");
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		GeoIP_type = GEOIP_ASNUM_EDITION;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_name_by_ipnum(gi, ipaddrp->addr[0]);
+#endif
+#ifdef SUPPORT_GEOIP_V6
+#if HAVE_DECL_GEOIP_ASNUM_EDITION_V6 == 1
+	} else if ((ipaddrp->proto == IPV6CALC_PROTO_IPV6) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV6_NAME_BY_IPNUM) != 0)) {
+		geoipv6_t ipnum;
+
+		if ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP] & IPV6CALC_DB_IPV6_TO_AS) == 0) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Database/Support not available: GEOIP_ASNUM_EDITION_V6");
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		GeoIP_type = GEOIP_ASNUM_EDITION_V6;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		libipv6calc_db_wrapper_GeoIP_ipaddr_to_ipnum_v6(ipaddrp, &ipnum);
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_name_by_ipnum_v6(gi, ipnum);
+#endif
+#endif // SUPPORT_GEOIP_V6
+	} else {
+		libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+		return(libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_addr(tempstring, ipaddrp->proto));
+	};
+
+	if (GeoIP_result_ptr == NULL) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	GEOIP_DB_USAGE_MAP_TAG(GeoIP_type);
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP, "Result for proto=%d: %s", ipaddrp->proto, GeoIP_result_ptr);
+	return(GeoIP_result_ptr);
+};
+
+
+/* record: city */
+GeoIPRecord *libipv6calc_db_wrapper_GeoIP_wrapper_record_city_by_ipaddr(const ipv6calc_ipaddr *ipaddrp) {
+	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
+	GeoIPRecord *GeoIP_result_ptr = NULL;
+	int GeoIP_type = 0;
+	GeoIP *gi;
+
+	if ((ipaddrp->proto == IPV6CALC_PROTO_IPV4) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV4_RECORD_BY_IPNUM) != 0)) {
+		GeoIP_type = GEOIP_CITY_EDITION_REV1;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			return (NULL);
+		};
+
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_record_by_ipnum(gi, ipaddrp->addr[0]);
+#ifdef SUPPORT_GEOIP_V6
+#if HAVE_DECL_GEOIP_CITY_EDITION_REV1_V6 == 1
+	} else if ((ipaddrp->proto == IPV6CALC_PROTO_IPV6) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_IPV6_RECORD_BY_IPNUM) != 0) && ((lib_features_GeoIP & GEOIP_LIB_FEATURE_LIB_VERSION) != 0)) {
+		geoipv6_t ipnum;
+
+		GeoIP_type = GEOIP_CITY_EDITION_REV1_V6;
+
+		gi = libipv6calc_db_wrapper_GeoIP_open_type(GeoIP_type, 0);
+		if (gi == NULL) {
+			return (NULL);
+		};
+
+		libipv6calc_db_wrapper_GeoIP_ipaddr_to_ipnum_v6(ipaddrp, &ipnum);
+		GeoIP_result_ptr = libipv6calc_db_wrapper_GeoIP_record_by_ipnum_v6(gi, ipnum);
+#endif
+#endif // SUPPORT_GEOIP_V6
+	} else {
+		libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+		return(libipv6calc_db_wrapper_GeoIP_wrapper_record_city_by_addr(tempstring, ipaddrp->proto));
+	};
+
+	if (GeoIP_result_ptr == NULL) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	GEOIP_DB_USAGE_MAP_TAG(GeoIP_type);
+
+END_libipv6calc_db_wrapper:
+	return(GeoIP_result_ptr);
+};
+
 #endif
 
 
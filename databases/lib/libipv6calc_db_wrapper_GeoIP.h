@@ -25,6 +25,11 @@
 #define GEOIP_LIB_FEATURE_IPV6_CN_BY_IPNUM	0x0200
 #define GEOIP_LIB_FEATURE_IPV6_CC_BY_ADDR	0x0400
 #define GEOIP_LIB_FEATURE_IPV6_CN_BY_ADDR	0x0800
+#define GEOIP_LIB_FEATURE_IPV4_CC_BY_IPNUM	0x1000
+#define GEOIP_LIB_FEATURE_IPV4_NAME_BY_IPNUM	0x2000
+#define GEOIP_LIB_FEATURE_IPV4_RECORD_BY_IPNUM	0x4000
+#define GEOIP_LIB_FEATURE_IPV6_NAME_BY_IPNUM	0x8000
+#define GEOIP_LIB_FEATURE_IPV6_RECORD_BY_IPNUM	0x10000
 
 // features
 extern uint32_t wrapper_features_GeoIP;
@@ -40,6 +45,7 @@ extern char        *libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_addr(const cha
 extern void         libipv6calc_db_wrapper_GeoIP_wrapper_info(char* string, const size_t size);
 extern void         libipv6calc_db_wrapper_GeoIP_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char        *libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used(void);
+extern void         libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used_reset(void);
 
 extern int          libipv6calc_db_wrapper_GeoIP_has_features(uint32_t features);
 
@@ -76,4 +82,8 @@ extern const char  **libipv6calc_db_wrapper_GeoIPDBDescription;
 extern char       ***libipv6calc_db_wrapper_GeoIPDBFileName_ptr;
 
 extern GeoIPRecord *libipv6calc_db_wrapper_GeoIP_wrapper_record_city_by_addr(const char *addr, const int proto);
+
+extern const char  *libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_ipaddr(const ipv6calc_ipaddr *ipaddrp);
+extern char        *libipv6calc_db_wrapper_GeoIP_wrapper_asnum_by_ipaddr(const ipv6calc_ipaddr *ipaddrp);
+extern GeoIPRecord *libipv6calc_db_wrapper_GeoIP_wrapper_record_city_by_ipaddr(const ipv6calc_ipaddr *ipaddrp);
 #endif
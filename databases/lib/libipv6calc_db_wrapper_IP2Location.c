@@ -17,6 +17,8 @@
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 
 #include "config.h"
 
@@ -840,6 +842,15 @@ char *libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_reset(void) {
+	memset(ip2location_db_usage_map, 0, sizeof(ip2location_db_usage_map));
+	ip2location_db_usage_string[0] = '\0';
+};
+
+
 
 #ifdef SUPPORT_IP2LOCATION
 
@@ -1841,6 +1852,485 @@ END_libipv6calc_db_wrapper:
 	return(record);
 };
 
+
+/*********************************************
+ * Native BIN reader
+ *  reads IP2Location BIN files from a read-only mapping, takes the binary
+ *  address (no string conversion) and copies results into caller storage
+ *  (no allocation), library functions are used as fallback
+ *  bin_cache[] is set up lazily on first lookup without own locking: callers
+ *  are the abstract lookup functions of libipv6calc_db_wrapper.c, which hold
+ *  the wrapper mutex for all features served by IP2Location after
+ *  libipv6calc_db_wrapper_threads_init (IP2Location is never lock-free there,
+ *  see libipv6calc_db_wrapper_threads_lock_features_update)
+ * *******************************************/
+
+// header of BIN file (little endian, offsets are 0-based, file positions stored in header are 1-based)
+#define IP2L_BIN_HEADER_DBTYPE		0
+#define IP2L_BIN_HEADER_DBCOLUMN	1
+#define IP2L_BIN_HEADER_IPV4_COUNT	5
+#define IP2L_BIN_HEADER_IPV4_ADDR	9
+#define IP2L_BIN_HEADER_IPV6_COUNT	13
+#define IP2L_BIN_HEADER_IPV6_ADDR	17
+#define IP2L_BIN_HEADER_IPV4_INDEX	21
+#define IP2L_BIN_HEADER_IPV6_INDEX	25
+#define IP2L_BIN_HEADER_SIZE		64
+
+// column positions of fields (DB1-DB24)
+#define IP2L_BIN_POSITION_COUNTRY(dbtype)	(((dbtype) >= 1) ? 2 : 0)
+#define IP2L_BIN_POSITION_REGION(dbtype)	(((dbtype) >= 3) ? 3 : 0)
+#define IP2L_BIN_POSITION_CITY(dbtype)		(((dbtype) >= 3) ? 4 : 0)
+
+typedef struct {
+	int            status;		// 0: not opened, 1: ok, -1: not usable
+	const uint8_t *map;
+	size_t         size;
+	uint8_t        dbtype;
+	uint8_t        dbcolumn;
+	uint32_t       ipv4_count;
+	uint32_t       ipv4_addr;
+	uint32_t       ipv6_count;
+	uint32_t       ipv6_addr;
+	uint32_t       ipv4_index;
+	uint32_t       ipv6_index;
+} s_ipv6calc_ip2location_bin;
+
+static s_ipv6calc_ip2location_bin bin_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)];
+
+// use native reader (option: --db-ip2location-disable-native)
+int ip2location_db_native = 1;
+
+
+/* read 32-bit little endian value at 1-based file position */
+static int libipv6calc_db_wrapper_IP2Location_bin_read32(const s_ipv6calc_ip2location_bin *binp, const uint64_t pos, uint32_t *value) {
+	const uint8_t *p;
+
+	if ((pos < 1) || (pos - 1 + 4 > binp->size)) {
+		return(-1);
+	};
+
+	p = binp->map + pos - 1;
+	*value = (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+	return(0);
+};
+
+
+/* read 128-bit little endian value at 1-based file position into 4x 32-bit (MSB first) */
+static int libipv6calc_db_wrapper_IP2Location_bin_read128(const s_ipv6calc_ip2location_bin *binp, const uint64_t pos, uint32_t *value) {
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		if (libipv6calc_db_wrapper_IP2Location_bin_read32(binp, pos + 12 - 4 * i, &value[i]) != 0) {
+			return(-1);
+		};
+	};
+	return(0);
+};
+
+
+/* read string (length byte + characters) at 0-based file position */
+static int libipv6calc_db_wrapper_IP2Location_bin_string(const s_ipv6calc_ip2location_bin *binp, const uint32_t pos, char *string, const size_t string_len) {
+	size_t length;
+
+	if ((size_t) pos + 1 > binp->size) {
+		return(-1);
+	};
+
+	length = binp->map[pos];
+	if ((size_t) pos + 1 + length > binp->size) {
+		return(-1);
+	};
+
+	if (length > string_len - 1) {
+		length = string_len - 1;
+	};
+
+	memcpy(string, binp->map + pos + 1, length);
+	string[length] = '\0';
+	return(0);
+};
+
+
+/*
+ * map BIN file of a database type (cached)
+ *  caller has to hold the IP2Location feature lock (bin_cache[] entry is set up on first call)
+ * ret: pointer to mapped database, NULL if not usable
+ */
+static const s_ipv6calc_ip2location_bin *libipv6calc_db_wrapper_IP2Location_bin_open_type(const unsigned int type) {
+	s_ipv6calc_ip2location_bin *binp;
+	const uint8_t *h;
+	char *filename;
+	struct stat st;
+	void *map;
+	int entry = -1, i, fd;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+		if (libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number == type) {
+			entry = i;
+			break;
+		};
+	};
+
+	if (entry < 0) {
+		return(NULL);
+	};
+
+	binp = &bin_cache[entry];
+
+	if (binp->status == 1) {
+		return(binp);
+	} else if (binp->status == -1) {
+		return(NULL);
+	};
+
+	binp->status = -1; // not usable unless all checks passed
+
+	filename = libipv6calc_db_wrapper_IP2Location_dbfilename(type);
+	if (filename == NULL) {
+		return(NULL);
+	};
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Can't open BIN file: %s (%s)", filename, strerror(errno));
+		return(NULL);
+	};
+
+	if ((fstat(fd, &st) != 0) || (st.st_size < IP2L_BIN_HEADER_SIZE)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "BIN file too short or not accessible: %s", filename);
+		close(fd);
+		return(NULL);
+	};
+
+	map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (map == MAP_FAILED) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Can't map BIN file: %s (%s)", filename, strerror(errno));
+		return(NULL);
+	};
+
+	binp->map = (const uint8_t *) map;
+	binp->size = (size_t) st.st_size;
+
+	h = binp->map;
+	binp->dbtype   = h[IP2L_BIN_HEADER_DBTYPE];
+	binp->dbcolumn = h[IP2L_BIN_HEADER_DBCOLUMN];
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV4_COUNT + 1, &binp->ipv4_count);
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV4_ADDR + 1, &binp->ipv4_addr);
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV6_COUNT + 1, &binp->ipv6_count);
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV6_ADDR + 1, &binp->ipv6_addr);
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV4_INDEX + 1, &binp->ipv4_index);
+	libipv6calc_db_wrapper_IP2Location_bin_read32(binp, IP2L_BIN_HEADER_IPV6_INDEX + 1, &binp->ipv6_index);
+
+	if ((binp->dbtype < 1) || (binp->dbcolumn < 2) \
+	  || (binp->ipv4_addr > binp->size) || (binp->ipv6_addr > binp->size) \
+	  || (binp->ipv4_index > binp->size) || (binp->ipv6_index > binp->size)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "BIN file has unsupported header: %s (dbtype=%u dbcolumn=%u)", filename, binp->dbtype, binp->dbcolumn);
+		munmap(map, binp->size);
+		binp->map = NULL;
+		return(NULL);
+	};
+
+	binp->status = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "BIN file mapped: %s (dbtype=%u dbcolumn=%u ipv4_count=%u ipv6_count=%u)", filename, binp->dbtype, binp->dbcolumn, binp->ipv4_count, binp->ipv6_count);
+
+	return(binp);
+};
+
+
+/*
+ * search row of an address (same algorithm as library: index, then binary search)
+ * ret: 1-based file position of fields of matching row (column 1 = IP from), 0 = not found
+ */
+static uint64_t libipv6calc_db_wrapper_IP2Location_bin_row(const s_ipv6calc_ip2location_bin *binp, const ipv6calc_ipaddr *ipaddrp) {
+	uint64_t base, row_size, pos;
+	int64_t low = 0, high, mid;
+	uint32_t ipno, from, to, ip[4], ip_from[4], ip_to[4];
+	int i, c_from, c_to;
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		if ((binp->ipv4_count == 0) || (binp->ipv4_addr == 0)) {
+			return(0);
+		};
+
+		ipno = ipaddrp->addr[0];
+		if (ipno == 0xffffffffu) {
+			ipno--;
+		};
+
+		base = binp->ipv4_addr;
+		row_size = (uint64_t) binp->dbcolumn * 4;
+		high = binp->ipv4_count;
+
+		if (binp->ipv4_index > 0) {
+			pos = binp->ipv4_index + ((uint64_t) (ipno >> 16) << 3);
+			if ((libipv6calc_db_wrapper_IP2Location_bin_read32(binp, pos, &from) != 0) || (libipv6calc_db_wrapper_IP2Location_bin_read32(binp, pos + 4, &to) != 0)) {
+				return(0);
+			};
+			low = from;
+			high = to;
+		};
+
+		while (low <= high) {
+			mid = (low + high) / 2;
+			if ((libipv6calc_db_wrapper_IP2Location_bin_read32(binp, base + mid * row_size, &from) != 0) \
+			  || (libipv6calc_db_wrapper_IP2Location_bin_read32(binp, base + (mid + 1) * row_size, &to) != 0)) {
+				return(0);
+			};
+
+			if ((ipno >= from) && (ipno < to)) {
+				return(base + mid * row_size);
+			} else if (ipno < from) {
+				high = mid - 1;
+			} else {
+				low = mid + 1;
+			};
+		};
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		if ((binp->ipv6_count == 0) || (binp->ipv6_addr == 0)) {
+			return(0);
+		};
+
+		for (i = 0; i < 4; i++) {
+			ip[i] = ipaddrp->addr[i];
+		};
+
+		if ((ip[0] & ip[1] & ip[2] & ip[3]) == 0xffffffffu) {
+			ip[3]--;
+		};
+
+		base = binp->ipv6_addr;
+		row_size = (uint64_t) binp->dbcolumn * 4 + 12;
+		high = binp->ipv6_count;
+
+		if (binp->ipv6_index > 0) {
+			pos = binp->ipv6_index + ((uint64_t) (ip[0] >> 16) << 3);
+			if ((libipv6calc_db_wrapper_IP2Location_bin_read32(binp, pos, &from) != 0) || (libipv6calc_db_wrapper_IP2Location_bin_read32(binp, pos + 4, &to) != 0)) {
+				return(0);
+			};
+			low = from;
+			high = to;
+		};
+
+		while (low <= high) {
+			mid = (low + high) / 2;
+			if ((libipv6calc_db_wrapper_IP2Location_bin_read128(binp, base + mid * row_size, ip_from) != 0) \
+			  || (libipv6calc_db_wrapper_IP2Location_bin_read128(binp, base + (mid + 1) * row_size, ip_to) != 0)) {
+				return(0);
+			};
+
+			c_from = 0; c_to = 0;
+			for (i = 0; i < 4; i++) {
+				if ((c_from == 0) && (ip[i] != ip_from[i])) {
+					c_from = (ip[i] > ip_from[i]) ? 1 : -1;
+				};
+				if ((c_to == 0) && (ip[i] != ip_to[i])) {
+					c_to = (ip[i] > ip_to[i]) ? 1 : -1;
+				};
+			};
+
+			if ((c_from >= 0) && (c_to < 0)) {
+				// fields start after 128-bit IP from (column 1 has 4 bytes in layout)
+				return(base + mid * row_size + 12);
+			} else if (c_from < 0) {
+				high = mid - 1;
+			} else {
+				low = mid + 1;
+			};
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * read string field of a row
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_db_wrapper_IP2Location_bin_field(const s_ipv6calc_ip2location_bin *binp, const uint64_t row, const int position, char *string, const size_t string_len) {
+	uint32_t offset;
+
+	if (libipv6calc_db_wrapper_IP2Location_bin_read32(binp, row + 4 * (position - 1), &offset) != 0) {
+		return(-1);
+	};
+
+	return(libipv6calc_db_wrapper_IP2Location_bin_string(binp, offset, string, string_len));
+};
+
+
+/*
+ * check whether native reader can handle the address
+ *  IPv6 addresses with embedded IPv4 address are mapped by the library, leave them to it
+ */
+static int libipv6calc_db_wrapper_IP2Location_bin_supported(const ipv6calc_ipaddr *ipaddrp) {
+	if (ip2location_db_native == 0) {
+		return(0);
+	};
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		return(1);
+	};
+
+	if (ipaddrp->proto != IPV6CALC_PROTO_IPV6) {
+		return(0);
+	};
+
+	if (((ipaddrp->addr[0] == 0) && (ipaddrp->addr[1] == 0) && (ipaddrp->addr[2] == 0x0000ffffu)) \
+	  || ((ipaddrp->addr[0] >> 16) == 0x2002) \
+	  || (ipaddrp->addr[0] == 0x20010000u)) {
+		// IPv4-mapped, 6to4, Teredo
+		return(0);
+	};
+
+	return(1);
+};
+
+
+/* country_code (native reader)
+ * in : ipaddrp, country, country_len
+ * ret: 0 = found, 1 = not found, -1 = native reader not usable (use library)
+ */
+int libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	const s_ipv6calc_ip2location_bin *binp;
+	unsigned int IP2Location_type = 0;
+	char country_short[4];
+	uint64_t row;
+
+	if (libipv6calc_db_wrapper_IP2Location_bin_supported(ipaddrp) == 0) {
+		return(-1);
+	};
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		IP2Location_type = ip2location_db_country_v4;
+
+		if ((ip2location_db_country_sample_v4_lite_autoswitch > 0) && (ip2location_db_country_v4_best[IP2L_COMM].num != IP2Location_type)) {
+			// lite database selected, sample database available (supporting 0.0.0.0-99.255.255.255)
+			if ((ipaddrp->addr[0] >> 24) < 100) {
+				IP2Location_type = ip2location_db_country_sample_v4_lite_autoswitch;
+			};
+		};
+	} else {
+		IP2Location_type = ip2location_db_country_v6;
+
+		if ((ip2location_db_country_sample_v6_lite_autoswitch > 0) && (ip2location_db_country_v6_best[IP2L_COMM].num != IP2Location_type)) {
+			// lite database selected, sample database available (supporting 2A04:0:0:0:0:0:0:0-2A04:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF:FFFF)
+			if ((ipaddrp->addr[0] >> 16) == 0x2a04) {
+				IP2Location_type = ip2location_db_country_sample_v6_lite_autoswitch;
+			};
+		};
+	};
+
+	if (IP2Location_type == 0) {
+		return(1);
+	};
+
+	binp = libipv6calc_db_wrapper_IP2Location_bin_open_type(IP2Location_type);
+	if (binp == NULL) {
+		return(-1);
+	};
+
+	row = libipv6calc_db_wrapper_IP2Location_bin_row(binp, ipaddrp);
+	if (row == 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location, "native reader found no row");
+		return(1);
+	};
+
+	if (libipv6calc_db_wrapper_IP2Location_bin_field(binp, row, IP2L_BIN_POSITION_COUNTRY(binp->dbtype), country_short, sizeof(country_short)) != 0) {
+		return(1);
+	};
+
+	if ((strlen(country_short) > 2) || (strcmp(country_short, "-") == 0) || (strcmp(country_short, "??") == 0)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "native reader: don't know country_short code: %s", country_short);
+		return(1);
+	};
+
+	snprintf(country, country_len, "%s", country_short);
+
+	IP2LOCATION_DB_USAGE_MAP_TAG(IP2Location_type);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "native reader returned country_short: %s", country);
+	return(0);
+};
+
+
+/* city/region (native reader)
+ * in : ipaddrp, city, city_len, region, region_len
+ * ret: 0 = found, 1 = not found, -1 = native reader not usable (use library)
+ */
+int libipv6calc_db_wrapper_IP2Location_wrapper_city_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *city, const size_t city_len, char *region, const size_t region_len) {
+	char country[4];
+
+	return(libipv6calc_db_wrapper_IP2Location_wrapper_all_by_ipaddr(ipaddrp, country, sizeof(country), city, city_len, region, region_len));
+};
+
+
+/* country_code/city/region from one row of the region/city database (native reader)
+ * in : ipaddrp, country, country_len, city, city_len, region, region_len
+ * mod: country (empty if row has no valid country code), city, region
+ * ret: 0 = found, 1 = not found, -1 = native reader not usable (use library)
+ */
+int libipv6calc_db_wrapper_IP2Location_wrapper_all_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, char *city, const size_t city_len, char *region, const size_t region_len) {
+	const s_ipv6calc_ip2location_bin *binp;
+	int IP2Location_type = 0;
+	uint64_t row;
+
+	country[0] = '\0';
+
+	if (libipv6calc_db_wrapper_IP2Location_bin_supported(ipaddrp) == 0) {
+		return(-1);
+	};
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		IP2Location_type = ip2location_db_region_city_v4;
+
+		if ((ip2location_db_region_city_sample_v4_lite_autoswitch > 0) && ((ipaddrp->addr[0] >> 24) < 100)) {
+			IP2Location_type = ip2location_db_region_city_sample_v4_lite_autoswitch;
+		};
+	} else {
+		IP2Location_type = ip2location_db_region_city_v6;
+
+		if ((ip2location_db_region_city_sample_v6_lite_autoswitch > 0) && ((ipaddrp->addr[0] >> 16) == 0x2a04)) {
+			IP2Location_type = ip2location_db_region_city_sample_v6_lite_autoswitch;
+		};
+	};
+
+	if (IP2Location_type == 0) {
+		return(1);
+	};
+
+	binp = libipv6calc_db_wrapper_IP2Location_bin_open_type(IP2Location_type);
+	if ((binp == NULL) || (IP2L_BIN_POSITION_CITY(binp->dbtype) == 0)) {
+		// database without city, library returns its placeholder text
+		return(-1);
+	};
+
+	row = libipv6calc_db_wrapper_IP2Location_bin_row(binp, ipaddrp);
+	if (row == 0) {
+		return(1);
+	};
+
+	if ((libipv6calc_db_wrapper_IP2Location_bin_field(binp, row, IP2L_BIN_POSITION_CITY(binp->dbtype), city, city_len) != 0) \
+	  || (libipv6calc_db_wrapper_IP2Location_bin_field(binp, row, IP2L_BIN_POSITION_REGION(binp->dbtype), region, region_len) != 0)) {
+		city[0] = '\0';
+		region[0] = '\0';
+		return(1);
+	};
+
+	if ((libipv6calc_db_wrapper_IP2Location_bin_field(binp, row, IP2L_BIN_POSITION_COUNTRY(binp->dbtype), country, country_len) != 0) \
+	  || (strlen(country) > 2) || (strcmp(country, "-") == 0) || (strcmp(country, "??") == 0)) {
+		country[0] = '\0';
+	};
+
+	IP2LOCATION_DB_USAGE_MAP_TAG(IP2Location_type);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "native reader returned country_short=%s city=%s region=%s", country, city, region);
+	return(0);
+};
+
+
 #endif
 
 
@@ -1968,6 +2458,14 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_cleanup(void) {
 		};
 	};
 
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+		if (bin_cache[i].status == 1) {
+			munmap((void *) bin_cache[i].map, bin_cache[i].size);
+		};
+		bin_cache[i].status = 0;
+		bin_cache[i].map = NULL;
+	};
+
 	dl_IP2Location_handle = NULL; // disable handle
 #endif
 
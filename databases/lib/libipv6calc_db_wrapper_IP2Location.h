@@ -582,6 +582,7 @@ extern const char *libipv6calc_db_wrapper_IP2Location_wrapper_asnum_by_addr (con
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_reset(void);
 
 extern char       *libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(char *addr, const int proto);
 extern char       *libipv6calc_db_wrapper_IP2Location_wrapper_country_name_by_addr(char *addr, const int proto);
@@ -608,12 +609,17 @@ extern char        *libipv6calc_db_wrapper_IP2Location_database_info(IP2Location
 
 extern IP2LocationRecord *libipv6calc_db_wrapper_IP2Location_wrapper_record_city_by_addr(char *addr, const int proto);
 
+extern int libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
+extern int libipv6calc_db_wrapper_IP2Location_wrapper_city_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *city, const size_t city_len, char *region, const size_t region_len);
+extern int libipv6calc_db_wrapper_IP2Location_wrapper_all_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, char *city, const size_t city_len, char *region, const size_t region_len);
+
 extern const char *libipv6calc_db_wrapper_IP2Location_UsageType_description(char *UsageType);
 
 extern int ip2location_db_lite_to_sample_autoswitch_max_delta_months;
 extern int ip2location_db_comm_to_lite_switch_min_delta_months;
 extern int ip2location_db_only_type;
 extern int ip2location_db_allow_softlinks;
+extern int ip2location_db_native;
 
 
 #endif
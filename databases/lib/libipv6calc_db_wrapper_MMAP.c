@@ -0,0 +1,742 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/lib/libipv6calc_db_wrapper_MMAP.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  ipv6calc MMAP (memory-mapped native format) database wrapper
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+
+#include "libipv6calc_db_wrapper.h"
+
+
+#ifdef SUPPORT_MMAP
+
+#include "libipv6calc_db_wrapper_MMAP.h"
+
+char mmap_db_dir[NI_MAXHOST] = MMAP_DB;
+
+static const char* wrapper_mmap_info = "MMAP";
+
+
+/* database usage map (tagged by lookups running in parallel without lock, see libipv6calc_db_wrapper_threads_init) */
+#define MMAP_DB_MAX_BLOCKS_32	2	// 0-63
+static uint32_t mmap_db_usage_map[MMAP_DB_MAX_BLOCKS_32];
+
+#define MMAP_DB_USAGE_MAP_TAG(db)	if (db < (32 * MMAP_DB_MAX_BLOCKS_32)) { \
+							DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Tag usage for db: %d", db); \
+							__atomic_fetch_or(&mmap_db_usage_map[db / 32], (uint32_t) 1 << (db % 32), __ATOMIC_RELAXED); \
+						} else { \
+							fprintf(stderr, "FIXME: unsupported db value (exceed limit): %d (%d)\n", db, 32 * MMAP_DB_MAX_BLOCKS_32 - 1); \
+							exit(1); \
+						};
+
+char mmap_db_usage_string[NI_MAXHOST] = "";
+
+// local cache of mappings
+typedef struct {
+	const s_ipv6calc_mmap_header	*header;	// start of mapping
+	size_t				size;		// size of mapping
+	const uint32_t			*rows;		// first row
+	const char			*pool;		// string pool
+	uint32_t			row_words;	// uint32_t per row
+} s_mmap_db;
+
+static s_mmap_db mmap_db_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc)];
+
+// creation time of databases
+time_t wrapper_db_unixtime_MMAP[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc)];
+
+
+// local prototyping
+static char     *libipv6calc_db_wrapper_MMAP_dbfilename(unsigned int type);
+static char     *libipv6calc_db_wrapper_MMAP_database_info(unsigned int type);
+static const s_mmap_db *libipv6calc_db_wrapper_MMAP_open_type(const unsigned int type);
+static void      libipv6calc_db_wrapper_MMAP_close(const int entry);
+
+
+/*
+ * function initialise the MMAP wrapper
+ *
+ * in : (nothing)
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_MMAP_wrapper_init(void) {
+	int i;
+	char *result;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called");
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Check for MMAP databases in directory: %s", mmap_db_dir);
+
+	/* check available databases for resolution */
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		// clean local cache
+		mmap_db_cache[i].header = NULL;
+		wrapper_db_unixtime_MMAP[i] = 0;
+
+		// add features to implemented
+		wrapper_features_by_source_implemented[IPV6CALC_DB_SOURCE_MMAP] |= libipv6calc_db_wrapper_MMAP_db_file_desc[i].features;
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "MMAP database test for availability: %s", libipv6calc_db_wrapper_MMAP_db_file_desc[i].filename);
+
+		if (libipv6calc_db_wrapper_MMAP_db_avail(libipv6calc_db_wrapper_MMAP_db_file_desc[i].number) != 1) {
+			// no file found
+			continue;
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "MMAP database available: %s type=%d", libipv6calc_db_wrapper_MMAP_db_file_desc[i].description, libipv6calc_db_wrapper_MMAP_db_file_desc[i].number);
+
+		result = libipv6calc_db_wrapper_MMAP_database_info(libipv6calc_db_wrapper_MMAP_db_file_desc[i].number);
+
+		if (strlen(result) == 0) {
+			// no proper database
+			continue;
+		};
+
+		if (wrapper_db_unixtime_MMAP[i] == 0) {
+			// no proper database
+			continue;
+		};
+
+		// finally mark database features as available
+		wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] |= libipv6calc_db_wrapper_MMAP_db_file_desc[i].features;
+	};
+
+	wrapper_features |= wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP];
+
+	return 0;
+};
+
+
+/*
+ * function cleanup the MMAP wrapper
+ *
+ * in : (nothing)
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_MMAP_wrapper_cleanup(void) {
+	int i;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called");
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		libipv6calc_db_wrapper_MMAP_close(i);
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Finished");
+	return 0;
+};
+
+
+/*
+ * function info of MMAP wrapper
+ *
+ * in : ptr and size of string to be filled
+ * out: modified string;
+ */
+void libipv6calc_db_wrapper_MMAP_wrapper_info(char* string, const size_t size) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called");
+
+	snprintf(string, size, "MMAP available databases: Registry4=%d Registry6=%d Country4=%d Country6=%d", \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] & IPV6CALC_DB_IPV4_TO_REGISTRY) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] & IPV6CALC_DB_IPV6_TO_REGISTRY) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] & IPV6CALC_DB_IPV4_TO_CC) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] & IPV6CALC_DB_IPV6_TO_CC) ? 1 : 0);
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Finished");
+	return;
+};
+
+
+/*
+ * function print database info of MMAP wrapper
+ *
+ * in : (void)
+ * out: (void)
+ */
+void libipv6calc_db_wrapper_MMAP_wrapper_print_db_info(const int level_verbose, const char *prefix_string) {
+	int i, type, count = 0;
+
+	const char *prefix = "\0";
+	if (prefix_string != NULL) {
+		prefix = prefix_string;
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called");
+
+	IPV6CALC_DB_FEATURE_INFO(prefix, IPV6CALC_DB_SOURCE_MMAP)
+
+	printf("%sMMAP: info of available databases in directory: %s\n", prefix, mmap_db_dir);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		type = libipv6calc_db_wrapper_MMAP_db_file_desc[i].number;
+
+		if (libipv6calc_db_wrapper_MMAP_db_avail(type)) {
+			printf("%sMMAP: %-20s: %-40s (%s)\n", prefix, libipv6calc_db_wrapper_MMAP_db_file_desc[i].description, libipv6calc_db_wrapper_MMAP_db_file_desc[i].filename, libipv6calc_db_wrapper_MMAP_database_info(type));
+			count++;
+		} else {
+			if (level_verbose == LEVEL_VERBOSE2) {
+				printf("%sMMAP: %-20s: %-40s (%s)\n", prefix, libipv6calc_db_wrapper_MMAP_db_file_desc[i].description, libipv6calc_db_wrapper_MMAP_dbfilename(type), strerror(errno));
+			};
+			continue;
+		};
+	};
+
+	if (count == 0) {
+		printf("%sMMAP: NO available databases found in directory: %s\n", prefix, mmap_db_dir);
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Finished");
+	return;
+};
+
+
+/*
+ * wrapper: string regarding used database infos
+ */
+char *libipv6calc_db_wrapper_MMAP_wrapper_db_info_used(void) {
+	int type;
+	char tempstring[NI_MAXHOST];
+	char *info;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called");
+
+	for (type = 0; type < 32 * MMAP_DB_MAX_BLOCKS_32; type++) {
+		if ((mmap_db_usage_map[type / 32] & (1 << (type % 32))) != 0) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "DB type used: %d", type);
+
+			info = libipv6calc_db_wrapper_MMAP_database_info(type);
+
+			if (info == NULL) { continue; }; // NULL pointer returned
+
+			if (strlen(info) == 0) { continue; }; // empty string returned
+
+			if (strlen(mmap_db_usage_string) > 0) {
+				if (strstr(mmap_db_usage_string, info) != NULL) {
+					continue;
+				}; // string already included
+
+				snprintf(tempstring, sizeof(tempstring), "%s / %s", mmap_db_usage_string, info);
+			} else {
+				snprintf(tempstring, sizeof(tempstring), "%s", info);
+			};
+
+			snprintf(mmap_db_usage_string, sizeof(mmap_db_usage_string), "%s", tempstring);
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "type=%d mmap_db_usage_string=%s", type, mmap_db_usage_string);
+		};
+	};
+
+	return(mmap_db_usage_string);
+};
+
+
+/*
+ * wrapper: reset usage map of databases (info regarding used databases starts again)
+ */
+void libipv6calc_db_wrapper_MMAP_wrapper_db_info_used_reset(void) {
+	memset(mmap_db_usage_map, 0, sizeof(mmap_db_usage_map));
+	mmap_db_usage_string[0] = '\0';
+};
+
+
+/*******************************
+ * Wrapper extension functions for MMAP
+ *******************************/
+
+/*
+ * wrapper extension: MMAP_dbfilename
+ */
+static char *libipv6calc_db_wrapper_MMAP_dbfilename(unsigned int type) {
+	static char tempstring[NI_MAXHOST];
+	int  entry = -1, i;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called: %s type=%d", wrapper_mmap_info, type);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		if (libipv6calc_db_wrapper_MMAP_db_file_desc[i].number == type) {
+			entry = i;
+			break;
+		};
+	};
+
+	if (entry < 0) {
+		return(NULL);
+	};
+
+	snprintf(tempstring, sizeof(tempstring), "%s/%s", mmap_db_dir, libipv6calc_db_wrapper_MMAP_db_file_desc[i].filename);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Finished: %s type=%d has filename=%s", wrapper_mmap_info, type, tempstring);
+
+	return(tempstring);
+};
+
+
+/*
+ * wrapper extension: MMAP_dbdescription
+ */
+const char *libipv6calc_db_wrapper_MMAP_dbdescription(const unsigned int type) {
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		if (libipv6calc_db_wrapper_MMAP_db_file_desc[i].number == type) {
+			return(libipv6calc_db_wrapper_MMAP_db_file_desc[i].description);
+		};
+	};
+
+	return("unknown");
+};
+
+
+/*
+ * wrapper extension: MMAP_db_avail
+ * ret: 1=avail  0=not-avail
+ */
+int libipv6calc_db_wrapper_MMAP_db_avail(const unsigned int type) {
+	char *filename;
+	int r = 0;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called: %s type=%d", wrapper_mmap_info, type);
+
+	filename = libipv6calc_db_wrapper_MMAP_dbfilename(type);
+
+	if (filename == NULL) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	r = (access(filename, R_OK) == 0) ? 1:0;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Finished: %s type=%d (%s) (r=%d)", wrapper_mmap_info, type, filename, r);
+
+END_libipv6calc_db_wrapper:
+	return(r);
+};
+
+
+/*
+ * wrapper extension: MMAP_close
+ */
+static void libipv6calc_db_wrapper_MMAP_close(const int entry) {
+	if (mmap_db_cache[entry].header != NULL) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Unmap database entry=%d", entry);
+		munmap((void *) mmap_db_cache[entry].header, mmap_db_cache[entry].size);
+		mmap_db_cache[entry].header = NULL;
+	};
+};
+
+
+/*
+ * wrapper extension: MMAP_open_type
+ *  maps the whole file read-only and shared, so all processes use the same page cache
+ *  mapping is kept open until cleanup
+ */
+static const s_mmap_db *libipv6calc_db_wrapper_MMAP_open_type(const unsigned int type) {
+	const s_ipv6calc_mmap_header *header;
+	struct stat st;
+	char *filename;
+	void *map;
+	int entry = -1, i, fd;
+	uint64_t rows_size;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called: %s type=%d", wrapper_mmap_info, type);
+
+	// check for valid type
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		if (libipv6calc_db_wrapper_MMAP_db_file_desc[i].number == type) {
+			entry = i;
+			break;
+		};
+	};
+
+	if (entry < 0) {
+		return(NULL);
+	};
+
+	if (mmap_db_cache[entry].header != NULL) {
+		// already mapped
+		return(&mmap_db_cache[entry]);
+	};
+
+	filename = libipv6calc_db_wrapper_MMAP_dbfilename(type);
+
+	if (filename == NULL) {
+		return(NULL);
+	};
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "open failed: %s (%s)", strerror(errno), filename);
+		return(NULL);
+	};
+
+	if ((fstat(fd, &st) != 0) || (st.st_size < (off_t) sizeof(s_ipv6calc_mmap_header))) {
+		ERRORPRINT_WA("database file too short or not readable: %s", filename);
+		close(fd);
+		return(NULL);
+	};
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (map == MAP_FAILED) {
+		ERRORPRINT_WA("mmap failed: %s (%s)", strerror(errno), filename);
+		return(NULL);
+	};
+
+	header = (const s_ipv6calc_mmap_header *) map;
+
+	// validate header
+	if (memcmp(header->magic, IPV6CALC_MMAP_MAGIC, sizeof(header->magic)) != 0) {
+		ERRORPRINT_WA("database has no proper magic: %s", filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	if (header->byteorder != IPV6CALC_MMAP_BYTEORDER) {
+		ERRORPRINT_WA("database has unsupported byte order: %s", filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	if (header->version != IPV6CALC_MMAP_VERSION) {
+		ERRORPRINT_WA("database has unsupported version %u (supported: %u): %s", header->version, IPV6CALC_MMAP_VERSION, filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	if ((header->type != type) || (header->key_length != (((libipv6calc_db_wrapper_MMAP_db_file_desc[entry].features & IPV6CALC_DB_MMAP_IPV4) != 0) ? 32 : 64))) {
+		ERRORPRINT_WA("database has unexpected type=%u or key_length=%u: %s", header->type, header->key_length, filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	// feature bits are hardcoded in generator, reject database of a generator not matching this library
+	if (header->features != libipv6calc_db_wrapper_MMAP_db_file_desc[entry].features) {
+		ERRORPRINT_WA("database has unexpected features=0x%08x (expected: 0x%08x), regenerate with matching ipv6calc-db-mmap-generate.pl: %s", header->features, libipv6calc_db_wrapper_MMAP_db_file_desc[entry].features, filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	mmap_db_cache[entry].row_words = (header->key_length / 32) * 2 + 1;
+
+	rows_size = (uint64_t) header->num_rows * mmap_db_cache[entry].row_words * sizeof(uint32_t);
+
+	if ((header->num_rows == 0) \
+	  || ((header->rows_offset % sizeof(uint32_t)) != 0) \
+	  || ((uint64_t) header->rows_offset + rows_size > (uint64_t) st.st_size) \
+	  || ((uint64_t) header->pool_offset + header->pool_size > (uint64_t) st.st_size) \
+	  || (header->pool_size == 0) \
+	  || (((const char *) map)[header->pool_offset + header->pool_size - 1] != '\0')) {
+		ERRORPRINT_WA("database has inconsistent layout, corrupt database: %s", filename);
+		goto END_libipv6calc_db_wrapper_unmap;
+	};
+
+	// rows are accessed in order of binary search
+	madvise(map, st.st_size, MADV_RANDOM);
+
+	mmap_db_cache[entry].header = header;
+	mmap_db_cache[entry].size = st.st_size;
+	mmap_db_cache[entry].rows = (const uint32_t *) ((const char *) map + header->rows_offset);
+	mmap_db_cache[entry].pool = (const char *) map + header->pool_offset;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Database successfully mapped: type=%d rows=%u key_length=%u size=%lu", type, header->num_rows, header->key_length, (unsigned long) st.st_size);
+
+	return(&mmap_db_cache[entry]);
+
+END_libipv6calc_db_wrapper_unmap:
+	munmap(map, st.st_size);
+	return(NULL);
+};
+
+
+/*
+ * wrapper extension: MMAP_lookup
+ *  binary search over sorted, non-overlapping ranges
+ * ret: pointer to data string, NULL if not found
+ */
+static const char *libipv6calc_db_wrapper_MMAP_lookup(const s_mmap_db *mdbp, const uint32_t key_00_31, const uint32_t key_32_63) {
+	const uint32_t *row;
+	uint32_t i_min = 0, i_max = mdbp->header->num_rows, i;
+	uint32_t pool_offset;
+
+	if (mdbp->header->key_length == 32) {
+		// row: first, last, pool_offset
+		while (i_min < i_max) {
+			i = i_min + (i_max - i_min) / 2;
+			row = mdbp->rows + (size_t) i * 3;
+
+			if (key_00_31 < row[0]) {
+				i_max = i;
+			} else if (key_00_31 > row[1]) {
+				i_min = i + 1;
+			} else {
+				pool_offset = row[2];
+				goto END_libipv6calc_db_wrapper_match;
+			};
+		};
+	} else {
+		// row: first_00_31, first_32_63, last_00_31, last_32_63, pool_offset
+		uint64_t key = ((uint64_t) key_00_31 << 32) | key_32_63;
+
+		while (i_min < i_max) {
+			i = i_min + (i_max - i_min) / 2;
+			row = mdbp->rows + (size_t) i * 5;
+
+			if (key < (((uint64_t) row[0] << 32) | row[1])) {
+				i_max = i;
+			} else if (key > (((uint64_t) row[2] << 32) | row[3])) {
+				i_min = i + 1;
+			} else {
+				pool_offset = row[4];
+				goto END_libipv6calc_db_wrapper_match;
+			};
+		};
+	};
+
+	return(NULL);
+
+END_libipv6calc_db_wrapper_match:
+	if (pool_offset >= mdbp->header->pool_size) {
+		ERRORPRINT_WA("data offset out of range, corrupt database: %u", pool_offset);
+		return(NULL);
+	};
+
+	return(mdbp->pool + pool_offset);
+};
+
+
+/*******************************
+ * Wrapper functions for MMAP
+ *******************************/
+
+/*
+ * wrapper: MMAP_database_info
+ */
+static char *libipv6calc_db_wrapper_MMAP_database_info(const unsigned int type) {
+	static char resultstring[NI_MAXHOST] = "";
+	char datastring[NI_MAXHOST];
+	const s_mmap_db *mdbp;
+	int i, entry = -1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called: %s", wrapper_mmap_info);
+
+	// check for valid type
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		if (libipv6calc_db_wrapper_MMAP_db_file_desc[i].number == (type & 0xffff)) {
+			entry = i;
+			break;
+		};
+	};
+
+	if (entry < 0) {
+		ERRORPRINT_WA("Invalid type (FIX CODE): %d", type);
+		snprintf(resultstring, sizeof(resultstring), "%s", "");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	mdbp = libipv6calc_db_wrapper_MMAP_open_type(type);
+
+	if (mdbp == NULL) {
+		snprintf(resultstring, sizeof(resultstring), "%s", "(CAN'T OPEN database information)");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	wrapper_db_unixtime_MMAP[entry] = (time_t) mdbp->header->unixtime;
+
+	if (wrapper_db_unixtime_MMAP[entry] == 0) {
+		snprintf(resultstring, sizeof(resultstring), "%s", "'unixtime' is not proper, unsupported db file");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	strftime(datastring, sizeof(datastring), "%Y%m%d-%H%M%S UTC", gmtime(&wrapper_db_unixtime_MMAP[entry]));
+	snprintf(resultstring, sizeof(resultstring), "MMAPDB-%d/%.*s, created: %s", type, (int) sizeof(mdbp->header->dbdate), mdbp->header->dbdate, datastring);
+
+END_libipv6calc_db_wrapper:
+	return(resultstring);
+};
+
+
+/*********************************************
+ * Abstract functions
+ * *******************************************/
+
+/* query for available features
+ * ret=-1: unknown
+ * 0 : not matching
+ * 1 : ok
+ */
+int libipv6calc_db_wrapper_MMAP_has_features(uint32_t features) {
+	int result = -1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Called with feature value to test: 0x%08x", features);
+
+	if ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_MMAP] & features) == features) {
+		result = 1;
+	} else {
+		result = 0;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Return with result: %d", result);
+	return(result);
+};
+
+
+/* query db_unixtime by feature
+ * ret: newest db_unixtime of databases providing the feature, 0 if unknown
+ */
+time_t libipv6calc_db_wrapper_MMAP_db_unixtime_by_feature(uint32_t feature) {
+	time_t result = 0;
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc); i++) {
+		if ((libipv6calc_db_wrapper_MMAP_db_file_desc[i].features & feature) == feature) {
+			if (wrapper_db_unixtime_MMAP[i] > result) {
+				result = wrapper_db_unixtime_MMAP[i];
+			};
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Return for feature=0x%08x db_unixtime=%ld", feature, (long int) result);
+	return(result);
+};
+
+
+/*
+ * get registry number of an IPv4/IPv6 address
+ *
+ * in:  ipaddr
+ * out: assignment number (-1 = no result)
+ */
+int libipv6calc_db_wrapper_MMAP_registry_num_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	const s_mmap_db *mdbp;
+	const char *data;
+	int i;
+	int retval = REGISTRY_UNKNOWN;
+
+	int MMAP_type;
+
+	switch (ipaddrp->proto) {
+	    case IPV6CALC_PROTO_IPV4:
+		MMAP_type = MMAP_DB_IPV4_REGISTRY;
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Given IPv4 address: %08x", (unsigned int) ipaddrp->addr[0]);
+		break;
+
+	    case IPV6CALC_PROTO_IPV6:
+		MMAP_type = MMAP_DB_IPV6_REGISTRY;
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "Given IPv6 address prefix (0-63): %08x%08x", (unsigned int) ipaddrp->addr[0], (unsigned int) ipaddrp->addr[1]);
+		break;
+
+	    default:
+		ERRORPRINT_WA("unsupported protocol: %d (FIX CODE)", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+		break;
+	};
+
+	mdbp = libipv6calc_db_wrapper_MMAP_open_type(MMAP_type);
+
+	if (mdbp == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Error opening MMAP by type");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	data = libipv6calc_db_wrapper_MMAP_lookup(mdbp, ipaddrp->addr[0], (ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? 0 : ipaddrp->addr[1]);
+
+	if (data == NULL) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "no match found in database type=%d", MMAP_type);
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "data=%s", data);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_registries); i++) {
+		if (strcmp(data, ipv6calc_registries[i].tokensimple) == 0) {
+			retval = ipv6calc_registries[i].number;
+			break;
+		};
+	};
+
+	if (retval == REGISTRY_UNKNOWN) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "did not return a record for 'registry'");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	MMAP_DB_USAGE_MAP_TAG(MMAP_type);
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "retval=%d", retval);
+	return(retval);
+};
+
+
+/*
+ * get country code of an IPv4/IPv6 address
+ *
+ * in:  ipaddr
+ * mod: country code
+ * out: status of retrievment (0=success, -1=problem)
+ */
+int libipv6calc_db_wrapper_MMAP_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	const s_mmap_db *mdbp;
+	const char *data;
+	int retval = -1;
+
+	int MMAP_type;
+
+	switch (ipaddrp->proto) {
+	    case IPV6CALC_PROTO_IPV4:
+		MMAP_type = MMAP_DB_IPV4_COUNTRYCODE;
+		break;
+
+	    case IPV6CALC_PROTO_IPV6:
+		MMAP_type = MMAP_DB_IPV6_COUNTRYCODE;
+		break;
+
+	    default:
+		ERRORPRINT_WA("unsupported protocol: %d (FIX CODE)", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+		break;
+	};
+
+	mdbp = libipv6calc_db_wrapper_MMAP_open_type(MMAP_type);
+
+	if (mdbp == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "Error opening MMAP by type");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	data = libipv6calc_db_wrapper_MMAP_lookup(mdbp, ipaddrp->addr[0], (ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? 0 : ipaddrp->addr[1]);
+
+	if (data == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "no match found");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	if (strlen(data) != 2) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMAP, "did not return a record for 'CountryCode'");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	snprintf(country, country_len, "%s", data);
+
+	retval = 0;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMAP, "result CountryCode=%s", country);
+
+	MMAP_DB_USAGE_MAP_TAG(MMAP_type);
+
+END_libipv6calc_db_wrapper:
+	return(retval);
+};
+
+#endif //SUPPORT_MMAP
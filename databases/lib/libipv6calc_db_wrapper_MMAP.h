@@ -0,0 +1,94 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/lib/libipv6calc_db_wrapper_MMAP.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipv6calc_db_wrapper_MMAP.c
+ */
+
+#include <time.h>
+#include "ipv6calctypes.h"
+
+#ifndef _libipv6calc_db_wrapper_MMAP_h
+
+#define _libipv6calc_db_wrapper_MMAP_h 1
+
+// database types
+#define MMAP_DB_IPV4_REGISTRY					1
+#define MMAP_DB_IPV6_REGISTRY					2
+#define MMAP_DB_IPV4_COUNTRYCODE				3
+#define MMAP_DB_IPV6_COUNTRYCODE				4
+#define MMAP_DB_MAX						(4 + 1)
+
+
+static const db_file_desc libipv6calc_db_wrapper_MMAP_db_file_desc[] = {
+	{ MMAP_DB_IPV4_REGISTRY   , "ipv6calc-mmap-ipv4-registry.bin"      , "IPv4 Registry"    , IPV6CALC_DB_IPV4_TO_REGISTRY | IPV6CALC_DB_MMAP_IPV4 },
+	{ MMAP_DB_IPV6_REGISTRY   , "ipv6calc-mmap-ipv6-registry.bin"      , "IPv6 Registry"    , IPV6CALC_DB_IPV6_TO_REGISTRY | IPV6CALC_DB_MMAP_IPV6 },
+	{ MMAP_DB_IPV4_COUNTRYCODE, "ipv6calc-mmap-ipv4-countrycode.bin"   , "IPv4 CountryCode" , IPV6CALC_DB_IPV4_TO_CC       | IPV6CALC_DB_MMAP_IPV4 },
+	{ MMAP_DB_IPV6_COUNTRYCODE, "ipv6calc-mmap-ipv6-countrycode.bin"   , "IPv6 CountryCode" , IPV6CALC_DB_IPV6_TO_CC       | IPV6CALC_DB_MMAP_IPV6 },
+};
+
+
+/*
+ * on-disk format (read-only, mapped as a whole, written in host byte order)
+ *
+ *  header   : s_ipv6calc_mmap_header
+ *  rows     : num_rows x (2 * key_length / 32 + 1) uint32_t
+ *               first[_00_31,_32_63] last[_00_31,_32_63] pool_offset
+ *             sorted by first, ranges do not overlap
+ *  pool     : NUL terminated data strings, referenced by pool_offset
+ */
+#define IPV6CALC_MMAP_MAGIC		"I6CMMAP"	// incl. terminating NUL = 8 bytes
+#define IPV6CALC_MMAP_VERSION		1
+#define IPV6CALC_MMAP_BYTEORDER		0x01020304
+
+typedef struct {
+	char		magic[8];	// IPV6CALC_MMAP_MAGIC
+	uint32_t	byteorder;	// IPV6CALC_MMAP_BYTEORDER
+	uint32_t	version;	// IPV6CALC_MMAP_VERSION
+	uint32_t	type;		// MMAP_DB_*
+	uint32_t	features;	// IPV6CALC_DB_* feature bitmask
+	uint32_t	key_length;	// 32 or 64
+	uint32_t	num_rows;	// number of rows
+	uint32_t	rows_offset;	// file offset of rows
+	uint32_t	pool_offset;	// file offset of string pool
+	uint32_t	pool_size;	// size of string pool
+	uint32_t	reserved;
+	int64_t		unixtime;	// creation time
+	char		dbdate[32];	// date of source data
+} s_ipv6calc_mmap_header;
+
+
+// creation time of databases
+extern time_t wrapper_db_unixtime_MMAP[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_MMAP_db_file_desc)];
+
+#endif
+
+extern int         libipv6calc_db_wrapper_MMAP_wrapper_init(void);
+extern int         libipv6calc_db_wrapper_MMAP_wrapper_cleanup(void);
+extern void        libipv6calc_db_wrapper_MMAP_wrapper_info(char* string, const size_t size);
+extern void        libipv6calc_db_wrapper_MMAP_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
+extern char       *libipv6calc_db_wrapper_MMAP_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_MMAP_wrapper_db_info_used_reset(void);
+
+extern int         libipv6calc_db_wrapper_MMAP_has_features(uint32_t features);
+extern time_t      libipv6calc_db_wrapper_MMAP_db_unixtime_by_feature(uint32_t feature);
+
+
+#ifdef SUPPORT_MMAP
+
+extern char mmap_db_dir[NI_MAXHOST];
+
+extern int          libipv6calc_db_wrapper_MMAP_db_avail(const unsigned int type);
+
+extern const char  *libipv6calc_db_wrapper_MMAP_dbdescription(const unsigned int type);
+
+// IPv4/v6 Registry Number
+extern int libipv6calc_db_wrapper_MMAP_registry_num_by_addr(const ipv6calc_ipaddr *ipaddrp);
+
+// IPv4/v6 CountryCode
+extern int libipv6calc_db_wrapper_MMAP_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
+
+#endif
@@ -83,7 +83,7 @@ print OUT qq| * Generated     : $now_string
 my $sb = stat($INFILE);
 print OUT "\/\*\@unused\@\*\/ static const char* libieee_" . $TYPE . "_status __attribute__ ((__unused__)) = \"" . uc($TYPE) . "/" . strftime("%Y%m%d", localtime($sb->mtime)) . "\";\n";
 
-# Structure
+# Structure (entries sorted by id and subid_begin)
 print OUT qq|
 
 static const s_ieee_$TYPE libieee_${TYPE}[] = {
@@ -100,6 +100,9 @@ my $oui_minor_end;
 
 my $state = 0;
 
+# entries, sorted by major/minor on output (required by binary search in lookup)
+my %entries;
+
 my $i = 0;
 while (<IN>) {
 	my $line = $_;
@@ -249,11 +252,20 @@ while (<IN>) {
 	};
 
 	if ($state == 2) {
-		print OUT "\t{ " . $oui_major . ", " . $oui_minor_begin . ", " . $oui_minor_end . ", \"" . $oui_owner . "\", \"" . $oui_owner_short . "\" },\n";
+		my $key = sprintf("%06x%06x", hex($oui_major), hex($oui_minor_begin));
+
+		# first entry wins on duplicate major/minor
+		if (! defined $entries{$key}) {
+			$entries{$key} = "\t{ " . $oui_major . ", " . $oui_minor_begin . ", " . $oui_minor_end . ", \"" . $oui_owner . "\", \"" . $oui_owner_short . "\" },\n";
+		};
 		$state = 0;
 	};
 };
 
+foreach my $key (sort keys %entries) {
+	print OUT $entries{$key};
+};
+
 print OUT qq|
 };
 |;
@@ -14,6 +14,12 @@
 #include <stdlib.h> 
 #include <getopt.h> 
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #include "config.h"
 
@@ -72,6 +78,20 @@ long int ipv6calc_debug = 0; // ipv6calc_debug usage ok
 int input_is_pipe = 0;
 #define LINEBUFFER      16384
 
+/* pipe mode workers */
+static int  pipe_workers = 0;		// --workers, 0: serial
+static int  pipe_worker = 0;		// 1: running as worker of a pipe mode parent
+static FILE *pipe_input = NULL;		// stdin or chunk stream from parent
+
+/* chunk markers in stream to worker (lines starting with NUL, not contained in text input) */
+#define PIPE_MARK_BEGIN	"ipv6calc-chunk-begin "
+#define PIPE_MARK_END	"ipv6calc-chunk-end"
+
+static void pipe_workers_start(const int workers, const int linecounter, const int retval, const int flush_mode);
+static uint32_t bulk_input_next(const int argc, char *argv[], int *argip, int *linecounterp, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp);
+static int  aggregate_input(const int argc, char *argv[], const int aggregate_ipv4, const int aggregate_ipv6, const uint32_t formatoptions);
+static int  reverse_input(const int argc, char *argv[], const int reverse_ipv4, const int reverse_ipv6, const char *reverse_ptr, const uint32_t formatoptions);
+
 /* anonymization default values */
 s_ipv6calc_anon_set ipv6calc_anon_set;
 
@@ -165,6 +185,9 @@ int main(int argc, char *argv[]) {
 	ptrptr = &cptr;
 	int linecounter = 0;
 	int flush_mode = 0;
+	int aggregate_ipv4 = 32, aggregate_ipv6 = 128;
+	int reverse_ipv4 = -1, reverse_ipv6 = -1;
+	char *reverse_ptr = NULL;
 
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
@@ -253,6 +276,17 @@ int main(int argc, char *argv[]) {
 				flush_mode = 1;
 				break;
 
+			case CMD_pipe_workers:
+				pipe_workers = atoi(optarg);
+				if (pipe_workers > PIPE_WORKERS_MAX) {
+					pipe_workers = PIPE_WORKERS_MAX;
+					fprintf(stderr, " Number of workers too big, built-in limit: %d\n", pipe_workers);
+				};
+				if (pipe_workers < 0) {
+					pipe_workers = 0;
+				};
+				break;
+
 			case 'h':
 			case '?':
 				command |= CMD_printhelp;
@@ -404,6 +438,67 @@ int main(int argc, char *argv[]) {
 				};
 				break;
 
+			/* aggregation options */
+			case CMD_aggregate_ipv4:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'aggregate-ipv4' selected");
+				if ((atoi(optarg) >= 0) && (atoi(optarg) <= 32)) {
+					aggregate_ipv4 = atoi(optarg);
+				} else {
+					fprintf(stderr, " Argument of option 'aggregate-ipv4' is out or range (0-32): %d\n", atoi(optarg));
+					exit(EXIT_FAILURE);
+				};
+				action = ACTION_aggregate;
+				action_given = 1;
+				break;
+
+			case CMD_aggregate_ipv6:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'aggregate-ipv6' selected");
+				if ((atoi(optarg) >= 0) && (atoi(optarg) <= 128)) {
+					aggregate_ipv6 = atoi(optarg);
+				} else {
+					fprintf(stderr, " Argument of option 'aggregate-ipv6' is out or range (0-128): %d\n", atoi(optarg));
+					exit(EXIT_FAILURE);
+				};
+				action = ACTION_aggregate;
+				action_given = 1;
+				break;
+
+			/* reverse DNS options */
+			case CMD_reverse_ipv4:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'reverse-ipv4' selected");
+				if ((atoi(optarg) >= 0) && (atoi(optarg) <= 32) && ((atoi(optarg) & 0x7) == 0)) {
+					reverse_ipv4 = atoi(optarg);
+				} else {
+					fprintf(stderr, " Argument of option 'reverse-ipv4' is out or range (0-32, dividable by 8): %d\n", atoi(optarg));
+					exit(EXIT_FAILURE);
+				};
+				action = ACTION_genreverse;
+				action_given = 1;
+				break;
+
+			case CMD_reverse_ipv6:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'reverse-ipv6' selected");
+				if ((atoi(optarg) >= 0) && (atoi(optarg) <= 128) && ((atoi(optarg) & 0x3) == 0)) {
+					reverse_ipv6 = atoi(optarg);
+				} else {
+					fprintf(stderr, " Argument of option 'reverse-ipv6' is out or range (0-128, dividable by 4): %d\n", atoi(optarg));
+					exit(EXIT_FAILURE);
+				};
+				action = ACTION_genreverse;
+				action_given = 1;
+				break;
+
+			case CMD_reverse_ptr:
+				DEBUGPRINT_WA(DEBUG_ipv6calc_general, "special option 'reverse-ptr' selected: %s", optarg);
+				if ((strlen(optarg) == 0) || (strlen(optarg) >= NI_MAXHOST - 64)) {
+					fprintf(stderr, " Argument of option 'reverse-ptr' is empty or too long\n");
+					exit(EXIT_FAILURE);
+				};
+				reverse_ptr = optarg;
+				action = ACTION_genreverse;
+				action_given = 1;
+				break;
+
 			/* test command */
 			case CMD_test_prefix:
 			case CMD_test_ge:
@@ -681,6 +776,22 @@ int main(int argc, char *argv[]) {
 					action_given = 1;
 				};
 				break;
+
+			case CMD_filter_file:
+				DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Got prefix set file: %s", optarg);
+
+				result = libipv6calc_filter_file(optarg, &filter_master);
+
+				if (result != 0) {
+					exit(EXIT_FAILURE);
+				};
+
+				if (action == ACTION_undefined) {
+					// autodefine action
+					action = ACTION_filter;
+					action_given = 1;
+				};
+				break;
 				
 			default:
 				fprintf(stderr, "Usage: (see '%s --command -?|-h|--help' for more help)\n", PROGRAM_NAME);
@@ -822,22 +933,57 @@ int main(int argc, char *argv[]) {
 		};
 	};
 
+	if (action == ACTION_aggregate) {
+		/* aggregation consumes complete input before printing */
+		retval = aggregate_input(argc, argv, aggregate_ipv4, aggregate_ipv6, formatoptions);
+		libipv6calc_db_wrapper_cleanup();
+		exit(retval);
+	};
+
+	if (action == ACTION_genreverse) {
+		/* bulk writer of reverse DNS names */
+		retval = reverse_input(argc, argv, reverse_ipv4, reverse_ipv6, reverse_ptr, formatoptions);
+		libipv6calc_db_wrapper_cleanup();
+		exit(retval);
+	};
+
 	/* loop for pipe */
 	if (input_is_pipe == 1) {
+		if (pipe_input == NULL) {
+			pipe_input = stdin;
+		};
 PIPE_input:
                 /* read line from stdin */
-                charptr = fgets(linebuffer, LINEBUFFER, stdin);
+                charptr = fgets(linebuffer, LINEBUFFER, pipe_input);
 
 		if (charptr == NULL) {
 			/* end of input */
 			exit(retval);
 		};
 
+		if ((pipe_worker == 1) && (linebuffer[0] == '\0')) {
+			if (strncmp(linebuffer + 1, PIPE_MARK_BEGIN, strlen(PIPE_MARK_BEGIN)) == 0) {
+				/* begin of chunk, take over line number */
+				linecounter = atoi(linebuffer + 1 + strlen(PIPE_MARK_BEGIN)) - 1;
+				goto PIPE_input;
+			} else if (strncmp(linebuffer + 1, PIPE_MARK_END, strlen(PIPE_MARK_END)) == 0) {
+				/* end of chunk, terminate output and error messages of chunk for parent */
+				fputc('\0', stdout);
+				fflush(stdout);
+				fputc('\0', stderr);
+				fflush(stderr);
+				goto PIPE_input;
+			};
+		};
+
 		linecounter++;
 
 		if (linecounter == 1) {
 			DEBUGPRINT_NA(DEBUG_ipv6calc_general, "Ok, proceeding stdin...");
 		};
+
+		/* info regarding used databases covers only the current line (independent from previous lines and from pipe workers) */
+		libipv6calc_db_wrapper_db_info_used_reset();
 		
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Line: %d", linecounter);
 
@@ -2088,6 +2234,11 @@ RESULT_print:
 		if (flush_mode == 1) {
 			fflush(stdout);
 		};
+
+		if ((pipe_workers > 0) && (pipe_worker == 0)) {
+			/* state is now set up by first line, following lines are processed by workers */
+			pipe_workers_start(pipe_workers, linecounter, retval, flush_mode);
+		};
 		goto PIPE_input;
 	};
 
@@ -2095,3 +2246,676 @@ RESULT_print:
 
 	exit(retval);
 };
+
+
+/*
+ * bulk actions: get next address/prefix from arguments or stdin (first token of each line)
+ *
+ * mod: *argip = index of next argument, *linecounterp = line number
+ * out: *ipv4addrp|*ipv6addrp = address/prefix
+ * ret: FORMAT_ipv4addr|FORMAT_ipv6addr, FORMAT_undefined: end of input, FORMAT_auto_noresult: invalid input
+ */
+static uint32_t bulk_input_next(const int argc, char *argv[], int *argip, int *linecounterp, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp) {
+	static char linebuffer[LINEBUFFER];
+	char resultstring[NI_MAXHOST];
+	char *token, *cptr;
+	uint32_t inputtype;
+	int r;
+
+	while (1) {
+		if (input_is_pipe == 1) {
+			if (fgets(linebuffer, sizeof(linebuffer), stdin) == NULL) {
+				return(FORMAT_undefined);
+			};
+			(*linecounterp)++;
+
+			if (strlen(linebuffer) >= NI_MAXHOST) {
+				fprintf(stderr, "Line too long: %d\n", *linecounterp);
+				return(FORMAT_auto_noresult);
+			};
+
+			token = strtok_r(linebuffer, " \t\r\n", &cptr);
+			if (token == NULL) {
+				fprintf(stderr, "Line contains no token: %d\n", *linecounterp);
+				continue;
+			};
+		} else {
+			if (*argip >= argc) {
+				return(FORMAT_undefined);
+			};
+			token = argv[(*argip)++];
+		};
+		break;
+	};
+
+	inputtype = libipv6calc_parse_ipaddr_fast(token, ipv4addrp, ipv6addrp);
+	if (inputtype != FORMAT_auto_noresult) {
+		return(inputtype);
+	};
+
+	/* not plain, full parser */
+	inputtype = libipv6calc_autodetectinput(token);
+
+	r = 1;
+	if (inputtype == FORMAT_ipv4addr) {
+		r = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), ipv4addrp);
+	} else if (inputtype == FORMAT_ipv6addr) {
+		r = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), ipv6addrp);
+	};
+
+	if (r != 0) {
+		if (input_is_pipe == 1) {
+			fprintf(stderr, "Line contains no IPv4/IPv6 address: %d\n", *linecounterp);
+		} else {
+			fprintf(stderr, "No IPv4/IPv6 address given: %s\n", token);
+		};
+		return(FORMAT_auto_noresult);
+	};
+
+	return(inputtype);
+};
+
+
+/*
+ * aggregation: print prefix of set
+ */
+static void aggregate_print(const ipv6calc_ipaddr *ipaddrp, const int length, void *data) {
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t formatoptions = *((uint32_t *) data);
+	char resultstring[NI_MAXHOST] = "";
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		CONVERT_IPADDRP_IPV4ADDR(ipaddrp, ipv4addr);
+		ipv4addr.prefixlength = (uint8_t) length;
+		ipv4addr.flag_prefixuse = 1;
+		libipv4addr_ipv4addrstruct_to_string(&ipv4addr, resultstring, sizeof(resultstring), formatoptions & ~FORMATOPTION_machinereadable);
+	} else {
+		CONVERT_IPADDRP_IPV6ADDR(ipaddrp, ipv6addr);
+		ipv6addr.prefixlength = (uint8_t) length;
+		ipv6addr.flag_prefixuse = 1;
+		if ((ipaddrp->addr[0] == 0) && (ipaddrp->addr[1] == 0)) {
+			/* typeinfo only required for format of embedded IPv4 address */
+			ipv6addr.typeinfo = ipv6addr_gettype(&ipv6addr, &ipv6addr.typeinfo2);
+		};
+		librfc1884_ipv6addrstruct_to_compaddr(&ipv6addr, resultstring, sizeof(resultstring), formatoptions);
+	};
+
+	fprintf(stdout, "%s\n", resultstring);
+};
+
+
+/*
+ * aggregation: collect addresses/prefixes from arguments or stdin,
+ * print merged minimal prefix list (IPv4 first, each in ascending order)
+ *
+ * in : aggregate_ipv4/aggregate_ipv6 = maximum prefix length of result
+ * ret: 0=ok, 1=error (invalid lines are skipped in pipe mode)
+ */
+static int aggregate_input(const int argc, char *argv[], const int aggregate_ipv4, const int aggregate_ipv6, const uint32_t formatoptions) {
+	s_ipaddrset set;
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipaddr ipaddr;
+	uint32_t inputtype, options = formatoptions;
+	int argi = 0, length, linecounter = 0, retval = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Start of action: aggregate (max IPv4: /%d, max IPv6: /%d)", aggregate_ipv4, aggregate_ipv6);
+
+	if ((input_is_pipe == 0) && (argc == 0)) {
+		fprintf(stderr, "No input given for aggregation\n");
+		return(EXIT_FAILURE);
+	};
+
+	libipaddrset_init(&set);
+
+	while ((inputtype = bulk_input_next(argc, argv, &argi, &linecounter, &ipv4addr, &ipv6addr)) != FORMAT_undefined) {
+		if (inputtype == FORMAT_auto_noresult) {
+			retval = EXIT_FAILURE;
+			if (input_is_pipe == 1) {
+				continue;
+			};
+			goto END_aggregate_input;
+		};
+
+		if (inputtype == FORMAT_ipv4addr) {
+			CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+			length = (ipv4addr.flag_prefixuse == 1) ? ipv4addr.prefixlength : 32;
+			if (length > aggregate_ipv4) {
+				length = aggregate_ipv4;
+			};
+		} else {
+			CONVERT_IPV6ADDRP_IPADDR(&ipv6addr, ipaddr);
+			length = (ipv6addr.flag_prefixuse == 1) ? ipv6addr.prefixlength : 128;
+			if (length > aggregate_ipv6) {
+				length = aggregate_ipv6;
+			};
+		};
+
+		if (libipaddrset_aggregate_add(&set, &ipaddr, length) != 0) {
+			retval = EXIT_FAILURE;
+			goto END_aggregate_input;
+		};
+	};
+
+	if ((libipaddrset_aggregate_walk(&set, IPV6CALC_PROTO_IPV4, aggregate_print, &options) != 0) || (libipaddrset_aggregate_walk(&set, IPV6CALC_PROTO_IPV6, aggregate_print, &options) != 0)) {
+		retval = EXIT_FAILURE;
+	};
+
+END_aggregate_input:
+	libipaddrset_cleanup(&set);
+	return(retval);
+};
+
+
+/*
+ * reverse DNS: print name, as PTR record with host label in given domain
+ */
+static void reverse_print_record(const char *name, const char *label, const char *domain) {
+	char line[NI_MAXHOST * 2 + 64], *p = line, *p_end = line + sizeof(line) - 2;
+	const char *s;
+
+	for (s = name; (*s != '\0') && (p < p_end); s++) {
+		*p++ = *s;
+	};
+
+	if (label != NULL) {
+		for (s = "\tIN\tPTR\t"; *s != '\0'; s++) {
+			*p++ = *s;
+		};
+		for (s = label; (*s != '\0') && (p < p_end); s++) {
+			*p++ = *s;
+		};
+		*p++ = '.';
+		for (s = domain; (*s != '\0') && (p < p_end); s++) {
+			*p++ = *s;
+		};
+	};
+	*p++ = '\n';
+
+	fwrite(line, 1, p - line, stdout);
+};
+
+
+/*
+ * reverse DNS: name of IPv4 prefix, host label are the octets covering the prefix separated by '-'
+ */
+static void reverse_print_ipv4(const char *name, const ipv6calc_ipv4addr *ipv4addrp, void *data) {
+	char label[32], *p = label;
+	unsigned int octet;
+	int n;
+
+	if (data == NULL) {
+		reverse_print_record(name, NULL, NULL);
+		return;
+	};
+
+	for (n = 0; (n < ((*ipv4addrp).prefixlength + 7) / 8) || (n == 0); n++) {
+		if (n > 0) {
+			*p++ = '-';
+		};
+		octet = ipv4addr_getoctet(ipv4addrp, (unsigned int) n);
+		if (octet >= 100) {
+			*p++ = (char) ('0' + octet / 100);
+		};
+		if (octet >= 10) {
+			*p++ = (char) ('0' + (octet / 10) % 10);
+		};
+		*p++ = (char) ('0' + octet % 10);
+	};
+	*p = '\0';
+
+	reverse_print_record(name, label, (const char *) data);
+};
+
+
+/*
+ * reverse DNS: name of IPv6 prefix, host label are the 16-bit words covering the prefix separated by '-'
+ */
+static void reverse_print_ipv6(const char *name, const ipv6calc_ipv6addr *ipv6addrp, void *data) {
+	static const char digits[] = "0123456789abcdef";
+	char label[64], *p = label;
+	unsigned int word;
+	int n, shift;
+
+	if (data == NULL) {
+		reverse_print_record(name, NULL, NULL);
+		return;
+	};
+
+	for (n = 0; (n < ((*ipv6addrp).prefixlength + 15) / 16) || (n == 0); n++) {
+		if (n > 0) {
+			*p++ = '-';
+		};
+		word = ipv6addr_getword(ipv6addrp, (unsigned int) n);
+		/* hex without leading zeros */
+		for (shift = 12; (shift > 0) && ((word >> shift) == 0); shift -= 4);
+		for (; shift >= 0; shift -= 4) {
+			*p++ = digits[(word >> shift) & 0xf];
+		};
+	};
+	*p = '\0';
+
+	reverse_print_record(name, label, (const char *) data);
+};
+
+
+/*
+ * reverse DNS: print in-addr.arpa/ip6.arpa names of addresses/prefixes from arguments or stdin,
+ * a prefix is expanded to all sub-prefixes of given length (default: next octet/nibble boundary)
+ *
+ * in : reverse_ipv4/reverse_ipv6 = length of sub-prefixes, longer ones are shortened (-1: not given)
+ * in : reverse_ptr = domain of PTR records (NULL: names only)
+ * ret: 0=ok, 1=error (invalid lines are skipped in pipe mode)
+ */
+static int reverse_input(const int argc, char *argv[], const int reverse_ipv4, const int reverse_ipv6, const char *reverse_ptr, const uint32_t formatoptions) {
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t inputtype;
+	int argi = 0, length, target, linecounter = 0, retval = 0, r;
+	char domain[NI_MAXHOST], *domainp = NULL;
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Start of action: genreverse (IPv4: /%d, IPv6: /%d)", reverse_ipv4, reverse_ipv6);
+
+	if ((input_is_pipe == 0) && (argc == 0)) {
+		fprintf(stderr, "No input given for reverse DNS names\n");
+		return(EXIT_FAILURE);
+	};
+
+	if (reverse_ptr != NULL) {
+		/* fully qualified */
+		snprintf(domain, sizeof(domain), "%s%s", reverse_ptr, (reverse_ptr[strlen(reverse_ptr) - 1] == '.') ? "" : ".");
+		domainp = domain;
+	};
+
+	while ((inputtype = bulk_input_next(argc, argv, &argi, &linecounter, &ipv4addr, &ipv6addr)) != FORMAT_undefined) {
+		if (inputtype == FORMAT_auto_noresult) {
+			retval = EXIT_FAILURE;
+			if (input_is_pipe == 1) {
+				continue;
+			};
+			break;
+		};
+
+		if (inputtype == FORMAT_ipv4addr) {
+			length = (ipv4addr.flag_prefixuse == 1) ? ipv4addr.prefixlength : 32;
+			target = (reverse_ipv4 >= 0) ? reverse_ipv4 : ((length + 7) & ~0x7);
+		} else {
+			length = (ipv6addr.flag_prefixuse == 1) ? ipv6addr.prefixlength : 128;
+			target = (reverse_ipv6 >= 0) ? reverse_ipv6 : ((length + 3) & ~0x3);
+		};
+
+		if (length > target) {
+			/* shorten to sub-prefix length */
+			length = target;
+		};
+
+		if ((target - length) > REVERSE_ENUMERATE_BITS_MAX) {
+			if (input_is_pipe == 1) {
+				fprintf(stderr, "Line contains prefix with too many sub-prefixes (/%d to /%d, limit: %d bits): %d\n", length, target, REVERSE_ENUMERATE_BITS_MAX, linecounter);
+				retval = EXIT_FAILURE;
+				continue;
+			};
+			fprintf(stderr, "Prefix has too many sub-prefixes (/%d to /%d, limit: %d bits)\n", length, target, REVERSE_ENUMERATE_BITS_MAX);
+			retval = EXIT_FAILURE;
+			break;
+		};
+
+		if (inputtype == FORMAT_ipv4addr) {
+			ipv4addr.prefixlength = (uint8_t) length;
+			ipv4addr.flag_prefixuse = 1;
+			r = libipv4addr_enumerate_reversestrings(&ipv4addr, target, formatoptions, reverse_print_ipv4, domainp);
+		} else {
+			ipv6addr.prefixlength = (uint8_t) length;
+			ipv6addr.flag_prefixuse = 1;
+			r = librfc1886_enumerate_nibblestrings(&ipv6addr, target, formatoptions, "ip6.arpa.", reverse_print_ipv6, domainp);
+		};
+
+		if (r != 0) {
+			fprintf(stderr, "Can't generate reverse DNS names (/%d to /%d)\n", length, target);
+			retval = EXIT_FAILURE;
+			break;
+		};
+	};
+
+	return(retval);
+};
+
+
+/*
+ * pipe mode workers
+ *
+ * forked after the first line has set up the state (types, action, filter),
+ * so each worker processes its lines exactly like the serial loop.
+ * Input is split into chunks of lines handed round-robin to the workers,
+ * results and error messages are printed in input order.
+ */
+typedef struct {
+	int    fd;		// output of worker, -1: EOF
+	char   *buf;		// data not yet printed, chunks are terminated by NUL
+	size_t size;
+	size_t used;
+	int    done;		// end of current chunk is already printed
+} s_pipe_output;
+
+typedef struct {
+	pid_t  pid;
+	int    fd_in;		// chunks to worker, -1: closed
+	char   *in;		// chunk data not yet written to worker
+	size_t in_size;
+	size_t in_used;
+	size_t in_pos;
+	s_pipe_output out;	// stdout of worker
+	s_pipe_output err;	// stderr of worker
+} s_pipe_worker;
+
+
+/* append data to a growing buffer */
+static void pipe_buffer_append(char **bufp, size_t *sizep, size_t *usedp, const char *data, const size_t length) {
+	size_t size_new;
+	char  *buf_new;
+
+	if (*usedp + length > *sizep) {
+		size_new = (*sizep == 0) ? 65536 : *sizep;
+		while (size_new < *usedp + length) {
+			size_new *= 2;
+		};
+		buf_new = realloc(*bufp, size_new);
+		if (buf_new == NULL) {
+			fprintf(stderr, "Can't allocate memory for pipe buffer\n");
+			exit(EXIT_FAILURE);
+		};
+		*bufp = buf_new;
+		*sizep = size_new;
+	};
+
+	memcpy(*bufp + *usedp, data, length);
+	*usedp += length;
+};
+
+
+/*
+ * print available data of current chunk
+ * ret: 0=ok, -1=write error
+ */
+static int pipe_output_print(s_pipe_output *o, FILE *stream) {
+	char *p;
+	size_t n;
+
+	if (o->done == 1) {
+		return(0);
+	};
+
+	p = memchr(o->buf, '\0', o->used);
+	n = (p == NULL) ? o->used : (size_t) (p - o->buf);
+	if ((n > 0) && (fwrite(o->buf, 1, n, stream) != n)) {
+		return(-1);
+	};
+
+	if (p == NULL) {
+		o->used = 0;
+	} else {
+		o->used -= n + 1;
+		memmove(o->buf, p + 1, o->used);
+		o->done = 1;
+	};
+
+	return(0);
+};
+
+
+/* read available data from worker output */
+static void pipe_output_read(s_pipe_output *o) {
+	char buffer[65536];
+	ssize_t length;
+
+	while (o->fd >= 0) {
+		length = read(o->fd, buffer, sizeof(buffer));
+		if (length > 0) {
+			pipe_buffer_append(&o->buf, &o->size, &o->used, buffer, length);
+		} else if ((length == 0) || ((errno != EAGAIN) && (errno != EINTR))) {
+			close(o->fd);
+			o->fd = -1;
+		} else {
+			break;
+		};
+	};
+};
+
+
+/* stop workers and terminate with exit status of given worker (-1: retval) */
+static void pipe_workers_stop(s_pipe_worker *w, const int workers, const int worker, const int kill_others, const int retval) {
+	int i, status, result = retval;
+
+	fflush(stdout);
+
+	for (i = 0; i < workers; i++) {
+		if (w[i].fd_in >= 0) {
+			close(w[i].fd_in);
+			w[i].fd_in = -1;
+		};
+		if ((kill_others == 1) && (i != worker)) {
+			kill(w[i].pid, SIGTERM);
+		};
+	};
+
+	for (i = 0; i < workers; i++) {
+		if (waitpid(w[i].pid, &status, 0) < 0) {
+			continue;
+		};
+		if (i == worker) {
+			if (WIFEXITED(status)) {
+				result = WEXITSTATUS(status);
+			} else {
+				result = EXIT_FAILURE;
+			};
+		};
+	};
+
+	exit(result);
+};
+
+
+/* start workers, returns only inside of a worker process */
+static void pipe_workers_start(const int workers, const int linecounter, const int retval, const int flush_mode) {
+	s_pipe_worker *w;
+	struct pollfd *pfds;
+	int pipe_in[2], pipe_out[2], pipe_err[2];
+	int i, j, n, line_number = linecounter + 1, input_eof = 0, lines;
+	long seq_read = 0, seq_print = 0;
+	char *line = NULL;
+	size_t line_size = 0;
+	ssize_t length;
+	char mark[64];
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Start pipe mode workers: %d", workers);
+
+	fflush(stdout);
+	fflush(stderr);
+
+	w = calloc(workers, sizeof(s_pipe_worker));
+	pfds = calloc(workers * 3, sizeof(struct pollfd));
+	if ((w == NULL) || (pfds == NULL)) {
+		fprintf(stderr, "Can't allocate memory for pipe mode workers\n");
+		exit(EXIT_FAILURE);
+	};
+
+	for (i = 0; i < workers; i++) {
+		if ((pipe(pipe_in) != 0) || (pipe(pipe_out) != 0) || (pipe(pipe_err) != 0)) {
+			fprintf(stderr, "Can't create pipe for worker: %s\n", strerror(errno));
+			exit(EXIT_FAILURE);
+		};
+
+		w[i].pid = fork();
+		if (w[i].pid < 0) {
+			fprintf(stderr, "Can't start worker: %s\n", strerror(errno));
+			exit(EXIT_FAILURE);
+		};
+
+		if (w[i].pid == 0) {
+			/* worker */
+			for (j = 0; j < i; j++) {
+				close(w[j].fd_in);
+				close(w[j].out.fd);
+				close(w[j].err.fd);
+			};
+			close(pipe_in[1]);
+			close(pipe_out[0]);
+			close(pipe_err[0]);
+
+			/* replace stdin/stdout/stderr, original input descriptor (and its offset) is only used by parent */
+			if ((dup2(pipe_in[0], STDIN_FILENO) < 0) || (dup2(pipe_out[1], STDOUT_FILENO) < 0) || (dup2(pipe_err[1], STDERR_FILENO) < 0)) {
+				exit(EXIT_FAILURE);
+			};
+			close(pipe_in[0]);
+			close(pipe_out[1]);
+			close(pipe_err[1]);
+
+			pipe_input = fdopen(STDIN_FILENO, "r");
+			if (pipe_input == NULL) {
+				fprintf(stderr, "Can't set up worker input: %s\n", strerror(errno));
+				exit(EXIT_FAILURE);
+			};
+
+			free(w);
+			free(pfds);
+			pipe_worker = 1;
+
+			/* reopen databases, file handles are not shared between workers */
+			libipv6calc_db_wrapper_cleanup();
+			if (libipv6calc_db_wrapper_init("") != 0) {
+				exit(EXIT_FAILURE);
+			};
+			return;
+		};
+
+		/* parent */
+		close(pipe_in[0]);
+		close(pipe_out[1]);
+		close(pipe_err[1]);
+		w[i].fd_in = pipe_in[1];
+		w[i].out.fd = pipe_out[0];
+		w[i].err.fd = pipe_err[0];
+		fcntl(w[i].fd_in, F_SETFL, fcntl(w[i].fd_in, F_GETFL) | O_NONBLOCK);
+		fcntl(w[i].out.fd, F_SETFL, fcntl(w[i].out.fd, F_GETFL) | O_NONBLOCK);
+		fcntl(w[i].err.fd, F_SETFL, fcntl(w[i].err.fd, F_GETFL) | O_NONBLOCK);
+	};
+
+	/* a terminated worker must not terminate the parent */
+	signal(SIGPIPE, SIG_IGN);
+
+	while (1) {
+		/* print results and error messages in input order */
+		while (seq_print < seq_read) {
+			i = seq_print % workers;
+			if ((pipe_output_print(&w[i].out, stdout) != 0) || (pipe_output_print(&w[i].err, stderr) != 0)) {
+				pipe_workers_stop(w, workers, -1, 1, EXIT_FAILURE);
+			};
+
+			if ((w[i].out.done == 0) || (w[i].err.done == 0)) {
+				if ((w[i].out.fd < 0) && (w[i].err.fd < 0)) {
+					/* worker terminated inside of chunk (error or last line without newline), messages of following chunks are dropped */
+					pipe_workers_stop(w, workers, i, 1, EXIT_FAILURE);
+				};
+				break;
+			};
+
+			w[i].out.done = 0;
+			w[i].err.done = 0;
+			seq_print++;
+			if (flush_mode == 1) {
+				fflush(stdout);
+			};
+		};
+
+		/* read chunks ahead, behind printing, which may have freed slots */
+		while ((input_eof == 0) && (seq_read - seq_print < (long) workers * PIPE_CHUNKS_AHEAD)) {
+			i = seq_read % workers;
+			for (lines = 0; lines < PIPE_CHUNK_LINES; lines++) {
+				length = getline(&line, &line_size, stdin);
+				if (length < 0) {
+					input_eof = 1;
+					break;
+				};
+				if (lines == 0) {
+					mark[0] = '\0';
+					n = snprintf(mark + 1, sizeof(mark) - 1, "%s%d\n", PIPE_MARK_BEGIN, line_number) + 1;
+					pipe_buffer_append(&w[i].in, &w[i].in_size, &w[i].in_used, mark, n);
+				};
+				pipe_buffer_append(&w[i].in, &w[i].in_size, &w[i].in_used, line, length);
+				line_number++;
+			};
+			if (lines == 0) {
+				break;
+			};
+			mark[0] = '\0';
+			n = snprintf(mark + 1, sizeof(mark) - 1, "%s\n", PIPE_MARK_END) + 1;
+			pipe_buffer_append(&w[i].in, &w[i].in_size, &w[i].in_used, mark, n);
+			seq_read++;
+		};
+
+		if (ferror(stdout)) {
+			pipe_workers_stop(w, workers, -1, 1, EXIT_FAILURE);
+		};
+
+		if ((input_eof == 1) && (seq_print == seq_read)) {
+			/* all done, result is the one of the last processed line */
+			pipe_workers_stop(w, workers, (seq_read > 0) ? (int) ((seq_read - 1) % workers) : -1, 0, retval);
+		};
+
+		/* wait for workers */
+		n = 0;
+		for (i = 0; i < workers; i++) {
+			if ((input_eof == 1) && (w[i].fd_in >= 0) && (w[i].in_pos == w[i].in_used)) {
+				close(w[i].fd_in);
+				w[i].fd_in = -1;
+			};
+			if ((w[i].fd_in >= 0) && (w[i].in_pos < w[i].in_used)) {
+				pfds[n].fd = w[i].fd_in;
+				pfds[n].events = POLLOUT;
+				pfds[n].revents = 0;
+				n++;
+			};
+			if (w[i].out.fd >= 0) {
+				pfds[n].fd = w[i].out.fd;
+				pfds[n].events = POLLIN;
+				pfds[n].revents = 0;
+				n++;
+			};
+			if (w[i].err.fd >= 0) {
+				pfds[n].fd = w[i].err.fd;
+				pfds[n].events = POLLIN;
+				pfds[n].revents = 0;
+				n++;
+			};
+		};
+
+		if (poll(pfds, n, -1) < 0) {
+			if (errno == EINTR) {
+				continue;
+			};
+			fprintf(stderr, "Can't poll workers: %s\n", strerror(errno));
+			pipe_workers_stop(w, workers, -1, 1, EXIT_FAILURE);
+		};
+
+		for (i = 0; i < workers; i++) {
+			if ((w[i].fd_in >= 0) && (w[i].in_pos < w[i].in_used)) {
+				length = write(w[i].fd_in, w[i].in + w[i].in_pos, w[i].in_used - w[i].in_pos);
+				if (length > 0) {
+					w[i].in_pos += length;
+					if (w[i].in_pos == w[i].in_used) {
+						w[i].in_pos = 0;
+						w[i].in_used = 0;
+					};
+				} else if ((length < 0) && (errno != EAGAIN) && (errno != EINTR)) {
+					/* worker terminated, detected by EOF of its output */
+					close(w[i].fd_in);
+					w[i].fd_in = -1;
+				};
+			};
+
+			pipe_output_read(&w[i].out);
+			pipe_output_read(&w[i].err);
+		};
+	};
+};
@@ -22,6 +22,14 @@
 
 #define DEBUG_ipv6calc_general      0x00000001l
 
+/* pipe mode workers (--workers) */
+#define PIPE_WORKERS_MAX	64
+#define PIPE_CHUNK_LINES	1024	// lines per chunk handed to a worker
+#define PIPE_CHUNKS_AHEAD	2	// chunks per worker read ahead of output
+
+/* reverse DNS names (-A genreverse) */
+#define REVERSE_ENUMERATE_BITS_MAX	24	// max. 2^24 names per given prefix
+
 #endif
 
 extern int feature_zeroize;
@@ -97,6 +97,8 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 
 	fprintf(stderr, "  [-q|--quiet]               : be more quiet (auto-enabled in pipe mode)\n");
 	fprintf(stderr, "  [-f|--flush]               : flush each line in pipe mode\n");
+	fprintf(stderr, "  [--workers <N>]            : process lines in pipe mode by N forked worker processes,\n");
+	fprintf(stderr, "                               output order and messages are kept like in serial mode\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " Usage with new style options:\n");
 	fprintf(stderr, "  [--in|-I <input type>]   : specify input  type\n");
@@ -113,6 +115,7 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 	fprintf(stderr, "  Available action types:  [-m] -A|--action -?|-h|--help\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, "  Special filter action :  -E -?|-h|--help\n");
+	fprintf(stderr, "                           --filter-file <FILE> (prefix set, see -E -?)\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " Other usage:\n");
 	fprintf(stderr, "  --showinfo|-i [--machine_readable|-m] : show information about input data\n");
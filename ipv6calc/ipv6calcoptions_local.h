@@ -129,6 +129,21 @@ static struct option ipv6calc_longopts[] = {
 	{ "test_le"		, 1, NULL, CMD_test_le },
 	{ "test_lt"		, 1, NULL, CMD_test_lt },
 
+	/* filter options action */
+	{ "filter-file"		, 1, NULL, CMD_filter_file },
+
+	/* pipe mode options */
+	{ "workers"		, 1, NULL, CMD_pipe_workers },
+
+	/* aggregation options */
+	{ "aggregate-ipv4"	, 1, NULL, CMD_aggregate_ipv4 },
+	{ "aggregate-ipv6"	, 1, NULL, CMD_aggregate_ipv6 },
+
+	/* reverse DNS options */
+	{ "reverse-ipv4"	, 1, NULL, CMD_reverse_ipv4 },
+	{ "reverse-ipv6"	, 1, NULL, CMD_reverse_ipv6 },
+	{ "reverse-ptr"		, 1, NULL, CMD_reverse_ptr },
+
 }; 
 
 
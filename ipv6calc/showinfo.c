@@ -30,6 +30,7 @@
 #include "../databases/lib/libipv6calc_db_wrapper_IP2Location.h"
 #include "../databases/lib/libipv6calc_db_wrapper_DBIP.h"
 #include "../databases/lib/libipv6calc_db_wrapper_External.h"
+#include "../databases/lib/libipv6calc_db_wrapper_MMAP.h"
 #include "../databases/lib/libipv6calc_db_wrapper_BuiltIn.h"
 
 #ifdef SUPPORT_IP2LOCATION
@@ -71,6 +72,9 @@ void showinfo_availabletypes(void) {
 	fprintf(stderr, " IPV6_AS_NUM=...               : AS number of (anonymized) IPv6 address\n");
 	fprintf(stderr, " IPV6_COUNTRYCODE=...          : Country Code of (anonymized) IPv6 address\n");
 	fprintf(stderr, " IPV6_COUNTRYCODE_SOURCE=...   : Source of Country Code of IPv6 address\n");
+	fprintf(stderr, " IPV6_CITY=...                 : City of IPv6 address\n");
+	fprintf(stderr, " IPV6_REGION=...               : Region of IPv6 address\n");
+	fprintf(stderr, " IPV6_CITY_SOURCE=...          : Source of City/Region of IPv6 address\n");
 	fprintf(stderr, " IPV4=ddd.ddd.ddd.ddd          : native IPv4 address\n");
 	fprintf(stderr, " IPV4_ANON=ddd.ddd.ddd.ddd     : native anonymized IPv4 address\n");
 	fprintf(stderr, " IPV4_REGISTRY=...             : registry token of native IPv4 address\n");
@@ -82,6 +86,9 @@ void showinfo_availabletypes(void) {
 	fprintf(stderr, " IPV4_AS_NUM[...]=...          : AS number of (anonymized) IPv4 address\n");
 	fprintf(stderr, " IPV4_COUNTRYCODE[...]=...     : Country Code of (anonymized) IPv4 address\n");
 	fprintf(stderr, " IPV4_COUNTRYCODE_SOURCE[...]=...: Source of Country Code of (anonymized) IPv4 address\n");
+	fprintf(stderr, " IPV4_CITY[...]=...            : City of IPv4 address\n");
+	fprintf(stderr, " IPV4_REGION[...]=...          : Region of IPv4 address\n");
+	fprintf(stderr, " IPV4_CITY_SOURCE[...]=...     : Source of City/Region of IPv4 address\n");
 	fprintf(stderr, "  ISATAP|TEREDO-SERVER|TEREDO-CLIENT|6TO4|LINK-LOCAL-IID\n");
 	fprintf(stderr, " SLA=xxxx                      : an included SLA\n");
 	fprintf(stderr, " IID=xxxx:xxxx:xxxx:xxxx       : an included interface identifier\n");
@@ -322,6 +329,17 @@ static void printfooter(const uint32_t formatoptions) {
 	};
 #endif
 
+#ifdef SUPPORT_MMAP
+	string = libipv6calc_db_wrapper_MMAP_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		if ( (formatoptions & FORMATOPTION_machinereadable) != 0 ) {
+			printout("MMAP_DATABASE_INFO", string, formatoptions);
+		} else {
+			fprintf(stdout, "MMAP database: %s\n", string);
+		};
+	};
+#endif
+
 #ifdef SUPPORT_BUILTIN
 	string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
 	if ((string != NULL) && (strlen(string) > 0)) {
@@ -903,6 +921,52 @@ static void print_external(const ipv6calc_ipaddr *ipaddrp, const uint32_t format
 };
 #endif
 
+/* print city/region of combined database lookup */
+static void print_city(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
+	s_ipv6calc_db_lookup_all lookup_all;
+	char token[NI_MAXHOST];
+	int i;
+
+	uint32_t machinereadable = (formatoptions & FORMATOPTION_machinereadable);
+
+	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
+
+	if (libipv6calc_db_wrapper_has_features((ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? IPV6CALC_DB_IPV4_TO_CITY : IPV6CALC_DB_IPV6_TO_CITY) != 1) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "no database supporting city/region available");
+		return;
+	};
+
+	libipv6calc_db_wrapper_lookup_all(ipaddrp, IPV6CALC_DB_LOOKUP_ALL_CITY, &lookup_all);
+
+	if ((lookup_all.found & IPV6CALC_DB_LOOKUP_ALL_CITY) == 0) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "no city/region found");
+		return;
+	};
+
+	if ( machinereadable != 0 ) {
+		snprintf(token, sizeof(token), "IPV%d_CITY", ipaddrp->proto);
+		printout2(token, additionalstring, lookup_all.city, formatoptions);
+		snprintf(token, sizeof(token), "IPV%d_REGION", ipaddrp->proto);
+		printout2(token, additionalstring, lookup_all.region, formatoptions);
+
+		for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+			if (lookup_all.city_data_source == data_sources[i].number) {
+				snprintf(token, sizeof(token), "IPV%d_CITY_SOURCE", ipaddrp->proto);
+				printout2(token, additionalstring, data_sources[i].name, formatoptions);
+				break;
+			};
+		};
+	} else {
+		if (strlen(additionalstring) > 0) {
+			fprintf(stdout, "City for %s: %s\n", additionalstring, lookup_all.city);
+			fprintf(stdout, "Region for %s: %s\n", additionalstring, lookup_all.region);
+		} else {
+			fprintf(stdout, "City: %s\n", lookup_all.city);
+			fprintf(stdout, "Region: %s\n", lookup_all.region);
+		};
+	};
+};
+
 /* print IPv4 address */
 static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t formatoptions, const char *string) {
 	char tempstring[NI_MAXHOST] = "", tempstring2[NI_MAXHOST] = "", tempstring3[NI_MAXHOST] = "", helpstring[NI_MAXHOST] = "";
@@ -1074,6 +1138,9 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 		} else {
 			DEBUGPRINT_NA(DEBUG_showinfo, "Skip CountryCode print: cc_index>=COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN");
 		};
+
+		/* get City/Region Information */
+		print_city(&ipaddr, formatoptions, embeddedipv4string);
 	};
 
 
@@ -1461,6 +1528,9 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 			};
 		};
 
+		/* City/Region */
+		print_city(&ipaddr, formatoptions, "");
+
 		/* AS */
 		DEBUGPRINT_NA(DEBUG_showinfo, "get AS number/text");
 		if ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) == 0) {
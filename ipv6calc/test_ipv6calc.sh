@@ -257,6 +257,14 @@ testscenarios_pipe() {
 	cat <<END
 3ffe::1:ff00:1234,--in ipv6addr --out ipv6addr --printuncompressed,3ffe:0:0:0:0:1:ff00:1234
 3ffe::1:ff00:1234,--in ipv6addr --out ipv6addr --printuncompressed --printprefix --forceprefix 96,3ffe:0:0:0:0:1
+192.0.2.0/25\\\\n192.0.2.128/25,-A aggregate,192.0.2.0/24
+192.0.2.1\\\\n192.0.2.0/24\\\\n192.0.2.77,-A aggregate,192.0.2.0/24
+2001:db8::1\\\\n2001:db8:0:1::1\\\\n2001:db8:1::1,--aggregate-ipv6 47,2001:db8::/47
+2001:db8::/33\\\\n2001:db8:8000::/33\\\\n2001:db8::1,-A aggregate,2001:db8::/32
+192.0.2.0/24,-A genreverse,2.0.192.in-addr.arpa.
+192.0.2.1,--reverse-ptr example.net,1.2.0.192.in-addr.arpa.	IN	PTR	192-0-2-1.example.net.
+2001:db8::1/48,-A genreverse,0.0.0.0.8.b.d.0.1.0.0.2.ip6.arpa.
+2001:db8:1234::/47,--reverse-ipv6 48,5.3.2.1.8.b.d.0.1.0.0.2.ip6.arpa.
 END
 
 }
@@ -682,6 +690,47 @@ done || exit 1
 echo "INFO  : $test successful"
 
 
+test="run 'ipv6calc' pipe mode workers tests (compare with serial mode)"
+echo "INFO  : $test"
+for options in "-m -i" "--in ipv4addr --out ipv6addr --action conv6to4" "-A anonymize"; do
+	info="INFO  : test 'testscenario_hugelist ipv4 | ./ipv6calc -q --workers 4 $options'"
+	[ "$verbose" = "1" ] && echo "$info"
+	output_serial="`testscenario_hugelist ipv4 | ./ipv6calc -q $options | cksum`"
+	output_workers="`testscenario_hugelist ipv4 | ./ipv6calc -q --workers 4 $options | cksum`"
+	if [ "$output_serial" != "$output_workers" ]; then
+		[ "$verbose" = "1" ] || echo "$info"
+		echo "Result '$output_workers' doesn't match serial mode result '$output_serial'!"
+		exit 1
+	fi
+	[ "$verbose" = "1" ] || echo -n "."
+done
+# showinfo of IPv6 addresses (incl. info regarding used databases)
+for options in "-m -i" "-i"; do
+	info="INFO  : test 'testscenario_hugelist ipv6 | ./ipv6calc -q --workers 3 $options'"
+	[ "$verbose" = "1" ] && echo "$info"
+	output_serial="`testscenario_hugelist ipv6 | ./ipv6calc -q $options | cksum`"
+	output_workers="`testscenario_hugelist ipv6 | ./ipv6calc -q --workers 3 $options | cksum`"
+	if [ "$output_serial" != "$output_workers" ]; then
+		[ "$verbose" = "1" ] || echo "$info"
+		echo "Result '$output_workers' doesn't match serial mode result '$output_serial'!"
+		exit 1
+	fi
+	[ "$verbose" = "1" ] || echo -n "."
+done
+# invalid lines in several chunks: only first error is reported, exit code like in serial mode
+info="INFO  : test 'testscenario_hugelist ipv4 (with invalid lines) | ./ipv6calc -q --workers 4 -m -i'"
+[ "$verbose" = "1" ] && echo "$info"
+output_serial="`testscenario_hugelist ipv4 | sed '5000s/^/x/;20000s/^/y/;40000s/^/z/' | ./ipv6calc -q -m -i 2>&1 >/dev/null; echo "rc=$?"`"
+output_workers="`testscenario_hugelist ipv4 | sed '5000s/^/x/;20000s/^/y/;40000s/^/z/' | ./ipv6calc -q --workers 4 -m -i 2>&1 >/dev/null; echo "rc=$?"`"
+if [ "$output_serial" != "$output_workers" ]; then
+	[ "$verbose" = "1" ] || echo "$info"
+	echo "Result '$output_workers' doesn't match serial mode result '$output_serial'!"
+	exit 1
+fi
+[ "$verbose" = "1" ] || echo -n "."
+[ "$verbose" = "1" ] || echo
+echo "INFO  : $test successful"
+
 retval=$?
 if [ $retval -eq 0 ]; then
 	echo "INFO  : all tests were successfully done!"
@@ -87,6 +87,102 @@ if [ $? -ne 0 ]; then
 	exit 1
 fi
 
+test="run 'ipv6calc' filter tests with long expression..."
+echo "INFO  : $test"
+
+# expression longer than NI_MAXHOST, last token must not be truncated
+filter=""
+for i in `seq 10 25`; do
+	filter="$filter^ipv6.addr=2001:0db8:0000:0000:0000:0000:0000:00$i/128,^ipv4.addr=10.0.0.$i/32,"
+done
+filter="${filter}ipv4.addr=2.2.3.0/24"
+
+output="`echo -e "2.2.3.4\n1.2.3.4\n10.0.0.10" | ./ipv6calc -A filter -E $filter`"
+if [ $? -ne 0 -o "$output" != "2.2.3.4" ]; then
+	echo "ERROR : long filter expression (length: ${#filter}) result not as expected: $output"
+	exit 1
+fi
+
+# large ASN list (hash set)
+if ./ipv6calc -v 2>&1 | grep -qw "DB_IPV4_AS"; then
+	filter="`seq 100000 105000 | awk '{ printf "ipv4.db.asn=%s,", $1 }'`ipv4.db.asn=3215"
+	output="`echo -e "2.2.3.4" | ./ipv6calc -A filter -E $filter`"
+	if [ $? -ne 0 -o "$output" != "2.2.3.4" ]; then
+		echo "ERROR : large ASN list filter 'must have' result not as expected: $output"
+		exit 1
+	fi
+
+	filter="`seq 100000 105000 | awk '{ printf "^ipv4.db.asn=%s,", $1 }'`^ipv4.db.asn=3215"
+	output="`echo -e "2.2.3.4" | ./ipv6calc -A filter -E $filter`"
+	if [ $? -ne 0 -o -n "$output" ]; then
+		echo "ERROR : large ASN list filter 'may not have' result not as expected: $output"
+		exit 1
+	fi
+else
+	echo "NOTICE: skip large ASN list filter tests (missing feature: DB_IPV4_AS)"
+fi
+
+# CountryCode list (bitset)
+if ./ipv6calc -v 2>&1 | grep -qw "DB_IPV4_CC"; then
+	filter="ipv4.db.cc=DE,ipv4.db.cc=US,ipv4.db.cc=GB,ipv4.db.cc=ZW,ipv4.db.cc=FR"
+	output="`echo -e "2.2.3.4" | ./ipv6calc -A filter -E $filter`"
+	if [ $? -ne 0 -o "$output" != "2.2.3.4" ]; then
+		echo "ERROR : CountryCode list filter 'must have' result not as expected: $output"
+		exit 1
+	fi
+
+	filter="ipv4.db.cc=DE,ipv4.db.cc=US,ipv4.db.cc=GB,ipv4.db.cc=ZW"
+	output="`echo -e "2.2.3.4" | ./ipv6calc -A filter -E $filter`"
+	if [ $? -ne 0 -o -n "$output" ]; then
+		echo "ERROR : CountryCode list filter 'must have' (not included) result not as expected: $output"
+		exit 1
+	fi
+
+	filter="^ipv4.db.cc=DE,^ipv4.db.cc=FR"
+	output="`echo -e "2.2.3.4" | ./ipv6calc -A filter -E $filter`"
+	if [ $? -ne 0 -o -n "$output" ]; then
+		echo "ERROR : CountryCode list filter 'may not have' result not as expected: $output"
+		exit 1
+	fi
+else
+	echo "NOTICE: skip CountryCode list filter tests (missing feature: DB_IPV4_CC)"
+fi
+
+echo "INFO  : $test successful"
+
+test="run 'ipv6calc' filter-file tests..."
+echo "INFO  : $test"
+
+tmpfile="`mktemp`"
+cat <<END >$tmpfile
+# comment
+
+10.0.0.0/8
+^10.1.0.0/16
+2001:db8::/32 ge 48 le 64
+END
+
+output="`echo -e "10.2.3.4\n10.1.2.3\n11.0.0.1\n2001:db8:1::/48\n2001:db8::1\n2001:db8:1:2::/64\n2001:db9::/48" | ./ipv6calc -A filter --filter-file $tmpfile`"
+if [ $? -ne 0 -o "$output" != "`echo -e "10.2.3.4\n2001:db8:1::/48\n2001:db8:1:2::/64"`" ]; then
+	echo "ERROR : filter-file result not as expected: $output"
+	rm -f $tmpfile
+	exit 1
+fi
+
+# invalid prefix set files
+for line in "1.2.3.0/24 ge 24abc" "1.2.3.0/24 le" "1.2.3.0/24 le 33" "1.2.3.0/24 ge 20" "1.2.3.0/24 xx 25" "1.2.3.0/33" "foo"; do
+	echo "$line" >$tmpfile
+	echo "1.2.3.4" | ./ipv6calc -A filter --filter-file $tmpfile >/dev/null 2>&1
+	if [ $? -eq 0 ]; then
+		echo "ERROR : invalid prefix set file line not detected: $line"
+		rm -f $tmpfile
+		exit 1
+	fi
+done
+rm -f $tmpfile
+
+echo "INFO  : $test successful"
+
 test="run 'ipv6calc' test_prefix tests..."
 echo "INFO  : $test"
 
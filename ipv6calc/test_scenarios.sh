@@ -546,6 +546,10 @@ testscenario_hugelist() {
 	    ipv4)
 		perl -e '{ for ($i = 0; $i < 256; $i++) { for ($j = 0; $j < 256; $j++) { print "$i.$j.$j.$i\n" } } }';
 		;;
+	    ipv6)
+		# mixed global unicast, 6to4, Teredo and EUI-64 based addresses
+		perl -e '{ for ($i = 0; $i < 64; $i++) { for ($j = 0; $j < 64; $j++) { printf "2%03x:%x:%x::%x\n2002:%02x%02x:%02x%02x::1\n2001:0:%x:%x::%x\n2a%02x:%x::2%02x:%02xff:fe%02x:%x\n", $i * 61, $j, $i, $j, $i, $j, $j, $i, $i, $j, $i + $j, $i, $j, $j, $i, $j, $i } } }';
+		;;
 	esac
 }
 
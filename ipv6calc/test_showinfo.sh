@@ -89,6 +89,104 @@ getexamples_DBIPv6() {
 END
 }
 
+getexamples_city() {
+	cat <<END
+212.18.21.186			DB_IPV4_CITY
+2001:a60:9002:1::186:6		DB_IPV6_CITY
+2a04::1				DB_IPV6_CITY
+END
+}
+
+getexamples_IP2Location_bin() {
+	cat <<END
+ipv4	1.0.0.1			AU	Queensland	Brisbane
+ipv4	1.0.1.255		CN	Fujian		Fuzhou
+ipv4	8.8.8.8			US	California	Pasadena
+ipv4	8.8.9.1			-	-		-
+ipv4	212.18.21.186		DE	Bayern		Muenchen
+ipv6	1.0.0.1			AU	Queensland	Brisbane
+ipv6	212.18.21.186		DE	Bayern		Muenchen
+ipv6	2001:a60:9002:1::186:6	DE	Bayern		Muenchen
+ipv6	2001:a61::1		-	-		-
+ipv6	2a04::1			NL	Noord-Holland	Amsterdam
+END
+}
+
+# create synthetic IP2Location BIN file: <file> <dbtype 1|3> <proto 4|6: IPv6 file includes IPv4> <index 0|1>
+ip2location_bin_create() {
+	perl - "$@" <<'END'
+use strict;
+my ($file, $dbtype, $proto, $with_index) = @ARGV;
+my $dbcolumn = ($dbtype >= 3) ? 4 : 2;
+# ip from (ascending, last row is end marker), country short, country long, region, city
+my @rows4 = (
+	[ "0.0.0.0"        , "-" , "-"            , "-"            , "-"         ],
+	[ "1.0.0.0"        , "AU", "Australia"    , "Queensland"   , "Brisbane"  ],
+	[ "1.0.1.0"        , "CN", "China"        , "Fujian"       , "Fuzhou"    ],
+	[ "8.8.8.0"        , "US", "United States", "California"   , "Pasadena"  ],
+	[ "8.8.9.0"        , "-" , "-"            , "-"            , "-"         ],
+	[ "212.18.21.0"    , "DE", "Germany"      , "Bayern"       , "Muenchen"  ],
+	[ "212.18.22.0"    , "-" , "-"            , "-"            , "-"         ],
+	[ "255.255.255.255", "-" , "-"            , "-"            , "-"         ],
+);
+my @rows6 = (
+	[ "0:0:0:0:0:0:0:0"                        , "-" , "-"          , "-"            , "-"         ],
+	[ "2001:a60:0:0:0:0:0:0"                   , "DE", "Germany"    , "Bayern"       , "Muenchen"  ],
+	[ "2001:a61:0:0:0:0:0:0"                   , "-" , "-"          , "-"            , "-"         ],
+	[ "2a04:0:0:0:0:0:0:0"                     , "NL", "Netherlands", "Noord-Holland", "Amsterdam" ],
+	[ "2a05:0:0:0:0:0:0:0"                     , "-" , "-"          , "-"            , "-"         ],
+	[ "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "-" , "-"          , "-"            , "-"         ],
+);
+my @sections = ($proto == 6) ? (4, 6) : (4);
+my %rows = (4 => \@rows4, 6 => \@rows6);
+# key of a row: upper 16 bits (index bucket) and lower bits
+sub key { my ($p, $ip) = @_; if ($p == 4) { my $n = unpack("N", pack("C4", split(/\./, $ip))); return ($n >> 16, $n & 0xffff); }; my @w = map { hex($_) } split(/:/, $ip); return (shift(@w), join(":", @w)); }
+my %index_size = map { $_ => ($with_index ? 65536 * 8 : 0) } @sections;
+my %row_size = (4 => $dbcolumn * 4, 6 => $dbcolumn * 4 + 12);
+my (%index_pos, %rows_pos);
+my $pos = 64;
+for my $p (@sections) { $index_pos{$p} = $pos; $pos += $index_size{$p}; };
+for my $p (@sections) { $rows_pos{$p} = $pos; $pos += scalar(@{$rows{$p}}) * $row_size{$p}; };
+my $strings = "";
+sub string { my ($s, $slot) = @_; my $o = $pos + length($strings); $strings .= pack("C", length($s)) . $s . ("\0" x ($slot - length($s))); return $o; }
+my ($index, $data) = ("", "");
+for my $p (@sections) {
+	my @r = @{$rows{$p}};
+	for my $row (@r) {
+		if ($p == 4) {
+			$data .= pack("C4", reverse(split(/\./, $row->[0])));
+		} else {
+			my @w = map { hex($_) } split(/:/, $row->[0]);
+			$data .= pack("v8", reverse(@w));
+		};
+		# country: short code (fixed 2 char slot), long name follows at +3
+		my $o = string($row->[1], 2); string($row->[2], 0);
+		$data .= pack("V", $o);
+		$data .= pack("VV", string($row->[3], 0), string($row->[4], 0)) if ($dbcolumn == 4);
+	};
+	next if (! $with_index);
+	# per upper 16 bits: first and last row which can contain addresses of this range
+	my ($low, $high) = (0, 0);
+	for (my $b = 0; $b < 65536; $b++) {
+		while (($low + 1 < $#r) && ((key($p, $r[$low + 1]->[0]))[0] < $b || ((key($p, $r[$low + 1]->[0]))[0] == $b && (key($p, $r[$low + 1]->[0]))[1] =~ /^[0:]*$/))) { $low++; };
+		$high = $low if ($high < $low);
+		while (($high + 1 < $#r) && ((key($p, $r[$high + 1]->[0]))[0] <= $b)) { $high++; };
+		$index .= pack("VV", $low, $high);
+	};
+};
+my $header = pack("C5", $dbtype, $dbcolumn, 26, 10, 1);
+$header .= pack("VV", $#rows4, $rows_pos{4} + 1);
+$header .= ($proto == 6) ? pack("VV", $#rows6, $rows_pos{6} + 1) : pack("VV", 0, 0);
+$header .= pack("V", $with_index ? $index_pos{4} + 1 : 0);
+$header .= pack("V", ($with_index && $proto == 6) ? $index_pos{6} + 1 : 0);
+$header .= "\0" x (64 - length($header));
+open(FILE, ">", $file) || die "can't create file: $file";
+binmode(FILE);
+print FILE $header . $index . $data . $strings;
+close(FILE);
+END
+}
+
 test="test showinfo"
 echo "INFO  : $test"
 getexamples | while read address separator comment; do
@@ -303,6 +401,31 @@ if ./ipv6calc -q -v 2>&1 | grep -qw GeoIP; then
 	done || exit 1
 	[ "$verbose" = "1" ] || echo
 	echo "INFO  : $test successful"
+
+	test="run GeoIP binary address lookup tests"
+	echo "INFO  : $test"
+	getexamples_GeoIP | while read address; do
+		if echo "$address" | grep -q ":" && ! ./ipv6calc -q -v 2>&1 | grep -qw "GeoIPv6"; then
+			[ "$verbose" = "1" ] && echo "Test: $address SKIPPED (no GeoIPv6 database)"
+			continue
+		fi
+		[ "$verbose" = "1" ] && echo "Test: $address"
+		output="`./ipv6calc -q -i -m --disable-ip2location --disable-dbip --disable-external $address`"
+		# GEOIP_* are retrieved by address string, IPV4_*/IPV6_* by binary address
+		for tokens in COUNTRY_SHORT:COUNTRYCODE AS_TEXT:AS_TEXT CITY:CITY REGION:REGION; do
+			expected="`echo "$output" | sed -n "s/^GEOIP_${tokens%%:*}=//p"`"
+			[ -z "$expected" ] && continue
+			result="`echo "$output" | sed -n "s/^IPV[46]_${tokens#*:}=//p"`"
+			if [ "$result" != "$expected" ]; then
+				[ "$verbose" = "1" ] || echo
+				echo "ERROR: lookup by binary address differs for $address: IPV?_${tokens#*:}=$result (should: $expected)"
+				exit 1
+			fi
+		done || exit 1
+		[ "$verbose" = "1" ] || echo -n "."
+	done || exit 1
+	[ "$verbose" = "1" ] || echo
+	echo "INFO  : $test successful"
 else
 	echo "NOTICE: $test SKIPPED"
 fi
@@ -399,6 +522,62 @@ else
 fi
 
 
+test="run IP2Location native BIN reader tests (synthetic databases)"
+if ./ipv6calc -v -v 2>&1 | grep -q "^IP2Location support enabled"; then
+	echo "INFO  : $test"
+	dir_bin="`mktemp -d`" || exit 1
+	for dbtype in 1 3; do
+		for index in 0 1; do
+			mkdir -p "$dir_bin/ipv4-db$dbtype-index$index" "$dir_bin/ipv6-db$dbtype-index$index" || exit 1
+			ip2location_bin_create "$dir_bin/ipv4-db$dbtype-index$index/IP2LOCATION-LITE-DB$dbtype.BIN" $dbtype 4 $index || exit 1
+			ip2location_bin_create "$dir_bin/ipv6-db$dbtype-index$index/IP2LOCATION-LITE-DB$dbtype.IPV6.BIN" $dbtype 6 $index || exit 1
+		done
+	done
+	options_bin="-q -i -m --disable-geoip --disable-dbip --disable-external"
+	if ! ./ipv6calc -q -v --db-ip2location-dir "$dir_bin/ipv4-db3-index1" 2>&1 | grep -qw "DB_IPV4_CITY"; then
+		echo "NOTICE: $test SKIPPED (synthetic databases not usable by IP2Location library)"
+	else
+		getexamples_IP2Location_bin | while read dir address cc region city; do
+			for dbtype in 1 3; do
+				for index in 0 1; do
+					dir_db="$dir_bin/$dir-db$dbtype-index$index"
+					[ "$verbose" = "1" ] && echo "Test: $address on $dir_db: $cc $region $city"
+					output="`./ipv6calc $options_bin --db-ip2location-dir "$dir_db" $address | grep -E "^IPV[46]_(COUNTRYCODE|REGION|CITY)="`"
+					if [ "$cc" = "-" ]; then
+						expected=""
+					elif [ $dbtype -eq 1 ]; then
+						expected="IPV[46]_COUNTRYCODE=$cc"
+					else
+						expected="IPV[46]_COUNTRYCODE=$cc IPV[46]_CITY=$city IPV[46]_REGION=$region"
+					fi
+					if ! echo $output | grep -q "^$expected$"; then
+						[ "$verbose" = "1" ] || echo
+						echo "ERROR: unexpected result for $address on $dir_db (should: $expected)"
+						echo "$output"
+						exit 1
+					fi
+					# library has to return same result
+					output_lib="`./ipv6calc $options_bin --db-ip2location-disable-native --db-ip2location-dir "$dir_db" $address | grep -E "^IPV[46]_(COUNTRYCODE|REGION|CITY)="`"
+					if [ "$output" != "$output_lib" ]; then
+						[ "$verbose" = "1" ] || echo
+						echo "ERROR: native reader result differs from library for $address on $dir_db"
+						echo "$output"
+						echo "$output_lib"
+						exit 1
+					fi
+					[ "$verbose" = "1" ] || echo -n "."
+				done || exit 1
+			done || exit 1
+		done || { rm -rf "$dir_bin"; exit 1; }
+		[ "$verbose" = "1" ] || echo
+		echo "INFO  : $test successful"
+	fi
+	rm -rf "$dir_bin"
+else
+	echo "NOTICE: $test SKIPPED"
+fi
+
+
 test="run db-ip.com IPv4 tests"
 if ./ipv6calc -q -v 2>&1 | grep -qw DBIPv4; then
 	echo "INFO  : $test"
@@ -494,6 +673,53 @@ else
 fi
 
 
+test="run city/region tests"
+if ./ipv6calc -q -v 2>&1 | grep -qwE "DB_IPV4_CITY|DB_IPV6_CITY"; then
+	echo "INFO  : $test"
+	getexamples_city | while read address requirement; do
+		if ! ./ipv6calc -q -v 2>&1 | grep -qw "$requirement"; then
+			echo "Test: $address SKIPPED (missing $requirement)"
+			continue
+		fi
+		[ "$verbose" = "1" ] && echo "Run city/region showinfo on: $address"
+		output="`./ipv6calc -q -i -m $address`"
+		source="`echo "$output" | sed -n 's/^IPV[46]_CITY_SOURCE=//p'`"
+		case $source in
+		    GeoIP)
+			prefix="GEOIP"
+			;;
+		    IP2Location)
+			prefix="IP2LOCATION"
+			;;
+		    db-ip.com)
+			prefix="DBIP"
+			;;
+		    *)
+			echo "Test: $address SKIPPED (no city/region found)"
+			continue
+			;;
+		esac
+		# combined lookup has to return same city/region as the source
+		for token in CITY REGION; do
+			expected="`echo "$output" | grep "^${prefix}_$token="`"
+			[ -z "$expected" ] && continue
+			if ! echo "$output" | grep -q "^IPV[46]_$token=${expected#*=}$"; then
+				[ "$verbose" = "1" ] || echo
+				echo "ERROR: unexpected result for $address (should: $expected)"
+				echo "$output" | grep "_$token="
+				exit 1
+			fi
+		done || exit 1
+		[ "$verbose" = "1" ] && echo
+		[ "$verbose" = "1" ] || echo -n "."
+	done || exit 1
+	[ "$verbose" = "1" ] || echo
+	echo "INFO  : $test successful"
+else
+	echo "NOTICE: $test SKIPPED"
+fi
+
+
 test="run special anon tests"
 if ./ipv6calc -v 2>&1 | grep -qw "ANON_KEEP-TYPE-ASN-CC"; then
 	echo "INFO  : $test"
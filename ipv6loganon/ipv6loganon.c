@@ -14,6 +14,12 @@
 #include <getopt.h> 
 #include <unistd.h>
 
+#include "config.h"
+
+#ifdef SUPPORT_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "ipv6loganon.h"
 #include "libipv6calcdebug.h"
 #include "libipv6calc.h"
@@ -60,20 +66,22 @@ int feature_kp      = 0; // will be checked later
 
 
 /* prototypes */
-static int anonymizetoken(char *result, const size_t resultstring_length, const char *token);
+static int anonymizetoken(char *result, const size_t resultstring_length, const char *token, s_ipaddrcache *cachep);
+static int lineparser_line(char *linebuffer, const int linecounter, s_ipaddrcache *cachep, char *outline, const size_t outline_length);
 static void lineparser();
+#ifdef SUPPORT_PTHREAD
+static void lineparser_threads();
+#endif
 
 
-/* LRU cache */
+/* result cache keyed on binary address, MAC/EUI-64 are stored in addr[0..1] with own tag */
+#define CACHE_TAG_ANONYMIZE		1
+#define CACHE_TAG_ANONYMIZE_MAC		2
+#define CACHE_TAG_ANONYMIZE_EUI64	3
 
-#define CACHE_LRU_SIZE 200
+static s_ipaddrcache cache;
 
-static int      cache_lru_max = 0;
-static int      cache_lru_last = 0;
-int      cache_lru_limit = 20; /* optimum */
-static char     cache_lru_key_token[CACHE_LRU_SIZE][NI_MAXHOST];
-static char     cache_lru_value[CACHE_LRU_SIZE][NI_MAXHOST];
-static long int cache_lru_statistics[CACHE_LRU_SIZE];
+int      cache_lru_limit = CACHE_LRU_DEFAULT;
 
 char	file_out[NI_MAXHOST] = "";
 int	file_out_flag = 0;
@@ -81,6 +89,13 @@ int	file_out_flush = 0;
 char	file_out_mode[NI_MAXHOST] = "";
 FILE	*FILE_OUT;
 
+/* worker threads (0 = single-threaded) */
+int	threads = 0;
+
+/* prefix set selecting lines (--filter-file), read-only while processing */
+static int opt_filter_file = 0;
+static s_ipaddrset filter_addrset;
+
 
 void printversion_verbose(const int level) {
 	printversion();
@@ -209,6 +224,20 @@ int main(int argc,char *argv[]) {
 				flag_nocache = 1;
 				break;
 
+			case 'T':
+				threads = liblinebatch_threads_option(optarg);
+				break;
+
+			case CMD_filter_file:
+				if (opt_filter_file == 0) {
+					libipaddrset_init(&filter_addrset);
+				};
+				if (libipaddrset_load(&filter_addrset, optarg) != 0) {
+					exit(EXIT_FAILURE);
+				};
+				opt_filter_file = 1;
+				break;
+
 			default:
 				ipv6loganon_printinfo();
 				exit(EXIT_FAILURE);
@@ -271,7 +300,29 @@ int main(int argc,char *argv[]) {
 		};
 	};
 
-	lineparser();
+#ifdef SUPPORT_PTHREAD
+	if (threads > 0) {
+		if (libipv6calc_db_wrapper_threads_init() != 0) {
+			fprintf(stderr, "Can't initialize database wrapper for threads\n");
+			exit(EXIT_FAILURE);
+		};
+
+		lineparser_threads();
+	} else {
+#endif
+		if (flag_nocache == 0) {
+			if (libipaddrcache_init(&cache, (uint32_t) cache_lru_limit) != 0) {
+				fprintf(stderr, "Can't allocate cache with limit: %d\n", cache_lru_limit);
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		lineparser();
+
+		libipaddrcache_cleanup(&cache);
+#ifdef SUPPORT_PTHREAD
+	};
+#endif
 
 	if (file_out_flag == 2) {
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Output file is closed now: %s", file_out);
@@ -281,6 +332,10 @@ int main(int argc,char *argv[]) {
 		fflush(stdout);
 	};
 
+	if (opt_filter_file == 1) {
+		libipaddrset_cleanup(&filter_addrset);
+	};
+
 	libipv6calc_db_wrapper_cleanup();
 
 	exit(EXIT_SUCCESS);
@@ -291,23 +346,25 @@ int main(int argc,char *argv[]) {
  * Line parser
  */
 static void lineparser(void) {
-	char linebuffer[LINEBUFFER];
-	char token[LINEBUFFER];
-	char resultstring[LINEBUFFER];
-	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i;
+	char *linebuffer;
+	char outline[LINEBUFFER * 2 + 2];
+	int linecounter = 0;
+	s_linereader reader;
 
-	ptrptr = &cptr;
-	
 	if (ipv6calc_quiet == 0) {
 		fprintf(stderr, "Expecting log lines on stdin\n");
 	};
 
+	if (liblinereader_open(&reader, fileno(stdin)) != 0) {
+		fprintf(stderr, "Can't read from stdin\n");
+		exit(EXIT_FAILURE);
+	};
+
 	while (1 == 1) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
+		/* read line from stdin (in place, no copy) */
+		linebuffer = liblinereader_getline(&reader, LINEBUFFER, NULL);
 		
-		if (charptr == NULL) {
+		if (linebuffer == NULL) {
 			/* end of input */
 			break;
 		};
@@ -320,57 +377,15 @@ static void lineparser(void) {
 			};
 		};
 	
-		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Line number: %d", linecounter);
-
-		if (strlen(linebuffer) >= LINEBUFFER) {
-			fprintf(stderr, "Line too long: %d\n", linecounter);
-			continue;
-		};
-		
-		if (strlen(linebuffer) == 0) {
-			fprintf(stderr, "Line empty: %d\n", linecounter);
-			continue;
-		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Got line: '%s'", linebuffer);
-
-		/* look for first token */
-		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
-		
-		if ( charptr == NULL ) {
-			fprintf(stderr, "Line contains no token: %d\n", linecounter);
-			continue;
-		};
-
-		if ( strlen(charptr) >=  LINEBUFFER) {
-			fprintf(stderr, "Line too strange: %d\n", linecounter);
+		if (lineparser_line(linebuffer, linecounter, &cache, outline, sizeof(outline)) != 0) {
 			continue;
 		};
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
-		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token 1: '%s'", token);
-		
-		/* call anonymizer now */
-		retval = anonymizetoken(resultstring, sizeof(resultstring), charptr);
-
-		if (retval != 0) {
-			continue;
-		};
-		
 		/* print result and rest of line, if available */
-		if (*ptrptr[0] != '\0') {
-			if (file_out_flag == 2) {
-				fprintf(FILE_OUT, "%s %s", resultstring, *ptrptr);
-			} else {
-				printf("%s %s", resultstring, *ptrptr);
-			};
+		if (file_out_flag == 2) {
+			fputs(outline, FILE_OUT);
 		} else {
-			if (file_out_flag == 2) {
-				fprintf(FILE_OUT, "%s\n", resultstring);
-			} else {
-				printf("%s\n", resultstring);
-			};
+			fputs(outline, stdout);
 		};
 
 		if (file_out_flush == 1) {
@@ -382,32 +397,286 @@ static void lineparser(void) {
 		};
 	};
 
+	liblinereader_close(&reader);
+
+	if (reader.error != 0) {
+		fprintf(stderr, "Error reading from stdin, input is incomplete\n");
+		exit(EXIT_FAILURE);
+	};
+
 	if (ipv6calc_quiet == 0) {
 		fprintf(stderr, "...finished\n");
 
 		if (flag_nocache == 0) {
 			fprintf(stderr, "Cache statistics:\n");
-			for (i = 0; i < cache_lru_limit; i++) {
-				fprintf(stderr, "Cache distance: %3d  hits: %8ld\n", i, cache_lru_statistics[i]);
+			fprintf(stderr, "Cache limit    : %8d\n", cache_lru_limit);
+			fprintf(stderr, "Cache entries  : %8u\n", cache.used);
+			fprintf(stderr, "Cache hits     : %8lu\n", cache.hit);
+			fprintf(stderr, "Cache misses   : %8lu\n", cache.miss);
+			fprintf(stderr, "Cache evictions: %8lu\n", cache.evict);
+		};
+	};
+	return;
+};
+
+
+/*
+ * Parse and anonymize one line
+ *
+ * in : linebuffer (modified), linecounter (for messages), cachep
+ * mod: outline (anonymized line incl. rest of line)
+ * out: 0=ok, 1=skip line
+ */
+static int lineparser_line(char *linebuffer, const int linecounter, s_ipaddrcache *cachep, char *outline, const size_t outline_length) {
+	char resultstring[LINEBUFFER];
+	char *charptr, *cptr, **ptrptr;
+	int retval;
+
+	ptrptr = &cptr;
+
+	DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Line number: %d", linecounter);
+
+	if (strlen(linebuffer) >= LINEBUFFER) {
+		fprintf(stderr, "Line too long: %d\n", linecounter);
+		return(1);
+	};
+	
+	if (strlen(linebuffer) == 0) {
+		fprintf(stderr, "Line empty: %d\n", linecounter);
+		return(1);
+	};
+	
+	DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Got line: '%s'", linebuffer);
+
+	/* look for first token */
+	charptr = strtok_r(linebuffer, " \t\n", ptrptr);
+	
+	if ( charptr == NULL ) {
+		fprintf(stderr, "Line contains no token: %d\n", linecounter);
+		return(1);
+	};
+
+	if ( strlen(charptr) >=  LINEBUFFER) {
+		fprintf(stderr, "Line too strange: %d\n", linecounter);
+		return(1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token 1: '%s'", charptr);
+
+	if ((opt_filter_file == 1) && (libipv6calc_filter_addrset_token(&filter_addrset, charptr) != 0)) {
+		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Skip line not selected by prefix set: %d", linecounter);
+		return(1);
+	};
+	
+	/* call anonymizer now */
+	retval = anonymizetoken(resultstring, sizeof(resultstring), charptr, cachep);
+
+	if (retval != 0) {
+		return(1);
+	};
+	
+	/* result and rest of line, if available */
+	if (*ptrptr[0] != '\0') {
+		snprintf(outline, outline_length, "%s %s", resultstring, *ptrptr);
+	} else {
+		snprintf(outline, outline_length, "%s\n", resultstring);
+	};
+
+	return(0);
+};
+
+
+#ifdef SUPPORT_PTHREAD
+/*
+ * Multi-threaded line parser
+ *
+ * main thread reads batches of lines into a ring of slots, worker threads
+ * (each with an own cache) anonymize them, a writer thread prints the batches
+ * in input order, so output is the same as in single-threaded mode
+ */
+static s_linebatch_ring *batches;
+
+typedef struct {
+	pthread_t     thread;
+	s_ipaddrcache cache;
+} s_loganon_worker;
+
+
+/* worker thread: anonymize ready batches */
+static void *lineparser_worker(void *arg) {
+	s_loganon_worker *workerp = (s_loganon_worker *) arg;
+	s_linebatch *batchp;
+	char outline[LINEBUFFER * 2 + 2];
+	char *linebuffer, *lineptr;
+	int l;
+
+	while ((batchp = liblinebatch_ring_get_ready(batches)) != NULL) {
+		batchp->out_used = 0;
+		lineptr = NULL;
+		for (l = 0; l < batchp->lines; l++) {
+			linebuffer = liblinebatch_line_next(batchp, &lineptr);
+
+			if (lineparser_line(linebuffer, batchp->linecounter + l, &workerp->cache, outline, sizeof(outline)) != 0) {
+				continue;
+			};
+
+			if (liblinebatch_buffer_append(&batchp->out, &batchp->out_size, &batchp->out_used, outline, strlen(outline)) != 0) {
+				fprintf(stderr, "Can't allocate output buffer for line: %d\n", batchp->linecounter + l);
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		liblinebatch_ring_put_done(batches, batchp);
+	};
+
+	return(NULL);
+};
+
+
+/* writer thread: print done batches in input order */
+static void *lineparser_writer(void *arg) {
+	s_linebatch *batchp;
+	FILE *out = (file_out_flag == 2) ? FILE_OUT : stdout;
+
+	(void) arg;
+
+	while ((batchp = liblinebatch_ring_get_done(batches)) != NULL) {
+		if (batchp->out_used > 0) {
+			fwrite(batchp->out, 1, batchp->out_used, out);
+		};
+
+		if (file_out_flush == 1) {
+			fflush(out);
+		};
+
+		liblinebatch_ring_put_free(batches, batchp);
+	};
+
+	return(NULL);
+};
+
+
+static void lineparser_threads(void) {
+	int linecounter = 0, batch_lines = LINEBATCH_LINES, i, r, eof = 0;
+	s_linereader reader;
+	s_loganon_worker *workers;
+	s_linebatch *batchp;
+	pthread_t writer;
+	uint32_t cache_used = 0;
+	long unsigned int cache_hit = 0, cache_miss = 0, cache_evict = 0;
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "Expecting log lines on stdin (using %d threads)\n", threads);
+	};
+
+	if (file_out_flush == 1) {
+		// don't delay lines waiting for a full batch
+		batch_lines = 1;
+	};
+
+	if (liblinereader_open(&reader, fileno(stdin)) != 0) {
+		fprintf(stderr, "Can't read from stdin\n");
+		exit(EXIT_FAILURE);
+	};
+
+	batches = liblinebatch_ring_new(threads, 1);
+	workers = calloc((size_t) threads, sizeof(s_loganon_worker));
+	if ((batches == NULL) || (workers == NULL)) {
+		fprintf(stderr, "Can't allocate memory for threads: %d\n", threads);
+		exit(EXIT_FAILURE);
+	};
+
+	for (i = 0; i < threads; i++) {
+		if (flag_nocache == 0) {
+			if (libipaddrcache_init(&workers[i].cache, (uint32_t) cache_lru_limit) != 0) {
+				fprintf(stderr, "Can't allocate cache with limit: %d\n", cache_lru_limit);
+				exit(EXIT_FAILURE);
 			};
 		};
+
+		r = pthread_create(&workers[i].thread, NULL, lineparser_worker, &workers[i]);
+		if (r != 0) {
+			fprintf(stderr, "Can't create worker thread: %d\n", i);
+			exit(EXIT_FAILURE);
+		};
+	};
+
+	r = pthread_create(&writer, NULL, lineparser_writer, NULL);
+	if (r != 0) {
+		fprintf(stderr, "Can't create writer thread\n");
+		exit(EXIT_FAILURE);
+	};
+
+	/* read batches from stdin */
+	while (eof == 0) {
+		batchp = liblinebatch_ring_get_free(batches);
+
+		eof = liblinebatch_fill(batchp, &reader, batch_lines, LINEBUFFER, &linecounter);
+		if (eof < 0) {
+			exit(EXIT_FAILURE);
+		};
+
+		liblinebatch_ring_put_ready(batches, batchp, eof);
+	};
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(workers[i].thread, NULL);
+	};
+	pthread_join(writer, NULL);
+
+	liblinereader_close(&reader);
+
+	if (reader.error != 0) {
+		fprintf(stderr, "Error reading from stdin, input is incomplete\n");
+		exit(EXIT_FAILURE);
+	};
+
+	for (i = 0; i < threads; i++) {
+		if (flag_nocache == 0) {
+			cache_used  += workers[i].cache.used;
+			cache_hit   += workers[i].cache.hit;
+			cache_miss  += workers[i].cache.miss;
+			cache_evict += workers[i].cache.evict;
+			libipaddrcache_cleanup(&workers[i].cache);
+		};
+	};
+
+	liblinebatch_ring_free(batches);
+	free(workers);
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "...finished\n");
+
+		if (flag_nocache == 0) {
+			fprintf(stderr, "Cache statistics (sum of %d threads):\n", threads);
+			fprintf(stderr, "Cache limit    : %8d (per thread)\n", cache_lru_limit);
+			fprintf(stderr, "Cache entries  : %8u\n", cache_used);
+			fprintf(stderr, "Cache hits     : %8lu\n", cache_hit);
+			fprintf(stderr, "Cache misses   : %8lu\n", cache_miss);
+			fprintf(stderr, "Cache evictions: %8lu\n", cache_evict);
+		};
 	};
 	return;
 };
+#endif // SUPPORT_PTHREAD
 
 
 /*
  * Anonymize token
  */
-static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token) {
+static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token, s_ipaddrcache *cachep) {
 	uint32_t inputtype = FORMAT_undefined;
 	int retval = 1, i;
+	int flag_cache = 0;
+	uint32_t cache_tag = CACHE_TAG_ANONYMIZE;
+	const char *cached;
 
 	/* used structures */
 	ipv6calc_ipv6addr  ipv6addr;
 	ipv6calc_ipv4addr  ipv4addr;
 	ipv6calc_macaddr   macaddr;
 	ipv6calc_eui64addr eui64addr;
+	ipv6calc_ipaddr    ipaddr;
 
 	DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token: '%s'", token);
 
@@ -418,48 +687,20 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 		return (1);
 	};
 
-	/* use cache ? */
-	if (flag_nocache == 0 && cache_lru_max > 0) {
-		/* check last seen one first */
-		DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "LRU cache: look for key=%s", token);
-
-		if (strcmp(cache_lru_key_token[cache_lru_last - 1], token) == 0) {
-			snprintf(resultstring, resultstring_length, "%s", cache_lru_value[cache_lru_last - 1]);
-			cache_lru_statistics[0]++;
-			DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "LRU cache: hit last line=%d key_token=%s value=%s", cache_lru_last - 1, token, resultstring);
-			return (0);
-		};
-		/* run backwards to first entry */
-		if (cache_lru_last > 1) {
-			for (i = cache_lru_last - 1; i > 0; i--) {
-				if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-					snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-					cache_lru_statistics[cache_lru_last - i]++;
-					DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "LRU cache: hit line=%d key_token=%s value=%s", i - 1, token, resultstring);
-					return (0);
-				};
-			};
-		};
-		/* round robin */ 
-		if (cache_lru_last < cache_lru_max) {
-			for (i = cache_lru_max; i > cache_lru_last; i--) {
-				if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-					snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-					cache_lru_statistics[cache_lru_max - i + cache_lru_last]++;
-					DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "LRU cache: hit line=%d key_token=%s value=%s", i - 1, token, resultstring);
-					return (0);
-				};
-			};
-		};
-	};
-
-
 	/* set addresses to invalid */
 	ipv6addr.flag_valid = 0;
 	ipv4addr.flag_valid = 0;
+	macaddr.flag_valid = 0;
+	eui64addr.flag_valid = 0;
+	libipaddr_clearall(&ipaddr);
 	
-	/* autodetection */
-	inputtype = libipv6calc_autodetectinput(token);
+	/* fast path: plain IPv4/IPv6 address is detected and parsed in one pass */
+	inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+
+	if (inputtype == FORMAT_auto_noresult) {
+		/* autodetection */
+		inputtype = libipv6calc_autodetectinput(token);
+	};
 
 	DEBUGSECTION_BEGIN(DEBUG_ipv6loganon_general)
 		if (inputtype != FORMAT_undefined) {
@@ -475,14 +716,14 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 		};
 	DEBUGSECTION_END
 
-	/* proceed input depending on type */	
+	/* proceed input depending on type (if not already done by fast path) */
 	switch (inputtype) {
 		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
+			retval = (ipv6addr.flag_valid == 1) ? 0 : addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
 			break;
 
 		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(token, resultstring, resultstring_length, &ipv4addr);
+			retval = (ipv4addr.flag_valid == 1) ? 0 : addr_to_ipv4addrstruct(token, resultstring, resultstring_length, &ipv4addr);
 			break;
 
 		case FORMAT_eui64:
@@ -501,6 +742,39 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 
 	DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token: '%s'", token);
 
+	/* use cache ? (only plain addresses, prefix length and scope ID are part of the output) */
+	if (flag_nocache == 0) {
+		if ((ipv6addr.flag_valid == 1) && (ipv6addr.flag_prefixuse == 0) && (ipv6addr.flag_scopeid == 0)) {
+			CONVERT_IPV6ADDRP_IPADDR(&ipv6addr, ipaddr);
+			flag_cache = 1;
+		} else if ((ipv4addr.flag_valid == 1) && (ipv4addr.flag_prefixuse == 0)) {
+			CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+			flag_cache = 1;
+		} else if (eui64addr.flag_valid == 1) {
+			ipaddr.proto = IPV6CALC_PROTO_IPV6;
+			ipaddr.addr[0] = EUI64_00_31(eui64addr.addr);
+			ipaddr.addr[1] = EUI64_32_63(eui64addr.addr);
+			cache_tag = CACHE_TAG_ANONYMIZE_EUI64;
+			flag_cache = 1;
+		} else if (macaddr.flag_valid == 1) {
+			ipaddr.proto = IPV6CALC_PROTO_IPV6;
+			ipaddr.addr[0] = ((uint32_t) macaddr.addr[0] << 16) | ((uint32_t) macaddr.addr[1] << 8) | macaddr.addr[2];
+			ipaddr.addr[1] = ((uint32_t) macaddr.addr[3] << 16) | ((uint32_t) macaddr.addr[4] << 8) | macaddr.addr[5];
+			cache_tag = CACHE_TAG_ANONYMIZE_MAC;
+			flag_cache = 1;
+		};
+
+		if (flag_cache == 1) {
+			cached = libipaddrcache_lookup(cachep, &ipaddr, cache_tag);
+
+			if (cached != NULL) {
+				snprintf(resultstring, resultstring_length, "%s", cached);
+				DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "cache: hit key_token=%s value=%s", token, resultstring);
+				return (0);
+			};
+		};
+	};
+
 	/***** postprocessing input *****/
 	
 	DEBUGPRINT_NA(DEBUG_ipv6loganon_general, "Start of postprocessing input");
@@ -540,24 +814,9 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 	};
 
 	/* use cache ? */
-	if (flag_nocache == 0) {
-		/* calculate pointer */
-		if (cache_lru_max < cache_lru_limit) {
-			cache_lru_last++;
-			cache_lru_max++;
-		} else {
-			if (cache_lru_last == cache_lru_limit) {
-				cache_lru_last = 1;
-			} else {
-				cache_lru_last++;
-			};
-
-		};
-
-		/* store key and value */
-		snprintf(cache_lru_key_token[cache_lru_last - 1], NI_MAXHOST, "%s", token);
-		snprintf(cache_lru_value[cache_lru_last - 1], NI_MAXHOST, "%s", resultstring);
-		DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "LRU cache: fill line=%d key_token=%s value=%s", cache_lru_last - 1, cache_lru_key_token[cache_lru_last - 1], cache_lru_value[cache_lru_last - 1]);
+	if (flag_cache == 1) {
+		libipaddrcache_store(cachep, &ipaddr, cache_tag, resultstring);
+		DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "cache: fill key_token=%s value=%s", token, resultstring);
 	};
 
 	return (0);
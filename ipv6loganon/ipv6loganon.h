@@ -13,8 +13,9 @@
 #define PROGRAM_NAME "ipv6loganon"
 #define PROGRAM_COPYRIGHT "(P) & (C) 2007-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
 
-/* LRU cache maximum size */
-#define CACHE_LRU_SIZE 200
+/* token cache default and maximum size */
+#define CACHE_LRU_DEFAULT	65536
+#define CACHE_LRU_SIZE		16777216
 
 #define DEBUG_ipv6loganon_general      0x00000001l
 
@@ -16,6 +16,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calccommands.h"
 #include "ipv6calchelp.h"
+#include "liblinebatch.h"
 #include "config.h"
 
 /* display info */
@@ -77,6 +78,13 @@ void ipv6loganon_printhelp(void) {
 	fprintf(stderr, "  [-c|--cachelimit <value>]  : set cache limit\n");
 	fprintf(stderr, "                               default: %d\n", cache_lru_limit);
 	fprintf(stderr, "                               maximum: %d\n", CACHE_LRU_SIZE);
+	fprintf(stderr, "  [-T|--threads <value>]     : number of worker threads (0: single-threaded)\n");
+	fprintf(stderr, "                               output order is kept, cache is per thread\n");
+	fprintf(stderr, "                               lookups in GeoIP/IP2Location/DB-IP/External databases\n");
+	fprintf(stderr, "                               are serialized, only BuiltIn/MMAP run in parallel\n");
+	fprintf(stderr, "                               maximum: %d\n", LINEBATCH_THREADS_MAX);
+	fprintf(stderr, "  [--filter-file <file>]     : output only lines with address selected by prefix set\n");
+	fprintf(stderr, "                               (format see: ipv6calc -E -?)\n");
 
 	printhelp_action_dispatcher(ACTION_anonymize, 1);
 
@@ -20,7 +20,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6loganon_shortopts = "vh?nc:w:a:f";
+static char *ipv6loganon_shortopts = "vh?nc:w:a:fT:";
 
 /* define long options */
 static struct option ipv6loganon_longopts[] = {
@@ -35,6 +35,8 @@ static struct option ipv6loganon_longopts[] = {
 	{"cachelimit", required_argument, 0, (int) 'c'},
 	{"write"     , required_argument, 0, (int) 'w'},
 	{"append"    , required_argument, 0, (int) 'a'},
+	{"threads"   , required_argument, 0, (int) 'T'},
+	{"filter-file", required_argument, 0, CMD_filter_file},
 };                
 
 #endif
@@ -101,6 +101,12 @@ fe80::210:a489:ab01:2345 - -
 4.2.3.4 - -
 5.2.3.4 - -
 195.226.187.50	- - "IPv4 address"
+00:11:22:33:44:55 - -
+00-11-22-33-44-55 - -
+00:11:22:33:44:56 - -
+01:23:45:67:89:ab:cd:ef - -
+01-23-45-67-89-ab-cd-ef - -
+00:11:22:33:44:55 - -
 END_CACHE
 }
 
@@ -441,6 +447,142 @@ run_loganon_options_kp_tests() {
 	echo "INFO  : test scenario with huge amount of addresses: OK"
 }
 
+run_loganon_threads_tests() {
+	if ! ./ipv6loganon -h 2>&1 | grep -q -- "--threads"; then
+		echo "NOTICE: 'ipv6loganon' has no support for threads, skip threads tests"
+		return 0
+	fi
+
+	echo "INFO  : run 'ipv6loganon' threads tests..." >&2
+	list="`testscenarios_standard | awk -F= '{ print $1 }'; testscenarios_cache; testscenario_hugelist ipv4`"
+	single="`echo "$list" | ./ipv6loganon -q | md5sum`"
+	for threads in 1 2 4; do
+		multi="`echo "$list" | ./ipv6loganon -q --threads $threads | md5sum`"
+		if [ "$single" != "$multi" ]; then
+			echo "ERROR : output differs between single-threaded and --threads $threads"
+			return 1
+		fi
+		[ "$verbose" = "1" ] && echo "INFO  : --threads $threads -> test ok"
+	done
+	echo "INFO  : run 'ipv6loganon' threads tests successful" >&2
+}
+
+run_loganon_cache_tests() {
+	echo "INFO  : run 'ipv6loganon' cache tests..." >&2
+	list="`testscenarios_cache`"
+	nocache="`echo "$list" | ./ipv6loganon -q -n | md5sum`"
+	cache="`echo "$list" | ./ipv6loganon -q | md5sum`"
+	if [ "$nocache" != "$cache" ]; then
+		echo "ERROR : output differs between with and without cache"
+		return 1
+	fi
+
+	# MAC/EUI-64 addresses are cached as well (independent from notation)
+	hits="`echo -e "00:11:22:33:44:55\n00-11-22-33-44-55\n01:23:45:67:89:ab:cd:ef\n01-23-45-67-89-ab-cd-ef" | ./ipv6loganon -V 2>&1 >/dev/null | awk '$1 == "Cache" && $2 == "hits" { print $4 }'`"
+	if [ "$hits" != "2" ]; then
+		echo "ERROR : unexpected cache hits for MAC/EUI-64 addresses: $hits"
+		return 1
+	fi
+	echo "INFO  : run 'ipv6loganon' cache tests successful" >&2
+}
+
+# $1: format (gzip|zstd), $2: compressor command
+run_loganon_compressed_format_tests() {
+	local format="$1" compressor="$2"
+
+	if ! which $compressor >/dev/null 2>&1; then
+		echo "NOTICE: '$compressor' not available, skip $format input tests"
+		return 0
+	fi
+
+	local tmpfile=$(mktemp /tmp/test_ipv6loganon.XXXXXX)
+	local tmpfile_broken=$(mktemp /tmp/test_ipv6loganon.XXXXXX)
+	local plain compressed size result=0
+
+	echo "$list" | $compressor -c > $tmpfile
+	plain="`echo "$list" | ./ipv6loganon -q | md5sum`"
+
+	if ./ipv6loganon -q < $tmpfile 2>&1 >/dev/null | grep -q "support is not compiled-in"; then
+		echo "NOTICE: 'ipv6loganon' has no support for $format input, skip $format input tests"
+		rm -f $tmpfile $tmpfile_broken
+		return 0
+	fi
+
+	compressed="`./ipv6loganon -q < $tmpfile | md5sum`"
+	if [ "$plain" != "$compressed" ]; then
+		echo "ERROR : output differs between plain and $format compressed input"
+		result=1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : $format complete input -> test ok"
+
+	# concatenated gzip members/zstd frames
+	compressed="`cat $tmpfile $tmpfile | ./ipv6loganon -q | md5sum`"
+	plain="`(echo "$list"; echo "$list") | ./ipv6loganon -q | md5sum`"
+	if [ "$plain" != "$compressed" ]; then
+		echo "ERROR : output differs between plain and concatenated $format compressed input"
+		result=1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : $format concatenated input -> test ok"
+
+	size=$(wc -c < $tmpfile)
+
+	# truncated input
+	head -c $[ size / 2 ] $tmpfile > $tmpfile_broken
+	if ./ipv6loganon -q < $tmpfile_broken >/dev/null 2>&1; then
+		echo "ERROR : truncated $format input not detected"
+		result=1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : $format truncated input -> test ok"
+
+	# corrupt input (overwrite 64 bytes in the middle of the stream)
+	(head -c $[ size / 2 ] $tmpfile; head -c 64 /dev/zero | tr '\0' 'x'; tail -c +$[ size / 2 + 65 ] $tmpfile) > $tmpfile_broken
+	if ./ipv6loganon -q < $tmpfile_broken >/dev/null 2>&1; then
+		echo "ERROR : corrupt $format input not detected"
+		result=1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : $format corrupt input -> test ok"
+
+	rm -f $tmpfile $tmpfile_broken
+	return $result
+}
+
+run_loganon_compressed_tests() {
+	echo "INFO  : run 'ipv6loganon' compressed input tests..." >&2
+	list="`testscenarios_standard | awk -F= '{ print $1 }'; testscenarios_cache; testscenario_hugelist ipv4`"
+
+	run_loganon_compressed_format_tests gzip gzip || return 1
+	run_loganon_compressed_format_tests zstd zstd || return 1
+	echo "INFO  : run 'ipv6loganon' compressed input tests successful" >&2
+}
+
+run_loganon_filter_file_tests() {
+	echo "INFO  : run 'ipv6loganon' filter-file tests..." >&2
+	local tmpfile=$(mktemp /tmp/test_ipv6loganon.XXXXXX)
+	local input output expected threads
+
+	cat <<END >$tmpfile
+192.168.0.0/16
+2001:db8::/32
+^2001:db8::a0fc:4291:a0fc:1884/128
+END
+
+	input="`echo -e "192.168.1.1 - - x\n10.1.1.1 - - x\nunknown - - x\n2001:db8::a0fc:4941:a0fc:3041 - - x\n2001:db8::a0fc:4291:a0fc:1884 - - x"`"
+	expected="`echo -e "192.168.1.1 - - x\n2001:db8::a0fc:4941:a0fc:3041 - - x" | ./ipv6loganon -q`"
+
+	for threads in 0 2; do
+		output="`echo "$input" | ./ipv6loganon -q --threads $threads --filter-file $tmpfile`"
+		if [ $? -ne 0 -o "$output" != "$expected" ]; then
+			echo "ERROR : unexpected result with filter-file (threads: $threads): $output"
+			rm -f $tmpfile
+			return 1
+		fi
+		[ "$verbose" = "1" ] && echo "INFO  : --filter-file --threads $threads -> test ok"
+	done
+
+	rm -f $tmpfile
+	echo "INFO  : run 'ipv6loganon' filter-file tests successful" >&2
+}
+
 
 #### Main
 
@@ -466,6 +608,30 @@ if [ $? -ne 0 ]; then
 	exit 1
 fi
 
+run_loganon_cache_tests
+if [ $? -ne 0 ]; then
+	echo "ERROR : run_loganon_cache_tests failed"
+	exit 1
+fi
+
+run_loganon_threads_tests
+if [ $? -ne 0 ]; then
+	echo "ERROR : run_loganon_threads_tests failed"
+	exit 1
+fi
+
+run_loganon_compressed_tests
+if [ $? -ne 0 ]; then
+	echo "ERROR : run_loganon_compressed_tests failed"
+	exit 1
+fi
+
+run_loganon_filter_file_tests
+if [ $? -ne 0 ]; then
+	echo "ERROR : run_loganon_filter_file_tests failed"
+	exit 1
+fi
+
 
 echo "All tests were successfully done!" >&2
 
@@ -55,16 +55,15 @@ static int converttoken(char *result, const size_t resultstring_length, const ch
 static void lineparser(const long int outputtype);
 
 
-/* LRU cache */
+/* result cache keyed on binary address and output type */
+static s_ipaddrcache cache;
 
-#define CACHE_LRU_SIZE 200
+/* batch lookup results of lines ahead in input buffer */
+static s_ipv6calc_db_batch batch;
 
-static int      cache_lru_max = 0;
-static int      cache_lru_last = 0;
-static char     cache_lru_key_token[CACHE_LRU_SIZE][NI_MAXHOST];
-static long int cache_lru_key_outputtype[CACHE_LRU_SIZE];
-static char     cache_lru_value[CACHE_LRU_SIZE][NI_MAXHOST];
-static long int cache_lru_statistics[CACHE_LRU_SIZE];
+/* prefix set selecting lines (--filter-file) */
+static int opt_filter_file = 0;
+static s_ipaddrset filter_addrset;
 
 int feature_reg = 0;
 int feature_ieee = 0;
@@ -81,7 +80,7 @@ int main(int argc,char *argv[]) {
 	int i, lop, result;
 	unsigned long int command = 0;
 
-	cache_lru_limit = 20; /* optimum */
+	cache_lru_limit = CACHE_LRU_DEFAULT;
 
 	/* new option style storage */	
 	uint32_t inputtype  = FORMAT_undefined, outputtype = FORMAT_undefined;
@@ -182,6 +181,16 @@ int main(int argc,char *argv[]) {
 				command = CMD_printexamples;
 				break;
 
+			case CMD_filter_file:
+				if (opt_filter_file == 0) {
+					libipaddrset_init(&filter_addrset);
+				};
+				if (libipaddrset_load(&filter_addrset, optarg) != 0) {
+					exit(EXIT_FAILURE);
+				};
+				opt_filter_file = 1;
+				break;
+
 			default:
 				fprintf(stderr, "Usage: (see '%s --command -?|-h|--help' for more help)\n", PROGRAM_NAME);
 				ipv6logconv_printhelp();
@@ -239,9 +248,23 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
+	if (flag_nocache == 0) {
+		if (libipaddrcache_init(&cache, (uint32_t) cache_lru_limit) != 0) {
+			fprintf(stderr, "Can't allocate cache with limit: %d\n", cache_lru_limit);
+			exit(EXIT_FAILURE);
+		};
+	};
+
 	/* call lineparser */
 	lineparser(outputtype);
 
+	libipaddrcache_cleanup(&cache);
+	libipv6calc_db_wrapper_batch_cleanup(&batch);
+
+	if (opt_filter_file == 1) {
+		libipaddrset_cleanup(&filter_addrset);
+	};
+
 	libipv6calc_db_wrapper_cleanup();
 
 	exit(EXIT_SUCCESS);
@@ -252,11 +275,15 @@ int main(int argc,char *argv[]) {
  * Line parser
  */
 static void lineparser(const long int outputtype) {
-	char linebuffer[LINEBUFFER];
-	char token[LINEBUFFER];
+	char *linebuffer, *token;
+	const char *data;
 	char resultstring[LINEBUFFER];
 	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i;
+	int linecounter = 0, retval;
+	int batch_lines = 0, batch_num;
+	size_t linelength, datalength;
+	s_linereader reader;
+	ipv6calc_ipaddr *batch_ipaddrs;
 
 	ptrptr = &cptr;
 	
@@ -264,17 +291,41 @@ static void lineparser(const long int outputtype) {
 		fprintf(stderr, "Expecting log lines on stdin\n");
 	};
 
+	if (liblinereader_open(&reader, fileno(stdin)) != 0) {
+		fprintf(stderr, "Can't read from stdin\n");
+		exit(EXIT_FAILURE);
+	};
+
+	batch_ipaddrs = malloc(sizeof(ipv6calc_ipaddr) * LOOKUP_BATCH_LINES);
+	if (batch_ipaddrs == NULL) {
+		fprintf(stderr, "Can't allocate memory for batch lookup\n");
+		exit(EXIT_FAILURE);
+	};
+
 	while (1 == 1) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
+		if ((feature_reg == 1) && (flag_nocache == 0) && (batch_lines == 0)) {
+			/* resolve addresses of lines ahead in input buffer at once (merge-join in database) */
+			data = liblinereader_peek(&reader, &datalength);
+			batch_lines = libipv6calc_collect_ipv4addrs(data, datalength, LOOKUP_BATCH_LINES, batch_ipaddrs, &batch_num);
+			if (batch_num > 0) {
+				libipv6calc_db_wrapper_batch_prepare(&batch, batch_ipaddrs, batch_num);
+			};
+		};
+
+		/* read line from stdin (in place, no copy) */
+		linebuffer = liblinereader_getline(&reader, LINEBUFFER, &linelength);
 		
-		if (charptr == NULL) {
+		if (linebuffer == NULL) {
 			/* end of input */
 			break;
 		};
 
 		linecounter++;
 
+		if (batch_lines > 0) {
+			batch_lines--;
+		};
+
 		if (linecounter == 1) {
 			if (ipv6calc_quiet == 0) {
 				fprintf(stderr, "Ok, proceeding stdin...\n");
@@ -283,12 +334,12 @@ static void lineparser(const long int outputtype) {
 		
 		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Line counter: %d", linecounter);
 
-		if (strlen(linebuffer) >= LINEBUFFER) {
+		if (linelength >= LINEBUFFER) {
 			fprintf(stderr, "Line too long: %d\n", linecounter);
 			continue;
 		};
 		
-		if (strlen(linebuffer) == 0) {
+		if (linebuffer[0] == '\0') {
 			fprintf(stderr, "Line empty: %d\n", linecounter);
 			continue;
 		};
@@ -308,9 +359,15 @@ static void lineparser(const long int outputtype) {
 			continue;
 		};
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
+		/* token is kept in place, strtok_r terminates it inside the line */
+		token = charptr;
+
 		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token 1: '%s'", token);
+
+		if ((opt_filter_file == 1) && (libipv6calc_filter_addrset_token(&filter_addrset, token) != 0)) {
+			DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Skip line not selected by prefix set: %d", linecounter);
+			continue;
+		};
 		
 		/* call converter now */
 		if ( outputtype == FORMAT_any ) {
@@ -377,14 +434,25 @@ END_line:
 		};
 	};
 
+	free(batch_ipaddrs);
+
+	liblinereader_close(&reader);
+
+	if (reader.error != 0) {
+		fprintf(stderr, "Error reading from stdin, input is incomplete\n");
+		exit(EXIT_FAILURE);
+	};
+
 	if (ipv6calc_quiet == 0) {
 		fprintf(stderr, "...finished\n");
 
 		if (flag_nocache == 0) {
 			fprintf(stderr, "Cache statistics:\n");
-			for (i = 0; i < cache_lru_limit; i++) {
-				fprintf(stderr, "Cache distance: %3d  hits: %8ld\n", i, cache_lru_statistics[i]);
-			};
+			fprintf(stderr, "Cache limit    : %8d\n", cache_lru_limit);
+			fprintf(stderr, "Cache entries  : %8u\n", cache.used);
+			fprintf(stderr, "Cache hits     : %8lu\n", cache.hit);
+			fprintf(stderr, "Cache misses   : %8lu\n", cache.miss);
+			fprintf(stderr, "Cache evictions: %8lu\n", cache.evict);
 		};
 	};
 	return;
@@ -400,6 +468,9 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 	uint32_t typeinfo, typeinfo_test;
 	char tempstring[NI_MAXHOST];
 	ipv6calc_macaddr macaddr;
+	ipv6calc_ipaddr ipaddr;
+	int flag_cache = 0;
+	const char *cached;
 
 	/* used structures */
 	ipv6calc_ipv6addr ipv6addr;
@@ -414,55 +485,17 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 		return (1);
 	};
 
-	/* use cache ? */
-	if (flag_nocache == 0 && cache_lru_max > 0) {
-		/* check last seen one first */
-		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: look for key=%s", token);
-
-		if (cache_lru_key_outputtype[cache_lru_last - 1] == outputtype) {
-			if (strcmp(cache_lru_key_token[cache_lru_last - 1], token) == 0) {
-				snprintf(resultstring, resultstring_length, "%s", cache_lru_value[cache_lru_last - 1]);
-				cache_lru_statistics[0]++;
-				DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit last line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, token, outputtype, resultstring);
-				return (0);
-			};
-		} else {
-			/* run backwards to first entry */
-			if (cache_lru_last > 1) {
-				for (i = cache_lru_last - 1; i > 0; i--) {
-					if (cache_lru_key_outputtype[i - 1] == outputtype) {
-						if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-							snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-							cache_lru_statistics[cache_lru_last - i]++;
-							DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit line=%d key_token=%s key_outputtype=%lx value=%s", i - 1, token, outputtype, resultstring);
-							return (0);
-						};
-					};
-				};
-			};
-			/* round robin */ 
-			if (cache_lru_last < cache_lru_max) {
-				for (i = cache_lru_max; i > cache_lru_last; i--) {
-					if (cache_lru_key_outputtype[i - 1] == outputtype) {
-						if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-							snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-							cache_lru_statistics[cache_lru_max - i + cache_lru_last]++;
-							DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit line=%d key_token=%s key_outputtype=%lx value=%s", i - 1, token, outputtype, resultstring);
-							return (0);
-						};
-					};
-				};
-			};
-		};
-	};
-
-
 	/* set addresses to invalid */
 	ipv6addr.flag_valid = 0;
 	ipv4addr.flag_valid = 0;
 	
-	/* autodetection */
-	inputtype = libipv6calc_autodetectinput(token);
+	/* fast path: plain IPv4/IPv6 address is detected and parsed in one pass */
+	inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+
+	if (inputtype == FORMAT_auto_noresult) {
+		/* autodetection */
+		inputtype = libipv6calc_autodetectinput(token);
+	};
 
 	DEBUGSECTION_BEGIN(DEBUG_ipv6logconv_processing)
 		if (inputtype != FORMAT_undefined) {
@@ -478,19 +511,42 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 		};
 	DEBUGSECTION_END
 
-	/* proceed input depending on type */	
+	/* proceed input depending on type (if not already done by fast path) */
 	switch (inputtype) {
 		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			retval = (ipv6addr.flag_valid == 1) ? 0 : addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
 			break;
 
 		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			retval = (ipv4addr.flag_valid == 1) ? 0 : addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
 			break;
 	};
 
 	DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token: '%s'", token);
 
+	/* use cache ? (only plain addresses) */
+	if (flag_nocache == 0) {
+		libipaddr_clearall(&ipaddr);
+
+		if ((ipv6addr.flag_valid == 1) && (ipv6addr.flag_prefixuse == 0) && (ipv6addr.flag_scopeid == 0)) {
+			CONVERT_IPV6ADDRP_IPADDR(&ipv6addr, ipaddr);
+			flag_cache = 1;
+		} else if ((ipv4addr.flag_valid == 1) && (ipv4addr.flag_prefixuse == 0)) {
+			CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+			flag_cache = 1;
+		};
+
+		if (flag_cache == 1) {
+			cached = libipaddrcache_lookup(&cache, &ipaddr, (uint32_t) outputtype);
+
+			if (cached != NULL) {
+				snprintf(resultstring, resultstring_length, "%s", cached);
+				DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "cache: hit key_token=%s key_outputtype=%lx value=%s", token, outputtype, resultstring);
+				return (0);
+			};
+		};
+	};
+
 	/***** postprocessing input *****/
 
 	DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "Start of postprocessing input");
@@ -581,7 +637,7 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 					ipv4addr_settype(&ipv4addr, 1); /* Set typeinfo */
 
 					/* IPv4 registry */
-					registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+					registry = libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(&batch, &ipv4addr);
 					snprintf(tempstring, sizeof(tempstring), "%s.%s", libipv6calc_registry_string_by_num(registry), resultstring);
 					snprintf(resultstring, resultstring_length, "%s", tempstring);
 				};
@@ -589,7 +645,7 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 				snprintf(resultstring, resultstring_length, "ipv4-addr.addrtype.ipv6calc");
 
 				/* IPv4 registry */
-				registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+				registry = libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(&batch, &ipv4addr);
 				snprintf(tempstring, sizeof(tempstring), "%s.%s", libipv6calc_registry_string_by_num(registry), resultstring);
 				snprintf(resultstring, resultstring_length, "%s", tempstring);
 			} else {
@@ -702,24 +758,9 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 	};
 
 	/* use cache ? */
-	if (flag_nocache == 0) {
-		/* calculate pointer */
-		if (cache_lru_max < cache_lru_limit) {
-			cache_lru_last++;
-			cache_lru_max++;
-		} else {
-			if (cache_lru_last == cache_lru_limit) {
-				cache_lru_last = 1;
-			} else {
-				cache_lru_last++;
-			};
-		};
-
-		/* store key and value */
-		snprintf(cache_lru_key_token[cache_lru_last - 1], NI_MAXHOST - 1, "%s", token);
-		cache_lru_key_outputtype[cache_lru_last - 1] = outputtype;
-		snprintf(cache_lru_value[cache_lru_last - 1], NI_MAXHOST - 1, "%s", resultstring);
-		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: fill line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, cache_lru_key_token[cache_lru_last - 1], cache_lru_key_outputtype[cache_lru_last - 1], cache_lru_value[cache_lru_last - 1]);
+	if (flag_cache == 1) {
+		libipaddrcache_store(&cache, &ipaddr, (uint32_t) outputtype, resultstring);
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "cache: fill key_token=%s key_outputtype=%lx value=%s", token, outputtype, resultstring);
 	};
 
 	return (0);
@@ -13,8 +13,12 @@
 #define PROGRAM_NAME "ipv6logconv"
 #define PROGRAM_COPYRIGHT "(P) & (C) 2002-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
 
-/* LRU cache maximum size */
-#define CACHE_LRU_SIZE 200
+/* cache default and maximum size */
+#define CACHE_LRU_DEFAULT	65536
+#define CACHE_LRU_SIZE		16777216
+
+/* lines ahead in input buffer resolved by batch lookup */
+#define LOOKUP_BATCH_LINES	4096
 
 
 #define DEBUG_ipv6logconv_general      0x00000001l
@@ -66,7 +66,7 @@ void ipv6logconv_printhelp(void) {
 	printhelp_common(IPV6CALC_HELP_BASIC);
 
 	fprintf(stderr, " Performance options:\n");
-	fprintf(stderr, "  [-n|--nocache]            : disable caching\n");
+	fprintf(stderr, "  [-n|--nocache]            : disable caching (incl. batch lookup of registries)\n");
 	fprintf(stderr, "  [-c|--cachelimit <value>] : set cache limit\n");
 	fprintf(stderr, "                               default: %d\n", cache_lru_limit);
 	fprintf(stderr, "                               maximum: %d\n", CACHE_LRU_SIZE);
@@ -76,6 +76,9 @@ void ipv6logconv_printhelp(void) {
 	fprintf(stderr, "   ouitype        : OUI (IEEE) type%s\n", (feature_ieee == 0) ? "  (NOT-SUPPORTED)" : "");
 	fprintf(stderr, "   ipv6addrtype   : IPv6 address type\n");
 	fprintf(stderr, "   any            : any type%s\n", ((feature_reg == 0) || (feature_ieee == 0)) ? "  (NOT-SUPPORTED)" : "");
+	fprintf(stderr, " Filter options:\n");
+	fprintf(stderr, "  [--filter-file <file>] : convert only lines with address selected by prefix set\n");
+	fprintf(stderr, "                           (format see: ipv6calc -E -?)\n");
 	fprintf(stderr, "\n");
 	if ((feature_reg == 0) || (feature_ieee == 0)) {
 			fprintf(stderr, " NOT-SUPPORTED means either database missing or support not compiled-in\n");
@@ -34,10 +34,11 @@ static struct option ipv6logconv_longopts[] = {
 
 	/* cache options */
 	{"nocache", 0, 0, (int) 'n'},
-	{"cachelimit", 0, 0, (int) 'c'},
+	{"cachelimit", 1, 0, (int) 'c'},
 
 	/* options */
 	{ "out"       , 1, 0, CMD_outputtype },
+	{ "filter-file", 1, 0, CMD_filter_file },
 };                
 
 #endif
@@ -96,7 +96,7 @@ END_CACHE
 ## main ##
 echo "Run 'ipv6logconv' function tests..." >&2
 
-if ./ipv6logconv -v | grep -w "CONV_REG" | grep -w "CONV_IEEE"; then
+if ./ipv6logconv -v 2>&1 | grep -w "CONV_REG" | grep -w "CONV_IEEE"; then
 	true
 else
 	echo "NOTICE : ipv6logconv tests skipped, at least one required database feature is missing"
@@ -143,6 +143,48 @@ fi
 
 echo "INFO  : test scenario with huge amount of addresses: OK"
 
+echo "INFO  : test scenario with huge amount of addresses: batch lookup vs. single lookup..."
+tmpfile_batch="`mktemp`"
+tmpfile_single="`mktemp`"
+# IPv4 address followed by 6to4 address including the same IPv4 address
+testscenario_hugelist ipv4 | awk -F. '{ print $0 " token2 token3"; printf "2002:%02x%02x:%02x%02x::1 token2 token3\n", $1, $2, $3, $4 }' | ./ipv6logconv -q --out any >"$tmpfile_batch"
+if [ $? -ne 0 ]; then
+	echo "ERROR : exit code <> 0 (batch lookup)"
+	rm -f "$tmpfile_batch" "$tmpfile_single"
+	exit 1
+fi
+testscenario_hugelist ipv4 | awk -F. '{ print $0 " token2 token3"; printf "2002:%02x%02x:%02x%02x::1 token2 token3\n", $1, $2, $3, $4 }' | ./ipv6logconv -q --out any -n >"$tmpfile_single"
+if [ $? -ne 0 ]; then
+	echo "ERROR : exit code <> 0 (single lookup)"
+	rm -f "$tmpfile_batch" "$tmpfile_single"
+	exit 1
+fi
+if ! cmp -s "$tmpfile_batch" "$tmpfile_single"; then
+	echo "ERROR : result of batch lookup differs from single lookup"
+	diff "$tmpfile_single" "$tmpfile_batch" | head -20
+	rm -f "$tmpfile_batch" "$tmpfile_single"
+	exit 1
+fi
+rm -f "$tmpfile_batch" "$tmpfile_single"
+echo "INFO  : test scenario with huge amount of addresses: batch lookup vs. single lookup OK"
+
+echo "INFO  : test scenario with filter-file..."
+tmpfile="`mktemp`"
+cat <<END >$tmpfile
+192.168.0.0/16
+2001:db8::/32
+^2001:db8::a0fc:4291:a0fc:1884/128
+END
+output="`echo -e "192.168.1.1 token2 token3\n10.1.1.1 token2 token3\nunknown token2 token3\n2001:db8::1 token2 token3\n2001:db8::a0fc:4291:a0fc:1884 token2 token3" | ./ipv6logconv -q --out any --filter-file $tmpfile`"
+retval=$?
+rm -f $tmpfile
+if [ $retval -ne 0 -o "`echo "$output" | wc -l`" -ne 2 ] || ! echo "$output" | grep -q "ipv4-addr" || ! echo "$output" | grep -q "ipv6-addr"; then
+	echo "ERROR : unexpected result with filter-file"
+	echo "$output"
+	exit 1
+fi
+echo "INFO  : test scenario with filter-file: OK"
+
 if [ $? -eq 0 ]; then
 	echo "All tests were successfully done!" >&2
 fi
@@ -17,6 +17,10 @@
 
 #include "config.h"
 
+#ifdef SUPPORT_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "ipv6logstats.h"
 #include "libipv6calcdebug.h"
 #include "libipv6calc.h"
@@ -26,6 +30,7 @@
 #include "ipv6logstatsoptions.h"
 #include "ipv6calchelp.h"
 #include "ipv6logstatshelp.h"
+#include "libasnmap.h"
 
 #include "libipv4addr.h"
 #include "libipv6addr.h"
@@ -36,6 +41,7 @@
 #include "../databases/lib/libipv6calc_db_wrapper_IP2Location.h"
 #include "../databases/lib/libipv6calc_db_wrapper_DBIP.h"
 #include "../databases/lib/libipv6calc_db_wrapper_External.h"
+#include "../databases/lib/libipv6calc_db_wrapper_MMAP.h"
 #include "../databases/lib/libipv6calc_db_wrapper_BuiltIn.h"
 
 #define LINEBUFFER	16384
@@ -49,6 +55,16 @@ static int opt_noheader = 0;
 static int opt_onlyheader = 0;
 static int opt_printdirection = 0; /* rows */
 static char opt_token[NI_MAXHOST] = "";
+static int opt_threads = 0;
+static int opt_merge = 0;
+static int opt_filter_file = 0;
+static s_ipaddrset filter_addrset;
+static int flag_batch = 0; /* batch lookup of registries */
+
+/* state files */
+static const char *state_in[STATE_FILES_MAX];
+static int state_in_num = 0;
+static const char *state_out = NULL;
 
 char    file_out[NI_MAXHOST] = "";
 int     file_out_flag = 0;
@@ -116,14 +132,47 @@ static long unsigned int counter_country_ipv6[COUNTRYCODE_INDEX_MAX];
 
 static long unsigned int counter_country_A46, counter_country_IPV4, counter_country_IPV6;
 
-/* stat by ASN (only 16-bit ASN supported, 32-bit ASNs are mapped to 23456 "AS_TRANS" */
-#define ASNUM_MAX     65536
-static long unsigned int counter_asn[ASNUM_MAX];
-static long unsigned int counter_asn_ipv4[ASNUM_MAX];
-static long unsigned int counter_asn_ipv6[ASNUM_MAX];
+/* stat by ASN (sparse, 32-bit ASN mapped to index of counter array) */
+typedef struct {
+	uint32_t          as_num32;
+	long unsigned int all;
+	long unsigned int ipv4;
+	long unsigned int ipv6;
+} s_asn_counter;
+
+typedef struct {
+	s_asnmap       map;
+	s_asn_counter *entries;		// index from map, map.used entries in use
+	uint32_t       size;		// allocated entries
+} s_asn_counters;
+
+#define ASN_COUNTERS_SIZE_MIN	256
+
+static s_asn_counters counter_asn;
+
+/* limit ASN output (0 = unlimited) */
+static long unsigned int opt_asn_top = 0;
+static long unsigned int opt_asn_threshold = 0;
+
+/* private counter block (per thread), added to the global counters at end of input */
+typedef struct {
+	long unsigned int stat[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+	long unsigned int country[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv4[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv6[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_A46, country_IPV4, country_IPV6;
+	s_asn_counters    asn;
+} s_ipv6logstats_counters;
 
 /* prototypes */
 static void lineparser(void);
+static void lineparser_line(char *linebuffer, const int linecounter, s_ipv6logstats_counters *countersp, const s_ipv6calc_db_batch *db_batchp);
+static void counters_merge(s_ipv6logstats_counters *countersp);
+static int state_load(const char *file);
+static int state_save(const char *file);
+#ifdef SUPPORT_PTHREAD
+static int lineparser_threads(void);
+#endif
 
 
 /**************************************************/
@@ -236,6 +285,44 @@ int main(int argc,char *argv[]) {
 				opt_simple = 1; // force simple mode in addition
 				break;
 
+			case 'T':
+				opt_threads = liblinebatch_threads_option(optarg);
+				break;
+
+			case 'I':
+				if (state_in_num >= STATE_FILES_MAX) {
+					fprintf(stderr, " Too many state files, built-in limit: %d\n", STATE_FILES_MAX);
+					exit(EXIT_FAILURE);
+				};
+				state_in[state_in_num++] = optarg;
+				break;
+
+			case 'S':
+				state_out = optarg;
+				break;
+
+			case 'M':
+				opt_merge = 1;
+				break;
+
+			case CMD_filter_file:
+				if (opt_filter_file == 0) {
+					libipaddrset_init(&filter_addrset);
+				};
+				if (libipaddrset_load(&filter_addrset, optarg) != 0) {
+					exit(EXIT_FAILURE);
+				};
+				opt_filter_file = 1;
+				break;
+
+			case 'A':
+				opt_asn_top = strtoul(optarg, NULL, 10);
+				break;
+
+			case 'm':
+				opt_asn_threshold = strtoul(optarg, NULL, 10);
+				break;
+
 			case 'w':
 				if (strlen(optarg) < sizeof(file_out)) {
 					snprintf(file_out, sizeof(file_out), "%s", optarg);
@@ -255,6 +342,22 @@ int main(int argc,char *argv[]) {
 	argv += optind;
 	argc -= optind;
 
+	/* remaining arguments are state files in merge mode */
+	if (opt_merge == 1) {
+		for (i = 0; i < argc; i++) {
+			if (state_in_num >= STATE_FILES_MAX) {
+				fprintf(stderr, " Too many state files, built-in limit: %d\n", STATE_FILES_MAX);
+				exit(EXIT_FAILURE);
+			};
+			state_in[state_in_num++] = argv[i];
+		};
+
+		if (state_in_num == 0) {
+			fprintf(stderr, " Merge mode requires at least one state file\n");
+			exit(EXIT_FAILURE);
+		};
+	};
+
         /* initialise database wrapper */
 	result = libipv6calc_db_wrapper_init("*3*DB-Info: ");
 	if (result != 0) {
@@ -298,7 +401,7 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
-	if (feature_reg == 0) {
+	if ((feature_reg == 0) && (opt_merge == 0)) {
 		fprintf(stderr, "Basic databases are missing for creating statistic\n");
 		exit(EXIT_FAILURE);
 	};
@@ -306,6 +409,10 @@ int main(int argc,char *argv[]) {
 	/* call lineparser */
 	lineparser();
 
+	if (opt_filter_file == 1) {
+		libipaddrset_cleanup(&filter_addrset);
+	};
+
 	libipv6calc_db_wrapper_cleanup();
 
 	exit(EXIT_SUCCESS);
@@ -315,12 +422,12 @@ int main(int argc,char *argv[]) {
 /*
  * Statistics structure handling
  */
-static void stat_inc(int number) {
+static void stat_inc(s_ipv6logstats_counters *countersp, int number) {
 	int i;
 	
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
 		if (number == ipv6logstats_statentries[i].number) {
-			ipv6logstats_statentries[i].counter++;
+			countersp->stat[i]++;
 			break;
 		};
 	};
@@ -330,7 +437,7 @@ static void stat_inc(int number) {
 /*
  * Country code statistics
  */
-static void stat_inc_country_code(uint16_t country_code, const int proto) {
+static void stat_inc_country_code(s_ipv6logstats_counters *countersp, uint16_t country_code, const int proto) {
 	int index = COUNTRYCODE_INDEX_UNKNOWN;
 
 	if (country_code < COUNTRYCODE_INDEX_MAX) {
@@ -342,15 +449,15 @@ static void stat_inc_country_code(uint16_t country_code, const int proto) {
 
 	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment CountryCode index: %d (%d)", index, country_code);
 
-	counter_country[index]++;
-	counter_country_A46++;
+	countersp->country[index]++;
+	countersp->country_A46++;
 
 	if (proto == 4) {
-		counter_country_ipv4[index]++;
-		counter_country_IPV4++;
+		countersp->country_ipv4[index]++;
+		countersp->country_IPV4++;
 	} else if (proto == 6) {
-		counter_country_ipv6[index]++;
-		counter_country_IPV6++;
+		countersp->country_ipv6[index]++;
+		countersp->country_IPV6++;
 	} else {
 		fprintf(stderr, "%s/%s: unexpected unsupported proto: %d\n", __FILE__, __func__, proto);
 		exit(1);
@@ -359,378 +466,491 @@ static void stat_inc_country_code(uint16_t country_code, const int proto) {
 
 
 /*
- * AS Number statistics
+ * AS Number counters (sparse)
  */
-static void stat_inc_asnum(const uint32_t as_num32, const int proto) {
-	unsigned int index = ASNUM_AS_UNKNOWN;
+/* get counter of ASN, create if not existing */
+static s_asn_counter *asn_counters_get(s_asn_counters *asnp, const uint32_t as_num32) {
+	s_asn_counter *entries;
+	uint32_t index, size;
+	int r;
+
+	r = libasnmap_add(&asnp->map, as_num32, &index);
+	if (r < 0) {
+		fprintf(stderr, "Can't allocate memory for ASN map: %u\n", asnp->map.used);
+		exit(EXIT_FAILURE);
+	};
 
-	if (as_num32 < ASNUM_MAX) {
-		// everything is fine
-		index = as_num32;
-	} else {
-		// map to AS_TRANS for now
-		index = ASNUM_AS_TRANS;
+	if (r == 0) {
+		// new ASN
+		if (index >= asnp->size) {
+			size = (asnp->size == 0) ? ASN_COUNTERS_SIZE_MIN : asnp->size * 2;
+			entries = realloc(asnp->entries, sizeof(s_asn_counter) * size);
+			if (entries == NULL) {
+				fprintf(stderr, "Can't allocate memory for ASN counters: %u\n", size);
+				exit(EXIT_FAILURE);
+			};
+			asnp->entries = entries;
+			asnp->size = size;
+		};
+
+		memset(&asnp->entries[index], 0, sizeof(s_asn_counter));
+		asnp->entries[index].as_num32 = as_num32;
+	};
+
+	return(&asnp->entries[index]);
+};
+
+static void asn_counters_free(s_asn_counters *asnp) {
+	libasnmap_free(&asnp->map);
+	free(asnp->entries);
+	asnp->entries = NULL;
+	asnp->size = 0;
+};
+
+static int asn_counters_cmp_num(const void *a, const void *b) {
+	const s_asn_counter *ap = a, *bp = b;
+
+	return((ap->as_num32 > bp->as_num32) - (ap->as_num32 < bp->as_num32));
+};
+
+static int asn_counters_cmp_all(const void *a, const void *b) {
+	const s_asn_counter *ap = a, *bp = b;
+
+	if (ap->all != bp->all) {
+		return((ap->all < bp->all) ? 1 : -1);
+	};
+
+	return(asn_counters_cmp_num(a, b));
+};
+
+/*
+ * list of used ASN counters, sorted by ASN
+ *
+ * in : asnp, flag_limit (apply --asn-top/--asn-threshold)
+ * mod: num_p (number of entries)
+ * out: allocated list (to be freed by caller)
+ */
+static s_asn_counter *asn_counters_list(const s_asn_counters *asnp, const int flag_limit, uint32_t *num_p) {
+	s_asn_counter *list;
+	uint32_t i, num = 0;
+
+	list = malloc(sizeof(s_asn_counter) * (asnp->map.used + 1));
+	if (list == NULL) {
+		fprintf(stderr, "Can't allocate memory for ASN list: %u\n", asnp->map.used);
+		exit(EXIT_FAILURE);
 	};
 
-	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment ASN index: %d (%d)", index, as_num32);
+	for (i = 0; i < asnp->map.used; i++) {
+		if ((flag_limit == 1) && (asnp->entries[i].all < opt_asn_threshold)) {
+			continue;
+		};
+
+		list[num++] = asnp->entries[i];
+	};
+
+	if ((flag_limit == 1) && (opt_asn_top > 0) && (num > opt_asn_top)) {
+		// keep top-N by count (ties: lower ASN first)
+		qsort(list, num, sizeof(s_asn_counter), asn_counters_cmp_all);
+		num = (uint32_t) opt_asn_top;
+	};
+
+	qsort(list, num, sizeof(s_asn_counter), asn_counters_cmp_num);
+
+	*num_p = num;
+	return(list);
+};
+
+
+/*
+ * AS Number statistics
+ */
+static void stat_inc_asnum(s_ipv6logstats_counters *countersp, const uint32_t as_num32, const int proto) {
+	s_asn_counter *counterp;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment ASN: %u", as_num32);
 
-	counter_asn[index]++;
+	counterp = asn_counters_get(&countersp->asn, as_num32);
+
+	counterp->all++;
 
 	if (proto == 4) {
-		counter_asn_ipv4[index]++;
+		counterp->ipv4++;
 	} else if (proto == 6) {
-		counter_asn_ipv6[index]++;
+		counterp->ipv6++;
 	};
 };
 
 
 /*
- * Line parser
+ * Add counter block to global counters
  */
-static void lineparser(void) {
-	char linebuffer[LINEBUFFER];
-	char token[LINEBUFFER];
-	char resultstring[LINEBUFFER];
-	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i, r;
+static void counters_merge(s_ipv6logstats_counters *countersp) {
+	s_asn_counter *counterp;
+	uint32_t a;
+	int i;
 
-	uint32_t inputtype  = FORMAT_undefined;
-	ipv6calc_ipv6addr ipv6addr;
-	ipv6calc_ipv4addr ipv4addr;
-	int registry, stat_registry_base;
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		ipv6logstats_statentries[i].counter += countersp->stat[i];
+	};
 
-	time_t timer;
-	struct tm* tm_info;
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		counter_country[i]      += countersp->country[i];
+		counter_country_ipv4[i] += countersp->country_ipv4[i];
+		counter_country_ipv6[i] += countersp->country_ipv6[i];
+	};
 
-	int index;
-	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
-	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
-	long unsigned int c_all, c_ipv4, c_ipv6;
+	counter_country_A46  += countersp->country_A46;
+	counter_country_IPV4 += countersp->country_IPV4;
+	counter_country_IPV6 += countersp->country_IPV6;
 
-	int column_offset = 1;
+	for (a = 0; a < countersp->asn.map.used; a++) {
+		counterp = asn_counters_get(&counter_asn, countersp->asn.entries[a].as_num32);
+		counterp->all  += countersp->asn.entries[a].all;
+		counterp->ipv4 += countersp->asn.entries[a].ipv4;
+		counterp->ipv6 += countersp->asn.entries[a].ipv6;
+	};
 
-	// clear counters
-	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
-		counter_country[i] = 0;
-		counter_country_ipv4[i] = 0;
-		counter_country_ipv6[i] = 0;
+	asn_counters_free(&countersp->asn);
+};
+
+
+/*
+ * Load state file and add counters to global counters
+ *
+ * in : file
+ * out: 0=ok, 1=error
+ */
+static int state_load(const char *file) {
+	FILE *fp;
+	s_ipv6logstats_state_header header;
+	s_ipv6logstats_state_record record;
+	s_asn_counter *counterp;
+	uint64_t value, sums[3];
+	uint32_t r;
+	int i, result = 1;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Load state file: %s", file);
+
+	fp = fopen(file, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "Can't open state file: %s\n", file);
+		return(1);
 	};
 
-	ptrptr = &cptr;
-	
-	if (opt_onlyheader == 0) {
-		if (ipv6calc_quiet == 0) {
-			fprintf(stderr, "Expecting log lines on stdin\n");
-		};
+	if (fread(&header, sizeof(header), 1, fp) != 1) {
+		fprintf(stderr, "Can't read header of state file: %s\n", file);
+		goto END_state_load;
 	};
 
-	while (opt_onlyheader == 0) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
-		
-		if (charptr == NULL) {
-			/* end of input */
-			break;
-		};
+	if ((memcmp(header.magic, STATE_MAGIC, sizeof(header.magic)) != 0) || (header.byteorder != STATE_BYTEORDER)) {
+		fprintf(stderr, "Not a state file (or different byte order): %s\n", file);
+		goto END_state_load;
+	};
 
-		linecounter++;
+	if ((header.version != STATE_VERSION) || (header.num_stat != MAXENTRIES_ARRAY(ipv6logstats_statentries))) {
+		fprintf(stderr, "Unsupported version of state file: %s (version=%u entries=%u)\n", file, header.version, header.num_stat);
+		goto END_state_load;
+	};
 
-		stat_registry_base = 0;
+	/* counters of different major statistics version have different meaning */
+	if ((header.stats_version >> 8) != STATS_VERSION_MAJOR) {
+		fprintf(stderr, "Unsupported statistics version of state file: %s (version=%u.%u supported=%d.x)\n", file, header.stats_version >> 8, header.stats_version & 0xff, STATS_VERSION_MAJOR);
+		goto END_state_load;
+	};
 
-		if (linecounter == 1) {
-			if (ipv6calc_quiet == 0) {
-				fprintf(stderr, "Ok, proceeding stdin...\n");
-			};
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (fread(&value, sizeof(value), 1, fp) != 1) {
+			fprintf(stderr, "State file truncated (statistic table): %s\n", file);
+			goto END_state_load;
 		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
+		ipv6logstats_statentries[i].counter += value;
+	};
 
-		if (strlen(linebuffer) >= LINEBUFFER) {
-			fprintf(stderr, "Line too long: %d\n", linecounter);
-			continue;
+	if (fread(sums, sizeof(sums), 1, fp) != 1) {
+		fprintf(stderr, "State file truncated (CountryCode sums): %s\n", file);
+		goto END_state_load;
+	};
+	counter_country_A46  += sums[0];
+	counter_country_IPV4 += sums[1];
+	counter_country_IPV6 += sums[2];
+
+	for (r = 0; r < header.num_cc; r++) {
+		if (fread(&record, sizeof(record), 1, fp) != 1) {
+			fprintf(stderr, "State file truncated (CountryCode): %s\n", file);
+			goto END_state_load;
 		};
 
-		/* remove trailing \n */
-		if (linebuffer[strlen(linebuffer) - 1] == '\n') {
-			linebuffer[strlen(linebuffer) - 1] = '\0';
+		if (record.index >= COUNTRYCODE_INDEX_MAX) {
+			fprintf(stderr, "State file contains invalid CountryCode index: %s (%u)\n", file, record.index);
+			goto END_state_load;
 		};
 
-		
-		if (strlen(linebuffer) == 0) {
-			fprintf(stderr, "Line empty: %d\n", linecounter);
-			continue;
-		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
+		counter_country[record.index]      += record.all;
+		counter_country_ipv4[record.index] += record.ipv4;
+		counter_country_ipv6[record.index] += record.ipv6;
+	};
 
-		/* look for first token (should be IP address) */
-		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
-		
-		if ( charptr == NULL ) {
-			fprintf(stderr, "Line contains no token: %d\n", linecounter);
-			continue;
+	for (r = 0; r < header.num_asn; r++) {
+		if (fread(&record, sizeof(record), 1, fp) != 1) {
+			fprintf(stderr, "State file truncated (ASN): %s\n", file);
+			goto END_state_load;
 		};
 
-		if ( strlen(charptr) >=  LINEBUFFER) {
-			fprintf(stderr, "Line too strange: %d\n", linecounter);
-			continue;
+		counterp = asn_counters_get(&counter_asn, record.index);
+		counterp->all  += record.all;
+		counterp->ipv4 += record.ipv4;
+		counterp->ipv6 += record.ipv6;
+	};
+
+	// print extended statistics if contained
+	if (opt_simple != 1) {
+		if (header.num_cc > 0) {
+			feature_cc = 1;
 		};
+		if (header.num_asn > 0) {
+			feature_as = 1;
+		};
+	};
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
+	result = 0;
 
-		stat_inc(STATS_ALL);
+END_state_load:
+	fclose(fp);
+	return(result);
+};
 
-		/* get input type now */
-		inputtype = libipv6calc_autodetectinput(token);
 
-		/* check for proper type */
-		if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
-			/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
-			stat_inc(STATS_UNKNOWN);
-			continue;
+/*
+ * Save global counters to state file
+ *
+ * in : file
+ * out: 0=ok, 1=error
+ */
+static int state_save(const char *file) {
+	FILE *fp;
+	s_ipv6logstats_state_header header;
+	s_ipv6logstats_state_record record;
+	s_asn_counter *asn_list = NULL;
+	uint64_t value, sums[3];
+	uint32_t asn_num = 0, a;
+	int i, result = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Save state file: %s", file);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, STATE_MAGIC, sizeof(header.magic));
+	header.byteorder = STATE_BYTEORDER;
+	header.version = STATE_VERSION;
+	header.stats_version = (STATS_VERSION_MAJOR << 8) | STATS_VERSION_MINOR;
+	header.num_stat = MAXENTRIES_ARRAY(ipv6logstats_statentries);
+	header.unixtime = (int64_t) time(NULL);
+
+	// extended statistics only if printed
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		if ((feature_cc == 1) && (counter_country[i] > 0)) {
+			header.num_cc++;
 		};
+	};
 
-		/* fill related structure */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
-				break;
+	if (feature_as == 1) {
+		asn_list = asn_counters_list(&counter_asn, 0, &asn_num);
+		header.num_asn = asn_num;
+	};
 
-			case FORMAT_ipv4addr:
-				retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
-				break;
+	fp = fopen(file, "wb");
+	if (fp == NULL) {
+		fprintf(stderr, "Can't open state file for writing: %s\n", file);
+		free(asn_list);
+		return(1);
+	};
 
-			default:
-				retval = 0;
-				break;
-		};
+	if (fwrite(&header, sizeof(header), 1, fp) != 1) {
+		result = 1;
+	};
 
-		if (retval != 0 ) {
-			fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
-			continue;
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		value = ipv6logstats_statentries[i].counter;
+		if (fwrite(&value, sizeof(value), 1, fp) != 1) {
+			result = 1;
 		};
+	};
 
-		/* catch compat/mapped */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				if ((ipv6addr.typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
-					/* extract IPv4 address */
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
+	sums[0] = counter_country_A46;
+	sums[1] = counter_country_IPV4;
+	sums[2] = counter_country_IPV6;
+	if (fwrite(sums, sizeof(sums), 1, fp) != 1) {
+		result = 1;
+	};
 
-					// remap
-					inputtype = FORMAT_ipv4addr;
+	memset(&record, 0, sizeof(record));
 
-					// create text represenation
-					r = libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token, sizeof(token), 0);
-				};
-				break;
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		if ((feature_cc == 1) && (counter_country[i] > 0)) {
+			record.index = (uint32_t) i;
+			record.all  = counter_country[i];
+			record.ipv4 = counter_country_ipv4[i];
+			record.ipv6 = counter_country_ipv6[i];
+			if (fwrite(&record, sizeof(record), 1, fp) != 1) {
+				result = 1;
+			};
+		};
+	};
 
-			default:
-				// nothing to do
-				break;
+	for (a = 0; a < asn_num; a++) {
+		record.index = asn_list[a].as_num32;
+		record.all  = asn_list[a].all;
+		record.ipv4 = asn_list[a].ipv4;
+		record.ipv6 = asn_list[a].ipv6;
+		if (fwrite(&record, sizeof(record), 1, fp) != 1) {
+			result = 1;
 		};
+	};
+	free(asn_list);
 
-		/* get information and fill statistics */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				/* is IPv6 address */
-				stat_inc(STATS_IPV6);
+	if (fclose(fp) != 0) {
+		result = 1;
+	};
 
-				if ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
-					/* has public IPv4 address included */
+	if (result != 0) {
+		fprintf(stderr, "Can't write state file: %s\n", file);
+	};
 
-					// get IPv4 address (in case of Teredo the client IP)
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
+	return(result);
+};
 
-					if (opt_simple != 1) {
-						cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-						as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr);
-						if (feature_cc == 1) {
-							stat_inc_country_code(cc_index, 4);
-						};
 
-						if (feature_as == 1) {
-							stat_inc_asnum(as_num32, 4);
-						};
-					};
+/*
+ * Line parser
+ */
+static void lineparser(void) {
+	char *linebuffer;
+	const char *data;
+	char resultstring[LINEBUFFER];
+	int linecounter = 0, i;
+	int batch_lines = 0, batch_num;
+	size_t datalength;
+	s_linereader reader;
+	s_ipv6logstats_counters *countersp;
+	s_ipv6calc_db_batch db_batch;
+	ipv6calc_ipaddr *batch_ipaddrs;
 
-					registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+	time_t timer;
+	struct tm* tm_info;
 
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
-						stat_registry_base = STATS_IPV6_6TO4_BASE;
+	int index;
+	long unsigned int c_all, c_ipv4, c_ipv6;
+	s_asn_counter *asn_list;
+	uint32_t asn_num, a;
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
-						stat_registry_base = STATS_IPV6_TEREDO_BASE;
+	int column_offset = 1;
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
-						stat_registry_base = STATS_IPV6_NAT64_BASE;
-					};
+	// clear counters
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		counter_country[i] = 0;
+		counter_country_ipv4[i] = 0;
+		counter_country_ipv6[i] = 0;
+	};
 
-					if (stat_registry_base > 0) {
-						switch (registry) {
-							case IPV4_ADDR_REGISTRY_IANA:
-								stat_inc(stat_registry_base + REGISTRY_IANA);
-								break;
-							case IPV4_ADDR_REGISTRY_APNIC:
-								stat_inc(stat_registry_base + REGISTRY_APNIC);
-								break;
-							case IPV4_ADDR_REGISTRY_ARIN:
-								stat_inc(stat_registry_base + REGISTRY_ARIN);
-								break;
-							case IPV4_ADDR_REGISTRY_RIPENCC:
-								stat_inc(stat_registry_base + REGISTRY_RIPENCC);
-								break;
-							case IPV4_ADDR_REGISTRY_LACNIC:
-								stat_inc(stat_registry_base + REGISTRY_LACNIC);
-								break;
-							case IPV4_ADDR_REGISTRY_AFRINIC:
-								stat_inc(stat_registry_base + REGISTRY_AFRINIC);
-								break;
-							case IPV4_ADDR_REGISTRY_RESERVED:
-								stat_inc(stat_registry_base + REGISTRY_RESERVED);
-								break;
-							default:
-								stat_inc(stat_registry_base + REGISTRY_UNKNOWN);
-								if (opt_unknown == 1) {
-									fprintf(stderr, "Unknown address: %s\n", token);
-								};
-								break;
-						};
-					} else {
-						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
-						};
-					};
-				} else {
-					if (opt_simple != 1) {
-						cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
-						as_num32 = libipv6addr_as_num32_by_addr(&ipv6addr);
+	// add counters from state files
+	for (i = 0; i < state_in_num; i++) {
+		if (state_load(state_in[i]) != 0) {
+			exit(EXIT_FAILURE);
+		};
+	};
 
-						if (feature_cc == 1) {
-							/* country code */
-							stat_inc_country_code(cc_index, 6);
-						};
+	if ((opt_onlyheader == 0) && (opt_merge == 0)) {
+		if (ipv6calc_quiet == 0) {
+			fprintf(stderr, "Expecting log lines on stdin\n");
+		};
+	};
 
-						if (feature_as == 1) {
-							/* asnum */
-							stat_inc_asnum(as_num32, 6);
-						};
-					};
+	flag_batch = libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY);
 
-					registry = libipv6addr_registry_num_by_addr(&ipv6addr);
+#ifdef SUPPORT_PTHREAD
+	if ((opt_threads > 0) && (opt_onlyheader == 0) && (opt_merge == 0)) {
+		if (lineparser_threads() != 0) {
+			exit(EXIT_FAILURE);
+		};
+	} else {
+#endif
+		countersp = calloc(1, sizeof(s_ipv6logstats_counters));
+		batch_ipaddrs = malloc(sizeof(ipv6calc_ipaddr) * LOOKUP_BATCH_LINES);
+		if ((countersp == NULL) || (batch_ipaddrs == NULL)) {
+			fprintf(stderr, "Can't allocate memory for counters\n");
+			exit(EXIT_FAILURE);
+		};
 
-					switch (registry) {
-						case IPV6_ADDR_REGISTRY_6BONE:
-							stat_inc(STATS_IPV6_6BONE);
-							break;
-						case IPV6_ADDR_REGISTRY_IANA:
-							stat_inc(STATS_IPV6_IANA);
-							break;
-						case IPV6_ADDR_REGISTRY_APNIC:
-							stat_inc(STATS_IPV6_APNIC);
-							break;
-						case IPV6_ADDR_REGISTRY_ARIN:
-							stat_inc(STATS_IPV6_ARIN);
-							break;
-						case IPV6_ADDR_REGISTRY_RIPENCC:
-							stat_inc(STATS_IPV6_RIPENCC);
-							break;
-						case IPV6_ADDR_REGISTRY_LACNIC:
-							stat_inc(STATS_IPV6_LACNIC);
-							break;
-						case IPV6_ADDR_REGISTRY_AFRINIC:
-							stat_inc(STATS_IPV6_AFRINIC);
-							break;
-						case IPV6_ADDR_REGISTRY_RESERVED:
-							stat_inc(STATS_IPV6_RESERVED);
-							break;
-						default:
-							stat_inc(STATS_IPV6_UNKNOWN);
-							if (opt_unknown == 1) {
-								fprintf(stderr, "Unknown address: %s\n", token);
-							};
-							break;
-					};
+		if ((opt_onlyheader == 0) && (opt_merge == 0)) {
+			if (liblinereader_open(&reader, fileno(stdin)) != 0) {
+				fprintf(stderr, "Can't read from stdin\n");
+				exit(EXIT_FAILURE);
+			};
+		};
 
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
-						if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
-							stat_inc(STATS_IPV6_IID_RANDOM);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
-							stat_inc(STATS_IPV6_IID_ISATAP);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
-							stat_inc(STATS_IPV6_IID_MANUAL);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
-							stat_inc(STATS_IPV6_IID_GLOBAL);
-						} else {
-							stat_inc(STATS_IPV6_IID_UNKNOWN);
-						};
-					};
+		memset(&db_batch, 0, sizeof(db_batch));
+
+		while ((opt_onlyheader == 0) && (opt_merge == 0)) {
+			if ((flag_batch == 1) && (batch_lines == 0)) {
+				/* resolve addresses of lines ahead in input buffer at once (merge-join in database) */
+				data = liblinereader_peek(&reader, &datalength);
+				batch_lines = libipv6calc_collect_ipv4addrs(data, datalength, LOOKUP_BATCH_LINES, batch_ipaddrs, &batch_num);
+				if (batch_num > 0) {
+					libipv6calc_db_wrapper_batch_prepare(&db_batch, batch_ipaddrs, batch_num);
 				};
-				
+			};
+
+			/* read line from stdin (in place, no copy) */
+			linebuffer = liblinereader_getline(&reader, LINEBUFFER, NULL);
+			
+			if (linebuffer == NULL) {
+				/* end of input */
 				break;
+			};
 
-			case FORMAT_ipv4addr:
-				/* is IPv4 address */
-				stat_inc(STATS_IPV4);
+			linecounter++;
 
-				if (opt_simple != 1) {
-					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-					as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr);
+			if (batch_lines > 0) {
+				batch_lines--;
+			};
 
-					stat_inc_country_code(cc_index, 4);
-					stat_inc_asnum(as_num32, 4);
+			if (linecounter == 1) {
+				if (ipv6calc_quiet == 0) {
+					fprintf(stderr, "Ok, proceeding stdin...\n");
 				};
+			};
 
-				registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+			lineparser_line(linebuffer, linecounter, countersp, &db_batch);
+		};
+		libipv6calc_db_wrapper_batch_cleanup(&db_batch);
 
-				switch (registry) {
-					case IPV4_ADDR_REGISTRY_IANA:
-						stat_inc(STATS_IPV4_IANA);
-						break;
-					case IPV4_ADDR_REGISTRY_APNIC:
-						stat_inc(STATS_IPV4_APNIC);
-						break;
-					case IPV4_ADDR_REGISTRY_ARIN:
-						stat_inc(STATS_IPV4_ARIN);
-						break;
-					case IPV4_ADDR_REGISTRY_RIPENCC:
-						stat_inc(STATS_IPV4_RIPENCC);
-						break;
-					case IPV4_ADDR_REGISTRY_LACNIC:
-						stat_inc(STATS_IPV4_LACNIC);
-						break;
-					case IPV4_ADDR_REGISTRY_AFRINIC:
-						stat_inc(STATS_IPV4_AFRINIC);
-						break;
-					case IPV4_ADDR_REGISTRY_RESERVED:
-						stat_inc(STATS_IPV4_RESERVED);
-						break;
-					default:
-						stat_inc(STATS_IPV4_UNKNOWN);
-						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
-						};
-						break;
-				};
-				
-				break;
+		if ((opt_onlyheader == 0) && (opt_merge == 0)) {
+			liblinereader_close(&reader);
+
+			if (reader.error != 0) {
+				fprintf(stderr, "Error reading from stdin, input is incomplete\n");
+				exit(EXIT_FAILURE);
+			};
 		};
+
+		counters_merge(countersp);
+		free(countersp);
+		free(batch_ipaddrs);
+#ifdef SUPPORT_PTHREAD
 	};
+#endif
 
-	if (opt_onlyheader == 0) {
+	if ((opt_onlyheader == 0) && (opt_merge == 0)) {
 		if (ipv6calc_quiet == 0) {
 			fprintf(stderr, "...finished\n");
 		};
 	};
 
+	if (state_out != NULL) {
+		if (state_save(state_out) != 0) {
+			exit(EXIT_FAILURE);
+		};
+	};
+
 	/* print result */
 	if (opt_printdirection == 0) {
 		/* print in rows */
@@ -801,36 +1021,39 @@ static void lineparser(void) {
 		};
 
 		if (feature_as == 1) {
+			asn_list = asn_counters_list(&counter_asn, 1, &asn_num);
+
 			/* ASN number / proto */
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-num-proto/%d/ALL   %lu\n", index, counter_asn[index]);
-					printf("*3*AS-num-proto/%d/IPv4  %lu\n", index, counter_asn_ipv4[index]);
-					printf("*3*AS-num-proto/%d/IPv6  %lu\n", index, counter_asn_ipv6[index]);
-					printf("*3*AS-num-proto-list/%d  %lu %lu %lu\n", index, counter_asn[index], counter_asn_ipv4[index], counter_asn_ipv6[index]);
-				};
+			for (a = 0; a < asn_num; a++) {
+				printf("*3*AS-num-proto/%u/ALL   %lu\n", asn_list[a].as_num32, asn_list[a].all);
+				printf("*3*AS-num-proto/%u/IPv4  %lu\n", asn_list[a].as_num32, asn_list[a].ipv4);
+				printf("*3*AS-num-proto/%u/IPv6  %lu\n", asn_list[a].as_num32, asn_list[a].ipv6);
+				printf("*3*AS-num-proto-list/%u  %lu %lu %lu\n", asn_list[a].as_num32, asn_list[a].all, asn_list[a].ipv4, asn_list[a].ipv6);
 			};
 
 			/* ASN proto / number */
-			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-proto-num/ALL/%d   %lu\n", index, counter_asn[index]);
-					c_all += counter_asn[index];
-				};
+			for (a = 0; a < asn_num; a++) {
+				printf("*3*AS-proto-num/ALL/%u   %lu\n", asn_list[a].as_num32, asn_list[a].all);
 			};
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv4[index] > 0) {
-					printf("*3*AS-proto-num/IPv4/%d  %lu\n", index, counter_asn_ipv4[index]);
-					c_ipv4 += counter_asn_ipv4[index];
+			for (a = 0; a < asn_num; a++) {
+				if (asn_list[a].ipv4 > 0) {
+					printf("*3*AS-proto-num/IPv4/%u  %lu\n", asn_list[a].as_num32, asn_list[a].ipv4);
 				};
 			};
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv6[index] > 0) {
-					printf("*3*AS-proto-num/IPv6/%d  %lu\n", index, counter_asn_ipv6[index]);
-					c_ipv6 += counter_asn_ipv6[index];
+			for (a = 0; a < asn_num; a++) {
+				if (asn_list[a].ipv6 > 0) {
+					printf("*3*AS-proto-num/IPv6/%u  %lu\n", asn_list[a].as_num32, asn_list[a].ipv6);
 				};
 			};
+			free(asn_list);
+
+			/* sum over all ASNs, also the ones suppressed by --asn-top/--asn-threshold */
+			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
+			for (a = 0; a < counter_asn.map.used; a++) {
+				c_all  += counter_asn.entries[a].all;
+				c_ipv4 += counter_asn.entries[a].ipv4;
+				c_ipv6 += counter_asn.entries[a].ipv6;
+			};
 
 			if ((c_all + c_ipv4 + c_ipv6) > 0) {
 				printf("*3*AS-proto-num-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
@@ -914,6 +1137,13 @@ static void lineparser(void) {
 		};
 #endif
 
+#ifdef SUPPORT_MMAP
+		string = libipv6calc_db_wrapper_MMAP_wrapper_db_info_used();
+		if ((string != NULL) && (strlen(string) > 0)) {
+			printf("*3*DB-Used: %s\n", string);
+		};
+#endif
+
 #ifdef SUPPORT_BUILTIN
 		string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
 		if ((string != NULL) && (strlen(string) > 0)) {
@@ -922,5 +1152,460 @@ static void lineparser(void) {
 #endif
 	};
 
+	asn_counters_free(&counter_asn);
+
 	return;
 };
+
+
+/*
+ * Parse one line and fill statistics into counter block
+ */
+static void lineparser_line(char *linebuffer, const int linecounter, s_ipv6logstats_counters *countersp, const s_ipv6calc_db_batch *db_batchp) {
+	char *token;
+	char token_ipv4[NI_MAXHOST];
+	char resultstring[LINEBUFFER];
+	char *charptr, *cptr, **ptrptr;
+	int retval, r;
+	size_t length;
+
+	uint32_t inputtype  = FORMAT_undefined;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+	int registry, stat_registry_base;
+
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
+
+	ptrptr = &cptr;
+
+	stat_registry_base = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
+
+	length = strlen(linebuffer);
+
+	if (length >= LINEBUFFER) {
+		fprintf(stderr, "Line too long: %d\n", linecounter);
+		return;
+	};
+
+	/* remove trailing \n */
+	if ((length > 0) && (linebuffer[length - 1] == '\n')) {
+		linebuffer[--length] = '\0';
+	};
+
+	
+	if (length == 0) {
+		fprintf(stderr, "Line empty: %d\n", linecounter);
+		return;
+	};
+	
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
+
+	/* look for first token (should be IP address) */
+	charptr = strtok_r(linebuffer, " \t\n", ptrptr);
+	
+	if ( charptr == NULL ) {
+		fprintf(stderr, "Line contains no token: %d\n", linecounter);
+		return;
+	};
+
+	if ( strlen(charptr) >=  LINEBUFFER) {
+		fprintf(stderr, "Line too strange: %d\n", linecounter);
+		return;
+	};
+
+	/* token is kept in place, strtok_r terminates it inside the line */
+	token = charptr;
+	
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
+
+	if (opt_filter_file == 0) {
+		stat_inc(countersp, STATS_ALL);
+	};
+
+	/* set addresses to invalid */
+	ipv6addr.flag_valid = 0;
+	ipv4addr.flag_valid = 0;
+
+	/* fast path: plain IPv4/IPv6 address is detected and parsed in one pass */
+	inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+
+	if (inputtype == FORMAT_auto_noresult) {
+		/* get input type now */
+		inputtype = libipv6calc_autodetectinput(token);
+	};
+
+	/* check for proper type */
+	if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
+		/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
+		if (opt_filter_file == 1) {
+			/* not subject of prefix set, counted like without filter */
+			stat_inc(countersp, STATS_ALL);
+		};
+		stat_inc(countersp, STATS_UNKNOWN);
+		return;
+	};
+
+	/* fill related structure (if not already done by fast path) */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			retval = (ipv6addr.flag_valid == 1) ? 0 : addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			break;
+
+		case FORMAT_ipv4addr:
+			retval = (ipv4addr.flag_valid == 1) ? 0 : addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			break;
+
+		default:
+			retval = 0;
+			break;
+	};
+
+	if (retval != 0 ) {
+		fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
+		return;
+	};
+
+	/* catch compat/mapped */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			if ((ipv6addr.typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
+				/* extract IPv4 address */
+				r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r != 0) {
+					return;
+				};
+
+				// remap
+				inputtype = FORMAT_ipv4addr;
+
+				// create text represenation
+				r = libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token_ipv4, sizeof(token_ipv4), 0);
+				token = token_ipv4;
+			};
+			break;
+
+		default:
+			// nothing to do
+			break;
+	};
+
+	if (opt_filter_file == 1) {
+		/* count only lines selected by prefix set */
+		if (libipv6calc_filter_addrset(&filter_addrset, inputtype, &ipv4addr, &ipv6addr) != 0) {
+			DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Skip line not selected by prefix set: %d", linecounter);
+			return;
+		};
+		stat_inc(countersp, STATS_ALL);
+	};
+
+	/* get information and fill statistics */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			/* is IPv6 address */
+			stat_inc(countersp, STATS_IPV6);
+
+			if ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
+				/* has public IPv4 address included */
+
+				// get IPv4 address (in case of Teredo the client IP)
+				r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r != 0) {
+					return;
+				};
+
+				if (opt_simple != 1) {
+					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
+					as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr);
+					if (feature_cc == 1) {
+						stat_inc_country_code(countersp, cc_index, 4);
+					};
+
+					if (feature_as == 1) {
+						stat_inc_asnum(countersp, as_num32, 4);
+					};
+				};
+
+				registry = libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(db_batchp, &ipv4addr);
+
+				if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
+					stat_registry_base = STATS_IPV6_6TO4_BASE;
+
+				} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
+					stat_registry_base = STATS_IPV6_TEREDO_BASE;
+
+				} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
+					stat_registry_base = STATS_IPV6_NAT64_BASE;
+				};
+
+				if (stat_registry_base > 0) {
+					switch (registry) {
+						case IPV4_ADDR_REGISTRY_IANA:
+							stat_inc(countersp, stat_registry_base + REGISTRY_IANA);
+							break;
+						case IPV4_ADDR_REGISTRY_APNIC:
+							stat_inc(countersp, stat_registry_base + REGISTRY_APNIC);
+							break;
+						case IPV4_ADDR_REGISTRY_ARIN:
+							stat_inc(countersp, stat_registry_base + REGISTRY_ARIN);
+							break;
+						case IPV4_ADDR_REGISTRY_RIPENCC:
+							stat_inc(countersp, stat_registry_base + REGISTRY_RIPENCC);
+							break;
+						case IPV4_ADDR_REGISTRY_LACNIC:
+							stat_inc(countersp, stat_registry_base + REGISTRY_LACNIC);
+							break;
+						case IPV4_ADDR_REGISTRY_AFRINIC:
+							stat_inc(countersp, stat_registry_base + REGISTRY_AFRINIC);
+							break;
+						case IPV4_ADDR_REGISTRY_RESERVED:
+							stat_inc(countersp, stat_registry_base + REGISTRY_RESERVED);
+							break;
+						default:
+							stat_inc(countersp, stat_registry_base + REGISTRY_UNKNOWN);
+							if (opt_unknown == 1) {
+								fprintf(stderr, "Unknown address: %s\n", token);
+							};
+							break;
+					};
+				} else {
+					if (opt_unknown == 1) {
+						fprintf(stderr, "Unknown address: %s\n", token);
+					};
+				};
+			} else {
+				if (opt_simple != 1) {
+					cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
+					as_num32 = libipv6addr_as_num32_by_addr(&ipv6addr);
+
+					if (feature_cc == 1) {
+						/* country code */
+						stat_inc_country_code(countersp, cc_index, 6);
+					};
+
+					if (feature_as == 1) {
+						/* asnum */
+						stat_inc_asnum(countersp, as_num32, 6);
+					};
+				};
+
+				registry = libipv6addr_registry_num_by_addr(&ipv6addr);
+
+				switch (registry) {
+					case IPV6_ADDR_REGISTRY_6BONE:
+						stat_inc(countersp, STATS_IPV6_6BONE);
+						break;
+					case IPV6_ADDR_REGISTRY_IANA:
+						stat_inc(countersp, STATS_IPV6_IANA);
+						break;
+					case IPV6_ADDR_REGISTRY_APNIC:
+						stat_inc(countersp, STATS_IPV6_APNIC);
+						break;
+					case IPV6_ADDR_REGISTRY_ARIN:
+						stat_inc(countersp, STATS_IPV6_ARIN);
+						break;
+					case IPV6_ADDR_REGISTRY_RIPENCC:
+						stat_inc(countersp, STATS_IPV6_RIPENCC);
+						break;
+					case IPV6_ADDR_REGISTRY_LACNIC:
+						stat_inc(countersp, STATS_IPV6_LACNIC);
+						break;
+					case IPV6_ADDR_REGISTRY_AFRINIC:
+						stat_inc(countersp, STATS_IPV6_AFRINIC);
+						break;
+					case IPV6_ADDR_REGISTRY_RESERVED:
+						stat_inc(countersp, STATS_IPV6_RESERVED);
+						break;
+					default:
+						stat_inc(countersp, STATS_IPV6_UNKNOWN);
+						if (opt_unknown == 1) {
+							fprintf(stderr, "Unknown address: %s\n", token);
+						};
+						break;
+				};
+
+				if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
+					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
+						stat_inc(countersp, STATS_IPV6_IID_RANDOM);
+					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
+						stat_inc(countersp, STATS_IPV6_IID_ISATAP);
+					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
+						stat_inc(countersp, STATS_IPV6_IID_MANUAL);
+					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
+						stat_inc(countersp, STATS_IPV6_IID_GLOBAL);
+					} else {
+						stat_inc(countersp, STATS_IPV6_IID_UNKNOWN);
+					};
+				};
+			};
+			
+			break;
+
+		case FORMAT_ipv4addr:
+			/* is IPv4 address */
+			stat_inc(countersp, STATS_IPV4);
+
+			if (opt_simple != 1) {
+				cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
+				as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr);
+
+				stat_inc_country_code(countersp, cc_index, 4);
+				stat_inc_asnum(countersp, as_num32, 4);
+			};
+
+			registry = libipv6calc_db_wrapper_batch_registry_num_by_ipv4addr(db_batchp, &ipv4addr);
+
+			switch (registry) {
+				case IPV4_ADDR_REGISTRY_IANA:
+					stat_inc(countersp, STATS_IPV4_IANA);
+					break;
+				case IPV4_ADDR_REGISTRY_APNIC:
+					stat_inc(countersp, STATS_IPV4_APNIC);
+					break;
+				case IPV4_ADDR_REGISTRY_ARIN:
+					stat_inc(countersp, STATS_IPV4_ARIN);
+					break;
+				case IPV4_ADDR_REGISTRY_RIPENCC:
+					stat_inc(countersp, STATS_IPV4_RIPENCC);
+					break;
+				case IPV4_ADDR_REGISTRY_LACNIC:
+					stat_inc(countersp, STATS_IPV4_LACNIC);
+					break;
+				case IPV4_ADDR_REGISTRY_AFRINIC:
+					stat_inc(countersp, STATS_IPV4_AFRINIC);
+					break;
+				case IPV4_ADDR_REGISTRY_RESERVED:
+					stat_inc(countersp, STATS_IPV4_RESERVED);
+					break;
+				default:
+					stat_inc(countersp, STATS_IPV4_UNKNOWN);
+					if (opt_unknown == 1) {
+						fprintf(stderr, "Unknown address: %s\n", token);
+					};
+					break;
+			};
+			
+			break;
+	};
+};
+
+
+#ifdef SUPPORT_PTHREAD
+/*
+ * Multi-threaded line parser
+ *
+ * main thread reads batches of lines into a ring of slots, worker threads
+ * fill private counter blocks, which are added to the global counters at
+ * end of input, so the result is the same as in single-threaded mode
+ */
+static s_linebatch_ring *batches;
+
+typedef struct {
+	pthread_t                thread;
+	s_ipv6logstats_counters *countersp;
+	s_ipv6calc_db_batch      db_batch;	// batch lookup results of current batch
+	ipv6calc_ipaddr         *ipaddrs;
+} s_logstats_worker;
+
+
+/* worker thread: parse ready batches */
+static void *lineparser_worker(void *arg) {
+	s_logstats_worker *workerp = (s_logstats_worker *) arg;
+	s_linebatch *batchp;
+	char *linebuffer, *lineptr;
+	int l, num;
+
+	while ((batchp = liblinebatch_ring_get_ready(batches)) != NULL) {
+		if (flag_batch == 1) {
+			/* resolve addresses of batch at once (merge-join in database) */
+			libipv6calc_collect_ipv4addrs(batchp->in, batchp->in_used, batchp->lines, workerp->ipaddrs, &num);
+			if (num > 0) {
+				libipv6calc_db_wrapper_batch_prepare(&workerp->db_batch, workerp->ipaddrs, num);
+			};
+		};
+
+		lineptr = NULL;
+		for (l = 0; l < batchp->lines; l++) {
+			linebuffer = liblinebatch_line_next(batchp, &lineptr);
+			lineparser_line(linebuffer, batchp->linecounter + l, workerp->countersp, &workerp->db_batch);
+		};
+
+		liblinebatch_ring_put_done(batches, batchp);
+	};
+
+	return(NULL);
+};
+
+
+/* read stdin, dispatch to worker threads and merge counters */
+static int lineparser_threads(void) {
+	int linecounter = 0, i, eof = 0;
+	s_linereader reader;
+	s_logstats_worker *workers;
+	s_linebatch *batchp;
+
+	if (libipv6calc_db_wrapper_threads_init() != 0) {
+		fprintf(stderr, "Can't initialize database wrapper for threads\n");
+		return(1);
+	};
+
+	if (liblinereader_open(&reader, fileno(stdin)) != 0) {
+		fprintf(stderr, "Can't read from stdin\n");
+		return(1);
+	};
+
+	batches = liblinebatch_ring_new(opt_threads, 0);
+	workers = calloc((size_t) opt_threads, sizeof(s_logstats_worker));
+	if ((batches == NULL) || (workers == NULL)) {
+		fprintf(stderr, "Can't allocate memory for threads: %d\n", opt_threads);
+		return(1);
+	};
+
+	for (i = 0; i < opt_threads; i++) {
+		workers[i].countersp = calloc(1, sizeof(s_ipv6logstats_counters));
+		workers[i].ipaddrs = malloc(sizeof(ipv6calc_ipaddr) * LINEBATCH_LINES);
+		if ((workers[i].countersp == NULL) || (workers[i].ipaddrs == NULL)) {
+			fprintf(stderr, "Can't allocate memory for counters of thread: %d\n", i);
+			return(1);
+		};
+
+		if (pthread_create(&workers[i].thread, NULL, lineparser_worker, &workers[i]) != 0) {
+			fprintf(stderr, "Can't create worker thread: %d\n", i);
+			return(1);
+		};
+	};
+
+	while (eof == 0) {
+		batchp = liblinebatch_ring_get_free(batches);
+
+		eof = liblinebatch_fill(batchp, &reader, LINEBATCH_LINES, LINEBUFFER, &linecounter);
+		if (eof < 0) {
+			exit(EXIT_FAILURE);
+		};
+
+		liblinebatch_ring_put_ready(batches, batchp, eof);
+	};
+
+	liblinereader_close(&reader);
+
+	if (reader.error != 0) {
+		fprintf(stderr, "Error reading from stdin, input is incomplete\n");
+		return(1);
+	};
+
+	for (i = 0; i < opt_threads; i++) {
+		pthread_join(workers[i].thread, NULL);
+		counters_merge(workers[i].countersp);
+		free(workers[i].countersp);
+		free(workers[i].ipaddrs);
+		libipv6calc_db_wrapper_batch_cleanup(&workers[i].db_batch);
+	};
+
+	liblinebatch_ring_free(batches);
+	free(workers);
+
+	return(0);
+};
+#endif // SUPPORT_PTHREAD
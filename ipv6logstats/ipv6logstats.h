@@ -8,6 +8,8 @@
  *  Main header file
  */ 
 
+#include "ipv6calctypes.h"
+
 /* global program related definitions */
 #define PROGRAM_NAME "ipv6logstats"
 #define PROGRAM_COPYRIGHT "(P) & (C) 2003-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
@@ -51,10 +53,45 @@
 #define STATS_IPV6_IID_ISATAP		0x103
 #define STATS_IPV6_IID_UNKNOWN		0x10f
 
+/* lines ahead in input buffer resolved by batch lookup (single-threaded) */
+#define LOOKUP_BATCH_LINES	4096
+
 #define DEBUG_ipv6logstats_general	0x00000001l
 #define DEBUG_ipv6logstats_summary	0x00000002l
 #define DEBUG_ipv6logstats_processing	0x00000004l
 
+/* state file (binary, host byte order) */
+#define STATE_MAGIC		"I6LSTAT"	// incl. terminating NUL = 8 bytes
+#define STATE_VERSION		2	// 2: ASN records with full 32-bit ASN (1: 16-bit, mapped to AS_TRANS)
+#define STATE_BYTEORDER		0x01020304
+#define STATE_FILES_MAX		1024
+
+/*
+ *  header   : s_ipv6logstats_state_header
+ *  stat     : num_stat x uint64_t (order of statistic table)
+ *  cc sums  : 3 x uint64_t (ALL, IPv4, IPv6)
+ *  cc       : num_cc x s_ipv6logstats_state_record (only non-zero)
+ *  asn      : num_asn x s_ipv6logstats_state_record (only non-zero)
+ */
+typedef struct {
+	char		magic[8];	// STATE_MAGIC
+	uint32_t	byteorder;	// STATE_BYTEORDER
+	uint32_t	version;	// STATE_VERSION
+	uint32_t	stats_version;	// STATS_VERSION_MAJOR << 8 | STATS_VERSION_MINOR
+	uint32_t	num_stat;	// number of entries in statistic table
+	uint32_t	num_cc;		// number of CountryCode records
+	uint32_t	num_asn;	// number of ASN records
+	int64_t		unixtime;	// creation time
+} s_ipv6logstats_state_header;
+
+typedef struct {
+	uint32_t	index;		// CountryCode index or ASN
+	uint32_t	reserved;
+	uint64_t	all;
+	uint64_t	ipv4;
+	uint64_t	ipv6;
+} s_ipv6logstats_state_record;
+
 /* labels statistic numbers */
 typedef struct {
 	const int	number;
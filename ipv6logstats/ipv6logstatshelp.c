@@ -15,6 +15,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calccommands.h"
 #include "ipv6calchelp.h"
+#include "liblinebatch.h"
 #include "config.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
@@ -85,6 +86,18 @@ void ipv6logstats_printhelp(void) {
 	fprintf(stderr, "  [-o|--onlyheader]          : print only header in columns mode (1)\n");
 	fprintf(stderr, "  [-p|--prefix <token>]      : print token as prefix (1)\n");
 	fprintf(stderr, "  [-s|--simple]              : disable extended statistic (CountryCode/ASN)\n");
+	fprintf(stderr, "  [-A|--asn-top <N>]         : print only the N ASNs with most hits\n");
+	fprintf(stderr, "  [-m|--asn-threshold <N>]   : print only ASNs with at least N hits\n");
+	fprintf(stderr, "  [-T|--threads <value>]     : number of worker threads (0: single-threaded)\n");
+	fprintf(stderr, "                               lookups in GeoIP/IP2Location/DB-IP/External databases\n");
+	fprintf(stderr, "                               are serialized, only BuiltIn/MMAP run in parallel\n");
+	fprintf(stderr, "                               maximum: %d\n", LINEBATCH_THREADS_MAX);
+	fprintf(stderr, "  [-I|--state-in <file>]     : add counters from state file (can be given multiple times)\n");
+	fprintf(stderr, "  [-S|--state-out <file>]    : write counters to state file\n");
+	fprintf(stderr, "  [-M|--merge] [<file> ...]  : don't read log lines, only merge state files\n");
+	fprintf(stderr, "  [--filter-file <file>]     : count only lines with address selected by prefix set\n");
+	fprintf(stderr, "                               (format see: ipv6calc -E -?)\n");
+	fprintf(stderr, "                               lines without address are counted as UNKNOWN\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " (1) unsupported for CountryCode & ASN statistics\n");
 	fprintf(stderr, "\n");
@@ -20,7 +20,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6logstats_shortopts = "vh?uNosncp:w:";
+static char *ipv6logstats_shortopts = "vh?uNosncp:w:T:I:S:MA:m:";
 
 /* define long options */
 static struct option ipv6logstats_longopts[] = {
@@ -38,6 +38,13 @@ static struct option ipv6logstats_longopts[] = {
 	{"simple"	, 0, 0, (int) 's'},
 	{"write"	, 1, 0, (int) 'O'},
 	{"column-numbers", 1, 0, (int) 'N'},
+	{"threads"	, 1, 0, (int) 'T'},
+	{"state-in"	, 1, 0, (int) 'I'},
+	{"state-out"	, 1, 0, (int) 'S'},
+	{"merge"	, 0, 0, (int) 'M'},
+	{"asn-top"	, 1, 0, (int) 'A'},
+	{"asn-threshold", 1, 0, (int) 'm'},
+	{"filter-file"	, 1, 0, CMD_filter_file},
 };                
 
 #endif
@@ -249,4 +249,161 @@ if [ $result -ne 0 ]; then
 fi
 echo "INFO  : test scenario with huge amount of addresses: OK"
 
+if ./ipv6logstats -h 2>&1 | grep -q -- "--threads"; then
+	test="run 'ipv6logstats' threads test"
+	echo "INFO  : $test"
+	single="`(testscenarios; testscenario_hugelist ipv4) | ./ipv6logstats -q 2>/dev/null | grep -v "Time:"`"
+	for threads in 1 2 4; do
+		multi="`(testscenarios; testscenario_hugelist ipv4) | ./ipv6logstats -q --threads $threads 2>/dev/null | grep -v "Time:"`"
+		if [ "$single" != "$multi" ]; then
+			echo "ERROR : result differs between single-threaded and --threads $threads"
+			tmpfile_single="`mktemp`"
+			tmpfile_multi="`mktemp`"
+			echo "$single" >$tmpfile_single
+			echo "$multi" >$tmpfile_multi
+			diff -u $tmpfile_single $tmpfile_multi
+			rm -f $tmpfile_single $tmpfile_multi
+			exit 1
+		fi
+	done
+	echo "INFO  : $test successful"
+fi
+
+test="run 'ipv6logstats' state file test"
+echo "INFO  : $test"
+statedir="`mktemp -d`"
+single="`(testscenarios; testscenario_hugelist ipv4) | ./ipv6logstats -q 2>/dev/null | grep -v "Time:\|DB-Used:"`"
+testscenarios | ./ipv6logstats -q -S $statedir/1.state >/dev/null 2>&1 \
+	&& testscenario_hugelist ipv4 | ./ipv6logstats -q -S $statedir/2.state >/dev/null 2>&1 \
+	&& merged="`./ipv6logstats -q -M $statedir/1.state $statedir/2.state 2>/dev/null | grep -v "Time:\|DB-Used:"`"
+retval=$?
+if [ $retval -ne 0 -o "$single" != "$merged" ]; then
+	echo "ERROR : result differs between single run and merged state files"
+	echo "$single" >$statedir/single.txt
+	echo "$merged" >$statedir/merged.txt
+	diff -u $statedir/single.txt $statedir/merged.txt
+	rm -rf "$statedir"
+	exit 1
+fi
+
+# statistics version (offset 16): other minor version is accepted, other major version is rejected
+for stats_version in "4.1:0" "3.0:1" "5.0:1"; do
+	expected=${stats_version/*:/}
+	stats_version=${stats_version/:*/}
+	perl -e '
+		local $/; open(F, "<", $ARGV[0]) || exit 1; binmode(F); $data = <F>; close(F);
+		($major, $minor) = split(/\./, $ARGV[2]);
+		substr($data, 16, 4) = pack("L", ($major << 8) | $minor);
+		open(F, ">", $ARGV[1]) || exit 1; binmode(F); print F $data; close(F);
+	' $statedir/1.state $statedir/version.state $stats_version
+	./ipv6logstats -q -M $statedir/version.state >/dev/null 2>&1
+	retval=$?
+	if [ $expected -eq 0 -a $retval -ne 0 ] || [ $expected -ne 0 -a $retval -eq 0 ]; then
+		echo "ERROR : unexpected result of merging state file with statistics version $stats_version (rc=$retval)"
+		rm -rf "$statedir"
+		exit 1
+	fi
+done
+rm -rf "$statedir"
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' ASN (32-bit, --asn-top, --asn-threshold) test"
+echo "INFO  : $test"
+statedir="`mktemp -d`"
+# state file without records, ASN records (native byte order) are appended (independent from AS database)
+./ipv6logstats -q -S $statedir/empty.state </dev/null >/dev/null 2>&1 \
+	&& perl -e '
+		local $/; open(F, "<", $ARGV[0]) || exit 1; binmode(F); $data = <F>; close(F);
+		@asn = ([4200000001, 5, 3, 2], [65536, 3, 3, 0], [70000, 3, 0, 3], [3215, 1, 1, 0]);
+		substr($data, 28, 4) = pack("L", scalar(@asn)); # num_asn
+		foreach $r (@asn) { $data .= pack("LLQQQ", $$r[0], 0, $$r[1], $$r[2], $$r[3]); };
+		open(F, ">", $ARGV[1]) || exit 1; binmode(F); print F $data; close(F);
+	' $statedir/empty.state $statedir/asn.state
+retval=$?
+if [ $retval -ne 0 ]; then
+	echo "ERROR : can't create state file with ASN records"
+	rm -rf "$statedir"
+	exit 1
+fi
+
+for options in "" "--asn-top 2" "--asn-threshold 3" "--asn-top 3 --asn-threshold 2"; do
+	case "$options" in
+	    "")
+		asn_included="4200000001 65536 70000 3215"; asn_excluded="";;
+	    "--asn-top 2")
+		# tie between 65536 and 70000: lower ASN first
+		asn_included="4200000001 65536"; asn_excluded="70000 3215";;
+	    "--asn-threshold 3")
+		asn_included="4200000001 65536 70000"; asn_excluded="3215";;
+	    "--asn-top 3 --asn-threshold 2")
+		asn_included="4200000001 65536 70000"; asn_excluded="3215";;
+	esac
+
+	output="`./ipv6logstats -q $options -M $statedir/asn.state 2>/dev/null`"
+	if [ $? -ne 0 ]; then
+		echo "ERROR : executing 'ipv6logstats $options -M' failed"
+		rm -rf "$statedir"
+		exit 1
+	fi
+
+	for asn in $asn_included; do
+		if ! echo "$output" | grep -q "^\*3\*AS-num-proto-list/$asn "; then
+			echo "ERROR : ASN $asn missing in output (options: $options)"
+			echo "$output" | grep "AS-"
+			rm -rf "$statedir"
+			exit 1
+		fi
+	done
+	for asn in $asn_excluded; do
+		if echo "$output" | grep -q "/$asn\W"; then
+			echo "ERROR : ASN $asn unexpected in output (options: $options)"
+			echo "$output" | grep "AS-"
+			rm -rf "$statedir"
+			exit 1
+		fi
+	done
+
+	# sum covers also suppressed ASNs
+	if ! echo "$output" | grep -q "^\*3\*AS-proto-num-list/ALL  12 7 5$"; then
+		echo "ERROR : unexpected ASN sum (options: $options)"
+		echo "$output" | grep "AS-"
+		rm -rf "$statedir"
+		exit 1
+	fi
+done
+
+if ! echo "$output" | grep -q "^\*3\*AS-num-proto-list/4200000001  5 3 2$"; then
+	echo "ERROR : unexpected counters of 32-bit ASN"
+	echo "$output" | grep "AS-"
+	rm -rf "$statedir"
+	exit 1
+fi
+rm -rf "$statedir"
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' filter-file test"
+echo "INFO  : $test"
+tmpfile="`mktemp`"
+cat <<END >$tmpfile
+192.168.0.0/16
+2001:db8::/32
+^2001:db8::a0fc:4291:a0fc:1884/128
+END
+# selected: 192.168.1.1 and 2001:db8::a0fc:4941:a0fc:3041, line without address is counted as UNKNOWN
+output="`(testscenarios; echo "unknown - - [15/Jun/2003:05:01:56 +0200] \"GET / HTTP/1.1\" 200 1011") | ./ipv6logstats -q --filter-file $tmpfile 2>/dev/null`"
+retval=$?
+rm -f $tmpfile
+for match in "ALL 3" "IPv4 1" "IPv6 1" "UNKNOWN 1"; do
+	if ! echo "$output" | grep -q "^${match% *}\W*${match#* }$"; then
+		echo "ERROR : unexpected result with filter-file (expected: $match)"
+		echo "$output" | grep -v "DB-Info"
+		exit 1
+	fi
+done
+if [ $retval -ne 0 ]; then
+	echo "Error executing 'ipv6logstats' with filter-file!"
+	exit 1
+fi
+echo "INFO  : $test successful"
+
 echo "All tests were successfully done!"
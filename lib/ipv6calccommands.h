@@ -70,6 +70,7 @@
 #define DB_ip2location_comm_to_lite_switch_min_delta_months		0x0020110
 #define DB_ip2location_only_type	0x0020120
 #define DB_ip2location_allow_softlinks	0x0020130
+#define DB_ip2location_disable_native	0x0020140
 
 #define DB_geoip_disable		0x0021000
 #define DB_geoip_dir			0x0021050
@@ -85,7 +86,11 @@
 
 #define DB_builtin_disable		0x0024000
 
+#define DB_mmap_disable			0x0025000
+#define DB_mmap_dir			0x0025050
+
 #define DB_common_priorization		0x002fff0
+#define DB_common_bdb_index		0x002ffe0
 
 
 /* address anonymizer options */
@@ -113,6 +118,21 @@
 #define CMD_test_lt			0x0050040	// less than
 #define CMD_test_le			0x0050050	// less equal
 
+/* filter options */
+#define CMD_filter_file			0x0060010	// prefix set file
+
+/* pipe mode options */
+#define CMD_pipe_workers		0x0070010	// amount of worker processes
+
+/* aggregation options */
+#define CMD_aggregate_ipv4		0x0080010	// maximum IPv4 prefix length
+#define CMD_aggregate_ipv6		0x0080020	// maximum IPv6 prefix length
+
+/* reverse DNS options */
+#define CMD_reverse_ipv4		0x0090010	// IPv4 sub-prefix length
+#define CMD_reverse_ipv6		0x0090020	// IPv6 sub-prefix length
+#define CMD_reverse_ptr			0x0090030	// PTR record domain
+
 /* no operations (dummy) */
 #define OPTION_NOOP			0xfffffff
 
@@ -25,6 +25,7 @@
 #include "databases/lib/libipv6calc_db_wrapper_DBIP.h"
 #include "databases/lib/libipv6calc_db_wrapper_BuiltIn.h"
 #include "databases/lib/libipv6calc_db_wrapper_External.h"
+#include "databases/lib/libipv6calc_db_wrapper_MMAP.h"
 
 
 #ifdef SUPPORT_IP2LOCATION
@@ -328,6 +329,8 @@ void printhelp_common(const uint32_t help_features) {
 		fprintf(stderr, "  [--db-ip2location-only-type <TYPE>]: IP2Location database only selected type (1-%d)\n", IP2LOCATION_DB_MAX);
 		fprintf(stderr, "  [--db-ip2location-allow-softlinks] : IP2Location database softlinks allowed\n");
 		fprintf(stderr, "     by default they are ignored because it is hard to autodetect COMM/LITE/SAMPLE\n");
+		fprintf(stderr, "  [--db-ip2location-disable-native ] : IP2Location database lookups only via library\n");
+		fprintf(stderr, "     by default BIN files are read natively (library is used as fallback)\n");
 		fprintf(stderr, "  [--db-ip2location-lite-to-sample-autoswitch-max-delta-months <MONTHS>]:\n");
 		fprintf(stderr, "     autoswitch from LITE to SAMPLE databases if possible and delta is not more than %d months (0=disabled)\n", ip2location_db_lite_to_sample_autoswitch_max_delta_months);
 		fprintf(stderr, "  [--db-ip2location-comm-to-lite-switch-min-delta-months <MONTHS>]:\n");
@@ -368,6 +371,15 @@ void printhelp_common(const uint32_t help_features) {
 #endif
 	};
 
+	if ((help_features & IPV6CALC_HELP_MMAP) != 0) {
+#ifdef SUPPORT_MMAP
+		fprintf(stderr, "\n");
+		fprintf(stderr, "  [--disable-mmap                  ] : MMAP support disabled\n");
+		fprintf(stderr, "  [--db-mmap-disable               ] : MMAP support disabled\n");
+		fprintf(stderr, "  [--db-mmap-dir        <directory>] : MMAP database directory (default: %s)\n", mmap_db_dir);
+#endif
+	};
+
 	if ((help_features & IPV6CALC_HELP_BUILTIN) != 0) {
 #ifdef SUPPORT_BUILTIN
 		fprintf(stderr, "\n");
@@ -375,7 +387,7 @@ void printhelp_common(const uint32_t help_features) {
 		fprintf(stderr, "  [--db-builtin-disable            ] : BuiltIn support disabled\n");
 #endif
 
-#if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
 		fprintf(stderr, "\n");
 		fprintf(stderr, "  [--db-priorization <entry1>[:...]] : Database priorization order list (overwrites default)\n");
 		fprintf(stderr, "                                         colon separated:");
@@ -385,6 +397,10 @@ void printhelp_common(const uint32_t help_features) {
 		};
 		fprintf(stderr, "\n");
 #endif
+
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP
+		fprintf(stderr, "  [--db-bdb-index                  ] : build in-memory key index of Berkeley DB databases on first lookup\n");
+#endif
 	};
 
 	fprintf(stderr, "\n");
@@ -793,6 +809,12 @@ void printhelp_action_dispatcher(const uint32_t action, const int embedded) {
 			fprintf(stderr, "   [^]ipv4.addr=(le|lt|gt|ge)=<IPV4-ADDRESS>\n");
 			fprintf(stderr, "   [^]ipv6.addr=(le|lt|gt|ge)=<IPV6-ADDRESS>\n");
 			fprintf(stderr, "\n");
+			fprintf(stderr, "  IPv4/v6 address filter based on a prefix set file (can be combined with -E):\n");
+			fprintf(stderr, "   --filter-file <FILE>\n");
+			fprintf(stderr, "    one entry per line: [^]<IPV4|IPV6-ADDRESS>[/<PREFIX-LENGTH>] [ge <N>] [le <N>]\n");
+			fprintf(stderr, "    ge/le: range of prefix length of given address (default: inside prefix)\n");
+			fprintf(stderr, "    lines starting with '#' are ignored\n");
+			fprintf(stderr, "\n");
 			fprintf(stderr, "  EUI-48/MAC address filter tokens:\n");
 			fprintf(stderr, "   ");
 			fprintf(stderr, " IMPLEMENTATION MISSING");
@@ -823,6 +845,39 @@ void printhelp_action_dispatcher(const uint32_t action, const int embedded) {
 			fprintf(stderr, "  ipv6calc [-A test] --test_ge 2001:db8:: --test_lt 2001:db9:: 2001:db8::1\n");
 			fprintf(stderr, "\n");
 			break;
+
+		case ACTION_aggregate:
+			fprintf(stderr, " Aggregate given addresses/prefixes to a merged minimal prefix list:\n");
+			fprintf(stderr, "  --aggregate-ipv4 <LENGTH>    : aggregate IPv4 to at most /LENGTH (default: 32)\n");
+			fprintf(stderr, "  --aggregate-ipv6 <LENGTH>    : aggregate IPv6 to at most /LENGTH (default: 128)\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Aggregate addresses/prefixes from stdin (first token of each line), e.g.\n");
+			fprintf(stderr, "  cat list | ipv6calc -A aggregate\n");
+			fprintf(stderr, "  cat list | ipv6calc [-A aggregate] --aggregate-ipv6 48 --aggregate-ipv4 24\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Aggregate given addresses/prefixes\n");
+			fprintf(stderr, "  ipv6calc -A aggregate 192.0.2.0/25 192.0.2.128/25 2001:db8::/33 2001:db8:8000::/33\n");
+			fprintf(stderr, "\n");
+			break;
+
+		case ACTION_genreverse:
+			fprintf(stderr, " Generate reverse DNS names (in-addr.arpa/ip6.arpa) of given addresses/prefixes:\n");
+			fprintf(stderr, "  --reverse-ipv4 <LENGTH>      : names of all IPv4 sub-prefixes of /LENGTH (divisible by 8)\n");
+			fprintf(stderr, "  --reverse-ipv6 <LENGTH>      : names of all IPv6 sub-prefixes of /LENGTH (divisible by 4)\n");
+			fprintf(stderr, "                                  (default: prefix length rounded up to octet/nibble boundary)\n");
+			fprintf(stderr, "  --reverse-ptr <DOMAIN>       : print as PTR records with host label in DOMAIN\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, "  At most 2^24 names are generated per address/prefix,\n");
+			fprintf(stderr, "  overlapping input can be merged before by 'ipv6calc -A aggregate'\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Generate reverse DNS names from stdin (first token of each line), e.g.\n");
+			fprintf(stderr, "  echo 2001:db8::1 | ipv6calc -A genreverse\n");
+			fprintf(stderr, "  cat list | ipv6calc [-A genreverse] --reverse-ipv6 64 --reverse-ipv4 24\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Generate PTR records of all /64 of a /56\n");
+			fprintf(stderr, "  ipv6calc --reverse-ipv6 64 --reverse-ptr cust.example.net 2001:db8:1234:5600::/56\n");
+			fprintf(stderr, "\n");
+			break;
 	};
 };
 
@@ -955,6 +1010,13 @@ void ipv6calc_print_features_verbose(const int level_verbose) {
 	fprintf(stderr, "External (generated BerkeleyDB) support not compiled-in\n\n");
 #endif
 
+#ifdef SUPPORT_MMAP
+	libipv6calc_db_wrapper_MMAP_wrapper_info(string, sizeof(string));
+	fprintf(stderr, "%s\n\n", string);
+#else
+	fprintf(stderr, "MMAP support not compiled-in\n\n");
+#endif
+
 #ifdef SUPPORT_BUILTIN
 	libipv6calc_db_wrapper_BuiltIn_wrapper_info(string, sizeof(string));
 	fprintf(stderr, "%s\n\n", string);
@@ -75,6 +75,7 @@ static struct option ipv6calc_longopts_ip2location[] = {
 	{"db-ip2location-comm-to-lite-switch-min-delta-months", 1, NULL, DB_ip2location_comm_to_lite_switch_min_delta_months },
 	{"db-ip2location-only-type", 1, NULL, DB_ip2location_only_type },
 	{"db-ip2location-allow-softlinks", 0, NULL, DB_ip2location_allow_softlinks },
+	{"db-ip2location-disable-native", 0, NULL, DB_ip2location_disable_native },
 
 #ifdef SUPPORT_IP2LOCATION_DYN
 	{"db-ip2location-lib"          , 1, NULL, DB_ip2location_lib     },
@@ -126,6 +127,16 @@ static struct option ipv6calc_longopts_external[] = {
 };
 #endif // SUPPORT_EXTERNAL
 
+#ifdef SUPPORT_MMAP
+static char *ipv6calc_shortopts_mmap = "";
+
+static struct option ipv6calc_longopts_mmap[] = {
+	{"disable-mmap"                , 0, NULL, DB_mmap_disable       },
+	{"db-mmap-disable"             , 0, NULL, DB_mmap_disable       },
+	{"db-mmap-dir"                 , 1, NULL, DB_mmap_dir           },
+};
+#endif // SUPPORT_MMAP
+
 #ifdef SUPPORT_BUILTIN
 static char *ipv6calc_shortopts_builtin = "";
 
@@ -135,11 +146,12 @@ static struct option ipv6calc_longopts_builtin[] = {
 };
 #endif // SUPPORT_BUILTIN
 
-#if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_MMAP || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
 static char *ipv6calc_shortopts_db_common = "";
 
 static struct option ipv6calc_longopts_db_common[] = {
 	{"db-priorization"             , 1, NULL, DB_common_priorization },
+	{"db-bdb-index"                , 0, NULL, DB_common_bdb_index    },
 };
 #endif
 
@@ -10,6 +10,7 @@
  */ 
 
 #include "ipv6calc_inttypes.h"
+#include "libasnmap.h"
 #include "ipv6calccommands.h"
 #include <getopt.h>
 
@@ -274,6 +275,8 @@ typedef struct {
 #define ACTION_NUM_ipv6_to_eui64	10
 #define ACTION_NUM_filter		15
 #define ACTION_NUM_test			16
+#define ACTION_NUM_aggregate		17
+#define ACTION_NUM_genreverse		18
 #define ACTION_NUM_undefined		31
 
 #define ACTION_auto			(uint32_t) 0x0
@@ -289,6 +292,8 @@ typedef struct {
 #define ACTION_ipv6_to_eui64		(uint32_t) (1 << ACTION_NUM_ipv6_to_eui64)
 #define ACTION_filter			(uint32_t) (1 << ACTION_NUM_filter)
 #define ACTION_test			(uint32_t) (1 << ACTION_NUM_test)
+#define ACTION_aggregate		(uint32_t) (1 << ACTION_NUM_aggregate)
+#define ACTION_genreverse		(uint32_t) (1 << ACTION_NUM_genreverse)
 #define ACTION_undefined		(uint32_t) (1 << ACTION_NUM_undefined)
 
 #define ANON_METHOD_ANONYMIZE		1
@@ -316,6 +321,8 @@ typedef struct {
 	{ ACTION_6rd_extract_ipv4     , "6rd_extract_ipv4", "Extract from 6rd address the include IPv4 address", "" },
 	{ ACTION_filter	              , "filter"          , "Filter addresses related to filter options", "" },
 	{ ACTION_test                 , "test"            , "Test address against given prefix or address", "" },
+	{ ACTION_aggregate            , "aggregate"       , "Aggregate IPv4/IPv6 addresses and prefixes to a minimal prefix list", "" },
+	{ ACTION_genreverse           , "genreverse"      , "Generates reverse DNS names of addresses/prefixes or of all their sub-prefixes, optional as PTR records", "" },
 };
 
 /* Possible action option map (required) */
@@ -338,6 +345,11 @@ typedef struct {
 	{ ACTION_test			, CMD_test_ge, 1},
 	{ ACTION_test			, CMD_test_lt, 1},
 	{ ACTION_test			, CMD_test_le, 1},
+	{ ACTION_aggregate		, CMD_aggregate_ipv4, 1},
+	{ ACTION_aggregate		, CMD_aggregate_ipv6, 1},
+	{ ACTION_genreverse		, CMD_reverse_ipv4, 1},
+	{ ACTION_genreverse		, CMD_reverse_ipv6, 1},
+	{ ACTION_genreverse		, CMD_reverse_ptr, 1},
 };
 
 /* anonymization set */
@@ -361,8 +373,7 @@ typedef struct {
 
 
 /**** filter structures ****/
-#define IPV6CALC_FILTER_DB_CC_MAX	16
-#define IPV6CALC_FILTER_DB_ASN_MAX	16
+#define IPV6CALC_FILTER_DB_CC_BITS	1024	// bitset covering all country code indexes (COUNTRYCODE_INDEX_MAX)
 #define IPV6CALC_FILTER_DB_REGISTRY_MAX	8
 #define IPV6CALC_FILTER_IPV4ADDR	16
 #define IPV6CALC_FILTER_IPV6ADDR	16
@@ -370,20 +381,20 @@ typedef struct {
 /* DB CC (CountryCode) filter structure */
 typedef struct {
 	int active;
-	int cc_must_have_max;
-	int cc_may_not_have_max;
-	uint16_t cc_must_have[IPV6CALC_FILTER_DB_CC_MAX];
-	uint16_t cc_may_not_have[IPV6CALC_FILTER_DB_CC_MAX];
+	int cc_must_have_max;		// amount of country codes in bitset
+	int cc_may_not_have_max;	// amount of country codes in bitset
+	uint32_t cc_must_have[IPV6CALC_FILTER_DB_CC_BITS / 32];		// bitset by cc_index
+	uint32_t cc_may_not_have[IPV6CALC_FILTER_DB_CC_BITS / 32];	// bitset by cc_index
 } s_ipv6calc_filter_db_cc;
 
 
 /* DB ASN (Autonomous System Number) filter structure */
 typedef struct {
 	int active;
-	int asn_must_have_max;
-	int asn_may_not_have_max;
-	uint32_t asn_must_have[IPV6CALC_FILTER_DB_ASN_MAX];
-	uint32_t asn_may_not_have[IPV6CALC_FILTER_DB_ASN_MAX];
+	int asn_must_have_max;		// amount of ASNs in set
+	int asn_may_not_have_max;	// amount of ASNs in set
+	s_asnmap asn_must_have;		// used as set, index not used
+	s_asnmap asn_may_not_have;	// used as set, index not used
 } s_ipv6calc_filter_db_asn;
 
 
@@ -0,0 +1,124 @@
+/*
+ * Project    : ipv6calc
+ * File       : libasnmap.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for mapping 32-bit ASNs to dense indexes
+ *   - hash table with multiplicative hash, open addressing and linear probing
+ *   - indexes are given in order of adding, caller keeps values in own array
+ *   - used by ASN filter (set only) and ipv6logstats (counters per ASN)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "libasnmap.h"
+
+
+/* multiplicative hash of ASN, slot by mask */
+#define ASNMAP_HASH(asn)	((uint32_t) ((asn) * 2654435761u))
+
+
+/*
+ * slot of ASN, either the one containing it or the free one to add it
+ */
+static uint32_t libasnmap_slot(const s_asnmap_slot *slots, const uint32_t size, const uint32_t asn) {
+	uint32_t i, mask = size - 1;
+
+	for (i = ASNMAP_HASH(asn) & mask; slots[i].index != 0; i = (i + 1) & mask) {
+		if (slots[i].asn == asn) {
+			break;
+		};
+	};
+
+	return(i);
+};
+
+
+/*
+ * get index of ASN
+ *
+ * in : map, asn
+ * ret: index, -1 = not found
+ */
+int libasnmap_get(const s_asnmap *map, const uint32_t asn) {
+	uint32_t i;
+
+	if (map->size == 0) {
+		return(-1);
+	};
+
+	i = libasnmap_slot(map->slots, map->size, asn);
+
+	return((int) map->slots[i].index - 1);
+};
+
+
+/*
+ * add ASN to map, grows map to keep load below 3/4
+ *
+ * in : map, asn
+ * mod: indexp (index of ASN, if not NULL)
+ * ret: 0=added 1=already member -1=can't allocate memory
+ */
+int libasnmap_add(s_asnmap *map, const uint32_t asn, uint32_t *indexp) {
+	s_asnmap_slot *slots;
+	uint32_t size, i, j;
+
+	if (map->size > 0) {
+		i = libasnmap_slot(map->slots, map->size, asn);
+		if (map->slots[i].index != 0) {
+			if (indexp != NULL) {
+				*indexp = map->slots[i].index - 1;
+			};
+			return(1);
+		};
+	};
+
+	if ((map->used + 1) * 4 > map->size * 3) {
+		size = (map->size == 0) ? ASNMAP_SIZE_MIN : map->size * 2;
+
+		slots = calloc(size, sizeof(s_asnmap_slot));
+		if (slots == NULL) {
+			ERRORPRINT_WA("can't allocate memory for ASN map with slots: %u", size);
+			return(-1);
+		};
+
+		/* rehash existing members */
+		for (j = 0; j < map->size; j++) {
+			if (map->slots[j].index != 0) {
+				slots[libasnmap_slot(slots, size, map->slots[j].asn)] = map->slots[j];
+			};
+		};
+
+		free(map->slots);
+		map->slots = slots;
+		map->size = size;
+	};
+
+	i = libasnmap_slot(map->slots, map->size, asn);
+	map->slots[i].asn = asn;
+	map->slots[i].index = ++map->used;
+
+	if (indexp != NULL) {
+		*indexp = map->used - 1;
+	};
+
+	return(0);
+};
+
+
+/*
+ * free map
+ */
+void libasnmap_free(s_asnmap *map) {
+	free(map->slots);
+	map->slots = NULL;
+	map->size = 0;
+	map->used = 0;
+};
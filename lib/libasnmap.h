@@ -0,0 +1,39 @@
+/*
+ * Project    : ipv6calc
+ * File       : libasnmap.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libasnmap.c
+ */
+
+#include "ipv6calc_inttypes.h"
+
+
+#ifndef _libasnmap_h
+
+#define _libasnmap_h 1
+
+/* initial amount of slots */
+#define ASNMAP_SIZE_MIN		64
+
+/* slot of hash table */
+typedef struct {
+	uint32_t asn;
+	uint32_t index;		/* index + 1 into array of caller, 0 = free slot */
+} s_asnmap_slot;
+
+/* map of 32-bit ASN to index (open addressing, linear probing) */
+typedef struct {
+	s_asnmap_slot *slots;
+	uint32_t size;		/* amount of slots (power of 2), 0 = not allocated */
+	uint32_t used;		/* amount of ASNs, indexes are given in order of adding: 0..used-1 */
+} s_asnmap;
+
+#endif
+
+
+extern int  libasnmap_get(const s_asnmap *map, const uint32_t asn);
+extern int  libasnmap_add(s_asnmap *map, const uint32_t asn, uint32_t *indexp);
+extern void libasnmap_free(s_asnmap *map);
@@ -0,0 +1,249 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipaddrcache.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for a bounded result cache keyed on binary IPv4/6
+ *  address and operation tag
+ *   - hash table with chaining by entry index
+ *   - eviction by CLOCK (second chance)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "libipaddrcache.h"
+
+
+/*
+ * build key from address
+ *  IPv4-mapped IPv6 addresses keep their own key, results of callers depend on the notation
+ */
+static void libipaddrcache_key(const ipv6calc_ipaddr *ipaddrp, uint32_t *addr, uint8_t *proto) {
+	addr[0] = ipaddrp->addr[0];
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		addr[1] = 0;
+		addr[2] = 0;
+		addr[3] = 0;
+	} else {
+		addr[1] = ipaddrp->addr[1];
+		addr[2] = ipaddrp->addr[2];
+		addr[3] = ipaddrp->addr[3];
+	};
+	*proto = ipaddrp->proto;
+};
+
+
+/*
+ * hash of key (multiplicative mixing)
+ */
+static uint32_t libipaddrcache_hash(const uint32_t *addr, const uint8_t proto, const uint32_t tag) {
+	uint32_t hash = 0x811c9dc5u ^ proto;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash ^= addr[i];
+		hash *= 0x9e3779b1u;
+		hash ^= hash >> 15;
+	};
+
+	hash ^= tag;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+
+	return (hash);
+};
+
+
+/*
+ * initialize cache
+ *
+ * in : limit = maximum amount of entries
+ * mod: cache
+ * ret: 0=ok, 1=error
+ */
+int libipaddrcache_init(s_ipaddrcache *cache, const uint32_t limit) {
+	uint32_t buckets = 1;
+	uint32_t i;
+
+	memset(cache, 0, sizeof(*cache));
+
+	if ((limit < 1) || (limit > IPADDRCACHE_LIMIT_MAX)) {
+		ERRORPRINT_WA("cache limit out of range: %u", limit);
+		return (1);
+	};
+
+	while (buckets < limit * 2) {
+		buckets <<= 1;
+	};
+
+	cache->entries = calloc((size_t) limit, sizeof(s_ipaddrcache_entry));
+	cache->buckets = malloc(sizeof(uint32_t) * buckets);
+
+	if ((cache->entries == NULL) || (cache->buckets == NULL)) {
+		free(cache->entries);
+		free(cache->buckets);
+		cache->entries = NULL;
+		cache->buckets = NULL;
+		return (1);
+	};
+
+	for (i = 0; i < buckets; i++) {
+		cache->buckets[i] = IPADDRCACHE_NONE;
+	};
+
+	cache->limit = limit;
+	cache->bucket_mask = buckets - 1;
+
+	DEBUGPRINT_WA(DEBUG_libipaddrcache, "cache initialized: limit=%u buckets=%u", limit, buckets);
+
+	return (0);
+};
+
+
+/*
+ * release cache
+ */
+void libipaddrcache_cleanup(s_ipaddrcache *cache) {
+	uint32_t i;
+
+	if (cache->entries == NULL) {
+		return;
+	};
+
+	for (i = 0; i < cache->used; i++) {
+		free(cache->entries[i].value);
+	};
+
+	free(cache->entries);
+	free(cache->buckets);
+	cache->entries = NULL;
+	cache->buckets = NULL;
+	cache->used = 0;
+};
+
+
+/*
+ * lookup value
+ *
+ * in : ipaddrp = address
+ * in : tag     = operation tag
+ * ret: value or NULL
+ */
+const char *libipaddrcache_lookup(s_ipaddrcache *cache, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag) {
+	uint32_t addr[4], hash, i;
+	uint8_t proto;
+	s_ipaddrcache_entry *entry;
+
+	if (cache->entries == NULL) {
+		return (NULL);
+	};
+
+	libipaddrcache_key(ipaddrp, addr, &proto);
+	hash = libipaddrcache_hash(addr, proto, tag);
+
+	for (i = cache->buckets[hash & cache->bucket_mask]; i != IPADDRCACHE_NONE; i = entry->next) {
+		entry = &cache->entries[i];
+
+		if ((entry->tag == tag) && (entry->proto == proto) \
+		    && (entry->addr[0] == addr[0]) && (entry->addr[1] == addr[1]) \
+		    && (entry->addr[2] == addr[2]) && (entry->addr[3] == addr[3])) {
+			entry->referenced = 1;
+			cache->hit++;
+			DEBUGPRINT_WA(DEBUG_libipaddrcache, "cache hit: entry=%u tag=0x%08x value=%s", i, tag, entry->value);
+			return (entry->value);
+		};
+	};
+
+	cache->miss++;
+	return (NULL);
+};
+
+
+/*
+ * unlink entry from its bucket chain
+ */
+static void libipaddrcache_unlink(s_ipaddrcache *cache, const uint32_t index) {
+	s_ipaddrcache_entry *entry = &cache->entries[index];
+	uint32_t *iptr = &cache->buckets[libipaddrcache_hash(entry->addr, entry->proto, entry->tag) & cache->bucket_mask];
+
+	while (*iptr != IPADDRCACHE_NONE) {
+		if (*iptr == index) {
+			*iptr = entry->next;
+			return;
+		};
+		iptr = &cache->entries[*iptr].next;
+	};
+};
+
+
+/*
+ * store value, evict by CLOCK if full
+ *
+ * in : ipaddrp = address
+ * in : tag     = operation tag
+ * in : value   = value to store (copied)
+ * ret: 0=ok, 1=error
+ */
+int libipaddrcache_store(s_ipaddrcache *cache, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag, const char *value) {
+	uint32_t addr[4], hash, index;
+	uint8_t proto;
+	s_ipaddrcache_entry *entry;
+	char *data;
+	size_t length = strlen(value);
+
+	if (cache->entries == NULL) {
+		return (1);
+	};
+
+	libipaddrcache_key(ipaddrp, addr, &proto);
+	hash = libipaddrcache_hash(addr, proto, tag);
+
+	if (cache->used < cache->limit) {
+		index = cache->used++;
+	} else {
+		/* second chance: skip and clear referenced entries */
+		while (cache->entries[cache->hand].referenced != 0) {
+			cache->entries[cache->hand].referenced = 0;
+			cache->hand = (cache->hand + 1) % cache->limit;
+		};
+		index = cache->hand;
+		cache->hand = (cache->hand + 1) % cache->limit;
+
+		libipaddrcache_unlink(cache, index);
+		cache->evict++;
+		DEBUGPRINT_WA(DEBUG_libipaddrcache, "cache evict: entry=%u", index);
+	};
+
+	entry = &cache->entries[index];
+
+	data = realloc(entry->value, length + 1);
+	if (data == NULL) {
+		/* entry stays unlinked, new slot is given back */
+		if (entry->value == NULL) {
+			cache->used--;
+		};
+		return (1);
+	};
+	memcpy(data, value, length + 1);
+
+	entry->value = data;
+	entry->addr[0] = addr[0];
+	entry->addr[1] = addr[1];
+	entry->addr[2] = addr[2];
+	entry->addr[3] = addr[3];
+	entry->proto = proto;
+	entry->tag = tag;
+	entry->referenced = 0;
+	entry->next = cache->buckets[hash & cache->bucket_mask];
+	cache->buckets[hash & cache->bucket_mask] = index;
+
+	DEBUGPRINT_WA(DEBUG_libipaddrcache, "cache store: entry=%u tag=0x%08x value=%s", index, tag, value);
+
+	return (0);
+};
@@ -0,0 +1,57 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipaddrcache.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipaddrcache.c
+ */ 
+
+#include "ipv6calc_inttypes.h"
+#include "libipaddr.h"
+
+
+#ifndef _libipaddrcache_h
+
+#define _libipaddrcache_h 1
+
+/* default and maximum amount of entries */
+#define IPADDRCACHE_LIMIT_DEFAULT	65536
+#define IPADDRCACHE_LIMIT_MAX		16777216
+
+/* end of chain marker */
+#define IPADDRCACHE_NONE		0xffffffffu
+
+/* cache entry, value is stored in an own allocated string */
+typedef struct {
+	uint32_t addr[4];	/* binary address (IPv4: only addr[0] used) */
+	uint32_t tag;		/* operation tag defined by caller */
+	uint32_t next;		/* next entry in bucket chain */
+	uint8_t  proto;		/* IPV6CALC_PROTO_IPV4|IPV6CALC_PROTO_IPV6 */
+	uint8_t  referenced;	/* CLOCK reference bit */
+	char     *value;
+} s_ipaddrcache_entry;
+
+/* cache structure */
+typedef struct {
+	uint32_t limit;
+	uint32_t used;
+	uint32_t hand;		/* CLOCK hand */
+	uint32_t bucket_mask;
+	s_ipaddrcache_entry *entries;
+	uint32_t *buckets;
+
+	/* statistics */
+	unsigned long int hit;
+	unsigned long int miss;
+	unsigned long int evict;
+} s_ipaddrcache;
+
+#endif
+
+
+extern int  libipaddrcache_init(s_ipaddrcache *cache, const uint32_t limit);
+extern void libipaddrcache_cleanup(s_ipaddrcache *cache);
+extern const char *libipaddrcache_lookup(s_ipaddrcache *cache, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag);
+extern int  libipaddrcache_store(s_ipaddrcache *cache, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag, const char *value);
@@ -0,0 +1,752 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipaddrset.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for large IPv4/6 prefix sets (e.g. bogon or block lists)
+ *   - path compressed binary radix tree per protocol, nodes stored in an array
+ *   - each prefix can carry several entries with accepted length range (ge/le)
+ *     and 'must have' or 'may not have' (negated) flag
+ *   - a lookup visits only nodes on the path of the address, independent of set size
+ *   - aggregation mode: covered prefixes are dropped and complete sibling pairs
+ *     are merged on insert, memory is bounded by the size of the result,
+ *     prefixes are inserted in sorted batches for locality of tree accesses
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "libipaddrset.h"
+
+
+/*
+ * get bit of address (0 = MSB)
+ */
+static int libipaddrset_bit(const uint32_t *addr, const int bit) {
+	return((addr[bit >> 5] >> (31 - (bit & 31))) & 1);
+};
+
+
+/*
+ * amount of leading bits equal in both addresses, limited by maxlength
+ */
+static int libipaddrset_common_length(const uint32_t *addr1, const uint32_t *addr2, const int maxlength) {
+	int i, length = 0;
+	uint32_t diff;
+
+	for (i = 0; i < 4 && length < maxlength; i++) {
+		diff = addr1[i] ^ addr2[i];
+		if (diff == 0) {
+			length += 32;
+			continue;
+		};
+
+#ifdef __GNUC__
+		length += __builtin_clz(diff);
+#else
+		while ((diff & 0x80000000u) == 0) {
+			diff <<= 1;
+			length++;
+		};
+#endif
+		break;
+	};
+
+	return((length < maxlength) ? length : maxlength);
+};
+
+
+/*
+ * copy address and clear bits behind length
+ */
+static void libipaddrset_mask(uint32_t *dst, const uint32_t *src, const int length) {
+	int i, bits;
+
+	for (i = 0; i < 4; i++) {
+		bits = length - (i * 32);
+		if (bits >= 32) {
+			dst[i] = src[i];
+		} else if (bits <= 0) {
+			dst[i] = 0;
+		} else {
+			dst[i] = src[i] & (0xffffffffu << (32 - bits));
+		};
+	};
+};
+
+
+/*
+ * create new node
+ * ret: index of node, IPADDRSET_NONE: out of memory
+ */
+static uint32_t libipaddrset_node_new(s_ipaddrset_tree *tree, const uint32_t *addr, const int length) {
+	s_ipaddrset_node *nodes;
+	uint32_t n, size;
+
+	if (tree->free != IPADDRSET_NONE) {
+		/* reuse released node */
+		n = tree->free;
+		tree->free = tree->nodes[n].child[0];
+		goto END_libipaddrset_node_new;
+	};
+
+	if (tree->nodes_used == tree->nodes_size) {
+		size = (tree->nodes_size == 0) ? 1024 : tree->nodes_size * 2;
+		nodes = realloc(tree->nodes, sizeof(s_ipaddrset_node) * size);
+		if (nodes == NULL) {
+			ERRORPRINT_WA("can't allocate memory for prefix set nodes: %u", size);
+			return(IPADDRSET_NONE);
+		};
+		tree->nodes = nodes;
+		tree->nodes_size = size;
+	};
+
+	n = tree->nodes_used++;
+
+END_libipaddrset_node_new:
+	nodes = &tree->nodes[n];
+	libipaddrset_mask(nodes->addr, addr, length);
+	nodes->child[0] = IPADDRSET_NONE;
+	nodes->child[1] = IPADDRSET_NONE;
+	nodes->entry = IPADDRSET_NONE;
+	nodes->length = (uint8_t) length;
+	nodes->flags = 0;
+
+	return(n);
+};
+
+
+/*
+ * release children (and their subtrees) of node into free list
+ */
+static void libipaddrset_node_prune(s_ipaddrset_tree *tree, const uint32_t n) {
+	uint32_t child;
+	int c;
+
+	for (c = 0; c < 2; c++) {
+		child = tree->nodes[n].child[c];
+		if (child == IPADDRSET_NONE) {
+			continue;
+		};
+
+		/* recursion depth is limited by prefix length */
+		libipaddrset_node_prune(tree, child);
+
+		tree->nodes[child].child[0] = tree->free;
+		tree->nodes[child].child[1] = IPADDRSET_NONE;
+		tree->free = child;
+		tree->nodes[n].child[c] = IPADDRSET_NONE;
+	};
+};
+
+
+/*
+ * find or insert node for prefix
+ *  optional (aggregation): stop at aggregated node covering the prefix,
+ *  store ancestors of returned node in path
+ * ret: index of node, IPADDRSET_NONE: out of memory, IPADDRSET_COVERED: covered
+ */
+static uint32_t libipaddrset_node_insert(s_ipaddrset_tree *tree, const uint32_t *addr, const int length, uint32_t *path, int *depthp) {
+	uint32_t n, parent = IPADDRSET_NONE, leaf, inner;
+	int parent_bit = 0, common;
+
+	n = tree->root;
+
+	while (n != IPADDRSET_NONE) {
+		common = libipaddrset_common_length(addr, tree->nodes[n].addr, (length < tree->nodes[n].length) ? length : tree->nodes[n].length);
+
+		if ((path != NULL) && (common == tree->nodes[n].length) && ((tree->nodes[n].flags & IPADDRSET_NODE_AGGREGATED) != 0)) {
+			return(IPADDRSET_COVERED);
+		};
+
+		if (common < tree->nodes[n].length) {
+			/* prefix diverges inside of node, split */
+			if (common == length) {
+				/* new node becomes parent of existing node */
+				leaf = libipaddrset_node_new(tree, addr, length);
+				if (leaf == IPADDRSET_NONE) {
+					return(IPADDRSET_NONE);
+				};
+				tree->nodes[leaf].child[libipaddrset_bit(tree->nodes[n].addr, length)] = n;
+			} else {
+				/* new inner node with existing and new node as children */
+				inner = libipaddrset_node_new(tree, addr, common);
+				if (inner == IPADDRSET_NONE) {
+					return(IPADDRSET_NONE);
+				};
+				leaf = libipaddrset_node_new(tree, addr, length);
+				if (leaf == IPADDRSET_NONE) {
+					return(IPADDRSET_NONE);
+				};
+				tree->nodes[inner].child[libipaddrset_bit(tree->nodes[n].addr, common)] = n;
+				tree->nodes[inner].child[libipaddrset_bit(addr, common)] = leaf;
+				n = inner;
+				if (path != NULL) {
+					path[(*depthp)++] = inner;
+				};
+			};
+
+			if (parent == IPADDRSET_NONE) {
+				tree->root = (common == length) ? leaf : n;
+			} else {
+				tree->nodes[parent].child[parent_bit] = (common == length) ? leaf : n;
+			};
+			return(leaf);
+		};
+
+		if (length == tree->nodes[n].length) {
+			/* existing node */
+			return(n);
+		};
+
+		parent = n;
+		parent_bit = libipaddrset_bit(addr, tree->nodes[n].length);
+		n = tree->nodes[n].child[parent_bit];
+		if (path != NULL) {
+			path[(*depthp)++] = parent;
+		};
+	};
+
+	leaf = libipaddrset_node_new(tree, addr, length);
+	if (leaf == IPADDRSET_NONE) {
+		return(IPADDRSET_NONE);
+	};
+
+	if (parent == IPADDRSET_NONE) {
+		tree->root = leaf;
+	} else {
+		tree->nodes[parent].child[parent_bit] = leaf;
+	};
+	return(leaf);
+};
+
+
+/*
+ * initialize prefix set
+ *
+ * mod: set
+ */
+void libipaddrset_init(s_ipaddrset *set) {
+	int t;
+
+	for (t = 0; t < 2; t++) {
+		set->tree[t].root = IPADDRSET_NONE;
+		set->tree[t].nodes_used = 0;
+		set->tree[t].nodes_size = 0;
+		set->tree[t].free = IPADDRSET_NONE;
+		set->tree[t].nodes = NULL;
+		set->tree[t].must_have = 0;
+		set->tree[t].may_not_have = 0;
+		set->tree[t].pending_used = 0;
+		set->tree[t].pending = NULL;
+	};
+
+	set->entries_used = 0;
+	set->entries_size = 0;
+	set->entries = NULL;
+};
+
+
+/*
+ * release memory of prefix set
+ *
+ * mod: set
+ */
+void libipaddrset_cleanup(s_ipaddrset *set) {
+	int t;
+
+	for (t = 0; t < 2; t++) {
+		if (set->tree[t].nodes != NULL) {
+			free(set->tree[t].nodes);
+		};
+		if (set->tree[t].pending != NULL) {
+			free(set->tree[t].pending);
+		};
+	};
+
+	if (set->entries != NULL) {
+		free(set->entries);
+	};
+
+	libipaddrset_init(set);
+};
+
+
+/*
+ * add prefix to set
+ *
+ * in : ipaddrp = prefix (bits behind length are ignored)
+ * in : length  = prefix length
+ * in : ge, le  = accepted prefix length range of tested address
+ * in : flags   = IPADDRSET_FLAG_*
+ * mod: set
+ * ret: 0=ok, 1=invalid length range, -1=can't allocate memory
+ */
+int libipaddrset_add(s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length, const int ge, const int le, const uint8_t flags) {
+	s_ipaddrset_tree *tree;
+	s_ipaddrset_entry *entries;
+	uint32_t n, e, size;
+	int maxlength;
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		tree = &set->tree[IPADDRSET_TREE_IPV4];
+		maxlength = 32;
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		tree = &set->tree[IPADDRSET_TREE_IPV6];
+		maxlength = 128;
+	} else {
+		ERRORPRINT_WA("unsupported protocol (FIX CODE): %d", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+	};
+
+	if ((length < 0) || (length > maxlength) || (ge < length) || (le < ge) || (le > maxlength)) {
+		return(1);
+	};
+
+	if (set->entries_used == set->entries_size) {
+		size = (set->entries_size == 0) ? 1024 : set->entries_size * 2;
+		entries = realloc(set->entries, sizeof(s_ipaddrset_entry) * size);
+		if (entries == NULL) {
+			ERRORPRINT_WA("can't allocate memory for prefix set entries: %u", size);
+			return(-1);
+		};
+		set->entries = entries;
+		set->entries_size = size;
+	};
+
+	n = libipaddrset_node_insert(tree, ipaddrp->addr, length, NULL, NULL);
+	if (n == IPADDRSET_NONE) {
+		return(-1);
+	};
+
+	e = set->entries_used++;
+	set->entries[e].ge = (uint8_t) ge;
+	set->entries[e].le = (uint8_t) le;
+	set->entries[e].flags = flags;
+	set->entries[e].next = tree->nodes[n].entry;
+	tree->nodes[n].entry = e;
+
+	if ((flags & IPADDRSET_FLAG_MAY_NOT_HAVE) != 0) {
+		tree->may_not_have++;
+	} else {
+		tree->must_have++;
+	};
+
+	return(0);
+};
+
+
+/*
+ * load prefix set from file (plain, gzip or zstd compressed)
+ *
+ * one entry per line, empty lines and lines starting with '#' are skipped:
+ *   [^]<IPv4|IPv6 address>[/<prefix length>] [ge <length>] [le <length>]
+ *  without ge/le each address inside of the prefix matches
+ *  with    ge/le the (prefix) length of the tested address must be in range
+ *  '^' marks a 'may not have' entry
+ *
+ * in : filename
+ * mod: set
+ * ret: 0=ok, 1=error
+ */
+int libipaddrset_load(s_ipaddrset *set, const char *filename) {
+	int fd, result = 1, r, length, ge, le, maxlength, linecounter = 0;
+	uint8_t flags;
+	uint32_t inputtype;
+	long int number;
+	char *line, *token, *value, *cptr, *endptr, resultstring[NI_MAXHOST];
+	s_linereader reader;
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipaddr ipaddr;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Load prefix set from file: %s", filename);
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		ERRORPRINT_WA("can't open prefix set file: %s", filename);
+		return(1);
+	};
+
+	if (liblinereader_open(&reader, fd) != 0) {
+		close(fd);
+		return(1);
+	};
+
+	while ((line = liblinereader_getline(&reader, IPADDRSET_LINE_MAX, NULL)) != NULL) {
+		linecounter++;
+
+		/* skip leading spaces, stop at comment */
+		token = strtok_r(line, " \t\r\n", &cptr);
+		if ((token == NULL) || (token[0] == '#')) {
+			continue;
+		};
+
+		flags = 0;
+		if (token[0] == '^') {
+			flags |= IPADDRSET_FLAG_MAY_NOT_HAVE;
+			token++;
+		};
+
+		inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+		if (inputtype == FORMAT_auto_noresult) {
+			inputtype = libipv6calc_autodetectinput(token);
+
+			r = 1;
+			if (inputtype == FORMAT_ipv4addr) {
+				r = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			} else if (inputtype == FORMAT_ipv6addr) {
+				r = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			} else {
+				snprintf(resultstring, sizeof(resultstring), "no IPv4/IPv6 address: %s", token);
+			};
+
+			if (r != 0) {
+				ERRORPRINT_WA("error in prefix set file %s line %d: %s", filename, linecounter, resultstring);
+				goto END_libipaddrset_load;
+			};
+		};
+
+		if (inputtype == FORMAT_ipv4addr) {
+			CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, ipaddr);
+			length = (ipv4addr.flag_prefixuse == 1) ? ipv4addr.prefixlength : 32;
+			maxlength = 32;
+		} else {
+			if (ipv6addr.flag_scopeid == 1) {
+				ERRORPRINT_WA("error in prefix set file %s line %d: scope ID not supported: %s", filename, linecounter, token);
+				goto END_libipaddrset_load;
+			};
+			CONVERT_IPV6ADDRP_IPADDR(&ipv6addr, ipaddr);
+			length = (ipv6addr.flag_prefixuse == 1) ? ipv6addr.prefixlength : 128;
+			maxlength = 128;
+		};
+
+		ge = length;
+		le = maxlength;
+
+		/* optional length range */
+		while ((token = strtok_r(NULL, " \t\r\n", &cptr)) != NULL) {
+			if (token[0] == '#') {
+				break;
+			};
+
+			value = strtok_r(NULL, " \t\r\n", &cptr);
+			if ((value == NULL) || (isdigit((int) value[0]) == 0)) {
+				ERRORPRINT_WA("error in prefix set file %s line %d: missing length behind: %s", filename, linecounter, token);
+				goto END_libipaddrset_load;
+			};
+
+			number = strtol(value, &endptr, 10);
+			if ((*endptr != '\0') || (number > maxlength)) {
+				ERRORPRINT_WA("error in prefix set file %s line %d: invalid length behind %s: %s", filename, linecounter, token, value);
+				goto END_libipaddrset_load;
+			};
+
+			if (strcmp(token, "ge") == 0) {
+				ge = (int) number;
+			} else if (strcmp(token, "le") == 0) {
+				le = (int) number;
+			} else {
+				ERRORPRINT_WA("error in prefix set file %s line %d: unsupported keyword: %s", filename, linecounter, token);
+				goto END_libipaddrset_load;
+			};
+		};
+
+		r = libipaddrset_add(set, &ipaddr, length, ge, le, flags);
+		if (r < 0) {
+			ERRORPRINT_WA("error in prefix set file %s line %d: can't add entry", filename, linecounter);
+			goto END_libipaddrset_load;
+		} else if (r > 0) {
+			ERRORPRINT_WA("error in prefix set file %s line %d: invalid length range (length=%d ge=%d le=%d)", filename, linecounter, length, ge, le);
+			goto END_libipaddrset_load;
+		};
+	};
+
+	if (reader.error != 0) {
+		ERRORPRINT_WA("error reading prefix set file: %s", filename);
+		goto END_libipaddrset_load;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Loaded prefix set from file: %s (entries=%u nodes IPv4=%u IPv6=%u)", filename, set->entries_used, set->tree[IPADDRSET_TREE_IPV4].nodes_used, set->tree[IPADDRSET_TREE_IPV6].nodes_used);
+	result = 0;
+
+END_libipaddrset_load:
+	liblinereader_close(&reader);
+	close(fd);
+	return(result);
+};
+
+
+/*
+ * check whether prefix set contains entries for protocol
+ *
+ * in : proto = IPV6CALC_PROTO_IPV4|IPV6CALC_PROTO_IPV6
+ * ret: 1=yes, 0=no
+ */
+int libipaddrset_active(const s_ipaddrset *set, const uint8_t proto) {
+	const s_ipaddrset_tree *tree = &set->tree[(proto == IPV6CALC_PROTO_IPV4) ? IPADDRSET_TREE_IPV4 : IPADDRSET_TREE_IPV6];
+
+	return(((tree->must_have + tree->may_not_have) > 0) ? 1 : 0);
+};
+
+
+/*
+ * match address against prefix set
+ *  match: at least one 'must have' entry (if any exists) and no 'may not have' entry covers the address
+ *
+ * in : ipaddrp = address
+ * in : length  = prefix length of address (32/128 for a single address)
+ * ret: 0=match, 1=no match
+ */
+int libipaddrset_match(const s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length) {
+	const s_ipaddrset_tree *tree;
+	const s_ipaddrset_node *node;
+	uint32_t n, e, addr[4];
+	int must_have = 0;
+
+	tree = &set->tree[(ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? IPADDRSET_TREE_IPV4 : IPADDRSET_TREE_IPV6];
+
+	if (tree->must_have == 0) {
+		must_have = 1;
+	};
+
+	libipaddrset_mask(addr, ipaddrp->addr, length);
+
+	n = tree->root;
+	while (n != IPADDRSET_NONE) {
+		node = &tree->nodes[n];
+
+		if ((node->length > length) || (libipaddrset_common_length(addr, node->addr, node->length) < node->length)) {
+			break;
+		};
+
+		for (e = node->entry; e != IPADDRSET_NONE; e = set->entries[e].next) {
+			if ((length < set->entries[e].ge) || (length > set->entries[e].le)) {
+				continue;
+			};
+
+			if ((set->entries[e].flags & IPADDRSET_FLAG_MAY_NOT_HAVE) != 0) {
+				DEBUGPRINT_WA(DEBUG_libipv6calc, "address matches 'may not have' prefix with length %u", (unsigned int) node->length);
+				return(1);
+			};
+			must_have = 1;
+		};
+
+		if ((must_have == 1) && (tree->may_not_have == 0)) {
+			/* result can't change anymore */
+			break;
+		};
+
+		if (node->length >= length) {
+			break;
+		};
+
+		n = node->child[libipaddrset_bit(addr, node->length)];
+	};
+
+	return((must_have == 1) ? 0 : 1);
+};
+
+
+/*
+ * insert prefix into aggregation tree
+ *  prefixes covered by an already aggregated one are dropped, an inserted prefix
+ *  replaces covered ones and is merged with its sibling into the parent
+ *  prefix as long as both are completely covered
+ *
+ * ret: 0=ok, 1=error
+ */
+static int libipaddrset_aggregate_insert(s_ipaddrset_tree *tree, const uint32_t *addr, const int length) {
+	uint32_t n, p, c0, c1, path[129];
+	int depth = 0;
+
+	n = libipaddrset_node_insert(tree, addr, length, path, &depth);
+	if (n == IPADDRSET_COVERED) {
+		return(0);
+	} else if (n == IPADDRSET_NONE) {
+		return(1);
+	};
+
+	tree->nodes[n].flags |= IPADDRSET_NODE_AGGREGATED;
+	libipaddrset_node_prune(tree, n);
+
+	/* merge complete sibling pairs upwards */
+	while (depth > 0) {
+		p = path[--depth];
+		c0 = tree->nodes[p].child[0];
+		c1 = tree->nodes[p].child[1];
+
+		if ((c0 == IPADDRSET_NONE) || (c1 == IPADDRSET_NONE)) {
+			break;
+		};
+
+		if (((tree->nodes[c0].flags & tree->nodes[c1].flags & IPADDRSET_NODE_AGGREGATED) == 0)
+		    || (tree->nodes[c0].length != tree->nodes[p].length + 1)
+		    || (tree->nodes[c1].length != tree->nodes[p].length + 1)) {
+			break;
+		};
+
+		tree->nodes[p].flags |= IPADDRSET_NODE_AGGREGATED;
+		libipaddrset_node_prune(tree, p);
+	};
+
+	return(0);
+};
+
+
+/*
+ * sort order of buffered prefixes: address, then length (covering prefix first)
+ */
+static int libipaddrset_prefix_cmp(const void *p1, const void *p2) {
+	const s_ipaddrset_prefix *a = p1, *b = p2;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		if (a->addr[i] != b->addr[i]) {
+			return((a->addr[i] < b->addr[i]) ? -1 : 1);
+		};
+	};
+
+	return((a->length < b->length) ? -1 : ((a->length > b->length) ? 1 : 0));
+};
+
+
+/*
+ * insert buffered prefixes into aggregation tree
+ *
+ * ret: 0=ok, 1=error
+ */
+static int libipaddrset_aggregate_flush(s_ipaddrset_tree *tree) {
+	uint32_t i;
+
+	if (tree->pending_used == 0) {
+		return(0);
+	};
+
+	qsort(tree->pending, tree->pending_used, sizeof(s_ipaddrset_prefix), libipaddrset_prefix_cmp);
+
+	for (i = 0; i < tree->pending_used; i++) {
+		if ((i > 0) && (libipaddrset_prefix_cmp(&tree->pending[i - 1], &tree->pending[i]) == 0)) {
+			/* duplicate */
+			continue;
+		};
+
+		if (libipaddrset_aggregate_insert(tree, tree->pending[i].addr, tree->pending[i].length) != 0) {
+			return(1);
+		};
+	};
+
+	tree->pending_used = 0;
+	return(0);
+};
+
+
+/*
+ * add prefix to aggregation set
+ *
+ * in : ipaddrp = prefix (bits behind length are ignored)
+ * in : length  = prefix length
+ * mod: set
+ * ret: 0=ok, 1=error
+ */
+int libipaddrset_aggregate_add(s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length) {
+	s_ipaddrset_tree *tree;
+	int maxlength;
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		tree = &set->tree[IPADDRSET_TREE_IPV4];
+		maxlength = 32;
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		tree = &set->tree[IPADDRSET_TREE_IPV6];
+		maxlength = 128;
+	} else {
+		ERRORPRINT_WA("unsupported protocol (FIX CODE): %d", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+	};
+
+	if ((length < 0) || (length > maxlength)) {
+		return(1);
+	};
+
+	if (tree->pending == NULL) {
+		tree->pending = malloc(sizeof(s_ipaddrset_prefix) * IPADDRSET_AGGREGATE_BATCH);
+		if (tree->pending == NULL) {
+			ERRORPRINT_WA("can't allocate memory for aggregation buffer: %d", IPADDRSET_AGGREGATE_BATCH);
+			return(1);
+		};
+	};
+
+	libipaddrset_mask(tree->pending[tree->pending_used].addr, ipaddrp->addr, length);
+	tree->pending[tree->pending_used].length = (uint32_t) length;
+	tree->pending_used++;
+
+	if (tree->pending_used == IPADDRSET_AGGREGATE_BATCH) {
+		return(libipaddrset_aggregate_flush(tree));
+	};
+
+	return(0);
+};
+
+
+/*
+ * walk through aggregated prefixes of subtree in ascending order
+ */
+static void libipaddrset_aggregate_walk_node(const s_ipaddrset_tree *tree, const uint32_t n, const uint8_t proto, void (*func)(const ipv6calc_ipaddr *ipaddrp, const int length, void *data), void *data) {
+	const s_ipaddrset_node *node = &tree->nodes[n];
+	ipv6calc_ipaddr ipaddr;
+	int i;
+
+	if ((node->flags & IPADDRSET_NODE_AGGREGATED) != 0) {
+		for (i = 0; i < 4; i++) {
+			ipaddr.addr[i] = node->addr[i];
+		};
+		ipaddr.scope = 0;
+		ipaddr.proto = proto;
+		ipaddr.flag_valid = 1;
+		ipaddr.typeinfo1 = 0;
+		ipaddr.typeinfo2 = 0;
+
+		(*func)(&ipaddr, node->length, data);
+		return;
+	};
+
+	for (i = 0; i < 2; i++) {
+		if (node->child[i] != IPADDRSET_NONE) {
+			libipaddrset_aggregate_walk_node(tree, node->child[i], proto, func, data);
+		};
+	};
+};
+
+
+/*
+ * call function for each prefix of aggregation set in ascending order
+ *
+ * in : proto = IPV6CALC_PROTO_IPV4|IPV6CALC_PROTO_IPV6
+ * in : func  = function called with prefix and its length
+ * in : data  = passed to function
+ * mod: set (buffered prefixes are inserted)
+ * ret: 0=ok, 1=error
+ */
+int libipaddrset_aggregate_walk(s_ipaddrset *set, const uint8_t proto, void (*func)(const ipv6calc_ipaddr *ipaddrp, const int length, void *data), void *data) {
+	s_ipaddrset_tree *tree = &set->tree[(proto == IPV6CALC_PROTO_IPV4) ? IPADDRSET_TREE_IPV4 : IPADDRSET_TREE_IPV6];
+
+	if (libipaddrset_aggregate_flush(tree) != 0) {
+		return(1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "aggregation set nodes: %u", tree->nodes_used);
+
+	if (tree->root != IPADDRSET_NONE) {
+		libipaddrset_aggregate_walk_node(tree, tree->root, proto, func, data);
+	};
+
+	return(0);
+};
@@ -0,0 +1,96 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipaddrset.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipaddrset.c
+ */
+
+#include "ipv6calc_inttypes.h"
+#include "libipaddr.h"
+
+
+#ifndef _libipaddrset_h
+
+#define _libipaddrset_h 1
+
+/* entry flags */
+#define IPADDRSET_FLAG_MAY_NOT_HAVE	0x01	/* negated entry ('^') */
+
+/* node flags */
+#define IPADDRSET_NODE_AGGREGATED	0x01	/* aggregation: prefix is completely covered */
+
+/* end of chain / no child marker */
+#define IPADDRSET_NONE			0xffffffffu
+
+/* aggregation: prefix covered by existing one */
+#define IPADDRSET_COVERED		0xfffffffeu
+
+/* tree index */
+#define IPADDRSET_TREE_IPV4		0
+#define IPADDRSET_TREE_IPV6		1
+
+/* aggregation: amount of prefixes buffered and sorted before insert */
+#define IPADDRSET_AGGREGATE_BATCH	262144
+
+/* maximum line length of a prefix set file */
+#define IPADDRSET_LINE_MAX		256
+
+/* node of path compressed binary radix tree */
+typedef struct {
+	uint32_t addr[4];	/* prefix, bits behind length are zero (IPv4: only addr[0] used) */
+	uint32_t child[2];	/* index of child node by next bit, IPADDRSET_NONE: none */
+	uint32_t entry;		/* index of first entry, IPADDRSET_NONE: inner node only */
+	uint8_t  length;	/* prefix length */
+	uint8_t  flags;		/* IPADDRSET_NODE_* */
+} s_ipaddrset_node;
+
+/* entry, several entries of one prefix are chained */
+typedef struct {
+	uint32_t next;		/* next entry of same prefix */
+	uint8_t  ge;		/* minimum prefix length of tested address */
+	uint8_t  le;		/* maximum prefix length of tested address */
+	uint8_t  flags;		/* IPADDRSET_FLAG_* */
+} s_ipaddrset_entry;
+
+/* prefix buffered for aggregation */
+typedef struct {
+	uint32_t addr[4];	/* prefix, bits behind length are zero */
+	uint32_t length;	/* prefix length */
+} s_ipaddrset_prefix;
+
+/* tree per protocol */
+typedef struct {
+	uint32_t root;
+	uint32_t nodes_used;
+	uint32_t nodes_size;
+	uint32_t free;		/* first released node, chained by child[0] */
+	s_ipaddrset_node *nodes;
+	uint32_t must_have;	/* amount of 'must have' entries */
+	uint32_t may_not_have;	/* amount of 'may not have' entries */
+	uint32_t pending_used;	/* aggregation: buffered prefixes not yet inserted */
+	s_ipaddrset_prefix *pending;
+} s_ipaddrset_tree;
+
+/* prefix set */
+typedef struct {
+	s_ipaddrset_tree tree[2];	/* IPADDRSET_TREE_* */
+	uint32_t entries_used;
+	uint32_t entries_size;
+	s_ipaddrset_entry *entries;
+} s_ipaddrset;
+
+#endif
+
+
+extern void libipaddrset_init(s_ipaddrset *set);
+extern void libipaddrset_cleanup(s_ipaddrset *set);
+extern int  libipaddrset_add(s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length, const int ge, const int le, const uint8_t flags);
+extern int  libipaddrset_load(s_ipaddrset *set, const char *filename);
+extern int  libipaddrset_match(const s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length);
+extern int  libipaddrset_active(const s_ipaddrset *set, const uint8_t proto);
+
+extern int  libipaddrset_aggregate_add(s_ipaddrset *set, const ipv6calc_ipaddr *ipaddrp, const int length);
+extern int  libipaddrset_aggregate_walk(s_ipaddrset *set, const uint8_t proto, void (*func)(const ipv6calc_ipaddr *ipaddrp, const int length, void *data), void *data);
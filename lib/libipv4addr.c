@@ -693,7 +693,8 @@ int libipv4addr_to_reversestring(const ipv6calc_ipv4addr *ipv4addrp, char *resul
 	int retval = 1;
 	uint8_t octet;
 	int bit_start, bit_end, nbit;
-	char tempstring[NI_MAXHOST];
+	char tempstring[NI_MAXHOST], *p = tempstring;
+	const char *domain;
 	unsigned int noctet;
 	
 	if ( ((formatoptions & (FORMATOPTION_printprefix | FORMATOPTION_printsuffix | FORMATOPTION_printstart | FORMATOPTION_printend)) == 0 ) && ((*ipv4addrp).flag_prefixuse != 0) ) {
@@ -706,10 +707,8 @@ int libipv4addr_to_reversestring(const ipv6calc_ipv4addr *ipv4addrp, char *resul
 	
 	DEBUGPRINT_WA(DEBUG_libipv4addr, "start bit %d  end bit %d", bit_start, bit_end);
 
-	/* print out nibble format */
+	/* print out nibble format, each character is written once */
 	/* 31 is lowest bit, 0 is highest bit */
-	resultstring[0] = '\0';
-
 	for (nbit = bit_end - 1; nbit >= bit_start - 1; nbit = nbit - 8) {
 		/* calculate octet (8 bit) */
 		noctet = ( ((unsigned int) nbit) & 0x78) >> 3;
@@ -719,20 +718,25 @@ int libipv4addr_to_reversestring(const ipv6calc_ipv4addr *ipv4addrp, char *resul
 		
 		DEBUGPRINT_WA(DEBUG_libipv4addr, "bit: %d = noctet: %u, value: %x", nbit, noctet, (unsigned int) octet);
 
-		snprintf(tempstring, sizeof(tempstring), "%s%u", resultstring, (unsigned int) octet);
-		snprintf(resultstring, resultstring_length, "%s.", tempstring);
+		if (octet >= 100) {
+			*p++ = (char) ('0' + octet / 100);
+		};
+		if (octet >= 10) {
+			*p++ = (char) ('0' + (octet / 10) % 10);
+		};
+		*p++ = (char) ('0' + octet % 10);
+		*p++ = '.';
 	};
 
 	if (bit_start == 1) {
-		snprintf(tempstring, sizeof(tempstring), "%sin-addr.arpa.", resultstring);
+		for (domain = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? "IN-ADDR.ARPA." : "in-addr.arpa."; *domain != '\0'; domain++) {
+			*p++ = *domain;
+		};
 	};
+	*p = '\0';
 
 	snprintf(resultstring, resultstring_length, "%s", tempstring);
 
-	if ( (formatoptions & FORMATOPTION_printuppercase) != 0 ) {
-		string_to_upcase(resultstring);
-	};
-	
 	if ( (formatoptions & FORMATOPTION_printmirrored) != 0 ) {
 		string_to_reverse_dotted(resultstring, resultstring_length);
 	};
@@ -744,6 +748,92 @@ int libipv4addr_to_reversestring(const ipv6calc_ipv4addr *ipv4addrp, char *resul
 };
 
 
+/*
+ * bulk writer: reverse decimal format strings of all sub-prefixes of a prefix
+ *  octets above the first varying one and the domain are written once,
+ *  for each sub-prefix only the varying octets (backwards) in front of them
+ *
+ * in : *ipv4addrp = prefix (prefix length 32 if not given)
+ * in : length = length of sub-prefixes (dividable by 8)
+ * in : func = called for each string with its sub-prefix, data = passed to func
+ * ret: ==0: ok, !=0: error
+ */
+int libipv4addr_enumerate_reversestrings(const ipv6calc_ipv4addr *ipv4addrp, const int length, const uint32_t formatoptions, void (*func)(const char *name, const ipv6calc_ipv4addr *ipv4addrp, void *data), void *data) {
+	ipv6calc_ipv4addr ipv4addr;
+	uint32_t dword, count, i;
+	unsigned int octet;
+	int prefixlength, bit_var, nbit;
+	char name[NI_MAXHOST], *p, *suffix;
+	const char *domain;
+
+	prefixlength = ((*ipv4addrp).flag_prefixuse != 0) ? (int) (*ipv4addrp).prefixlength : 32;
+
+	if (((length & 0x7) != 0) || (length < prefixlength) || (length > 32) || ((length - prefixlength) > 31)) {
+		return(1);
+	};
+
+	dword = ipv4addr_getdword(ipv4addrp);
+	if (prefixlength == 0) {
+		dword = 0;
+	} else {
+		dword &= 0xffffffffu << (32 - prefixlength);
+	};
+
+	/* constant part behind the varying octets (max. 4 octets with 3 digits and '.') */
+	bit_var = prefixlength & ~0x7;
+	suffix = name + ((length - bit_var) / 8) * 4;
+	p = suffix;
+	for (nbit = bit_var - 8; nbit >= 0; nbit -= 8) {
+		octet = (dword >> (24 - nbit)) & 0xff;
+		if (octet >= 100) {
+			*p++ = (char) ('0' + octet / 100);
+		};
+		if (octet >= 10) {
+			*p++ = (char) ('0' + (octet / 10) % 10);
+		};
+		*p++ = (char) ('0' + octet % 10);
+		*p++ = '.';
+	};
+	for (domain = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? "IN-ADDR.ARPA." : "in-addr.arpa."; *domain != '\0'; domain++) {
+		*p++ = *domain;
+	};
+	*p = '\0';
+
+	ipv4addr_clearall(&ipv4addr);
+	ipv4addr.prefixlength = (uint8_t) length;
+	ipv4addr.flag_prefixuse = 1;
+	ipv4addr.flag_valid = 1;
+
+	count = 1u << (length - prefixlength);
+
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "enumerate %u sub-prefixes with length %d", (unsigned int) count, length);
+
+	for (i = 0; i < count; i++) {
+		if (i > 0) {
+			/* next sub-prefix */
+			dword += 1u << (32 - length);
+		};
+
+		/* varying octets, written backwards in front of constant part */
+		p = suffix;
+		for (nbit = bit_var; nbit < length; nbit += 8) {
+			octet = (dword >> (24 - nbit)) & 0xff;
+			*--p = '.';
+			do {
+				*--p = (char) ('0' + octet % 10);
+				octet /= 10;
+			} while (octet > 0);
+		};
+
+		ipv4addr_setdword(&ipv4addr, dword);
+
+		(*func)(p, &ipv4addr, data);
+	};
+
+	return(0);
+};
+
+
 /*
  * function prints an IPv4 address in native octal format
  *
@@ -842,6 +932,7 @@ int libipv4addr_anonymize(ipv6calc_ipv4addr *ipv4addrp, unsigned int mask, const
 	uint32_t as_num32, as_num32_comp17, as_num32_decomp17, ipv4addr_anon, p;
 	uint16_t cc_index, c;
 	ipv6calc_ipaddr ipaddr;
+	s_ipv6calc_db_lookup_all lookup_all;
 	int i;
 
 	ipv4addr_settype(ipv4addrp, 0); // set typeinfo if not already done
@@ -902,9 +993,14 @@ int libipv4addr_anonymize(ipv6calc_ipv4addr *ipv4addrp, unsigned int mask, const
 			as_num32_comp17 = 0x11800;
 			as_num32_comp17 |= (libipv6calc_db_wrapper_registry_num_by_ipv4addr(ipv4addrp) & 0x7) << 12;
 			as_num32_comp17 |= 0x000; // TODO: map LISP information into 11 LSB
+
+			// get countrycode
+			cc_index = libipv6calc_db_wrapper_cc_index_by_addr(&ipaddr, NULL);
 		} else {
-			// get AS number
-			as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr);
+			// get AS number and countrycode
+			libipv6calc_db_wrapper_lookup_all(&ipaddr, IPV6CALC_DB_LOOKUP_ALL_CC | IPV6CALC_DB_LOOKUP_ALL_AS, &lookup_all);
+			as_num32 = lookup_all.as_num32;
+			cc_index = lookup_all.cc_index;
 			DEBUGPRINT_WA(DEBUG_libipv4addr, "result of AS number  retrievement: 0x%08x (%d)", as_num32, as_num32);
 
 			as_num32_comp17 = libipv6calc_db_wrapper_as_num32_comp17(as_num32);
@@ -914,8 +1010,6 @@ int libipv4addr_anonymize(ipv6calc_ipv4addr *ipv4addrp, unsigned int mask, const
 			DEBUGPRINT_WA(DEBUG_libipv4addr, "result of AS number decompression: 0x%08x (%d)", as_num32_decomp17, as_num32_decomp17);
 		};
 
-		// get countrycode
-		cc_index = libipv6calc_db_wrapper_cc_index_by_addr(&ipaddr, NULL);
 		if (cc_index == COUNTRYCODE_INDEX_UNKNOWN) {
 			// on unknown country, map registry value
 			cc_index = COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN + libipv6calc_db_wrapper_registry_num_by_ipv4addr(ipv4addrp);
@@ -1006,6 +1100,7 @@ void ipv4addr_filter_clear(s_ipv6calc_filter_ipv4addr *filter) {
         filter->filter_addr.active = 0;
         filter->filter_addr.addr_must_have_max = 0;
         filter->filter_addr.addr_may_not_have_max = 0;
+        filter->filter_addr.addrset = NULL;
 
 	return;
 };
@@ -1266,6 +1361,9 @@ int ipv4addr_filter_check(const s_ipv6calc_filter_ipv4addr *filter) {
 				DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'addr/may_not_have'    : %s", resultstring);
 			};
 		};
+		if (filter->filter_addr.addrset != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'addr/prefix set'      : must_have=%u may_not_have=%u", filter->filter_addr.addrset->tree[IPADDRSET_TREE_IPV4].must_have, filter->filter_addr.addrset->tree[IPADDRSET_TREE_IPV4].may_not_have);
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'db.cc' active         : %d", filter->filter_db_cc.active);
@@ -1393,6 +1491,32 @@ int ipv4addr_filter(const ipv6calc_ipv4addr *ipv4addrp, const s_ipv6calc_filter_
 				result = 1;
 			};
 		};
+		if ((result == 0) && (filter->filter_addr.addrset != NULL)) {
+			ipv6calc_ipaddr ipaddr;
+
+			DEBUGPRINT_NA(DEBUG_libipv4addr, "compare against prefix set");
+			CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, ipaddr);
+			if (libipaddrset_match(filter->filter_addr.addrset, &ipaddr, (ipv4addrp->flag_prefixuse == 1) ? ipv4addrp->prefixlength : 32) != 0) {
+				/* no match */
+				result = 1;
+			};
+		};
+	};
+
+	/* database lookups only if cheap tests above already passed, cheapest first */
+	if (result != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv4addr, "no match, skip database lookups");
+		goto END_ipv4addr_filter;
+	};
+
+	if (filter->filter_db_registry.active > 0) {
+		int registry = libipv4addr_registry_num_by_addr(ipv4addrp);
+
+		if (libipv6calc_db_registry_filter(registry, &filter->filter_db_registry) > 0) {
+			/* no match */
+			result = 1;
+			goto END_ipv4addr_filter;
+		};
 	};
 
 	if (filter->filter_db_cc.active > 0) {
@@ -1401,31 +1525,20 @@ int ipv4addr_filter(const ipv6calc_ipv4addr *ipv4addrp, const s_ipv6calc_filter_
 		if (libipv6calc_db_cc_filter(cc_index, &filter->filter_db_cc) > 0) {
 			/* no match */
 			result = 1;
+			goto END_ipv4addr_filter;
 		};
 	};
 
 	if (filter->filter_db_asn.active > 0) {
 		uint32_t asn = libipv4addr_as_num32_by_addr(ipv4addrp);
 
-		if (filter->filter_db_asn.active > 0) {
-			if (libipv6calc_db_asn_filter(asn, &filter->filter_db_asn) > 0) {
-				/* no match */
-				result = 1;
-			};
-		};
-	};
-
-	if (filter->filter_db_registry.active > 0) {
-		int registry = libipv4addr_registry_num_by_addr(ipv4addrp);
-
-		if (filter->filter_db_registry.active > 0) {
-			if (libipv6calc_db_registry_filter(registry, &filter->filter_db_registry) > 0) {
-				/* no match */
-				result = 1;
-			};
+		if (libipv6calc_db_asn_filter(asn, &filter->filter_db_asn) > 0) {
+			/* no match */
+			result = 1;
 		};
 	};
 
+END_ipv4addr_filter:
 	return (result);
 };
 
@@ -10,6 +10,7 @@
  */ 
 
 #include "ipv6calctypes.h"
+#include "libipaddrset.h"
 #include <netinet/in.h>
 
 /* typedefs */
@@ -36,6 +37,7 @@ typedef struct {
         int addr_may_not_have_max;
         ipv6calc_ipv4addr ipv4addr_must_have[IPV6CALC_FILTER_IPV4ADDR];
         ipv6calc_ipv4addr ipv4addr_may_not_have[IPV6CALC_FILTER_IPV6ADDR];
+        const s_ipaddrset *addrset;	// prefix set loaded from file, NULL: none
 } s_ipv6calc_filter_addr_ipv4;
 
 /* IPv4 filter structure */
@@ -181,6 +183,7 @@ extern int addrhex_to_ipv4addrstruct(const char *addrstring, char *resultstring,
 extern int libipv4addr_ipv4addrstruct_to_string(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
 
 extern int libipv4addr_to_reversestring(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
+extern int libipv4addr_enumerate_reversestrings(const ipv6calc_ipv4addr *ipv4addrp, const int length, const uint32_t formatoptions, void (*func)(const char *name, const ipv6calc_ipv4addr *ipv4addrp, void *data), void *data);
 
 extern int libipv4addr_to_octal(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
 extern int libipv4addr_to_hex(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
@@ -2067,6 +2067,7 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 	ipv6calc_eui64addr eui64addr;
 	ipv6calc_ipv4addr  ipv4addr;
 	ipv6calc_ipaddr    ipaddr;
+	s_ipv6calc_db_lookup_all lookup_all;
 	uint32_t map_value;
 
 	uint16_t cc_index, flags;
@@ -2206,8 +2207,9 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 			} else {
 				CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
 
-				cc_index = libipv6calc_db_wrapper_cc_index_by_addr(&ipaddr, NULL);
-				as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr);
+				libipv6calc_db_wrapper_lookup_all(&ipaddr, IPV6CALC_DB_LOOKUP_ALL_CC | IPV6CALC_DB_LOOKUP_ALL_AS, &lookup_all);
+				cc_index = lookup_all.cc_index;
+				as_num32 = lookup_all.as_num32;
 
 				if (cc_index == COUNTRYCODE_INDEX_UNKNOWN) {
 					// on unknown country, map registry value
@@ -2607,6 +2609,7 @@ void ipv6addr_filter_clear(s_ipv6calc_filter_ipv6addr *filter) {
 	filter->filter_addr.active = 0;
 	filter->filter_addr.addr_must_have_max = 0;
 	filter->filter_addr.addr_may_not_have_max = 0;
+	filter->filter_addr.addrset = NULL;
 
 	return;
 };
@@ -2893,6 +2896,9 @@ int ipv6addr_filter_check(const s_ipv6calc_filter_ipv6addr *filter) {
 				DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'addr/may_not_have'     : %s", resultstring);
 			};
 		};
+		if (filter->filter_addr.addrset != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'addr/prefix set'       : must_have=%u may_not_have=%u", filter->filter_addr.addrset->tree[IPADDRSET_TREE_IPV6].must_have, filter->filter_addr.addrset->tree[IPADDRSET_TREE_IPV6].may_not_have);
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'db.cc' active          : %d", filter->filter_db_cc.active);
@@ -3043,35 +3049,54 @@ int ipv6addr_filter(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_filter_
 				result = 1;
 			};
 		};
+		if ((result == 0) && (filter->filter_addr.addrset != NULL)) {
+			ipv6calc_ipaddr ipaddr;
+
+			DEBUGPRINT_NA(DEBUG_libipv6addr, "compare against prefix set");
+			CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
+			if (libipaddrset_match(filter->filter_addr.addrset, &ipaddr, (ipv6addrp->flag_prefixuse == 1) ? ipv6addrp->prefixlength : 128) != 0) {
+				/* no match */
+				result = 1;
+			};
+		};
 	};
 
-	if (filter->filter_db_cc.active > 0) {
-		uint16_t cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, NULL);
+	/* database lookups only if cheap tests above already passed, cheapest first */
+	if (result != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6addr, "no match, skip database lookups");
+		goto END_ipv6addr_filter;
+	};
 
-		if (libipv6calc_db_cc_filter(cc_index, &filter->filter_db_cc) > 0) {
+	if (filter->filter_db_registry.active > 0) {
+		int registry = libipv6addr_registry_num_by_addr(ipv6addrp);
+
+		if (libipv6calc_db_registry_filter(registry, &filter->filter_db_registry) > 0) {
 			/* no match */
 			result = 1;
+			goto END_ipv6addr_filter;
 		};
 	};
 
-	if (filter->filter_db_asn.active > 0) {
-		uint32_t asn = libipv6addr_as_num32_by_addr(ipv6addrp);
+	if (filter->filter_db_cc.active > 0) {
+		uint16_t cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, NULL);
 
-		if (libipv6calc_db_asn_filter(asn, &filter->filter_db_asn) > 0) {
+		if (libipv6calc_db_cc_filter(cc_index, &filter->filter_db_cc) > 0) {
 			/* no match */
 			result = 1;
+			goto END_ipv6addr_filter;
 		};
 	};
 
-	if (filter->filter_db_registry.active > 0) {
-		int registry = libipv6addr_registry_num_by_addr(ipv6addrp);
+	if (filter->filter_db_asn.active > 0) {
+		uint32_t asn = libipv6addr_as_num32_by_addr(ipv6addrp);
 
-		if (libipv6calc_db_registry_filter(registry, &filter->filter_db_registry) > 0) {
+		if (libipv6calc_db_asn_filter(asn, &filter->filter_db_asn) > 0) {
 			/* no match */
 			result = 1;
 		};
 	};
 
+END_ipv6addr_filter:
 	return (result);
 };
 
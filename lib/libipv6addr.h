@@ -10,6 +10,7 @@
  */ 
 
 #include "ipv6calctypes.h"
+#include "libipaddrset.h"
 #include <netinet/in.h>
 #include <ctype.h>
 
@@ -189,6 +190,7 @@ typedef struct {
         int addr_may_not_have_max;
         ipv6calc_ipv6addr ipv6addr_must_have[IPV6CALC_FILTER_IPV4ADDR];
         ipv6calc_ipv6addr ipv6addr_may_not_have[IPV6CALC_FILTER_IPV6ADDR];
+        const s_ipaddrset *addrset;	// prefix set loaded from file, NULL: none
 } s_ipv6calc_filter_addr_ipv6;
 
 /* IPv6 filter structure */
@@ -413,6 +413,301 @@ END_libipv6calc_autodetectinput:
 	return (type);
 };
 
+/*
+ * value of a hex digit character plus 1, 0: no hex digit
+ *  (one table lookup per character instead of isdigit/isxdigit/isalnum)
+ */
+static const uint8_t libipv6calc_xdigit_table[256] = {
+	['0'] =  1, ['1'] =  2, ['2'] =  3, ['3'] =  4, ['4'] =  5,
+	['5'] =  6, ['6'] =  7, ['7'] =  8, ['8'] =  9, ['9'] = 10,
+	['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+	['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
+#define XDIGIT_VALUE(c)	(libipv6calc_xdigit_table[(uint8_t) (c)] - 1)
+#define IS_XDIGIT(c)	(libipv6calc_xdigit_table[(uint8_t) (c)] != 0)
+#define IS_DIGIT(c)	((c) >= '0' && (c) <= '9')
+
+
+/*
+ * parse dotted quad d{1-3}.d{1-3}.d{1-3}.d{1-3} (no prefix length)
+ * in : string
+ * out: value
+ * ret: pointer behind the parsed string, NULL: not valid
+ */
+static const char *libipv6calc_parse_dotted_quad_fast(const char *p, uint32_t *valuep) {
+	int o, d;
+	unsigned int octet;
+	uint32_t value = 0;
+
+	for (o = 0; o < 4; o++) {
+		if (o > 0) {
+			if (*p != '.') {
+				return(NULL);
+			};
+			p++;
+		};
+
+		octet = 0;
+		for (d = 0; d < 3 && IS_DIGIT(*p); d++, p++) {
+			octet = octet * 10 + (*p - '0');
+		};
+
+		if ((d == 0) || IS_DIGIT(*p) || (octet > 255)) {
+			return(NULL);
+		};
+
+		value = (value << 8) | octet;
+	};
+
+	*valuep = value;
+	return(p);
+};
+
+
+/*
+ * parse optional prefix length /d{1-maxdigits} up to end of string
+ * in : string, maximum number of digits, maximum value
+ * out: prefix length (-1: not given)
+ * ret: 0=ok, 1=not valid
+ */
+static int libipv6calc_parse_prefixlength_fast(const char *p, const int maxdigits, const int maxvalue, int *prefixlengthp) {
+	int d, value = 0;
+
+	*prefixlengthp = -1;
+
+	if (*p == '\0') {
+		return(0);
+	};
+
+	if (*p != '/') {
+		return(1);
+	};
+	p++;
+
+	for (d = 0; d < maxdigits && IS_DIGIT(*p); d++, p++) {
+		value = value * 10 + (*p - '0');
+	};
+
+	if ((d == 0) || (*p != '\0') || (value > maxvalue)) {
+		return(1);
+	};
+
+	*prefixlengthp = value;
+	return(0);
+};
+
+
+/*
+ * single pass detection and parsing of plain IPv4/IPv6 addresses
+ *  (fast path for the log tools, no copy of the input, no tokenizer)
+ *
+ * supported: d.d.d.d[/p], x:x:x:x:x:x:x:x[/p], compressed '::' and trailing dotted quad
+ * everything else (scope ID, EUI-64 look-alikes, errors) is left to
+ *  libipv6calc_autodetectinput and addr_to_ipv4addrstruct/addr_to_ipv6addrstruct
+ *
+ * in : string
+ * out: *ipv4addrp or *ipv6addrp filled
+ * ret: FORMAT_ipv4addr, FORMAT_ipv6addr, FORMAT_auto_noresult (not handled)
+ */
+uint32_t libipv6calc_parse_ipaddr_fast(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp) {
+	const char *p = string;
+	int i, d, n = 0, dc = -1, tail = 0, digits_max = 0, prefixlength;
+	unsigned int word;
+	uint16_t words[8];
+	uint32_t value;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Got input '%s'", string);
+
+	/* IPv4: starts with a decimal digit and has a dot within the first 4 chars */
+	if (IS_DIGIT(p[0]) && (p[1] == '.' || (IS_DIGIT(p[1]) && (p[2] == '.' || (IS_DIGIT(p[2]) && p[3] == '.'))))) {
+		p = libipv6calc_parse_dotted_quad_fast(p, &value);
+		if ((p == NULL) || (libipv6calc_parse_prefixlength_fast(p, 2, 32, &prefixlength) != 0)) {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+
+		ipv4addr_clearall(ipv4addrp);
+		if (prefixlength >= 0) {
+			ipv4addrp->flag_prefixuse = 1;
+			ipv4addrp->prefixlength = (uint8_t) prefixlength;
+		};
+		ipv4addr_setdword(ipv4addrp, value);
+		ipv4addrp->typeinfo = ipv4addr_gettype(ipv4addrp);
+		ipv4addrp->flag_valid = 1;
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc, "Fast path found IPv4 address: %08x", (unsigned int) value);
+		return(FORMAT_ipv4addr);
+	};
+
+	/* IPv6 */
+	if (p[0] == ':') {
+		if (p[1] != ':') {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+		dc = 0;
+		p += 2;
+	};
+
+	while ((*p != '\0') && (*p != '/')) {
+		if (n == 8) {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+
+		word = 0;
+		for (d = 0; d < 5 && IS_XDIGIT(p[d]); d++) {
+			word = (word << 4) | XDIGIT_VALUE(p[d]);
+		};
+
+		if (p[d] == '.') {
+			/* trailing dotted quad */
+			if (n > 6) {
+				goto END_libipv6calc_parse_ipaddr_fast;
+			};
+			p = libipv6calc_parse_dotted_quad_fast(p, &value);
+			if (p == NULL) {
+				goto END_libipv6calc_parse_ipaddr_fast;
+			};
+			words[n++] = (uint16_t) (value >> 16);
+			words[n++] = (uint16_t) (value & 0xffff);
+			tail = 1;
+			break;
+		};
+
+		if ((d == 0) || (d > 4)) {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+
+		if (d > digits_max) {
+			digits_max = d;
+		};
+
+		words[n++] = (uint16_t) word;
+		p += d;
+
+		if (*p == ':') {
+			if (p[1] == ':') {
+				if (dc >= 0) {
+					/* only one '::' allowed */
+					goto END_libipv6calc_parse_ipaddr_fast;
+				};
+				dc = n;
+				p += 2;
+			} else {
+				p++;
+				if ((*p == '\0') || (*p == '/')) {
+					/* trailing single ':' */
+					goto END_libipv6calc_parse_ipaddr_fast;
+				};
+			};
+		} else if ((*p != '\0') && (*p != '/')) {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+	};
+
+	if (libipv6calc_parse_prefixlength_fast(p, 3, 128, &prefixlength) != 0) {
+		goto END_libipv6calc_parse_ipaddr_fast;
+	};
+
+	if (dc < 0) {
+		if (n != 8) {
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+		if ((tail == 0) && (digits_max <= 2)) {
+			/* looks like EUI-64 xx:xx:xx:xx:xx:xx:xx:xx */
+			goto END_libipv6calc_parse_ipaddr_fast;
+		};
+	} else if (n > 7) {
+		goto END_libipv6calc_parse_ipaddr_fast;
+	};
+
+	ipv6addr_clearall(ipv6addrp);
+	if (prefixlength >= 0) {
+		ipv6addrp->flag_prefixuse = 1;
+		ipv6addrp->prefixlength = (uint8_t) prefixlength;
+	};
+
+	if (dc < 0) {
+		for (i = 0; i < 8; i++) {
+			ipv6addr_setword(ipv6addrp, (unsigned int) i, (unsigned int) words[i]);
+		};
+	} else {
+		/* words before '::' stay at the front, words behind move to the end */
+		for (i = 0; i < dc; i++) {
+			ipv6addr_setword(ipv6addrp, (unsigned int) i, (unsigned int) words[i]);
+		};
+		for (i = dc; i < n; i++) {
+			ipv6addr_setword(ipv6addrp, (unsigned int) (8 - n + i), (unsigned int) words[i]);
+		};
+	};
+
+	ipv6addr_settype(ipv6addrp, 1);
+	ipv6addrp->flag_valid = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Fast path found IPv6 address: %08x %08x %08x %08x", (unsigned int) ipv6addr_getdword(ipv6addrp, 0), (unsigned int) ipv6addr_getdword(ipv6addrp, 1), (unsigned int) ipv6addr_getdword(ipv6addrp, 2), (unsigned int) ipv6addr_getdword(ipv6addrp, 3));
+	return(FORMAT_ipv6addr);
+
+END_libipv6calc_parse_ipaddr_fast:
+	DEBUGPRINT_NA(DEBUG_libipv6calc, "Fast path not applicable");
+	return(FORMAT_auto_noresult);
+};
+
+
+/*
+ * collect IPv4 addresses of the first token of lines in a block of data
+ * (plain or included in an IPv6 address), e.g. for a batch lookup
+ *
+ * in : data/length = block, lines_max = maximum number of lines to scan
+ * mod: ipaddrs = collected addresses (at least lines_max entries), *nump = number of addresses
+ * ret: number of scanned lines (only complete lines, terminated by '\n' or NUL)
+ */
+int libipv6calc_collect_ipv4addrs(const char *data, const size_t length, const int lines_max, ipv6calc_ipaddr *ipaddrs, int *nump) {
+	const char *p = data, *end = data + length, *eol;
+	char token[64];
+	size_t token_length;
+	int lines = 0;
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t inputtype;
+
+	*nump = 0;
+
+	while ((p < end) && (lines < lines_max)) {
+		for (eol = p; (eol < end) && (*eol != '\n') && (*eol != '\0'); eol++);
+		if (eol == end) {
+			/* incomplete line */
+			break;
+		};
+		lines++;
+
+		/* first token, leading blanks are skipped like by strtok */
+		while ((p < eol) && ((*p == ' ') || (*p == '\t'))) {
+			p++;
+		};
+		for (token_length = 0; (p + token_length < eol) && (p[token_length] != ' ') && (p[token_length] != '\t'); token_length++);
+
+		if ((token_length > 0) && (token_length < sizeof(token))) {
+			memcpy(token, p, token_length);
+			token[token_length] = '\0';
+
+			inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+			if ((inputtype == FORMAT_ipv6addr) && ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0)) {
+				if (libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT) == 0) {
+					inputtype = FORMAT_ipv4addr;
+				};
+			};
+
+			if (inputtype == FORMAT_ipv4addr) {
+				CONVERT_IPV4ADDRP_IPADDR((&ipv4addr), ipaddrs[*nump]);
+				(*nump)++;
+			};
+		};
+
+		p = eol + 1;
+	};
+
+	return(lines);
+};
+
 
 /*
  * clear filter master structure
@@ -423,6 +718,7 @@ void libipv6calc_filter_clear(s_ipv6calc_filter_master *filter_master) {
 	ipv4addr_filter_clear(&filter_master->filter_ipv4addr);
 	ipv6addr_filter_clear(&filter_master->filter_ipv6addr);
         macaddr_filter_clear(&filter_master->filter_macaddr);
+	libipaddrset_init(&filter_master->filter_addrset);
 	return;
 };
 
@@ -438,7 +734,7 @@ void libipv6calc_filter_clear_db_cc(s_ipv6calc_filter_db_cc *filter_db_cc) {
 	filter_db_cc->cc_must_have_max = 0;
 	filter_db_cc->cc_may_not_have_max = 0;
 
-	for (i = 0; i < IPV6CALC_FILTER_DB_CC_MAX; i++) {
+	for (i = 0; i < IPV6CALC_FILTER_DB_CC_BITS / 32; i++) {
 		filter_db_cc->cc_must_have[i] = 0;
 		filter_db_cc->cc_may_not_have[i] = 0;
 	};
@@ -453,16 +749,13 @@ void libipv6calc_filter_clear_db_cc(s_ipv6calc_filter_db_cc *filter_db_cc) {
  * in : *filter    = filter structure
  */
 void libipv6calc_filter_clear_db_asn(s_ipv6calc_filter_db_asn *filter_db_asn) {
-	int i;
-
 	filter_db_asn->active = 0;
 	filter_db_asn->asn_must_have_max = 0;
 	filter_db_asn->asn_may_not_have_max = 0;
 
-	for (i = 0; i < IPV6CALC_FILTER_DB_ASN_MAX; i++) {
-		filter_db_asn->asn_must_have[i] = 0;
-		filter_db_asn->asn_may_not_have[i] = 0;
-	};
+	/* hash sets are allocated on first entry */
+	memset(&filter_db_asn->asn_must_have, 0, sizeof(filter_db_asn->asn_must_have));
+	memset(&filter_db_asn->asn_may_not_have, 0, sizeof(filter_db_asn->asn_may_not_have));
 
 	return;
 };
@@ -497,14 +790,19 @@ void libipv6calc_filter_clear_db_registry(s_ipv6calc_filter_db_registry *filter_
  * ret: success
  */
 int libipv6calc_filter_parse(const char *expression, s_ipv6calc_filter_master *filter_master) {
-	char tempstring[NI_MAXHOST] = "";
+	char *tempstring;
 	char *charptr, *cptr, **ptrptr;
 	ptrptr = &cptr;
 	int r, token_used, result = 0;
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc, "called with: %s", expression);
 
-	snprintf(tempstring, sizeof(tempstring), "%s", expression);
+	/* copy of expression without length limit (e.g. long ASN lists) */
+	tempstring = strdup(expression);
+	if (tempstring == NULL) {
+		ERRORPRINT_WA("can't allocate memory for filter expression: %lu", (unsigned long) strlen(expression));
+		return (1);
+	};
 
 	/* split expression */
 	charptr = strtok_r(tempstring, ",", ptrptr);
@@ -538,10 +836,103 @@ int libipv6calc_filter_parse(const char *expression, s_ipv6calc_filter_master *f
 		charptr = strtok_r(NULL, ",", ptrptr);
 	};
 
+	free(tempstring);
+
 	return (result);
 };
 
 
+/*
+ * function loads prefix set file (see libipaddrset_load) into filter
+ *  IPv4/IPv6 address filter are activated for protocols with entries in the file
+ *
+ * in : filename
+ * mod: master filter structure
+ * ret: success
+ */
+int libipv6calc_filter_file(const char *filename, s_ipv6calc_filter_master *filter_master) {
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "called with: %s", filename);
+
+	if (libipaddrset_load(&filter_master->filter_addrset, filename) != 0) {
+		return (1);
+	};
+
+	if (libipaddrset_active(&filter_master->filter_addrset, IPV6CALC_PROTO_IPV4) == 1) {
+		filter_master->filter_ipv4addr.filter_addr.addrset = &filter_master->filter_addrset;
+		filter_master->filter_ipv4addr.filter_addr.active = 1;
+		filter_master->filter_ipv4addr.active = 1;
+	};
+
+	if (libipaddrset_active(&filter_master->filter_addrset, IPV6CALC_PROTO_IPV6) == 1) {
+		filter_master->filter_ipv6addr.filter_addr.addrset = &filter_master->filter_addrset;
+		filter_master->filter_ipv6addr.filter_addr.active = 1;
+		filter_master->filter_ipv6addr.active = 1;
+	};
+
+	return (0);
+};
+
+
+/*
+ * function matches an IPv4/IPv6 address against a prefix set
+ *
+ * in : set       = prefix set (loaded by libipaddrset_load)
+ * in : inputtype = FORMAT_ipv4addr|FORMAT_ipv6addr
+ * in : ipv4addrp/ipv6addrp = address related to inputtype
+ * ret: 0=match, 1=no match (also in case the set contains no entry for the protocol)
+ */
+int libipv6calc_filter_addrset(const s_ipaddrset *set, const uint32_t inputtype, const ipv6calc_ipv4addr *ipv4addrp, const ipv6calc_ipv6addr *ipv6addrp) {
+	ipv6calc_ipaddr ipaddr;
+
+	if ((inputtype == FORMAT_ipv4addr) && (libipaddrset_active(set, IPV6CALC_PROTO_IPV4) == 1)) {
+		CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, ipaddr);
+		return(libipaddrset_match(set, &ipaddr, (ipv4addrp->flag_prefixuse == 1) ? ipv4addrp->prefixlength : 32));
+	} else if ((inputtype == FORMAT_ipv6addr) && (libipaddrset_active(set, IPV6CALC_PROTO_IPV6) == 1)) {
+		CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
+		return(libipaddrset_match(set, &ipaddr, (ipv6addrp->flag_prefixuse == 1) ? ipv6addrp->prefixlength : 128));
+	};
+
+	return(1);
+};
+
+
+/*
+ * function matches an IPv4/IPv6 address token against a prefix set
+ *
+ * in : set   = prefix set (loaded by libipaddrset_load)
+ * in : token = address string
+ * ret: 0=match, 1=no match (also in case token is not an IPv4/IPv6 address)
+ */
+int libipv6calc_filter_addrset_token(const s_ipaddrset *set, const char *token) {
+	char resultstring[NI_MAXHOST];
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t inputtype;
+	int retval = 1;
+
+	ipv4addr.flag_valid = 0;
+	ipv6addr.flag_valid = 0;
+
+	inputtype = libipv6calc_parse_ipaddr_fast(token, &ipv4addr, &ipv6addr);
+
+	if (inputtype == FORMAT_auto_noresult) {
+		inputtype = libipv6calc_autodetectinput(token);
+
+		if (inputtype == FORMAT_ipv4addr) {
+			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+		} else if (inputtype == FORMAT_ipv6addr) {
+			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+		};
+
+		if (retval != 0) {
+			return(1);
+		};
+	};
+
+	return(libipv6calc_filter_addrset(set, inputtype, &ipv4addr, &ipv6addr));
+};
+
+
 /*
  * function checks ipv6calc filter expression
  *
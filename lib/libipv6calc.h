@@ -14,6 +14,10 @@
 #include "libipv4addr.h"
 #include "libipv6addr.h"
 #include "libipaddr.h"
+#include "libipaddrcache.h"
+#include "libipaddrset.h"
+#include "liblinereader.h"
+#include "liblinebatch.h"
 #include "databases/lib/libipv6calc_db_wrapper.h"
 #include "ipv6calcoptions.h"
 #include "libipv6calcdebug.h"
@@ -29,6 +33,7 @@ typedef struct {
 	s_ipv6calc_filter_ipv4addr filter_ipv4addr;
 	s_ipv6calc_filter_ipv6addr filter_ipv6addr;
 	s_ipv6calc_filter_macaddr  filter_macaddr;
+	s_ipaddrset                filter_addrset;	// prefix set of --filter-file, referenced by IPv4/IPv6 filter
 } s_ipv6calc_filter_master;
 
 
@@ -124,8 +129,13 @@ extern void string_to_reverse(char *string);
 extern void string_to_reverse_dotted(char *string, const size_t string_length);
 
 extern uint32_t libipv6calc_autodetectinput(const char *string);
+extern uint32_t libipv6calc_parse_ipaddr_fast(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp);
+extern int libipv6calc_collect_ipv4addrs(const char *data, const size_t length, const int lines_max, ipv6calc_ipaddr *ipaddrs, int *nump);
 
 extern int  libipv6calc_filter_parse(const char *expression, s_ipv6calc_filter_master *filter_master);
+extern int  libipv6calc_filter_file(const char *filename, s_ipv6calc_filter_master *filter_master);
+extern int  libipv6calc_filter_addrset(const s_ipaddrset *set, const uint32_t inputtype, const ipv6calc_ipv4addr *ipv4addrp, const ipv6calc_ipv6addr *ipv6addrp);
+extern int  libipv6calc_filter_addrset_token(const s_ipaddrset *set, const char *token);
 extern int  libipv6calc_filter_check(s_ipv6calc_filter_master *filter_master);
 extern void libipv6calc_filter_clear(s_ipv6calc_filter_master *filter_master);
 extern void libipv6calc_filter_clear_db_cc(s_ipv6calc_filter_db_cc *filter_db_cc);
@@ -38,6 +38,8 @@
 
 #define DEBUG_libmac					0x00010000l
 #define DEBUG_libipaddr					0x00020000l
+#define DEBUG_libipaddrcache				0x00040000l
+#define DEBUG_liblinereader				0x00080000l
 
 #define DEBUG_libipv6calc_db_wrapper			0x00100000l
 #define DEBUG_libipv6calc_db_wrapper_GeoIP		0x00200000l
@@ -46,6 +48,7 @@
 
 #define DEBUG_libipv6addr_iidrandomdetection		0x01000000l
 #define DEBUG_libipv6addr_anonymization_unknown_break	0x02000000l
+#define DEBUG_libipv6calc_db_wrapper_MMAP		0x04000000l
 
 #define DEBUG_libipv6calc_db_wrapper_DBIP		0x10000000l
 #define DEBUG_libipv6calc_db_wrapper_External		0x20000000l
@@ -0,0 +1,335 @@
+/*
+ * Project    : ipv6calc
+ * File       : liblinebatch.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for processing log lines in batches by worker threads
+ *   - batch: lines copied one after another (NUL terminated), optional output
+ *   - ring: main thread fills free batches, worker threads process ready
+ *     batches, in ordered mode a writer thread takes done batches in input
+ *     order, otherwise batches are free again after processing
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+
+#ifdef SUPPORT_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "liblinebatch.h"
+
+
+/*
+ * append string to growing buffer
+ * ret: 0=ok, 1=can't allocate memory
+ */
+int liblinebatch_buffer_append(char **bufp, size_t *sizep, size_t *usedp, const char *string, const size_t length) {
+	char *newbuf;
+	size_t newsize;
+
+	if (*usedp + length > *sizep) {
+		newsize = (*sizep == 0) ? LINEBATCH_BUFFER_INITIAL : *sizep;
+		while (*usedp + length > newsize) {
+			newsize *= 2;
+		};
+
+		newbuf = realloc(*bufp, newsize);
+		if (newbuf == NULL) {
+			return(1);
+		};
+		*bufp = newbuf;
+		*sizep = newsize;
+	};
+
+	memcpy(*bufp + *usedp, string, length);
+	*usedp += length;
+	return(0);
+};
+
+
+/*
+ * fill batch with up to lines_max lines from reader
+ * mod: linecounterp (incremented per read line)
+ * ret: 0=batch full, 1=end of input, -1=can't allocate memory
+ */
+int liblinebatch_fill(s_linebatch *batchp, s_linereader *reader, const int lines_max, const size_t maxlength, int *linecounterp) {
+	char *linebuffer;
+
+	batchp->lines = 0;
+	batchp->in_used = 0;
+	batchp->out_used = 0;
+	batchp->linecounter = *linecounterp + 1;
+
+	while (batchp->lines < lines_max) {
+		linebuffer = liblinereader_getline(reader, maxlength, NULL);
+
+		if (linebuffer == NULL) {
+			/* end of input */
+			return(1);
+		};
+
+		(*linecounterp)++;
+
+		if (*linecounterp == 1) {
+			NONQUIETPRINT_NA("Ok, proceeding stdin...");
+		};
+
+		if (liblinebatch_buffer_append(&batchp->in, &batchp->in_size, &batchp->in_used, linebuffer, strlen(linebuffer) + 1) != 0) {
+			fprintf(stderr, "Can't allocate input buffer for line: %d\n", *linecounterp);
+			return(-1);
+		};
+		batchp->lines++;
+	};
+
+	return(0);
+};
+
+
+/*
+ * iterate over lines of a batch, *lineptrp = NULL starts with first line
+ * ret: line
+ */
+char *liblinebatch_line_next(const s_linebatch *batchp, char **lineptrp) {
+	char *line = (*lineptrp == NULL) ? batchp->in : *lineptrp;
+
+	*lineptrp = line + strlen(line) + 1;
+	return(line);
+};
+
+
+/* free buffers of batch */
+void liblinebatch_free(s_linebatch *batchp) {
+	free(batchp->in);
+	free(batchp->out);
+	batchp->in = NULL;
+	batchp->out = NULL;
+	batchp->in_size = 0;
+	batchp->out_size = 0;
+};
+
+
+/*
+ * parse option value for amount of worker threads
+ * ret: amount of threads (0 = single-threaded)
+ */
+int liblinebatch_threads_option(const char *arg) {
+	int threads = atoi(arg);
+
+	if (threads > LINEBATCH_THREADS_MAX) {
+		threads = LINEBATCH_THREADS_MAX;
+		fprintf(stderr, " Number of threads too big, built-in limit: %d\n", threads);
+	};
+	if (threads < 0) {
+		threads = 0;
+	};
+#ifndef SUPPORT_PTHREAD
+	if (threads > 0) {
+		fprintf(stderr, " Support for threads not compiled in, proceed single-threaded\n");
+		threads = 0;
+	};
+#endif
+	return(threads);
+};
+
+
+#ifdef SUPPORT_PTHREAD
+struct s_linebatch_ring_struct {
+	s_linebatch    *batches;
+	int             num;
+	int             ordered;	// done batches are taken by writer in input order
+	long            read;		// next sequence number to read
+	long            written;	// next sequence number to write
+	int             eof;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t  cond_ready;
+	pthread_cond_t  cond_done;
+	pthread_cond_t  cond_free;
+};
+
+
+/*
+ * create ring with 2 batches per worker thread (+2 for reader and writer)
+ * ret: ring, NULL on error
+ */
+s_linebatch_ring *liblinebatch_ring_new(const int threads, const int ordered) {
+	s_linebatch_ring *ring;
+
+	ring = calloc(1, sizeof(s_linebatch_ring));
+	if (ring == NULL) {
+		return(NULL);
+	};
+
+	ring->num = threads * 2 + 2;
+	ring->ordered = ordered;
+	ring->batches = calloc((size_t) ring->num, sizeof(s_linebatch));
+	if (ring->batches == NULL) {
+		free(ring);
+		return(NULL);
+	};
+
+	pthread_mutex_init(&ring->mutex, NULL);
+	pthread_cond_init(&ring->cond_ready, NULL);
+	pthread_cond_init(&ring->cond_done, NULL);
+	pthread_cond_init(&ring->cond_free, NULL);
+
+	return(ring);
+};
+
+
+/* free ring incl. buffers of batches */
+void liblinebatch_ring_free(s_linebatch_ring *ring) {
+	int i;
+
+	for (i = 0; i < ring->num; i++) {
+		liblinebatch_free(&ring->batches[i]);
+	};
+
+	pthread_cond_destroy(&ring->cond_free);
+	pthread_cond_destroy(&ring->cond_done);
+	pthread_cond_destroy(&ring->cond_ready);
+	pthread_mutex_destroy(&ring->mutex);
+
+	free(ring->batches);
+	free(ring);
+};
+
+
+/* reader: wait for free batch */
+s_linebatch *liblinebatch_ring_get_free(s_linebatch_ring *ring) {
+	s_linebatch *batchp;
+	int i;
+
+	pthread_mutex_lock(&ring->mutex);
+	while (1 == 1) {
+		batchp = NULL;
+		for (i = 0; i < ring->num; i++) {
+			if (ring->batches[i].state == LINEBATCH_FREE) {
+				batchp = &ring->batches[i];
+				break;
+			};
+		};
+
+		if (batchp != NULL) {
+			break;
+		};
+
+		pthread_cond_wait(&ring->cond_free, &ring->mutex);
+	};
+	pthread_mutex_unlock(&ring->mutex);
+
+	return(batchp);
+};
+
+
+/* reader: hand over filled batch (if not empty) to worker threads, eof: no more batches follow */
+void liblinebatch_ring_put_ready(s_linebatch_ring *ring, s_linebatch *batchp, const int eof) {
+	pthread_mutex_lock(&ring->mutex);
+	if (batchp->lines > 0) {
+		batchp->seq = ring->read++;
+		batchp->state = LINEBATCH_READY;
+		pthread_cond_signal(&ring->cond_ready);
+	};
+	if (eof != 0) {
+		ring->eof = 1;
+		pthread_cond_broadcast(&ring->cond_ready);
+		pthread_cond_broadcast(&ring->cond_done);
+	};
+	pthread_mutex_unlock(&ring->mutex);
+};
+
+
+/*
+ * worker: wait for ready batch with lowest sequence number
+ * ret: batch, NULL on end of input
+ */
+s_linebatch *liblinebatch_ring_get_ready(s_linebatch_ring *ring) {
+	s_linebatch *batchp;
+	int i;
+
+	pthread_mutex_lock(&ring->mutex);
+	while (1 == 1) {
+		batchp = NULL;
+		for (i = 0; i < ring->num; i++) {
+			if ((ring->batches[i].state == LINEBATCH_READY) && ((batchp == NULL) || (ring->batches[i].seq < batchp->seq))) {
+				batchp = &ring->batches[i];
+			};
+		};
+
+		if ((batchp != NULL) || (ring->eof == 1)) {
+			break;
+		};
+
+		pthread_cond_wait(&ring->cond_ready, &ring->mutex);
+	};
+
+	if (batchp != NULL) {
+		batchp->state = LINEBATCH_BUSY;
+	};
+	pthread_mutex_unlock(&ring->mutex);
+
+	return(batchp);
+};
+
+
+/* worker: batch processed, in ordered mode hand over to writer, otherwise free */
+void liblinebatch_ring_put_done(s_linebatch_ring *ring, s_linebatch *batchp) {
+	pthread_mutex_lock(&ring->mutex);
+	if (ring->ordered == 1) {
+		batchp->state = LINEBATCH_DONE;
+		pthread_cond_broadcast(&ring->cond_done);
+	} else {
+		batchp->state = LINEBATCH_FREE;
+		pthread_cond_signal(&ring->cond_free);
+	};
+	pthread_mutex_unlock(&ring->mutex);
+};
+
+
+/*
+ * writer (ordered mode only): wait for next done batch in input order
+ * ret: batch, NULL if all batches are written
+ */
+s_linebatch *liblinebatch_ring_get_done(s_linebatch_ring *ring) {
+	s_linebatch *batchp;
+	int i;
+
+	pthread_mutex_lock(&ring->mutex);
+	while (1 == 1) {
+		batchp = NULL;
+		for (i = 0; i < ring->num; i++) {
+			if ((ring->batches[i].state == LINEBATCH_DONE) && (ring->batches[i].seq == ring->written)) {
+				batchp = &ring->batches[i];
+				break;
+			};
+		};
+
+		if ((batchp != NULL) || ((ring->eof == 1) && (ring->written == ring->read))) {
+			break;
+		};
+
+		pthread_cond_wait(&ring->cond_done, &ring->mutex);
+	};
+	pthread_mutex_unlock(&ring->mutex);
+
+	return(batchp);
+};
+
+
+/* writer: batch written, free for reader */
+void liblinebatch_ring_put_free(s_linebatch_ring *ring, s_linebatch *batchp) {
+	pthread_mutex_lock(&ring->mutex);
+	batchp->state = LINEBATCH_FREE;
+	ring->written++;
+	pthread_cond_signal(&ring->cond_free);
+	pthread_mutex_unlock(&ring->mutex);
+};
+#endif // SUPPORT_PTHREAD
@@ -0,0 +1,68 @@
+/*
+ * Project    : ipv6calc
+ * File       : liblinebatch.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for liblinebatch.c
+ */
+
+#include <stddef.h>
+
+#include "liblinereader.h"
+
+
+#ifndef _liblinebatch_h
+
+#define _liblinebatch_h 1
+
+/* maximum amount of worker threads */
+#define LINEBATCH_THREADS_MAX	64
+
+/* default amount of lines per batch */
+#define LINEBATCH_LINES		1024
+
+/* initial size of batch buffers */
+#define LINEBATCH_BUFFER_INITIAL	65536
+
+/* batch states */
+#define LINEBATCH_FREE		0
+#define LINEBATCH_READY		1
+#define LINEBATCH_BUSY		2
+#define LINEBATCH_DONE		3
+
+/* batch of lines */
+typedef struct {
+	int      state;
+	long     seq;
+	int      lines;
+	int      linecounter;			// line number of first line
+	char    *in;				// lines, each NUL terminated
+	size_t   in_size;
+	size_t   in_used;
+	char    *out;				// output of batch (optional)
+	size_t   out_size;
+	size_t   out_used;
+} s_linebatch;
+
+/* ring of batches shared between reader, worker and writer threads */
+typedef struct s_linebatch_ring_struct s_linebatch_ring;
+
+#endif
+
+
+extern int  liblinebatch_buffer_append(char **bufp, size_t *sizep, size_t *usedp, const char *string, const size_t length);
+extern int  liblinebatch_fill(s_linebatch *batchp, s_linereader *reader, const int lines_max, const size_t maxlength, int *linecounterp);
+extern char *liblinebatch_line_next(const s_linebatch *batchp, char **lineptrp);
+extern void liblinebatch_free(s_linebatch *batchp);
+extern int  liblinebatch_threads_option(const char *arg);
+
+extern s_linebatch_ring *liblinebatch_ring_new(const int threads, const int ordered);
+extern void liblinebatch_ring_free(s_linebatch_ring *ring);
+extern s_linebatch *liblinebatch_ring_get_free(s_linebatch_ring *ring);
+extern void liblinebatch_ring_put_ready(s_linebatch_ring *ring, s_linebatch *batchp, const int eof);
+extern s_linebatch *liblinebatch_ring_get_ready(s_linebatch_ring *ring);
+extern void liblinebatch_ring_put_done(s_linebatch_ring *ring, s_linebatch *batchp);
+extern s_linebatch *liblinebatch_ring_get_done(s_linebatch_ring *ring);
+extern void liblinebatch_ring_put_free(s_linebatch_ring *ring, s_linebatch *batchp);
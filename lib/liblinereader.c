@@ -0,0 +1,453 @@
+/*
+ * Project    : ipv6calc
+ * File       : liblinereader.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for reading lines from large input (e.g. log files)
+ *   - input is read in large blocks, lines are scanned with memchr
+ *   - lines are returned in place (no copy), terminated by a temporary
+ *     NUL which is replaced by the original character on next call
+ *   - gzip/zstd compressed input is detected by magic and decompressed
+ *     transparently (if supported)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "config.h"
+
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "liblinereader.h"
+
+#ifdef SUPPORT_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef SUPPORT_ZSTD
+#include <zstd.h>
+#endif
+
+
+/*
+ * read from file descriptor, retry on interrupt
+ * ret: amount of read bytes, 0 on EOF, -1 on error
+ */
+static ssize_t liblinereader_read(const int fd, char *buf, const size_t count) {
+	ssize_t r;
+
+	do {
+		r = read(fd, buf, count);
+	} while ((r < 0) && (errno == EINTR));
+
+	if (r < 0) {
+		ERRORPRINT_WA("Error reading input: %s", strerror(errno));
+	};
+
+	return(r);
+};
+
+
+/*
+ * fill raw input buffer (compressed input only)
+ * ret: amount of available bytes, 0 on EOF, -1 on error
+ */
+static ssize_t liblinereader_fill_raw(s_linereader *reader) {
+	ssize_t r;
+
+	if (reader->raw_eof != 0) {
+		return(0);
+	};
+
+	r = liblinereader_read(reader->fd, reader->raw, LINEREADER_BLOCKSIZE);
+	if (r == 0) {
+		reader->raw_eof = 1;
+	} else if (r > 0) {
+		reader->raw_pos = 0;
+		reader->raw_end = r;
+	};
+
+	return(r);
+};
+
+
+/*
+ * fill given buffer with (decompressed) data
+ * ret: amount of stored bytes, 0 on EOF, -1 on error
+ */
+static ssize_t liblinereader_fill(s_linereader *reader, char *out, const size_t count) {
+	if (reader->format == LINEREADER_FORMAT_PLAIN) {
+		return(liblinereader_read(reader->fd, out, count));
+
+#ifdef SUPPORT_ZLIB
+	} else if (reader->format == LINEREADER_FORMAT_GZIP) {
+		z_stream *zs = (z_stream *) reader->stream;
+		ssize_t r;
+		int ret;
+
+		zs->next_out = (Bytef *) out;
+		zs->avail_out = count;
+
+		while (zs->avail_out == count) {
+			if ((zs->avail_in == 0) && (reader->raw_eof == 0)) {
+				r = liblinereader_fill_raw(reader);
+				if (r < 0) {
+					return(-1);
+				} else if (r > 0) {
+					zs->next_in = (Bytef *) reader->raw;
+					zs->avail_in = reader->raw_end;
+				};
+			};
+
+			if ((zs->avail_in == 0) && (reader->raw_eof != 0) && (reader->stream_open == 0)) {
+				/* end of input behind complete gzip member */
+				break;
+			};
+
+			ret = inflate(zs, Z_NO_FLUSH);
+			if (ret == Z_STREAM_END) {
+				/* concatenated gzip members */
+				inflateReset(zs);
+				reader->stream_open = 0;
+			} else if ((ret == Z_OK) || (ret == Z_BUF_ERROR)) {
+				reader->stream_open = 1;
+			} else {
+				ERRORPRINT_WA("Error decompressing gzip input: %s", (zs->msg != NULL) ? zs->msg : "unknown");
+				return(-1);
+			};
+
+			if ((zs->avail_out == count) && (zs->avail_in == 0) && (reader->raw_eof != 0) && (reader->stream_open != 0)) {
+				ERRORPRINT_NA("Error decompressing gzip input: unexpected end of input (truncated)");
+				return(-1);
+			};
+		};
+
+		return(count - zs->avail_out);
+#endif
+
+#ifdef SUPPORT_ZSTD
+	} else if (reader->format == LINEREADER_FORMAT_ZSTD) {
+		ZSTD_DStream *zds = (ZSTD_DStream *) reader->stream;
+		ZSTD_outBuffer zout = { out, count, 0 };
+		ZSTD_inBuffer zin;
+		size_t ret;
+
+		while (zout.pos == 0) {
+			if ((reader->raw_pos == reader->raw_end) && (reader->raw_eof == 0)) {
+				if (liblinereader_fill_raw(reader) < 0) {
+					return(-1);
+				};
+			};
+
+			if ((reader->raw_pos == reader->raw_end) && (reader->raw_eof != 0) && (reader->stream_open == 0)) {
+				/* end of input behind complete zstd frame */
+				break;
+			};
+
+			zin.src = reader->raw;
+			zin.size = reader->raw_end;
+			zin.pos = reader->raw_pos;
+
+			ret = ZSTD_decompressStream(zds, &zout, &zin);
+			reader->raw_pos = zin.pos;
+
+			if (ZSTD_isError(ret)) {
+				ERRORPRINT_WA("Error decompressing zstd input: %s", ZSTD_getErrorName(ret));
+				return(-1);
+			};
+
+			/* 0: frame is completely decoded and flushed */
+			reader->stream_open = (ret != 0) ? 1 : 0;
+
+			if ((zout.pos == 0) && (reader->raw_pos == reader->raw_end) && (reader->raw_eof != 0) && (reader->stream_open != 0)) {
+				ERRORPRINT_NA("Error decompressing zstd input: unexpected end of input (truncated)");
+				return(-1);
+			};
+		};
+
+		return(zout.pos);
+#endif
+	};
+
+	return(-1);
+};
+
+
+/*
+ * open reader on file descriptor and detect input format
+ * ret: 0=ok, 1=error
+ */
+int liblinereader_open(s_linereader *reader, const int fd) {
+	ssize_t r;
+	int result = 1;
+
+	memset(reader, 0, sizeof(s_linereader));
+
+	reader->fd = fd;
+	reader->size = LINEREADER_BLOCKSIZE;
+
+	/* +1 for terminator behind a line ending at the end of the buffer */
+	reader->buffer = malloc(reader->size + 1);
+	if (reader->buffer == NULL) {
+		ERRORPRINT_WA("Can't allocate memory for line buffer: %lu", (unsigned long) reader->size + 1);
+		goto END_liblinereader_open;
+	};
+
+	/* read start of input for magic detection */
+	while (reader->end < 4) {
+		r = liblinereader_read(fd, reader->buffer + reader->end, reader->size - reader->end);
+		if (r < 0) {
+			goto END_liblinereader_open;
+		} else if (r == 0) {
+			reader->eof = 1;
+			break;
+		};
+		reader->end += r;
+	};
+
+	if ((reader->end >= 2) && ((unsigned char) reader->buffer[0] == 0x1f) && ((unsigned char) reader->buffer[1] == 0x8b)) {
+		reader->format = LINEREADER_FORMAT_GZIP;
+	} else if ((reader->end >= 4) && ((unsigned char) reader->buffer[0] == 0x28) && ((unsigned char) reader->buffer[1] == 0xb5) && ((unsigned char) reader->buffer[2] == 0x2f) && ((unsigned char) reader->buffer[3] == 0xfd)) {
+		reader->format = LINEREADER_FORMAT_ZSTD;
+	};
+
+	DEBUGPRINT_WA(DEBUG_liblinereader, "Detected input format: %s", liblinereader_format_string(reader));
+
+	if (reader->format == LINEREADER_FORMAT_PLAIN) {
+		result = 0;
+		goto END_liblinereader_open;
+	};
+
+#if defined SUPPORT_ZLIB || defined SUPPORT_ZSTD
+	/* move already read compressed data into raw buffer */
+	reader->raw = malloc(LINEREADER_BLOCKSIZE);
+	if (reader->raw == NULL) {
+		ERRORPRINT_WA("Can't allocate memory for input buffer: %lu", (unsigned long) LINEREADER_BLOCKSIZE);
+		goto END_liblinereader_open;
+	};
+	memcpy(reader->raw, reader->buffer, reader->end);
+	reader->raw_pos = 0;
+	reader->raw_end = reader->end;
+	reader->raw_eof = reader->eof;
+	reader->end = 0;
+	reader->eof = 0;
+#endif
+
+	if (reader->format == LINEREADER_FORMAT_GZIP) {
+#ifdef SUPPORT_ZLIB
+		z_stream *zs = calloc(1, sizeof(z_stream));
+		if (zs == NULL) {
+			ERRORPRINT_NA("Can't allocate memory for gzip stream");
+			goto END_liblinereader_open;
+		};
+		reader->stream = zs;
+
+		/* 15 bit window, +16: gzip header */
+		if (inflateInit2(zs, 15 + 16) != Z_OK) {
+			ERRORPRINT_NA("Can't initialize gzip decompression");
+			free(zs);
+			reader->stream = NULL;
+			goto END_liblinereader_open;
+		};
+		zs->next_in = (Bytef *) reader->raw;
+		zs->avail_in = reader->raw_end;
+		result = 0;
+#else
+		ERRORPRINT_NA("Input is gzip compressed, but support is not compiled-in");
+#endif
+	} else if (reader->format == LINEREADER_FORMAT_ZSTD) {
+#ifdef SUPPORT_ZSTD
+		ZSTD_DStream *zds = ZSTD_createDStream();
+		if (zds == NULL) {
+			ERRORPRINT_NA("Can't allocate memory for zstd stream");
+			goto END_liblinereader_open;
+		};
+		reader->stream = zds;
+
+		if (ZSTD_isError(ZSTD_initDStream(zds))) {
+			ERRORPRINT_NA("Can't initialize zstd decompression");
+			goto END_liblinereader_open;
+		};
+		result = 0;
+#else
+		ERRORPRINT_NA("Input is zstd compressed, but support is not compiled-in");
+#endif
+	};
+
+END_liblinereader_open:
+	if (result != 0) {
+		liblinereader_close(reader);
+	};
+	return(result);
+};
+
+
+/*
+ * return next line (incl. newline) in place, NUL terminated
+ *  lines longer than maxlength - 1 are returned in chunks (like fgets)
+ *  returned pointer is valid until next call
+ * ret: pointer to line, NULL on EOF or error
+ */
+char *liblinereader_getline(s_linereader *reader, const size_t maxlength, size_t *lengthp) {
+	size_t avail, limit, length;
+	char *line, *p;
+	ssize_t r;
+
+	if (reader->buffer == NULL) {
+		return(NULL);
+	};
+
+	/* restore character replaced by terminator on previous call */
+	if (reader->saved != 0) {
+		reader->buffer[reader->saved_pos] = reader->saved_char;
+		reader->saved = 0;
+	};
+
+	if (maxlength < 2) {
+		return(NULL);
+	};
+
+	while (1) {
+		avail = reader->end - reader->start;
+		limit = (avail < maxlength - 1) ? avail : maxlength - 1;
+
+		p = memchr(reader->buffer + reader->start, '\n', limit);
+		if (p != NULL) {
+			length = p - (reader->buffer + reader->start) + 1;
+			break;
+		};
+
+		if (avail >= maxlength - 1) {
+			length = maxlength - 1;
+			break;
+		};
+
+		if (reader->eof != 0) {
+			if (avail == 0) {
+				return(NULL);
+			};
+			length = avail;
+			break;
+		};
+
+		/* move incomplete line to begin of buffer */
+		if (reader->start > 0) {
+			if (avail > 0) {
+				memmove(reader->buffer, reader->buffer + reader->start, avail);
+			};
+			reader->start = 0;
+			reader->end = avail;
+		};
+
+		if (reader->size < maxlength) {
+			p = realloc(reader->buffer, maxlength + 1);
+			if (p == NULL) {
+				ERRORPRINT_WA("Can't allocate memory for line buffer: %lu", (unsigned long) maxlength + 1);
+				reader->error = 1;
+				reader->eof = 1;
+				continue;
+			};
+			reader->buffer = p;
+			reader->size = maxlength;
+		};
+
+		r = liblinereader_fill(reader, reader->buffer + reader->end, reader->size - reader->end);
+		if (r < 0) {
+			reader->error = 1;
+			reader->eof = 1;
+		} else if (r == 0) {
+			reader->eof = 1;
+		} else {
+			reader->end += r;
+		};
+	};
+
+	line = reader->buffer + reader->start;
+	reader->start += length;
+
+	reader->saved_pos = reader->start;
+	reader->saved_char = reader->buffer[reader->start];
+	reader->saved = 1;
+	reader->buffer[reader->start] = '\0';
+
+	if (lengthp != NULL) {
+		*lengthp = length;
+	};
+
+	return(line);
+};
+
+
+/*
+ * return buffered data behind the last returned line without consuming it
+ *  (e.g. to scan upcoming lines in advance), data is not NUL terminated and
+ *  can end with an incomplete line, no further data is read from input
+ *  the last returned line is no longer terminated after this call
+ * ret: pointer to data, length in *lengthp (0 = nothing buffered)
+ */
+const char *liblinereader_peek(s_linereader *reader, size_t *lengthp) {
+	*lengthp = 0;
+
+	if (reader->buffer == NULL) {
+		return(NULL);
+	};
+
+	/* restore character replaced by terminator on previous call */
+	if (reader->saved != 0) {
+		reader->buffer[reader->saved_pos] = reader->saved_char;
+		reader->saved = 0;
+	};
+
+	*lengthp = reader->end - reader->start;
+	return(reader->buffer + reader->start);
+};
+
+
+/*
+ * close reader, file descriptor is not closed
+ */
+void liblinereader_close(s_linereader *reader) {
+#ifdef SUPPORT_ZLIB
+	if ((reader->format == LINEREADER_FORMAT_GZIP) && (reader->stream != NULL)) {
+		inflateEnd((z_stream *) reader->stream);
+		free(reader->stream);
+	};
+#endif
+
+#ifdef SUPPORT_ZSTD
+	if ((reader->format == LINEREADER_FORMAT_ZSTD) && (reader->stream != NULL)) {
+		ZSTD_freeDStream((ZSTD_DStream *) reader->stream);
+	};
+#endif
+
+	reader->stream = NULL;
+
+	if (reader->raw != NULL) {
+		free(reader->raw);
+		reader->raw = NULL;
+	};
+
+	if (reader->buffer != NULL) {
+		free(reader->buffer);
+		reader->buffer = NULL;
+	};
+};
+
+
+/*
+ * return input format as string
+ */
+const char *liblinereader_format_string(const s_linereader *reader) {
+	switch (reader->format) {
+		case LINEREADER_FORMAT_GZIP:
+			return("gzip");
+		case LINEREADER_FORMAT_ZSTD:
+			return("zstd");
+	};
+	return("plain");
+};
@@ -0,0 +1,59 @@
+/*
+ * Project    : ipv6calc
+ * File       : liblinereader.h
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for liblinereader.c
+ */ 
+
+#include <stddef.h>
+
+
+#ifndef _liblinereader_h
+
+#define _liblinereader_h 1
+
+/* size of block read from input */
+#define LINEREADER_BLOCKSIZE		(1024 * 1024)
+
+/* input formats (autodetected by magic bytes) */
+#define LINEREADER_FORMAT_PLAIN		0
+#define LINEREADER_FORMAT_GZIP		1
+#define LINEREADER_FORMAT_ZSTD		2
+
+/* reader structure */
+typedef struct {
+	int    fd;
+	int    format;		/* LINEREADER_FORMAT_* */
+	int    eof;		/* no more data available from source */
+	int    error;		/* read or decompression error occured */
+
+	/* line buffer, lines are returned in place */
+	char   *buffer;		/* allocated with size + 1 (terminator) */
+	size_t size;
+	size_t start;		/* begin of not yet returned data */
+	size_t end;		/* end of valid data */
+	size_t saved_pos;	/* position of temporary terminator */
+	char   saved_char;	/* original character at saved_pos */
+	int    saved;
+
+	/* raw input buffer, only used for compressed input */
+	char   *raw;
+	size_t raw_pos;
+	size_t raw_end;
+	int    raw_eof;
+
+	void   *stream;		/* decompression context */
+	int    stream_open;	/* gzip member/zstd frame not yet completed */
+} s_linereader;
+
+#endif
+
+
+extern int   liblinereader_open(s_linereader *reader, const int fd);
+extern char *liblinereader_getline(s_linereader *reader, const size_t maxlength, size_t *lengthp);
+extern const char *liblinereader_peek(s_linereader *reader, size_t *lengthp);
+extern void  liblinereader_close(s_linereader *reader);
+extern const char *liblinereader_format_string(const s_linereader *reader);
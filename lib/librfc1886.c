@@ -29,6 +29,10 @@
 #include "librfc1886.h"
 
 
+/* nibble characters: lowercase, uppercase */
+static const char *librfc1886_digits[2] = { "0123456789abcdef", "0123456789ABCDEF" };
+
+
 /*
  * converts IPv6addr_structure to a reverse nibble format string
  *
@@ -40,8 +44,10 @@ int librfc1886_addr_to_nibblestring(ipv6calc_ipv6addr *ipv6addrp, char *resultst
 	int retval = 1;
 	unsigned int nibble;
 	int bit_start, bit_end, nbit;
-	char tempstring[NI_MAXHOST];
+	char tempstring[NI_MAXHOST], *p = tempstring, *p_end = tempstring + sizeof(tempstring) - 1;
 	unsigned int nnibble, noctet;
+	int uppercase = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? 1 : 0;
+	const char *digits = librfc1886_digits[uppercase];
 	
 	DEBUGPRINT_WA(DEBUG_librfc1886, "flag_prefixuse %d", (*ipv6addrp).flag_prefixuse);
 
@@ -78,10 +84,8 @@ int librfc1886_addr_to_nibblestring(ipv6calc_ipv6addr *ipv6addrp, char *resultst
 	
 	DEBUGPRINT_WA(DEBUG_librfc1886, "start bit %d  end bit %d", bit_start, bit_end);
 
-	/* print out nibble format */
+	/* print out nibble format, each character is written once */
 	/* 127 is lowest bit, 0 is highest bit */
-	resultstring[0] = '\0';
-
 	for (nbit = bit_end - 1; nbit >= bit_start - 1; nbit = nbit - 4) {
 		/* calculate octet (8 bit) */
 		noctet = ( ((unsigned int) nbit) & 0x78) >> 3;
@@ -94,25 +98,24 @@ int librfc1886_addr_to_nibblestring(ipv6calc_ipv6addr *ipv6addrp, char *resultst
 		
 		DEBUGPRINT_WA(DEBUG_librfc1886, "bit: %d = noctet: %u, nnibble: %u, octet: %02x, value: %x", nbit, noctet, nnibble, (unsigned int) (*ipv6addrp).in6_addr.s6_addr[noctet], nibble);
 
-		snprintf(tempstring, sizeof(tempstring), "%s%x", resultstring, nibble);
-		if ((nbit < bit_start) && (bit_start != 1)) {
-			/* don't print trailing "." on middle part end */
-			snprintf(resultstring, resultstring_length, "%s", tempstring);
-		} else {
-			snprintf(resultstring, resultstring_length, "%s.", tempstring);
+		if (p != tempstring) {
+			*p++ = '.';
 		};
+		*p++ = digits[nibble];
 	};
 
 	if (bit_start == 1) {
-		snprintf(tempstring, sizeof(tempstring), "%s%s", resultstring, domain);
+		if (p != tempstring) {
+			*p++ = '.';
+		};
+		for (; (*domain != '\0') && (p < p_end); domain++) {
+			*p++ = (uppercase == 1) ? (char) toupper((int) *domain) : *domain;
+		};
 	};
+	*p = '\0';
 
 	snprintf(resultstring, resultstring_length, "%s", tempstring);
 
-	if ( (formatoptions & FORMATOPTION_printuppercase) != 0 ) {
-		string_to_upcase(resultstring);
-	};
-
 	if ( (formatoptions & FORMATOPTION_printmirrored) != 0 ) {
 		string_to_reverse_dotted(resultstring, resultstring_length);
 	};
@@ -345,3 +348,91 @@ NEXT_librfc1886_formatcheck:
 
 	return (0);
 };
+
+
+/*
+ * bulk writer: reverse nibble format strings of all sub-prefixes of a prefix
+ *  nibbles above the first varying one and the domain are written once,
+ *  for each sub-prefix only the varying nibbles in front of them
+ *
+ * in : *ipv6addrp = prefix (prefix length 128 if not given)
+ * in : length = length of sub-prefixes (dividable by 4)
+ * in : domain = e.g. "ip6.arpa."
+ * in : func = called for each string with its sub-prefix, data = passed to func
+ * ret: ==0: ok, !=0: error
+ */
+int librfc1886_enumerate_nibblestrings(const ipv6calc_ipv6addr *ipv6addrp, const int length, const uint32_t formatoptions, const char *domain, void (*func)(const char *name, const ipv6calc_ipv6addr *ipv6addrp, void *data), void *data) {
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t dword[4], count, i, value;
+	int prefixlength, bit_var, nbit, n, bits;
+	int uppercase = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? 1 : 0;
+	const char *digits = librfc1886_digits[uppercase];
+	char name[NI_MAXHOST], *p, *p_end = name + sizeof(name) - 1;
+
+	prefixlength = ((*ipv6addrp).flag_prefixuse != 0) ? (int) (*ipv6addrp).prefixlength : 128;
+
+	if (((length & 0x3) != 0) || (length < prefixlength) || (length > 128) || ((length - prefixlength) > 31)) {
+		return(1);
+	};
+
+	/* prefix, bits behind prefix length cleared */
+	for (n = 0; n < 4; n++) {
+		bits = prefixlength - (n * 32);
+		dword[n] = ipv6addr_getdword(ipv6addrp, (unsigned int) n);
+		if (bits <= 0) {
+			dword[n] = 0;
+		} else if (bits < 32) {
+			dword[n] &= 0xffffffffu << (32 - bits);
+		};
+	};
+
+	/* constant part behind the varying nibbles */
+	bit_var = prefixlength & ~0x3;
+	p = name + ((length - bit_var) / 4) * 2;
+	for (nbit = bit_var - 4; nbit >= 0; nbit -= 4) {
+		*p++ = digits[(dword[nbit >> 5] >> (28 - (nbit & 31))) & 0xf];
+		*p++ = '.';
+	};
+	for (; (*domain != '\0') && (p < p_end); domain++) {
+		*p++ = (uppercase == 1) ? (char) toupper((int) *domain) : *domain;
+	};
+	*p = '\0';
+
+	ipv6addr_clearall(&ipv6addr);
+	ipv6addr.prefixlength = (uint8_t) length;
+	ipv6addr.flag_prefixuse = 1;
+	ipv6addr.flag_valid = 1;
+
+	count = 1u << (length - prefixlength);
+
+	DEBUGPRINT_WA(DEBUG_librfc1886, "enumerate %u sub-prefixes with length %d", (unsigned int) count, length);
+
+	for (i = 0; i < count; i++) {
+		if (i > 0) {
+			/* next sub-prefix */
+			n = (length - 1) >> 5;
+			value = 1u << (31 - ((length - 1) & 31));
+			dword[n] += value;
+			while ((dword[n] < value) && (n > 0)) {
+				/* carry */
+				n--;
+				value = 1;
+				dword[n] += value;
+			};
+		};
+
+		p = name;
+		for (nbit = length - 4; nbit >= bit_var; nbit -= 4) {
+			*p++ = digits[(dword[nbit >> 5] >> (28 - (nbit & 31))) & 0xf];
+			*p++ = '.';
+		};
+
+		for (n = 0; n < 4; n++) {
+			ipv6addr_setdword(&ipv6addr, (unsigned int) n, dword[n]);
+		};
+
+		(*func)(name, &ipv6addr, data);
+	};
+
+	return(0);
+};
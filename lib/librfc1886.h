@@ -14,3 +14,4 @@
 extern int librfc1886_addr_to_nibblestring(ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions, const char *domain);
 extern int librfc1886_nibblestring_to_ipv6addrstruct(const char *inputstring, ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length);
 extern int librfc1886_formatcheck(const char *string, char *infostring, const size_t infostring_length);
+extern int librfc1886_enumerate_nibblestrings(const ipv6calc_ipv6addr *ipv6addrp, const int length, const uint32_t formatoptions, const char *domain, void (*func)(const char *name, const ipv6calc_ipv6addr *ipv6addrp, void *data), void *data);
@@ -20,8 +20,12 @@
  *   ipv6calcActionAsn			on
  *   ipv6calcActionRegistry		on
  *   ipv6calcCache			off (default: on)
- *   ipv6calcCacheLimit			>= IPV6CALC_CACHE_LRI_LIMIT_MIN
+ *   ipv6calcCacheLimit			>= IPV6CALC_CACHE_LIMIT_MIN (client addresses, per thread on threaded MPMs)
  *   ipv6calcCacheStatisticsInterval	0:disable 
+ *   ipv6calcSharedCacheSize		0:disable (default) or >= IPV6CALC_SHARED_CACHE_SIZE_MIN
+ *   ipv6calcLazy			on (default: off)
+ *
+ *  log format (mod_log_config) %{<name>}w, name: anon|cc|asn|registry|method
  *   ipv6calcDebuglevel			>0 (see defines below)
  *
  *  ipv6calc behavior can be controlled by config, e.g
@@ -43,6 +47,21 @@
 #include <http_log.h>
 #include <http_protocol.h>
 #include <apr_strings.h>
+#include <apr_atomic.h>
+#include <ap_mpm.h>
+#include <apr_shm.h>
+#include <apr_global_mutex.h>
+#include <apr_optional.h>
+#include <mod_log_config.h>
+#if (((AP_SERVER_MAJORVERSION_NUMBER == 2) && (AP_SERVER_MINORVERSION_NUMBER >= 4)) || (AP_SERVER_MAJORVERSION_NUMBER > 2))
+#include <util_mutex.h>
+#else
+#include <unixd.h>
+#endif
+#if APR_HAS_THREADS
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+#endif
 
 // ipv6calc related includes
 #undef PACKAGE_BUGREPORT
@@ -100,6 +119,8 @@ static const char *set_ipv6calc_no_fallback(cmd_parms *cmd, void *dummy, int arg
 static const char *set_ipv6calc_cache(cmd_parms *cmd, void *dummy, int arg);
 static const char *set_ipv6calc_cache_limit(cmd_parms *cmd, void *dummy, const char *value, int arg);
 static const char *set_ipv6calc_cache_statistics_interval(cmd_parms *cmd, void *dummy, const char *value, int arg);
+static const char *set_ipv6calc_shared_cache_size(cmd_parms *cmd, void *dummy, const char *value, int arg);
+static const char *set_ipv6calc_lazy(cmd_parms *cmd, void *dummy, int arg);
 static const char *set_ipv6calc_debuglevel(cmd_parms *cmd, void *dummy, const char *value, int arg);
 
 static const char *set_ipv6calc_action_anonymize(cmd_parms *cmd, void *dummy, int arg);
@@ -111,27 +132,92 @@ static const char *set_ipv6calc_option(cmd_parms *cmd, void *dummy, const char *
 
 
 /***************************
- * Cache (Last Recently Inserted)
+ * Cache (keyed on binary client address, see lib/libipaddrcache.c)
  ***************************/
-#define IPV6CALC_CACHE_LRI_SIZE 200
-#define IPV6CALC_CACHE_LRI_LIMIT_MIN 20
-
-static long int ipv6calc_cache_lri_checked[2] = {0, 0};
+#define IPV6CALC_CACHE_LIMIT_MIN	20
+#define IPV6CALC_CACHE_LIMIT_DEFAULT	4096
 
-static int      ipv6calc_cache_lri_max[2] = {0, 0};
-static int      ipv6calc_cache_lri_last[2] = {0, 0 };
-static long int ipv6calc_cache_lri_statistics[2][IPV6CALC_CACHE_LRI_SIZE];
+#define IPV6CALC_CACHE_TAG_ANON		1
+#define IPV6CALC_CACHE_TAG_CC		2
+#define IPV6CALC_CACHE_TAG_ASN		3
+#define IPV6CALC_CACHE_TAG_REGISTRY	4
 
-static char     ipv6calc_cache_lri_value_anon[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
-static char     ipv6calc_cache_lri_value_cc[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
-static char     ipv6calc_cache_lri_value_asn[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
-static char     ipv6calc_cache_lri_value_registry[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
+/* cache incl. request counters, on threaded MPMs one per thread */
+typedef struct {
+	s_ipaddrcache cache;
+	uint64_t checked;
+	uint64_t hit;
+#if APR_HAS_THREADS
+	apr_pool_t *pool;
+	apr_thread_mutex_t *mutex;	/* only contended by statistics of other threads */
+#endif
+} s_ipv6calc_cache;
+
+#if APR_HAS_THREADS
+// each thread has an own cache, registered for statistics and cleanup, freed on thread exit
+static apr_threadkey_t *ipv6calc_cache_key = NULL;
+static apr_thread_mutex_t *ipv6calc_caches_mutex = NULL;
+static s_ipv6calc_cache **ipv6calc_caches = NULL;
+static int ipv6calc_caches_num = 0;
+static int ipv6calc_caches_size = 0;
+
+// counters of caches of already exited threads
+static uint64_t ipv6calc_cache_checked = 0;
+static uint64_t ipv6calc_cache_hit = 0;
+static unsigned long int ipv6calc_cache_lookup_hit = 0;
+static unsigned long int ipv6calc_cache_lookup_miss = 0;
+static unsigned long int ipv6calc_cache_evict = 0;
+
+#define IPV6CALC_CACHE_LOCK(cachep)	apr_thread_mutex_lock((cachep)->mutex)
+#define IPV6CALC_CACHE_UNLOCK(cachep)	apr_thread_mutex_unlock((cachep)->mutex)
+#else
+static s_ipv6calc_cache ipv6calc_cache;
 
-static struct in_addr  ipv6calc_cache_lri_ipv4_token[IPV6CALC_CACHE_LRI_SIZE];
-#if APR_HAVE_IPV6
-static struct in6_addr ipv6calc_cache_lri_ipv6_token[IPV6CALC_CACHE_LRI_SIZE];
+#define IPV6CALC_CACHE_LOCK(cachep)
+#define IPV6CALC_CACHE_UNLOCK(cachep)
 #endif
 
+// requests of all threads, only used to trigger statistics (wrap-around only shifts one interval)
+static volatile apr_uint32_t ipv6calc_cache_requests = 0;
+
+
+/***************************
+ * Shared cache (all children, set-associative table in shared memory)
+ ***************************/
+#define IPV6CALC_SHARED_CACHE_SIZE_MIN	1024
+#define IPV6CALC_SHARED_CACHE_SIZE_MAX	16777216
+#define IPV6CALC_SHARED_CACHE_WAYS	4
+#define IPV6CALC_SHARED_CACHE_MUTEX	"ipv6calc-shared-cache"	/* mutex type, configurable by 'Mutex' directive */
+
+/* shared cache entry, values which do not fit are not stored */
+typedef struct {
+	uint32_t addr[4];	/* binary address (IPv4: only addr[0] used) */
+	uint32_t stamp;		/* last use (0: empty) */
+	uint8_t  proto;		/* IPV6CALC_PROTO_IPV4|IPV6CALC_PROTO_IPV6 */
+	uint8_t  valid;		/* stored values: bit (1 << IPV6CALC_CACHE_TAG_*) */
+	char     anon[64];
+	char     cc[8];
+	char     asn[16];
+	char     registry[24];
+} s_ipv6calc_shared_cache_entry;
+
+/* shared cache header, followed by entries */
+typedef struct {
+	uint32_t sets;
+	uint32_t used;
+	uint32_t clock;
+
+	/* statistics */
+	unsigned long int hit;
+	unsigned long int miss;
+	unsigned long int store;
+	unsigned long int evict;
+} s_ipv6calc_shared_cache;
+
+static apr_shm_t *ipv6calc_shared_cache_shm = NULL;
+static apr_global_mutex_t *ipv6calc_shared_cache_mutex = NULL;
+static s_ipv6calc_shared_cache *ipv6calc_shared_cache = NULL;	/* NULL: disabled */
+
 
 /***************************
  * Static values
@@ -156,6 +242,9 @@ typedef struct {
 	int cache;
 	int cache_limit;
 	unsigned long int cache_statistics_interval;
+	int shared_cache_size;
+
+	int lazy;
 
 	uint32_t debuglevel;
 
@@ -190,8 +279,10 @@ static const command_rec ipv6calc_cmds[] = {
 	AP_INIT_FLAG("ipv6calcEnable", set_ipv6calc_enable, NULL, OR_FILEINFO, "Turn on mod_ipv6calc"),
 	AP_INIT_FLAG("ipv6calcNoFallback", set_ipv6calc_no_fallback, NULL, OR_FILEINFO, "Do not fallback in case of issues with mod_ipv6calc"),
 	AP_INIT_FLAG("ipv6calcCache", set_ipv6calc_cache, NULL, OR_FILEINFO, "Turn off mod_ipv6calc cache"),
-	AP_INIT_TAKE1("ipv6calcCacheLimit",  (const char *(*)()) set_ipv6calc_cache_limit, NULL, OR_FILEINFO, "mod_ipv6calc cache limit: <value>"),
+	AP_INIT_TAKE1("ipv6calcCacheLimit",  (const char *(*)()) set_ipv6calc_cache_limit, NULL, OR_FILEINFO, "mod_ipv6calc cache limit: <client addresses> (per thread on threaded MPMs)"),
 	AP_INIT_TAKE1("ipv6calcCacheStatisticsInterval",  (const char *(*)()) set_ipv6calc_cache_statistics_interval, NULL, OR_FILEINFO, "mod_ipv6calc cache statistics interval: <value> (0=disabled)"),
+	AP_INIT_FLAG("ipv6calcLazy", set_ipv6calc_lazy, NULL, OR_FILEINFO, "Lookup only on demand (log format %{...}w or handler other than static files)"),
+	AP_INIT_TAKE1("ipv6calcSharedCacheSize",  (const char *(*)()) set_ipv6calc_shared_cache_size, NULL, OR_FILEINFO, "mod_ipv6calc cache shared by all children: <entries> (0=disabled)"),
 	AP_INIT_TAKE1("ipv6calcDebuglevel",  (const char *(*)()) set_ipv6calc_debuglevel, NULL, OR_FILEINFO, "Debug level of module (binary or'ed): <value>"),
 	AP_INIT_FLAG("ipv6calcActionAnonymize", set_ipv6calc_action_anonymize, NULL, OR_FILEINFO, "Store anonymized IP address in IPV6CALC_CLIENT_IP_ANON"),
 	AP_INIT_FLAG("ipv6calcActionCountrycode", set_ipv6calc_action_countrycode, NULL, OR_FILEINFO, "Store Country Code of IP address in IPV6CALC_CLIENT_COUNTRYCODE"),
@@ -309,6 +400,269 @@ static int ipv6calc_support_init(server_rec *s) {
 };
 
 
+/*
+ * ipv6calc_shared_cache_create
+ *  create shared memory segment and mutex (called from post_config, inherited by children)
+ */
+static int ipv6calc_shared_cache_create(apr_pool_t *pconf, server_rec *s, const ipv6calc_server_config *config) {
+	s_ipv6calc_shared_cache *cachep;
+	apr_size_t size;
+	apr_status_t rv;
+	uint32_t sets = (uint32_t) config->shared_cache_size / IPV6CALC_SHARED_CACHE_WAYS;
+	const char *file;
+
+	size = sizeof(s_ipv6calc_shared_cache) + (apr_size_t) sets * IPV6CALC_SHARED_CACHE_WAYS * sizeof(s_ipv6calc_shared_cache_entry);
+
+	// anonymous segment, named one on platforms without support
+	rv = apr_shm_create(&ipv6calc_shared_cache_shm, size, NULL, pconf);
+	if (rv == APR_ENOTIMPL) {
+#if (((AP_SERVER_MAJORVERSION_NUMBER == 2) && (AP_SERVER_MINORVERSION_NUMBER >= 4)) || (AP_SERVER_MAJORVERSION_NUMBER > 2))
+		file = ap_runtime_dir_relative(pconf, "mod_ipv6calc-cache.shm");
+#else
+		file = ap_server_root_relative(pconf, "logs/mod_ipv6calc-cache.shm");
+#endif
+		apr_shm_remove(file, pconf);
+		rv = apr_shm_create(&ipv6calc_shared_cache_shm, size, file, pconf);
+	};
+
+	if (rv != APR_SUCCESS) {
+		ap_log_error(APLOG_MARK, APLOG_ERR, rv, s
+			, "can't create shared memory segment with size %lu"
+			, (unsigned long) size
+		);
+		ipv6calc_shared_cache_shm = NULL;
+		return(1);
+	};
+
+	// mutex is created by root, permissions have to allow children (running as User/Group) to lock it
+#if (((AP_SERVER_MAJORVERSION_NUMBER == 2) && (AP_SERVER_MINORVERSION_NUMBER >= 4)) || (AP_SERVER_MAJORVERSION_NUMBER > 2))
+	rv = ap_global_mutex_create(&ipv6calc_shared_cache_mutex, NULL, IPV6CALC_SHARED_CACHE_MUTEX, NULL, s, pconf, 0);
+#else
+	rv = apr_global_mutex_create(&ipv6calc_shared_cache_mutex, NULL, APR_LOCK_DEFAULT, pconf);
+#ifdef AP_NEED_SET_MUTEX_PERMS
+	if (rv == APR_SUCCESS) {
+		rv = unixd_set_global_mutex_perms(ipv6calc_shared_cache_mutex);
+	};
+#endif
+#endif
+	if (rv != APR_SUCCESS) {
+		ap_log_error(APLOG_MARK, APLOG_ERR, rv, s
+			, "can't create shared cache mutex"
+		);
+		ipv6calc_shared_cache_shm = NULL;
+		return(1);
+	};
+
+	cachep = (s_ipv6calc_shared_cache *) apr_shm_baseaddr_get(ipv6calc_shared_cache_shm);
+	memset(cachep, 0, size);
+	cachep->sets = sets;
+
+	return(0);
+};
+
+
+/*
+ * ipv6calc_shared_cache_find
+ *  return entry of address or NULL, mutex has to be locked by caller
+ */
+static s_ipv6calc_shared_cache_entry *ipv6calc_shared_cache_find(const ipv6calc_ipaddr *ipaddrp, s_ipv6calc_shared_cache_entry **victimp) {
+	s_ipv6calc_shared_cache_entry *entryp, *victim = NULL;
+	uint32_t hash;
+	int i;
+
+	hash = ipaddrp->addr[0] ^ (ipaddrp->addr[1] * 0x9e3779b1u) ^ (ipaddrp->addr[2] * 0x85ebca77u) ^ (ipaddrp->addr[3] * 0xc2b2ae3du) ^ ipaddrp->proto;
+	hash ^= hash >> 16;
+	hash *= 0x7feb352du;
+	hash ^= hash >> 15;
+
+	entryp = (s_ipv6calc_shared_cache_entry *) (ipv6calc_shared_cache + 1) + (hash % ipv6calc_shared_cache->sets) * IPV6CALC_SHARED_CACHE_WAYS;
+
+	for (i = 0; i < IPV6CALC_SHARED_CACHE_WAYS; i++, entryp++) {
+		if (entryp->stamp == 0) {
+			if ((victim == NULL) || (victim->stamp != 0)) {
+				victim = entryp;
+			};
+			continue;
+		};
+
+		if ((entryp->proto == ipaddrp->proto) && (memcmp(entryp->addr, ipaddrp->addr, sizeof(entryp->addr)) == 0)) {
+			return(entryp);
+		};
+
+		if ((victim == NULL) || ((victim->stamp != 0) && (entryp->stamp < victim->stamp))) {
+			victim = entryp;
+		};
+	};
+
+	if (victimp != NULL) {
+		*victimp = victim;
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * ipv6calc_shared_cache_value
+ *  return value buffer of entry selected by tag
+ */
+static char *ipv6calc_shared_cache_value(s_ipv6calc_shared_cache_entry *entryp, const uint32_t tag, size_t *sizep) {
+	switch (tag) {
+		case IPV6CALC_CACHE_TAG_ANON:
+			*sizep = sizeof(entryp->anon);
+			return(entryp->anon);
+		case IPV6CALC_CACHE_TAG_CC:
+			*sizep = sizeof(entryp->cc);
+			return(entryp->cc);
+		case IPV6CALC_CACHE_TAG_ASN:
+			*sizep = sizeof(entryp->asn);
+			return(entryp->asn);
+		case IPV6CALC_CACHE_TAG_REGISTRY:
+			*sizep = sizeof(entryp->registry);
+			return(entryp->registry);
+	};
+
+	*sizep = 0;
+	return(NULL);
+};
+
+
+/*
+ * ipv6calc_shared_cache_lookup
+ *  lookup all enabled actions in shared cache, values are copied into request pool
+ *  return: 1=hit 0=miss
+ */
+static int ipv6calc_shared_cache_lookup(const ipv6calc_server_config *config, request_rec *r, const ipv6calc_ipaddr *ipaddrp, const char **ccp, const char **asnp, const char **registryp, const char **anonp) {
+	s_ipv6calc_shared_cache_entry *entryp, entry;
+	uint8_t required = 0;
+	int hit = 0;
+
+	if (config->action_countrycode == 1) required |= (1 << IPV6CALC_CACHE_TAG_CC);
+	if (config->action_asn == 1)         required |= (1 << IPV6CALC_CACHE_TAG_ASN);
+	if (config->action_registry == 1)    required |= (1 << IPV6CALC_CACHE_TAG_REGISTRY);
+	if (config->action_anonymize == 1)   required |= (1 << IPV6CALC_CACHE_TAG_ANON);
+
+	if (apr_global_mutex_lock(ipv6calc_shared_cache_mutex) != APR_SUCCESS) {
+		return(0);
+	};
+
+	entryp = ipv6calc_shared_cache_find(ipaddrp, NULL);
+	if ((entryp != NULL) && ((entryp->valid & required) == required)) {
+		entryp->stamp = ++ipv6calc_shared_cache->clock;
+		if (entryp->stamp == 0) {
+			// wrap, 0 marks empty entries
+			entryp->stamp = ++ipv6calc_shared_cache->clock;
+		};
+		entry = *entryp;
+		ipv6calc_shared_cache->hit++;
+		hit = 1;
+	} else {
+		ipv6calc_shared_cache->miss++;
+	};
+
+	apr_global_mutex_unlock(ipv6calc_shared_cache_mutex);
+
+	if (hit == 1) {
+		*ccp       = apr_pstrdup(r->pool, entry.cc);
+		*asnp      = apr_pstrdup(r->pool, entry.asn);
+		*registryp = apr_pstrdup(r->pool, entry.registry);
+		*anonp     = apr_pstrdup(r->pool, entry.anon);
+	};
+
+	return(hit);
+};
+
+
+/*
+ * ipv6calc_shared_cache_store
+ *  store value of address in shared cache, least recently used entry of set is evicted
+ */
+static void ipv6calc_shared_cache_store(const ipv6calc_ipaddr *ipaddrp, const uint32_t tag, const char *value) {
+	s_ipv6calc_shared_cache_entry *entryp, *victim = NULL;
+	char *valuep;
+	size_t size;
+
+	if (apr_global_mutex_lock(ipv6calc_shared_cache_mutex) != APR_SUCCESS) {
+		return;
+	};
+
+	entryp = ipv6calc_shared_cache_find(ipaddrp, &victim);
+	if (entryp == NULL) {
+		entryp = victim;
+
+		if (entryp->stamp != 0) {
+			ipv6calc_shared_cache->evict++;
+		} else {
+			ipv6calc_shared_cache->used++;
+		};
+
+		memset(entryp, 0, sizeof(s_ipv6calc_shared_cache_entry));
+		memcpy(entryp->addr, ipaddrp->addr, sizeof(entryp->addr));
+		entryp->proto = ipaddrp->proto;
+	};
+
+	valuep = ipv6calc_shared_cache_value(entryp, tag, &size);
+	if ((valuep != NULL) && (strlen(value) < size)) {
+		memcpy(valuep, value, strlen(value) + 1);
+		entryp->valid |= (1 << tag);
+		ipv6calc_shared_cache->store++;
+	};
+
+	entryp->stamp = ++ipv6calc_shared_cache->clock;
+	if (entryp->stamp == 0) {
+		entryp->stamp = ++ipv6calc_shared_cache->clock;
+	};
+
+	apr_global_mutex_unlock(ipv6calc_shared_cache_mutex);
+};
+
+
+#if APR_HAS_THREADS
+/*
+ * ipv6calc_cache_free
+ *  free cache of a thread
+ */
+static void ipv6calc_cache_free(s_ipv6calc_cache *cachep) {
+	libipaddrcache_cleanup(&cachep->cache);
+	if (cachep->pool != NULL) {
+		apr_pool_destroy(cachep->pool);
+	};
+	free(cachep);
+};
+
+
+/*
+ * ipv6calc_cache_destroy
+ *  destructor of thread key (called on thread exit), keeps counters for statistics
+ */
+static void ipv6calc_cache_destroy(void *data) {
+	s_ipv6calc_cache *cachep = (s_ipv6calc_cache *) data;
+	int i;
+
+	if (cachep == NULL) {
+		return;
+	};
+
+	apr_thread_mutex_lock(ipv6calc_caches_mutex);
+	for (i = 0; i < ipv6calc_caches_num; i++) {
+		if (ipv6calc_caches[i] == cachep) {
+			ipv6calc_caches[i] = ipv6calc_caches[--ipv6calc_caches_num];
+			break;
+		};
+	};
+
+	ipv6calc_cache_checked     += cachep->checked;
+	ipv6calc_cache_hit         += cachep->hit;
+	ipv6calc_cache_lookup_hit  += cachep->cache.hit;
+	ipv6calc_cache_lookup_miss += cachep->cache.miss;
+	ipv6calc_cache_evict       += cachep->cache.evict;
+	apr_thread_mutex_unlock(ipv6calc_caches_mutex);
+
+	ipv6calc_cache_free(cachep);
+};
+#endif
+
+
 /***************************
  * Hooks functions
  ***************************/
@@ -317,6 +671,27 @@ static int ipv6calc_support_init(server_rec *s) {
  * ipv6calc_cleanup
  */
 static apr_status_t ipv6calc_cleanup(void *cfgdata) {
+	// cleanup cache
+#if APR_HAS_THREADS
+	int i;
+
+	if (ipv6calc_cache_key != NULL) {
+		// no destructor call by threads exiting later
+		apr_threadkey_private_delete(ipv6calc_cache_key);
+		ipv6calc_cache_key = NULL;
+	};
+
+	for (i = 0; i < ipv6calc_caches_num; i++) {
+		ipv6calc_cache_free(ipv6calc_caches[i]);
+	};
+	free(ipv6calc_caches);
+	ipv6calc_caches = NULL;
+	ipv6calc_caches_num = 0;
+	ipv6calc_caches_size = 0;
+#else
+	libipaddrcache_cleanup(&ipv6calc_cache.cache);
+#endif
+
 	// cleanup ipv6calc database wrapper
 	libipv6calc_db_wrapper_cleanup();
 	return APR_SUCCESS;
@@ -381,6 +756,12 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 		, (config->action_registry > 0) ? "ON" : "OFF"
 	);
 
+	ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
+		, "%s module lookup: %s"
+		, (config->lazy == 0) ? "default" : "configured"
+		, (config->lazy == 0) ? "each request" : "lazy (on demand)"
+	);
+
 	ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
 		, "%s module debug level: 0x%08x (%d)"
 		, (config->debuglevel == 0) ? "default" : "configured"
@@ -394,14 +775,30 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 		);
 	} else {
 		ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
-			, "module cache: ON (default)  limit=%d (%s)  statistics_interval=%lu (%s)"
+			, "module cache: ON (default)  limit=%d per thread (%s)  statistics_interval=%lu (%s)"
 			, config->cache_limit
-			, (config->cache_limit == IPV6CALC_CACHE_LRI_LIMIT_MIN) ? "default/minimum" : "configured"
+			, (config->cache_limit == IPV6CALC_CACHE_LIMIT_DEFAULT) ? "default" : "configured"
 			, config->cache_statistics_interval
 			, (config->cache_statistics_interval == 0) ? "default" : "configured"
 		);
 	};
 
+	if (config->shared_cache_size > 0) {
+		if (ipv6calc_shared_cache_create(pconf, s, config) != 0) {
+			ap_log_error(APLOG_MARK, APLOG_WARNING, 0, s
+				, "can't create shared cache with size %d (disable shared cache now)"
+				, config->shared_cache_size
+			);
+			config->shared_cache_size = 0;
+		} else {
+			ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
+				, "module shared cache: ON  size=%d entries (%lu bytes)"
+				, config->shared_cache_size
+				, (unsigned long) apr_shm_size_get(ipv6calc_shared_cache_shm)
+			);
+		};
+	};
+
 	result = ipv6calc_support_init(s);
 
 	if (result != 0) {
@@ -484,10 +881,23 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 
 
 
+/*
+ * ipv6calc_cache_entries
+ *  amount of cache entries, one per client address and enabled action (limit is given in addresses)
+ */
+static uint32_t ipv6calc_cache_entries(const ipv6calc_server_config *config) {
+	int actions = config->action_anonymize + config->action_countrycode + config->action_asn + config->action_registry;
+	uint64_t entries = (uint64_t) config->cache_limit * (uint64_t) ((actions > 0) ? actions : 1);
+
+	return((entries > IPADDRCACHE_LIMIT_MAX) ? IPADDRCACHE_LIMIT_MAX : (uint32_t) entries);
+};
+
+
 /*
  * ipv6calc_child_init
  */
 static void ipv6calc_child_init(apr_pool_t *p, server_rec *s) {
+	int threaded = AP_MPMQ_NOT_SUPPORTED;
 
 	apr_pool_cleanup_register(p, NULL, ipv6calc_cleanup, ipv6calc_cleanup);
 
@@ -509,6 +919,52 @@ static void ipv6calc_child_init(apr_pool_t *p, server_rec *s) {
 
 	ipv6calc_support_init(s);
 
+	if ((ap_mpm_query(AP_MPMQ_IS_THREADED, &threaded) == APR_SUCCESS) && (threaded != AP_MPMQ_NOT_SUPPORTED)) {
+		// serialize database lookups
+		if (libipv6calc_db_wrapper_threads_init() != 0) {
+			ap_log_error(APLOG_MARK, APLOG_ERR, 0, s
+				, "threaded MPM, but database wrapper has no thread support (disable module now)"
+			);
+			config->enabled = 0;
+			return;
+		};
+
+		ap_log_error(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, s
+			, "threaded MPM, database lookups are serialized (except BuiltIn/MMAP), cache is per thread"
+		);
+	};
+
+	if (config->cache == 1) {
+#if APR_HAS_THREADS
+		if ((apr_threadkey_private_create(&ipv6calc_cache_key, ipv6calc_cache_destroy, p) != APR_SUCCESS) \
+		    || (apr_thread_mutex_create(&ipv6calc_caches_mutex, APR_THREAD_MUTEX_DEFAULT, p) != APR_SUCCESS)) {
+			ap_log_error(APLOG_MARK, APLOG_WARNING, 0, s
+				, "can't create thread key/mutex for cache (disable cache now)"
+			);
+			config->cache = 0;
+		};
+#else
+		if (libipaddrcache_init(&ipv6calc_cache.cache, ipv6calc_cache_entries(config)) != 0) {
+			ap_log_error(APLOG_MARK, APLOG_WARNING, 0, s
+				, "can't allocate cache with limit %d (disable cache now)"
+				, config->cache_limit
+			);
+			config->cache = 0;
+		};
+#endif
+	};
+
+	if ((config->shared_cache_size > 0) && (ipv6calc_shared_cache_shm != NULL)) {
+		// segment is inherited from parent, mutex has to be reopened
+		if (apr_global_mutex_child_init(&ipv6calc_shared_cache_mutex, apr_global_mutex_lockfile(ipv6calc_shared_cache_mutex), p) != APR_SUCCESS) {
+			ap_log_error(APLOG_MARK, APLOG_WARNING, 0, s
+				, "can't attach shared cache mutex (disable shared cache now)"
+			);
+		} else {
+			ipv6calc_shared_cache = (s_ipv6calc_shared_cache *) apr_shm_baseaddr_get(ipv6calc_shared_cache_shm);
+		};
+	};
+
 	/* check for KeepTypeAsnCC support */
 	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
 	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
@@ -529,9 +985,193 @@ static void ipv6calc_child_init(apr_pool_t *p, server_rec *s) {
 
 
 /*
- * ipv6calc_post_read_request  (ACTION CODE)
+ * ipv6calc_cache_get
+ *  return cache of current thread, created on first call (NULL: not available)
  */
-static int ipv6calc_post_read_request(request_rec *r) {
+static s_ipv6calc_cache *ipv6calc_cache_get(const ipv6calc_server_config *config, request_rec *r) {
+#if APR_HAS_THREADS
+	s_ipv6calc_cache *cachep = NULL, **caches;
+	int size;
+
+	if (apr_threadkey_private_get((void **) &cachep, ipv6calc_cache_key) != APR_SUCCESS) {
+		return(NULL);
+	};
+
+	if (cachep != NULL) {
+		return(cachep);
+	};
+
+	cachep = calloc(1, sizeof(s_ipv6calc_cache));
+	if (cachep == NULL) {
+		return(NULL);
+	};
+
+	// own pool (global parent is thread-safe) for mutex living as long as the thread
+	if ((apr_pool_create(&cachep->pool, NULL) != APR_SUCCESS) \
+	    || (apr_thread_mutex_create(&cachep->mutex, APR_THREAD_MUTEX_DEFAULT, cachep->pool) != APR_SUCCESS)) {
+		ap_log_rerror(APLOG_MARK, APLOG_WARNING, 0, r
+			, "can't create mutex of cache for thread"
+		);
+		ipv6calc_cache_free(cachep);
+		return(NULL);
+	};
+
+	if (libipaddrcache_init(&cachep->cache, ipv6calc_cache_entries(config)) != 0) {
+		ap_log_rerror(APLOG_MARK, APLOG_WARNING, 0, r
+			, "can't allocate cache with limit %d for thread"
+			, config->cache_limit
+		);
+		ipv6calc_cache_free(cachep);
+		return(NULL);
+	};
+
+	// register for statistics and cleanup
+	apr_thread_mutex_lock(ipv6calc_caches_mutex);
+	if (ipv6calc_caches_num == ipv6calc_caches_size) {
+		size = (ipv6calc_caches_size == 0) ? 64 : ipv6calc_caches_size * 2;
+		caches = realloc(ipv6calc_caches, sizeof(s_ipv6calc_cache *) * size);
+		if (caches == NULL) {
+			apr_thread_mutex_unlock(ipv6calc_caches_mutex);
+			ipv6calc_cache_free(cachep);
+			return(NULL);
+		};
+		ipv6calc_caches = caches;
+		ipv6calc_caches_size = size;
+	};
+	ipv6calc_caches[ipv6calc_caches_num++] = cachep;
+	apr_thread_mutex_unlock(ipv6calc_caches_mutex);
+
+	apr_threadkey_private_set(cachep, ipv6calc_cache_key);
+
+	return(cachep);
+#else
+	return(&ipv6calc_cache);
+#endif
+};
+
+
+/*
+ * ipv6calc_cache_lookup
+ *  lookup value in cache of current thread
+ */
+static const char *ipv6calc_cache_lookup(s_ipv6calc_cache *cachep, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag) {
+	const char *value;
+
+	IPV6CALC_CACHE_LOCK(cachep);
+	value = libipaddrcache_lookup(&cachep->cache, ipaddrp, tag);
+	IPV6CALC_CACHE_UNLOCK(cachep);
+
+	// pointer stays valid, only the owning thread modifies the cache
+	return(value);
+};
+
+
+/*
+ * ipv6calc_cache_store
+ *  store value in cache of current thread
+ */
+static void ipv6calc_cache_store(s_ipv6calc_cache *cachep, const ipv6calc_ipaddr *ipaddrp, const uint32_t tag, const char *value) {
+	IPV6CALC_CACHE_LOCK(cachep);
+	libipaddrcache_store(&cachep->cache, ipaddrp, tag, value);
+	IPV6CALC_CACHE_UNLOCK(cachep);
+};
+
+
+/*
+ * ipv6calc_cache_count
+ *  count request and hit in cache of current thread
+ */
+static void ipv6calc_cache_count(s_ipv6calc_cache *cachep, const int hit) {
+	IPV6CALC_CACHE_LOCK(cachep);
+	cachep->checked++;
+	if (hit == 1) {
+		cachep->hit++;
+	};
+	IPV6CALC_CACHE_UNLOCK(cachep);
+};
+
+
+/*
+ * ipv6calc_cache_statistics
+ *  log statistics summarized over all caches (incl. caches of already exited threads)
+ */
+static void ipv6calc_cache_statistics(request_rec *r) {
+	uint64_t checked = 0, hit = 0;
+	unsigned long int lookup_hit = 0, lookup_miss = 0, evict = 0;
+	unsigned long int used = 0, limit = 0;
+	int caches = 0;
+
+#if APR_HAS_THREADS
+	s_ipv6calc_cache *cachep;
+	int i;
+
+	apr_thread_mutex_lock(ipv6calc_caches_mutex);
+	checked     = ipv6calc_cache_checked;
+	hit         = ipv6calc_cache_hit;
+	lookup_hit  = ipv6calc_cache_lookup_hit;
+	lookup_miss = ipv6calc_cache_lookup_miss;
+	evict       = ipv6calc_cache_evict;
+
+	for (i = 0; i < ipv6calc_caches_num; i++) {
+		cachep = ipv6calc_caches[i];
+		IPV6CALC_CACHE_LOCK(cachep);
+		checked     += cachep->checked;
+		hit         += cachep->hit;
+		used        += cachep->cache.used;
+		limit       += cachep->cache.limit;
+		lookup_hit  += cachep->cache.hit;
+		lookup_miss += cachep->cache.miss;
+		evict       += cachep->cache.evict;
+		IPV6CALC_CACHE_UNLOCK(cachep);
+	};
+	caches = ipv6calc_caches_num;
+	apr_thread_mutex_unlock(ipv6calc_caches_mutex);
+#else
+	checked     = ipv6calc_cache.checked;
+	hit         = ipv6calc_cache.hit;
+	used        = ipv6calc_cache.cache.used;
+	limit       = ipv6calc_cache.cache.limit;
+	lookup_hit  = ipv6calc_cache.cache.hit;
+	lookup_miss = ipv6calc_cache.cache.miss;
+	evict       = ipv6calc_cache.cache.evict;
+	caches = 1;
+#endif
+
+	ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+		, "cache statistics: requests=%" APR_UINT64_T_FMT " hits=%" APR_UINT64_T_FMT " (%2" APR_UINT64_T_FMT "%%) caches=%d entries=%lu/%lu lookups: hits=%lu misses=%lu evictions=%lu"
+		, (apr_uint64_t) checked
+		, (apr_uint64_t) hit
+		, (apr_uint64_t) ((checked > 0) ? (hit * 100) / checked : 0)
+		, caches
+		, used
+		, limit
+		, lookup_hit
+		, lookup_miss
+		, evict
+	);
+
+	if (ipv6calc_shared_cache != NULL) {
+		// read without lock
+		ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+			, "shared cache statistics: entries=%u/%u lookups: hits=%lu misses=%lu stores=%lu evictions=%lu"
+			, ipv6calc_shared_cache->used
+			, ipv6calc_shared_cache->sets * IPV6CALC_SHARED_CACHE_WAYS
+			, ipv6calc_shared_cache->hit
+			, ipv6calc_shared_cache->miss
+			, ipv6calc_shared_cache->store
+			, ipv6calc_shared_cache->evict
+		);
+	};
+};
+
+
+/*
+ * ipv6calc_lookup  (ACTION CODE)
+ *  retrieve data of client address and store in r->subprocess_env, only once per request
+ */
+static int ipv6calc_lookup_done;
+
+static int ipv6calc_lookup(request_rec *r) {
 	int i, hit;
 	int pi; // proto index (0:IPv4, 1:IPv6
 	int p_mapped; // proto mapped (IPv6 in IPv4)
@@ -544,6 +1184,10 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 	// ipv6calc related
 	ipv6calc_ipaddr ipaddr;
+	ipv6calc_ipaddr cache_ipaddr;
+	s_ipv6calc_cache *cachep = NULL;
+	apr_uint32_t requests;
+	const char *cached_cc = NULL, *cached_asn = NULL, *cached_registry = NULL, *cached_anon = NULL;
 	ipv6calc_ipv4addr ipv4addr;
 #if APR_HAVE_IPV6
 	ipv6calc_ipv6addr ipv6addr;
@@ -567,6 +1211,12 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		return OK;
 	};
 
+	// check already done
+	if (ap_get_module_config(r->request_config, &ipv6calc_module) != NULL) {
+		return OK;
+	};
+	ap_set_module_config(r->request_config, &ipv6calc_module, &ipv6calc_lookup_done);
+
 	if (config->debuglevel & IPV6CALC_DEBUG_MAP_DEBUG_TO_NOTICE) {
 		mod_ipv6calc_APLOG_DEBUG = APLOG_NOTICE;
 	};
@@ -619,196 +1269,142 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 	/* cache lookup */
 	if (config->cache == 1) {
-		hit = -1;
+		cachep = ipv6calc_cache_get(config, r);
+	};
 
+	if ((cachep != NULL) || (ipv6calc_shared_cache != NULL)) {
+		// build cache key directly from socket address (IPv4-mapped is stored as IPv4)
+		libipaddr_clearall(&cache_ipaddr);
+
+		if (pi == mod_ipv6calc_pi_IPV4) {
+			cache_ipaddr.proto = IPV6CALC_PROTO_IPV4;
+			cache_ipaddr.addr[0] = ntohl((p_mapped == 0) ? client_addr_p->sa.sin.sin_addr.s_addr : client_addr_p->sa.sin6.sin6_addr.s6_addr32[3]);
 #if APR_HAVE_IPV6
-#define IPV6CALC_COMPARE(entry) \
-			     (    pi == mod_ipv6calc_pi_IPV4 \
-			       && ( \
-				      (p_mapped == 0 && ipv6calc_cache_lri_ipv4_token[entry].s_addr == client_addr_p->sa.sin.sin_addr.s_addr) \
-				   || (p_mapped == 1 && ipv6calc_cache_lri_ipv4_token[entry].s_addr == client_addr_p->sa.sin6.sin6_addr.s6_addr32[3]) \
-				  ) \
-			     ) \
-			  || (    pi == mod_ipv6calc_pi_IPV6 \
-			       && ipv6calc_cache_lri_ipv6_token[entry].s6_addr32[3] == client_addr_p->sa.sin6.sin6_addr.s6_addr32[3] \
-			       && ipv6calc_cache_lri_ipv6_token[entry].s6_addr32[2] == client_addr_p->sa.sin6.sin6_addr.s6_addr32[2] \
-			       && ipv6calc_cache_lri_ipv6_token[entry].s6_addr32[1] == client_addr_p->sa.sin6.sin6_addr.s6_addr32[1] \
-			       && ipv6calc_cache_lri_ipv6_token[entry].s6_addr32[0] == client_addr_p->sa.sin6.sin6_addr.s6_addr32[0] \
-			     )
-#else
-#define IPV6CALC_COMPARE(entry) \
-			     (    pi == mod_ipv6calc_pi_IPV4 \
-			       && ipv6calc_cache_lri_ipv4_token[entry].s_addr == client_addr_p->sa.sin.sin_addr.s_addr \
-			     )
+		} else {
+			cache_ipaddr.proto = IPV6CALC_PROTO_IPV6;
+			for (i = 0; i < 4; i++) {
+				cache_ipaddr.addr[i] = ntohl(client_addr_p->sa.sin6.sin6_addr.s6_addr32[i]);
+			};
 #endif
+		};
+
+		if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
+			ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+				, "IPv%s address to lookup in cache: %08x %08x %08x %08x"
+				, (pi == 0) ? "4" : "6"
+				, cache_ipaddr.addr[0]
+				, cache_ipaddr.addr[1]
+				, cache_ipaddr.addr[2]
+				, cache_ipaddr.addr[3]
+			);
+		};
 
+		requests = apr_atomic_inc32(&ipv6calc_cache_requests) + 1;
 
-		if (ipv6calc_cache_lri_max[pi] > 0) {
-			ipv6calc_cache_lri_checked[pi]++;
+		// hit only if all enabled actions are cached
+		hit = (cachep != NULL) ? 1 : 0;
 
-			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
-				if (pi == mod_ipv6calc_pi_IPV4) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "IPv4 address to lookup in cache: %08x"
-						, (p_mapped == 0) ? client_addr_p->sa.sin.sin_addr.s_addr : client_addr_p->sa.sin6.sin6_addr.s6_addr32[3]
-					);
-				} else if (pi == mod_ipv6calc_pi_IPV6) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "IPv6 address to lookup in cache: %08x %08x %08x %08x"
-						, client_addr_p->sa.sin6.sin6_addr.s6_addr32[0]
-						, client_addr_p->sa.sin6.sin6_addr.s6_addr32[1]
-						, client_addr_p->sa.sin6.sin6_addr.s6_addr32[2]
-						, client_addr_p->sa.sin6.sin6_addr.s6_addr32[3]
-					);
-				};
-			};
+		if ((hit == 1) && (config->action_countrycode == 1)) {
+			cached_cc = ipv6calc_cache_lookup(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_CC);
+			hit = (cached_cc != NULL) ? 1 : 0;
+		};
 
-			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_ENTRIES) {
-				for (i = 0; i < ipv6calc_cache_lri_max[pi]; i++) {
-					if (pi == mod_ipv6calc_pi_IPV4) {
-						ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-							, "IPv4 address in cache       %3d: %08x"
-							, i
-							, ipv6calc_cache_lri_ipv4_token[i].s_addr
-						);
-					} else if (pi == mod_ipv6calc_pi_IPV6) {
-						ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-							, "IPv6 address in cache       %3d: %08x %08x %08x %08x"
-							, i
-							, ipv6calc_cache_lri_ipv6_token[i].s6_addr32[0]
-							, ipv6calc_cache_lri_ipv6_token[i].s6_addr32[1]
-							, ipv6calc_cache_lri_ipv6_token[i].s6_addr32[2]
-							, ipv6calc_cache_lri_ipv6_token[i].s6_addr32[3]
-						);
-					};
-				};
-			};
+		if ((hit == 1) && (config->action_asn == 1)) {
+			cached_asn = ipv6calc_cache_lookup(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ASN);
+			hit = (cached_asn != NULL) ? 1 : 0;
+		};
 
-			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
-				ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-					, "check for IPv%s address in cache on last inserted entry: %d"
-					, (pi == 0) ? "4" : "6"
-					, ipv6calc_cache_lri_last[pi] - 1
-				);
-			};
+		if ((hit == 1) && (config->action_registry == 1)) {
+			cached_registry = ipv6calc_cache_lookup(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_REGISTRY);
+			hit = (cached_registry != NULL) ? 1 : 0;
+		};
 
-			/* check last seen one first */
-			if (IPV6CALC_COMPARE(ipv6calc_cache_lri_last[pi] - 1)) {
-				ipv6calc_cache_lri_statistics[pi][0]++;
-				hit = ipv6calc_cache_lri_last[pi] - 1;
-			};
+		if ((hit == 1) && (config->action_anonymize == 1)) {
+			cached_anon = ipv6calc_cache_lookup(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ANON);
+			hit = (cached_anon != NULL) ? 1 : 0;
+		};
 
-			/* run backwards to first entry */
-			if ((hit < 0) && (ipv6calc_cache_lri_last[pi] > 1)) {
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "check for IPv%s address in cache backwards to first entry"
-						, (pi == 0) ? "4" : "6"
-					);
-				};
+		if ((hit == 0) && (ipv6calc_shared_cache != NULL)) {
+			// second level: cache shared by all children
+			hit = ipv6calc_shared_cache_lookup(config, r, &cache_ipaddr, &cached_cc, &cached_asn, &cached_registry, &cached_anon);
 
-				for (i = ipv6calc_cache_lri_last[pi] - 1; i > 0; i--) {
-					if (IPV6CALC_COMPARE(i - 1)) {
-						ipv6calc_cache_lri_statistics[pi][ipv6calc_cache_lri_last[pi] - i]++;
-						hit = i - 1;
-						break;
-					};
-				};
+			if ((hit == 1) && (cachep != NULL)) {
+				if (config->action_countrycode == 1) ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_CC, cached_cc);
+				if (config->action_asn == 1)         ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ASN, cached_asn);
+				if (config->action_registry == 1)    ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_REGISTRY, cached_registry);
+				if (config->action_anonymize == 1)   ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ANON, cached_anon);
 			};
+		};
 
-			/* round robin */ 
-			if ((hit < 0) && (ipv6calc_cache_lri_last[pi] < ipv6calc_cache_lri_max[pi])) {
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "check for IPv%s address in cache round robin from last entry"
-						, (pi == 0) ? "4" : "6"
-					);
-				};
+		// without own cache requests are only covered by shared cache statistics
+		if (cachep != NULL) {
+			ipv6calc_cache_count(cachep, hit);
+		};
 
-				for (i = ipv6calc_cache_lri_max[pi]; i > ipv6calc_cache_lri_last[pi]; i--) {
-					if (IPV6CALC_COMPARE(i - 1)) {
-						ipv6calc_cache_lri_statistics[pi][ipv6calc_cache_lri_max[pi] - i + ipv6calc_cache_lri_last[pi]]++;
-						hit = i - 1;
-						break;
-					};
-				};
-			};
+		// print cache statistics
+		if (	config->cache_statistics_interval > 0
+		    &&  ((requests % config->cache_statistics_interval) == 0)
+		) {
+			ipv6calc_cache_statistics(r);
+		};
 
-			if (hit >= 0) {
+		if (hit == 1) {
+			ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
+				, "retrieve data of IPv%s address from cache"
+				, (pi == 0) ? "4" : "6"
+			);
+
+			if (config->action_countrycode == 1) {
 				ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
-					, "retrieve data of IPv%s address from cache position: %d"
-					, (pi == 0) ? "4" : "6"
-					, hit
+					, "client IP country code (from cache): %s"
+					, cached_cc
 				);
 
-				if (config->action_countrycode == 1) {
-					ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
-						, "client IP country code (from cache): %s"
-						, ipv6calc_cache_lri_value_cc[pi][hit]
-					);
-
-					apr_table_set(r->subprocess_env
-						, "IPV6CALC_CLIENT_COUNTRYCODE"
-						, ipv6calc_cache_lri_value_cc[pi][hit]
-					); 
-				};
-
-				if (config->action_asn == 1) {
-					ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
-						, "client IP ASN (from cache): %s"
-						, ipv6calc_cache_lri_value_asn[pi][hit]
-					);
+				apr_table_set(r->subprocess_env
+					, "IPV6CALC_CLIENT_COUNTRYCODE"
+					, cached_cc
+				); 
+			};
 
-					apr_table_set(r->subprocess_env
-						, "IPV6CALC_CLIENT_ASN"
-						, ipv6calc_cache_lri_value_asn[pi][hit]
-					); 
-				};
+			if (config->action_asn == 1) {
+				ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
+					, "client IP ASN (from cache): %s"
+					, cached_asn
+				);
 
-				if (config->action_registry == 1) {
-					ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
-						, "client IP Registry (from cache): %s"
-						, ipv6calc_cache_lri_value_registry[pi][hit]
-					);
+				apr_table_set(r->subprocess_env
+					, "IPV6CALC_CLIENT_ASN"
+					, cached_asn
+				); 
+			};
 
-					apr_table_set(r->subprocess_env
-						, "IPV6CALC_CLIENT_REGISTRY"
-						, ipv6calc_cache_lri_value_registry[pi][hit]
-					); 
-				};
+			if (config->action_registry == 1) {
+				ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
+					, "client IP Registry (from cache): %s"
+					, cached_registry
+				);
 
-				if (config->action_anonymize == 1) {
-					ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
-						, "client IP address anonymized (from cache): %s"
-						, ipv6calc_cache_lri_value_anon[pi][hit]
-					);
+				apr_table_set(r->subprocess_env
+					, "IPV6CALC_CLIENT_REGISTRY"
+					, cached_registry
+				); 
+			};
 
-					apr_table_set(r->subprocess_env
-						, "IPV6CALC_CLIENT_IP_ANON"
-						, ipv6calc_cache_lri_value_anon[pi][hit]
-					); 
+			if (config->action_anonymize == 1) {
+				ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
+					, "client IP address anonymized (from cache): %s"
+					, cached_anon
+				);
 
-					apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", anon_method_name);
-				};
+				apr_table_set(r->subprocess_env
+					, "IPV6CALC_CLIENT_IP_ANON"
+					, cached_anon
+				); 
 
-				return OK;
+				apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", anon_method_name);
 			};
 
-			// print cache statistics
-			if (	config->cache_statistics_interval > 0
-			    &&  ((ipv6calc_cache_lri_checked[pi] % config->cache_statistics_interval) == 0)
-			) {
-				for (i = 0; i < config->cache_limit; i++) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "cache hit statistics for IPv%s: distance %3d: %lu / %lu (%2lu%%)"
-						, (pi == 0) ? "4" : "6"
-						, i
-						, ipv6calc_cache_lri_statistics[pi][i]
-						, ipv6calc_cache_lri_checked[pi]
-						, (ipv6calc_cache_lri_statistics[pi][i] * 100) / ipv6calc_cache_lri_checked[pi]
-					);
-				};
-			};
+			return OK;
 		};
 	};
 
@@ -838,42 +1434,6 @@ static int ipv6calc_post_read_request(request_rec *r) {
 #endif
 	};
 
-	/* store address in cache */
-	if (config->cache == 1) {
-		if (ipv6calc_cache_lri_max[pi] < config->cache_limit) {
-			ipv6calc_cache_lri_last[pi]++;
-			ipv6calc_cache_lri_max[pi]++;
-		} else {
-			if (ipv6calc_cache_lri_last[pi] == config->cache_limit) {
-				ipv6calc_cache_lri_last[pi] = 1;
-			} else {
-				ipv6calc_cache_lri_last[pi]++;
-			};
-		};
-
-		if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-			ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-				, "store IPv%s address in cache on position: %d"
-				, (pi == 0) ? "4" : "6"
-				, ipv6calc_cache_lri_last[pi] - 1
-			);
-		};
-
-		if (pi == mod_ipv6calc_pi_IPV4) {
-			// store token
-			if (p_mapped == 0) {
-				ipv6calc_cache_lri_ipv4_token[ipv6calc_cache_lri_last[pi] - 1] = client_addr_p->sa.sin.sin_addr;
-			} else {
-				ipv6calc_cache_lri_ipv4_token[ipv6calc_cache_lri_last[pi] - 1].s_addr = client_addr_p->sa.sin6.sin6_addr.s6_addr32[3];
-			};
-#if APR_HAVE_IPV6
-		} else if (pi == mod_ipv6calc_pi_IPV6) {
-			// store token
-			ipv6calc_cache_lri_ipv6_token[ipv6calc_cache_lri_last[pi] - 1] = client_addr_p->sa.sin6.sin6_addr;
-#endif
-		};
-	};
-
 	// retrieve data
 	int result_cc = -1;
 	int result_registry = -1;
@@ -950,14 +1510,17 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_COUNTRYCODE", cc); 
 
-			if (config->cache == 1) {
+			if (ipv6calc_shared_cache != NULL) {
+				ipv6calc_shared_cache_store(&cache_ipaddr, IPV6CALC_CACHE_TAG_CC, cc);
+			};
+
+			if (cachep != NULL) {
 				// store value
-				snprintf(ipv6calc_cache_lri_value_cc[pi][ipv6calc_cache_lri_last[pi] - 1], sizeof(ipv6calc_cache_lri_value_cc[pi][ipv6calc_cache_lri_last[pi] - 1]), "%s", cc);
+				ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_CC, cc);
 				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
 					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store CountryCode of IPv%s address in cache on position: %d"
+						, "store CountryCode of IPv%s address in cache"
 						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
 					);
 				};
 			};
@@ -980,14 +1543,17 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_ASN", asn); 
 
-			if (config->cache == 1) {
+			if (ipv6calc_shared_cache != NULL) {
+				ipv6calc_shared_cache_store(&cache_ipaddr, IPV6CALC_CACHE_TAG_ASN, asn);
+			};
+
+			if (cachep != NULL) {
 				// store value
-				snprintf(ipv6calc_cache_lri_value_asn[pi][ipv6calc_cache_lri_last[pi] - 1], sizeof(ipv6calc_cache_lri_value_asn[pi][ipv6calc_cache_lri_last[pi] - 1]), "%s", asn);
+				ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ASN, asn);
 				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
 					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store ASN of IPv%s address in cache on position: %d"
+						, "store ASN of IPv%s address in cache"
 						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
 					);
 				};
 			};
@@ -1014,14 +1580,17 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_REGISTRY", registry); 
 
-			if (config->cache == 1) {
+			if (ipv6calc_shared_cache != NULL) {
+				ipv6calc_shared_cache_store(&cache_ipaddr, IPV6CALC_CACHE_TAG_REGISTRY, registry);
+			};
+
+			if (cachep != NULL) {
 				// store value
-				snprintf(ipv6calc_cache_lri_value_registry[pi][ipv6calc_cache_lri_last[pi] - 1], sizeof(ipv6calc_cache_lri_value_asn[pi][ipv6calc_cache_lri_last[pi] - 1]), "%s", registry);
+				ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_REGISTRY, registry);
 				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
 					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store Registry of IPv%s address in cache on position: %d"
+						, "store Registry of IPv%s address in cache"
 						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
 					);
 				};
 			};
@@ -1083,15 +1652,18 @@ static int ipv6calc_post_read_request(request_rec *r) {
 #endif
 		};
 
-		if (config->cache == 1) {
+		if (ipv6calc_shared_cache != NULL) {
+			ipv6calc_shared_cache_store(&cache_ipaddr, IPV6CALC_CACHE_TAG_ANON, result_anon_p);
+		};
+
+		if (cachep != NULL) {
 			// store value
-			snprintf(ipv6calc_cache_lri_value_anon[pi][ipv6calc_cache_lri_last[pi] - 1], sizeof(ipv6calc_cache_lri_value_anon[pi][ipv6calc_cache_lri_last[pi] - 1]), "%s", result_anon_p);
+			ipv6calc_cache_store(cachep, &cache_ipaddr, IPV6CALC_CACHE_TAG_ANON, result_anon_p);
 
 			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
 				ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-					, "store anonymized IPv%s address in cache on position: %d"
+					, "store anonymized IPv%s address in cache"
 					, (pi == 0) ? "4" : "6"
-					, ipv6calc_cache_lri_last[pi] - 1
 				);
 			};
 		};
@@ -1104,6 +1676,96 @@ static int ipv6calc_post_read_request(request_rec *r) {
 };
 
 
+/*
+ * ipv6calc_post_read_request
+ */
+static int ipv6calc_post_read_request(request_rec *r) {
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(r->server->module_config, &ipv6calc_module);
+
+	if ((config->enabled == 0) || (config->lazy == 1)) {
+		// lazy: retrieved on demand
+		return OK;
+	};
+
+	return(ipv6calc_lookup(r));
+};
+
+
+/*
+ * ipv6calc_fixups
+ *  lazy: provide environment only to handlers other than the static file one
+ */
+static int ipv6calc_fixups(request_rec *r) {
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(r->server->module_config, &ipv6calc_module);
+
+	if ((config->enabled == 0) || (config->lazy == 0)) {
+		return DECLINED;
+	};
+
+	if ((r->handler == NULL) || (strcmp(r->handler, "default-handler") == 0)) {
+		return DECLINED;
+	};
+
+	ipv6calc_lookup(r);
+
+	return DECLINED;
+};
+
+
+/*
+ * ipv6calc_log_handler
+ *  mod_log_config format %{<name>}w, retrieves data on first use
+ */
+static const char *ipv6calc_log_handler(request_rec *r, char *a) {
+	const char *name;
+
+	if (a == NULL) {
+		return NULL;
+	};
+
+	if (strcmp(a, "anon") == 0) {
+		name = "IPV6CALC_CLIENT_IP_ANON";
+	} else if (strcmp(a, "cc") == 0) {
+		name = "IPV6CALC_CLIENT_COUNTRYCODE";
+	} else if (strcmp(a, "asn") == 0) {
+		name = "IPV6CALC_CLIENT_ASN";
+	} else if (strcmp(a, "registry") == 0) {
+		name = "IPV6CALC_CLIENT_REGISTRY";
+	} else if (strcmp(a, "method") == 0) {
+		name = "IPV6CALC_ANON_METHOD";
+	} else {
+		return NULL;
+	};
+
+	ipv6calc_lookup(r);
+
+	return(apr_table_get(r->subprocess_env, name));
+};
+
+
+/*
+ * ipv6calc_pre_config
+ *  register log format handler and mutex type of shared cache
+ */
+static int ipv6calc_pre_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t *ptemp) {
+	APR_OPTIONAL_FN_TYPE(ap_register_log_handler) *log_pfn_register;
+
+	log_pfn_register = APR_RETRIEVE_OPTIONAL_FN(ap_register_log_handler);
+	if (log_pfn_register != NULL) {
+		log_pfn_register(pconf, "w", ipv6calc_log_handler, 0);
+	};
+
+#if (((AP_SERVER_MAJORVERSION_NUMBER == 2) && (AP_SERVER_MINORVERSION_NUMBER >= 4)) || (AP_SERVER_MAJORVERSION_NUMBER > 2))
+	// mutex of shared cache
+	if (ap_mutex_register(pconf, IPV6CALC_SHARED_CACHE_MUTEX, NULL, APR_LOCK_DEFAULT, 0) != APR_SUCCESS) {
+		return HTTP_INTERNAL_SERVER_ERROR;
+	};
+#endif
+
+	return OK;
+};
+
+
 /***************************
  * Module config option handlers
  ***************************/
@@ -1166,20 +1828,20 @@ static const char *set_ipv6calc_cache_limit(cmd_parms *cmd, void *dummy, const c
 		return NULL;
 	};
 
-	if (atoi(value) < IPV6CALC_CACHE_LRI_LIMIT_MIN) {
+	if (atoi(value) < IPV6CALC_CACHE_LIMIT_MIN) {
 		ap_log_error(APLOG_MARK, APLOG_WARNING, 0, cmd->server
 			, "given cache limit below minimum (%d), skip: %s"
-			, IPV6CALC_CACHE_LRI_LIMIT_MIN
+			, IPV6CALC_CACHE_LIMIT_MIN
 			, value
 		);
 
 		return NULL;
 	};
 
-	if (atoi(value) > IPV6CALC_CACHE_LRI_SIZE) {
+	if (atoi(value) > IPADDRCACHE_LIMIT_MAX) {
 		ap_log_error(APLOG_MARK, APLOG_WARNING, 0, cmd->server
-			, "given cache limit below maximum (%d), skip: %s"
-			, IPV6CALC_CACHE_LRI_SIZE
+			, "given cache limit above maximum (%d), skip: %s"
+			, IPADDRCACHE_LIMIT_MAX
 			, value
 		);
 
@@ -1227,6 +1889,63 @@ static const char *set_ipv6calc_cache_statistics_interval(cmd_parms *cmd, void *
 	return NULL;
 };
 
+
+/*
+ * set_ipv6calc_lazy
+ */
+static const char *set_ipv6calc_lazy(cmd_parms *cmd, void *dummy, int arg) {
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(cmd->server->module_config, &ipv6calc_module);
+	
+	if (!config) {
+		return NULL;
+	};
+	
+	config->lazy = arg;
+	
+	return NULL;
+};
+
+
+/*
+ * set_ipv6calc_shared_cache_size
+ */
+static const char *set_ipv6calc_shared_cache_size(cmd_parms *cmd, void *dummy, const char *value, int arg) {
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(cmd->server->module_config, &ipv6calc_module);
+
+	if (!config) {
+		return NULL;
+	};
+
+	if ((atoi(value) != 0) && (atoi(value) < IPV6CALC_SHARED_CACHE_SIZE_MIN)) {
+		ap_log_error(APLOG_MARK, APLOG_WARNING, 0, cmd->server
+			, "given shared cache size below minimum (%d), skip: %s"
+			, IPV6CALC_SHARED_CACHE_SIZE_MIN
+			, value
+		);
+
+		return NULL;
+	};
+
+	if (atoi(value) > IPV6CALC_SHARED_CACHE_SIZE_MAX) {
+		ap_log_error(APLOG_MARK, APLOG_WARNING, 0, cmd->server
+			, "given shared cache size above maximum (%d), skip: %s"
+			, IPV6CALC_SHARED_CACHE_SIZE_MAX
+			, value
+		);
+
+		return NULL;
+	};
+
+	ap_log_error(APLOG_MARK, APLOG_INFO, 0, cmd->server
+		, "set shared cache size: %s"
+		, value
+	);
+
+	config->shared_cache_size = atoi(value);
+
+	return NULL;
+};
+
 /*
  * set_ipv6calc_debuglevel
  */
@@ -1366,8 +2085,11 @@ static void *ipv6calc_create_svr_conf(apr_pool_t* pool, server_rec* svr) {
 
 	// cache settings
 	svr_cfg->cache = 1; // default: on
-	svr_cfg->cache_limit = IPV6CALC_CACHE_LRI_LIMIT_MIN; /* optimum ?? */
+	svr_cfg->cache_limit = IPV6CALC_CACHE_LIMIT_DEFAULT;
 	svr_cfg->cache_statistics_interval = 0; // disabled
+	svr_cfg->shared_cache_size = 0; // disabled
+
+	svr_cfg->lazy = 0; // default: retrieve on each request
 
 	svr_cfg->debuglevel = 0;
 
@@ -1385,9 +2107,13 @@ static void *ipv6calc_create_svr_conf(apr_pool_t* pool, server_rec* svr) {
  * ipv6calc_register_hooks
  */
 static void ipv6calc_register_hooks(apr_pool_t *p) {
+	static const char * const aszPre[] = { "mod_log_config.c", NULL };
+
+	ap_hook_pre_config(ipv6calc_pre_config, aszPre, NULL, APR_HOOK_MIDDLE);
 	ap_hook_post_config(ipv6calc_post_config, NULL, NULL, APR_HOOK_MIDDLE);
 	ap_hook_child_init(ipv6calc_child_init, NULL, NULL, APR_HOOK_MIDDLE);
 	ap_hook_post_read_request(ipv6calc_post_read_request, NULL, NULL, APR_HOOK_MIDDLE);
+	ap_hook_fixups(ipv6calc_fixups, NULL, NULL, APR_HOOK_MIDDLE);
 };
 
 
@@ -0,0 +1,402 @@
+#!/usr/bin/perl -W
+#
+# Perl converter for ipv6calc databases into memory-mappable ipv6calc database files
+#
+# Project    : ipv6calc/MMAP
+# File       : ipv6calc-db-mmap-generate.pl
+# Version    : $Id$
+# Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GNU GPL version 2
+#
+# Supported input
+#  ipv6calc Berkeley DB file (External/DBIP, subdb 'data' and for IPv4 registry also 'data-iana')
+#  text file with one ipv6calc database line per entry (same format as the 'data' subdb)
+#
+# Output format: see databases/lib/libipv6calc_db_wrapper_MMAP.h
+
+use strict;
+use warnings;
+
+use Getopt::Std;
+use POSIX qw(strftime);
+
+
+my %opts;
+getopts ("t:I:O:D:k:Aqdh?", \%opts);
+
+## types, numbers and feature bits have to match
+##  databases/lib/libipv6calc_db_wrapper_MMAP.h
+##  databases/lib/libipv6calc_db_wrapper.h
+## (library rejects database files with other type, key length or feature bits)
+my %types = (
+	'ipv4-registry'    => { 'number' => 1, 'key_length' => 32, 'features' => (1 << 2) | 0x00400000, 'key_type' => 'first-last' },
+	'ipv6-registry'    => { 'number' => 2, 'key_length' => 64, 'features' => (1 << 3) | 0x00800000, 'key_type' => 'base-mask'  },
+	'ipv4-countrycode' => { 'number' => 3, 'key_length' => 32, 'features' => (1 << 6) | 0x00400000, 'key_type' => 'first-last' },
+	'ipv6-countrycode' => { 'number' => 4, 'key_length' => 64, 'features' => (1 << 7) | 0x00800000, 'key_type' => 'base-mask'  },
+);
+
+my $magic = "I6CMMAP";
+my $version = 1;
+my $byteorder = 0x01020304;
+my $header_length = 88;
+
+my $file_input;
+my $dir_output = ".";
+my $type_string;
+my $key_type;
+my $date;
+my $atomic = 0;
+
+my $types_list = join(", ", sort keys %types);
+
+if (defined $opts{'h'} || defined $opts{'?'}) {
+	print qq|
+Usage:  PROGNAME -t <type> -I <input file> [-O <output directory>] [-D <date>] [-k <key type>] [-A]
+
+Options:
+	-t <type>              database type: $types_list
+	-I <input file>        ipv6calc Berkeley DB file (*.db) or text file with database lines
+	-O <output directory>  optional output directory for database file, default: .
+	-D <date>              optional date of source data, default: taken from Berkeley DB or today
+	-k <key type>          optional key type of text input lines: first-last or base-mask
+	                         default: ipv4-* first-last, ipv6-* base-mask
+	-A                     atomic operation (generate .new and move on success)
+	-d                     debug
+	-q                     quiet
+
+Input line formats (hex values without prefix):
+	IPv4: <first>;<last>;<data>
+	IPv6: <first_00_31>;<first_32_63>;<last_00_31>;<last_32_63>;<data>
+	IPv6: <base_00_31>;<base_32_63>;<mask_00_31>;<mask_32_63>[;<mask_length>];<data>
+
+Nested ranges are resolved in favor of the most specific one.
+|;
+	exit 0;
+};
+
+
+if (defined $opts{'t'}) {
+	$type_string = $opts{'t'};
+};
+
+if (defined $opts{'I'}) {
+	$file_input = $opts{'I'};
+};
+
+if (defined $opts{'O'}) {
+	$dir_output = $opts{'O'};
+};
+
+if (defined $opts{'D'}) {
+	$date = $opts{'D'};
+};
+
+if (defined $opts{'A'}) {
+	$atomic = 1;
+};
+
+if ((! defined $type_string) || (! defined $types{$type_string})) {
+	print "ERROR : no or unsupported type given (-t <TYPE>), supported: $types_list\n";
+	exit 1;
+};
+
+my $type = $types{$type_string};
+
+$key_type = $type->{'key_type'};
+
+if (defined $opts{'k'}) {
+	if ($opts{'k'} !~ /^(first-last|base-mask)$/o) {
+		print "ERROR : unsupported key type given (-k <KEY TYPE>): " . $opts{'k'} . "\n";
+		exit 1;
+	};
+	$key_type = $opts{'k'};
+};
+
+if (! defined $file_input) {
+	print "ERROR : no input file given (-I <FILENAME>)\n";
+	exit 1;
+};
+
+if (! -f $file_input) {
+	print "ERROR : given input file doesn't exist: $file_input\n";
+	exit 1;
+};
+
+if (! -d $dir_output) {
+	print "ERROR : given output directory doesn't exist: $dir_output\n";
+	exit 1;
+};
+
+my $file_output = "$dir_output/ipv6calc-mmap-$type_string.bin";
+my $file_output_orig = $file_output;
+
+if ($atomic == 1) {
+	$file_output .= ".new";
+};
+
+my $key_max = ($type->{'key_length'} == 32) ? 0xffffffff : ~0;
+
+
+## read input lines
+my @lines;
+my @lines_fallback;
+
+if ($file_input =~ /\.db$/o) {
+	# ipv6calc Berkeley DB file, module only required in this case
+	eval { require BerkeleyDB; BerkeleyDB->import(); 1; } || die "ERROR : Perl module BerkeleyDB is required for reading: $file_input\n";
+
+	my %h_info;
+	my @a;
+
+	tie %h_info, 'BerkeleyDB::Btree', -Filename => $file_input, -Subname => 'info', -Flags => BerkeleyDB::DB_RDONLY() || die "Cannot open file $file_input: $! $BerkeleyDB::Error\n";
+	if ((! defined $date) && (defined $h_info{'dbdate'})) {
+		$date = $h_info{'dbdate'};
+	};
+	untie %h_info;
+
+	tie @a, 'BerkeleyDB::Recno', -Filename => $file_input, -Subname => 'data', -Flags => BerkeleyDB::DB_RDONLY() || die "Cannot open file $file_input: $! $BerkeleyDB::Error\n";
+	@lines = @a;
+	untie @a;
+
+	if ($type_string eq "ipv4-registry") {
+		# optional IANA fallback, used only where 'data' has no entry
+		if (tie @a, 'BerkeleyDB::Recno', -Filename => $file_input, -Subname => 'data-iana', -Flags => BerkeleyDB::DB_RDONLY()) {
+			@lines_fallback = @a;
+			untie @a;
+		};
+	};
+} else {
+	my $FILE;
+	open($FILE, "<$file_input") || die "Can't open file: $file_input";
+	while (<$FILE>) {
+		my $line = $_;
+		chomp $line;
+		next if ($line =~ /^\s*(#.*)?$/o);
+		push @lines, $line;
+	};
+	close($FILE);
+};
+
+if (! defined $date) {
+	$date = strftime "%Y%m%d", gmtime;
+};
+
+print "INFO  : input file: $file_input type=$type_string key_type=$key_type date=$date lines=" . scalar(@lines) . " fallback=" . scalar(@lines_fallback) . "\n" if (! defined $opts{'q'});
+
+
+## convert lines into ranges [first, last, data]
+sub parse_lines($) {
+	my $lines_p = shift;
+	my @ranges;
+	my $linecounter = 0;
+
+	foreach my $line (@$lines_p) {
+		$linecounter++;
+
+		my @f = split /;/, $line;
+		my ($first, $last);
+
+		if ($type->{'key_length'} == 32) {
+			if ((scalar(@f) < 3) || ($f[0] !~ /^[0-9a-fA-F]{1,8}$/o) || ($f[1] !~ /^[0-9a-fA-F]{1,8}$/o)) {
+				print "ERROR : unexpected line in input (line: $linecounter): $line\n";
+				exit 1;
+			};
+			$first = hex($f[0]);
+			$last  = hex($f[1]);
+			if ($key_type eq "base-mask") {
+				$first &= $last;
+				$last = $first | (~$last & $key_max);
+			};
+			splice(@f, 0, 2);
+		} else {
+			if ((scalar(@f) < 5) || (grep { $_ !~ /^[0-9a-fA-F]{1,8}$/o } @f[0..3])) {
+				print "ERROR : unexpected line in input (line: $linecounter): $line\n";
+				exit 1;
+			};
+			$first = (hex($f[0]) << 32) | hex($f[1]);
+			$last  = (hex($f[2]) << 32) | hex($f[3]);
+			if ($key_type eq "base-mask") {
+				$first &= $last;
+				$last = $first | (~$last & $key_max);
+				# optional mask length
+				splice(@f, 4, 1) if ((scalar(@f) > 5) && ($f[4] =~ /^[0-9]{1,3}$/o));
+			};
+			splice(@f, 0, 4);
+		};
+
+		if ($first > $last) {
+			print "ERROR : first is greater than last (line: $linecounter): $line\n";
+			exit 1;
+		};
+
+		push @ranges, [ $first, $last, join(";", @f) ];
+	};
+
+	return(\@ranges);
+};
+
+# append range, merge with previous one if adjacent with same data
+sub range_append($$$$) {
+	my ($out_p, $first, $last, $data) = @_;
+
+	return if ((! defined $first) || ($first > $last));
+
+	if ((scalar(@$out_p) > 0) && ($out_p->[-1]->[2] eq $data) && ($out_p->[-1]->[1] != $key_max) && ($out_p->[-1]->[1] + 1 == $first)) {
+		$out_p->[-1]->[1] = $last;
+	} else {
+		push @$out_p, [ $first, $last, $data ];
+	};
+};
+
+# resolve nested ranges into sorted non-overlapping ones, most specific wins
+sub ranges_flatten($) {
+	my $ranges_p = shift;
+	my @out;
+	my @stack;
+	my $pos;
+
+	foreach my $r (sort { $a->[0] <=> $b->[0] || $b->[1] <=> $a->[1] } @$ranges_p) {
+		while (scalar(@stack) > 0) {
+			my $top = $stack[-1];
+			if ($top->[1] < $r->[0]) {
+				# finished before new range
+				range_append(\@out, $pos, $top->[1], $top->[2]);
+				$pos = ($top->[1] == $key_max) ? undef : $top->[1] + 1;
+				pop @stack;
+				next;
+			};
+
+			range_append(\@out, $pos, $r->[0] - 1, $top->[2]) if ($r->[0] > 0);
+			$pos = $r->[0];
+
+			if ($top->[1] < $r->[1]) {
+				# partial overlap, new range wins
+				pop @stack;
+				next;
+			};
+			last;
+		};
+
+		$pos = $r->[0];
+		push @stack, $r;
+	};
+
+	while (scalar(@stack) > 0) {
+		my $top = pop @stack;
+		range_append(\@out, $pos, $top->[1], $top->[2]);
+		$pos = (! defined $pos || $top->[1] == $key_max) ? undef : $top->[1] + 1;
+	};
+
+	return(\@out);
+};
+
+# fill gaps of primary ranges with fallback ranges
+sub ranges_fill($$) {
+	my ($primary_p, $fallback_p) = @_;
+	my @fill;
+	my $j = 0;
+
+	foreach my $b (@$fallback_p) {
+		my ($first, $last, $data) = @$b;
+		my $pos = $first;
+
+		$j++ while (($j < scalar(@$primary_p)) && ($primary_p->[$j]->[1] < $first));
+
+		for (my $k = $j; ($k < scalar(@$primary_p)) && ($primary_p->[$k]->[0] <= $last) && (defined $pos); $k++) {
+			range_append(\@fill, $pos, $primary_p->[$k]->[0] - 1, $data) if ($primary_p->[$k]->[0] > $pos);
+			$pos = ($primary_p->[$k]->[1] >= $last) ? undef : $primary_p->[$k]->[1] + 1;
+		};
+
+		range_append(\@fill, $pos, $last, $data);
+	};
+
+	my @out;
+	foreach my $r (sort { $a->[0] <=> $b->[0] } (@$primary_p, @fill)) {
+		range_append(\@out, $r->[0], $r->[1], $r->[2]);
+	};
+
+	return(\@out);
+};
+
+
+my $ranges_p = ranges_flatten(parse_lines(\@lines));
+
+if (scalar(@lines_fallback) > 0) {
+	$ranges_p = ranges_fill($ranges_p, ranges_flatten(parse_lines(\@lines_fallback)));
+};
+
+if (scalar(@$ranges_p) == 0) {
+	print "ERROR : no entries found in input: $file_input\n";
+	exit 1;
+};
+
+
+## create string pool
+my %pool_offsets;
+my $pool = "";
+
+foreach my $r (@$ranges_p) {
+	next if (defined $pool_offsets{$r->[2]});
+	$pool_offsets{$r->[2]} = length($pool);
+	$pool .= $r->[2] . "\0";
+};
+
+
+## create rows
+my $rows = "";
+
+foreach my $r (@$ranges_p) {
+	if ($type->{'key_length'} == 32) {
+		$rows .= pack("LLL", $r->[0], $r->[1], $pool_offsets{$r->[2]});
+	} else {
+		$rows .= pack("LLLLL", $r->[0] >> 32, $r->[0] & 0xffffffff, $r->[1] >> 32, $r->[1] & 0xffffffff, $pool_offsets{$r->[2]});
+	};
+
+	printf "DEBUG : %0*x-%0*x %s\n", $type->{'key_length'} / 4, $r->[0], $type->{'key_length'} / 4, $r->[1], $r->[2] if (defined $opts{'d'});
+};
+
+
+## create header, see s_ipv6calc_mmap_header
+my $header = pack("a8LLLLLLLLLLqa32",
+	$magic,
+	$byteorder,
+	$version,
+	$type->{'number'},
+	$type->{'features'},
+	$type->{'key_length'},
+	scalar(@$ranges_p),
+	$header_length,
+	$header_length + length($rows),
+	length($pool),
+	0,
+	time,
+	$date
+);
+
+if (length($header) != $header_length) {
+	print "ERROR : unexpected header length (FIX CODE): " . length($header) . "\n";
+	exit 1;
+};
+
+
+## write database file
+if (-f $file_output) {
+	unlink($file_output) || die "Can't delete old file: $file_output";
+};
+
+my $OUT;
+open($OUT, ">$file_output") || die "Can't create file: $file_output";
+binmode($OUT);
+print $OUT $header . $rows . $pool;
+close($OUT) || die "Can't write file: $file_output";
+
+print "INFO  : database created: $file_output rows=" . scalar(@$ranges_p) . " pool=" . length($pool) . "\n" if (! defined $opts{'q'});
+
+if ($atomic == 1) {
+	if (! rename($file_output, $file_output_orig)) {
+		print "ERROR : can't rename file to: $file_output_orig ($!) - delete: $file_output\n";
+		unlink $file_output;
+		exit 1;
+	};
+	print "INFO  : successful rename file to: $file_output_orig\n" if (! defined $opts{'q'});
+};
@@ -0,0 +1,500 @@
+/*
+ * Project    : ipv6calc/tools
+ * File       : ipv6calcbench.c
+ * Version    : $Id$
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Micro-benchmark for the core library functions and the database wrapper
+ *
+ *  Input is a deterministic synthetic address list (same seed -> same list),
+ *  output is tab separated: name, source, ops, ns_per_op, ops_per_s
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <time.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "ipv6calccommands.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcoptions.h"
+
+#include "libipaddr.h"
+#include "libipv4addr.h"
+#include "libipv6addr.h"
+#include "libmac.h"
+#include "librfc1884.h"
+
+#include "../databases/lib/libipv6calc_db_wrapper.h"
+
+#define BENCH_COUNT_DEFAULT	100000
+#define BENCH_SEED_DEFAULT	0x1234abcd
+#define BENCH_STRING_SIZE	64
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+/* define short options */
+static char *ipv6calcbench_shortopts = "h?n:s:";
+
+/* define long options */
+static struct option ipv6calcbench_longopts[] = {
+	{"help"		, 0, 0, (int) 'h'},
+	{"count"	, 1, 0, (int) 'n'},
+	{"seed"		, 1, 0, (int) 's'},
+};
+
+/* synthetic input */
+static char (*bench_strings)[BENCH_STRING_SIZE] = NULL;
+static int bench_strings_num = 0;
+
+static ipv6calc_ipv6addr *bench_ipv6addr = NULL;
+static int bench_ipv6addr_num = 0;
+
+static ipv6calc_ipaddr *bench_ipaddr = NULL;
+static int bench_ipaddr_num = 0;
+
+static ipv6calc_macaddr *bench_macaddr = NULL;
+static int bench_macaddr_num = 0;
+
+/* keeps results alive, otherwise the compiler may drop the calls */
+static volatile uint32_t bench_sink = 0;
+
+/* DB wrapper lookups */
+#define BENCH_DB_REGISTRY	1
+#define BENCH_DB_CC		2
+#define BENCH_DB_AS		3
+#define BENCH_DB_CITY		4
+#define BENCH_DB_IEEE		5
+
+static const struct {
+	const char *name;
+	const int  feature_ipv4;	// -1: not applicable
+	const int  feature_ipv6;	// -1: not applicable
+	const int  type;
+} bench_db_list[] = {
+	{ "db_registry_num_by_ipaddr"	, IPV6CALC_DB_FEATURE_NUM_IPV4_TO_REGISTRY, IPV6CALC_DB_FEATURE_NUM_IPV6_TO_REGISTRY, BENCH_DB_REGISTRY },
+	{ "db_country_code_by_addr"	, IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CC      , IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CC      , BENCH_DB_CC       },
+	{ "db_as_num32_by_addr"		, IPV6CALC_DB_FEATURE_NUM_IPV4_TO_AS      , IPV6CALC_DB_FEATURE_NUM_IPV6_TO_AS      , BENCH_DB_AS       },
+	{ "db_lookup_all_city"		, IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CITY    , IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CITY    , BENCH_DB_CITY     },
+	{ "db_ieee_vendor_by_macaddr"	, IPV6CALC_DB_FEATURE_NUM_IEEE_TO_INFO    , -1                                      , BENCH_DB_IEEE     },
+};
+
+
+/* printhelp */
+static void printhelp(void) {
+	fprintf(stderr, "Usage: ipv6calcbench [-n|--count <number>] [-s|--seed <number>] [<common options>]\n");
+	fprintf(stderr, "  -n|--count <number>  : number of synthetic addresses (default: %d)\n", BENCH_COUNT_DEFAULT);
+	fprintf(stderr, "  -s|--seed <number>   : seed of address generator (default: 0x%08x)\n", BENCH_SEED_DEFAULT);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "  Output is tab separated: name, source, ops, ns_per_op, ops_per_s\n");
+	fprintf(stderr, "  Database lookups are measured for each source providing the feature\n");
+};
+
+
+/* deterministic pseudo random generator (xorshift32) */
+static uint32_t bench_random_state = BENCH_SEED_DEFAULT;
+
+static uint32_t bench_random(void) {
+	uint32_t x = bench_random_state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	bench_random_state = x;
+	return(x);
+};
+
+
+/* monotonic time in nanoseconds */
+static double bench_time_ns(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return((double) ts.tv_sec * 1.0e9 + (double) ts.tv_nsec);
+};
+
+
+/* print one result line */
+static void bench_print(const char *name, const char *source, const int ops, const double ns) {
+	double ns_per_op = 0, ops_per_s = 0;
+
+	if (ops > 0) {
+		ns_per_op = ns / ops;
+	};
+	if (ns > 0) {
+		ops_per_s = ops * 1.0e9 / ns;
+	};
+
+	fprintf(stdout, "%s\t%s\t%d\t%.1f\t%.0f\n", name, source, ops, ns_per_op, ops_per_s);
+};
+
+
+/*
+ * generate synthetic address strings
+ *  mix per 8 entries: 2x IPv4, IPv6 global, 6to4, Teredo, ISATAP, EUI-64 IID, MAC
+ */
+static void bench_generate(const int count) {
+	int i;
+	uint32_t r1, r2, r3, r4;
+
+	for (i = 0; i < count; i++) {
+		r1 = bench_random(); r2 = bench_random(); r3 = bench_random(); r4 = bench_random();
+
+		switch (i % 8) {
+			case 0:
+			case 1:
+				// IPv4 (avoid 0.x and multicast/reserved)
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "%u.%u.%u.%u", (r1 % 223) + 1, r2 & 0xff, r3 & 0xff, (r4 % 254) + 1);
+				break;
+
+			case 2:
+				// IPv6 global
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "%x:%x:%x:%x:%x:%x:%x:%x", 0x2000 | (r1 & 0x0fff), r1 >> 16, r2 & 0xffff, r2 >> 16, r3 & 0xffff, r3 >> 16, r4 & 0xffff, r4 >> 16);
+				break;
+
+			case 3:
+				// 6to4
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "2002:%x:%x:%x::%x", r1 & 0xffff, r1 >> 16, r2 & 0xffff, r3 & 0xffff);
+				break;
+
+			case 4:
+				// Teredo
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "2001:0:%x:%x:%x:%x:%x:%x", r1 & 0xffff, r1 >> 16, r2 & 0xffff, r2 >> 16, r3 & 0xffff, r3 >> 16);
+				break;
+
+			case 5:
+				// ISATAP
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "2001:db8:%x:%x:0:5efe:%u.%u.%u.%u", r1 & 0xffff, r1 >> 16, (r2 % 223) + 1, r3 & 0xff, r4 & 0xff, (r4 >> 8) % 254 + 1);
+				break;
+
+			case 6:
+				// EUI-64 based IID
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "2a01:%x:%x:%x:%x:%xff:fe%02x:%x", r1 & 0xffff, r1 >> 16, r2 & 0xffff, (r3 & 0xfcff) | 0x0200, (r3 >> 16) & 0xff, (r3 >> 24) & 0xff, r4 & 0xffff);
+				break;
+
+			case 7:
+				// MAC
+				snprintf(bench_strings[i], BENCH_STRING_SIZE, "%02x:%02x:%02x:%02x:%02x:%02x", r1 & 0xfc, (r1 >> 8) & 0xff, (r1 >> 16) & 0xff, r2 & 0xff, (r2 >> 8) & 0xff, (r2 >> 16) & 0xff);
+				break;
+		};
+	};
+
+	bench_strings_num = count;
+};
+
+
+/* parse synthetic address strings once for the benchmarks using structures */
+static void bench_prepare(void) {
+	int i, result;
+	uint32_t inputtype;
+	char resultstring[NI_MAXHOST];
+	ipv6calc_ipv4addr ipv4addr;
+
+	for (i = 0; i < bench_strings_num; i++) {
+		inputtype = libipv6calc_autodetectinput(bench_strings[i]);
+
+		if (inputtype == FORMAT_ipv4addr) {
+			result = addr_to_ipv4addrstruct(bench_strings[i], resultstring, sizeof(resultstring), &ipv4addr);
+			if (result == 0) {
+				CONVERT_IPV4ADDRP_IPADDR(&ipv4addr, bench_ipaddr[bench_ipaddr_num]);
+				bench_ipaddr_num++;
+			};
+		} else if (inputtype == FORMAT_ipv6addr) {
+			result = addr_to_ipv6addrstruct(bench_strings[i], resultstring, sizeof(resultstring), &bench_ipv6addr[bench_ipv6addr_num]);
+			if (result == 0) {
+				CONVERT_IPV6ADDRP_IPADDR(&bench_ipv6addr[bench_ipv6addr_num], bench_ipaddr[bench_ipaddr_num]);
+				bench_ipaddr_num++;
+				bench_ipv6addr_num++;
+			};
+		} else if (inputtype == FORMAT_mac) {
+			result = mac_to_macaddrstruct(bench_strings[i], resultstring, sizeof(resultstring), &bench_macaddr[bench_macaddr_num]);
+			if (result == 0) {
+				bench_macaddr_num++;
+			};
+		};
+	};
+};
+
+
+/* benchmarks of the core library */
+static void bench_core(void) {
+	int i, a, ops;
+	double t;
+	char resultstring[NI_MAXHOST];
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	s_ipv6calc_anon_set ipv6calc_anon_set;
+	s_iid_statistics iid_statistics;
+
+	// autodetection
+	t = bench_time_ns();
+	for (i = 0; i < bench_strings_num; i++) {
+		bench_sink += libipv6calc_autodetectinput(bench_strings[i]);
+	};
+	bench_print("libipv6calc_autodetectinput", "-", bench_strings_num, bench_time_ns() - t);
+
+	// parser (IPv6 only)
+	ops = 0;
+	t = bench_time_ns();
+	for (i = 0; i < bench_strings_num; i++) {
+		if ((i % 8) < 2 || (i % 8) == 7) {
+			continue;
+		};
+		bench_sink += addr_to_ipv6addrstruct(bench_strings[i], resultstring, sizeof(resultstring), &ipv6addr);
+		ops++;
+	};
+	bench_print("addr_to_ipv6addrstruct", "-", ops, bench_time_ns() - t);
+
+	// single pass detection and parsing (fast path of the log tools)
+	t = bench_time_ns();
+	for (i = 0; i < bench_strings_num; i++) {
+		bench_sink += libipv6calc_parse_ipaddr_fast(bench_strings[i], &ipv4addr, &ipv6addr);
+	};
+	bench_print("libipv6calc_parse_ipaddr_fast", "-", bench_strings_num, bench_time_ns() - t);
+
+	// formatter
+	t = bench_time_ns();
+	for (i = 0; i < bench_ipv6addr_num; i++) {
+		bench_sink += ipv6addrstruct_to_compaddr(&bench_ipv6addr[i], resultstring, sizeof(resultstring));
+	};
+	bench_print("ipv6addrstruct_to_compaddr", "-", bench_ipv6addr_num, bench_time_ns() - t);
+
+	// anonymization per method
+	for (a = 0; a < MAXENTRIES_ARRAY(ipv6calc_anon_set_list); a++) {
+		if (libipv6calc_anon_set_by_name(&ipv6calc_anon_set, ipv6calc_anon_set_list[a].name) != 0) {
+			continue;
+		};
+
+		if ((ipv6calc_anon_set.method == ANON_METHOD_KEEPTYPEASNCC) && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB | ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) != 1)) {
+			// missing database support
+			continue;
+		};
+
+		t = bench_time_ns();
+		for (i = 0; i < bench_ipv6addr_num; i++) {
+			ipv6addr_copy(&ipv6addr, &bench_ipv6addr[i]);
+			bench_sink += libipv6addr_anonymize(&ipv6addr, &ipv6calc_anon_set);
+		};
+		t = bench_time_ns() - t;
+
+		snprintf(resultstring, sizeof(resultstring), "libipv6addr_anonymize/%s", ipv6calc_anon_set.name);
+		bench_print(resultstring, "-", bench_ipv6addr_num, t);
+	};
+
+	// IID random detection
+	t = bench_time_ns();
+	for (i = 0; i < bench_ipv6addr_num; i++) {
+		bench_sink += ipv6addr_iidrandomdetection(&bench_ipv6addr[i], &iid_statistics);
+	};
+	bench_print("ipv6addr_iidrandomdetection", "-", bench_ipv6addr_num, bench_time_ns() - t);
+};
+
+
+/* one DB lookup */
+static void bench_db_lookup(const int type, const ipv6calc_ipaddr *ipaddrp, const ipv6calc_macaddr *macaddrp) {
+	char resultstring[NI_MAXHOST];
+	s_ipv6calc_db_lookup_all lookup_all;
+
+	switch (type) {
+		case BENCH_DB_REGISTRY:
+			bench_sink += libipv6calc_db_wrapper_registry_num_by_ipaddr(ipaddrp);
+			break;
+
+		case BENCH_DB_CC:
+			bench_sink += libipv6calc_db_wrapper_country_code_by_addr(resultstring, sizeof(resultstring), ipaddrp, NULL);
+			break;
+
+		case BENCH_DB_AS:
+			bench_sink += libipv6calc_db_wrapper_as_num32_by_addr(ipaddrp);
+			break;
+
+		case BENCH_DB_CITY:
+			bench_sink += libipv6calc_db_wrapper_lookup_all(ipaddrp, IPV6CALC_DB_LOOKUP_ALL_CC | IPV6CALC_DB_LOOKUP_ALL_CITY, &lookup_all);
+			break;
+
+		case BENCH_DB_IEEE:
+			bench_sink += libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(resultstring, sizeof(resultstring), macaddrp);
+			break;
+	};
+};
+
+
+/* benchmarks of the database wrapper, each lookup is restricted to one source at a time */
+static void bench_db(void) {
+	int d, s, i, ops;
+	int feature_ipv4, feature_ipv6;
+	double t;
+	char name[NI_MAXHOST];
+
+	for (d = 0; d < MAXENTRIES_ARRAY(bench_db_list); d++) {
+		for (s = 0; s < MAXENTRIES_ARRAY(data_sources); s++) {
+			feature_ipv4 = 0;
+			feature_ipv6 = 0;
+
+			if (bench_db_list[d].feature_ipv4 >= 0) {
+				feature_ipv4 = (libipv6calc_db_wrapper_feature_select_source(bench_db_list[d].feature_ipv4, data_sources[s].number) == 0) ? 1 : 0;
+			};
+			if (bench_db_list[d].feature_ipv6 >= 0) {
+				feature_ipv6 = (libipv6calc_db_wrapper_feature_select_source(bench_db_list[d].feature_ipv6, data_sources[s].number) == 0) ? 1 : 0;
+			};
+
+			if (bench_db_list[d].type == BENCH_DB_IEEE) {
+				if (feature_ipv4 == 1) {
+					t = bench_time_ns();
+					for (i = 0; i < bench_macaddr_num; i++) {
+						bench_db_lookup(bench_db_list[d].type, NULL, &bench_macaddr[i]);
+					};
+					bench_print(bench_db_list[d].name, data_sources[s].shortname, bench_macaddr_num, bench_time_ns() - t);
+				};
+			} else {
+				if (feature_ipv4 == 1) {
+					ops = 0;
+					t = bench_time_ns();
+					for (i = 0; i < bench_ipaddr_num; i++) {
+						if (bench_ipaddr[i].proto != IPV6CALC_PROTO_IPV4) {
+							continue;
+						};
+						bench_db_lookup(bench_db_list[d].type, &bench_ipaddr[i], NULL);
+						ops++;
+					};
+					t = bench_time_ns() - t;
+					snprintf(name, sizeof(name), "%s/ipv4", bench_db_list[d].name);
+					bench_print(name, data_sources[s].shortname, ops, t);
+				};
+
+				if (feature_ipv6 == 1) {
+					ops = 0;
+					t = bench_time_ns();
+					for (i = 0; i < bench_ipaddr_num; i++) {
+						if (bench_ipaddr[i].proto != IPV6CALC_PROTO_IPV6) {
+							continue;
+						};
+						bench_db_lookup(bench_db_list[d].type, &bench_ipaddr[i], NULL);
+						ops++;
+					};
+					t = bench_time_ns() - t;
+					snprintf(name, sizeof(name), "%s/ipv6", bench_db_list[d].name);
+					bench_print(name, data_sources[s].shortname, ops, t);
+				};
+			};
+
+			// restore selection
+			if (bench_db_list[d].feature_ipv4 >= 0) {
+				libipv6calc_db_wrapper_feature_select_source(bench_db_list[d].feature_ipv4, 0);
+			};
+			if (bench_db_list[d].feature_ipv6 >= 0) {
+				libipv6calc_db_wrapper_feature_select_source(bench_db_list[d].feature_ipv6, 0);
+			};
+		};
+	};
+};
+
+
+/**************************************************/
+/* main */
+int main(int argc, char *argv[]) {
+	int i, lop, result;
+	int count = BENCH_COUNT_DEFAULT;
+	uint32_t seed = BENCH_SEED_DEFAULT;
+
+	/* options */
+	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
+	char   shortopts[NI_MAXHOST] = "";
+	int    longopts_maxentries = 0;
+
+	/* initialize debug value from environment for bootstrap debugging */
+	ipv6calc_debug_from_env(); // ipv6calc_debug usage ok
+
+	/* add options */
+	ipv6calc_options_add_common_basic(shortopts, sizeof(shortopts), longopts, &longopts_maxentries);
+	ipv6calc_options_add(shortopts, sizeof(shortopts), longopts, &longopts_maxentries, ipv6calcbench_shortopts, ipv6calcbench_longopts, MAXENTRIES_ARRAY(ipv6calcbench_longopts));
+
+	/* initialize options from environment */
+	ipv6calc_common_options_from_env(longopts, NULL);
+
+	/* Fetch the command-line arguments. */
+	while ((i = getopt_long(argc, argv, shortopts, longopts, &lop)) != EOF) {
+		/* catch common options */
+		result = ipv6calcoptions_common_basic(i, optarg, longopts);
+		if (result == 0) {
+			// found
+			continue;
+		};
+
+		switch (i) {
+			case 'n':
+				count = atoi(optarg);
+				if (count <= 0) {
+					fprintf(stderr, " Count must be greater than 0: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case 's':
+				seed = (uint32_t) strtoul(optarg, NULL, 0);
+				if (seed == 0) {
+					fprintf(stderr, " Seed must not be 0: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case 'h':
+			case '?':
+				printhelp();
+				exit(EXIT_FAILURE);
+				break;
+
+			default:
+				fprintf(stderr, "Usage: (see '%s --help' for more help)\n", "ipv6calcbench");
+				exit(EXIT_FAILURE);
+				break;
+		};
+	};
+
+	/* do work depending on selection */
+	if (ipv6calc_quiet == 0) {
+		ipv6calc_quiet = 1; // avoid info messages of database wrapper
+	};
+
+	result = libipv6calc_db_wrapper_init("");
+	if (result != 0) {
+		fprintf(stderr, " Database wrapper initialization failed\n");
+		exit(EXIT_FAILURE);
+	};
+
+	bench_strings  = malloc(sizeof(*bench_strings) * count);
+	bench_ipv6addr = malloc(sizeof(ipv6calc_ipv6addr) * count);
+	bench_ipaddr   = malloc(sizeof(ipv6calc_ipaddr) * count);
+	bench_macaddr  = malloc(sizeof(ipv6calc_macaddr) * count);
+
+	if ((bench_strings == NULL) || (bench_ipv6addr == NULL) || (bench_ipaddr == NULL) || (bench_macaddr == NULL)) {
+		fprintf(stderr, " Can't allocate memory for %d addresses\n", count);
+		exit(EXIT_FAILURE);
+	};
+
+	bench_random_state = seed;
+	bench_generate(count);
+	bench_prepare();
+
+	fprintf(stdout, "# ipv6calcbench version=%s count=%d seed=0x%08x ipv4=%d ipv6=%d mac=%d\n", IPV6CALC_PACKAGE_VERSION_STRING, count, seed, bench_ipaddr_num - bench_ipv6addr_num, bench_ipv6addr_num, bench_macaddr_num);
+	fprintf(stdout, "# name\tsource\tops\tns_per_op\tops_per_s\n");
+
+	bench_core();
+	bench_db();
+
+	free(bench_strings);
+	free(bench_ipv6addr);
+	free(bench_ipaddr);
+	free(bench_macaddr);
+
+	libipv6calc_db_wrapper_cleanup();
+
+	exit(EXIT_SUCCESS);
+};